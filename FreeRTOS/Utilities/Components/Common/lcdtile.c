@@ -0,0 +1,174 @@
+/**
+ * @file lcdtile.c
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+#include "lcdtile.h"
+#include "pixel.h"
+#include <assert.h>
+#include <string.h>
+
+static inline uint8_t LCDTILE_IsDirty(const LCDTILE_t* t, uint32_t n) {
+	return (t->dirty[n >> 5] >> (n & 31)) & 1;
+}
+
+static inline void LCDTILE_Clear(LCDTILE_t* t, uint32_t n) {
+	t->dirty[n >> 5] &= ~(1UL << (n & 31));
+}
+
+/**
+ * @brief Ritaglia un rettangolo sul display.
+ * @return 0 se il rettangolo e' esterno al display, 1 altrimenti
+ */
+static uint8_t LCDTILE_Clip(const LCDTILE_t* t, uint16_t* x, uint16_t* y, uint16_t* w, uint16_t* h) {
+	if (*x >= t->width || *y >= t->height || *w == 0 || *h == 0)
+		return 0;
+	if (*w > t->width - *x)
+		*w = t->width - *x;
+	if (*h > t->height - *y)
+		*h = t->height - *y;
+	return 1;
+}
+
+/**
+ * @brief Marca i tile di un rettangolo gia' ritagliato sul display.
+ */
+static void LCDTILE_Mark(LCDTILE_t* t, uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+	uint32_t tx0 = x >> LCDTILE_SHIFT, tx1 = (uint32_t)(x + w - 1) >> LCDTILE_SHIFT;
+	uint32_t ty1 = (uint32_t)(y + h - 1) >> LCDTILE_SHIFT;
+	for (uint32_t ty = y >> LCDTILE_SHIFT; ty <= ty1; ty++)
+		for (uint32_t n = ty * t->tilesX + tx0; n <= ty * t->tilesX + tx1; n++)
+			t->dirty[n >> 5] |= 1UL << (n & 31);
+}
+
+/**
+ * @brief Invia un rettangolo del back buffer al display.
+ */
+static void LCDTILE_Send(LCDTILE_t* t, uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+	const uint16_t* src = t->buffer + (uint32_t)y * t->width + x;
+	if (t->drv->BlitRect)
+		t->drv->BlitRect(x, y, w, h, src, t->width);
+	else
+		for (uint16_t j = 0; j < h; j++, src += t->width)
+			for (uint16_t i = 0; i < w; i++)
+				t->drv->WritePixel(x + i, y + j, src[i]);
+	t->stats.rects++;
+	t->stats.pixels += (uint32_t)w * h;
+}
+
+void LCDTILE_Init(LCDTILE_t* t, LCD_DrvTypeDef* drv, uint16_t* buffer, uint16_t width, uint16_t height) {
+	assert(t && drv && buffer);
+	assert(drv->BlitRect || drv->WritePixel);
+	assert(width > 0 && height > 0);
+	memset(t, 0, sizeof(LCDTILE_t));
+	t->drv = drv;
+	t->buffer = buffer;
+	t->width = width;
+	t->height = height;
+	t->tilesX = (width + LCDTILE_SIZE - 1) >> LCDTILE_SHIFT;
+	t->tilesY = (height + LCDTILE_SIZE - 1) >> LCDTILE_SHIFT;
+	assert((uint32_t)t->tilesX * t->tilesY <= LCDTILE_MAX_TILES);
+}
+
+void LCDTILE_Invalidate(LCDTILE_t* t, uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+	assert(t);
+	if (LCDTILE_Clip(t, &x, &y, &w, &h))
+		LCDTILE_Mark(t, x, y, w, h);
+}
+
+void LCDTILE_InvalidateAll(LCDTILE_t* t) {
+	assert(t);
+	LCDTILE_Mark(t, 0, 0, t->width, t->height);
+}
+
+void LCDTILE_FillRect(LCDTILE_t* t, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color) {
+	assert(t);
+	if (!LCDTILE_Clip(t, &x, &y, &w, &h))
+		return;
+	uint16_t* dst = t->buffer + (uint32_t)y * t->width + x;
+	for (uint16_t j = 0; j < h; j++, dst += t->width)
+		PIXEL_Fill(dst, color, w);
+	LCDTILE_Mark(t, x, y, w, h);
+}
+
+void LCDTILE_BlitRect(LCDTILE_t* t, uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint16_t* src,
+		uint16_t pitch) {
+	assert(t && src);
+	uint16_t cx = x, cy = y;
+	if (!LCDTILE_Clip(t, &cx, &cy, &w, &h))
+		return;
+	src += (uint32_t)(cy - y) * pitch + (cx - x);
+	uint16_t* dst = t->buffer + (uint32_t)cy * t->width + cx;
+	for (uint16_t j = 0; j < h; j++, dst += t->width, src += pitch)
+		memcpy(dst, src, w * sizeof(uint16_t));
+	LCDTILE_Mark(t, cx, cy, w, h);
+}
+
+void LCDTILE_BlendRect(LCDTILE_t* t, uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint16_t* src,
+		uint16_t pitch, uint8_t alpha) {
+	assert(t && src);
+	uint16_t cx = x, cy = y;
+	if (alpha == 0 || !LCDTILE_Clip(t, &cx, &cy, &w, &h))
+		return;
+	src += (uint32_t)(cy - y) * pitch + (cx - x);
+	uint16_t* dst = t->buffer + (uint32_t)cy * t->width + cx;
+	for (uint16_t j = 0; j < h; j++, dst += t->width, src += pitch)
+		PIXEL_Blend(dst, src, alpha, w);
+	LCDTILE_Mark(t, cx, cy, w, h);
+}
+
+uint32_t LCDTILE_Flush(LCDTILE_t* t) {
+	assert(t);
+	uint32_t pixels = t->stats.pixels;
+	for (uint32_t ty = 0; ty < t->tilesY; ty++) {
+		uint32_t row = ty * t->tilesX;
+		uint32_t tx = 0;
+		while (tx < t->tilesX) {
+			if (!LCDTILE_IsDirty(t, row + tx)) {
+				tx++;
+				continue;
+			}
+			/* sequenza di tile modificati della riga */
+			uint32_t tx0 = tx;
+			for (; tx < t->tilesX && LCDTILE_IsDirty(t, row + tx); tx++)
+				LCDTILE_Clear(t, row + tx);
+			/* estensione verso il basso, finche' le righe successive sono modificate per tutta la larghezza */
+			uint32_t ty1 = ty + 1;
+			for (; ty1 < t->tilesY; ty1++) {
+				uint32_t n = ty1 * t->tilesX;
+				uint32_t k = tx0;
+				while (k < tx && LCDTILE_IsDirty(t, n + k))
+					k++;
+				if (k < tx)
+					break;
+				for (k = tx0; k < tx; k++)
+					LCDTILE_Clear(t, n + k);
+			}
+			t->stats.tiles += (tx - tx0) * (ty1 - ty);
+			uint32_t x = tx0 << LCDTILE_SHIFT, y = ty << LCDTILE_SHIFT;
+			uint32_t x1 = tx << LCDTILE_SHIFT, y1 = ty1 << LCDTILE_SHIFT;
+			if (x1 > t->width)
+				x1 = t->width;
+			if (y1 > t->height)
+				y1 = t->height;
+			LCDTILE_Send(t, x, y, x1 - x, y1 - y);
+		}
+	}
+	pixels = t->stats.pixels - pixels;
+	if (pixels > 0)
+		t->stats.flushes++;
+	return pixels;
+}
@@ -0,0 +1,99 @@
+/**
+ * @file pixel.h
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+#ifndef PIXEL_H_
+#define PIXEL_H_
+
+/**
+ * @addtogroup BSP
+ * @{
+ * @addtogroup Components
+ * @{
+ * @defgroup PIXEL
+ * @{
+ *
+ * @brief Conversione e fusione (alpha blending) di blocchi di pixel RGB565.
+ *
+ * @details
+ * I controller LCD dei componenti (ST7789H2, ST7735, ...) ricevono pixel RGB565; le immagini possono pero' essere in
+ * ARGB8888 o RGB888 e i disegni semitrasparenti richiedono la fusione con il contenuto gia' presente. Le funzioni del
+ * modulo operano su righe di pixel in RAM, da inviare poi al display con le operazioni di trasferimento a blocchi dei
+ * driver (LCD_DrvTypeDef::BlitRect, LCD_DrvTypeDef::WritePixels).
+ *
+ * La fusione usa un alpha a 5 bit (0..32), ottenuto arrotondando l'alpha a 8 bit: per ogni canale
+ * out = (src * a + dst * (32 - a)) >> 5. Su Cortex-M4 i tre canali di un pixel sono distribuiti in una parola a 32 bit
+ * (0x07E0F81F), per cui la fusione di un pixel costa una sola moltiplicazione; con SSE2 (host x86) gli stessi calcoli
+ * sono svolti su 8 pixel alla volta, con risultati identici bit a bit.<br>
+ * Il modulo non dipende dalla libreria HAL, per cui puo' essere compilato e verificato anche su un host.
+ */
+
+#include <inttypes.h>
+
+/**
+ * @brief Compone un pixel RGB565 a partire dalle componenti a 8 bit.
+ */
+#define PIXEL_RGB565(r, g, b)	((uint16_t)((((r) & 0xF8) << 8) | (((g) & 0xFC) << 3) | ((b) >> 3)))
+
+/**
+ * @brief Riempie n pixel con lo stesso colore.
+ * @param[out] dst pixel di destinazione
+ * @param[in] color colore RGB565
+ * @param[in] n numero di pixel
+ */
+void PIXEL_Fill(uint16_t* dst, uint16_t color, uint32_t n);
+
+/**
+ * @brief Converte n pixel ARGB8888 in RGB565; l'alpha e' ignorato.
+ * @param[out] dst pixel RGB565
+ * @param[in] src pixel ARGB8888
+ * @param[in] n numero di pixel
+ */
+void PIXEL_FromARGB8888(uint16_t* dst, const uint32_t* src, uint32_t n);
+
+/**
+ * @brief Converte n pixel RGB888, memorizzati come nei file BMP (blu, verde, rosso), in RGB565.
+ * @param[out] dst pixel RGB565
+ * @param[in] src pixel RGB888, 3 byte per pixel
+ * @param[in] n numero di pixel
+ */
+void PIXEL_FromRGB888(uint16_t* dst, const uint8_t* src, uint32_t n);
+
+/**
+ * @brief Fonde n pixel RGB565 sulla destinazione con un alpha costante.
+ * @param[inout] dst pixel RGB565 di sfondo, sostituiti dal risultato
+ * @param[in] src pixel RGB565 in primo piano
+ * @param[in] alpha opacita' di src, da 0 (trasparente) a 255 (opaco)
+ * @param[in] n numero di pixel
+ */
+void PIXEL_Blend(uint16_t* dst, const uint16_t* src, uint8_t alpha, uint32_t n);
+
+/**
+ * @brief Fonde n pixel ARGB8888 sulla destinazione, ciascuno con il proprio alpha.
+ * @param[inout] dst pixel RGB565 di sfondo, sostituiti dal risultato
+ * @param[in] src pixel ARGB8888 in primo piano
+ * @param[in] n numero di pixel
+ */
+void PIXEL_BlendARGB8888(uint16_t* dst, const uint32_t* src, uint32_t n);
+
+/**
+ * @}
+ * @}
+ * @}
+ */
+
+#endif /* PIXEL_H_ */
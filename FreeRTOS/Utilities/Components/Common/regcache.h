@@ -0,0 +1,197 @@
+/**
+ * @file regcache.h
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+#ifndef REGCACHE_H_
+#define REGCACHE_H_
+
+/**
+ * @addtogroup BSP
+ * @{
+ * @addtogroup Components
+ * @{
+ * @defgroup REGCACHE
+ * @{
+ *
+ * @brief Copia in RAM dei registri di configurazione di un dispositivo I2C/SPI.
+ *
+ * @details
+ * I driver dei componenti leggono un registro di controllo, ne modificano alcuni bit e lo riscrivono: ogni modifica
+ * costa due transazioni sul bus, anche quando il valore del registro e' gia' noto, e molte sequenze riscrivono valori
+ * che il dispositivo contiene gia'. Il modulo mantiene una copia dei registri di una finestra di indirizzi contigui:
+ *  - il driver dichiara quali registri sono memorizzabili (REGCACHE_Cacheable()); tutti gli altri (stato, dati,
+ *    registri che si modificano da soli) sono volatili e vengono sempre letti e scritti sul bus;
+ *  - le letture di un registro memorizzabile il cui valore e' noto sono servite dalla RAM (REGCACHE_Read());
+ *  - le scritture di un valore gia' presente nel dispositivo sono omesse (REGCACHE_Write());
+ *  - le scritture possono essere accumulate (REGCACHE_Stage()) e poi inviate in ordine crescente di indirizzo,
+ *    raggruppando i registri consecutivi in un'unica transazione se il dispositivo prevede l'auto-incremento
+ *    dell'indirizzo (REGCACHE_NextRun()); i valori inviati diventano noti solo quando il driver conferma che la
+ *    transazione e' riuscita (REGCACHE_Complete()).
+ *
+ * Il valore contenuto nel dispositivo e quello accumulato sono conservati separatamente: accumulare piu' volte lo
+ * stesso valore, o scrivere subito un valore accumulato, non fa credere che il dispositivo lo contenga gia'.
+ *
+ * Il modulo non accede al bus: le transazioni restano al driver, che usa le proprie funzioni di IO. Dopo ogni reset
+ * del dispositivo (o reboot, o power-down che non conserva i registri) il driver deve chiamare REGCACHE_Invalidate().
+ * <br>
+ * Una struttura azzerata (per esempio una variabile statica mai inizializzata) ha una finestra vuota e si comporta
+ * come se tutti i registri fossero volatili, per cui e' sempre sicuro usarla.<br>
+ * Il modulo non dipende dalla libreria HAL, per cui puo' essere compilato e verificato anche su un host.
+ */
+
+#include <inttypes.h>
+
+#ifndef REGCACHE_MAX_REGS
+#define REGCACHE_MAX_REGS		64		//!< Registri della finestra, al piu' 64
+#endif
+
+#if REGCACHE_MAX_REGS > 64
+#error "REGCACHE_MAX_REGS deve essere al piu' 64"
+#endif
+
+/**
+ * @brief Contatori del traffico risparmiato o generato.
+ */
+typedef struct {
+	uint32_t readHits;		//!< letture servite dalla RAM
+	uint32_t readMisses;	//!< letture lasciate al bus
+	uint32_t writesSkipped;	//!< scritture omesse perche' il valore era gia' nel dispositivo
+	uint32_t writes;		//!< registri scritti sul bus
+	uint32_t runs;			//!< transazioni restituite da REGCACHE_NextRun()
+} REGCACHE_Stats_t;
+
+/**
+ * @brief Struttura che rappresenta la copia dei registri di un dispositivo.
+ */
+typedef struct {
+	uint8_t base;						//!< indirizzo del primo registro della finestra
+	uint8_t count;						//!< registri della finestra
+	uint64_t cacheable;					//!< bit n: il registro base+n e' memorizzabile
+	uint64_t valid;						//!< bit n: value[n] e' il valore contenuto nel dispositivo
+	uint64_t dirty;						//!< bit n: staged[n] e' da scrivere sul dispositivo
+	uint8_t value[REGCACHE_MAX_REGS];	//!< valori contenuti nel dispositivo
+	uint8_t staged[REGCACHE_MAX_REGS];	//!< valori da scrivere, o in corso di scrittura
+	REGCACHE_Stats_t stats;				//!< contatori
+} REGCACHE_t;
+
+/**
+ * @brief Inizializza la copia dei registri: tutti volatili, nessun valore noto.
+ * @param[out] c puntatore alla copia dei registri
+ * @param[in] base indirizzo del primo registro della finestra
+ * @param[in] count registri della finestra, al piu' REGCACHE_MAX_REGS
+ */
+void REGCACHE_Init(REGCACHE_t* c, uint8_t base, uint8_t count);
+
+/**
+ * @brief Dichiara memorizzabili i registri da first a last, compresi.
+ * @details Un registro e' memorizzabile se il suo valore cambia solo per effetto delle scritture del driver. I bit che
+ * il dispositivo azzera da solo (per esempio un comando di reboot) vanno rimossi dal valore scritto con
+ * REGCACHE_Write(), o il registro va trattato come volatile.
+ * @param[inout] c puntatore alla copia dei registri
+ * @param[in] first primo registro, nella finestra
+ * @param[in] last ultimo registro, nella finestra
+ */
+void REGCACHE_Cacheable(REGCACHE_t* c, uint8_t first, uint8_t last);
+
+/**
+ * @brief Dimentica i valori noti e le scritture accumulate, dopo un reset del dispositivo.
+ * @param[inout] c puntatore alla copia dei registri
+ */
+void REGCACHE_Invalidate(REGCACHE_t* c);
+
+/**
+ * @brief Legge un registro dalla RAM, se possibile.
+ * @details Se la funzione restituisce 0 il driver legge il registro dal bus e ne comunica il valore con
+ * REGCACHE_Fill(). Se il registro ha una scrittura accumulata, viene restituito il valore accumulato.
+ * @param[inout] c puntatore alla copia dei registri
+ * @param[in] reg indirizzo del registro
+ * @param[out] value valore del registro, se noto
+ * @return 1 se il valore e' noto, 0 se va letto dal bus
+ */
+uint8_t REGCACHE_Read(REGCACHE_t* c, uint8_t reg, uint8_t* value);
+
+/**
+ * @brief Registra il valore di un registro letto dal bus.
+ * @param[inout] c puntatore alla copia dei registri
+ * @param[in] reg indirizzo del registro
+ * @param[in] value valore letto; ignorato se il registro e' volatile
+ */
+void REGCACHE_Fill(REGCACHE_t* c, uint8_t reg, uint8_t value);
+
+/**
+ * @brief Registra la scrittura immediata di un registro.
+ * @details Se la funzione restituisce 1 il driver scrive il registro sul bus, e il valore e' considerato subito
+ * contenuto nel dispositivo; se la scrittura fallisce, il driver lo comunica con REGCACHE_Complete(). Eventuali
+ * scritture accumulate dello stesso registro sono annullate.
+ * @param[inout] c puntatore alla copia dei registri
+ * @param[in] reg indirizzo del registro
+ * @param[in] value valore da scrivere
+ * @return 1 se il valore va scritto sul bus, 0 se il dispositivo lo contiene gia'
+ */
+uint8_t REGCACHE_Write(REGCACHE_t* c, uint8_t reg, uint8_t value);
+
+/**
+ * @brief Accumula la scrittura di un registro, da inviare con REGCACHE_NextRun().
+ * @details Accumulare piu' volte lo stesso registro ne invia solo l'ultimo valore; un valore gia' presente nel
+ * dispositivo annulla la scrittura accumulata. I registri volatili vengono sempre scritti.
+ * @param[inout] c puntatore alla copia dei registri
+ * @param[in] reg indirizzo del registro, nella finestra
+ * @param[in] value valore da scrivere
+ */
+void REGCACHE_Stage(REGCACHE_t* c, uint8_t reg, uint8_t value);
+
+/**
+ * @brief Restituisce la prossima sequenza di registri consecutivi da scrivere con un'unica transazione.
+ * @details Le sequenze sono restituite in ordine crescente di indirizzo. Una sequenza comprende anche fino a bridge
+ * registri memorizzabili non modificati, il cui valore e' noto, per unire due sequenze vicine: con bridge pari a 0, o
+ * se il dispositivo non prevede l'auto-incremento e maxLength vale 1, ogni registro ha la propria transazione.<br>
+ * Il driver invia i registri restituiti e comunica l'esito con REGCACHE_Complete() prima di chiamare di nuovo la
+ * funzione: fino ad allora i valori inviati non sono considerati contenuti nel dispositivo.
+ * @param[inout] c puntatore alla copia dei registri
+ * @param[out] reg indirizzo del primo registro della sequenza
+ * @param[in] bridge numero massimo di registri non modificati da riscrivere per unire due sequenze
+ * @param[in] maxLength lunghezza massima di una sequenza, almeno 1
+ * @return numero di registri della sequenza, i cui valori sono in REGCACHE_Data(c, *reg); 0 se non ci sono scritture
+ * accumulate
+ */
+uint8_t REGCACHE_NextRun(REGCACHE_t* c, uint8_t* reg, uint8_t bridge, uint8_t maxLength);
+
+/**
+ * @brief Comunica l'esito della scrittura di una sequenza di registri.
+ * @details Se la scrittura e' riuscita, i valori inviati diventano i valori noti dei registri memorizzabili; se e'
+ * fallita, il contenuto dei registri non e' piu' noto e la scrittura successiva li inviera' di nuovo.
+ * @param[inout] c puntatore alla copia dei registri
+ * @param[in] reg indirizzo del primo registro, come restituito da REGCACHE_NextRun() o passato a REGCACHE_Write()
+ * @param[in] length numero di registri
+ * @param[in] status 0 se la scrittura e' riuscita, diverso da 0 altrimenti
+ */
+void REGCACHE_Complete(REGCACHE_t* c, uint8_t reg, uint8_t length, uint8_t status);
+
+/**
+ * @brief Restituisce il puntatore ai valori da scrivere a partire da un registro della finestra.
+ * @param[in] c puntatore alla copia dei registri
+ * @param[in] reg indirizzo del registro, nella finestra
+ */
+uint8_t* REGCACHE_Data(REGCACHE_t* c, uint8_t reg);
+
+/**
+ * @}
+ * @}
+ * @}
+ */
+
+#endif /* REGCACHE_H_ */
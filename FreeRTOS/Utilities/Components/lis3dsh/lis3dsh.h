@@ -1051,6 +1051,14 @@ typedef struct
 #define LIS3DSH_SENSITIVITY_0_18G            0.18  /* 0.18 mg/digit*/
 #define LIS3DSH_SENSITIVITY_0_24G            0.24  /* 0.24 mg/digit*/
 #define LIS3DSH_SENSITIVITY_0_73G            0.73  /* 0.73 mg/digit*/
+
+/* Same sensitivities in Q16 fixed point (mg/digit * 65536), used by
+   LIS3DSH_ReadACC to scale the samples without floating point */
+#define LIS3DSH_SENSITIVITY_Q16_0_06G        3932  /* 0.06 mg/digit*/
+#define LIS3DSH_SENSITIVITY_Q16_0_12G        7864  /* 0.12 mg/digit*/
+#define LIS3DSH_SENSITIVITY_Q16_0_18G        11796 /* 0.18 mg/digit*/
+#define LIS3DSH_SENSITIVITY_Q16_0_24G        15729 /* 0.24 mg/digit*/
+#define LIS3DSH_SENSITIVITY_Q16_0_73G        47841 /* 0.73 mg/digit*/
 /**
   * @}
   */
@@ -1068,6 +1076,8 @@ typedef struct
 #define LIS3DSH_DATARATE_400                 ((uint8_t)0x70)  /* 400   Hz Normal Mode */
 #define LIS3DSH_DATARATE_800                 ((uint8_t)0x80)  /* 800   Hz Normal Mode */
 #define LIS3DSH_DATARATE_1600                ((uint8_t)0x90)  /* 1600  Hz Normal Mode */
+
+#define LIS3DSH__DATARATE_SELECTION          ((uint8_t)0xF0)  /* CTRL_REG4 ODR field */
 /**
   * @}
   */
@@ -1177,6 +1187,14 @@ typedef struct
   */
 #define LIS3DSH_BOOT_NORMALMODE              ((uint8_t)0x00)
 #define LIS3DSH_BOOT_FORCED                  ((uint8_t)0x80)
+/**
+  * @}
+  */
+
+/** @defgroup Address_Increment_selection
+  * @{
+  */
+#define LIS3DSH_ADD_INC                      ((uint8_t)0x10)  /* CTRL_REG6 IF_ADD_INC */
 /**
   * @}
   */   
@@ -1191,6 +1209,29 @@ typedef struct
 #define LIS3DSH_FIFO_SF_TRIGGER_MODE         ((uint8_t)0x60)
 #define LIS3DSH_FIFO_BS_TRIGGER_MODE         ((uint8_t)0x80)
 #define LIS3DSH_FIFO_BF_TRIGGER_MODE         ((uint8_t)0xE0)
+
+#define LIS3DSH__FIFO_MODE_SELECTION         ((uint8_t)0xE0)  /* FIFO_CTRL FMODE field */
+#define LIS3DSH__FIFO_WATERMARK_SELECTION    ((uint8_t)0x1F)  /* FIFO_CTRL WTMP field */
+#define LIS3DSH_FIFO_DEPTH                   32               /* FIFO levels (samples) */
+/**
+  * @}
+  */
+
+/** @defgroup FIFO_Control_selection
+  * @{
+  */
+#define LIS3DSH_FIFO_ENABLE                  ((uint8_t)0x40)  /* CTRL_REG6 FIFO_EN */
+#define LIS3DSH_FIFO_STOP_ON_WTM             ((uint8_t)0x20)  /* CTRL_REG6 STP_WTM */
+#define LIS3DSH_FIFO_I1_EMPTY                ((uint8_t)0x08)  /* CTRL_REG6 I1_EMPTY */
+#define LIS3DSH_FIFO_I1_WTM                  ((uint8_t)0x04)  /* CTRL_REG6 I1_WTM */
+#define LIS3DSH_FIFO_I1_OVERRUN              ((uint8_t)0x02)  /* CTRL_REG6 I1_OVERRUN */
+
+#define LIS3DSH_INT1_ENABLE                  ((uint8_t)0x08)  /* CTRL_REG3 INT1_EN */
+
+#define LIS3DSH_FIFO_SRC_WTM                 ((uint8_t)0x80)  /* FIFO_SRC WTM */
+#define LIS3DSH_FIFO_SRC_OVRN                ((uint8_t)0x40)  /* FIFO_SRC OVRN_FIFO */
+#define LIS3DSH_FIFO_SRC_EMPTY               ((uint8_t)0x20)  /* FIFO_SRC EMPTY */
+#define LIS3DSH_FIFO_SRC_FSS                 ((uint8_t)0x1F)  /* FIFO_SRC FSS field */
 /**
   * @}
   */
@@ -1220,6 +1261,8 @@ void    LIS3DSH_DataRateCmd(uint8_t DataRateValue);
 void    LIS3DSH_FullScaleCmd(uint8_t FS_value);
 void    LIS3DSH_RebootCmd(void);
 void    LIS3DSH_ReadACC(int16_t *pData);
+void    LIS3DSH_FIFOConfig(uint8_t FIFO_Mode, uint8_t Watermark);
+uint8_t LIS3DSH_ReadFIFO(int16_t *pData, uint8_t MaxSamples);
 
 /* Accelerometer driver structure */
 extern ACCELERO_DrvTypeDef Lis3dshDrv;
@@ -1227,8 +1270,10 @@ extern ACCELERO_DrvTypeDef Lis3dshDrv;
 /* Accelerometer IO functions */  
 void    ACCELERO_IO_Init(void);
 void    ACCELERO_IO_ITConfig(void);
+void    ACCELERO_IO_INT1Config(void);
 void    ACCELERO_IO_Write(uint8_t* pBuffer, uint8_t WriteAddr, uint16_t NumByteToWrite);
 void    ACCELERO_IO_Read(uint8_t* pBuffer, uint8_t ReadAddr, uint16_t NumByteToRead);
+void    ACCELERO_IO_ReadBurst(uint8_t* pBuffer, uint8_t ReadAddr, uint16_t NumByteToRead);
 
 #ifdef __cplusplus
 }
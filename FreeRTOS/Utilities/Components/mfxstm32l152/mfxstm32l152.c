@@ -38,6 +38,7 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "mfxstm32l152.h"
+#include "../Common/regcache.h"
 
 /** @addtogroup BSP
   * @{
@@ -64,6 +65,10 @@
   */ 
 #define MFXSTM32L152_MAX_INSTANCE         3
 
+/* Window of the register copy: MFX_IRQ_OUT to GPIO_PUPD3 */
+#define MFXSTM32L152_CACHE_FIRST          MFXSTM32L152_REG_ADR_MFX_IRQ_OUT
+#define MFXSTM32L152_CACHE_COUNT          (MFXSTM32L152_REG_ADR_GPIO_PUPD3 - MFXSTM32L152_REG_ADR_MFX_IRQ_OUT + 1)
+
 /* Private macro -------------------------------------------------------------*/
 
 /** @defgroup MFXSTM32L152_Private_Macros
@@ -141,6 +146,13 @@ IDD_DrvTypeDef mfxstm32l152_idd_drv =
 
 /* mfxstm32l152 instances by address */
 uint8_t mfxstm32l152[MFXSTM32L152_MAX_INSTANCE] = {0};
+
+/* Copy of the configuration registers of each instance, read-modified-written 
+   pin by pin by the IO functions. MFX_IRQ_OUT, IRQ_SRC_EN and the IRQ_GPI_SRC, 
+   IRQ_GPI_EVT, IRQ_GPI_TYPE, GPIO_DIR, GPIO_TYPE and GPIO_PUPD banks are only 
+   changed by the driver; SYS_CTRL (self-clearing reset bit), the ACK and the 
+   GPO_SET/GPO_CLR registers act on write and are always written on the bus */
+static REGCACHE_t mfxstm32l152Cache[MFXSTM32L152_MAX_INSTANCE];
 /**
   * @}
   */ 
@@ -153,6 +165,9 @@ uint8_t mfxstm32l152[MFXSTM32L152_MAX_INSTANCE] = {0};
 static uint8_t mfxstm32l152_GetInstance(uint16_t DeviceAddr); 
 static uint8_t  mfxstm32l152_ReleaseInstance(uint16_t DeviceAddr);
 static void mfxstm32l152_reg24_setPinValue(uint16_t DeviceAddr, uint8_t RegisterAddr, uint32_t PinPosition, uint8_t PinValue );
+static void mfxstm32l152_InvalidateCache(uint16_t DeviceAddr);
+static uint8_t mfxstm32l152_ReadCachedReg(uint16_t DeviceAddr, uint8_t RegAddr);
+static void mfxstm32l152_WriteCachedReg(uint16_t DeviceAddr, uint8_t RegAddr, uint8_t Value);
 
 /* Private functions ---------------------------------------------------------*/
 
@@ -184,6 +199,12 @@ void mfxstm32l152_Init(uint16_t DeviceAddr)
       /* Register the current device instance */
       mfxstm32l152[empty] = DeviceAddr;
       
+      /* The register values of the device are not known yet */
+      REGCACHE_Init(&mfxstm32l152Cache[empty], MFXSTM32L152_CACHE_FIRST, MFXSTM32L152_CACHE_COUNT);
+      REGCACHE_Cacheable(&mfxstm32l152Cache[empty], MFXSTM32L152_REG_ADR_MFX_IRQ_OUT, MFXSTM32L152_REG_ADR_IRQ_SRC_EN);
+      REGCACHE_Cacheable(&mfxstm32l152Cache[empty], MFXSTM32L152_REG_ADR_IRQ_GPI_SRC1, MFXSTM32L152_REG_ADR_IRQ_GPI_TYPE3);
+      REGCACHE_Cacheable(&mfxstm32l152Cache[empty], MFXSTM32L152_REG_ADR_GPIO_DIR1, MFXSTM32L152_REG_ADR_GPIO_PUPD3);
+      
       /* Initialize IO BUS layer */
       MFX_IO_Init();
     }
@@ -225,6 +246,9 @@ void mfxstm32l152_Reset(uint16_t DeviceAddr)
 
   /* Wait for a delay to ensure registers erasing */
   MFX_IO_Delay(10);
+  
+  /* The register values are back to their defaults */
+  mfxstm32l152_InvalidateCache(DeviceAddr);
 }
 
 /**
@@ -262,6 +286,9 @@ void  mfxstm32l152_WakeUp(uint16_t DeviceAddr)
 
   /* toggle wakeup pin */
   MFX_IO_Wakeup();
+  
+  /* Do not rely on the register values kept through the standby */
+  mfxstm32l152_InvalidateCache(DeviceAddr);
 }
 
 /**
@@ -319,13 +346,13 @@ void mfxstm32l152_EnableITSource(uint16_t DeviceAddr, uint8_t Source)
   uint8_t tmp = 0;
   
   /* Get the current value of the INT_EN register */
-  tmp = MFX_IO_Read(DeviceAddr, MFXSTM32L152_REG_ADR_IRQ_SRC_EN);
+  tmp = mfxstm32l152_ReadCachedReg(DeviceAddr, MFXSTM32L152_REG_ADR_IRQ_SRC_EN);
 
   /* Set the interrupts to be Enabled */    
   tmp |= Source; 
   
   /* Set the register */
-  MFX_IO_Write(DeviceAddr, MFXSTM32L152_REG_ADR_IRQ_SRC_EN, tmp);
+  mfxstm32l152_WriteCachedReg(DeviceAddr, MFXSTM32L152_REG_ADR_IRQ_SRC_EN, tmp);
 }
 
 /**
@@ -347,13 +374,13 @@ void mfxstm32l152_DisableITSource(uint16_t DeviceAddr, uint8_t Source)
   uint8_t tmp = 0;
   
   /* Get the current value of the INT_EN register */
-  tmp = MFX_IO_Read(DeviceAddr, MFXSTM32L152_REG_ADR_IRQ_SRC_EN);
+  tmp = mfxstm32l152_ReadCachedReg(DeviceAddr, MFXSTM32L152_REG_ADR_IRQ_SRC_EN);
 
   /* Set the interrupts to be Enabled */    
   tmp &= ~Source; 
   
   /* Set the register */
-  MFX_IO_Write(DeviceAddr, MFXSTM32L152_REG_ADR_IRQ_SRC_EN, tmp);
+  mfxstm32l152_WriteCachedReg(DeviceAddr, MFXSTM32L152_REG_ADR_IRQ_SRC_EN, tmp);
 }
 
 
@@ -412,7 +439,7 @@ void mfxstm32l152_SetIrqOutPinPolarity(uint16_t DeviceAddr, uint8_t Polarity)
   uint8_t tmp = 0;
   
   /* Get the current register value */ 
-  tmp = MFX_IO_Read(DeviceAddr, MFXSTM32L152_REG_ADR_MFX_IRQ_OUT);
+  tmp = mfxstm32l152_ReadCachedReg(DeviceAddr, MFXSTM32L152_REG_ADR_MFX_IRQ_OUT);
   
   /* Mask the polarity bits */
   tmp &= ~(uint8_t)0x02;
@@ -421,7 +448,7 @@ void mfxstm32l152_SetIrqOutPinPolarity(uint16_t DeviceAddr, uint8_t Polarity)
   tmp |= Polarity;
   
   /* Set the new register value */
-  MFX_IO_Write(DeviceAddr, MFXSTM32L152_REG_ADR_MFX_IRQ_OUT, tmp);
+  mfxstm32l152_WriteCachedReg(DeviceAddr, MFXSTM32L152_REG_ADR_MFX_IRQ_OUT, tmp);
 
   /* Wait for 1 ms for MFX to change IRQ_out pin config, before activate it */
   MFX_IO_Delay(1);
@@ -441,7 +468,7 @@ void mfxstm32l152_SetIrqOutPinType(uint16_t DeviceAddr, uint8_t Type)
   uint8_t tmp = 0;
   
   /* Get the current register value */ 
-  tmp = MFX_IO_Read(DeviceAddr, MFXSTM32L152_REG_ADR_MFX_IRQ_OUT);
+  tmp = mfxstm32l152_ReadCachedReg(DeviceAddr, MFXSTM32L152_REG_ADR_MFX_IRQ_OUT);
   
   /* Mask the type bits */
   tmp &= ~(uint8_t)0x01;
@@ -450,7 +477,7 @@ void mfxstm32l152_SetIrqOutPinType(uint16_t DeviceAddr, uint8_t Type)
   tmp |= Type;
   
   /* Set the new register value */
-  MFX_IO_Write(DeviceAddr, MFXSTM32L152_REG_ADR_MFX_IRQ_OUT, tmp);
+  mfxstm32l152_WriteCachedReg(DeviceAddr, MFXSTM32L152_REG_ADR_MFX_IRQ_OUT, tmp);
 
   /* Wait for 1 ms for MFX to change IRQ_out pin config, before activate it */
   MFX_IO_Delay(1);
@@ -1439,8 +1466,16 @@ uint8_t mfxstm32l152_ReadReg(uint16_t DeviceAddr, uint8_t RegAddr)
 
 void mfxstm32l152_WriteReg(uint16_t DeviceAddr, uint8_t RegAddr, uint8_t Value)
 {
+  uint8_t instance = mfxstm32l152_GetInstance(DeviceAddr);
+  
   /* set the current register value */ 
   MFX_IO_Write((uint8_t) DeviceAddr, RegAddr, Value);
+  
+  /* Keep the copy of the configuration registers up to date */
+  if(instance != 0xFF)
+  {
+    REGCACHE_Fill(&mfxstm32l152Cache[instance], RegAddr, Value);
+  }
 }
 
 /* ------------------------------------------------------------------ */
@@ -1510,7 +1545,7 @@ void mfxstm32l152_reg24_setPinValue(uint16_t DeviceAddr, uint8_t RegisterAddr, u
   if (pin_0_7)
   {  
     /* Get the current register value */ 
-    tmp = MFX_IO_Read(DeviceAddr, RegisterAddr);
+    tmp = mfxstm32l152_ReadCachedReg(DeviceAddr, RegisterAddr);
   
     /* Set the selected pin direction */
     if (PinValue != 0)
@@ -1523,13 +1558,13 @@ void mfxstm32l152_reg24_setPinValue(uint16_t DeviceAddr, uint8_t RegisterAddr, u
     }
   
     /* Set the new register value */
-    MFX_IO_Write(DeviceAddr, RegisterAddr, tmp);
+    mfxstm32l152_WriteCachedReg(DeviceAddr, RegisterAddr, tmp);
   }
 
   if (pin_8_15)
   {
     /* Get the current register value */ 
-    tmp = MFX_IO_Read(DeviceAddr, RegisterAddr+1);
+    tmp = mfxstm32l152_ReadCachedReg(DeviceAddr, RegisterAddr+1);
   
     /* Set the selected pin direction */
     if (PinValue != 0)
@@ -1542,13 +1577,13 @@ void mfxstm32l152_reg24_setPinValue(uint16_t DeviceAddr, uint8_t RegisterAddr, u
     }
   
     /* Set the new register value */
-    MFX_IO_Write(DeviceAddr, RegisterAddr+1, tmp);
+    mfxstm32l152_WriteCachedReg(DeviceAddr, RegisterAddr+1, tmp);
   }  
 
   if (pin_16_23)
   {
     /* Get the current register value */ 
-    tmp = MFX_IO_Read(DeviceAddr, RegisterAddr+2);
+    tmp = mfxstm32l152_ReadCachedReg(DeviceAddr, RegisterAddr+2);
   
     /* Set the selected pin direction */
     if (PinValue != 0)
@@ -1561,10 +1596,66 @@ void mfxstm32l152_reg24_setPinValue(uint16_t DeviceAddr, uint8_t RegisterAddr, u
     }
   
     /* Set the new register value */
-    MFX_IO_Write(DeviceAddr, RegisterAddr+2, tmp);
+    mfxstm32l152_WriteCachedReg(DeviceAddr, RegisterAddr+2, tmp);
   } 
 }
 
+/**
+  * @brief  Forget the register values of the copy, after a reset or a standby
+  * @param  DeviceAddr: Device address on communication Bus.
+  * @retval None
+  */
+static void mfxstm32l152_InvalidateCache(uint16_t DeviceAddr)
+{
+  uint8_t instance = mfxstm32l152_GetInstance(DeviceAddr);
+  
+  if(instance != 0xFF)
+  {
+    REGCACHE_Invalidate(&mfxstm32l152Cache[instance]);
+  }
+}
+
+/**
+  * @brief  Read a register, from the copy of the configuration registers if 
+  *         its value is known.
+  * @param  DeviceAddr: Device address on communication Bus.
+  * @param  RegAddr: Register Address
+  * @retval Register value
+  */
+static uint8_t mfxstm32l152_ReadCachedReg(uint16_t DeviceAddr, uint8_t RegAddr)
+{
+  uint8_t instance = mfxstm32l152_GetInstance(DeviceAddr);
+  uint8_t value = 0;
+  
+  if(instance == 0xFF)
+  {
+    return MFX_IO_Read(DeviceAddr, RegAddr);
+  }
+  if(!REGCACHE_Read(&mfxstm32l152Cache[instance], RegAddr, &value))
+  {
+    value = MFX_IO_Read(DeviceAddr, RegAddr);
+    REGCACHE_Fill(&mfxstm32l152Cache[instance], RegAddr, value);
+  }
+  return value;
+}
+
+/**
+  * @brief  Write a register, unless it is known to already hold the value.
+  * @param  DeviceAddr: Device address on communication Bus.
+  * @param  RegAddr: Register Address
+  * @param  Value: Register value
+  * @retval None
+  */
+static void mfxstm32l152_WriteCachedReg(uint16_t DeviceAddr, uint8_t RegAddr, uint8_t Value)
+{
+  uint8_t instance = mfxstm32l152_GetInstance(DeviceAddr);
+  
+  if((instance == 0xFF) || REGCACHE_Write(&mfxstm32l152Cache[instance], RegAddr, Value))
+  {
+    MFX_IO_Write(DeviceAddr, RegAddr, Value);
+  }
+}
+
 
 /**
   * @}
@@ -80,6 +80,7 @@
   * @{
   */
 static uint32_t ov2640_ConvertValue(uint32_t feature, uint32_t value);
+static void     ov2640_WriteTable(uint16_t DeviceAddr, const unsigned char table[][2], uint32_t size, uint32_t delay);
 /**
   * @}
   */ 
@@ -95,250 +96,9 @@ CAMERA_DrvTypeDef   ov2640_drv =
   ov2640_Config,
 };
 
-/* Initialization sequence for 480x272 resolution */
-const unsigned char OV2640_480x272[][2]=
-{
-  {0xff, 0x00},  /* Device control register list Table 12 */
-  {0x2c, 0xff},  /* Reserved                              */
-  {0x2e, 0xdf},  /* Reserved                              */
-  {0xff, 0x01},  /* Device control register list Table 13 */
-  {0x3c, 0x32},  /* Reserved                              */
-  {0x11, 0x00},  /* Clock Rate Control                    */
-  {0x09, 0x02},  /* Common control 2                      */
-  {0x04, 0xA8},  /* Mirror                                */
-  {0x13, 0xe5},  /* Common control 8                      */
-  {0x14, 0x48},  /* Common control 9                      */
-  {0x2c, 0x0c},  /* Reserved                              */
-  {0x33, 0x78},  /* Reserved                              */
-  {0x3a, 0x33},  /* Reserved                              */
-  {0x3b, 0xfB},  /* Reserved                              */
-  {0x3e, 0x00},  /* Reserved                              */
-  {0x43, 0x11},  /* Reserved                              */
-  {0x16, 0x10},  /* Reserved                              */
-  {0x4a, 0x81},  /* Reserved                              */
-  {0x21, 0x99},  /* Reserved                              */
-  {0x24, 0x40},  /* Luminance signal High range           */
-  {0x25, 0x38},  /* Luminance signal low range            */
-  {0x26, 0x82},  /*                                       */
-  {0x5c, 0x00},  /* Reserved                              */
-  {0x63, 0x00},  /* Reserved                              */
-  {0x46, 0x3f},  /* Frame length adjustment               */
-  {0x0c, 0x3c},  /* Common control 3                      */
-  {0x61, 0x70},  /* Histogram algo low level              */
-  {0x62, 0x80},  /* Histogram algo high level             */
-  {0x7c, 0x05},  /* Reserved                              */
-  {0x20, 0x80},  /* Reserved                              */
-  {0x28, 0x30},  /* Reserved                              */
-  {0x6c, 0x00},  /* Reserved                              */
-  {0x6d, 0x80},  /* Reserved                              */
-  {0x6e, 0x00},  /* Reserved                              */
-  {0x70, 0x02},  /* Reserved                              */
-  {0x71, 0x94},  /* Reserved                              */
-  {0x73, 0xc1},  /* Reserved                              */
-  {0x3d, 0x34},  /* Reserved                              */
-  {0x5a, 0x57},  /* Reserved                              */
-  {0x12, 0x00},  /* Common control 7                      */
-  {0x11, 0x00},  /* Clock Rate Control                   2*/
-  {0x17, 0x11},  /* Horiz window start MSB 8bits          */
-  {0x18, 0x75},  /* Horiz window end MSB 8bits            */
-  {0x19, 0x01},  /* Vert window line start MSB 8bits      */
-  {0x1a, 0x97},  /* Vert window line end MSB 8bits        */
-  {0x32, 0x36},
-  {0x03, 0x0f},
-  {0x37, 0x40},
-  {0x4f, 0xbb},
-  {0x50, 0x9c},
-  {0x5a, 0x57},
-  {0x6d, 0x80},
-  {0x6d, 0x38},
-  {0x39, 0x02},
-  {0x35, 0x88},
-  {0x22, 0x0a},
-  {0x37, 0x40},
-  {0x23, 0x00},
-  {0x34, 0xa0},
-  {0x36, 0x1a},
-  {0x06, 0x02},
-  {0x07, 0xc0},
-  {0x0d, 0xb7},
-  {0x0e, 0x01},
-  {0x4c, 0x00},
-  {0xff, 0x00},
-  {0xe5, 0x7f},
-  {0xf9, 0xc0},
-  {0x41, 0x24},
-  {0xe0, 0x14},
-  {0x76, 0xff},
-  {0x33, 0xa0},
-  {0x42, 0x20},
-  {0x43, 0x18},
-  {0x4c, 0x00},
-  {0x87, 0xd0},
-  {0x88, 0x3f},
-  {0xd7, 0x03},
-  {0xd9, 0x10},
-  {0xd3, 0x82},
-  {0xc8, 0x08},
-  {0xc9, 0x80},
-  {0x7d, 0x00},
-  {0x7c, 0x03},
-  {0x7d, 0x48},
-  {0x7c, 0x08},
-  {0x7d, 0x20},
-  {0x7d, 0x10},
-  {0x7d, 0x0e},
-  {0x90, 0x00},
-  {0x91, 0x0e},
-  {0x91, 0x1a},
-  {0x91, 0x31},
-  {0x91, 0x5a},
-  {0x91, 0x69},
-  {0x91, 0x75},
-  {0x91, 0x7e},
-  {0x91, 0x88},
-  {0x91, 0x8f},
-  {0x91, 0x96},
-  {0x91, 0xa3},
-  {0x91, 0xaf},
-  {0x91, 0xc4},
-  {0x91, 0xd7},
-  {0x91, 0xe8},
-  {0x91, 0x20},
-  {0x92, 0x00},
-  {0x93, 0x06},
-  {0x93, 0xe3},
-  {0x93, 0x02},
-  {0x93, 0x02},
-  {0x93, 0x00},
-  {0x93, 0x04},
-  {0x93, 0x00},
-  {0x93, 0x03},
-  {0x93, 0x00},
-  {0x93, 0x00},
-  {0x93, 0x00},
-  {0x93, 0x00},
-  {0x93, 0x00},
-  {0x93, 0x00},
-  {0x93, 0x00},
-  {0x96, 0x00},
-  {0x97, 0x08},
-  {0x97, 0x19},
-  {0x97, 0x02},
-  {0x97, 0x0c},
-  {0x97, 0x24},
-  {0x97, 0x30},
-  {0x97, 0x28},
-  {0x97, 0x26},
-  {0x97, 0x02},
-  {0x97, 0x98},
-  {0x97, 0x80},
-  {0x97, 0x00},
-  {0x97, 0x00},
-  {0xc3, 0xef},
-  {0xff, 0x00},
-  {0xba, 0xdc},
-  {0xbb, 0x08},
-  {0xb6, 0x24},
-  {0xb8, 0x33},
-  {0xb7, 0x20},
-  {0xb9, 0x30},
-  {0xb3, 0xb4},
-  {0xb4, 0xca},
-  {0xb5, 0x43},
-  {0xb0, 0x5c},
-  {0xb1, 0x4f},
-  {0xb2, 0x06},
-  {0xc7, 0x00},
-  {0xc6, 0x51},
-  {0xc5, 0x11},
-  {0xc4, 0x9c},
-  {0xbf, 0x00},
-  {0xbc, 0x64},
-  {0xa6, 0x00},
-  {0xa7, 0x1e},
-  {0xa7, 0x6b},
-  {0xa7, 0x47},
-  {0xa7, 0x33},
-  {0xa7, 0x00},
-  {0xa7, 0x23},
-  {0xa7, 0x2e},
-  {0xa7, 0x85},
-  {0xa7, 0x42},
-  {0xa7, 0x33},
-  {0xa7, 0x00},
-  {0xa7, 0x23},
-  {0xa7, 0x1b},
-  {0xa7, 0x74},
-  {0xa7, 0x42},
-  {0xa7, 0x33},
-  {0xa7, 0x00},
-  {0xa7, 0x23},
-  {0xc0, 0xc8},
-  {0xc1, 0x96},
-  {0x8c, 0x00},
-  {0x86, 0x3d},
-  {0x50, 0x92},
-  {0x51, 0x90},
-  {0x52, 0x2c},
-  {0x53, 0x00},
-  {0x54, 0x00},
-  {0x55, 0x88},
-  {0x5a, 0x50},
-  {0x5b, 0x3c},
-  {0x5c, 0x00},
-  {0xd3, 0x04},
-  {0x7f, 0x00},
-  {0xda, 0x00},
-  {0xe5, 0x1f},
-  {0xe1, 0x67},
-  {0xe0, 0x00},
-  {0xdd, 0x7f},
-  {0x05, 0x00},
-  {0xff, 0x00},
-  {0xe0, 0x04},
-  {0xc0, 0xc8},
-  {0xc1, 0x96},
-  {0x86, 0x3d},
-  {0x50, 0x92},
-  {0x51, 0x90},
-  {0x52, 0x2c},
-  {0x53, 0x00},
-  {0x54, 0x00},
-  {0x55, 0x88},
-  {0x57, 0x00},
-  {0x5a, 0x50},
-  {0x5b, 0x3c},
-  {0x5c, 0x00},
-  {0xd3, 0x04},
-  {0xe0, 0x00},
-  {0xFF, 0x00},
-  {0x05, 0x00},
-  {0xDA, 0x08},
-  {0xda, 0x09},
-  {0x98, 0x00},
-  {0x99, 0x00},
-  {0x00, 0x00},
-  {0xff, 0x00},
-  {0xe0, 0x04},
-  {0xc0, 0xc8},
-  {0xc1, 0x96},
-  {0x86, 0x35},
-  {0x50, 0x80},
-  {0x51, 0x90},
-  {0x52, 0x2c},
-  {0x53, 0x00},
-  {0x54, 0x00},
-  {0x55, 0x88},
-  {0x57, 0x00},
-  {0x5a, 0x78},
-  {0x5b, 0x44},
-  {0x5c, 0x00},
-  {0xd3, 0x04},
-  {0xe0, 0x00},
-};
-
-/* Initialization sequence for VGA resolution (640x480)*/
-const unsigned char OV2640_VGA[][2]=
+/* Initialization sequence common to all resolutions, followed by the
+   resolution specific sequence */
+const unsigned char OV2640_Common[][2]=
 {
   {0xff, 0x00},  /* Device control register list Table 12 */
   {0x2c, 0xff},  /* Reserved                              */
@@ -350,283 +110,41 @@ const unsigned char OV2640_VGA[][2]=
   {0x04, 0xA8},  /* Mirror                                */
   {0x13, 0xe5},  /* Common control 8                      */
   {0x14, 0x48},  /* Common control 9                      */
-  {0x2c, 0x0c},  /* Reserved                              */
-  {0x33, 0x78},  /* Reserved                              */
-  {0x3a, 0x33},  /* Reserved                              */
-  {0x3b, 0xfB},  /* Reserved                              */
-  {0x3e, 0x00},  /* Reserved                              */
-  {0x43, 0x11},  /* Reserved                              */
-  {0x16, 0x10},  /* Reserved                              */
-  {0x4a, 0x81},  /* Reserved                              */
-  {0x21, 0x99},  /* Reserved                              */
-  {0x24, 0x40},  /* Luminance signal High range           */
-  {0x25, 0x38},  /* Luminance signal low range            */
-  {0x26, 0x82},  /*                                       */
-  {0x5c, 0x00},  /* Reserved                              */
-  {0x63, 0x00},  /* Reserved                              */
-  {0x46, 0x3f},  /* Frame length adjustment               */
-  {0x0c, 0x3c},  /* Common control 3                      */
-  {0x61, 0x70},  /* Histogram algo low level              */
-  {0x62, 0x80},  /* Histogram algo high level             */
-  {0x7c, 0x05},  /* Reserved                              */
-  {0x20, 0x80},  /* Reserved                              */
-  {0x28, 0x30},  /* Reserved                              */
-  {0x6c, 0x00},  /* Reserved                              */
-  {0x6d, 0x80},  /* Reserved                              */
-  {0x6e, 0x00},  /* Reserved                              */
-  {0x70, 0x02},  /* Reserved                              */
-  {0x71, 0x94},  /* Reserved                              */
-  {0x73, 0xc1},  /* Reserved                              */
-  {0x3d, 0x34},  /* Reserved                              */
-  {0x5a, 0x57},  /* Reserved                              */
-  {0x12, 0x00},  /* Common control 7                      */
-  {0x11, 0x00},  /* Clock Rate Control                   2*/
-  {0x17, 0x11},  /* Horiz window start MSB 8bits          */
-  {0x18, 0x75},  /* Horiz window end MSB 8bits            */
-  {0x19, 0x01},  /* Vert window line start MSB 8bits      */
-  {0x1a, 0x97},  /* Vert window line end MSB 8bits        */
-  {0x32, 0x36},
-  {0x03, 0x0f},
-  {0x37, 0x40},
-  {0x4f, 0xbb},
-  {0x50, 0x9c},
-  {0x5a, 0x57},
-  {0x6d, 0x80},
-  {0x6d, 0x38},
-  {0x39, 0x02},
-  {0x35, 0x88},
-  {0x22, 0x0a},
-  {0x37, 0x40},
-  {0x23, 0x00},
-  {0x34, 0xa0},
-  {0x36, 0x1a},
-  {0x06, 0x02},
-  {0x07, 0xc0},
-  {0x0d, 0xb7},
-  {0x0e, 0x01},
-  {0x4c, 0x00},
-  {0xff, 0x00},
-  {0xe5, 0x7f},
-  {0xf9, 0xc0},
-  {0x41, 0x24},
-  {0xe0, 0x14},
-  {0x76, 0xff},
-  {0x33, 0xa0},
-  {0x42, 0x20},
-  {0x43, 0x18},
-  {0x4c, 0x00},
-  {0x87, 0xd0},
-  {0x88, 0x3f},
-  {0xd7, 0x03},
-  {0xd9, 0x10},
-  {0xd3, 0x82},
-  {0xc8, 0x08},
-  {0xc9, 0x80},
-  {0x7d, 0x00},
-  {0x7c, 0x03},
-  {0x7d, 0x48},
-  {0x7c, 0x08},
-  {0x7d, 0x20},
-  {0x7d, 0x10},
-  {0x7d, 0x0e},
-  {0x90, 0x00},
-  {0x91, 0x0e},
-  {0x91, 0x1a},
-  {0x91, 0x31},
-  {0x91, 0x5a},
-  {0x91, 0x69},
-  {0x91, 0x75},
-  {0x91, 0x7e},
-  {0x91, 0x88},
-  {0x91, 0x8f},
-  {0x91, 0x96},
-  {0x91, 0xa3},
-  {0x91, 0xaf},
-  {0x91, 0xc4},
-  {0x91, 0xd7},
-  {0x91, 0xe8},
-  {0x91, 0x20},
-  {0x92, 0x00},
-  {0x93, 0x06},
-  {0x93, 0xe3},
-  {0x93, 0x02},
-  {0x93, 0x02},
-  {0x93, 0x00},
-  {0x93, 0x04},
-  {0x93, 0x00},
-  {0x93, 0x03},
-  {0x93, 0x00},
-  {0x93, 0x00},
-  {0x93, 0x00},
-  {0x93, 0x00},
-  {0x93, 0x00},
-  {0x93, 0x00},
-  {0x93, 0x00},
-  {0x96, 0x00},
-  {0x97, 0x08},
-  {0x97, 0x19},
-  {0x97, 0x02},
-  {0x97, 0x0c},
-  {0x97, 0x24},
-  {0x97, 0x30},
-  {0x97, 0x28},
-  {0x97, 0x26},
-  {0x97, 0x02},
-  {0x97, 0x98},
-  {0x97, 0x80},
-  {0x97, 0x00},
-  {0x97, 0x00},
-  {0xc3, 0xef},
-  {0xff, 0x00},
-  {0xba, 0xdc},
-  {0xbb, 0x08},
-  {0xb6, 0x24},
-  {0xb8, 0x33},
-  {0xb7, 0x20},
-  {0xb9, 0x30},
-  {0xb3, 0xb4},
-  {0xb4, 0xca},
-  {0xb5, 0x43},
-  {0xb0, 0x5c},
-  {0xb1, 0x4f},
-  {0xb2, 0x06},
-  {0xc7, 0x00},
-  {0xc6, 0x51},
-  {0xc5, 0x11},
-  {0xc4, 0x9c},
-  {0xbf, 0x00},
-  {0xbc, 0x64},
-  {0xa6, 0x00},
-  {0xa7, 0x1e},
-  {0xa7, 0x6b},
-  {0xa7, 0x47},
-  {0xa7, 0x33},
-  {0xa7, 0x00},
-  {0xa7, 0x23},
-  {0xa7, 0x2e},
-  {0xa7, 0x85},
-  {0xa7, 0x42},
-  {0xa7, 0x33},
-  {0xa7, 0x00},
-  {0xa7, 0x23},
-  {0xa7, 0x1b},
-  {0xa7, 0x74},
-  {0xa7, 0x42},
-  {0xa7, 0x33},
-  {0xa7, 0x00},
-  {0xa7, 0x23},
-  {0xc0, 0xc8},
-  {0xc1, 0x96},
-  {0x8c, 0x00},
-  {0x86, 0x3d},
-  {0x50, 0x92},
-  {0x51, 0x90},
-  {0x52, 0x2c},
-  {0x53, 0x00},
-  {0x54, 0x00},
-  {0x55, 0x88},
-  {0x5a, 0x50},
-  {0x5b, 0x3c},
-  {0x5c, 0x00},
-  {0xd3, 0x04},
-  {0x7f, 0x00},
-  {0xda, 0x00},
-  {0xe5, 0x1f},
-  {0xe1, 0x67},
-  {0xe0, 0x00},
-  {0xdd, 0x7f},
-  {0x05, 0x00},
-  {0xff, 0x00},
-  {0xe0, 0x04},
-  {0xc0, 0xc8},
-  {0xc1, 0x96},
-  {0x86, 0x3d},
-  {0x50, 0x92},
-  {0x51, 0x90},
-  {0x52, 0x2c},
-  {0x53, 0x00},
-  {0x54, 0x00},
-  {0x55, 0x88},
-  {0x57, 0x00},
-  {0x5a, 0x50},
-  {0x5b, 0x3c},
-  {0x5c, 0x00},
-  {0xd3, 0x04},
-  {0xe0, 0x00},
-  {0xFF, 0x00},
-  {0x05, 0x00},
-  {0xDA, 0x08},
-  {0xda, 0x09},
-  {0x98, 0x00},
-  {0x99, 0x00},
-  {0x00, 0x00},
-  {0xff, 0x00},
-  {0xe0, 0x04},
-  {0xc0, 0xc8},
-  {0xc1, 0x96},
-  {0x86, 0x3d},
-  {0x50, 0x89},
-  {0x51, 0x90},
-  {0x52, 0x2c},
-  {0x53, 0x00},
-  {0x54, 0x00},
-  {0x55, 0x88},
-  {0x57, 0x00},
-  {0x5a, 0xA0},
-  {0x5b, 0x78},
-  {0x5c, 0x00},
-  {0xd3, 0x02},
-  {0xe0, 0x00},
-};
-
-/* Initialization sequence for QVGA resolution (320x240) */
-const unsigned char OV2640_QVGA[][2]=
-{
-  {0xff, 0x00},
-  {0x2c, 0xff},
-  {0x2e, 0xdf},
-  {0xff, 0x01},
-  {0x3c, 0x32},
-  {0x11, 0x00},
-  {0x09, 0x02},
-  {0x04, 0xA8},
-  {0x13, 0xe5},
-  {0x14, 0x48},
-  {0x2c, 0x0c},
-  {0x33, 0x78},
-  {0x3a, 0x33},
-  {0x3b, 0xfB},
-  {0x3e, 0x00},
-  {0x43, 0x11},
-  {0x16, 0x10},
-  {0x4a, 0x81},
-  {0x21, 0x99},
-  {0x24, 0x40},
-  {0x25, 0x38},
-  {0x26, 0x82},
-  {0x5c, 0x00},
-  {0x63, 0x00},
-  {0x46, 0x3f},
-  {0x0c, 0x3c},
-  {0x61, 0x70},
-  {0x62, 0x80},
-  {0x7c, 0x05},
-  {0x20, 0x80},
-  {0x28, 0x30},
-  {0x6c, 0x00},
-  {0x6d, 0x80},
-  {0x6e, 0x00},
-  {0x70, 0x02},
-  {0x71, 0x94},
-  {0x73, 0xc1},
-  {0x3d, 0x34},
-  {0x5a, 0x57},
-  {0x12, 0x00},
-  {0x11, 0x00},
-  {0x17, 0x11},
-  {0x18, 0x75},
-  {0x19, 0x01},
-  {0x1a, 0x97},
+  {0x2c, 0x0c},  /* Reserved                              */
+  {0x33, 0x78},  /* Reserved                              */
+  {0x3a, 0x33},  /* Reserved                              */
+  {0x3b, 0xfB},  /* Reserved                              */
+  {0x3e, 0x00},  /* Reserved                              */
+  {0x43, 0x11},  /* Reserved                              */
+  {0x16, 0x10},  /* Reserved                              */
+  {0x4a, 0x81},  /* Reserved                              */
+  {0x21, 0x99},  /* Reserved                              */
+  {0x24, 0x40},  /* Luminance signal High range           */
+  {0x25, 0x38},  /* Luminance signal low range            */
+  {0x26, 0x82},  /*                                       */
+  {0x5c, 0x00},  /* Reserved                              */
+  {0x63, 0x00},  /* Reserved                              */
+  {0x46, 0x3f},  /* Frame length adjustment               */
+  {0x0c, 0x3c},  /* Common control 3                      */
+  {0x61, 0x70},  /* Histogram algo low level              */
+  {0x62, 0x80},  /* Histogram algo high level             */
+  {0x7c, 0x05},  /* Reserved                              */
+  {0x20, 0x80},  /* Reserved                              */
+  {0x28, 0x30},  /* Reserved                              */
+  {0x6c, 0x00},  /* Reserved                              */
+  {0x6d, 0x80},  /* Reserved                              */
+  {0x6e, 0x00},  /* Reserved                              */
+  {0x70, 0x02},  /* Reserved                              */
+  {0x71, 0x94},  /* Reserved                              */
+  {0x73, 0xc1},  /* Reserved                              */
+  {0x3d, 0x34},  /* Reserved                              */
+  {0x5a, 0x57},  /* Reserved                              */
+  {0x12, 0x00},  /* Common control 7                      */
+  {0x11, 0x00},  /* Clock Rate Control                   2*/
+  {0x17, 0x11},  /* Horiz window start MSB 8bits          */
+  {0x18, 0x75},  /* Horiz window end MSB 8bits            */
+  {0x19, 0x01},  /* Vert window line start MSB 8bits      */
+  {0x1a, 0x97},  /* Vert window line end MSB 8bits        */
   {0x32, 0x36},
   {0x03, 0x0f},
   {0x37, 0x40},
@@ -790,10 +308,15 @@ const unsigned char OV2640_QVGA[][2]=
   {0x54, 0x00},
   {0x55, 0x88},
   {0x57, 0x00},
+};
+
+/* Initialization sequence for 480x272 resolution */
+const unsigned char OV2640_480x272[][2]=
+{
   {0x5a, 0x50},
-  {0x5b, 0x3C},
+  {0x5b, 0x3c},
   {0x5c, 0x00},
-  {0xd3, 0x08},
+  {0xd3, 0x04},
   {0xe0, 0x00},
   {0xFF, 0x00},
   {0x05, 0x00},
@@ -802,219 +325,79 @@ const unsigned char OV2640_QVGA[][2]=
   {0x98, 0x00},
   {0x99, 0x00},
   {0x00, 0x00},
-};
-
-/* Initialization sequence for QQVGA resolution (160x120) */
-const char OV2640_QQVGA[][2]=
-{
-  {0xff, 0x00},
-  {0x2c, 0xff},
-  {0x2e, 0xdf},
-  {0xff, 0x01},
-  {0x3c, 0x32},
-  {0x11, 0x00},
-  {0x09, 0x02},
-  {0x04, 0xA8},
-  {0x13, 0xe5},
-  {0x14, 0x48},
-  {0x2c, 0x0c},
-  {0x33, 0x78},
-  {0x3a, 0x33},
-  {0x3b, 0xfB},
-  {0x3e, 0x00},
-  {0x43, 0x11},
-  {0x16, 0x10},
-  {0x4a, 0x81},
-  {0x21, 0x99},
-  {0x24, 0x40},
-  {0x25, 0x38},
-  {0x26, 0x82},
-  {0x5c, 0x00},
-  {0x63, 0x00},
-  {0x46, 0x3f},
-  {0x0c, 0x3c},
-  {0x61, 0x70},
-  {0x62, 0x80},
-  {0x7c, 0x05},
-  {0x20, 0x80},
-  {0x28, 0x30},
-  {0x6c, 0x00},
-  {0x6d, 0x80},
-  {0x6e, 0x00},
-  {0x70, 0x02},
-  {0x71, 0x94},
-  {0x73, 0xc1},
-  {0x3d, 0x34},
-  {0x5a, 0x57},
-  {0x12, 0x00},
-  {0x11, 0x00},
-  {0x17, 0x11},
-  {0x18, 0x75},
-  {0x19, 0x01},
-  {0x1a, 0x97},
-  {0x32, 0x36},
-  {0x03, 0x0f},
-  {0x37, 0x40},
-  {0x4f, 0xbb},
-  {0x50, 0x9c},
-  {0x5a, 0x57},
-  {0x6d, 0x80},
-  {0x6d, 0x38},
-  {0x39, 0x02},
-  {0x35, 0x88},
-  {0x22, 0x0a},
-  {0x37, 0x40},
-  {0x23, 0x00},
-  {0x34, 0xa0},
-  {0x36, 0x1a},
-  {0x06, 0x02},
-  {0x07, 0xc0},
-  {0x0d, 0xb7},
-  {0x0e, 0x01},
-  {0x4c, 0x00},
-  {0xff, 0x00},
-  {0xe5, 0x7f},
-  {0xf9, 0xc0},
-  {0x41, 0x24},
-  {0xe0, 0x14},
-  {0x76, 0xff},
-  {0x33, 0xa0},
-  {0x42, 0x20},
-  {0x43, 0x18},
-  {0x4c, 0x00},
-  {0x87, 0xd0},
-  {0x88, 0x3f},
-  {0xd7, 0x03},
-  {0xd9, 0x10},
-  {0xd3, 0x82},
-  {0xc8, 0x08},
-  {0xc9, 0x80},
-  {0x7d, 0x00},
-  {0x7c, 0x03},
-  {0x7d, 0x48},
-  {0x7c, 0x08},
-  {0x7d, 0x20},
-  {0x7d, 0x10},
-  {0x7d, 0x0e},
-  {0x90, 0x00},
-  {0x91, 0x0e},
-  {0x91, 0x1a},
-  {0x91, 0x31},
-  {0x91, 0x5a},
-  {0x91, 0x69},
-  {0x91, 0x75},
-  {0x91, 0x7e},
-  {0x91, 0x88},
-  {0x91, 0x8f},
-  {0x91, 0x96},
-  {0x91, 0xa3},
-  {0x91, 0xaf},
-  {0x91, 0xc4},
-  {0x91, 0xd7},
-  {0x91, 0xe8},
-  {0x91, 0x20},
-  {0x92, 0x00},
-  {0x93, 0x06},
-  {0x93, 0xe3},
-  {0x93, 0x02},
-  {0x93, 0x02},
-  {0x93, 0x00},
-  {0x93, 0x04},
-  {0x93, 0x00},
-  {0x93, 0x03},
-  {0x93, 0x00},
-  {0x93, 0x00},
-  {0x93, 0x00},
-  {0x93, 0x00},
-  {0x93, 0x00},
-  {0x93, 0x00},
-  {0x93, 0x00},
-  {0x96, 0x00},
-  {0x97, 0x08},
-  {0x97, 0x19},
-  {0x97, 0x02},
-  {0x97, 0x0c},
-  {0x97, 0x24},
-  {0x97, 0x30},
-  {0x97, 0x28},
-  {0x97, 0x26},
-  {0x97, 0x02},
-  {0x97, 0x98},
-  {0x97, 0x80},
-  {0x97, 0x00},
-  {0x97, 0x00},
-  {0xc3, 0xef},
   {0xff, 0x00},
-  {0xba, 0xdc},
-  {0xbb, 0x08},
-  {0xb6, 0x24},
-  {0xb8, 0x33},
-  {0xb7, 0x20},
-  {0xb9, 0x30},
-  {0xb3, 0xb4},
-  {0xb4, 0xca},
-  {0xb5, 0x43},
-  {0xb0, 0x5c},
-  {0xb1, 0x4f},
-  {0xb2, 0x06},
-  {0xc7, 0x00},
-  {0xc6, 0x51},
-  {0xc5, 0x11},
-  {0xc4, 0x9c},
-  {0xbf, 0x00},
-  {0xbc, 0x64},
-  {0xa6, 0x00},
-  {0xa7, 0x1e},
-  {0xa7, 0x6b},
-  {0xa7, 0x47},
-  {0xa7, 0x33},
-  {0xa7, 0x00},
-  {0xa7, 0x23},
-  {0xa7, 0x2e},
-  {0xa7, 0x85},
-  {0xa7, 0x42},
-  {0xa7, 0x33},
-  {0xa7, 0x00},
-  {0xa7, 0x23},
-  {0xa7, 0x1b},
-  {0xa7, 0x74},
-  {0xa7, 0x42},
-  {0xa7, 0x33},
-  {0xa7, 0x00},
-  {0xa7, 0x23},
+  {0xe0, 0x04},
   {0xc0, 0xc8},
   {0xc1, 0x96},
-  {0x8c, 0x00},
-  {0x86, 0x3d},
-  {0x50, 0x92},
+  {0x86, 0x35},
+  {0x50, 0x80},
   {0x51, 0x90},
   {0x52, 0x2c},
   {0x53, 0x00},
   {0x54, 0x00},
   {0x55, 0x88},
+  {0x57, 0x00},
+  {0x5a, 0x78},
+  {0x5b, 0x44},
+  {0x5c, 0x00},
+  {0xd3, 0x04},
+  {0xe0, 0x00},
+};
+
+/* Initialization sequence for VGA resolution (640x480)*/
+const unsigned char OV2640_VGA[][2]=
+{
   {0x5a, 0x50},
   {0x5b, 0x3c},
   {0x5c, 0x00},
   {0xd3, 0x04},
-  {0x7f, 0x00},
-  {0xda, 0x00},
-  {0xe5, 0x1f},
-  {0xe1, 0x67},
   {0xe0, 0x00},
-  {0xdd, 0x7f},
+  {0xFF, 0x00},
   {0x05, 0x00},
+  {0xDA, 0x08},
+  {0xda, 0x09},
+  {0x98, 0x00},
+  {0x99, 0x00},
+  {0x00, 0x00},
   {0xff, 0x00},
   {0xe0, 0x04},
   {0xc0, 0xc8},
   {0xc1, 0x96},
   {0x86, 0x3d},
-  {0x50, 0x92},
+  {0x50, 0x89},
   {0x51, 0x90},
   {0x52, 0x2c},
   {0x53, 0x00},
   {0x54, 0x00},
   {0x55, 0x88},
   {0x57, 0x00},
+  {0x5a, 0xA0},
+  {0x5b, 0x78},
+  {0x5c, 0x00},
+  {0xd3, 0x02},
+  {0xe0, 0x00},
+};
+
+/* Initialization sequence for QVGA resolution (320x240) */
+const unsigned char OV2640_QVGA[][2]=
+{
+  {0x5a, 0x50},
+  {0x5b, 0x3C},
+  {0x5c, 0x00},
+  {0xd3, 0x08},
+  {0xe0, 0x00},
+  {0xFF, 0x00},
+  {0x05, 0x00},
+  {0xDA, 0x08},
+  {0xda, 0x09},
+  {0x98, 0x00},
+  {0x99, 0x00},
+  {0x00, 0x00},
+};
+
+/* Initialization sequence for QQVGA resolution (160x120) */
+const unsigned char OV2640_QQVGA[][2]=
+{
   {0x5a, 0x28}, 
   {0x5b, 0x1E}, 
   {0x5c, 0x00},
@@ -1045,8 +428,6 @@ const char OV2640_QQVGA[][2]=
   */
 void ov2640_Init(uint16_t DeviceAddr, uint32_t resolution)
 {
-  uint32_t index;
-  
   /* Initialize I2C */
   CAMERA_IO_Init();    
   
@@ -1060,38 +441,26 @@ void ov2640_Init(uint16_t DeviceAddr, uint32_t resolution)
   {
   case CAMERA_R160x120:
     {
-      for(index=0; index<(sizeof(OV2640_QQVGA)/2); index++)
-      {
-        CAMERA_IO_Write(DeviceAddr, OV2640_QQVGA[index][0], OV2640_QQVGA[index][1]);
-        CAMERA_Delay(1);
-      } 
+      ov2640_WriteTable(DeviceAddr, OV2640_Common, sizeof(OV2640_Common)/2, 1);
+      ov2640_WriteTable(DeviceAddr, OV2640_QQVGA, sizeof(OV2640_QQVGA)/2, 1);
       break;
     }    
   case CAMERA_R320x240:
     {
-      for(index=0; index<(sizeof(OV2640_QVGA)/2); index++)
-      {
-        CAMERA_IO_Write(DeviceAddr, OV2640_QVGA[index][0], OV2640_QVGA[index][1]);
-        CAMERA_Delay(1);
-      } 
+      ov2640_WriteTable(DeviceAddr, OV2640_Common, sizeof(OV2640_Common)/2, 1);
+      ov2640_WriteTable(DeviceAddr, OV2640_QVGA, sizeof(OV2640_QVGA)/2, 1);
       break;
     }
   case CAMERA_R480x272:
     {
-      for(index=0; index<(sizeof(OV2640_480x272)/2); index++)
-      {
-        CAMERA_IO_Write(DeviceAddr, OV2640_480x272[index][0], OV2640_480x272[index][1]);
-        CAMERA_Delay(2);
-      }
+      ov2640_WriteTable(DeviceAddr, OV2640_Common, sizeof(OV2640_Common)/2, 2);
+      ov2640_WriteTable(DeviceAddr, OV2640_480x272, sizeof(OV2640_480x272)/2, 2);
       break;
     }
   case CAMERA_R640x480:
     {
-      for(index=0; index<(sizeof(OV2640_VGA)/2); index++)
-      {
-        CAMERA_IO_Write(DeviceAddr, OV2640_VGA[index][0], OV2640_VGA[index][1]);
-        CAMERA_Delay(2);
-      }
+      ov2640_WriteTable(DeviceAddr, OV2640_Common, sizeof(OV2640_Common)/2, 2);
+      ov2640_WriteTable(DeviceAddr, OV2640_VGA, sizeof(OV2640_VGA)/2, 2);
       break;
     }    
   default:
@@ -1331,6 +700,26 @@ static uint32_t ov2640_ConvertValue(uint32_t feature, uint32_t value)
   
   return ret;
 }
+
+/**
+  * @brief  Writes an initialization table, one register per transaction.
+  * @note   The SCCB interface of the sensor has no multi-byte write.
+  * @param  DeviceAddr: Device address on communication Bus.
+  * @param  table: Initialization table, register and value pairs.
+  * @param  size: Number of pairs.
+  * @param  delay: Delay after each write, in ms.
+  * @retval None
+  */
+static void ov2640_WriteTable(uint16_t DeviceAddr, const unsigned char table[][2], uint32_t size, uint32_t delay)
+{
+  uint32_t index;
+  
+  for(index=0; index<size; index++)
+  {
+    CAMERA_IO_Write(DeviceAddr, table[index][0], table[index][1]);
+    CAMERA_Delay(delay);
+  }
+}
          
 /**
   * @}
@@ -46,6 +46,12 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "../Common/camera.h"
+
+#if defined ( __GNUC__ )
+#ifndef __weak
+#define __weak __attribute__((weak))
+#endif /* __weak */
+#endif /* __GNUC__ */
    
 /** @addtogroup BSP
   * @{
@@ -120,6 +126,7 @@ uint16_t s5k5cag_ReadID(uint16_t DeviceAddr);
 
 void     CAMERA_IO_Init(void);
 void     CAMERA_IO_Write(uint8_t addr, uint16_t reg, uint16_t value);
+void     CAMERA_IO_WriteMultiple(uint8_t addr, uint16_t reg, const uint16_t *buffer, uint16_t length);
 uint16_t CAMERA_IO_Read(uint8_t addr, uint16_t reg);
 void     CAMERA_Delay(uint32_t delay);
 
@@ -38,6 +38,7 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "stmpe1600.h"
+#include "../Common/regcache.h"
 
 /** @addtogroup BSP
   * @{
@@ -64,6 +65,10 @@
   */ 
 #define STMPE1600_MAX_INSTANCE        2
 
+/* Window of the register copy: IEGPIOR to GPPIR */
+#define STMPE1600_CACHE_FIRST         STMPE1600_REG_IEGPIOR
+#define STMPE1600_CACHE_COUNT         (STMPE1600_REG_GPPIR + 2 - STMPE1600_REG_IEGPIOR)
+
 /* Private macro -------------------------------------------------------------*/
 
 /** @defgroup STMPE1600_Private_Macros
@@ -93,6 +98,12 @@ IO_DrvTypeDef stmpe1600_io_drv =
 };
 
 uint8_t stmpe1600[STMPE1600_MAX_INSTANCE] = {0};
+
+/* Copy of the configuration registers of each instance. IEGPIOR, GPSR, GPDR 
+   and GPPIR are only changed by the driver; GPMR and ISGPIOR follow the pins, 
+   and SYS_CTRL holds the self-clearing reset bit, so they are always read and 
+   written on the bus */
+static REGCACHE_t stmpe1600Cache[STMPE1600_MAX_INSTANCE];
 /**
   * @}
   */ 
@@ -103,6 +114,8 @@ uint8_t stmpe1600[STMPE1600_MAX_INSTANCE] = {0};
   * @{
   */
 static uint8_t stmpe1600_GetInstance(uint16_t DeviceAddr);
+static void    stmpe1600_ReadMultiple(uint16_t DeviceAddr, uint8_t Reg, uint8_t *Buffer, uint16_t Length);
+static void    stmpe1600_WriteMultiple(uint16_t DeviceAddr, uint8_t Reg, uint8_t *Buffer, uint16_t Length);
 
 /* Private functions ---------------------------------------------------------*/
 
@@ -159,6 +172,8 @@ void stmpe1600_Start(uint16_t DeviceAddr, uint32_t IO_Pin)
   */
 void stmpe1600_Reset(uint16_t DeviceAddr)
 {
+  uint8_t instance;
+  
   /* Power Down the stmpe1600 */
   IOE_Write(DeviceAddr, STMPE1600_REG_SYS_CTRL, (uint16_t)0x80);
 
@@ -170,6 +185,19 @@ void stmpe1600_Reset(uint16_t DeviceAddr)
   
   /* Wait for a delay to ensure registers erasing */
   IOE_Delay(2); 
+  
+  /* The register values are back to their defaults, not yet known */
+  instance = stmpe1600_GetInstance(DeviceAddr);
+  if(instance != 0xFF)
+  {
+    if(stmpe1600Cache[instance].count == 0)
+    {
+      REGCACHE_Init(&stmpe1600Cache[instance], STMPE1600_CACHE_FIRST, STMPE1600_CACHE_COUNT);
+      REGCACHE_Cacheable(&stmpe1600Cache[instance], STMPE1600_REG_IEGPIOR, STMPE1600_REG_IEGPIOR + 1);
+      REGCACHE_Cacheable(&stmpe1600Cache[instance], STMPE1600_REG_GPSR, STMPE1600_REG_GPPIR + 1);
+    }
+    REGCACHE_Invalidate(&stmpe1600Cache[instance]);
+  }
 }
 
 /**
@@ -275,7 +303,7 @@ void stmpe1600_IO_InitPin(uint16_t DeviceAddr, uint32_t IO_Pin, uint8_t Directio
   uint8_t tmpData[2] = {0 , 0};
   
   /* Get the current register value */
-  IOE_ReadMultiple(DeviceAddr, STMPE1600_REG_GPDR, tmpData, 2);
+  stmpe1600_ReadMultiple(DeviceAddr, STMPE1600_REG_GPDR, tmpData, 2);
 
   tmp = ((uint16_t)tmpData[0] | (((uint16_t)tmpData[1]) << 8));
   
@@ -290,7 +318,7 @@ void stmpe1600_IO_InitPin(uint16_t DeviceAddr, uint32_t IO_Pin, uint8_t Directio
   }
     
   /* Set the new register value */
-  IOE_WriteMultiple(DeviceAddr, STMPE1600_REG_GPDR, (uint8_t *)&tmp, 2);      
+  stmpe1600_WriteMultiple(DeviceAddr, STMPE1600_REG_GPDR, (uint8_t *)&tmp, 2);      
 }
 
 /**
@@ -367,7 +395,7 @@ void stmpe1600_IO_PolarityInv_Enable(uint16_t DeviceAddr, uint32_t IO_Pin)
   uint8_t tmpData[2] = {0 , 0};
   
   /* Get the current register value */
-  IOE_ReadMultiple(DeviceAddr, STMPE1600_REG_GPPIR, tmpData, 2);
+  stmpe1600_ReadMultiple(DeviceAddr, STMPE1600_REG_GPPIR, tmpData, 2);
   
   tmp = ((uint16_t)tmpData[0] | (((uint16_t)tmpData[1]) << 8));  
 
@@ -375,7 +403,7 @@ void stmpe1600_IO_PolarityInv_Enable(uint16_t DeviceAddr, uint32_t IO_Pin)
   tmp |= (uint16_t)IO_Pin;
     
   /* Set the new register value */  
-  IOE_WriteMultiple(DeviceAddr, STMPE1600_REG_GPPIR, (uint8_t *)&tmp, 2);
+  stmpe1600_WriteMultiple(DeviceAddr, STMPE1600_REG_GPPIR, (uint8_t *)&tmp, 2);
 }
 
 /**
@@ -391,7 +419,7 @@ void stmpe1600_IO_PolarityInv_Disable(uint16_t DeviceAddr, uint32_t IO_Pin)
   uint8_t tmpData[2] = {0 , 0};
   
   /* Get the current register value */
-  IOE_ReadMultiple(DeviceAddr, STMPE1600_REG_GPPIR, tmpData, 2);
+  stmpe1600_ReadMultiple(DeviceAddr, STMPE1600_REG_GPPIR, tmpData, 2);
   
   tmp = ((uint16_t)tmpData[0] | (((uint16_t)tmpData[1]) << 8));  
 
@@ -399,7 +427,7 @@ void stmpe1600_IO_PolarityInv_Disable(uint16_t DeviceAddr, uint32_t IO_Pin)
    tmp &= ~ (uint16_t)IO_Pin;
     
   /* Set the new register value */  
-  IOE_WriteMultiple(DeviceAddr, STMPE1600_REG_GPPIR, (uint8_t *)&tmp, 2);  
+  stmpe1600_WriteMultiple(DeviceAddr, STMPE1600_REG_GPPIR, (uint8_t *)&tmp, 2);  
 }
 
 /**
@@ -431,7 +459,7 @@ void stmpe1600_IO_WritePin(uint16_t DeviceAddr, uint32_t IO_Pin, uint8_t PinStat
   }
     
   /* Set the new register value */  
-  IOE_WriteMultiple(DeviceAddr, STMPE1600_REG_GPSR, (uint8_t *)&tmp, 2);
+  stmpe1600_WriteMultiple(DeviceAddr, STMPE1600_REG_GPSR, (uint8_t *)&tmp, 2);
 }
 
 /**
@@ -471,7 +499,7 @@ void stmpe1600_IO_EnablePinIT(uint16_t DeviceAddr, uint32_t IO_Pin)
   stmpe1600_EnableGlobalIT(DeviceAddr);
 
   /* Get the current register value */
-  IOE_ReadMultiple(DeviceAddr, STMPE1600_REG_IEGPIOR, tmpData, 2);
+  stmpe1600_ReadMultiple(DeviceAddr, STMPE1600_REG_IEGPIOR, tmpData, 2);
   
   tmp = ((uint16_t)tmpData[0] | (((uint16_t)tmpData[1]) << 8));  
   
@@ -479,7 +507,7 @@ void stmpe1600_IO_EnablePinIT(uint16_t DeviceAddr, uint32_t IO_Pin)
   tmp |= (uint16_t)IO_Pin;
     
   /* Write the new register value */
-  IOE_WriteMultiple(DeviceAddr, STMPE1600_REG_IEGPIOR, (uint8_t *)&tmp, 2);
+  stmpe1600_WriteMultiple(DeviceAddr, STMPE1600_REG_IEGPIOR, (uint8_t *)&tmp, 2);
 }
 
 /**
@@ -495,7 +523,7 @@ void stmpe1600_IO_DisablePinIT(uint16_t DeviceAddr, uint32_t IO_Pin)
   uint8_t tmpData[2] = {0 , 0};
   
   /* Get the current register value */
-  IOE_ReadMultiple(DeviceAddr, STMPE1600_REG_IEGPIOR, tmpData, 2);
+  stmpe1600_ReadMultiple(DeviceAddr, STMPE1600_REG_IEGPIOR, tmpData, 2);
   
   tmp = ((uint16_t)tmpData[0] | (((uint16_t)tmpData[1]) << 8));  
   
@@ -503,7 +531,7 @@ void stmpe1600_IO_DisablePinIT(uint16_t DeviceAddr, uint32_t IO_Pin)
   tmp &= ~(uint16_t)IO_Pin;
     
   /* Set the new register value */
-  IOE_WriteMultiple(DeviceAddr, STMPE1600_REG_IEGPIOR, (uint8_t *)&tmp, 2); 
+  stmpe1600_WriteMultiple(DeviceAddr, STMPE1600_REG_IEGPIOR, (uint8_t *)&tmp, 2); 
 }
 
 /**
@@ -586,6 +614,78 @@ static uint8_t stmpe1600_GetInstance(uint16_t DeviceAddr)
   return 0xFF;
 }
 
+/**
+  * @brief  Read consecutive registers, from the copy of the configuration 
+  *         registers if all their values are known.
+  * @param  DeviceAddr: Device address on communication Bus.
+  * @param  Reg: First register address.
+  * @param  Buffer: Pointer to the register values.
+  * @param  Length: Number of registers.
+  * @retval None
+  */
+static void stmpe1600_ReadMultiple(uint16_t DeviceAddr, uint8_t Reg, uint8_t *Buffer, uint16_t Length)
+{
+  uint8_t instance = stmpe1600_GetInstance(DeviceAddr);
+  uint16_t idx = 0;
+  
+  if(instance != 0xFF)
+  {
+    while((idx < Length) && REGCACHE_Read(&stmpe1600Cache[instance], Reg + idx, &Buffer[idx]))
+    {
+      idx++;
+    }
+    if(idx == Length)
+    {
+      return;
+    }
+  }
+  
+  IOE_ReadMultiple(DeviceAddr, Reg, Buffer, Length);
+  
+  if(instance != 0xFF)
+  {
+    for(idx = 0; idx < Length; idx++)
+    {
+      REGCACHE_Fill(&stmpe1600Cache[instance], Reg + idx, Buffer[idx]);
+    }
+  }
+}
+
+/**
+  * @brief  Write consecutive registers, skipping those known to already hold 
+  *         the value.
+  * @param  DeviceAddr: Device address on communication Bus.
+  * @param  Reg: First register address.
+  * @param  Buffer: Pointer to the register values.
+  * @param  Length: Number of registers.
+  * @retval None
+  */
+static void stmpe1600_WriteMultiple(uint16_t DeviceAddr, uint8_t Reg, uint8_t *Buffer, uint16_t Length)
+{
+  uint8_t instance = stmpe1600_GetInstance(DeviceAddr);
+  uint8_t first = 0;
+  uint8_t count = 0;
+  uint16_t idx = 0;
+  
+  if(instance == 0xFF)
+  {
+    IOE_WriteMultiple(DeviceAddr, Reg, Buffer, Length);
+    return;
+  }
+  
+  for(idx = 0; idx < Length; idx++)
+  {
+    REGCACHE_Stage(&stmpe1600Cache[instance], Reg + idx, Buffer[idx]);
+  }
+  
+  /* Only the bytes whose value changed are sent */
+  while((count = REGCACHE_NextRun(&stmpe1600Cache[instance], &first, 0, Length)) != 0)
+  {
+    IOE_WriteMultiple(DeviceAddr, first, REGCACHE_Data(&stmpe1600Cache[instance], first), count);
+    REGCACHE_Complete(&stmpe1600Cache[instance], first, count, 0);
+  }
+}
+
 /**
   * @}
   */ 
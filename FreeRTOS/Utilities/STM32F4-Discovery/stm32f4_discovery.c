@@ -106,6 +106,8 @@ uint32_t I2cxTimeout = I2Cx_TIMEOUT_MAX;    /*<! Value of Timeout when I2C commu
 uint32_t SpixTimeout = SPIx_TIMEOUT_MAX;    /*<! Value of Timeout when SPI communication fails */
 
 static SPI_HandleTypeDef    SpiHandle;
+static DMA_HandleTypeDef    SpiDmaRxHandle;
+static DMA_HandleTypeDef    SpiDmaTxHandle;
 static I2C_HandleTypeDef    I2cHandle;
 /**
   * @}
@@ -122,26 +124,32 @@ static I2C_HandleTypeDef    I2cHandle;
   * @{
   */ 
 static void     I2Cx_Init(void);
-static void     I2Cx_WriteData(uint8_t Addr, uint8_t Reg, uint8_t Value);
+static HAL_StatusTypeDef I2Cx_WriteData(uint8_t Addr, uint8_t Reg, uint8_t Value);
+static HAL_StatusTypeDef I2Cx_WriteBuffer(uint8_t Addr, uint8_t Reg, uint8_t *pBuffer, uint16_t Length);
 static uint8_t  I2Cx_ReadData(uint8_t Addr, uint8_t Reg);
 static void     I2Cx_MspInit(void);
 static void     I2Cx_Error(uint8_t Addr);
 
 static void     SPIx_Init(void);
 static void     SPIx_MspInit(void);
-static uint8_t  SPIx_WriteRead(uint8_t Byte);
+static void     SPIx_Transfer(const uint8_t *pTxData, uint8_t *pRxData, uint16_t Size);
+static HAL_StatusTypeDef SPIx_TransferPolling(const uint8_t *pTxData, uint8_t *pRxData, uint16_t Size);
+static HAL_StatusTypeDef SPIx_TransferDMA(const uint8_t *pTxData, uint8_t *pRxData, uint16_t Size);
 static  void    SPIx_Error(void);
 
 /* Link functions for Accelerometer peripheral */
 void            ACCELERO_IO_Init(void);
 void            ACCELERO_IO_ITConfig(void);
+void            ACCELERO_IO_INT1Config(void);
 void            ACCELERO_IO_Write(uint8_t *pBuffer, uint8_t WriteAddr, uint16_t NumByteToWrite);
 void            ACCELERO_IO_Read(uint8_t *pBuffer, uint8_t ReadAddr, uint16_t NumByteToRead);
+void            ACCELERO_IO_ReadBurst(uint8_t *pBuffer, uint8_t ReadAddr, uint16_t NumByteToRead);
 
 /* Link functions for Audio peripheral */
 void            AUDIO_IO_Init(void);
 void            AUDIO_IO_DeInit(void);
-void            AUDIO_IO_Write(uint8_t Addr, uint8_t Reg, uint8_t Value);
+uint8_t         AUDIO_IO_Write(uint8_t Addr, uint8_t Reg, uint8_t Value);
+uint8_t         AUDIO_IO_WriteMultiple(uint8_t Addr, uint8_t Reg, uint8_t *pBuffer, uint16_t Length);
 uint8_t         AUDIO_IO_Read(uint8_t Addr, uint8_t Reg);
 /**
   * @}
@@ -328,27 +336,134 @@ static void SPIx_Init(void)
 
     SPIx_MspInit();
     HAL_SPI_Init(&SpiHandle);
+    
+    /* SPIx_Transfer accesses the data register directly: enable the
+       peripheral now instead of at the first HAL transfer */
+    __HAL_SPI_ENABLE(&SpiHandle);
   }
 }
 
 /**
-  * @brief  Sends a Byte through the SPI interface and return the Byte received 
-  *         from the SPI bus.
-  * @param  Byte: Byte send.
-  * @retval The received byte value
+  * @brief  Exchanges a block of bytes on the SPI bus (full duplex). The
+  *         transfers shorter than DISCOVERY_SPIx_DMA_THRESHOLD are done
+  *         polling the SPI registers, the longer ones by the DMA.
+  * @param  pTxData: bytes to send, or NULL to send DUMMY_BYTE.
+  * @param  pRxData: buffer for the received bytes, or NULL to discard them.
+  *         Buffers moved by the DMA must not be placed in the CCM RAM.
+  * @param  Size: number of bytes to exchange.
   */
-static uint8_t SPIx_WriteRead(uint8_t Byte)
+static void SPIx_Transfer(const uint8_t *pTxData, uint8_t *pRxData, uint16_t Size)
 {
-  uint8_t receivedbyte = 0;
+  HAL_StatusTypeDef status;
+  
+  if(Size >= DISCOVERY_SPIx_DMA_THRESHOLD)
+  {
+    status = SPIx_TransferDMA(pTxData, pRxData, Size);
+  }
+  else
+  {
+    status = SPIx_TransferPolling(pTxData, pRxData, Size);
+  }
   
-  /* Send a Byte through the SPI peripheral */
-  /* Read byte from the SPI bus */
-  if(HAL_SPI_TransmitReceive(&SpiHandle, (uint8_t*) &Byte, (uint8_t*) &receivedbyte, 1, SpixTimeout) != HAL_OK)
+  if(status != HAL_OK)
   {
     SPIx_Error();
   }
+}
+
+/**
+  * @brief  Exchanges a block of bytes writing and reading the SPI data
+  *         register directly, one byte at a time.
+  * @param  pTxData: bytes to send, or NULL to send DUMMY_BYTE.
+  * @param  pRxData: buffer for the received bytes, or NULL to discard them.
+  * @param  Size: number of bytes to exchange.
+  * @retval HAL_OK, or HAL_TIMEOUT if a byte is not received in time.
+  */
+static HAL_StatusTypeDef SPIx_TransferPolling(const uint8_t *pTxData, uint8_t *pRxData, uint16_t Size)
+{
+  SPI_TypeDef *spi = SpiHandle.Instance;
+  uint32_t timeout;
+  uint8_t data;
+  
+  while(Size > 0x00)
+  {
+    /* The transmit buffer is empty: the previous byte has been received */
+    spi->DR = (pTxData != NULL) ? *pTxData++ : DUMMY_BYTE;
+    
+    /* Wait for the byte shifted in by the slave */
+    timeout = SpixTimeout;
+    while((spi->SR & SPI_SR_RXNE) == 0)
+    {
+      if(--timeout == 0)
+      {
+        return HAL_TIMEOUT;
+      }
+    }
+    data = (uint8_t)spi->DR;
+    
+    if(pRxData != NULL)
+    {
+      *pRxData++ = data;
+    }
+    Size--;
+  }
   
-  return receivedbyte;
+  return HAL_OK;
+}
+
+/**
+  * @brief  Exchanges a block of bytes by the DMA, waiting for the end of the
+  *         transfer. The DMA interrupts are not used, so the BSP does not
+  *         take the DMA2 stream interrupt handlers away from the application.
+  * @param  pTxData: bytes to send, or NULL to send DUMMY_BYTE.
+  * @param  pRxData: buffer for the received bytes, or NULL to discard them.
+  * @param  Size: number of bytes to exchange.
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef SPIx_TransferDMA(const uint8_t *pTxData, uint8_t *pRxData, uint16_t Size)
+{
+  static uint8_t dummy;
+  SPI_TypeDef *spi = SpiHandle.Instance;
+  HAL_StatusTypeDef status;
+  
+  /* A missing buffer is replaced by a single byte, without memory increment */
+  dummy = DUMMY_BYTE;
+  MODIFY_REG(SpiDmaTxHandle.Instance->CR, DMA_SxCR_MINC, (pTxData != NULL) ? DMA_SxCR_MINC : 0U);
+  MODIFY_REG(SpiDmaRxHandle.Instance->CR, DMA_SxCR_MINC, (pRxData != NULL) ? DMA_SxCR_MINC : 0U);
+  
+  status = HAL_DMA_Start(&SpiDmaRxHandle, (uint32_t)(uintptr_t)&spi->DR,
+                         (pRxData != NULL) ? (uint32_t)(uintptr_t)pRxData : (uint32_t)(uintptr_t)&dummy, Size);
+  if(status == HAL_OK)
+  {
+    status = HAL_DMA_Start(&SpiDmaTxHandle,
+                           (pTxData != NULL) ? (uint32_t)(uintptr_t)pTxData : (uint32_t)(uintptr_t)&dummy,
+                           (uint32_t)(uintptr_t)&spi->DR, Size);
+  }
+  if(status != HAL_OK)
+  {
+    __HAL_DMA_DISABLE(&SpiDmaRxHandle);
+    return status;
+  }
+  
+  /* Enable the RX requests first, so that no received byte is missed */
+  SET_BIT(spi->CR2, SPI_CR2_RXDMAEN);
+  SET_BIT(spi->CR2, SPI_CR2_TXDMAEN);
+  
+  /* The last byte has been received when the RX stream completes */
+  status = HAL_DMA_PollForTransfer(&SpiDmaRxHandle, HAL_DMA_FULL_TRANSFER, SpixTimeout);
+  if(status == HAL_OK)
+  {
+    status = HAL_DMA_PollForTransfer(&SpiDmaTxHandle, HAL_DMA_FULL_TRANSFER, SpixTimeout);
+  }
+  
+  CLEAR_BIT(spi->CR2, SPI_CR2_TXDMAEN | SPI_CR2_RXDMAEN);
+  if(status != HAL_OK)
+  {
+    __HAL_DMA_DISABLE(&SpiDmaTxHandle);
+    __HAL_DMA_DISABLE(&SpiDmaRxHandle);
+  }
+  
+  return status;
 }
 
 /**
@@ -383,6 +498,30 @@ static void SPIx_MspInit(void)
   GPIO_InitStructure.Speed = GPIO_SPEED_MEDIUM;
   GPIO_InitStructure.Alternate = DISCOVERY_SPIx_AF;
   HAL_GPIO_Init(DISCOVERY_SPIx_GPIO_PORT, &GPIO_InitStructure);
+  
+  /* DMA streams for the block transfers: byte wide, direct mode, no interrupts */
+  DISCOVERY_SPIx_DMA_CLK_ENABLE();
+  
+  SpiDmaRxHandle.Instance = DISCOVERY_SPIx_DMA_RX_STREAM;
+  SpiDmaRxHandle.Init.Channel = DISCOVERY_SPIx_DMA_CHANNEL;
+  SpiDmaRxHandle.Init.Direction = DMA_PERIPH_TO_MEMORY;
+  SpiDmaRxHandle.Init.PeriphInc = DMA_PINC_DISABLE;
+  SpiDmaRxHandle.Init.MemInc = DMA_MINC_ENABLE;
+  SpiDmaRxHandle.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+  SpiDmaRxHandle.Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+  SpiDmaRxHandle.Init.Mode = DMA_NORMAL;
+  SpiDmaRxHandle.Init.Priority = DMA_PRIORITY_HIGH;
+  SpiDmaRxHandle.Init.FIFOMode = DMA_FIFOMODE_DISABLE;
+  SpiDmaRxHandle.Init.FIFOThreshold = DMA_FIFO_THRESHOLD_FULL;
+  SpiDmaRxHandle.Init.MemBurst = DMA_MBURST_SINGLE;
+  SpiDmaRxHandle.Init.PeriphBurst = DMA_PBURST_SINGLE;
+  HAL_DMA_Init(&SpiDmaRxHandle);
+  
+  SpiDmaTxHandle.Instance = DISCOVERY_SPIx_DMA_TX_STREAM;
+  SpiDmaTxHandle.Init = SpiDmaRxHandle.Init;
+  SpiDmaTxHandle.Init.Direction = DMA_MEMORY_TO_PERIPH;
+  SpiDmaTxHandle.Init.Priority = DMA_PRIORITY_MEDIUM;
+  HAL_DMA_Init(&SpiDmaTxHandle);
 }
 
 /******************************* I2C Routines**********************************/
@@ -413,7 +552,7 @@ static void I2Cx_Init(void)
   * @param  Value: The target register value to be written 
   * @retval HAL status
   */
-static void I2Cx_WriteData(uint8_t Addr, uint8_t Reg, uint8_t Value)
+static HAL_StatusTypeDef I2Cx_WriteData(uint8_t Addr, uint8_t Reg, uint8_t Value)
 {
   HAL_StatusTypeDef status = HAL_OK;
   
@@ -425,6 +564,31 @@ static void I2Cx_WriteData(uint8_t Addr, uint8_t Reg, uint8_t Value)
     /* Execute user timeout callback */
     I2Cx_Error(Addr);
   }
+  return status;
+}
+
+/**
+  * @brief  Write a buffer to the device through BUS, in a single transaction
+  * @param  Addr: Device address on BUS Bus.  
+  * @param  Reg: The target register address (and device specific flags, e.g. 
+  *         the auto-increment bit) sent before the data
+  * @param  pBuffer: The data to be written
+  * @param  Length: Number of bytes to write
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef I2Cx_WriteBuffer(uint8_t Addr, uint8_t Reg, uint8_t *pBuffer, uint16_t Length)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+  
+  status = HAL_I2C_Mem_Write(&I2cHandle, Addr, (uint16_t)Reg, I2C_MEMADD_SIZE_8BIT, pBuffer, Length, I2cxTimeout); 
+
+  /* Check the communication status */
+  if(status != HAL_OK)
+  {
+    /* Execute user timeout callback */
+    I2Cx_Error(Addr);
+  }
+  return status;
 }
 
 /**
@@ -551,6 +715,31 @@ void ACCELERO_IO_ITConfig(void)
   HAL_NVIC_EnableIRQ((IRQn_Type)ACCELERO_INT2_EXTI_IRQn);
 }
 
+/**
+  * @brief  Configures the Accelerometer INT1 (FIFO watermark, data ready).
+  *         INT1 shares EXTI0 with the user button: once this function is
+  *         called the button can only be used in BUTTON_MODE_GPIO.
+  *         The interrupt has the lowest priority, below the SysTick used by
+  *         the SPI timeouts, so the FIFO can be read from its handler.
+  */
+void ACCELERO_IO_INT1Config(void)
+{
+  GPIO_InitTypeDef GPIO_InitStructure;
+  
+  /* Enable INT1 GPIO clock and configure GPIO PIN to detect Interrupts */
+  ACCELERO_INT_GPIO_CLK_ENABLE();
+  
+  GPIO_InitStructure.Pin = ACCELERO_INT1_PIN;
+  GPIO_InitStructure.Mode = GPIO_MODE_IT_RISING;
+  GPIO_InitStructure.Speed = GPIO_SPEED_FAST;
+  GPIO_InitStructure.Pull = GPIO_NOPULL;
+  HAL_GPIO_Init(ACCELERO_INT_GPIO_PORT, &GPIO_InitStructure);
+  
+  /* Enable and set Accelerometer INT1 to the lowest priority */
+  HAL_NVIC_SetPriority((IRQn_Type)ACCELERO_INT1_EXTI_IRQn, 0x0F, 0);
+  HAL_NVIC_EnableIRQ((IRQn_Type)ACCELERO_INT1_EXTI_IRQn);
+}
+
 /**
   * @brief  Writes one byte to the Accelerometer.
   * @param  pBuffer: pointer to the buffer containing the data to be written to the Accelerometer.
@@ -571,15 +760,10 @@ void ACCELERO_IO_Write(uint8_t *pBuffer, uint8_t WriteAddr, uint16_t NumByteToWr
   ACCELERO_CS_LOW();
   
   /* Send the Address of the indexed register */
-  SPIx_WriteRead(WriteAddr);
+  SPIx_Transfer(&WriteAddr, NULL, 1);
   
   /* Send the data that will be written into the device (MSB First) */
-  while(NumByteToWrite >= 0x01)
-  {
-    SPIx_WriteRead(*pBuffer);
-    NumByteToWrite--;
-    pBuffer++;
-  }
+  SPIx_Transfer(pBuffer, NULL, NumByteToWrite);
   
   /* Set chip select High at the end of the transmission */ 
   ACCELERO_CS_HIGH();
@@ -605,16 +789,38 @@ void ACCELERO_IO_Read(uint8_t *pBuffer, uint8_t ReadAddr, uint16_t NumByteToRead
   ACCELERO_CS_LOW();
   
   /* Send the Address of the indexed register */
-  SPIx_WriteRead(ReadAddr);
+  SPIx_Transfer(&ReadAddr, NULL, 1);
   
-  /* Receive the data that will be read from the device (MSB First) */
-  while(NumByteToRead > 0x00)
-  {
-    /* Send dummy byte (0x00) to generate the SPI clock to ACCELEROMETER (Slave device) */
-    *pBuffer = SPIx_WriteRead(DUMMY_BYTE);
-    NumByteToRead--;
-    pBuffer++;
-  }
+  /* Receive the data that will be read from the device (MSB First),
+     sending dummy bytes to generate the SPI clock */
+  SPIx_Transfer(NULL, pBuffer, NumByteToRead);
+  
+  /* Set chip select High at the end of the transmission */ 
+  ACCELERO_CS_HIGH();
+}
+
+/**
+  * @brief  Reads consecutive registers from the Accelerometer in a single chip
+  *         select cycle, relying on the register address auto-increment of
+  *         the device (LIS3DSH IF_ADD_INC): unlike ACCELERO_IO_Read the
+  *         address is sent as is, without the MS bit, which on the LIS3DSH
+  *         is part of the 7-bit register address.
+  * @param  pBuffer: pointer to the buffer that receives the data read from the Accelerometer.
+  * @param  ReadAddr: Accelerometer's internal address of the first register to read.
+  * @param  NumByteToRead: number of bytes to read from the Accelerometer.
+  */
+void ACCELERO_IO_ReadBurst(uint8_t *pBuffer, uint8_t ReadAddr, uint16_t NumByteToRead)
+{
+  ReadAddr |= (uint8_t)READWRITE_CMD;
+  
+  /* Set chip select Low at the start of the transmission */
+  ACCELERO_CS_LOW();
+  
+  /* Send the Address of the first register */
+  SPIx_Transfer(&ReadAddr, NULL, 1);
+  
+  /* Receive the data that will be read from the device */
+  SPIx_Transfer(NULL, pBuffer, NumByteToRead);
   
   /* Set chip select High at the end of the transmission */ 
   ACCELERO_CS_HIGH();
@@ -667,10 +873,25 @@ void AUDIO_IO_DeInit(void)
   * @param  Addr: I2C address
   * @param  Reg: Reg address 
   * @param  Value: Data to be written
+  * @retval HAL status (HAL_OK if the codec acknowledged the write)
+  */
+uint8_t AUDIO_IO_Write (uint8_t Addr, uint8_t Reg, uint8_t Value)
+{
+  return (uint8_t)I2Cx_WriteData(Addr, Reg, Value);
+}
+
+/**
+  * @brief  Writes consecutive registers in a single transaction.
+  * @param  Addr: I2C address
+  * @param  Reg: Reg address of the first byte, with the codec auto-increment 
+  *         bit set (see CS43L22_MAP_INCR)
+  * @param  pBuffer: Data to be written
+  * @param  Length: Number of bytes to write
+  * @retval HAL status (HAL_OK if the codec acknowledged the whole transaction)
   */
-void AUDIO_IO_Write (uint8_t Addr, uint8_t Reg, uint8_t Value)
+uint8_t AUDIO_IO_WriteMultiple(uint8_t Addr, uint8_t Reg, uint8_t *pBuffer, uint16_t Length)
 {
-  I2Cx_WriteData(Addr, Reg, Value);
+  return (uint8_t)I2Cx_WriteBuffer(Addr, Reg, pBuffer, Length);
 }
 
 /**
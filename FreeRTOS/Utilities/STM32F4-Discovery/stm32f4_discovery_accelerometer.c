@@ -248,6 +248,43 @@ void BSP_ACCELERO_GetXYZ(int16_t *pDataXYZ)
   }
 }
 
+/**
+  * @brief  Start the acquisition through the accelerometer FIFO, in stream
+  *         mode: the samples are collected at the configured data rate and
+  *         INT1 (EXTI0) rises when the FIFO reaches the watermark level. The
+  *         EXTI0 handler must then read the FIFO with BSP_ACCELERO_FIFO_Read
+  *         until it is empty, which releases INT1.
+  * @param  Watermark: FIFO level, from 1 to 31 samples, that raises INT1.
+  * @retval ACCELERO_OK, or ACCELERO_ERROR if the MEMS has no FIFO (LIS302DL).
+  */
+uint8_t BSP_ACCELERO_FIFO_Start(uint8_t Watermark)
+{
+  if(AcceleroDrv != &Lis3dshDrv)
+  {
+    return ACCELERO_ERROR;
+  }
+  
+  LIS3DSH_FIFOConfig(LIS3DSH_FIFO_STREAM_MODE, Watermark);
+  return ACCELERO_OK;
+}
+
+/**
+  * @brief  Read the samples stored in the accelerometer FIFO, oldest first.
+  * @param  pDataXYZ: buffer of 3 * MaxSamples values, X, Y, Z of each sample.
+  *                   It must not be placed in the CCM RAM.
+  * @param  MaxSamples: maximum number of samples to read.
+  * @retval Number of samples read, 0 if the FIFO is empty.
+  */
+uint8_t BSP_ACCELERO_FIFO_Read(int16_t *pDataXYZ, uint8_t MaxSamples)
+{
+  if(AcceleroDrv != &Lis3dshDrv)
+  {
+    return 0;
+  }
+  
+  return LIS3DSH_ReadFIFO(pDataXYZ, MaxSamples);
+}
+
 /**
   * @}
   */ 
@@ -0,0 +1,457 @@
+/**
+ * @file audiodsp.c
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+#include "audiodsp.h"
+#include <assert.h>
+#include <math.h>
+#include <stddef.h>
+#include <string.h>
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+#define AUDIODSP_LOG2_DB		10885		//!< log2(10) / 20 in Q16: un dB in unita' log2 Q16
+#define AUDIODSP_LOG2_K			22500		//!< log2(1 + f) ~ f + K f (1 - f), K in Q16
+#define AUDIODSP_EXP2_K			22500		//!< 2^f ~ 1 + f - K f (1 - f), K in Q16
+#define AUDIODSP_GATE_DETECT_MS	10			//!< tempo di rilascio del rivelatore del noise gate, in ms
+#define AUDIODSP_PI				3.14159265358979323846f
+
+/**
+ * @brief Prodotto scalare di due coppie di valori a 16 bit con accumulo a 64 bit, acc + x.lo * y.lo + x.hi * y.hi.
+ * @details Sui core con estensione DSP (Cortex-M4) e' una singola istruzione SMLALD.
+ */
+static inline int64_t AUDIODSP_Smlald(uint32_t x, uint32_t y, int64_t acc) {
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+	__asm__ ("smlald %Q0, %R0, %1, %2" : "+r" (acc) : "r" (x), "r" (y));
+	return acc;
+#else
+	return acc + (int32_t)(int16_t)x * (int16_t)y + (int32_t)(int16_t)(x >> 16) * (int16_t)(y >> 16);
+#endif
+}
+
+/**
+ * @brief Parte ricorsiva di una sezione biquad, acc + b1 x1 + b2 x2 - a1 y1 - a2 y2, con i valori impaccati a coppie.
+ * @details Sui Cortex-M4 sono due SMLALD; su x86 i quattro prodotti sono calcolati da una sola PMADDWD (SSE2), che
+ * somma i prodotti a coppie su 32 bit. Nessun coefficiente vale -32768 (lo escludono AUDIODSP_BiquadDesign() e
+ * AUDIODSP_BiquadInit()), per cui le somme a coppie non traboccano e il risultato e' identico.
+ */
+static inline int64_t AUDIODSP_BiquadTaps(uint32_t x, uint32_t b12, uint32_t y, uint32_t a12, int64_t acc) {
+#if defined(__SSE2__)
+	__m128i p = _mm_madd_epi16(_mm_set_epi32(0, 0, (int32_t)y, (int32_t)x),
+			_mm_set_epi32(0, 0, (int32_t)a12, (int32_t)b12));
+	return acc + _mm_cvtsi128_si32(p) + _mm_cvtsi128_si32(_mm_srli_si128(p, 4));
+#else
+	return AUDIODSP_Smlald(y, a12, AUDIODSP_Smlald(x, b12, acc));
+#endif
+}
+
+/**
+ * @brief Satura un valore a 16 bit con segno.
+ */
+static inline int16_t AUDIODSP_Saturate(int32_t x) {
+	if (x > INT16_MAX)
+		return INT16_MAX;
+	if (x < INT16_MIN)
+		return INT16_MIN;
+	return (int16_t)x;
+}
+
+/**
+ * @brief Logaritmo in base 2, in Q16, di un intero positivo.
+ * @details Parte intera dalla posizione del bit piu' significativo, mantissa con un'approssimazione parabolica
+ * (errore massimo circa 0.01, cioe' 0.05 dB).
+ */
+static inline int32_t AUDIODSP_Log2(uint32_t x) {
+	if (x == 0)
+		x = 1;
+	int32_t n = 31 - __builtin_clz(x);
+	uint32_t f = (n >= 16 ? x >> (n - 16) : x << (16 - n)) & 0xFFFF;
+	uint32_t t = (f * (0x10000 - f)) >> 16;
+	return (n << 16) + (int32_t)f + (int32_t)((t * AUDIODSP_LOG2_K) >> 16);
+}
+
+/**
+ * @brief Potenza di 2, in Q16, di un esponente in Q16.
+ * @details Il risultato satura a 2^15; mantissa con un'approssimazione parabolica, duale di AUDIODSP_Log2().
+ */
+static inline uint32_t AUDIODSP_Exp2(int32_t e) {
+	int32_t n = e >> 16;
+	uint32_t f = (uint32_t)e & 0xFFFF;
+	uint32_t t = (f * (0x10000 - f)) >> 16;
+	uint32_t m = 0x10000 + f - ((t * AUDIODSP_EXP2_K) >> 16);
+	if (n >= 15)
+		return 0x80000000UL;
+	if (n >= 0)
+		return m << n;
+	if (n <= -17)
+		return 0;
+	return m >> -n;
+}
+
+/**
+ * @brief Coefficiente Q15 di un filtro del primo ordine con la costante di tempo data.
+ */
+static int32_t AUDIODSP_TimeCoeff(uint32_t fs, uint16_t ms) {
+	uint32_t samples = fs * ms / 1000;
+	if (samples <= 1)
+		return 32768;
+	return (int32_t)((32768 + samples / 2) / samples);
+}
+
+/**
+ * @brief Aggiorna la misura di carico di uno stadio.
+ */
+static void AUDIODSP_MeterUpdate(AUDIODSP_Meter_t* m, uint32_t cycles, uint32_t budget) {
+	m->cycles = cycles;
+	m->budget = budget;
+	if (cycles > m->cyclesMax)
+		m->cyclesMax = cycles;
+	if (budget && cycles > budget)
+		m->overBudget++;
+}
+
+/**
+ * @brief Quantizza un coefficiente in Q(15 - shift).
+ * @retval 0 se il coefficiente e' rappresentabile, -1 altrimenti
+ */
+static int AUDIODSP_Quantize(float v, uint8_t shift, int16_t* q) {
+	float s = floorf(v * (float)(1 << (15 - shift)) + 0.5f);
+	if (s > (float)INT16_MAX || s < (float)-INT16_MAX)
+		return -1;
+	*q = (int16_t)s;
+	return 0;
+}
+
+int AUDIODSP_BiquadDesign(AUDIODSP_BiquadCoeffs_t* c, AUDIODSP_BiquadType_t type, uint32_t fs, float f0, float q,
+		float gainDb) {
+	assert(c);
+	if (fs == 0 || f0 <= 0.0f || f0 >= (float)fs / 2 || q <= 0.0f)
+		return -1;
+	float w0 = 2.0f * AUDIODSP_PI * f0 / (float)fs;
+	float cw = cosf(w0), sw = sinf(w0);
+	float alpha = sw / (2.0f * q);
+	float A = powf(10.0f, gainDb / 40.0f);
+	float sa = 2.0f * sqrtf(A) * alpha;
+	float b0, b1, b2, a0, a1, a2;
+	switch (type) {
+	case AUDIODSP_LOWPASS:
+		b0 = (1.0f - cw) / 2.0f; b1 = 1.0f - cw; b2 = b0;
+		a0 = 1.0f + alpha; a1 = -2.0f * cw; a2 = 1.0f - alpha;
+		break;
+	case AUDIODSP_HIGHPASS:
+		b0 = (1.0f + cw) / 2.0f; b1 = -(1.0f + cw); b2 = b0;
+		a0 = 1.0f + alpha; a1 = -2.0f * cw; a2 = 1.0f - alpha;
+		break;
+	case AUDIODSP_PEAKING:
+		b0 = 1.0f + alpha * A; b1 = -2.0f * cw; b2 = 1.0f - alpha * A;
+		a0 = 1.0f + alpha / A; a1 = -2.0f * cw; a2 = 1.0f - alpha / A;
+		break;
+	case AUDIODSP_LOWSHELF:
+		b0 = A * ((A + 1.0f) - (A - 1.0f) * cw + sa);
+		b1 = 2.0f * A * ((A - 1.0f) - (A + 1.0f) * cw);
+		b2 = A * ((A + 1.0f) - (A - 1.0f) * cw - sa);
+		a0 = (A + 1.0f) + (A - 1.0f) * cw + sa;
+		a1 = -2.0f * ((A - 1.0f) + (A + 1.0f) * cw);
+		a2 = (A + 1.0f) + (A - 1.0f) * cw - sa;
+		break;
+	case AUDIODSP_HIGHSHELF:
+		b0 = A * ((A + 1.0f) + (A - 1.0f) * cw + sa);
+		b1 = -2.0f * A * ((A - 1.0f) + (A + 1.0f) * cw);
+		b2 = A * ((A + 1.0f) + (A - 1.0f) * cw - sa);
+		a0 = (A + 1.0f) - (A - 1.0f) * cw + sa;
+		a1 = 2.0f * ((A - 1.0f) - (A + 1.0f) * cw);
+		a2 = (A + 1.0f) - (A - 1.0f) * cw - sa;
+		break;
+	default:
+		return -1;
+	}
+	// il formato piu' preciso in cui tutti i coefficienti normalizzati sono rappresentabili
+	for (uint8_t shift = 1; shift <= 2; shift++)
+		if (	AUDIODSP_Quantize(b0 / a0, shift, &c->b0) == 0 &&
+				AUDIODSP_Quantize(b1 / a0, shift, &c->b1) == 0 &&
+				AUDIODSP_Quantize(b2 / a0, shift, &c->b2) == 0 &&
+				AUDIODSP_Quantize(a1 / a0, shift, &c->a1) == 0 &&
+				AUDIODSP_Quantize(a2 / a0, shift, &c->a2) == 0) {
+			c->shift = shift;
+			return 0;
+		}
+	return -1;
+}
+
+void AUDIODSP_BiquadInit(AUDIODSP_Biquad_t* bq, uint8_t channels, const AUDIODSP_BiquadCoeffs_t* coeffs,
+		uint8_t sections) {
+	assert(bq && coeffs);
+	assert(channels > 0 && channels <= AUDIODSP_MAX_CHANNELS);
+	assert(sections <= AUDIODSP_MAX_SECTIONS);
+	memset(bq, 0, sizeof(AUDIODSP_Biquad_t));
+	bq->channels = channels;
+	bq->sections = sections;
+	for (uint8_t s = 0; s < sections; s++) {
+		assert(coeffs[s].shift == 1 || coeffs[s].shift == 2);
+		assert(coeffs[s].a1 != INT16_MIN && coeffs[s].a2 != INT16_MIN);
+		bq->coeffs[s].b0 = coeffs[s].b0;
+		bq->coeffs[s].b12 = (uint16_t)coeffs[s].b1 | ((uint32_t)(uint16_t)coeffs[s].b2 << 16);
+		bq->coeffs[s].a12 = (uint16_t)-coeffs[s].a1 | ((uint32_t)(uint16_t)-coeffs[s].a2 << 16);
+		bq->coeffs[s].shift = coeffs[s].shift;
+	}
+}
+
+void AUDIODSP_BiquadProcess(AUDIODSP_Biquad_t* bq, int16_t* buffer, uint32_t frames) {
+	assert(bq && buffer);
+	const uint8_t channels = bq->channels;
+	for (uint8_t s = 0; s < bq->sections; s++) {
+		const int32_t b0 = bq->coeffs[s].b0;
+		const uint32_t b12 = bq->coeffs[s].b12;
+		const uint32_t a12 = bq->coeffs[s].a12;
+		const uint8_t sh = 15 - bq->coeffs[s].shift;
+		const int32_t mask = (1 << sh) - 1;
+		for (uint8_t c = 0; c < channels; c++) {
+			AUDIODSP_BiquadState_t* st = &bq->state[s][c];
+			uint32_t x = st->x, y = st->y;
+			int32_t err = st->err;
+			int16_t* p = buffer + c;
+			for (uint32_t n = frames; n > 0; n--, p += channels) {
+				int32_t x0 = *p;
+				int64_t acc = b0 * x0 + err;
+				acc = AUDIODSP_BiquadTaps(x, b12, y, a12, acc);
+				int16_t y0 = AUDIODSP_Saturate((int32_t)(acc >> sh));
+				// error feedback: il resto della quantizzazione entra nell'uscita successiva
+				err = (int32_t)acc & mask;
+				x = (x << 16) | (uint16_t)x0;
+				y = (y << 16) | (uint16_t)y0;
+				*p = y0;
+			}
+			st->x = x;
+			st->y = y;
+			st->err = err;
+		}
+	}
+}
+
+void AUDIODSP_CompressorInit(AUDIODSP_Compressor_t* c, uint32_t fs, uint8_t channels, int8_t thresholdDb,
+		uint8_t ratio, uint16_t attackMs, uint16_t releaseMs, uint8_t makeupDb) {
+	assert(c);
+	assert(channels > 0 && channels <= AUDIODSP_MAX_CHANNELS);
+	assert(thresholdDb <= 0 && makeupDb <= 18);
+	memset(c, 0, sizeof(AUDIODSP_Compressor_t));
+	c->channels = channels;
+	c->threshold = thresholdDb * AUDIODSP_LOG2_DB;
+	c->slope = (ratio == 0 ? 32768 : 32768 - 32768 / ratio);
+	c->makeup = makeupDb * AUDIODSP_LOG2_DB;
+	c->attack = AUDIODSP_TimeCoeff(fs, attackMs);
+	c->release = AUDIODSP_TimeCoeff(fs, releaseMs);
+	c->gain = (int32_t)(AUDIODSP_Exp2(c->makeup) >> 4);
+}
+
+void AUDIODSP_CompressorProcess(AUDIODSP_Compressor_t* c, int16_t* buffer, uint32_t frames) {
+	assert(c && buffer);
+	const uint8_t channels = c->channels;
+	int32_t env = c->envelope;
+	int32_t gain = c->gain;
+	for (uint32_t n = frames; n > 0; n--, buffer += channels) {
+		// rivelatore di picco collegato su tutti i canali
+		int32_t peak = 0;
+		for (uint8_t ch = 0; ch < channels; ch++) {
+			int32_t a = buffer[ch] < 0 ? -buffer[ch] : buffer[ch];
+			if (a > peak)
+				peak = a;
+		}
+		int32_t d = (peak << 15) - env;
+		env += (int32_t)(((int64_t)d * (d > 0 ? c->attack : c->release)) >> 15);
+		// curva statica nel dominio log2: oltre la soglia il livello cresce di 1/ratio
+		int32_t over = AUDIODSP_Log2((uint32_t)env) - (30 << 16) - c->threshold;
+		int32_t lg = c->makeup;
+		if (over > 0)
+			lg -= (int32_t)(((int64_t)over * c->slope) >> 15);
+		gain = (int32_t)(AUDIODSP_Exp2(lg) >> 4);
+		for (uint8_t ch = 0; ch < channels; ch++)
+			buffer[ch] = AUDIODSP_Saturate((buffer[ch] * gain + (1 << 11)) >> 12);
+	}
+	c->envelope = env;
+	c->gain = gain;
+}
+
+void AUDIODSP_GateInit(AUDIODSP_Gate_t* g, uint32_t fs, uint8_t channels, int8_t thresholdDb, int8_t rangeDb,
+		uint16_t attackMs, uint16_t holdMs, uint16_t releaseMs) {
+	assert(g);
+	assert(channels > 0 && channels <= AUDIODSP_MAX_CHANNELS);
+	assert(thresholdDb <= 0 && rangeDb <= 0);
+	memset(g, 0, sizeof(AUDIODSP_Gate_t));
+	g->channels = channels;
+	g->threshold = (int32_t)(AUDIODSP_Exp2(thresholdDb * AUDIODSP_LOG2_DB) << 14);
+	g->floor = (int32_t)(AUDIODSP_Exp2(rangeDb * AUDIODSP_LOG2_DB) << 14);
+	g->attack = AUDIODSP_TimeCoeff(fs, attackMs);
+	g->release = AUDIODSP_TimeCoeff(fs, releaseMs);
+	g->detector = AUDIODSP_TimeCoeff(fs, AUDIODSP_GATE_DETECT_MS);
+	g->hold = fs * holdMs / 1000;
+	g->gain = g->floor;
+}
+
+void AUDIODSP_GateProcess(AUDIODSP_Gate_t* g, int16_t* buffer, uint32_t frames) {
+	assert(g && buffer);
+	const uint8_t channels = g->channels;
+	int32_t env = g->envelope;
+	int32_t gain = g->gain;
+	for (uint32_t n = frames; n > 0; n--, buffer += channels) {
+		int32_t peak = 0;
+		for (uint8_t ch = 0; ch < channels; ch++) {
+			int32_t a = buffer[ch] < 0 ? -buffer[ch] : buffer[ch];
+			if (a > peak)
+				peak = a;
+		}
+		// attacco istantaneo, rilascio lento, per non chiudere il gate tra un periodo e l'altro
+		if ((peak << 15) > env)
+			env = peak << 15;
+		else
+			env -= (int32_t)(((int64_t)env * g->detector) >> 15);
+		int32_t target;
+		if (env >= g->threshold) {
+			g->holdCount = g->hold;
+			target = 1 << 30;
+		}
+		else if (g->holdCount > 0) {
+			g->holdCount--;
+			target = 1 << 30;
+		}
+		else
+			target = g->floor;
+		int32_t d = target - gain;
+		gain += (int32_t)(((int64_t)d * (d > 0 ? g->attack : g->release)) >> 15);
+		int32_t q15 = gain >> 15;
+		for (uint8_t ch = 0; ch < channels; ch++)
+			buffer[ch] = (int16_t)((buffer[ch] * q15) >> 15);
+	}
+	g->envelope = env;
+	g->gain = gain;
+}
+
+void AUDIODSP_SRCInit(AUDIODSP_SRC_t* src, uint8_t channels, uint32_t fsIn, uint32_t fsOut) {
+	assert(src);
+	assert(channels > 0 && channels <= AUDIODSP_MAX_CHANNELS);
+	assert(fsIn > 0 && fsOut > 0);
+	memset(src, 0, sizeof(AUDIODSP_SRC_t));
+	src->channels = channels;
+	src->nominal = ((uint64_t)fsIn << 32) / fsOut;
+	src->step = src->nominal;
+	// il primo frame interpolato e' il secondo della storia, che ha a disposizione il frame precedente
+	src->pos = (uint64_t)1 << 32;
+}
+
+void AUDIODSP_SRCTrim(AUDIODSP_SRC_t* src, int32_t ppm) {
+	assert(src);
+	src->step = src->nominal + (int64_t)src->nominal * ppm / 1000000;
+}
+
+/**
+ * @brief Campione del canale c del frame k dell'ingresso esteso con la storia (i primi tre frame).
+ */
+static inline int32_t AUDIODSP_SRCSample(const AUDIODSP_SRC_t* src, const int16_t* in, uint32_t k, uint8_t c) {
+	return k < 3 ? src->history[k][c] : in[(k - 3) * src->channels + c];
+}
+
+uint32_t AUDIODSP_SRCProcess(AUDIODSP_SRC_t* src, const int16_t* in, uint32_t inFrames, int16_t* out,
+		uint32_t outFrames) {
+	assert(src && in && out);
+	uint32_t start = AUDIODSP_CYCLES();
+	const uint8_t channels = src->channels;
+	uint64_t pos = src->pos;
+	uint32_t produced = 0;
+	// l'interpolazione nel frame i usa i frame da i - 1 a i + 2 dell'ingresso esteso, che ne ha inFrames + 3
+	while (produced < outFrames && (uint32_t)(pos >> 32) <= inFrames) {
+		uint32_t i = (uint32_t)(pos >> 32);
+		int32_t f = (int32_t)((uint32_t)pos >> 17);
+		for (uint8_t c = 0; c < channels; c++) {
+			int32_t xm1 = AUDIODSP_SRCSample(src, in, i - 1, c);
+			int32_t x0 = AUDIODSP_SRCSample(src, in, i, c);
+			int32_t x1 = AUDIODSP_SRCSample(src, in, i + 1, c);
+			int32_t x2 = AUDIODSP_SRCSample(src, in, i + 2, c);
+			// Catmull-Rom, coefficienti raddoppiati per restare interi
+			int32_t c1 = x1 - xm1;
+			int32_t c2 = 2 * xm1 - 5 * x0 + 4 * x1 - x2;
+			int32_t c3 = (x2 - xm1) + 3 * (x0 - x1);
+			int64_t t = (((int64_t)c3 * f) >> 15) + c2;
+			t = ((t * f) >> 15) + c1;
+			t = (t * f) >> 15;
+			*out++ = AUDIODSP_Saturate(x0 + (int32_t)((t + 1) >> 1));
+		}
+		produced++;
+		pos += src->step;
+	}
+	if ((uint32_t)(pos >> 32) <= inFrames) {
+		// uscita piena: i frame rimanenti del blocco sono contati e saltati, la fase resta allineata all'ingresso
+		uint64_t left = ((((uint64_t)inFrames + 1) << 32) - pos + src->step - 1) / src->step;
+		src->dropped += (uint32_t)left;
+		pos += left * src->step;
+	}
+	// gli ultimi tre frame dell'ingresso esteso diventano la storia
+	for (uint32_t k = 0; k < 3; k++)
+		for (uint8_t c = 0; c < channels; c++)
+			src->history[k][c] = (int16_t)AUDIODSP_SRCSample(src, in, inFrames + k, c);
+	src->pos = pos - ((uint64_t)inFrames << 32);
+	AUDIODSP_MeterUpdate(&src->meter, AUDIODSP_CYCLES() - start, 0);
+	return produced;
+}
+
+void AUDIODSP_BiquadStage(void* state, int16_t* buffer, uint32_t frames) {
+	AUDIODSP_BiquadProcess((AUDIODSP_Biquad_t*)state, buffer, frames);
+}
+
+void AUDIODSP_CompressorStage(void* state, int16_t* buffer, uint32_t frames) {
+	AUDIODSP_CompressorProcess((AUDIODSP_Compressor_t*)state, buffer, frames);
+}
+
+void AUDIODSP_GateStage(void* state, int16_t* buffer, uint32_t frames) {
+	AUDIODSP_GateProcess((AUDIODSP_Gate_t*)state, buffer, frames);
+}
+
+void AUDIODSP_ChainInit(AUDIODSP_Chain_t* chain, uint32_t coreClock, uint32_t fs) {
+	assert(chain && fs > 0);
+	memset(chain, 0, sizeof(AUDIODSP_Chain_t));
+	chain->cyclesPerFrame = coreClock / fs;
+}
+
+int AUDIODSP_ChainAdd(AUDIODSP_Chain_t* chain, AUDIODSP_Stage_t process, void* state, uint16_t share) {
+	assert(chain && process);
+	assert(share <= 1000);
+	if (chain->count == AUDIODSP_MAX_STAGES)
+		return -1;
+	chain->stage[chain->count].process = process;
+	chain->stage[chain->count].state = state;
+	chain->stage[chain->count].share = share;
+	return chain->count++;
+}
+
+void AUDIODSP_ChainProcess(AUDIODSP_Chain_t* chain, int16_t* buffer, uint32_t frames) {
+	assert(chain && buffer);
+	uint32_t block = frames * chain->cyclesPerFrame;
+	uint32_t start = AUDIODSP_CYCLES();
+	uint32_t t0 = start;
+	for (uint8_t i = 0; i < chain->count; i++) {
+		chain->stage[i].process(chain->stage[i].state, buffer, frames);
+		uint32_t t1 = AUDIODSP_CYCLES();
+		AUDIODSP_MeterUpdate(&chain->stage[i].meter, t1 - t0,
+				(uint32_t)((uint64_t)block * chain->stage[i].share / 1000));
+		t0 = t1;
+	}
+	AUDIODSP_MeterUpdate(&chain->meter, t0 - start, block);
+}
+
+const AUDIODSP_Meter_t* AUDIODSP_ChainMeter(const AUDIODSP_Chain_t* chain, int index) {
+	assert(chain && index < (int)chain->count);
+	return index < 0 ? &chain->meter : &chain->stage[index].meter;
+}
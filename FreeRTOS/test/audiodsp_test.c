@@ -0,0 +1,406 @@
+/**
+ * @file audiodsp_test.c
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+/**
+ * @brief Verifica su host dei nuclei di audiodsp.c, rispetto a riferimenti in virgola mobile e a uscite di
+ * riferimento, e misura del costo.
+ *
+ * @details
+ * Sono verificati:
+ *  - la cascata di biquad, rispetto alla stessa cascata in doppia precisione con i coefficienti quantizzati, e
+ *    l'indipendenza dell'uscita dalla dimensione dei blocchi;
+ *  - la curva statica del compressore, per livelli da -40 a 0 dBFS, e il picco in uscita del limitatore;
+ *  - l'attenuazione del noise gate a gate chiuso e il guadagno unitario a gate aperto;
+ *  - il convertitore di frequenza di campionamento, come rapporto segnale/errore su un tono e numero di frame
+ *    prodotti, e il comportamento con spazio in uscita insufficiente: i frame prodotti sono gli stessi di una
+ *    conversione con spazio a sufficienza, quelli mancanti sono contati in dropped e la fase resta allineata;
+ *  - le uscite di riferimento: un'impronta per ciascun nucleo, uguale per la versione in C (SMLALD sui Cortex-M4) e
+ *    per quella SSE2.
+ *
+ * Infine viene riportato il costo per frame stereo di ciascun nucleo, in ns e, su x86, in cicli, e la misura di
+ * carico della catena: su x86 AUDIODSP_CYCLES() legge il contatore TSC, per cui la catena misura i cicli come sul
+ * Cortex-M4 con DWT_CYCCNT; sugli host senza contatore le righe dei misuratori sono omesse.
+ * @code
+ * gcc -std=gnu99 -O2 -Wall -Wextra -IUtilities test/audiodsp_test.c Utilities/audiodsp.c -lm -o audiodsp_test && ./audiodsp_test
+ * gcc -std=gnu99 -O2 -mno-sse2 -IUtilities -c Utilities/audiodsp.c -o audiodsp.o && \
+ *   gcc -std=gnu99 -O2 -Wall -Wextra -IUtilities test/audiodsp_test.c audiodsp.o -lm -o audiodsp_test && ./audiodsp_test
+ * @endcode
+ */
+#include "audiodsp.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <math.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#define TEST_FS				16000		//!< frequenza di campionamento (Hz)
+#define TEST_FRAMES			16000		//!< frame per prova, un secondo
+#define TEST_BLOCK			16			//!< frame per blocco, un millisecondo come nel BSP
+#define TEST_PI				3.14159265358979323846
+#define BENCH_FRAMES		4000000		//!< frame elaborati per la misura del costo
+
+/**
+ * @brief Impronte delle uscite di TestGolden(), per biquad, compressore, noise gate e convertitore.
+ */
+static const uint32_t golden[4] = { 0xa143915du, 0xc5489795u, 0xcbdec8e4u, 0x94c9d139u };
+
+static int failures = 0;
+
+#define CHECK(cond) do { if (!(cond)) { printf("%s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+static uint32_t seed = 12345;
+
+static uint32_t Random(void) {
+	seed ^= seed << 13;
+	seed ^= seed >> 17;
+	seed ^= seed << 5;
+	return seed;
+}
+
+/**
+ * @brief Tono sinusoidale stereo, uguale sui due canali.
+ * @param[out] x frame interlacciati
+ * @param[in] frames numero di frame
+ * @param[in] level livello in dBFS
+ * @param[in] freq frequenza (Hz)
+ */
+static void Tone(int16_t* x, uint32_t frames, double level, double freq) {
+	double a = pow(10, level / 20) * 32767;
+	for (uint32_t n = 0; n < frames; n++)
+		x[2 * n] = x[2 * n + 1] = (int16_t) lrint(a * sin(2 * TEST_PI * freq * n / TEST_FS));
+}
+
+/**
+ * @brief Segnale di prova: due toni e rumore uniforme, come un parlato con ronzio di rete.
+ */
+static void Program(int16_t* x, uint32_t frames) {
+	for (uint32_t n = 0; n < frames; n++) {
+		double v = 0.1 * sin(2 * TEST_PI * 997 * n / TEST_FS) + 0.1 * sin(2 * TEST_PI * 60 * n / TEST_FS)
+				+ 0.05 * ((double) (Random() & 0xFFFF) / 32768 - 1);
+		x[2 * n] = x[2 * n + 1] = (int16_t) lrint(v * 32767);
+	}
+}
+
+/**
+ * @brief Picco del canale sinistro, in dBFS, sui frame da n0 a n1 esclusi.
+ */
+static double PeakDb(const int16_t* x, uint32_t n0, uint32_t n1) {
+	int peak = 0;
+	for (uint32_t n = n0; n < n1; n++)
+		if (abs(x[2 * n]) > peak)
+			peak = abs(x[2 * n]);
+	return 20 * log10((peak + 0.1) / 32767);
+}
+
+/**
+ * @brief Equalizzatore di prova: passa-alto a 40 Hz, campana a 1 kHz di +9 dB, shelving a 150 Hz di -6 dB.
+ */
+static void Equalizer(AUDIODSP_BiquadCoeffs_t* c) {
+	CHECK(AUDIODSP_BiquadDesign(&c[0], AUDIODSP_HIGHPASS, TEST_FS, 40, 0.7071f, 0) == 0);
+	CHECK(AUDIODSP_BiquadDesign(&c[1], AUDIODSP_PEAKING, TEST_FS, 1000, 1.0f, 9) == 0);
+	CHECK(AUDIODSP_BiquadDesign(&c[2], AUDIODSP_LOWSHELF, TEST_FS, 150, 0.7071f, -6) == 0);
+}
+
+static void TestBiquad(void) {
+	static int16_t x[2 * TEST_FRAMES], y[2 * TEST_FRAMES];
+	static double ref[TEST_FRAMES];
+	AUDIODSP_BiquadCoeffs_t c[3];
+	AUDIODSP_Biquad_t bq;
+	Equalizer(c);
+	Program(x, TEST_FRAMES);
+	// riferimento: forma diretta I in doppia precisione, con gli stessi coefficienti quantizzati
+	double st[3][4] = { { 0 } };
+	for (uint32_t n = 0; n < TEST_FRAMES; n++) {
+		double v = x[2 * n];
+		for (int k = 0; k < 3; k++) {
+			double s = 1 << (15 - c[k].shift);
+			double w = (c[k].b0 * v + c[k].b1 * st[k][0] + c[k].b2 * st[k][1] - c[k].a1 * st[k][2]
+					- c[k].a2 * st[k][3]) / s;
+			st[k][1] = st[k][0];
+			st[k][0] = v;
+			st[k][3] = st[k][2];
+			st[k][2] = w;
+			v = w;
+		}
+		ref[n] = v;
+	}
+	memcpy(y, x, sizeof(x));
+	AUDIODSP_BiquadInit(&bq, 2, c, 3);
+	for (uint32_t n = 0; n < TEST_FRAMES; n += TEST_BLOCK)
+		AUDIODSP_BiquadProcess(&bq, y + 2 * n, TEST_BLOCK);
+	double e = 0, s = 0;
+	int stereo = 1;
+	for (uint32_t n = 0; n < TEST_FRAMES; n++) {
+		e += (y[2 * n] - ref[n]) * (y[2 * n] - ref[n]);
+		s += ref[n] * ref[n];
+		stereo &= y[2 * n] == y[2 * n + 1];
+	}
+	double snr = 10 * log10(s / e);
+	printf("biquad: SNR rispetto al riferimento %.1f dB\n", snr);
+	CHECK(snr > 65);
+	CHECK(stereo);
+	// un unico blocco da un secondo deve dare la stessa uscita dei blocchi da un millisecondo
+	AUDIODSP_BiquadInit(&bq, 2, c, 3);
+	AUDIODSP_BiquadProcess(&bq, x, TEST_FRAMES);
+	CHECK(memcmp(x, y, sizeof(x)) == 0);
+	// coefficienti in Q13, fuori dall'intervallo [-4, 4) e parametri non validi
+	CHECK(AUDIODSP_BiquadDesign(&c[0], AUDIODSP_PEAKING, TEST_FS, 1000, 1.0f, 30) == 0 && c[0].shift == 2);
+	CHECK(AUDIODSP_BiquadDesign(&c[0], AUDIODSP_PEAKING, TEST_FS, 1000, 1.0f, 60) == -1);
+	CHECK(AUDIODSP_BiquadDesign(&c[0], AUDIODSP_LOWPASS, TEST_FS, TEST_FS / 2, 0.7071f, 0) == -1);
+}
+
+static void TestCompressor(void) {
+	static int16_t x[2 * TEST_FRAMES];
+	AUDIODSP_Compressor_t c;
+	// soglia -20 dBFS, 4:1: il picco a regime segue la curva statica
+	for (int level = -40; level <= 0; level += 5) {
+		Tone(x, TEST_FRAMES, level, 1000);
+		AUDIODSP_CompressorInit(&c, TEST_FS, 2, -20, 4, 1, 200, 0);
+		for (uint32_t n = 0; n < TEST_FRAMES; n += TEST_BLOCK)
+			AUDIODSP_CompressorProcess(&c, x + 2 * n, TEST_BLOCK);
+		double out = PeakDb(x, TEST_FRAMES / 2, TEST_FRAMES);
+		double ideal = level > -20 ? -20 + (level + 20) / 4.0 : level;
+		if (fabs(out - ideal) > 0.5)
+			printf("compressore: %d dBFS -> %.2f dBFS, atteso %.2f\n", level, out, ideal);
+		CHECK(fabs(out - ideal) <= 0.5);
+	}
+	// limitatore a -6 dBFS con 6 dB di compensazione: un tono a fondo scala esce a 0 dBFS senza saturare
+	Tone(x, TEST_FRAMES, 0, 300);
+	AUDIODSP_CompressorInit(&c, TEST_FS, 2, -6, 0, 0, 50, 6);
+	AUDIODSP_CompressorProcess(&c, x, TEST_FRAMES);
+	double peak = PeakDb(x, TEST_BLOCK, TEST_FRAMES);
+	printf("limitatore: picco %.2f dBFS\n", peak);
+	CHECK(peak < 0.01 && peak > -0.5);
+}
+
+static void TestGate(void) {
+	static int16_t x[2 * 3 * TEST_FRAMES];
+	AUDIODSP_Gate_t g;
+	// -50 dBFS per un secondo, poi -20 dBFS, poi di nuovo -50 dBFS; soglia -40 dBFS, attenuazione 60 dB
+	Tone(x, 3 * TEST_FRAMES, -20, 440);
+	for (uint32_t n = 0; n < 3 * TEST_FRAMES; n++)
+		if (n < TEST_FRAMES || n >= 2 * TEST_FRAMES)
+			x[2 * n] = x[2 * n + 1] = (int16_t) (x[2 * n] / 32);
+	AUDIODSP_GateInit(&g, TEST_FS, 2, -40, -60, 1, 50, 20);
+	for (uint32_t n = 0; n < 3 * TEST_FRAMES; n += TEST_BLOCK)
+		AUDIODSP_GateProcess(&g, x + 2 * n, TEST_BLOCK);
+	double closed = PeakDb(x, 0, TEST_FRAMES), open = PeakDb(x, TEST_FRAMES + 800, 2 * TEST_FRAMES);
+	double after = PeakDb(x, 2 * TEST_FRAMES + 4000, 3 * TEST_FRAMES);
+	printf("noise gate: %.1f dBFS chiuso, %.1f dBFS aperto, %.1f dBFS dopo il rilascio\n", closed, open, after);
+	// a gate chiuso resta al piu' un LSB, dal troncamento dei campioni negativi
+	CHECK(closed < -85 && after < -85);
+	CHECK(fabs(open + 20) < 0.2);
+}
+
+/**
+ * @brief Tono a 1 kHz a 16000 dBFS circa, un blocco di TEST_BLOCK frame a partire dal frame n0.
+ */
+static void ToneBlock(int16_t* in, uint32_t n0, uint32_t fs) {
+	for (uint32_t k = 0; k < TEST_BLOCK; k++)
+		in[2 * k] = in[2 * k + 1] = (int16_t) lrint(16000 * sin(2 * TEST_PI * 1000.0 * (n0 + k) / fs));
+}
+
+static void TestSRC(void) {
+	static const uint32_t rates[][2] = { { 16000, 48000 }, { 48000, 44100 }, { 44100, 48000 }, { 16000, 16000 } };
+	static int16_t in[2 * TEST_BLOCK], out[2 * 64], part[2 * 64];
+	static double y[200000];
+	AUDIODSP_SRC_t src, small;
+	for (size_t t = 0; t < sizeof(rates) / sizeof(rates[0]); t++) {
+		uint32_t fsIn = rates[t][0], fsOut = rates[t][1], ny = 0;
+		AUDIODSP_SRCInit(&src, 2, fsIn, fsOut);
+		for (uint32_t n = 0; n < 4000 * TEST_BLOCK; n += TEST_BLOCK) {
+			ToneBlock(in, n, fsIn);
+			uint32_t p = AUDIODSP_SRCProcess(&src, in, TEST_BLOCK, out, 64);
+			for (uint32_t k = 0; k < p; k++) {
+				CHECK(out[2 * k] == out[2 * k + 1]);
+				y[ny++] = out[2 * k];
+			}
+		}
+		double expected = 4000.0 * TEST_BLOCK * fsOut / fsIn;
+		CHECK(src.dropped == 0 && fabs(ny - expected) <= 3);
+		// i tre frame di storia iniziali sono nulli e il primo frame interpolato e' il secondo: y[n] = x(n fsIn / fsOut - 2)
+		double e = 0, s = 0;
+		for (uint32_t n = 100; n < ny; n++) {
+			double r = 16000 * sin(2 * TEST_PI * 1000.0 * ((double) n / fsOut - 2.0 / fsIn));
+			e += (y[n] - r) * (y[n] - r);
+			s += r * r;
+		}
+		double snr = 10 * log10(s / e);
+		printf("SRC %5u -> %5u Hz: %u frame, SNR %.1f dB\n", fsIn, fsOut, ny, snr);
+		CHECK(snr > (fsIn < fsOut ? 60 : 55));
+	}
+	// 16 -> 48 kHz con spazio per 40 dei 48 frame di un blocco: a ogni blocco i frame prodotti sono i primi di quelli
+	// di un convertitore con spazio a sufficienza, gli altri sono contati, e la fase resta allineata
+	AUDIODSP_SRCInit(&src, 2, 16000, 48000);
+	AUDIODSP_SRCInit(&small, 2, 16000, 48000);
+	AUDIODSP_SRCTrim(&src, 300);
+	AUDIODSP_SRCTrim(&small, 300);
+	uint32_t lost = 0;
+	int aligned = 1;
+	for (uint32_t n = 0; n < 4000 * TEST_BLOCK; n += TEST_BLOCK) {
+		ToneBlock(in, n, 16000);
+		uint32_t p = AUDIODSP_SRCProcess(&src, in, TEST_BLOCK, out, 64);
+		uint32_t q = AUDIODSP_SRCProcess(&small, in, TEST_BLOCK, part, 40);
+		CHECK(q == (p < 40 ? p : 40));
+		aligned &= memcmp(out, part, 2 * q * sizeof(int16_t)) == 0;
+		lost += p - q;
+	}
+	CHECK(aligned);
+	CHECK(small.dropped == lost && lost > 4000 * 7);
+	CHECK(src.pos == small.pos);
+}
+
+static uint32_t Fnv(uint32_t h, const int16_t* x, uint32_t count) {
+	const uint8_t* p = (const uint8_t*) x;
+	for (uint32_t n = 0; n < 2 * count; n++)
+		h = (h ^ p[n]) * 16777619u;
+	return h;
+}
+
+/**
+ * @brief Impronte (FNV-1a) delle uscite dei quattro nuclei sullo stesso segnale, con saturazione nel biquad.
+ */
+static void TestGolden(void) {
+	static int16_t x[2 * TEST_FRAMES], y[2 * TEST_FRAMES], out[2 * 64];
+	AUDIODSP_BiquadCoeffs_t c[3];
+	AUDIODSP_Biquad_t bq;
+	AUDIODSP_Compressor_t cp;
+	AUDIODSP_Gate_t g;
+	AUDIODSP_SRC_t src;
+	uint32_t h[4];
+	seed = 12345;
+	Program(x, TEST_FRAMES);
+	for (uint32_t n = 0; n < 2 * TEST_FRAMES; n++)
+		x[n] = (int16_t) (x[n] * 3 + (int16_t) (Random() & 0x3FF) - 512);
+	Equalizer(c);
+	memcpy(y, x, sizeof(x));
+	AUDIODSP_BiquadInit(&bq, 2, c, 3);
+	for (uint32_t n = 0; n < TEST_FRAMES; n += TEST_BLOCK)
+		AUDIODSP_BiquadProcess(&bq, y + 2 * n, TEST_BLOCK);
+	h[0] = Fnv(2166136261u, y, 2 * TEST_FRAMES);
+	memcpy(y, x, sizeof(x));
+	AUDIODSP_CompressorInit(&cp, TEST_FS, 2, -18, 3, 2, 100, 6);
+	for (uint32_t n = 0; n < TEST_FRAMES; n += TEST_BLOCK)
+		AUDIODSP_CompressorProcess(&cp, y + 2 * n, TEST_BLOCK);
+	h[1] = Fnv(2166136261u, y, 2 * TEST_FRAMES);
+	memcpy(y, x, sizeof(x));
+	AUDIODSP_GateInit(&g, TEST_FS, 2, -12, -40, 1, 20, 10);
+	for (uint32_t n = 0; n < TEST_FRAMES; n += TEST_BLOCK)
+		AUDIODSP_GateProcess(&g, y + 2 * n, TEST_BLOCK);
+	h[2] = Fnv(2166136261u, y, 2 * TEST_FRAMES);
+	h[3] = 2166136261u;
+	AUDIODSP_SRCInit(&src, 2, 48000, 44100);
+	AUDIODSP_SRCTrim(&src, 150);
+	for (uint32_t n = 0; n < TEST_FRAMES; n += TEST_BLOCK)
+		h[3] = Fnv(h[3], out, 2 * AUDIODSP_SRCProcess(&src, x + 2 * n, TEST_BLOCK, out, 64));
+	printf("impronte: biquad 0x%08x, compressore 0x%08x, gate 0x%08x, SRC 0x%08x\n", h[0], h[1], h[2], h[3]);
+	for (int k = 0; k < 4; k++)
+		CHECK(h[k] == golden[k]);
+}
+
+/**
+ * @brief Costo di un nucleo per frame stereo, sullo stesso blocco di TEST_BLOCK frame ripetuto.
+ */
+static void Bench(const char* name, AUDIODSP_Stage_t process, void* state) {
+	static int16_t x[2 * TEST_BLOCK], y[2 * TEST_BLOCK];
+	long sink = 0;
+	Program(x, TEST_BLOCK);
+	struct timespec t0, t1;
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+#if defined(__x86_64__) || defined(__i386__)
+	uint64_t c0 = __rdtsc();
+#endif
+	for (uint32_t n = 0; n < BENCH_FRAMES; n += TEST_BLOCK) {
+		memcpy(y, x, sizeof(x));
+		process(state, y, TEST_BLOCK);
+		sink += y[n % (2 * TEST_BLOCK)];
+	}
+#if defined(__x86_64__) || defined(__i386__)
+	uint64_t c1 = __rdtsc();
+#endif
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	double ns = ((t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec)) / BENCH_FRAMES;
+#if defined(__x86_64__) || defined(__i386__)
+	printf("%-22s %6.2f ns, %6.1f cicli TSC per frame stereo [%ld]\n", name, ns, (double) (c1 - c0) / BENCH_FRAMES,
+			sink & 1);
+#else
+	printf("%-22s %6.2f ns per frame stereo [%ld]\n", name, ns, sink & 1);
+#endif
+}
+
+/**
+ * @brief Adatta AUDIODSP_SRCProcess() alla firma di uno stadio, per la misura del costo (48 -> 44.1 kHz).
+ */
+static void SRCStage(void* state, int16_t* buffer, uint32_t frames) {
+	static int16_t out[2 * 64];
+	AUDIODSP_SRCProcess((AUDIODSP_SRC_t*) state, buffer, frames, out, 64);
+	buffer[0] = out[0];
+}
+
+static void Benchmark(void) {
+	AUDIODSP_BiquadCoeffs_t c[3];
+	AUDIODSP_Biquad_t bq;
+	AUDIODSP_Compressor_t cp;
+	AUDIODSP_Gate_t g;
+	AUDIODSP_SRC_t src;
+	AUDIODSP_Chain_t chain;
+	Equalizer(c);
+	AUDIODSP_BiquadInit(&bq, 2, c, 1);
+	Bench("biquad, 1 sezione", AUDIODSP_BiquadStage, &bq);
+	AUDIODSP_BiquadInit(&bq, 2, c, 3);
+	Bench("biquad, 3 sezioni", AUDIODSP_BiquadStage, &bq);
+	AUDIODSP_CompressorInit(&cp, TEST_FS, 2, -30, 4, 1, 100, 6);
+	Bench("compressore", AUDIODSP_CompressorStage, &cp);
+	AUDIODSP_GateInit(&g, TEST_FS, 2, -40, -60, 1, 50, 20);
+	Bench("noise gate", AUDIODSP_GateStage, &g);
+	AUDIODSP_SRCInit(&src, 2, 48000, 44100);
+	Bench("SRC 48 -> 44.1 kHz", SRCStage, &src);
+	// catena con budget di 168 MHz a 16 kHz, ripartito tra gli stadi; su host i cicli sono quelli del TSC
+	AUDIODSP_ChainInit(&chain, 168000000, TEST_FS);
+	CHECK(AUDIODSP_ChainAdd(&chain, AUDIODSP_GateStage, &g, 50) == 0);
+	CHECK(AUDIODSP_ChainAdd(&chain, AUDIODSP_BiquadStage, &bq, 100) == 1);
+	CHECK(AUDIODSP_ChainAdd(&chain, AUDIODSP_CompressorStage, &cp, 50) == 2);
+	Bench("catena", (AUDIODSP_Stage_t) AUDIODSP_ChainProcess, &chain);
+	static const char* names[] = { "noise gate", "biquad", "compressore" };
+#if defined(__x86_64__) || defined(__i386__)
+	CHECK(AUDIODSP_ChainMeter(&chain, -1)->cyclesMax > 0);
+#endif
+	if (AUDIODSP_ChainMeter(&chain, -1)->cyclesMax == 0)
+		printf("  misuratori omessi: AUDIODSP_CYCLES() non legge alcun contatore su questo host\n");
+	for (int i = -1; i < 3 && AUDIODSP_ChainMeter(&chain, -1)->cyclesMax > 0; i++) {
+		const AUDIODSP_Meter_t* m = AUDIODSP_ChainMeter(&chain, i);
+		printf("  %-12s %6u cicli per blocco (massimo %u), budget %u, superato %u volte\n", i < 0 ? "catena" : names[i],
+				m->cycles, m->cyclesMax, m->budget, m->overBudget);
+	}
+	CHECK(AUDIODSP_ChainMeter(&chain, -1)->budget == TEST_BLOCK * (168000000 / TEST_FS));
+}
+
+int main(void) {
+	TestBiquad();
+	TestCompressor();
+	TestGate();
+	TestSRC();
+	TestGolden();
+	Benchmark();
+
+	printf("audiodsp: %s\n", failures ? "FAILED" : "OK");
+	return failures != 0;
+}
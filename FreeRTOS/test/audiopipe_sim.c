@@ -0,0 +1,200 @@
+/**
+ * @file audiopipe_sim.c
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+/**
+ * @brief Simulazione su host della pipeline AUDIOPIPE con clock di acquisizione e di riproduzione diversi.
+ *
+ * @details
+ * Riproduce la configurazione del loopback del BSP (AUDIO_LOOPBACK_BLOCKS blocchi di PCM_OUT_SIZE frame stereo a
+ * 16 kHz, latenza obiettivo di due blocchi):
+ *  - l'acquisizione produce un blocco per periodo del proprio clock, confermato in piu' parti di dimensione casuale,
+ *    come i mezzi buffer del DMA di I2S2 che non sono allineati ai blocchi; ogni frame contiene un contatore e ne
+ *    viene registrato l'istante di acquisizione;
+ *  - la riproduzione, a ogni fine blocco del proprio clock, chiama AUDIOPIPE_Play() come la callback di cambio buffer
+ *    del DMA di I2S3, in doppio buffer, e verifica i frame riprodotti: i contatori devono crescere di 1 (o di 0 e 2
+ *    per un frame duplicato o scartato dalla compensazione); ogni altro salto, o un blocco di silenzio dopo l'avvio,
+ *    e' un buco udibile.
+ *
+ * Per ogni deriva dei clock sono riportati underrun, overrun, frame scartati o duplicati, buchi e latenza tra
+ * acquisizione e riproduzione. Sono verificati l'assenza di buchi da -8000 a +3000 ppm di deriva del periodo di
+ * acquisizione (anche con la deriva sulla riproduzione) e l'assenza di correzioni con i clock uguali; viene infine
+ * cercata la massima deriva compensata con l'acquisizione piu' lenta, il caso limitato da AUDIOPIPE_SLIP_GAIN
+ * (vedi audiopipe.h). Compilando con -DAUDIOPIPE_SLIP_GAIN=1024 la compensazione non tiene il passo gia' a +1000 ppm
+ * (limite di circa 750 ppm) e con 512 a +2000 ppm, per cui il valore predefinito e' 256 (circa 3750 ppm).
+ * @code
+ * gcc -std=gnu99 -O2 -Wall -Wextra -IUtilities test/audiopipe_sim.c Utilities/audiopipe.c -o audiopipe_sim && ./audiopipe_sim
+ * @endcode
+ */
+#include "audiopipe.h"
+#include <stdio.h>
+#include <string.h>
+
+#define FRAMES			16			//!< PCM_OUT_SIZE a 16 kHz
+#define CHANNELS		2			//!< loopback stereo
+#define BLOCKS			8			//!< AUDIO_LOOPBACK_BLOCKS
+#define TARGET			(2 * FRAMES)	//!< AUDIO_LOOPBACK_LATENCY
+#define SIM_SECONDS		60			//!< durata simulata di ogni prova
+#define HISTORY			65536		//!< istanti di acquisizione registrati, indicizzati dal contatore a 16 bit
+
+static int failures = 0;
+
+#define CHECK(cond) do { if (!(cond)) { printf("%s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+/**
+ * @brief Generatore pseudo-casuale xorshift, per rendere la simulazione riproducibile.
+ */
+static uint32_t rng = 12345;
+static uint32_t Random(void) {
+	rng ^= rng << 13;
+	rng ^= rng >> 17;
+	rng ^= rng << 5;
+	return rng;
+}
+
+/**
+ * @brief Risultato di una prova.
+ */
+typedef struct {
+	AUDIOPIPE_Stats_t stats;	//!< contatori della pipeline
+	uint32_t glitches;			//!< buchi udibili
+	double latAvg;				//!< latenza media (ms)
+	double latMin;				//!< latenza minima (ms)
+	double latMax;				//!< latenza massima (ms)
+} Result_t;
+
+static int16_t pool[(BLOCKS + 1) * FRAMES * CHANNELS];
+static double captureTime[HISTORY];
+
+/**
+ * @brief Simula SIM_SECONDS secondi di loopback.
+ * @param[in] capturePpm deriva del periodo di acquisizione (ppm, positiva se l'acquisizione e' piu' lenta)
+ * @param[in] playPpm deriva del periodo di riproduzione (ppm)
+ * @param[out] r risultato
+ */
+static void Simulate(double capturePpm, double playPpm, Result_t* r) {
+	AUDIOPIPE_t p;
+	AUDIOPIPE_Init(&p, pool, BLOCKS, FRAMES, CHANNELS, TARGET, NULL, NULL);
+	const int16_t* silence = pool + BLOCKS * FRAMES * CHANNELS;
+	const double dtc = 1e-3 * (1 + capturePpm * 1e-6), dtp = 1e-3 * (1 + playPpm * 1e-6);
+	double tc = 0.37e-3, tp = 0;		/* i due clock partono sfasati */
+	const int16_t* dma[2];
+	dma[0] = AUDIOPIPE_Play(&p, NULL);
+	dma[1] = AUDIOPIPE_Play(&p, NULL);
+	uint16_t counter = 0, last = 0;
+	int started = 0;
+	double latSum = 0;
+	long latN = 0;
+	memset(r, 0, sizeof(Result_t));
+	r->latMin = 1e9;
+
+	while (tc < SIM_SECONDS || tp < SIM_SECONDS) {
+		if (tc <= tp) {
+			/* un blocco di acquisizione, in parti di dimensione casuale */
+			uint32_t left = FRAMES;
+			while (left) {
+				uint32_t room, n = 1 + Random() % left;
+				int16_t* d = AUDIOPIPE_CaptureBuffer(&p, &room);
+				if (n > room)
+					n = room;
+				for (uint32_t i = 0; i < n; i++) {
+					captureTime[counter] = tc - dtc + (FRAMES - left + i + 1) * dtc / FRAMES;
+					d[i * CHANNELS] = d[i * CHANNELS + 1] = (int16_t) counter++;
+				}
+				AUDIOPIPE_CaptureCommit(&p, n);
+				left -= n;
+			}
+			tc += dtc;
+		}
+		else {
+			/* fine del blocco dma[0]: il DMA passa a dma[1] e carica il successivo nel buffer libero */
+			const int16_t* done = dma[0];
+			dma[0] = dma[1];
+			dma[1] = AUDIOPIPE_Play(&p, done);
+			const int16_t* b = dma[0];
+			if (b == silence) {
+				if (started)
+					r->glitches++;
+				started = 0;
+			}
+			else
+				for (int i = 0; i < FRAMES; i++) {
+					uint16_t v = (uint16_t) b[i * CHANNELS];
+					if (b[i * CHANNELS + 1] != b[i * CHANNELS])
+						r->glitches++;
+					if (started && (uint16_t) (v - last) > 2)
+						r->glitches++;
+					double lat = (tp + i * dtp / FRAMES - captureTime[v]) * 1e3;
+					latSum += lat;
+					latN++;
+					if (lat < r->latMin)
+						r->latMin = lat;
+					if (lat > r->latMax)
+						r->latMax = lat;
+					last = v;
+					started = 1;
+				}
+			tp += dtp;
+		}
+	}
+	r->stats = p.stats;
+	r->latAvg = latN ? latSum / latN : 0;
+}
+
+static void Print(double capturePpm, double playPpm, const Result_t* r) {
+	printf("%+6.0f %+6.0f %9u %6u %6u %7u %8u %6u    %5.2f [%5.2f, %5.2f]\n", capturePpm, playPpm, r->stats.played,
+			r->stats.underruns, r->stats.overruns, r->stats.dropped, r->stats.inserted, r->glitches, r->latAvg,
+			r->latMin, r->latMax);
+}
+
+int main(void) {
+	static const double drifts[] = { -8000, -5000, -3000, -1000, -100, 0, 100, 1000, 2000, 3000 };
+	Result_t r;
+
+	printf("AUDIOPIPE_SLIP_GAIN %d, %d blocchi da %d frame, obiettivo %d frame, %d s per prova\n", AUDIOPIPE_SLIP_GAIN,
+			BLOCKS, FRAMES, TARGET, SIM_SECONDS);
+	printf("   acq    rip  riprodotti under   over scartati duplicati buchi  latenza media [min, max] (ms)\n");
+	for (size_t i = 0; i < sizeof(drifts) / sizeof(drifts[0]); i++) {
+		Simulate(drifts[i], 0, &r);
+		Print(drifts[i], 0, &r);
+		CHECK(r.glitches == 0 && r.stats.underruns == 0 && r.stats.overruns == 0);
+		if (drifts[i] == 0)
+			CHECK(r.stats.dropped == 0 && r.stats.inserted == 0);
+	}
+	/* la deriva e' relativa: spostarla sulla riproduzione non cambia il risultato */
+	Simulate(0, -2000, &r);
+	Print(0, -2000, &r);
+	CHECK(r.glitches == 0 && r.stats.underruns == 0 && r.stats.overruns == 0);
+	Simulate(0, 5000, &r);
+	Print(0, 5000, &r);
+	CHECK(r.glitches == 0 && r.stats.underruns == 0 && r.stats.overruns == 0);
+
+	/* massima deriva compensata con l'acquisizione piu' lenta, a passi di 250 ppm */
+	double limit = 0;
+	for (double ppm = 250; ppm <= 10000; ppm += 250) {
+		Simulate(ppm, 0, &r);
+		if (r.glitches || r.stats.underruns)
+			break;
+		limit = ppm;
+	}
+	printf("acquisizione piu' lenta compensata fino a %.0f ppm; limite teorico %.0f ppm\n", limit,
+			1e6 * (TARGET - FRAMES) / ((double) FRAMES * AUDIOPIPE_SLIP_GAIN));
+	CHECK(limit >= 3000);
+
+	printf("audiopipe: %s\n", failures ? "FAILED" : "OK");
+	return failures != 0;
+}
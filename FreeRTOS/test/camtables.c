@@ -0,0 +1,400 @@
+/**
+ * @file camtables.c
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+/**
+ * @brief Conversione su host delle tabelle di inizializzazione dei sensori S5K5CAG e OV2640 nel formato compatto.
+ *
+ * @details
+ * Le tabelle originali sono coppie {registro, valore}, scritte una per transazione. Lo strumento legge il sorgente
+ * originale del driver e ne converte le tabelle:
+ *  - S5K5CAG: ogni tabella diventa una sequenza di parole (registro, numero di valori, valori), scritta con le macro
+ *    S5K5CAG_WRITE, S5K5CAG_RUN e S5K5CAG_DELAY; le scritture consecutive sulla porta dati 0x0F12 formano una sola
+ *    sequenza, inviata dal driver a burst;
+ *  - OV2640: le prime OV2640_PREFIX coppie, uguali in tutte le risoluzioni, sono spostate in OV2640_Common, seguita
+ *    dalla parte propria di ogni risoluzione.
+ * I commenti delle singole voci sono mantenuti. Il sorgente convertito e' scritto sullo standard output, con le stesse
+ * terminazioni di riga dell'originale; il codice che usa le tabelle e' modificato a mano.
+ *
+ * Con un secondo sorgente, il driver attuale, lo strumento verifica invece che ogni tabella convertita vi compaia
+ * identica e riporta la memoria flash occupata dalle tabelle, prima e dopo. L'esito delle sequenze sul sensore e il
+ * traffico sul bus sono verificati da s5k5cag_sim.c e ov2640_sim.c con il driver vero.
+ * @code
+ * gcc -std=gnu99 -O2 -Wall test/camtables.c -o camtables
+ * git show f487edc^:FreeRTOS/Utilities/Components/s5k5cag/s5k5cag.c > s5k5cag_orig.c
+ * git show f487edc^:FreeRTOS/Utilities/Components/ov2640/ov2640.c > ov2640_orig.c
+ * ./camtables s5k5cag s5k5cag_orig.c > s5k5cag_conv.c
+ * ./camtables s5k5cag s5k5cag_orig.c Utilities/Components/s5k5cag/s5k5cag.c
+ * ./camtables ov2640 ov2640_orig.c Utilities/Components/ov2640/ov2640.c
+ * @endcode
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+#define MAX_LINES			8192		//!< righe di un sorgente
+#define OV2640_PREFIX		208			//!< coppie comuni alle tabelle dell'OV2640
+#define S5K5CAG_REG_DATA	0x0F12		//!< porta dati dell'accesso indiretto
+#define S5K5CAG_REG_DELAY	0xFFFF		//!< registro che indica un ritardo
+
+/**
+ * @brief Righe di un sorgente, senza terminazione.
+ */
+typedef struct {
+	char* line[MAX_LINES];		//!< righe
+	int count;					//!< numero di righe
+	int crlf;					//!< le righe terminano con CR LF
+} Source_t;
+
+/**
+ * @brief Una voce {registro, valore} di una tabella originale.
+ */
+typedef struct {
+	char indent[32];			//!< spazi che precedono la voce
+	char reg[16];				//!< registro, come scritto nel sorgente
+	char value[16];				//!< valore, come scritto nel sorgente
+	const char* rest;			//!< commento che segue la voce, senza spazi iniziali e finali, o ""
+} Entry_t;
+
+/**
+ * @brief Una tabella del sorgente: riga della dichiarazione e righe tra le parentesi graffe.
+ */
+typedef struct {
+	int decl;					//!< riga della dichiarazione
+	int first;					//!< prima riga del corpo
+	int end;					//!< riga di chiusura "};"
+} Table_t;
+
+static const char* s5k5cagTables[] = { "S5K5CAG_Common", "S5K5CAG_480x272", "S5K5CAG_VGA", "S5K5CAG_QVGA",
+		"S5K5CAG_QQVGA" };
+static const char* ov2640Tables[] = { "OV2640_480x272", "OV2640_VGA", "OV2640_QVGA", "OV2640_QQVGA" };
+
+static void Fail(const char* what, const char* detail) {
+	fprintf(stderr, "camtables: %s %s\n", what, detail);
+	exit(2);
+}
+
+static void Append(Source_t* s, const char* text) {
+	if (s->count == MAX_LINES)
+		Fail("troppe righe", "");
+	s->line[s->count++] = strdup(text);
+}
+
+static void Load(Source_t* s, const char* path) {
+	static char buffer[4096];
+	FILE* f = fopen(path, "rb");
+	if (!f)
+		Fail("impossibile aprire", path);
+	memset(s, 0, sizeof(Source_t));
+	while (fgets(buffer, sizeof(buffer), f)) {
+		size_t n = strlen(buffer);
+		if (n > 0 && buffer[n - 1] == '\n')
+			buffer[--n] = 0;
+		if (n > 0 && buffer[n - 1] == '\r') {
+			buffer[--n] = 0;
+			s->crlf = 1;
+		}
+		Append(s, buffer);
+	}
+	fclose(f);
+}
+
+static void Print(const Source_t* s, int from, int to) {
+	for (int i = from; i < to; i++)
+		printf("%s%s", s->line[i], s->crlf ? "\r\n" : "\n");
+}
+
+/**
+ * @brief Riconosce una voce "{0xRRRR, 0xVVVV}," seguita eventualmente da un commento.
+ */
+static int ParseEntry(const char* line, Entry_t* e) {
+	const char* p = line;
+	int n = 0;
+	while (isspace((unsigned char) *p) && n < (int) sizeof(e->indent) - 1)
+		e->indent[n++] = *p++;
+	e->indent[n] = 0;
+	if (*p++ != '{')
+		return 0;
+	for (int k = 0; k < 2; k++) {
+		char* out = k == 0 ? e->reg : e->value;
+		while (isspace((unsigned char) *p))
+			p++;
+		if (p[0] != '0' || (p[1] != 'x' && p[1] != 'X'))
+			return 0;
+		for (n = 0; isxdigit((unsigned char) p[n]) || n == 1; n++)
+			if (n < 15)
+				out[n] = p[n];
+		out[n < 15 ? n : 15] = 0;
+		p += n;
+		while (isspace((unsigned char) *p))
+			p++;
+		if (*p++ != (k == 0 ? ',' : '}'))
+			return 0;
+	}
+	while (isspace((unsigned char) *p))
+		p++;
+	if (*p == ',')
+		p++;
+	while (isspace((unsigned char) *p))
+		p++;
+	e->rest = p;
+	return 1;
+}
+
+/**
+ * @brief Cerca la dichiarazione "NOME[][2]=" seguita da "{" e la riga "};" che chiude la tabella.
+ */
+static Table_t FindTable(const Source_t* s, const char* name) {
+	char pattern[64];
+	Table_t t = { -1, -1, -1 };
+	snprintf(pattern, sizeof(pattern), " %s[][2]", name);
+	for (int i = 0; i + 1 < s->count; i++)
+		if (strncmp(s->line[i], "const ", 6) == 0 && strstr(s->line[i], pattern) && strcmp(s->line[i + 1], "{") == 0) {
+			t.decl = i;
+			t.first = i + 2;
+			for (int j = t.first; j < s->count; j++)
+				if (strcmp(s->line[j], "};") == 0) {
+					t.end = j;
+					return t;
+				}
+		}
+	Fail("tabella non trovata:", name);
+	return t;
+}
+
+static unsigned Hex(const char* text) {
+	return (unsigned) strtoul(text, NULL, 16);
+}
+
+/**
+ * @brief Commento di una voce, preceduto da uno spazio, o stringa vuota.
+ */
+static const char* Rest(const Entry_t* e, char* buffer, size_t size) {
+	size_t n = strlen(e->rest);
+	while (n > 0 && isspace((unsigned char) e->rest[n - 1]))
+		n--;
+	if (n == 0)
+		return "";
+	snprintf(buffer, size, " %.*s", (int) n, e->rest);
+	return buffer;
+}
+
+/**
+ * @brief Converte una tabella dell'S5K5CAG, accodando le righe convertite a out.
+ * @return parole della tabella convertita
+ */
+static unsigned ConvertS5k5cag(const Source_t* s, Table_t t, Source_t* out, unsigned* entries) {
+	static char text[8192], buffer[4096];
+	const char* rest;
+	unsigned words = 0;
+	int inRun = 0;
+	char decl[256];
+	Entry_t e, next;
+
+	// la dichiarazione perde la seconda dimensione
+	const char* dim = strstr(s->line[t.decl], "[][2]");
+	snprintf(decl, sizeof(decl), "%.*s[]%s", (int) (dim - s->line[t.decl]), s->line[t.decl], dim + 5);
+	Append(out, decl);
+	Append(out, "{");
+	*entries = 0;
+	for (int i = t.first; i < t.end; i++) {
+		if (!ParseEntry(s->line[i], &e)) {
+			Append(out, s->line[i]);
+			continue;
+		}
+		(*entries)++;
+		rest = Rest(&e, buffer, sizeof(buffer));
+		if (Hex(e.reg) == S5K5CAG_REG_DELAY) {
+			snprintf(text, sizeof(text), "%sS5K5CAG_DELAY(%s),%s", e.indent, e.value, rest);
+			words += 2;
+		}
+		else if (inRun > 0) {
+			snprintf(text, sizeof(text), "%s  %s,%s", e.indent, e.value, rest);
+			inRun--;
+			words++;
+		}
+		else {
+			// lunghezza della sequenza di scritture sulla porta dati, anche attraverso righe di commento
+			int run = 1;
+			if (Hex(e.reg) == S5K5CAG_REG_DATA)
+				for (int j = i + 1; j < t.end; j++)
+					if (ParseEntry(s->line[j], &next)) {
+						if (Hex(next.reg) != S5K5CAG_REG_DATA)
+							break;
+						run++;
+					}
+			if (run > 1) {
+				snprintf(text, sizeof(text), "%sS5K5CAG_RUN(%s, %d),", e.indent, e.reg, run);
+				Append(out, text);
+				snprintf(text, sizeof(text), "%s  %s,%s", e.indent, e.value, rest);
+				inRun = run - 1;
+				words += 3;
+			}
+			else {
+				snprintf(text, sizeof(text), "%sS5K5CAG_WRITE(%s, %s),%s", e.indent, e.reg, e.value, rest);
+				words += 3;
+			}
+		}
+		Append(out, text);
+	}
+	Append(out, "};");
+	return words;
+}
+
+/**
+ * @brief Indice della riga che segue le prime count voci del corpo di una tabella.
+ */
+static int AfterEntries(const Source_t* s, Table_t t, int count) {
+	Entry_t e;
+	for (int i = t.first; i < t.end; i++)
+		if (ParseEntry(s->line[i], &e) && count-- == 0)
+			return i;
+	Fail("tabella troppo corta", "");
+	return -1;
+}
+
+/**
+ * @brief Converte le tabelle del sorgente di un sensore; restituisce la flash delle tabelle prima e dopo.
+ */
+static void ConvertFile(const Source_t* s, const char* sensor, Source_t* out, unsigned* before, unsigned* after) {
+	int n = strcmp(sensor, "s5k5cag") == 0 ? 5 : 4;
+	const char** names = n == 5 ? s5k5cagTables : ov2640Tables;
+	Table_t t[5];
+	int from = 0;
+
+	memset(out, 0, sizeof(Source_t));
+	out->crlf = s->crlf;
+	*before = *after = 0;
+	for (int k = 0; k < n; k++)
+		t[k] = FindTable(s, names[k]);
+
+	if (n == 5) {
+		for (int k = 0; k < n; k++) {
+			unsigned entries;
+			while (from < t[k].decl)
+				Append(out, s->line[from++]);
+			*after += 2 * ConvertS5k5cag(s, t[k], out, &entries);
+			*before += 4 * entries;
+			from = t[k].end + 1;
+		}
+	}
+	else {
+		// le prime OV2640_PREFIX voci devono essere uguali in tutte le tabelle
+		Entry_t a, b;
+		int common = AfterEntries(s, t[0], OV2640_PREFIX);
+		for (int k = 0; k < n; k++) {
+			int i = t[0].first, j = t[k].first, count = 0;
+			while (count < OV2640_PREFIX) {
+				while (!ParseEntry(s->line[i], &a))
+					i++;
+				while (!ParseEntry(s->line[j], &b))
+					j++;
+				if (Hex(a.reg) != Hex(b.reg) || Hex(a.value) != Hex(b.value))
+					Fail("prefisso diverso in", names[k]);
+				i++, j++, count++;
+			}
+		}
+		// OV2640_Common prima del commento che precede la prima tabella
+		int comment = t[0].decl;
+		while (comment > 0 && strncmp(s->line[comment], "/* Initialization sequence for", 30) != 0)
+			comment--;
+		while (from < comment)
+			Append(out, s->line[from++]);
+		Append(out, "/* Initialization sequence common to all resolutions, followed by the");
+		Append(out, "   resolution specific sequence */");
+		Append(out, "const unsigned char OV2640_Common[][2]=");
+		Append(out, "{");
+		for (int i = t[0].first; i < common; i++)
+			Append(out, s->line[i]);
+		Append(out, "};");
+		Append(out, "");
+		*after += 2 * OV2640_PREFIX;
+		for (int k = 0; k < n; k++) {
+			char decl[256];
+			const char* p = s->line[t[k].decl];
+			int tail = AfterEntries(s, t[k], OV2640_PREFIX), entries = 0;
+			while (from < t[k].decl)
+				Append(out, s->line[from++]);
+			// tutte le tabelle diventano unsigned char, come gia' le altre
+			if (strncmp(p, "const char ", 11) == 0)
+				snprintf(decl, sizeof(decl), "const unsigned char %s", p + 11);
+			else
+				snprintf(decl, sizeof(decl), "%s", p);
+			Append(out, decl);
+			Append(out, "{");
+			for (int i = tail; i < t[k].end; i++) {
+				Append(out, s->line[i]);
+				entries += ParseEntry(s->line[i], &a);
+			}
+			Append(out, "};");
+			for (int i = t[k].first; i < t[k].end; i++)
+				*before += 2 * ParseEntry(s->line[i], &a);
+			*after += 2 * entries;
+			from = t[k].end + 1;
+		}
+	}
+	while (from < s->count)
+		Append(out, s->line[from++]);
+}
+
+/**
+ * @brief Verifica che ogni tabella del sorgente convertito compaia identica nel driver.
+ */
+static int Compare(const Source_t* conv, const Source_t* current) {
+	int tables = 0, errors = 0;
+	for (int i = 0; i + 1 < conv->count; i++) {
+		if (strncmp(conv->line[i], "const ", 6) != 0 || strcmp(conv->line[i + 1], "{") != 0)
+			continue;
+		int end = i + 2;
+		while (end < conv->count && strcmp(conv->line[end], "};") != 0)
+			end++;
+		int found = 0;
+		for (int j = 0; j + (end - i) < current->count && !found; j++) {
+			int k = 0;
+			while (i + k <= end && strcmp(conv->line[i + k], current->line[j + k]) == 0)
+				k++;
+			found = i + k > end;
+		}
+		printf("%-40s %s\n", conv->line[i], found ? "identica" : "DIVERSA");
+		tables++;
+		errors += !found;
+		i = end;
+	}
+	return tables > 0 && errors == 0;
+}
+
+int main(int argc, char** argv) {
+	static Source_t original, converted, current;
+	unsigned before, after;
+
+	if (argc < 3 || (strcmp(argv[1], "s5k5cag") != 0 && strcmp(argv[1], "ov2640") != 0)) {
+		fprintf(stderr, "uso: %s s5k5cag|ov2640 originale.c [driver.c]\n", argv[0]);
+		return 2;
+	}
+	Load(&original, argv[2]);
+	ConvertFile(&original, argv[1], &converted, &before, &after);
+	if (argc == 3) {
+		Print(&converted, 0, converted.count);
+		return 0;
+	}
+	Load(&current, argv[3]);
+	int ok = Compare(&converted, &current);
+	printf("%s: tabelle %u -> %u byte di flash (-%.0f%%)\n", argv[1], before, after, 100.0 * (before - after) / before);
+	printf("camtables: %s\n", ok ? "OK" : "FAILED");
+	return !ok;
+}
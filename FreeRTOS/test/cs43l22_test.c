@@ -0,0 +1,308 @@
+/**
+ * @file cs43l22_test.c
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+/**
+ * @brief Verifica su host del traffico I2C del driver del CS43L22, rispetto al driver originale della BSP.
+ *
+ * @details
+ * Le funzioni AUDIO_IO_* sono sostituite da un modello del CS43L22 che ne riproduce i registri, il reset eseguito da
+ * AUDIO_IO_Init() e l'incremento automatico dell'indirizzo con il bit MAP_INCR, e che conta le transazioni e i byte
+ * trasferiti (indirizzo del dispositivo, del registro e dati). Il driver originale (una scrittura singola per ogni
+ * registro, senza letture) e' riprodotto nel test, con le stesse sequenze, su un secondo modello.
+ *
+ * Entrambi i driver eseguono la stessa sessione, a fasi: Init con uscita automatica, Play, un cambio di volume, lo
+ * stesso volume ripetuto, una rampa di 101 passi da 0 a 100, mute e unmute, Pause e Resume, cambio dell'uscita, Stop,
+ * e un secondo Init dopo lo Stop. Dopo ogni fase i registri dei due modelli devono coincidere, e il driver con la
+ * copia dei registri non deve usare piu' transazioni ne' piu' byte dell'originale. Per ogni fase e' riportato il
+ * traffico, prima e dopo, e il totale della sessione.
+ * @code
+ * gcc -std=gnu99 -O2 -Wall test/cs43l22_test.c Utilities/Components/cs43l22/cs43l22.c \
+ *   Utilities/Components/Common/regcache.c -o cs43l22_test && ./cs43l22_test
+ * @endcode
+ */
+#include "../Utilities/Components/cs43l22/cs43l22.h"
+#include <stdio.h>
+#include <string.h>
+
+#define CODEC_ADDRESS		0x94		//!< indirizzo del CS43L22 sulla Discovery
+
+static int failures = 0;
+
+#define CHECK(cond) do { if (!(cond)) { printf("%s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+/**
+ * @brief Modello del CS43L22 visto dal bus I2C.
+ */
+typedef struct {
+	uint8_t reg[256];			//!< register file
+	unsigned transactions;		//!< transazioni I2C
+	unsigned bytes;				//!< byte trasferiti
+} Codec_t;
+
+static Codec_t newDev, oldDev;
+
+/**
+ * @brief Reset del codec tramite il pin di reset, come in AUDIO_IO_Init().
+ */
+static void CodecReset(Codec_t* d) {
+	memset(d->reg, 0, sizeof(d->reg));
+	d->reg[CS43L22_CHIPID_ADDR] = CS43L22_ID;
+}
+
+/**
+ * @brief Una scrittura: indirizzo del dispositivo e del registro, poi i dati, con l'incremento automatico se richiesto.
+ */
+static void CodecWrite(Codec_t* d, uint8_t reg, const uint8_t* data, uint16_t len) {
+	d->transactions++;
+	d->bytes += 2 + len;
+	for (uint16_t i = 0; i < len; i++)
+		d->reg[((reg & CS43L22_MAP_INCR) ? (reg & ~CS43L22_MAP_INCR) + i : reg) & 0xFF] = data[i];
+}
+
+/*
+ * Interfaccia verso la BSP, usata dal driver con la copia dei registri.
+ */
+void AUDIO_IO_Init(void) {
+	CodecReset(&newDev);
+}
+
+void AUDIO_IO_DeInit(void) {
+}
+
+uint8_t AUDIO_IO_Write(uint8_t Addr, uint8_t Reg, uint8_t Value) {
+	(void) Addr;
+	CodecWrite(&newDev, Reg, &Value, 1);
+	return 0;
+}
+
+uint8_t AUDIO_IO_WriteMultiple(uint8_t Addr, uint8_t Reg, uint8_t *pBuffer, uint16_t Length) {
+	(void) Addr;
+	CodecWrite(&newDev, Reg, pBuffer, Length);
+	return 0;
+}
+
+uint8_t AUDIO_IO_Read(uint8_t Addr, uint8_t Reg) {
+	(void) Addr;
+	newDev.transactions++;
+	newDev.bytes += 4;
+	return newDev.reg[Reg & ~CS43L22_MAP_INCR];
+}
+
+/*
+ * Driver originale della BSP: ogni registro e' una transazione a se'.
+ */
+static uint8_t oldOutputDev = 0;
+static uint8_t oldStopped = 1;
+
+static void OldWrite(uint8_t reg, uint8_t value) {
+	CodecWrite(&oldDev, reg, &value, 1);
+}
+
+static void OldSetVolume(uint8_t volume) {
+	uint8_t converted = volume > 100 ? 100 : (uint8_t) ((volume * 255) / 100);
+	uint8_t value = volume > 0xE6 ? converted - 0xE7 : converted + 0x19;
+	OldWrite(CS43L22_REG_MASTER_A_VOL, value);
+	OldWrite(CS43L22_REG_MASTER_B_VOL, value);
+}
+
+static void OldSetMute(uint32_t cmd) {
+	if (cmd == AUDIO_MUTE_ON) {
+		OldWrite(CS43L22_REG_POWER_CTL2, 0xFF);
+		OldWrite(CS43L22_REG_HEADPHONE_A_VOL, 0x01);
+		OldWrite(CS43L22_REG_HEADPHONE_B_VOL, 0x01);
+	}
+	else {
+		OldWrite(CS43L22_REG_HEADPHONE_A_VOL, 0x00);
+		OldWrite(CS43L22_REG_HEADPHONE_B_VOL, 0x00);
+		OldWrite(CS43L22_REG_POWER_CTL2, oldOutputDev);
+	}
+}
+
+static void OldInit(uint16_t output, uint8_t volume) {
+	CodecReset(&oldDev);
+	OldWrite(CS43L22_REG_POWER_CTL1, 0x01);
+	oldOutputDev = output == OUTPUT_DEVICE_SPEAKER ? 0xFA : output == OUTPUT_DEVICE_HEADPHONE ? 0xAF
+			: output == OUTPUT_DEVICE_BOTH ? 0xAA : 0x05;
+	OldWrite(CS43L22_REG_POWER_CTL2, oldOutputDev);
+	OldWrite(CS43L22_REG_CLOCKING_CTL, 0x81);
+	OldWrite(CS43L22_REG_INTERFACE_CTL1, CODEC_STANDARD);
+	OldSetVolume(volume);
+	if (output != OUTPUT_DEVICE_HEADPHONE) {
+		OldWrite(CS43L22_REG_PLAYBACK_CTL2, 0x06);
+		OldWrite(CS43L22_REG_SPEAKER_A_VOL, 0x00);
+		OldWrite(CS43L22_REG_SPEAKER_B_VOL, 0x00);
+	}
+	OldWrite(CS43L22_REG_ANALOG_ZC_SR_SETT, 0x00);
+	OldWrite(CS43L22_REG_MISC_CTL, 0x04);
+	OldWrite(CS43L22_REG_LIMIT_CTL1, 0x00);
+	OldWrite(CS43L22_REG_TONE_CTL, 0x0F);
+	OldWrite(CS43L22_REG_PCMA_VOL, 0x0A);
+	OldWrite(CS43L22_REG_PCMB_VOL, 0x0A);
+}
+
+static void OldPlay(void) {
+	if (oldStopped) {
+		OldWrite(CS43L22_REG_MISC_CTL, 0x06);
+		OldSetMute(AUDIO_MUTE_OFF);
+		OldWrite(CS43L22_REG_POWER_CTL1, 0x9E);
+		oldStopped = 0;
+	}
+}
+
+static void OldPause(void) {
+	OldSetMute(AUDIO_MUTE_ON);
+	OldWrite(CS43L22_REG_POWER_CTL1, 0x01);
+}
+
+static void OldResume(void) {
+	OldSetMute(AUDIO_MUTE_OFF);
+	OldWrite(CS43L22_REG_POWER_CTL2, oldOutputDev);
+	OldWrite(CS43L22_REG_POWER_CTL1, 0x9E);
+}
+
+static void OldSetOutputMode(uint8_t output) {
+	oldOutputDev = output == OUTPUT_DEVICE_SPEAKER ? 0xFA : output == OUTPUT_DEVICE_HEADPHONE ? 0xAF
+			: output == OUTPUT_DEVICE_BOTH ? 0xAA : 0x05;
+	OldWrite(CS43L22_REG_POWER_CTL2, oldOutputDev);
+}
+
+static void OldStop(void) {
+	OldSetMute(AUDIO_MUTE_ON);
+	OldWrite(CS43L22_REG_MISC_CTL, 0x04);
+	OldWrite(CS43L22_REG_POWER_CTL1, 0x9F);
+	oldStopped = 1;
+}
+
+/**
+ * @brief Fasi della sessione, eseguite da entrambi i driver.
+ */
+typedef enum {
+	PHASE_INIT, PHASE_PLAY, PHASE_VOLUME, PHASE_SAME_VOLUME, PHASE_RAMP, PHASE_MUTE, PHASE_PAUSE_RESUME, PHASE_OUTPUT,
+	PHASE_STOP, PHASE_REINIT, PHASES
+} Phase_t;
+
+static const char* phaseName[PHASES] = {
+	"Init", "Play", "SetVolume", "SetVolume, stesso", "rampa, 101 passi", "mute / unmute", "Pause / Resume",
+	"uscita HP / auto", "Stop", "Init dopo Stop"
+};
+
+static void RunNew(Phase_t phase) {
+	switch (phase) {
+	case PHASE_INIT:
+	case PHASE_REINIT:
+		cs43l22_Init(CODEC_ADDRESS, OUTPUT_DEVICE_AUTO, 70, 48000);
+		break;
+	case PHASE_PLAY:
+		cs43l22_Play(CODEC_ADDRESS, NULL, 0);
+		break;
+	case PHASE_VOLUME:
+	case PHASE_SAME_VOLUME:
+		cs43l22_SetVolume(CODEC_ADDRESS, 50);
+		break;
+	case PHASE_RAMP:
+		for (int volume = 0; volume <= 100; volume++)
+			cs43l22_SetVolume(CODEC_ADDRESS, volume);
+		break;
+	case PHASE_MUTE:
+		cs43l22_SetMute(CODEC_ADDRESS, AUDIO_MUTE_ON);
+		cs43l22_SetMute(CODEC_ADDRESS, AUDIO_MUTE_OFF);
+		break;
+	case PHASE_PAUSE_RESUME:
+		cs43l22_Pause(CODEC_ADDRESS);
+		cs43l22_Resume(CODEC_ADDRESS);
+		break;
+	case PHASE_OUTPUT:
+		cs43l22_SetOutputMode(CODEC_ADDRESS, OUTPUT_DEVICE_HEADPHONE);
+		cs43l22_SetOutputMode(CODEC_ADDRESS, OUTPUT_DEVICE_AUTO);
+		break;
+	case PHASE_STOP:
+		cs43l22_Stop(CODEC_ADDRESS, CODEC_PDWN_SW);
+		break;
+	default:
+		break;
+	}
+}
+
+static void RunOld(Phase_t phase) {
+	switch (phase) {
+	case PHASE_INIT:
+	case PHASE_REINIT:
+		OldInit(OUTPUT_DEVICE_AUTO, 70);
+		break;
+	case PHASE_PLAY:
+		OldPlay();
+		break;
+	case PHASE_VOLUME:
+	case PHASE_SAME_VOLUME:
+		OldSetVolume(50);
+		break;
+	case PHASE_RAMP:
+		for (int volume = 0; volume <= 100; volume++)
+			OldSetVolume(volume);
+		break;
+	case PHASE_MUTE:
+		OldSetMute(AUDIO_MUTE_ON);
+		OldSetMute(AUDIO_MUTE_OFF);
+		break;
+	case PHASE_PAUSE_RESUME:
+		OldPause();
+		OldResume();
+		break;
+	case PHASE_OUTPUT:
+		OldSetOutputMode(OUTPUT_DEVICE_HEADPHONE);
+		OldSetOutputMode(OUTPUT_DEVICE_AUTO);
+		break;
+	case PHASE_STOP:
+		OldStop();
+		break;
+	default:
+		break;
+	}
+}
+
+int main(void) {
+	unsigned oldTx = 0, oldBytes = 0, newTx = 0, newBytes = 0;
+
+	CodecReset(&newDev);
+	CodecReset(&oldDev);
+	printf("%-20s %13s %16s\n", "fase", "transazioni", "byte");
+	for (Phase_t phase = PHASE_INIT; phase < PHASES; phase++) {
+		unsigned ot = oldDev.transactions, ob = oldDev.bytes, nt = newDev.transactions, nb = newDev.bytes;
+		RunOld(phase);
+		RunNew(phase);
+		ot = oldDev.transactions - ot;
+		ob = oldDev.bytes - ob;
+		nt = newDev.transactions - nt;
+		nb = newDev.bytes - nb;
+		printf("%-20s %5u -> %5u %6u -> %6u\n", phaseName[phase], ot, nt, ob, nb);
+		if (memcmp(oldDev.reg, newDev.reg, sizeof(oldDev.reg)) != 0)
+			printf("%s: registri diversi\n", phaseName[phase]);
+		CHECK(memcmp(oldDev.reg, newDev.reg, sizeof(oldDev.reg)) == 0);
+		CHECK(nt <= ot);
+		CHECK(nb <= ob);
+		oldTx += ot;
+		oldBytes += ob;
+		newTx += nt;
+		newBytes += nb;
+	}
+	printf("%-20s %5u -> %5u %6u -> %6u\n", "sessione", oldTx, newTx, oldBytes, newBytes);
+	CHECK(newTx < oldTx && newBytes < oldBytes);
+
+	printf("cs43l22_test: %s\n", failures == 0 ? "OK" : "FAILED");
+	return failures != 0;
+}
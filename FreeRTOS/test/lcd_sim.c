@@ -0,0 +1,277 @@
+/**
+ * @file lcd_sim.c
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+/**
+ * @brief Simulazione su host dei driver ST7789H2 e ST7735, con le operazioni a blocchi.
+ *
+ * @details
+ * Le funzioni LCD_IO_* sono sostituite da un modello del controllore: i comandi CASET (0x2A) e RASET (0x2B) impostano
+ * la finestra di indirizzamento, RAMWR (0x2C) la apre e i dati successivi riempiono la GRAM riga per riga, tornando
+ * all'inizio della finestra quando la superano. Il modello conta le chiamate all'IO e le parole o i byte trasferiti.
+ *
+ * Lo stesso carico (riempimenti, linee orizzontali e verticali, copie di blocchi di pixel, singoli pixel) è eseguito
+ * con le operazioni a blocchi quando il driver le fornisce, altrimenti con le primitive per pixel e per linea come
+ * prima. Sono verificati:
+ *  - il contenuto finale della GRAM, confrontato con l'impronta FNV-1a ottenuta dai driver originali;
+ *  - che le chiamate all'IO non aumentino rispetto ai driver originali.
+ * Con -DSIM_ST7789H2 è simulato l'ST7789H2 (240x240, bus a 16 bit), altrimenti l'ST7735 (128x160, bus a 8 bit). Per
+ * l'ST7789H2 è misurata a parte anche DrawRGBImage. Le origini X restano tra 0 e 16, perché il SetCursor originale
+ * dell'ST7789H2 tronca a 8 bit la fine della colonna oltre questo valore.
+ *
+ * I valori dei driver originali si riottengono compilando lo stesso simulatore con i sorgenti precedenti le operazioni
+ * a blocchi (git show 87f7c55^:FreeRTOS/Utilities/Components/st7789h2/st7789h2.c e analoghi).
+ * @code
+ * gcc -std=gnu99 -O2 -Wall -DSIM_ST7789H2 -IUtilities/Components/st7789h2 test/lcd_sim.c \
+ *   Utilities/Components/st7789h2/st7789h2.c Utilities/Components/Common/pixel.c -o lcd_sim && ./lcd_sim
+ * gcc -std=gnu99 -O2 -Wall -IUtilities/Components/st7735 test/lcd_sim.c \
+ *   Utilities/Components/st7735/st7735.c Utilities/Components/Common/pixel.c -o lcd_sim && ./lcd_sim
+ * @endcode
+ */
+#include <stdio.h>
+#include <string.h>
+
+#ifdef SIM_ST7789H2
+#include "st7789h2.h"
+#define LCD_WIDTH			240
+#define LCD_HEIGHT			240
+#define LCD_DRV				ST7789H2_drv
+#define LCD_NAME			"ST7789H2"
+#else
+#include "st7735.h"
+#define LCD_WIDTH			128
+#define LCD_HEIGHT			160
+#define LCD_DRV				st7735_drv
+#define LCD_NAME			"ST7735"
+#endif
+
+#define GRAM_SIZE			512			//!< lato della GRAM simulata, oltre il pannello
+#define IMAGE_PITCH			64			//!< pixel per riga dell'immagine sorgente
+#define ROUNDS				20			//!< ripetizioni del carico
+
+static int failures = 0;
+
+#define CHECK(cond) do { if (!(cond)) { printf("%s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+/**
+ * @brief Modello del controllore visto dal bus.
+ */
+typedef struct {
+	uint16_t gram[GRAM_SIZE][GRAM_SIZE];	//!< memoria dei pixel
+	uint8_t command;			//!< ultimo comando
+	uint8_t param[4];			//!< parametri di CASET e RASET
+	unsigned params;			//!< parametri ricevuti
+	unsigned xs, xe, ys, ye;	//!< finestra di indirizzamento
+	unsigned x, y;				//!< prossimo pixel
+	uint8_t high;				//!< byte alto di un pixel sul bus a 8 bit
+	uint8_t half;				//!< byte alto ricevuto
+	unsigned calls;				//!< chiamate all'IO
+	unsigned words;				//!< parole (ST7789H2) o byte (ST7735) trasferiti
+} Controller_t;
+
+static Controller_t lcd;
+
+/**
+ * @brief Valori dei driver originali.
+ */
+typedef struct {
+	uint32_t image;				//!< impronta della GRAM dopo il carico
+	unsigned calls;				//!< chiamate all'IO per il carico
+	unsigned words;				//!< dati trasferiti per il carico
+#ifdef SIM_ST7789H2
+	uint32_t rgbImage;			//!< impronta della GRAM dopo DrawRGBImage
+	unsigned rgbCalls;			//!< chiamate all'IO per DrawRGBImage
+	unsigned rgbWords;			//!< parole trasferite per DrawRGBImage
+#endif
+} Reference_t;
+
+#ifdef SIM_ST7789H2
+static const Reference_t reference = { 0x64056e3c, 771261, 627291, 0xc28c749c, 56720, 54320 };
+#else
+static const Reference_t reference = { 0xd912cb8b, 411370, 414062 };
+#endif
+
+static uint16_t source[IMAGE_PITCH * 80];
+
+static void Pixel(uint16_t value) {
+	if (lcd.x < GRAM_SIZE && lcd.y < GRAM_SIZE)
+		lcd.gram[lcd.y][lcd.x] = value;
+	if (++lcd.x > lcd.xe) {
+		lcd.x = lcd.xs;
+		if (++lcd.y > lcd.ye)
+			lcd.y = lcd.ys;
+	}
+}
+
+/* Parametro di un comando o metà di un pixel */
+static void Byte(uint8_t value) {
+	if (lcd.command == 0x2A || lcd.command == 0x2B) {
+		unsigned* start = lcd.command == 0x2A ? &lcd.xs : &lcd.ys;
+		unsigned* end = lcd.command == 0x2A ? &lcd.xe : &lcd.ye;
+		if (lcd.params < 4)
+			lcd.param[lcd.params++] = value;
+		if (lcd.params == 2)
+			*start = lcd.param[0] << 8 | lcd.param[1];
+		if (lcd.params == 4)
+			*end = lcd.param[2] << 8 | lcd.param[3];
+	}
+	else if (lcd.command == 0x2C) {
+		if (!lcd.half)
+			lcd.high = value;
+		else
+			Pixel(lcd.high << 8 | value);
+		lcd.half = !lcd.half;
+	}
+}
+
+/*
+ * Interfaccia verso la BSP.
+ */
+void LCD_IO_Init(void) {
+}
+
+void LCD_IO_WriteReg(uint8_t Reg) {
+	lcd.calls++;
+	lcd.command = Reg;
+	lcd.params = 0;
+	lcd.half = 0;
+	if (Reg == 0x2C) {
+		lcd.x = lcd.xs;
+		lcd.y = lcd.ys;
+	}
+}
+
+#ifdef SIM_ST7789H2
+void LCD_IO_WriteData(uint16_t RegValue) {
+	lcd.calls++;
+	lcd.words++;
+	if (lcd.command == 0x2C)
+		Pixel(RegValue);
+	else
+		Byte(RegValue & 0xFF);
+}
+
+void LCD_IO_WriteMultipleData(uint16_t *pData, uint32_t Size) {
+	lcd.calls++;
+	lcd.words += Size;
+	for (uint32_t i = 0; i < Size; i++) {
+		if (lcd.command == 0x2C)
+			Pixel(pData[i]);
+		else
+			Byte(pData[i] & 0xFF);
+	}
+}
+
+uint16_t LCD_IO_ReadData(void) {
+	lcd.calls++;
+	return 0;
+}
+
+void LCD_IO_Delay(uint32_t delay) {
+	(void) delay;
+}
+#else
+/* I pixel arrivano in memoria little endian: il byte alto è il secondo */
+void LCD_IO_WriteMultipleData(uint8_t *pData, uint32_t Size) {
+	lcd.calls++;
+	lcd.words += Size;
+	if (Size == 1)
+		Byte(pData[0]);
+	else
+		for (uint32_t i = 0; i + 1 < Size; i += 2) {
+			Byte(pData[i + 1]);
+			Byte(pData[i]);
+		}
+}
+#endif
+
+void LCD_Delay(uint32_t delay) {
+	(void) delay;
+}
+
+static void Fill(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint16_t color) {
+	if (LCD_DRV.FillRect)
+		LCD_DRV.FillRect(x, y, width, height, color);
+	else
+		for (uint16_t j = 0; j < height; j++)
+			LCD_DRV.DrawHLine(color, x, y + j, width);
+}
+
+static void Blit(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint16_t* data, uint16_t pitch) {
+	if (LCD_DRV.BlitRect)
+		LCD_DRV.BlitRect(x, y, width, height, data, pitch);
+	else
+		for (uint16_t j = 0; j < height; j++)
+			for (uint16_t i = 0; i < width; i++)
+				LCD_DRV.WritePixel(x + i, y + j, data[j * pitch + i]);
+}
+
+static uint32_t Fingerprint(void) {
+	uint32_t h = 2166136261u;
+	for (int y = 0; y < LCD_HEIGHT; y++)
+		for (int x = 0; x < LCD_WIDTH; x++) {
+			h = (h ^ (lcd.gram[y][x] & 0xFF)) * 16777619u;
+			h = (h ^ (lcd.gram[y][x] >> 8)) * 16777619u;
+		}
+	return h;
+}
+
+int main(void) {
+	for (unsigned i = 0; i < sizeof(source) / sizeof(source[0]); i++)
+		source[i] = (uint16_t) (i * 2654435761u >> 7);
+	lcd.xe = LCD_WIDTH - 1;
+	lcd.ye = LCD_HEIGHT - 1;
+
+	LCD_DRV.Init();
+	unsigned calls = lcd.calls, words = lcd.words;
+	for (int k = 0; k < ROUNDS; k++) {
+		int x = k % 17;
+		Fill(x, k * 5, LCD_WIDTH / 2, LCD_HEIGHT / 3, 0x1234 * k);
+		LCD_DRV.DrawHLine(0xF800, x, k * 7, LCD_WIDTH - x - 1);
+		LCD_DRV.DrawVLine(0x07E0, k * 5, k, LCD_HEIGHT - k - 1);
+		Blit(x, k * 3, 40 + k, 30, source, IMAGE_PITCH);
+		Blit(16, LCD_HEIGHT - 20, 30, 20, source, 30);
+		LCD_DRV.WritePixel(k, k, 0xFFFF);
+		LCD_DRV.WritePixel(LCD_WIDTH - 1 - k, k + 1, 0x001F);
+		LCD_DRV.DrawHLine(0xABCD, 3, LCD_HEIGHT - 1 - k, 20);
+	}
+	calls = lcd.calls - calls;
+	words = lcd.words - words;
+	uint32_t image = Fingerprint();
+	printf("%s: immagine %08x, %6u -> %4u chiamate IO, %6u -> %6u dati\n", LCD_NAME, image, reference.calls, calls,
+			reference.words, words);
+	CHECK(image == reference.image);
+	CHECK(calls <= reference.calls);
+
+#ifdef SIM_ST7789H2
+	ST7789H2_SetDisplayWindow(10, 10, 100, 100);
+	calls = lcd.calls;
+	words = lcd.words;
+	for (int k = 0; k < ROUNDS; k++)
+		ST7789H2_DrawRGBImage(k % 17, 20 + k, 64, 40, (uint8_t*) source);
+	calls = lcd.calls - calls;
+	words = lcd.words - words;
+	image = Fingerprint();
+	printf("%s: DrawRGBImage, immagine %08x, %6u -> %4u chiamate IO, %6u -> %6u dati\n", LCD_NAME, image,
+			reference.rgbCalls, calls, reference.rgbWords, words);
+	CHECK(image == reference.rgbImage);
+	CHECK(calls <= reference.rgbCalls);
+#endif
+
+	printf("lcd_sim: %s\n", failures == 0 ? "OK" : "FAILED");
+	return failures != 0;
+}
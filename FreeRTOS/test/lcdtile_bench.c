@@ -0,0 +1,258 @@
+/**
+ * @file lcdtile_bench.c
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+/**
+ * @brief Benchmark su host del compositore a tile (lcdtile) con il driver ST7789H2.
+ *
+ * @details
+ * Le funzioni LCD_IO_* sono sostituite da un modello della GRAM del pannello 240x240: CASET (0x2A) e RASET (0x2B)
+ * impostano la finestra di indirizzamento, RAMWR (0x2C) la apre e le parole successive la riempiono riga per riga. Il
+ * modello conta i byte trasferiti sul bus a 16 bit, comandi compresi.
+ *
+ * Ogni script ridisegna un elemento tipico di un'interfaccia per 300 frame: la cifra dei secondi di un orologio, una
+ * barra di avanzamento, un pulsante che cambia stato, il cursore di un campo di testo, uno sprite in movimento fuso con
+ * lo sfondo e lo scorrimento di una lista. Un ultimo script disegna a ogni frame rettangoli pseudo-casuali, anche a
+ * cavallo dei bordi del display. Ogni script è eseguito due volte: inviando solo i tile modificati e ridisegnando ogni
+ * volta l'intero display. Sono verificati:
+ *  - che dopo ogni LCDTILE_Flush() la GRAM del pannello coincida con il back buffer;
+ *  - che i tile modificati non costino mai più del ridisegno completo.
+ * Sono riportati i byte per frame sul bus e i frame al secondo che il bus consentirebbe con l'FSMC a 16 bit (circa
+ * 100 ns per scrittura), oltre al tempo di composizione e flush sull'host. La dimensione dei tile si cambia con
+ * -DLCDTILE_SHIFT, per esempio 3 (8 pixel, con -DLCDTILE_MAX_TILES=900) o 5 (32 pixel, che a 240 pixel lascia tile
+ * parziali sui bordi).
+ * @code
+ * gcc -std=gnu99 -O2 -Wall -IUtilities/Components/st7789h2 -IUtilities/Components/Common test/lcdtile_bench.c \
+ *   Utilities/Components/Common/lcdtile.c Utilities/Components/Common/pixel.c \
+ *   Utilities/Components/st7789h2/st7789h2.c -o lcdtile_bench && ./lcdtile_bench
+ * @endcode
+ */
+#include "st7789h2.h"
+#include "lcdtile.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#define LCD_WIDTH			240
+#define LCD_HEIGHT			240
+#define BUS_BYTES_PER_S		20000000.0	//!< FSMC a 16 bit, circa 100 ns per scrittura
+#define FRAMES				300			//!< frame per script
+#define HOST_FRAMES			20000		//!< frame per la misura del tempo sull'host
+
+static int failures = 0;
+
+#define CHECK(cond) do { if (!(cond)) { printf("%s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+/**
+ * @brief Modello della GRAM del pannello visto dal bus.
+ */
+typedef struct {
+	uint16_t gram[LCD_HEIGHT][LCD_WIDTH];	//!< memoria dei pixel
+	uint8_t command;			//!< ultimo comando
+	uint8_t param[4];			//!< parametri di CASET e RASET
+	unsigned params;			//!< parametri ricevuti
+	unsigned xs, xe, ys, ye;	//!< finestra di indirizzamento
+	unsigned x, y;				//!< prossimo pixel
+	unsigned long bytes;		//!< byte trasferiti
+} Panel_t;
+
+static Panel_t panel;
+
+static uint16_t back[LCD_WIDTH * LCD_HEIGHT];
+static uint16_t glyph[20 * 32];
+static uint16_t icon[32 * 32];
+static LCDTILE_t tiles;
+static uint32_t seed;
+
+static void Data(uint16_t value) {
+	if (panel.command == 0x2C) {
+		if (panel.x < LCD_WIDTH && panel.y < LCD_HEIGHT)
+			panel.gram[panel.y][panel.x] = value;
+		if (++panel.x > panel.xe) {
+			panel.x = panel.xs;
+			if (++panel.y > panel.ye)
+				panel.y = panel.ys;
+		}
+	}
+	else if (panel.command == 0x2A || panel.command == 0x2B) {
+		unsigned* start = panel.command == 0x2A ? &panel.xs : &panel.ys;
+		unsigned* end = panel.command == 0x2A ? &panel.xe : &panel.ye;
+		if (panel.params < 4)
+			panel.param[panel.params++] = value;
+		if (panel.params == 2)
+			*start = panel.param[0] << 8 | panel.param[1];
+		if (panel.params == 4)
+			*end = panel.param[2] << 8 | panel.param[3];
+	}
+}
+
+/*
+ * Interfaccia verso la BSP.
+ */
+void LCD_IO_Init(void) {
+}
+
+void LCD_IO_Delay(uint32_t delay) {
+	(void) delay;
+}
+
+void LCD_IO_WriteReg(uint8_t Reg) {
+	panel.bytes += 2;
+	panel.command = Reg;
+	panel.params = 0;
+	if (Reg == 0x2C) {
+		panel.x = panel.xs;
+		panel.y = panel.ys;
+	}
+}
+
+void LCD_IO_WriteData(uint16_t RegValue) {
+	panel.bytes += 2;
+	Data(RegValue);
+}
+
+void LCD_IO_WriteMultipleData(uint16_t *pData, uint32_t Size) {
+	panel.bytes += 2 * Size;
+	for (uint32_t i = 0; i < Size; i++)
+		Data(pData[i]);
+}
+
+uint16_t LCD_IO_ReadData(void) {
+	return 0;
+}
+
+static uint32_t Random(void) {
+	seed = seed * 1664525u + 1013904223u;
+	return seed >> 8;
+}
+
+/*
+ * Script: ognuno disegna il frame f nel back buffer.
+ */
+static void ClockDigit(int f) {
+	LCDTILE_FillRect(&tiles, 180, 20, 20, 32, 0x0000);
+	for (int i = 0; i < 20 * 32; i++)
+		glyph[i] = ((i * 7 + f * 13) % 5) ? 0 : 0xFFFF;
+	LCDTILE_BlitRect(&tiles, 180, 20, 20, 32, glyph, 20);
+}
+
+static void ProgressBar(int f) {
+	LCDTILE_FillRect(&tiles, 20, 200, 200, 12, 0x4208);
+	LCDTILE_FillRect(&tiles, 20, 200, (f * 2) % 200, 12, 0x07E0);
+}
+
+static void ButtonToggle(int f) {
+	LCDTILE_FillRect(&tiles, 90, 100, 60, 30, (f & 1) ? 0x001F : 0x7BEF);
+	LCDTILE_FillRect(&tiles, 90, 100, 60, 2, 0xFFFF);
+	LCDTILE_FillRect(&tiles, 90, 128, 60, 2, 0x0000);
+	LCDTILE_BlitRect(&tiles, 104, 107, 20, 16, glyph, 20);
+}
+
+static void TextCursor(int f) {
+	LCDTILE_FillRect(&tiles, 30, 60, 2, 16, (f & 1) ? 0xFFFF : 0x0000);
+}
+
+static void MovingSprite(int f) {
+	int x = (f * 3) % 200;
+	LCDTILE_FillRect(&tiles, x > 3 ? x - 3 : 0, 110, 40, 50, 0x0000);
+	LCDTILE_BlendRect(&tiles, x, 120 + f % 10, 32, 32, icon, 32, 160);
+}
+
+static void ListScroll(int f) {
+	for (int r = 0; r < 8; r++)
+		LCDTILE_FillRect(&tiles, 0, 40 + r * 20, LCD_WIDTH, 20, ((r + f) & 1) ? 0x2104 : 0x39E7);
+}
+
+static void RandomRects(int f) {
+	(void) f;
+	for (int n = Random() % 4; n >= 0; n--) {
+		uint16_t x = Random() % LCD_WIDTH, y = Random() % LCD_HEIGHT;
+		uint16_t w = 1 + Random() % 32, h = 1 + Random() % 32;
+		switch (Random() % 3) {
+		case 0:
+			LCDTILE_FillRect(&tiles, x, y, w, h, Random());
+			break;
+		case 1:
+			LCDTILE_BlitRect(&tiles, x, y, w, h, icon, 32);
+			break;
+		default:
+			LCDTILE_BlendRect(&tiles, x, y, w, h, icon, 32, Random());
+			break;
+		}
+	}
+}
+
+static const struct {
+	const char* name;
+	void (*draw)(int);
+} script[] = {
+	{ "clock digit", ClockDigit },
+	{ "progress bar", ProgressBar },
+	{ "button toggle", ButtonToggle },
+	{ "text cursor", TextCursor },
+	{ "moving sprite", MovingSprite },
+	{ "list scroll", ListScroll },
+	{ "random rects", RandomRects },
+};
+
+/* Esegue uno script e restituisce i byte per frame; full = 1 ridisegna ogni volta l'intero display */
+static unsigned long Replay(unsigned s, int full) {
+	seed = 12345;
+	LCDTILE_Init(&tiles, &ST7789H2_drv, back, LCD_WIDTH, LCD_HEIGHT);
+	LCDTILE_FillRect(&tiles, 0, 0, LCD_WIDTH, LCD_HEIGHT, 0x18E3);
+	LCDTILE_Flush(&tiles);
+	panel.bytes = 0;
+	for (int f = 0; f < FRAMES; f++) {
+		script[s].draw(f);
+		if (full)
+			LCDTILE_InvalidateAll(&tiles);
+		LCDTILE_Flush(&tiles);
+		if (memcmp(panel.gram, back, sizeof(back)) != 0) {
+			printf("%s: il pannello non coincide con il back buffer al frame %d\n", script[s].name, f);
+			failures++;
+			break;
+		}
+	}
+	return panel.bytes / FRAMES;
+}
+
+int main(void) {
+	for (int i = 0; i < 32 * 32; i++)
+		icon[i] = (uint16_t) (i * 2654435761u >> 9);
+	ST7789H2_Init();
+
+	printf("tile di %u pixel\n", LCDTILE_SIZE);
+	printf("%-14s %12s %12s %8s %10s %10s\n", "script", "tile B/fr", "intero B/fr", "rapporto", "tile fps",
+			"intero fps");
+	for (unsigned s = 0; s < sizeof(script) / sizeof(script[0]); s++) {
+		unsigned long dirty = Replay(s, 0);
+		unsigned long full = Replay(s, 1);
+		printf("%-14s %12lu %12lu %7.1fx %10.0f %10.0f\n", script[s].name, dirty, full, (double) full / dirty,
+				BUS_BYTES_PER_S / dirty, BUS_BYTES_PER_S / full);
+		CHECK(dirty <= full);
+	}
+
+	clock_t start = clock();
+	for (int f = 0; f < HOST_FRAMES; f++) {
+		ButtonToggle(f);
+		LCDTILE_Flush(&tiles);
+	}
+	printf("host: %.1f us per frame del pulsante\n", (double) (clock() - start) * 1e6 / CLOCKS_PER_SEC / HOST_FRAMES);
+
+	printf("lcdtile_bench: %s\n", failures == 0 ? "OK" : "FAILED");
+	return failures != 0;
+}
@@ -0,0 +1,231 @@
+/**
+ * @file lis3dsh_test.c
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+/**
+ * @brief Verifica su host della lettura dei campioni del LIS3DSH, con un register file simulato.
+ *
+ * @details
+ * Le funzioni ACCELERO_IO_* sono sostituite da un modello del bus SPI del LIS3DSH, che riproduce i byte trasmessi dalla
+ * BSP della Discovery (indirizzo con il bit di lettura, poi i dati) e il comportamento del dispositivo: registri da
+ * 7 bit e incremento automatico dell'indirizzo solo con CTRL_REG6 IF_ADD_INC impostato. Il modello conta i cicli di
+ * chip select e i byte trasferiti.
+ *
+ * Sono verificati:
+ *  - l'abilitazione di IF_ADD_INC all'inizializzazione e, dopo un reboot, alla prima lettura;
+ *  - i valori restituiti da LIS3DSH_ReadACC() per ogni valore grezzo e ogni fondo scala, rispetto alla conversione in
+ *    virgola mobile del driver originale (errore massimo 1 mg);
+ *  - il traffico SPI per campione, confrontato con la lettura originale (CTRL_REG5 e i sei registri di uscita letti
+ *    uno alla volta), in byte, cicli di SCK e cicli del processore a 168 MHz.
+ * @code
+ * gcc -std=gnu99 -O2 -Wall -IUtilities/Components/lis3dsh test/lis3dsh_test.c Utilities/Components/lis3dsh/lis3dsh.c \
+ *   Utilities/Components/Common/regcache.c -o lis3dsh_test && ./lis3dsh_test
+ * @endcode
+ */
+#include "lis3dsh.h"
+#include <stdio.h>
+#include <string.h>
+
+#define SPI_READ			0x80		//!< bit di lettura del primo byte (READWRITE_CMD della BSP)
+#define SPI_MULTIPLE		0x40		//!< bit MULTIPLEBYTE_CMD della BSP, parte dell'indirizzo sul LIS3DSH
+#define SPI_CLOCK_HZ		5250000		//!< SCK della BSP: APB2 a 84 MHz, prescaler 16
+#define CPU_CLOCK_HZ		168000000	//!< HCLK della Discovery
+
+static int failures = 0;
+
+#define CHECK(cond) do { if (!(cond)) { printf("%s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+/**
+ * @brief Modello del LIS3DSH visto dal bus SPI.
+ */
+typedef struct {
+	uint8_t reg[128];		//!< register file
+	unsigned cycles;		//!< cicli di chip select
+	unsigned bytes;			//!< byte trasferiti, indirizzo compreso
+} Device_t;
+
+static Device_t dev;
+
+/**
+ * @brief Valori dei registri dopo l'accensione o un reboot; IF_ADD_INC e' disabilitato, il caso peggiore per il driver.
+ */
+static void DeviceReset(void) {
+	memset(dev.reg, 0, sizeof(dev.reg));
+	dev.reg[LIS3DSH_WHO_AM_I_ADDR] = I_AM_LIS3DSH;
+	dev.reg[LIS3DSH_CTRL_REG4_ADDR] = LIS3DSH_XYZ_ENABLE;
+}
+
+/**
+ * @brief Imposta i registri di uscita.
+ */
+static void DeviceSample(int16_t x, int16_t y, int16_t z) {
+	int16_t v[3] = { x, y, z };
+	for (int i = 0; i < 3; i++) {
+		dev.reg[LIS3DSH_OUT_X_L_ADDR + 2 * i] = (uint8_t) v[i];
+		dev.reg[LIS3DSH_OUT_X_L_ADDR + 2 * i + 1] = (uint8_t) ((uint16_t) v[i] >> 8);
+	}
+}
+
+/**
+ * @brief Un ciclo di chip select: il primo byte e' l'indirizzo, gli altri sono dati letti o scritti.
+ */
+static void DeviceTransfer(uint8_t first, uint8_t* data, uint16_t len) {
+	uint8_t addr = first & 0x7F;
+	dev.cycles++;
+	dev.bytes += 1 + len;
+	for (uint16_t i = 0; i < len; i++) {
+		if (first & SPI_READ)
+			data[i] = dev.reg[addr];
+		else if (addr == LIS3DSH_CTRL_REG6_ADDR && (data[i] & LIS3DSH_BOOT_FORCED)) {
+			DeviceReset();	// il reboot ricarica i valori di default e termina prima del ciclo successivo
+			continue;
+		}
+		else
+			dev.reg[addr] = data[i];
+		if (dev.reg[LIS3DSH_CTRL_REG6_ADDR] & LIS3DSH_ADD_INC)
+			addr = (addr + 1) & 0x7F;
+	}
+}
+
+/*
+ * Interfaccia verso la BSP, con la stessa sequenza di byte di stm32f4_discovery.c.
+ */
+void ACCELERO_IO_Init(void) {
+}
+
+void ACCELERO_IO_ITConfig(void) {
+}
+
+void ACCELERO_IO_INT1Config(void) {
+}
+
+void ACCELERO_IO_Write(uint8_t* pBuffer, uint8_t WriteAddr, uint16_t NumByteToWrite) {
+	DeviceTransfer(WriteAddr | (NumByteToWrite > 1 ? SPI_MULTIPLE : 0), pBuffer, NumByteToWrite);
+}
+
+void ACCELERO_IO_Read(uint8_t* pBuffer, uint8_t ReadAddr, uint16_t NumByteToRead) {
+	DeviceTransfer(ReadAddr | SPI_READ | (NumByteToRead > 1 ? SPI_MULTIPLE : 0), pBuffer, NumByteToRead);
+}
+
+void ACCELERO_IO_ReadBurst(uint8_t* pBuffer, uint8_t ReadAddr, uint16_t NumByteToRead) {
+	DeviceTransfer(ReadAddr | SPI_READ, pBuffer, NumByteToRead);
+}
+
+/**
+ * @brief Lettura originale del driver: CTRL_REG5 e i sei registri di uscita letti singolarmente, conversione in float.
+ * @details Il buffer e' senza segno, per non riprodurre l'estensione del segno del byte basso del driver originale.
+ */
+static void LegacyReadACC(int16_t* pData) {
+	uint8_t buffer[6], ctrl;
+	float sensitivity = LIS3DSH_SENSITIVITY_0_06G;
+
+	ACCELERO_IO_Read(&ctrl, LIS3DSH_CTRL_REG5_ADDR, 1);
+	for (int i = 0; i < 6; i++)
+		ACCELERO_IO_Read(&buffer[i], LIS3DSH_OUT_X_L_ADDR + i, 1);
+	switch (ctrl & LIS3DSH__FULLSCALE_SELECTION) {
+	case LIS3DSH_FULLSCALE_4: sensitivity = LIS3DSH_SENSITIVITY_0_12G; break;
+	case LIS3DSH_FULLSCALE_6: sensitivity = LIS3DSH_SENSITIVITY_0_18G; break;
+	case LIS3DSH_FULLSCALE_8: sensitivity = LIS3DSH_SENSITIVITY_0_24G; break;
+	case LIS3DSH_FULLSCALE_16: sensitivity = LIS3DSH_SENSITIVITY_0_73G; break;
+	default: break;
+	}
+	for (int i = 0; i < 3; i++)
+		pData[i] = (int16_t) ((int16_t) ((buffer[2 * i + 1] << 8) | buffer[2 * i]) * sensitivity);
+}
+
+/**
+ * @brief Inizializzazione come in BSP_ACCELERO_Init(): 100 Hz, assi abilitati, fondo scala 2 g.
+ */
+static void Init(void) {
+	DeviceReset();
+	LIS3DSH_Init((uint16_t) (LIS3DSH_DATARATE_100 | LIS3DSH_XYZ_ENABLE) | ((uint16_t) LIS3DSH_FULLSCALE_2 << 8));
+}
+
+/**
+ * @brief Valori convertiti per ogni valore grezzo e fondo scala, e abilitazione dell'incremento automatico.
+ */
+static void TestValues(void) {
+	static const uint8_t scales[] = { LIS3DSH_FULLSCALE_2, LIS3DSH_FULLSCALE_4, LIS3DSH_FULLSCALE_6,
+			LIS3DSH_FULLSCALE_8, LIS3DSH_FULLSCALE_16 };
+	Init();
+	CHECK(dev.reg[LIS3DSH_CTRL_REG6_ADDR] & LIS3DSH_ADD_INC);
+
+	int maxErr = 0;
+	for (unsigned s = 0; s < sizeof(scales); s++) {
+		LIS3DSH_FullScaleCmd(scales[s]);
+		CHECK((dev.reg[LIS3DSH_CTRL_REG5_ADDR] & LIS3DSH__FULLSCALE_SELECTION) == scales[s]);
+		for (int32_t raw = -32768; raw <= 32767; raw++) {
+			int16_t got[3], ref[3];
+			DeviceSample(raw, -1 - raw, raw ^ 0x5A5A);
+			LIS3DSH_ReadACC(got);
+			LegacyReadACC(ref);
+			for (int i = 0; i < 3; i++) {
+				int err = got[i] > ref[i] ? got[i] - ref[i] : ref[i] - got[i];
+				if (err > maxErr)
+					maxErr = err;
+			}
+		}
+	}
+	CHECK(maxErr <= 1);
+
+	// dopo un reboot IF_ADD_INC torna disabilitato e il fondo scala a 2 g: la prima lettura li ripristina
+	LIS3DSH_FullScaleCmd(LIS3DSH_FULLSCALE_16);
+	LIS3DSH_RebootCmd();
+	CHECK(!(dev.reg[LIS3DSH_CTRL_REG6_ADDR] & LIS3DSH_ADD_INC));
+	int16_t got[3], ref[3];
+	DeviceSample(1000, -2000, 16000);
+	LIS3DSH_ReadACC(got);
+	LegacyReadACC(ref);
+	CHECK(dev.reg[LIS3DSH_CTRL_REG6_ADDR] & LIS3DSH_ADD_INC);
+	for (int i = 0; i < 3; i++)
+		CHECK(got[i] - ref[i] <= 1 && ref[i] - got[i] <= 1);
+	printf("LIS3DSH_ReadACC: errore massimo %d mg rispetto alla conversione in float\n", maxErr);
+}
+
+/**
+ * @brief Traffico SPI per campione, lettura a burst e lettura originale.
+ * @details I cicli CPU sono quelli in cui il processore attende il bus, la cui durata domina la lettura.
+ */
+static void TestTraffic(void) {
+	int16_t data[3];
+	struct {
+		const char* name;
+		void (*read)(int16_t*);
+	} paths[] = { { "burst", LIS3DSH_ReadACC }, { "originale", LegacyReadACC } };
+	unsigned bytes[2];
+
+	Init();
+	DeviceSample(123, -456, 1000);
+	for (int p = 0; p < 2; p++) {
+		dev.cycles = dev.bytes = 0;
+		paths[p].read(data);
+		bytes[p] = dev.bytes;
+		printf("%-10s: %u cicli CS, %u byte, %u cicli SCK, %.1f us e %u cicli CPU a %u Hz per campione\n",
+				paths[p].name, dev.cycles, dev.bytes, 8 * dev.bytes, 8e6 * dev.bytes / SPI_CLOCK_HZ,
+				8 * dev.bytes * (CPU_CLOCK_HZ / SPI_CLOCK_HZ), CPU_CLOCK_HZ);
+		if (p == 0)
+			CHECK(dev.cycles == 1 && dev.bytes == 7);
+	}
+	CHECK(bytes[0] * 2 == bytes[1]);
+}
+
+int main(void) {
+	TestValues();
+	TestTraffic();
+	printf("lis3dsh_test: %s\n", failures == 0 ? "OK" : "FAILED");
+	return failures != 0;
+}
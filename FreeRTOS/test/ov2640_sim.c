@@ -0,0 +1,133 @@
+/**
+ * @file ov2640_sim.c
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+/**
+ * @brief Simulazione su host dell'inizializzazione dell'OV2640, con le tabelle compatte.
+ *
+ * @details
+ * Le funzioni CAMERA_IO_* sono sostituite da un modello del sensore: due banchi di registri (DSP e sensore)
+ * selezionati dal registro 0xFF. Il modello conta le transazioni SCCB, i byte trasferiti e i ritardi richiesti dal
+ * driver.
+ *
+ * Per ogni risoluzione sono verificati:
+ *  - il contenuto finale dei due banchi e il banco selezionato, confrontati con l'impronta FNV-1a ottenuta dal driver
+ *    originale (tabelle {registro, valore} a 16 bit per elemento);
+ *  - che il traffico non aumenti rispetto al driver originale.
+ *
+ * I valori del driver originale si riottengono compilando lo stesso simulatore con il sorgente precedente la
+ * conversione (git show f487edc^:FreeRTOS/Utilities/Components/ov2640/ov2640.c).
+ * @code
+ * gcc -std=gnu99 -O2 -Wall -IUtilities/Components/ov2640 test/ov2640_sim.c \
+ *   Utilities/Components/ov2640/ov2640.c -o ov2640_sim && ./ov2640_sim
+ * @endcode
+ */
+#include "ov2640.h"
+#include <stdio.h>
+#include <string.h>
+
+#define SCCB_CLOCK_HZ		100000		//!< SCL della BSP
+#define SCCB_BYTE_BITS		9			//!< bit per byte, con il bit don't care
+
+static int failures = 0;
+
+#define CHECK(cond) do { if (!(cond)) { printf("%s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+/**
+ * @brief Modello dell'OV2640 visto dal bus SCCB.
+ */
+typedef struct {
+	uint8_t reg[2][256];		//!< banchi DSP (0) e sensore (1)
+	uint8_t bank;				//!< banco selezionato da 0xFF
+	unsigned transactions;		//!< transazioni SCCB
+	unsigned bytes;				//!< byte trasferiti
+	unsigned delayMs;			//!< ritardi richiesti
+} Sensor_t;
+
+static Sensor_t sensor;
+
+/**
+ * @brief Valori del driver originale per ogni risoluzione.
+ */
+typedef struct {
+	uint32_t resolution;		//!< risoluzione
+	const char* name;			//!< nome della risoluzione
+	uint32_t image;				//!< impronta dei banchi
+	unsigned transactions;		//!< transazioni SCCB
+	unsigned bytes;				//!< byte trasferiti
+	unsigned delayMs;			//!< ritardi richiesti
+} Reference_t;
+
+static const Reference_t reference[] = {
+	{ CAMERA_R160x120, "QQVGA", 0xa2aee4a2, 222, 666, 420 },
+	{ CAMERA_R320x240, "QVGA", 0x72e1ebd0, 222, 666, 420 },
+	{ CAMERA_R480x272, "480x272", 0x3252c35e, 239, 717, 674 },
+	{ CAMERA_R640x480, "VGA", 0x7224862b, 239, 717, 674 },
+};
+
+/*
+ * Interfaccia verso la BSP.
+ */
+void CAMERA_IO_Init(void) {
+}
+
+void CAMERA_IO_Write(uint8_t addr, uint8_t reg, uint8_t value) {
+	(void) addr;
+	sensor.transactions++;
+	sensor.bytes += 3;
+	if (reg == 0xFF)
+		sensor.bank = value & 1;
+	else
+		sensor.reg[sensor.bank][reg] = value;
+}
+
+uint8_t CAMERA_IO_Read(uint8_t addr, uint8_t reg) {
+	(void) addr;
+	return sensor.reg[sensor.bank][reg];
+}
+
+void CAMERA_Delay(uint32_t delay) {
+	sensor.delayMs += delay;
+}
+
+static uint32_t Fingerprint(void) {
+	uint32_t h = 2166136261u;
+	for (int b = 0; b < 2; b++)
+		for (int i = 0; i < 256; i++)
+			h = (h ^ sensor.reg[b][i]) * 16777619u;
+	return (h ^ sensor.bank) * 16777619u;
+}
+
+static double InitMs(unsigned bytes, unsigned delayMs) {
+	return delayMs + 1e3 * SCCB_BYTE_BITS * bytes / SCCB_CLOCK_HZ;
+}
+
+int main(void) {
+	for (unsigned r = 0; r < sizeof(reference) / sizeof(reference[0]); r++) {
+		const Reference_t* ref = &reference[r];
+		memset(&sensor, 0, sizeof(sensor));
+		ov2640_Init(0x60, ref->resolution);
+		uint32_t image = Fingerprint();
+		printf("%-8s: immagine %08x, %3u -> %3u transazioni, %3u -> %3u byte, %4.0f -> %4.0f ms a %u Hz\n", ref->name,
+				image, ref->transactions, sensor.transactions, ref->bytes, sensor.bytes,
+				InitMs(ref->bytes, ref->delayMs), InitMs(sensor.bytes, sensor.delayMs), SCCB_CLOCK_HZ);
+		CHECK(image == ref->image);
+		CHECK(sensor.transactions <= ref->transactions);
+	}
+	printf("ov2640_sim: %s\n", failures == 0 ? "OK" : "FAILED");
+	return failures != 0;
+}
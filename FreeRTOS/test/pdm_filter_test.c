@@ -0,0 +1,344 @@
+/**
+ * @file pdm_filter_test.c
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+/**
+ * @brief Verifica su host del decimatore PDM/PCM, rispetto a un riferimento in virgola mobile, e misura del costo.
+ *
+ * @details
+ * I flussi PDM sono prodotti da un modulatore sigma-delta del secondo ordine, come quello di un microfono MEMS, a
+ * partire da toni sinusoidali e da una componente continua. Il riferimento e' la stessa catena in doppia precisione:
+ * CIC del quinto ordine calcolato per definizione (cinque medie mobili di D/2 campioni), filtro half-band con gli
+ * stessi coefficienti e passa-alto con lo stesso polo, senza arrotondamenti intermedi. Sono verificati:
+ *  - l'errore rispetto al riferimento, efficace e massimo in LSB, per D = 64, 80 e 128 e diverse frequenze;
+ *  - l'identita' delle uscite per i quattro formati PDM (ordine dei bit e halfword little endian del DMA) e per due
+ *    microfoni interlacciati, ciascuno rispetto al proprio flusso elaborato da solo, e la replica di un microfono
+ *    sui due canali di uscita;
+ *  - la rimozione della componente continua e la linearita' del guadagno;
+ *  - un'impronta dell'uscita, uguale per la versione in C (SMLAD sui Cortex-M4) e per quelle SSE2 e AVX2.
+ *
+ * Infine viene riportato il costo per campione PCM e per millisecondo di audio a 16 kHz, in ns e, su x86, in cicli.
+ * La versione del filtro half-band dipende dalle opzioni con cui e' compilato pdm_filter.c: SSE2 e' predefinita su
+ * x86-64, -mavx2 abilita AVX2 e -mno-sse2 (solo su pdm_filter.c) la versione in C.
+ * @code
+ * gcc -std=gnu99 -O2 -Wall -Wextra -IUtilities test/pdm_filter_test.c Utilities/pdm_filter.c -lm -o pdm_filter_test && ./pdm_filter_test
+ * gcc -std=gnu99 -O2 -Wall -Wextra -mavx2 -IUtilities test/pdm_filter_test.c Utilities/pdm_filter.c -lm -o pdm_filter_test && ./pdm_filter_test
+ * gcc -std=gnu99 -O2 -mno-sse2 -IUtilities -c Utilities/pdm_filter.c -o pdm_filter.o && \
+ *   gcc -std=gnu99 -O2 -Wall -Wextra -IUtilities test/pdm_filter_test.c pdm_filter.o -lm -o pdm_filter_test && ./pdm_filter_test
+ * @endcode
+ */
+#include "pdm_filter.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <math.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#define TEST_FS				16000		//!< frequenza di campionamento PCM (Hz)
+#define TEST_HP_HZ			10			//!< passa-alto del BSP
+#define TEST_SAMPLES		4000		//!< campioni PCM per prova
+#define TEST_MAX_D			128			//!< fattore di decimazione massimo
+#define TEST_BYTES			(TEST_SAMPLES * TEST_MAX_D / 8)
+#define TEST_PI				3.14159265358979323846
+#define TEST_FINGERPRINT	0x6e54d586u	//!< impronta dell'uscita di TestFingerprint()
+#define BENCH_SAMPLES		2000000		//!< campioni PCM elaborati per la misura del costo
+
+static int failures = 0;
+
+#define CHECK(cond) do { if (!(cond)) { printf("%s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+static const uint16_t decimations[] = { 64, 80, 128 };
+#define N_DECIMATIONS (sizeof(decimations) / sizeof(decimations[0]))
+
+/**
+ * @brief Coefficienti pari del filtro half-band di pdm_filter.c, in Q15.
+ */
+static const int16_t halfBand[PDM_HB_TAPS] = {
+	-1, 3, -6, 10, -17, 25, -36, 50, -69, 92, -120, 156, -199, 252, -316, 396,
+	-496, 623, -792, 1028, -1386, 2011, -3431, 10415, 10415, -3431, 2011, -1386, 1028, -792, 623, -496,
+	396, -316, 252, -199, 156, -120, 92, -69, 50, -36, 25, -17, 10, -6, 3, -1
+};
+
+/**
+ * @brief Modulatore sigma-delta del secondo ordine: flusso PDM di un tono piu' una componente continua.
+ * @param[out] pdm byte in ordine di tempo, primo bit nel bit piu' significativo
+ * @param[in] bytes byte da produrre
+ * @param[in] d fattore di decimazione, per la frequenza PDM
+ * @param[in] amp ampiezza del tono, rispetto al fondo scala
+ * @param[in] freq frequenza del tono (Hz)
+ * @param[in] dc componente continua, rispetto al fondo scala
+ */
+static void Modulate(uint8_t* pdm, uint32_t bytes, uint16_t d, double amp, double freq, double dc) {
+	double i1 = 0, i2 = 0, y = 0, w = 2 * TEST_PI * freq / ((double) TEST_FS * d);
+	for (uint32_t n = 0; n < bytes; n++) {
+		uint8_t b = 0;
+		for (int k = 0; k < 8; k++) {
+			double x = dc + amp * sin(w * (8.0 * n + k));
+			i1 += x - y;
+			i2 += i1 - y;
+			y = i2 >= 0 ? 1 : -1;
+			b = (uint8_t) (b << 1 | (y > 0));
+		}
+		pdm[n] = b;
+	}
+}
+
+/**
+ * @brief Catena di riferimento in doppia precisione, con uscita in LSB a 16 bit non saturata.
+ */
+static void Reference(const uint8_t* pdm, uint16_t d, double* out, uint32_t count, uint16_t gain) {
+	static double stage[PDM_CIC_ORDER + 1][TEST_MAX_D / 2];
+	static double cic[2 * TEST_SAMPLES + PDM_HB_TAPS * 2];
+	const uint32_t r = d / 2, pre = 2 * PDM_HB_TAPS;
+	double sum[PDM_CIC_ORDER];
+	/* come nel decimatore, il CIC parte da un flusso di zeri (-1) e il filtro half-band da campioni nulli */
+	for (int k = 0; k < PDM_CIC_ORDER; k++) {
+		for (uint32_t i = 0; i < r; i++)
+			stage[k][i] = -1;
+		sum[k] = -(double) r;
+	}
+	memset(cic, 0, sizeof(cic));
+	/* CIC: cinque medie mobili su r campioni, decimate di r */
+	for (uint32_t n = 0; n < 2 * count * r; n++) {
+		double x = (pdm[n / 8] >> (7 - n % 8)) & 1 ? 1 : -1;
+		for (int k = 0; k < PDM_CIC_ORDER; k++) {
+			sum[k] += x - stage[k][n % r];
+			stage[k][n % r] = x;
+			x = sum[k] / r;
+		}
+		if (n % r == r - 1)
+			cic[pre + n / r] = x;
+	}
+	/* half-band: y[n] = 0.5 dispari[n - 23] + somma dei coefficienti pari */
+	double hpIn = 0, hpOut = 0, a = 1 - 2 * TEST_PI * TEST_HP_HZ / TEST_FS;
+	for (uint32_t n = 0; n < count; n++) {
+		const double* x = &cic[pre + 2 * n];
+		double y = 0.5 * x[-2 * PDM_HB_DELAY];
+		for (int k = 0; k < PDM_HB_TAPS; k++)
+			y += halfBand[k] / 32768.0 * x[1 - 2 * (PDM_HB_TAPS - 1 - k)];
+		double h = y - hpIn + a * hpOut;
+		hpIn = y;
+		hpOut = h;
+		out[n] = h * 32768 * gain / PDM_GAIN_UNITY;
+	}
+}
+
+/**
+ * @brief Errore del decimatore rispetto al riferimento, su diverse frequenze e ampiezze.
+ */
+static void TestAccuracy(void) {
+	static const double freqs[] = { 100, 1000, 3000, 6000 };
+	static uint8_t pdm[TEST_BYTES];
+	static int16_t out[TEST_SAMPLES];
+	static double ref[TEST_SAMPLES];
+	PDM_Filter_t f;
+	for (size_t i = 0; i < N_DECIMATIONS; i++) {
+		uint16_t d = decimations[i];
+		double worstRms = 0, worstMax = 0;
+		for (size_t j = 0; j < sizeof(freqs) / sizeof(freqs[0]); j++) {
+			Modulate(pdm, TEST_SAMPLES * d / 8, d, 0.5, freqs[j], 0.05);
+			CHECK(PDM_Init(&f, d, PDM_MSB_FIRST, TEST_FS, TEST_HP_HZ, 0, 1, 1) == 0);
+			PDM_Process(&f, pdm, out, TEST_SAMPLES, PDM_GAIN_UNITY);
+			Reference(pdm, d, ref, TEST_SAMPLES, PDM_GAIN_UNITY);
+			double e2 = 0, emax = 0;
+			for (int n = 0; n < TEST_SAMPLES; n++) {
+				double e = fabs(out[n] - ref[n]);
+				e2 += e * e;
+				if (e > emax)
+					emax = e;
+			}
+			double rms = sqrt(e2 / TEST_SAMPLES);
+			if (rms > worstRms)
+				worstRms = rms;
+			if (emax > worstMax)
+				worstMax = emax;
+		}
+		printf("D = %3u: errore rispetto al riferimento %.2f LSB efficace, %.1f LSB massimo\n", d, worstRms, worstMax);
+		CHECK(worstRms < 1.5);
+		CHECK(worstMax < 4);
+	}
+	CHECK(PDM_Init(&f, 96, PDM_MSB_FIRST, TEST_FS, TEST_HP_HZ, 0, 1, 1) == -1);
+}
+
+static uint8_t Reverse(uint8_t b) {
+	uint8_t r = 0;
+	for (int i = 0; i < 8; i++)
+		r = (uint8_t) (r << 1 | ((b >> i) & 1));
+	return r;
+}
+
+/**
+ * @brief Formati PDM, microfoni interlacciati e replica sui canali di uscita.
+ */
+static void TestFormats(void) {
+	static uint8_t a[TEST_BYTES], b[TEST_BYTES], in[2 * TEST_BYTES];
+	static int16_t ref[2][TEST_SAMPLES], out[2 * TEST_SAMPLES];
+	PDM_Filter_t f[2];
+	const uint16_t d = 64;
+	const uint32_t bytes = TEST_SAMPLES * d / 8;
+	Modulate(a, bytes, d, 0.4, 1000, 0);
+	Modulate(b, bytes, d, 0.3, 2500, 0.1);
+	PDM_Init(&f[0], d, PDM_MSB_FIRST, TEST_FS, TEST_HP_HZ, 0, 1, 1);
+	PDM_Process(&f[0], a, ref[0], TEST_SAMPLES, PDM_GAIN_UNITY);
+	PDM_Init(&f[1], d, PDM_MSB_FIRST, TEST_FS, TEST_HP_HZ, 0, 1, 1);
+	PDM_Process(&f[1], b, ref[1], TEST_SAMPLES, PDM_GAIN_UNITY);
+
+	/* quattro formati, elaborati a blocchi di 16 campioni come nel BSP */
+	for (int format = PDM_MSB_FIRST; format <= PDM_LSB_FIRST_HALFWORD; format++) {
+		for (uint32_t n = 0; n < bytes; n++) {
+			uint8_t v = format & 1 ? Reverse(a[n]) : a[n];
+			in[format >> 1 ? n ^ 1 : n] = v;
+		}
+		PDM_Init(&f[0], d, (PDM_Format_t) format, TEST_FS, TEST_HP_HZ, 0, 1, 1);
+		for (uint32_t n = 0; n < TEST_SAMPLES; n += 16)
+			PDM_Process(&f[0], in + n * d / 8, out + n, 16, PDM_GAIN_UNITY);
+		CHECK(memcmp(out, ref[0], TEST_SAMPLES * sizeof(int16_t)) == 0);
+	}
+
+	/* due microfoni, byte interlacciati in halfword little endian */
+	for (uint32_t n = 0; n < bytes; n++) {
+		in[(2 * n) ^ 1] = a[n];
+		in[(2 * n + 1) ^ 1] = b[n];
+	}
+	for (uint8_t c = 0; c < 2; c++)
+		PDM_Init(&f[c], d, PDM_MSB_FIRST_HALFWORD, TEST_FS, TEST_HP_HZ, c, 2, 2);
+	for (uint32_t n = 0; n < TEST_SAMPLES; n += 16)
+		for (uint8_t c = 0; c < 2; c++)
+			PDM_Process(&f[c], in + 2 * n * d / 8, out + 2 * n, 16, PDM_GAIN_UNITY);
+	int mismatch = 0;
+	for (uint32_t n = 0; n < TEST_SAMPLES; n++)
+		mismatch += out[2 * n] != ref[0][n] || out[2 * n + 1] != ref[1][n];
+	CHECK(mismatch == 0);
+
+	/* un microfono su un flusso stereo */
+	for (uint32_t n = 0; n < bytes; n++)
+		in[n ^ 1] = a[n];
+	PDM_Init(&f[0], d, PDM_MSB_FIRST_HALFWORD, TEST_FS, TEST_HP_HZ, 0, 1, 2);
+	PDM_Process(&f[0], in, out, TEST_SAMPLES, PDM_GAIN_UNITY);
+	mismatch = 0;
+	for (uint32_t n = 0; n < TEST_SAMPLES; n++)
+		mismatch += out[2 * n] != ref[0][n] || out[2 * n + 1] != ref[0][n];
+	CHECK(mismatch == 0);
+}
+
+/**
+ * @brief Rimozione della componente continua e linearita' del guadagno.
+ */
+static void TestDcAndGain(void) {
+	static uint8_t pdm[TEST_BYTES];
+	static int16_t a[TEST_SAMPLES], b[TEST_SAMPLES];
+	PDM_Filter_t f;
+	const uint16_t d = 64;
+	Modulate(pdm, TEST_SAMPLES * d / 8, d, 0, 0, 0.3);
+	PDM_Init(&f, d, PDM_MSB_FIRST, TEST_FS, TEST_HP_HZ, 0, 1, 1);
+	PDM_Process(&f, pdm, a, TEST_SAMPLES, PDM_GAIN_UNITY);
+	double mean = 0;
+	for (int n = TEST_SAMPLES - 1000; n < TEST_SAMPLES; n++)
+		mean += a[n];
+	mean /= 1000;
+	printf("componente continua di 0.3 fondo scala: %.2f LSB in uscita\n", mean);
+	CHECK(fabs(mean) < 2);
+
+	Modulate(pdm, TEST_SAMPLES * d / 8, d, 0.2, 1000, 0);
+	PDM_Init(&f, d, PDM_MSB_FIRST, TEST_FS, TEST_HP_HZ, 0, 1, 1);
+	PDM_Process(&f, pdm, a, TEST_SAMPLES, PDM_GAIN_UNITY);
+	PDM_Init(&f, d, PDM_MSB_FIRST, TEST_FS, TEST_HP_HZ, 0, 1, 1);
+	PDM_Process(&f, pdm, b, TEST_SAMPLES, 4 * PDM_GAIN_UNITY);
+	/* a parte la saturazione nel transitorio iniziale, differiscono solo per l'arrotondamento di a */
+	int wrong = 0;
+	for (int n = 0; n < TEST_SAMPLES; n++)
+		if (b[n] != INT16_MAX && b[n] != INT16_MIN)
+			wrong += b[n] - 4 * a[n] < 0 || b[n] - 4 * a[n] > 3;
+	CHECK(wrong == 0);
+	PDM_Init(&f, d, PDM_MSB_FIRST, TEST_FS, TEST_HP_HZ, 0, 1, 1);
+	PDM_Process(&f, pdm, b, TEST_SAMPLES, 0);
+	int silent = 1;
+	for (int n = 0; n < TEST_SAMPLES; n++)
+		silent &= b[n] == 0;
+	CHECK(silent);
+}
+
+/**
+ * @brief Impronta (FNV-1a) dell'uscita a guadagno elevato, con saturazione, per tutti i fattori di decimazione.
+ */
+static void TestFingerprint(void) {
+	static uint8_t pdm[TEST_BYTES];
+	static int16_t out[TEST_SAMPLES];
+	PDM_Filter_t f;
+	uint32_t h = 2166136261u;
+	for (size_t i = 0; i < N_DECIMATIONS; i++) {
+		uint16_t d = decimations[i];
+		Modulate(pdm, TEST_SAMPLES * d / 8, d, 0.45, 440 * (i + 1), 0.02);
+		PDM_Init(&f, d, PDM_MSB_FIRST, TEST_FS, TEST_HP_HZ, 0, 1, 1);
+		PDM_Process(&f, pdm, out, TEST_SAMPLES, 3 * PDM_GAIN_UNITY);
+		const uint8_t* p = (const uint8_t*) out;
+		for (size_t n = 0; n < sizeof(out); n++)
+			h = (h ^ p[n]) * 16777619u;
+	}
+	printf("impronta dell'uscita: 0x%08x\n", h);
+	CHECK(h == TEST_FINGERPRINT);
+}
+
+/**
+ * @brief Costo di PDM_Process() per campione PCM, per ciascun fattore di decimazione.
+ */
+static void Benchmark(void) {
+	static uint8_t pdm[TEST_BYTES];
+	static int16_t out[TEST_SAMPLES];
+	PDM_Filter_t f;
+	long sink = 0;
+	for (size_t i = 0; i < N_DECIMATIONS; i++) {
+		uint16_t d = decimations[i];
+		Modulate(pdm, TEST_SAMPLES * d / 8, d, 0.5, 1000, 0);
+		PDM_Init(&f, d, PDM_MSB_FIRST_HALFWORD, TEST_FS, TEST_HP_HZ, 0, 1, 1);
+		struct timespec t0, t1;
+		clock_gettime(CLOCK_MONOTONIC, &t0);
+#if defined(__x86_64__) || defined(__i386__)
+		uint64_t c0 = __rdtsc();
+#endif
+		for (int n = 0; n < BENCH_SAMPLES; n += TEST_SAMPLES) {
+			PDM_Process(&f, pdm, out, TEST_SAMPLES, PDM_GAIN_UNITY);
+			sink += out[n % TEST_SAMPLES];
+		}
+#if defined(__x86_64__) || defined(__i386__)
+		uint64_t c1 = __rdtsc();
+#endif
+		clock_gettime(CLOCK_MONOTONIC, &t1);
+		double ns = ((t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec)) / BENCH_SAMPLES;
+#if defined(__x86_64__) || defined(__i386__)
+		double cycles = (double) (c1 - c0) / BENCH_SAMPLES;
+		printf("PDM_Process D = %3u: %.1f ns, %.1f cicli TSC per campione, %.0f cicli per ms a 16 kHz [%ld]\n", d, ns,
+				cycles, cycles * TEST_FS / 1000, sink & 1);
+#else
+		printf("PDM_Process D = %3u: %.1f ns per campione, %.2f us per ms a 16 kHz [%ld]\n", d, ns,
+				ns * TEST_FS / 1e6, sink & 1);
+#endif
+	}
+}
+
+int main(void) {
+	TestAccuracy();
+	TestFormats();
+	TestDcAndGain();
+	TestFingerprint();
+	Benchmark();
+
+	printf("pdm_filter: %s\n", failures ? "FAILED" : "OK");
+	return failures != 0;
+}
@@ -0,0 +1,184 @@
+/**
+ * @file pdmtopcm_test.c
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+/**
+ * @brief Confronto su host tra la conversione PDM/PCM del BSP in tre passi e quella in un solo passo sul buffer del DMA.
+ *
+ * @details
+ * Il percorso originale di BSP_AUDIO_IN_PDMToPCM(), riprodotto qui, copia ogni blocco del DMA in un buffer sullo
+ * stack scambiando i byte di ogni halfword (HTONS), lo decima con il formato PDM_MSB_FIRST e, con un solo microfono,
+ * duplica i campioni mono sul canale destro in un terzo passo. Il percorso attuale legge i byte direttamente dalle
+ * halfword (PDM_MSB_FIRST_HALFWORD) e scrive i campioni stereo interlacciati durante la decimazione.<br>
+ * Su blocchi di 1 ms a 16 kHz (INTERNAL_BUFF_SIZE / 2 halfword per microfono) di un flusso sigma-delta, con uno e con
+ * due microfoni, e' verificato che le uscite dei due percorsi siano identiche, e ne viene riportato il costo per
+ * blocco in ns e, su x86, in cicli.
+ * @code
+ * gcc -std=gnu99 -O2 -Wall -Wextra -IUtilities test/pdmtopcm_test.c Utilities/pdm_filter.c -lm -o pdmtopcm_test && ./pdmtopcm_test
+ * @endcode
+ */
+#include "pdm_filter.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <math.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#define TEST_FS				16000					//!< DEFAULT_AUDIO_IN_FREQ
+#define TEST_DECIMATION		64						//!< DEFAULT_AUDIO_IN_DECIMATION
+#define TEST_VOLUME			64						//!< DEFAULT_AUDIO_IN_VOLUME
+#define PCM_OUT_SIZE		(TEST_FS / 1000)		//!< campioni per canale di un blocco
+#define BLOCK_HALFWORDS		(PCM_OUT_SIZE * TEST_DECIMATION / 16)	//!< halfword del DMA per microfono
+#define TEST_BLOCKS			20000					//!< blocchi da 1 ms per prova
+#define TEST_ROUNDS			5						//!< ripetizioni della misura
+#define TEST_PI				3.14159265358979323846
+
+#define HTONS(A)  ((((uint16_t)(A) & 0xff00) >> 8) | \
+                   (((uint16_t)(A) & 0x00ff) << 8))
+
+static int failures = 0;
+
+#define CHECK(cond) do { if (!(cond)) { printf("%s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+static uint16_t dma[2 * BLOCK_HALFWORDS * TEST_BLOCKS];		//!< flusso PDM, come scritto dal DMA di I2S2
+static int16_t pcmOld[2 * PCM_OUT_SIZE * TEST_BLOCKS];
+static int16_t pcmNew[2 * PCM_OUT_SIZE * TEST_BLOCKS];
+
+/**
+ * @brief Flusso PDM di channels microfoni, con i bit in ordine di tempo dal piu' significativo di ogni halfword, come
+ * li riceve I2S2: modulatore sigma-delta del secondo ordine su un tono diverso per ogni microfono.
+ */
+static void Modulate(uint8_t channels) {
+	for (uint8_t c = 0; c < channels; c++) {
+		double i1 = 0, i2 = 0, y = 0, w = 2 * TEST_PI * (700 + 1100 * c) / ((double) TEST_FS * TEST_DECIMATION);
+		uint32_t bits = 8 * BLOCK_HALFWORDS * TEST_BLOCKS * 2;
+		for (uint32_t n = 0; n < bits; n++) {
+			i1 += 0.4 * sin(w * n) - y;
+			i2 += i1 - y;
+			y = i2 >= 0 ? 1 : -1;
+			/* byte n / 8 del microfono c: con piu' microfoni i byte sono interlacciati */
+			uint32_t byte = n / 8 * channels + c;
+			uint16_t* hw = &dma[byte / 2];
+			uint16_t mask = (uint16_t) (1 << ((byte & 1 ? 7 : 15) - n % 8));
+			if (y > 0)
+				*hw |= mask;
+			else
+				*hw &= (uint16_t) ~mask;
+		}
+	}
+}
+
+/**
+ * @brief Percorso originale di BSP_AUDIO_IN_PDMToPCM(): copia con scambio dei byte, decimazione, duplicazione.
+ * @details Il filtro originale scriveva il canale sinistro con passo 2; quello attuale, con un solo microfono e due
+ * canali in uscita, replica i campioni da se', per cui qui scrive i campioni mono in un buffer a parte, che il terzo
+ * passo copia su entrambi i canali (una lettura e due scritture per campione, come in origine).
+ */
+static void PDMToPCM_Old(PDM_Filter_t* filter, uint8_t channels, uint16_t* PDMBuf, uint16_t* PCMBuf) {
+	uint16_t AppPDM[2 * BLOCK_HALFWORDS];
+	uint16_t mono[PCM_OUT_SIZE];
+	uint32_t index = 0;
+
+	for (index = 0; index < BLOCK_HALFWORDS * channels; index++)
+		AppPDM[index] = HTONS(PDMBuf[index]);
+
+	if (channels == 1) {
+		PDM_Process(&filter[0], (uint8_t*) AppPDM, (int16_t*) mono, PCM_OUT_SIZE, TEST_VOLUME);
+		for (index = 0; index < PCM_OUT_SIZE; index++)
+			PCMBuf[index << 1] = PCMBuf[(index << 1) + 1] = mono[index];
+		return;
+	}
+	for (index = 0; index < channels; index++)
+		PDM_Process(&filter[index], (uint8_t*) AppPDM, (int16_t*) PCMBuf, PCM_OUT_SIZE, TEST_VOLUME);
+}
+
+/**
+ * @brief Percorso attuale di BSP_AUDIO_IN_PDMToPCM(), in un solo passo.
+ */
+static void PDMToPCM_New(PDM_Filter_t* filter, uint8_t channels, uint16_t* PDMBuf, uint16_t* PCMBuf) {
+	for (uint32_t index = 0; index < channels; index++)
+		PDM_Process(&filter[index], (uint8_t*) PDMBuf, (int16_t*) PCMBuf, PCM_OUT_SIZE, TEST_VOLUME);
+}
+
+/**
+ * @brief Esegue un percorso su tutti i blocchi.
+ * @details La prova e' ripetuta TEST_ROUNDS volte, dallo stato iniziale dei filtri, e vale la piu' veloce.
+ * @return cicli (o ns, se il TSC non e' disponibile) per blocco
+ */
+static double Run(void (*path)(PDM_Filter_t*, uint8_t, uint16_t*, uint16_t*), PDM_Format_t format, uint8_t channels,
+		int16_t* pcm, double* ns) {
+	PDM_Filter_t filter[2];
+	double best = 0;
+	for (int round = 0; round < TEST_ROUNDS; round++) {
+		/* nel percorso originale un microfono e' decimato in mono: la duplicazione e' un passo a parte */
+		for (uint8_t c = 0; c < channels; c++)
+			PDM_Init(&filter[c], TEST_DECIMATION, format, TEST_FS, 10, c, channels,
+					path == PDMToPCM_Old ? channels : 2);
+		struct timespec t0, t1;
+		clock_gettime(CLOCK_MONOTONIC, &t0);
+#if defined(__x86_64__) || defined(__i386__)
+		uint64_t c0 = __rdtsc();
+#endif
+		for (uint32_t k = 0; k < TEST_BLOCKS; k++)
+			path(filter, channels, &dma[k * BLOCK_HALFWORDS * channels], (uint16_t*) &pcm[k * 2 * PCM_OUT_SIZE]);
+#if defined(__x86_64__) || defined(__i386__)
+		uint64_t c1 = __rdtsc();
+#endif
+		clock_gettime(CLOCK_MONOTONIC, &t1);
+		double t = ((t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec)) / TEST_BLOCKS;
+#if defined(__x86_64__) || defined(__i386__)
+		double c = (double) (c1 - c0) / TEST_BLOCKS;
+#else
+		double c = t;
+#endif
+		if (round == 0 || c < best) {
+			best = c;
+			*ns = t;
+		}
+	}
+	return best;
+}
+
+static void TestPaths(uint8_t channels) {
+	double nsOld, nsNew;
+	Modulate(channels);
+	memset(pcmOld, 0x55, sizeof(pcmOld));
+	memset(pcmNew, 0xAA, sizeof(pcmNew));
+	double old = Run(PDMToPCM_Old, PDM_MSB_FIRST, channels, pcmOld, &nsOld);
+	double new = Run(PDMToPCM_New, PDM_MSB_FIRST_HALFWORD, channels, pcmNew, &nsNew);
+	uint32_t differing = 0;
+	for (uint32_t k = 0; k < TEST_BLOCKS; k++)
+		differing += memcmp(&pcmOld[k * 2 * PCM_OUT_SIZE], &pcmNew[k * 2 * PCM_OUT_SIZE],
+				2 * PCM_OUT_SIZE * sizeof(int16_t)) != 0;
+	printf("%s: %u blocchi diversi su %u; per blocco da 1 ms: originale %.0f ns, in un passo %.0f ns",
+			channels == 1 ? "1 microfono" : "2 microfoni", differing, TEST_BLOCKS, nsOld, nsNew);
+#if defined(__x86_64__) || defined(__i386__)
+	printf(" (%.0f e %.0f cicli TSC, %+.0f%%)", old, new, 100 * (new - old) / old);
+#endif
+	printf("\n");
+	CHECK(differing == 0);
+}
+
+int main(void) {
+	TestPaths(1);
+	TestPaths(2);
+
+	printf("pdmtopcm: %s\n", failures ? "FAILED" : "OK");
+	return failures != 0;
+}
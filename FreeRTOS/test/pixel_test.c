@@ -0,0 +1,207 @@
+/**
+ * @file pixel_test.c
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+/**
+ * @brief Verifica su host delle conversioni e della fusione di pixel.c, rispetto a un riferimento canale per canale.
+ *
+ * @details
+ * Il riferimento separa i canali R (5 bit), G (6 bit) e B (5 bit) di ogni pixel e calcola per ciascuno
+ * out = (src * a + dst * (32 - a)) >> 5, con a = (alpha + 4) >> 3; le conversioni troncano ogni canale a 8 bit ai bit
+ * piu' significativi. Sono verificati PIXEL_FromARGB8888(), PIXEL_FromRGB888(), PIXEL_Blend() e
+ * PIXEL_BlendARGB8888():
+ *  - per tutte le lunghezze da 0 a 40 e per 257 pixel, per cui i blocchi di 8 pixel della versione SSE2 sono seguiti
+ *    da code di ogni lunghezza, con puntatori allineati e non allineati a 16 byte;
+ *  - con alpha costante 0, 255 e ai bordi di ogni passo dell'alpha a 5 bit, e con alpha per pixel casuale, 0 e 255;
+ *  - che i pixel oltre l'n-esimo non siano scritti.
+ *
+ * Il test e' eseguito due volte: con pixel.c compilato per SSE2, come di default su x86-64, e senza, per cui sono
+ * usate solo le versioni in C destinate al Cortex-M4.
+ * @code
+ * gcc -std=gnu99 -O2 -Wall -Wextra -IUtilities/Components/Common test/pixel_test.c Utilities/Components/Common/pixel.c \
+ *   -o pixel_test && ./pixel_test
+ * gcc -std=gnu99 -O2 -mno-sse2 -c Utilities/Components/Common/pixel.c -o pixel.o && \
+ *   gcc -std=gnu99 -O2 -Wall -Wextra -IUtilities/Components/Common test/pixel_test.c pixel.o -o pixel_test && ./pixel_test
+ * @endcode
+ */
+#include "pixel.h"
+#include <stdio.h>
+#include <string.h>
+
+#define TEST_MAX			257			//!< lunghezza massima provata
+#define TEST_SHORT			40			//!< lunghezze provate tutte, da 0
+#define TEST_GUARD			0xA5C3		//!< valore dei pixel oltre l'n-esimo
+
+static int failures = 0;
+
+#define CHECK(cond) do { if (!(cond)) { printf("%s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+static uint32_t seed = 12345;
+
+/**
+ * @brief Generatore congruenziale lineare, per dati riproducibili.
+ */
+static uint32_t Random(void) {
+	seed = seed * 1664525u + 1013904223u;
+	return seed;
+}
+
+/**
+ * @brief Riferimento: pixel RGB565 dalle componenti a 8 bit, troncate.
+ */
+static uint16_t RefRGB565(uint32_t r, uint32_t g, uint32_t b) {
+	return (uint16_t) (((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3));
+}
+
+/**
+ * @brief Riferimento: fusione di un pixel, canale per canale, con alpha a 8 bit.
+ */
+static uint16_t RefBlend(uint16_t fg, uint16_t bg, uint32_t alpha) {
+	uint32_t a = (alpha + 4) >> 3;
+	uint32_t r = (((fg >> 11) & 0x1F) * a + ((bg >> 11) & 0x1F) * (32 - a)) >> 5;
+	uint32_t g = (((fg >> 5) & 0x3F) * a + ((bg >> 5) & 0x3F) * (32 - a)) >> 5;
+	uint32_t b = ((fg & 0x1F) * a + (bg & 0x1F) * (32 - a)) >> 5;
+	return (uint16_t) ((r << 11) | (g << 5) | b);
+}
+
+static uint32_t argb[TEST_MAX + 4];			//!< sorgente ARGB8888
+static uint8_t rgb[3 * (TEST_MAX + 4)];		//!< sorgente RGB888
+static uint16_t fg[TEST_MAX + 8];			//!< sorgente RGB565
+static uint16_t bg[TEST_MAX + 8];			//!< sfondo RGB565
+static uint16_t out[TEST_MAX + 16];			//!< destinazione
+static uint16_t ref[TEST_MAX + 8];			//!< destinazione attesa
+
+/**
+ * @brief Genera i dati per una prova; l'alpha dei pixel ARGB8888 e' casuale, 0 o 255 con uguale probabilita'.
+ */
+static void Generate(void) {
+	for (int i = 0; i < TEST_MAX + 4; i++) {
+		uint32_t alpha = Random() >> 24;
+		argb[i] = (Random() & 0x00FFFFFF) | ((i % 3 == 0 ? alpha : i % 3 == 1 ? 0 : 255) << 24);
+		for (int c = 0; c < 3; c++)
+			rgb[3 * i + c] = (uint8_t) (Random() >> 24);
+	}
+	for (int i = 0; i < TEST_MAX + 8; i++) {
+		fg[i] = (uint16_t) (Random() >> 16);
+		bg[i] = (uint16_t) (Random() >> 16);
+	}
+}
+
+/**
+ * @brief Prepara la destinazione a partire da offset: lo sfondo nei primi n pixel, TEST_GUARD dopo.
+ */
+static uint16_t* Destination(uint32_t offset, uint32_t n) {
+	for (uint32_t i = 0; i < sizeof(out) / sizeof(out[0]); i++)
+		out[i] = TEST_GUARD;
+	memcpy(out + offset, bg, n * sizeof(uint16_t));
+	return out + offset;
+}
+
+/**
+ * @brief Confronta la destinazione con il riferimento e verifica che i pixel oltre l'n-esimo non siano stati scritti.
+ */
+static int Matches(const uint16_t* dst, uint32_t n) {
+	if (memcmp(dst, ref, n * sizeof(uint16_t)) != 0)
+		return 0;
+	for (uint32_t i = n; i < n + 8; i++)
+		if (dst[i] != TEST_GUARD)
+			return 0;
+	return 1;
+}
+
+/**
+ * @brief Lunghezza della prova i-esima: 0..TEST_SHORT, poi TEST_MAX.
+ */
+static uint32_t Length(uint32_t i) {
+	return i <= TEST_SHORT ? i : TEST_MAX;
+}
+
+static void TestConvert(void) {
+	int argbErrors = 0, rgbErrors = 0;
+	for (uint32_t i = 0; i <= TEST_SHORT + 1; i++)
+		for (uint32_t offset = 0; offset < 2; offset++) {
+			uint32_t n = Length(i);
+			Generate();
+			for (uint32_t k = 0; k < n; k++)
+				ref[k] = RefRGB565((argb[k + offset] >> 16) & 0xFF, (argb[k + offset] >> 8) & 0xFF,
+						argb[k + offset] & 0xFF);
+			uint16_t* dst = Destination(offset, n);
+			PIXEL_FromARGB8888(dst, argb + offset, n);
+			argbErrors += !Matches(dst, n);
+
+			for (uint32_t k = 0; k < n; k++)
+				ref[k] = RefRGB565(rgb[3 * k + 2], rgb[3 * k + 1], rgb[3 * k]);
+			dst = Destination(offset, n);
+			PIXEL_FromRGB888(dst, rgb, n);
+			rgbErrors += !Matches(dst, n);
+		}
+	printf("conversioni: %d errori ARGB8888, %d errori RGB888\n", argbErrors, rgbErrors);
+	CHECK(argbErrors == 0);
+	CHECK(rgbErrors == 0);
+	CHECK(PIXEL_RGB565(0xFF, 0xFF, 0xFF) == 0xFFFF && PIXEL_RGB565(0x08, 0x04, 0x08) == 0x0821);
+}
+
+static void TestBlend(void) {
+	static const uint8_t alphas[] = { 0, 3, 4, 11, 12, 127, 128, 131, 132, 243, 244, 251, 252, 255 };
+	int errors = 0, unchanged = 1, copied = 1;
+	for (uint32_t j = 0; j < sizeof(alphas); j++)
+		for (uint32_t i = 0; i <= TEST_SHORT + 1; i++)
+			for (uint32_t offset = 0; offset < 2; offset++) {
+				uint32_t n = Length(i);
+				Generate();
+				for (uint32_t k = 0; k < n; k++)
+					ref[k] = RefBlend(fg[k + offset], bg[k], alphas[j]);
+				uint16_t* dst = Destination(offset, n);
+				PIXEL_Blend(dst, fg + offset, alphas[j], n);
+				errors += !Matches(dst, n);
+				if (alphas[j] == 0)
+					unchanged &= memcmp(dst, bg, n * sizeof(uint16_t)) == 0;
+				if (alphas[j] == 255)
+					copied &= memcmp(dst, fg + offset, n * sizeof(uint16_t)) == 0;
+			}
+	printf("fusione con alpha costante: %d errori\n", errors);
+	CHECK(errors == 0);
+	CHECK(unchanged);
+	CHECK(copied);
+}
+
+static void TestBlendARGB8888(void) {
+	int errors = 0;
+	for (uint32_t i = 0; i <= TEST_SHORT + 1; i++)
+		for (uint32_t offset = 0; offset < 2; offset++) {
+			uint32_t n = Length(i);
+			Generate();
+			for (uint32_t k = 0; k < n; k++) {
+				uint32_t p = argb[k + offset];
+				ref[k] = RefBlend(RefRGB565((p >> 16) & 0xFF, (p >> 8) & 0xFF, p & 0xFF), bg[k], p >> 24);
+			}
+			uint16_t* dst = Destination(offset, n);
+			PIXEL_BlendARGB8888(dst, argb + offset, n);
+			errors += !Matches(dst, n);
+		}
+	printf("fusione con alpha per pixel: %d errori\n", errors);
+	CHECK(errors == 0);
+}
+
+int main(void) {
+	TestConvert();
+	TestBlend();
+	TestBlendARGB8888();
+
+	printf("pixel: %s\n", failures ? "FAILED" : "OK");
+	return failures != 0;
+}
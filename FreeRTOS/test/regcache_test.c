@@ -0,0 +1,830 @@
+/**
+ * @file regcache_test.c
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+/**
+ * @brief Verifica su host della copia dei registri e del traffico I2C e SPI risparmiato dai driver che la usano.
+ *
+ * @details
+ * Le funzioni IOE_*, MFX_IO_* e AUDIO_IO_* sono sostituite da modelli dei dispositivi (STMPE811, STMPE1600,
+ * MFXSTM32L152 e CS43L22) che ne riproducono i registri: reset software, registri di stato, registri di comando che
+ * agiscono sulla scrittura (SET/CLR dei pin, ACK delle interruzioni) e incremento automatico dell'indirizzo del
+ * CS43L22. Ogni transazione e' contata, con i byte trasferiti sul bus: indirizzo del dispositivo, del registro e dati,
+ * ripetendo l'indirizzo del dispositivo per le letture.
+ *
+ * Gli espansori sono provati a coppie: lo stesso script di uso tipico della BSP (configurazione dei pin, scrittura e
+ * lettura dei pin, interruzioni) e' eseguito su un dispositivo registrato con l'Init del driver, che usa la copia dei
+ * registri, e su uno non registrato, che il driver pilota come faceva prima, leggendo e scrivendo ogni registro sul
+ * bus. Il traffico del CS43L22, confrontato con il driver originale, e' verificato in cs43l22_test.c; qui ne e'
+ * provato il recupero dopo un errore I2C.
+ *
+ * Il LIS3DSH, sul bus SPI, ha una sola istanza: il driver originale e' il driver attuale in cui LIS3DSH_ReadReg() e
+ * LIS3DSH_WriteReg() vanno sempre sul bus, le sole due funzioni che accedono alla copia dei registri. Lo script
+ * (Init, ReadACC ad ogni passo, DataRateCmd e FullScaleCmd con valori nuovi e ripetuti, FIFOConfig in stream e in
+ * bypass, RebootCmd seguito una volta da DataRateCmd e una da ReadACC, che trovano il reboot in corso, un secondo
+ * Init) e' eseguito prima con REGCACHE_Read() e REGCACHE_Write() sostituite (--wrap del linker) da versioni che non
+ * trovano alcun registro nella copia, registrando i registri e i campioni letti dopo ogni passo, poi con la copia dei
+ * registri. Le funzioni ACCELERO_IO_* sono sostituite da un modello SPI che conta i cicli di chip select.
+ *
+ * Sono verificati:
+ *  - la separazione tra valore accumulato e valore nel dispositivo: accumulare due volte lo stesso valore lo lascia
+ *    da scrivere, riaccumulare il valore del dispositivo annulla la scrittura, REGCACHE_Fill() non sovrascrive un
+ *    valore accumulato;
+ *  - REGCACHE_Complete(): dopo un errore il valore non e' piu' noto e la scrittura successiva lo rimanda;
+ *  - i registri volatili, mai serviti dalla copia, e REGCACHE_Invalidate();
+ *  - i registri rimandati per unire due sequenze in REGCACHE_NextRun(), con il valore che hanno gia';
+ *  - per ogni espansore, che i registri e i comandi ricevuti dai due dispositivi siano gli stessi dopo ogni passo
+ *    dello script, anche dopo un reset software;
+ *  - per il CS43L22, che un errore I2C su una scrittura del volume sia recuperato dalla scrittura successiva;
+ *  - per il LIS3DSH, che i registri e i campioni letti coincidano con quelli del driver originale dopo ogni passo;
+ *  - il traffico di ogni script, prima e dopo, in transazioni, byte e tempo sul bus (I2C a 100 kHz, SPI a
+ *    5.25 MHz), e per il LIS3DSH quello di ciascun comando.
+ * @code
+ * gcc -std=gnu99 -O2 -Wall -Wl,--wrap=REGCACHE_Read,--wrap=REGCACHE_Write test/regcache_test.c \
+ *   Utilities/Components/Common/regcache.c Utilities/Components/stmpe811/stmpe811.c \
+ *   Utilities/Components/stmpe1600/stmpe1600.c Utilities/Components/mfxstm32l152/mfxstm32l152.c \
+ *   Utilities/Components/cs43l22/cs43l22.c Utilities/Components/lis3dsh/lis3dsh.c -o regcache_test && ./regcache_test
+ * @endcode
+ */
+#include "../Utilities/Components/Common/regcache.h"
+#include "../Utilities/Components/stmpe811/stmpe811.h"
+#include "../Utilities/Components/stmpe1600/stmpe1600.h"
+#include "../Utilities/Components/mfxstm32l152/mfxstm32l152.h"
+#include "../Utilities/Components/cs43l22/cs43l22.h"
+#include "../Utilities/Components/lis3dsh/lis3dsh.h"
+#include <stdio.h>
+#include <string.h>
+
+#define I2C_CLOCK_HZ		100000		//!< SCL della BSP
+#define I2C_BYTE_BITS		9			//!< bit per byte, con l'acknowledge
+#define SPI_CLOCK_HZ		5250000		//!< SCK della BSP: APB2 a 84 MHz, prescaler 16
+#define SPI_BYTE_BITS		8			//!< bit per byte
+#define SPI_READ			0x80		//!< bit di lettura del primo byte (READWRITE_CMD della BSP)
+#define SPI_MULTIPLE		0x40		//!< bit MULTIPLEBYTE_CMD della BSP, parte dell'indirizzo sul LIS3DSH
+#define LIS3DSH_STEPS		300			//!< passi dello script del LIS3DSH
+
+#define STMPE811_CACHED		0x82		//!< indirizzo dello STMPE811 registrato
+#define STMPE811_PLAIN		0x88		//!< indirizzo dello STMPE811 non registrato
+#define STMPE1600_CACHED	0x84		//!< indirizzo dello STMPE1600 registrato
+#define STMPE1600_PLAIN		0x86		//!< indirizzo dello STMPE1600 non registrato
+#define MFX_CACHED			0x84		//!< indirizzo dell'MFX registrato
+#define MFX_PLAIN			0x86		//!< indirizzo dell'MFX non registrato
+#define CODEC_ADDRESS		0x94		//!< indirizzo del CS43L22 sulla Discovery
+
+static int failures = 0;
+
+#define CHECK(cond) do { if (!(cond)) { printf("%s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+/**
+ * @brief Tipo di dispositivo simulato.
+ */
+typedef enum {
+	KIND_STMPE811, KIND_STMPE1600, KIND_MFX, KIND_CS43L22, KIND_LIS3DSH
+} Kind_t;
+
+/**
+ * @brief Modello di un dispositivo visto dal bus I2C.
+ */
+typedef struct {
+	Kind_t kind;				//!< tipo di dispositivo
+	uint8_t reg[256];			//!< register file
+	uint8_t latch[3];			//!< uscite impostate dai registri SET/CLR
+	uint8_t inputs[3];			//!< livello dei pin in ingresso
+	uint32_t commands;			//!< impronta FNV-1a delle scritture sui registri di comando
+	unsigned transactions;		//!< transazioni I2C
+	unsigned bytes;				//!< byte trasferiti
+	uint8_t failNext;			//!< la prossima scrittura non riceve l'acknowledge
+	uint8_t booting;			//!< reboot del LIS3DSH in corso per il prossimo ciclo di chip select
+} Device_t;
+
+static Device_t stmpe811Dev[2], stmpe1600Dev[2], mfxDev[2], codecDev, lis3dshDev[2];
+static Device_t* lis3dsh = &lis3dshDev[0];	//!< LIS3DSH collegato al bus SPI
+
+/**
+ * @brief Valori dei registri dopo l'accensione o un reset software.
+ */
+static void DeviceReset(Device_t* d) {
+	memset(d->reg, 0, sizeof(d->reg));
+	memset(d->latch, 0, sizeof(d->latch));
+	switch (d->kind) {
+	case KIND_STMPE811:
+		d->reg[STMPE811_REG_CHP_ID_LSB] = STMPE811_ID >> 8;
+		d->reg[STMPE811_REG_CHP_ID_MSB] = STMPE811_ID & 0xFF;
+		d->reg[STMPE811_REG_SYS_CTRL2] = 0x0F;
+		break;
+	case KIND_STMPE1600:
+		d->reg[STMPE1600_REG_CHP_ID + 1] = 0x16;
+		d->reg[STMPE1600_REG_SYS_CTRL] = 0x00;
+		break;
+	case KIND_MFX:
+		d->reg[MFXSTM32L152_REG_ADR_ID] = MFXSTM32L152_ID_1;
+		break;
+	case KIND_CS43L22:
+		d->reg[CS43L22_CHIPID_ADDR] = CS43L22_ID;
+		break;
+	case KIND_LIS3DSH:
+		d->reg[LIS3DSH_WHO_AM_I_ADDR] = I_AM_LIS3DSH;
+		d->reg[LIS3DSH_CTRL_REG4_ADDR] = LIS3DSH_XYZ_ENABLE;
+		break;
+	}
+}
+
+static void DeviceInit(Device_t* d, Kind_t kind) {
+	memset(d, 0, sizeof(Device_t));
+	d->kind = kind;
+	d->commands = 2166136261u;
+	DeviceReset(d);
+}
+
+static void DeviceCommand(Device_t* d, uint8_t reg, uint8_t value) {
+	d->commands = (d->commands ^ reg) * 16777619u;
+	d->commands = (d->commands ^ value) * 16777619u;
+}
+
+/**
+ * @brief Stato dei pin letto dal registro di monitor: le uscite dal latch o dal registro dati, gli ingressi dai pin.
+ */
+static uint8_t DeviceRead(Device_t* d, uint8_t reg) {
+	uint8_t value = d->reg[reg];
+	switch (d->kind) {
+	case KIND_STMPE811:
+		if (reg == STMPE811_REG_IO_MP_STA)
+			value = (d->latch[0] & d->reg[STMPE811_REG_IO_DIR]) | (d->inputs[0] & ~d->reg[STMPE811_REG_IO_DIR]);
+		break;
+	case KIND_STMPE1600:
+		if (reg == STMPE1600_REG_GPMR || reg == STMPE1600_REG_GPMR + 1) {
+			uint8_t n = reg - STMPE1600_REG_GPMR;
+			uint8_t dir = d->reg[STMPE1600_REG_GPDR + n];
+			value = (d->reg[STMPE1600_REG_GPSR + n] & dir) | (d->inputs[n] & ~dir);
+		}
+		else if (reg == STMPE1600_REG_ISGPIOR || reg == STMPE1600_REG_ISGPIOR + 1)
+			d->reg[reg] = 0;	// la lettura cancella le interruzioni
+		break;
+	case KIND_MFX:
+		if (reg >= MFXSTM32L152_REG_ADR_GPIO_STATE1 && reg <= MFXSTM32L152_REG_ADR_GPIO_STATE3) {
+			uint8_t n = reg - MFXSTM32L152_REG_ADR_GPIO_STATE1;
+			uint8_t dir = d->reg[MFXSTM32L152_REG_ADR_GPIO_DIR1 + n];
+			value = (d->latch[n] & dir) | (d->inputs[n] & ~dir);
+		}
+		break;
+	case KIND_CS43L22:
+	case KIND_LIS3DSH:
+		break;
+	}
+	return value;
+}
+
+static void DeviceWrite(Device_t* d, uint8_t reg, uint8_t value) {
+	switch (d->kind) {
+	case KIND_STMPE811:
+		if (reg == STMPE811_REG_SYS_CTRL1) {
+			DeviceCommand(d, reg, value);
+			if (value & 0x02)
+				DeviceReset(d);
+		}
+		else if (reg == STMPE811_REG_INT_STA || reg == STMPE811_REG_IO_INT_STA || reg == STMPE811_REG_IO_ED
+				|| reg == STMPE811_REG_FIFO_STA) {
+			DeviceCommand(d, reg, value);
+			d->reg[reg] &= ~value;
+		}
+		else if (reg == STMPE811_REG_IO_SET_PIN || reg == STMPE811_REG_IO_CLR_PIN) {
+			DeviceCommand(d, reg, value);
+			d->latch[0] = reg == STMPE811_REG_IO_SET_PIN ? d->latch[0] | value : d->latch[0] & ~value;
+		}
+		else
+			d->reg[reg] = value;
+		break;
+	case KIND_STMPE1600:
+		if (reg == STMPE1600_REG_SYS_CTRL) {
+			DeviceCommand(d, reg, value);
+			if (value & 0x80)
+				DeviceReset(d);
+			else
+				d->reg[reg] = value;
+		}
+		else if (reg == STMPE1600_REG_ISGPIOR || reg == STMPE1600_REG_ISGPIOR + 1
+				|| reg == STMPE1600_REG_GPMR || reg == STMPE1600_REG_GPMR + 1)
+			DeviceCommand(d, reg, value);	// sola lettura
+		else
+			d->reg[reg] = value;
+		break;
+	case KIND_MFX:
+		if (reg == MFXSTM32L152_REG_ADR_SYS_CTRL) {
+			DeviceCommand(d, reg, value);
+			if (value & MFXSTM32L152_SWRST)
+				DeviceReset(d);
+			else
+				d->reg[reg] = value;
+		}
+		else if (reg >= MFXSTM32L152_REG_ADR_GPO_SET1 && reg <= MFXSTM32L152_REG_ADR_GPO_SET3) {
+			DeviceCommand(d, reg, value);
+			d->latch[reg - MFXSTM32L152_REG_ADR_GPO_SET1] |= value;
+		}
+		else if (reg >= MFXSTM32L152_REG_ADR_GPO_CLR1 && reg <= MFXSTM32L152_REG_ADR_GPO_CLR3) {
+			DeviceCommand(d, reg, value);
+			d->latch[reg - MFXSTM32L152_REG_ADR_GPO_CLR1] &= ~value;
+		}
+		else if (reg == MFXSTM32L152_REG_ADR_IRQ_ACK) {
+			DeviceCommand(d, reg, value);
+			d->reg[MFXSTM32L152_REG_ADR_IRQ_PENDING] &= ~value;
+		}
+		else if (reg >= MFXSTM32L152_REG_ADR_IRQ_GPI_ACK1 && reg <= MFXSTM32L152_REG_ADR_IRQ_GPI_ACK3) {
+			DeviceCommand(d, reg, value);
+			d->reg[MFXSTM32L152_REG_ADR_IRQ_GPI_PENDING1 + reg - MFXSTM32L152_REG_ADR_IRQ_GPI_ACK1] &= ~value;
+		}
+		else
+			d->reg[reg] = value;
+		break;
+	case KIND_CS43L22:
+	case KIND_LIS3DSH:
+		d->reg[reg] = value;
+		break;
+	}
+}
+
+/**
+ * @brief Una transazione: indirizzo del dispositivo e del registro, poi i dati; le letture ripetono l'indirizzo.
+ */
+static void DeviceTransfer(Device_t* d, uint8_t read, uint8_t reg, uint8_t* data, uint16_t len, uint8_t increment) {
+	d->transactions++;
+	d->bytes += 2 + (read ? 1 : 0) + len;
+	for (uint16_t i = 0; i < len; i++) {
+		if (read)
+			data[i] = DeviceRead(d, reg);
+		else
+			DeviceWrite(d, reg, data[i]);
+		if (increment)
+			reg++;
+	}
+}
+
+static Device_t* IoeDevice(uint8_t addr) {
+	switch (addr) {
+	case STMPE811_CACHED: return &stmpe811Dev[0];
+	case STMPE811_PLAIN: return &stmpe811Dev[1];
+	case STMPE1600_CACHED: return &stmpe1600Dev[0];
+	default: return &stmpe1600Dev[1];
+	}
+}
+
+static Device_t* MfxDevice(uint16_t addr) {
+	return addr == MFX_CACHED ? &mfxDev[0] : &mfxDev[1];
+}
+
+/*
+ * Interfaccia verso la BSP: gli indirizzi dei registri si incrementano nelle transazioni multiple.
+ */
+void IOE_Init(void) {
+}
+
+void IOE_ITConfig(void) {
+}
+
+void IOE_Delay(uint32_t delay) {
+	(void) delay;
+}
+
+void IOE_Write(uint8_t addr, uint8_t reg, uint8_t value) {
+	DeviceTransfer(IoeDevice(addr), 0, reg, &value, 1, 1);
+}
+
+uint8_t IOE_Read(uint8_t addr, uint8_t reg) {
+	uint8_t value;
+	DeviceTransfer(IoeDevice(addr), 1, reg, &value, 1, 1);
+	return value;
+}
+
+uint16_t IOE_ReadMultiple(uint8_t addr, uint8_t reg, uint8_t *buffer, uint16_t length) {
+	DeviceTransfer(IoeDevice(addr), 1, reg, buffer, length, 1);
+	return 0;
+}
+
+void IOE_WriteMultiple(uint8_t addr, uint8_t reg, uint8_t *buffer, uint16_t length) {
+	DeviceTransfer(IoeDevice(addr), 0, reg, buffer, length, 1);
+}
+
+void MFX_IO_Init(void) {
+}
+
+void MFX_IO_DeInit(void) {
+}
+
+void MFX_IO_ITConfig(void) {
+}
+
+void MFX_IO_EnableWakeupPin(void) {
+}
+
+void MFX_IO_Wakeup(void) {
+}
+
+void MFX_IO_Delay(uint32_t delay) {
+	(void) delay;
+}
+
+void MFX_IO_Write(uint16_t addr, uint8_t reg, uint8_t value) {
+	DeviceTransfer(MfxDevice(addr), 0, reg, &value, 1, 1);
+}
+
+uint8_t MFX_IO_Read(uint16_t addr, uint8_t reg) {
+	uint8_t value;
+	DeviceTransfer(MfxDevice(addr), 1, reg, &value, 1, 1);
+	return value;
+}
+
+uint16_t MFX_IO_ReadMultiple(uint16_t addr, uint8_t reg, uint8_t *buffer, uint16_t length) {
+	DeviceTransfer(MfxDevice(addr), 1, reg, buffer, length, 1);
+	return 0;
+}
+
+void AUDIO_IO_Init(void) {
+}
+
+void AUDIO_IO_DeInit(void) {
+}
+
+/**
+ * @brief Scrittura sul CS43L22: senza acknowledge la transazione si interrompe prima dei dati.
+ */
+static uint8_t CodecTransfer(uint8_t reg, uint8_t* data, uint16_t len) {
+	if (codecDev.failNext) {
+		codecDev.failNext = 0;
+		codecDev.transactions++;
+		codecDev.bytes += 2;
+		return 1;
+	}
+	DeviceTransfer(&codecDev, 0, reg & ~CS43L22_MAP_INCR, data, len, reg & CS43L22_MAP_INCR);
+	return 0;
+}
+
+uint8_t AUDIO_IO_Write(uint8_t Addr, uint8_t Reg, uint8_t Value) {
+	(void) Addr;
+	return CodecTransfer(Reg, &Value, 1);
+}
+
+uint8_t AUDIO_IO_WriteMultiple(uint8_t Addr, uint8_t Reg, uint8_t *pBuffer, uint16_t Length) {
+	(void) Addr;
+	return CodecTransfer(Reg, pBuffer, Length);
+}
+
+uint8_t AUDIO_IO_Read(uint8_t Addr, uint8_t Reg) {
+	uint8_t value;
+	(void) Addr;
+	DeviceTransfer(&codecDev, 1, Reg & ~CS43L22_MAP_INCR, &value, 1, 0);
+	return value;
+}
+
+/**
+ * @brief Un ciclo di chip select sul LIS3DSH: il primo byte e' l'indirizzo, gli altri sono dati letti o scritti, con
+ * l'indirizzo incrementato solo se CTRL_REG6 IF_ADD_INC e' impostato.
+ * @details Il bit BOOT ricarica i valori di default; il reboot resta in corso per il ciclo successivo, in cui
+ * CTRL_REG6 e' letto con BOOT impostato e le scritture sono ignorate.
+ */
+static void Lis3dshTransfer(uint8_t first, uint8_t* data, uint16_t len) {
+	Device_t* d = lis3dsh;
+	uint8_t addr = first & 0x7F, booting = d->booting;
+	d->transactions++;
+	d->bytes += 1 + len;
+	d->booting = 0;
+	for (uint16_t i = 0; i < len; i++) {
+		if (first & SPI_READ)
+			data[i] = DeviceRead(d, addr) | (booting && addr == LIS3DSH_CTRL_REG6_ADDR ? LIS3DSH_BOOT_FORCED : 0);
+		else if (booting)
+			continue;
+		else if (addr == LIS3DSH_CTRL_REG6_ADDR && (data[i] & LIS3DSH_BOOT_FORCED)) {
+			DeviceCommand(d, addr, data[i]);
+			DeviceReset(d);
+			d->booting = 1;
+			return;
+		}
+		else
+			DeviceWrite(d, addr, data[i]);
+		if (d->reg[LIS3DSH_CTRL_REG6_ADDR] & LIS3DSH_ADD_INC)
+			addr = (addr + 1) & 0x7F;
+	}
+}
+
+void ACCELERO_IO_Init(void) {
+}
+
+void ACCELERO_IO_ITConfig(void) {
+}
+
+void ACCELERO_IO_INT1Config(void) {
+}
+
+void ACCELERO_IO_Write(uint8_t* pBuffer, uint8_t WriteAddr, uint16_t NumByteToWrite) {
+	Lis3dshTransfer(WriteAddr | (NumByteToWrite > 1 ? SPI_MULTIPLE : 0), pBuffer, NumByteToWrite);
+}
+
+void ACCELERO_IO_Read(uint8_t* pBuffer, uint8_t ReadAddr, uint16_t NumByteToRead) {
+	Lis3dshTransfer(ReadAddr | SPI_READ | (NumByteToRead > 1 ? SPI_MULTIPLE : 0), pBuffer, NumByteToRead);
+}
+
+void ACCELERO_IO_ReadBurst(uint8_t* pBuffer, uint8_t ReadAddr, uint16_t NumByteToRead) {
+	Lis3dshTransfer(ReadAddr | SPI_READ, pBuffer, NumByteToRead);
+}
+
+/*
+ * Copia dei registri disattivata, per riprodurre il driver originale del LIS3DSH: nessun registro e' noto e ogni
+ * scrittura va sul bus.
+ */
+static int bypassCache = 0;
+
+uint8_t __real_REGCACHE_Read(REGCACHE_t* c, uint8_t reg, uint8_t* value);
+uint8_t __real_REGCACHE_Write(REGCACHE_t* c, uint8_t reg, uint8_t value);
+
+uint8_t __wrap_REGCACHE_Read(REGCACHE_t* c, uint8_t reg, uint8_t* value) {
+	return bypassCache ? 0 : __real_REGCACHE_Read(c, reg, value);
+}
+
+uint8_t __wrap_REGCACHE_Write(REGCACHE_t* c, uint8_t reg, uint8_t value) {
+	return bypassCache ? 1 : __real_REGCACHE_Write(c, reg, value);
+}
+
+/**
+ * @brief Stampa il traffico di uno script, prima e dopo.
+ */
+static void Report(const char* name, unsigned clockHz, unsigned byteBits, unsigned oldTransactions, unsigned oldBytes,
+		unsigned newTransactions, unsigned newBytes) {
+	printf("%-13s: %5u -> %5u transazioni, %6u -> %6u byte, %8.2f -> %8.2f ms a %u Hz (-%.0f%%)\n", name,
+			oldTransactions, newTransactions, oldBytes, newBytes, 1e3 * byteBits * oldBytes / clockHz,
+			1e3 * byteBits * newBytes / clockHz, clockHz, oldBytes ? 100.0 * (oldBytes - newBytes) / oldBytes : 0);
+}
+
+/**
+ * @brief Confronta i due dispositivi di una coppia, dopo un passo dello script.
+ */
+static int SameState(const Device_t* d) {
+	return memcmp(d[0].reg, d[1].reg, sizeof(d[0].reg)) == 0 && memcmp(d[0].latch, d[1].latch, sizeof(d[0].latch)) == 0
+			&& d[0].commands == d[1].commands;
+}
+
+/**
+ * @brief Operazioni elementari della copia dei registri.
+ */
+static void TestCache(void) {
+	REGCACHE_t c;
+	uint8_t value = 0, reg = 0, length;
+
+	REGCACHE_Init(&c, 0x10, 8);
+	REGCACHE_Cacheable(&c, 0x10, 0x15);
+
+	// registro non noto: la lettura va sul bus, la scrittura anche
+	CHECK(!REGCACHE_Read(&c, 0x11, &value));
+	CHECK(REGCACHE_Write(&c, 0x11, 0x22));
+	CHECK(REGCACHE_Read(&c, 0x11, &value) && value == 0x22);
+	CHECK(!REGCACHE_Write(&c, 0x11, 0x22));
+
+	// accumulare due volte un nuovo valore lo lascia da scrivere; il valore del dispositivo annulla la scrittura
+	REGCACHE_Stage(&c, 0x11, 0x33);
+	REGCACHE_Stage(&c, 0x11, 0x33);
+	CHECK(REGCACHE_Read(&c, 0x11, &value) && value == 0x33);
+	REGCACHE_Fill(&c, 0x11, 0x44);
+	CHECK(REGCACHE_Read(&c, 0x11, &value) && value == 0x33);
+	CHECK(REGCACHE_NextRun(&c, &reg, 0, 8) == 1 && reg == 0x11 && *REGCACHE_Data(&c, 0x11) == 0x33);
+	REGCACHE_Complete(&c, reg, 1, 0);
+	REGCACHE_Stage(&c, 0x11, 0x55);
+	REGCACHE_Stage(&c, 0x11, 0x33);
+	CHECK(REGCACHE_NextRun(&c, &reg, 0, 8) == 0);
+
+	// dopo un errore il valore non e' noto e la stessa scrittura e' rimandata
+	REGCACHE_Stage(&c, 0x11, 0x66);
+	CHECK(REGCACHE_NextRun(&c, &reg, 0, 8) == 1);
+	REGCACHE_Complete(&c, reg, 1, 1);
+	CHECK(!REGCACHE_Read(&c, 0x11, &value));
+	REGCACHE_Stage(&c, 0x11, 0x66);
+	CHECK(REGCACHE_NextRun(&c, &reg, 0, 8) == 1);
+	REGCACHE_Complete(&c, reg, 1, 0);
+	CHECK(REGCACHE_Read(&c, 0x11, &value) && value == 0x66);
+
+	// un valore accumulato seguito da una scrittura diretta dello stesso valore: la scrittura va sul bus
+	REGCACHE_Stage(&c, 0x12, 0x40);
+	CHECK(REGCACHE_Write(&c, 0x12, 0x40));
+	CHECK(REGCACHE_NextRun(&c, &reg, 0, 8) == 0);
+
+	// due sequenze unite dai registri noti che le separano, riscritti con il loro valore
+	REGCACHE_Write(&c, 0x13, 0x13);
+	REGCACHE_Write(&c, 0x14, 0x14);
+	REGCACHE_Stage(&c, 0x12, 0x77);
+	REGCACHE_Stage(&c, 0x15, 0x88);
+	length = REGCACHE_NextRun(&c, &reg, 2, 8);
+	CHECK(length == 4 && reg == 0x12);
+	CHECK(memcmp(REGCACHE_Data(&c, 0x12), "\x77\x13\x14\x88", 4) == 0);
+	REGCACHE_Complete(&c, reg, length, 0);
+
+	// registri volatili e invalidazione
+	CHECK(REGCACHE_Write(&c, 0x16, 0x01) && REGCACHE_Write(&c, 0x16, 0x01));
+	REGCACHE_Fill(&c, 0x16, 0x01);
+	CHECK(!REGCACHE_Read(&c, 0x16, &value));
+	REGCACHE_Invalidate(&c);
+	CHECK(!REGCACHE_Read(&c, 0x13, &value));
+	printf("REGCACHE: %u letture dalla RAM, %u scritture omesse\n", c.stats.readHits, c.stats.writesSkipped);
+}
+
+/**
+ * @brief STMPE811 come espansore e touch screen: pin di uscita commutati, un ingresso letto, due pin in
+ * interruzione, un pin riconfigurato ogni 20 passi, lettura del tocco ad ogni passo.
+ */
+static void Stmpe811Script(uint16_t addr, Device_t* d, int step) {
+	if (step == 0) {
+		if (addr == STMPE811_CACHED)
+			stmpe811_Init(addr);
+		else
+			stmpe811_Reset(addr);
+		stmpe811_IO_Start(addr, STMPE811_PIN_ALL & ~(STMPE811_PIN_4 | STMPE811_PIN_5 | STMPE811_PIN_6 | STMPE811_PIN_7));
+		stmpe811_IO_Config(addr, STMPE811_PIN_0 | STMPE811_PIN_1, IO_MODE_OUTPUT);
+		stmpe811_IO_Config(addr, STMPE811_PIN_2, IO_MODE_INPUT);
+		stmpe811_IO_Config(addr, STMPE811_PIN_3, IO_MODE_IT_RISING_EDGE);
+		stmpe811_TS_Start(addr);
+		return;
+	}
+	if (step == 150) {
+		// reset software: i registri tornano ai valori di default e la copia e' invalidata
+		stmpe811_Reset(addr);
+		stmpe811_IO_Start(addr, STMPE811_PIN_0 | STMPE811_PIN_1 | STMPE811_PIN_2 | STMPE811_PIN_3);
+		stmpe811_IO_Config(addr, STMPE811_PIN_0 | STMPE811_PIN_1, IO_MODE_OUTPUT);
+		stmpe811_IO_Config(addr, STMPE811_PIN_3, IO_MODE_IT_FALLING_EDGE);
+	}
+	if (step % 3 == 0)
+		d->inputs[0] ^= STMPE811_PIN_2;
+	if (step % 7 == 0) {
+		d->reg[STMPE811_REG_INT_STA] |= STMPE811_GIT_IO;
+		d->reg[STMPE811_REG_IO_INT_STA] |= STMPE811_PIN_3;
+	}
+	stmpe811_IO_WritePin(addr, STMPE811_PIN_0, step & 1);
+	stmpe811_IO_WritePin(addr, STMPE811_PIN_1, !(step & 1));
+	stmpe811_IO_ReadPin(addr, STMPE811_PIN_2);
+	if (stmpe811_IO_ITStatus(addr, STMPE811_PIN_3))
+		stmpe811_IO_ClearIT(addr, STMPE811_PIN_3);
+	if (step % 20 == 0) {
+		stmpe811_IO_Config(addr, STMPE811_PIN_1, IO_MODE_INPUT);
+		stmpe811_IO_Config(addr, STMPE811_PIN_1, IO_MODE_OUTPUT);
+		stmpe811_IO_Config(addr, STMPE811_PIN_3, IO_MODE_IT_RISING_EDGE);
+	}
+	stmpe811_TS_DetectTouch(addr);
+}
+
+/**
+ * @brief STMPE1600 come espansore a 16 pin: quattro uscite, un ingresso in interruzione, riconfigurazioni periodiche.
+ */
+static void Stmpe1600Script(uint16_t addr, Device_t* d, int step) {
+	if (step == 0) {
+		if (addr == STMPE1600_CACHED)
+			stmpe1600_Init(addr);
+		else
+			stmpe1600_Reset(addr);
+		stmpe1600_IO_Config(addr, STMPE1600_PIN_0 | STMPE1600_PIN_1 | STMPE1600_PIN_2 | STMPE1600_PIN_3, IO_MODE_OUTPUT);
+		stmpe1600_IO_Config(addr, STMPE1600_PIN_8, IO_MODE_IT_FALLING_EDGE);
+		return;
+	}
+	if (step == 150) {
+		stmpe1600_Reset(addr);
+		stmpe1600_IO_Config(addr, STMPE1600_PIN_0 | STMPE1600_PIN_1, IO_MODE_OUTPUT);
+		stmpe1600_IO_Config(addr, STMPE1600_PIN_8, IO_MODE_IT_RISING_EDGE);
+	}
+	if (step % 5 == 0) {
+		d->inputs[1] ^= STMPE1600_PIN_8 >> 8;
+		d->reg[STMPE1600_REG_ISGPIOR + 1] |= STMPE1600_PIN_8 >> 8;
+	}
+	stmpe1600_IO_WritePin(addr, STMPE1600_PIN_0 << (step & 3), step & 4);
+	stmpe1600_IO_ReadPin(addr, STMPE1600_PIN_8);
+	if (stmpe1600_IO_ITStatus(addr, STMPE1600_PIN_8))
+		stmpe1600_IO_ClearIT(addr, STMPE1600_PIN_8);
+	if (step % 20 == 0) {
+		stmpe1600_IO_Config(addr, STMPE1600_PIN_3, IO_MODE_INPUT);
+		stmpe1600_IO_Config(addr, STMPE1600_PIN_3, IO_MODE_OUTPUT);
+		stmpe1600_IO_PolarityInv_Enable(addr, STMPE1600_PIN_8);
+		stmpe1600_IO_PolarityInv_Disable(addr, STMPE1600_PIN_8);
+	}
+}
+
+/**
+ * @brief MFXSTM32L152 come espansore: uscite push-pull, un ingresso con pull-up, un pin in interruzione sul fronte,
+ * riconfigurazioni periodiche di pin sui tre banchi.
+ */
+static void MfxScript(uint16_t addr, Device_t* d, int step) {
+	if (step == 0) {
+		if (addr == MFX_CACHED)
+			mfxstm32l152_Init(addr);
+		else {
+			mfxstm32l152_SetIrqOutPinPolarity(addr, MFXSTM32L152_OUT_PIN_POLARITY_HIGH);
+			mfxstm32l152_SetIrqOutPinType(addr, MFXSTM32L152_OUT_PIN_TYPE_PUSHPULL);
+		}
+		mfxstm32l152_IO_Start(addr, MFXSTM32L152_GPIO_PINS_ALL);
+		mfxstm32l152_IO_Config(addr, MFXSTM32L152_GPIO_PIN_0 | MFXSTM32L152_GPIO_PIN_1, IO_MODE_OUTPUT_PP_PU);
+		mfxstm32l152_IO_Config(addr, MFXSTM32L152_GPIO_PIN_8, IO_MODE_INPUT_PU);
+		mfxstm32l152_IO_Config(addr, MFXSTM32L152_GPIO_PIN_9, IO_MODE_IT_RISING_EDGE);
+		return;
+	}
+	if (step == 150) {
+		mfxstm32l152_Reset(addr);
+		mfxstm32l152_IO_Start(addr, MFXSTM32L152_GPIO_PINS_ALL);
+		mfxstm32l152_IO_Config(addr, MFXSTM32L152_GPIO_PIN_0 | MFXSTM32L152_GPIO_PIN_1, IO_MODE_OUTPUT_PP_PU);
+		mfxstm32l152_IO_Config(addr, MFXSTM32L152_GPIO_PIN_9, IO_MODE_IT_FALLING_EDGE);
+	}
+	if (step % 3 == 0)
+		d->inputs[1] ^= MFXSTM32L152_GPIO_PIN_8 >> 8;
+	if (step % 7 == 0) {
+		d->reg[MFXSTM32L152_REG_ADR_IRQ_PENDING] |= MFXSTM32L152_IRQ_GPIO;
+		d->reg[MFXSTM32L152_REG_ADR_IRQ_GPI_PENDING2] |= MFXSTM32L152_GPIO_PIN_9 >> 8;
+	}
+	mfxstm32l152_IO_WritePin(addr, MFXSTM32L152_GPIO_PIN_0, step & 1);
+	mfxstm32l152_IO_WritePin(addr, MFXSTM32L152_GPIO_PIN_1, !(step & 1));
+	mfxstm32l152_IO_ReadPin(addr, MFXSTM32L152_GPIO_PIN_8);
+	if (mfxstm32l152_IO_ITStatus(addr, MFXSTM32L152_GPIO_PIN_9))
+		mfxstm32l152_IO_ClearIT(addr, MFXSTM32L152_GPIO_PIN_9);
+	if (step % 20 == 0) {
+		mfxstm32l152_IO_Config(addr, MFXSTM32L152_GPIO_PIN_2 | MFXSTM32L152_AGPIO_PIN_0, IO_MODE_OUTPUT_PP_PD);
+		mfxstm32l152_IO_Config(addr, MFXSTM32L152_GPIO_PIN_2 | MFXSTM32L152_AGPIO_PIN_0, IO_MODE_INPUT_PD);
+		mfxstm32l152_IO_Config(addr, MFXSTM32L152_GPIO_PIN_9, IO_MODE_IT_RISING_EDGE);
+	}
+}
+
+/**
+ * @brief Esegue uno script su una coppia di dispositivi, confrontandoli ad ogni passo.
+ */
+static void TestExpander(const char* name, Device_t* d, Kind_t kind, uint16_t cached, uint16_t plain,
+		void (*script)(uint16_t, Device_t*, int)) {
+	int mismatch = -1;
+	DeviceInit(&d[0], kind);
+	DeviceInit(&d[1], kind);
+	for (int step = 0; step < 300; step++) {
+		script(cached, &d[0], step);
+		script(plain, &d[1], step);
+		if (mismatch < 0 && !SameState(d))
+			mismatch = step;
+	}
+	if (mismatch >= 0)
+		printf("%s: stato diverso dal passo %d\n", name, mismatch);
+	CHECK(mismatch < 0);
+	CHECK(d[0].transactions < d[1].transactions);
+	Report(name, I2C_CLOCK_HZ, I2C_BYTE_BITS, d[1].transactions, d[1].bytes, d[0].transactions, d[0].bytes);
+}
+
+/**
+ * @brief CS43L22: una scrittura del volume senza acknowledge e' rimandata dalla stessa scrittura successiva.
+ */
+static void TestCodec(void) {
+	uint8_t expected;
+
+	DeviceInit(&codecDev, KIND_CS43L22);
+	cs43l22_Init(CODEC_ADDRESS, OUTPUT_DEVICE_AUTO, 70, 48000);
+	cs43l22_Play(CODEC_ADDRESS, NULL, 0);
+	expected = codecDev.reg[CS43L22_REG_MASTER_A_VOL];
+	cs43l22_SetVolume(CODEC_ADDRESS, 40);
+	CHECK(codecDev.reg[CS43L22_REG_MASTER_A_VOL] != expected);
+	expected = codecDev.reg[CS43L22_REG_MASTER_A_VOL];
+	codecDev.failNext = 1;
+	CHECK(cs43l22_SetVolume(CODEC_ADDRESS, 60) != 0);
+	CHECK(codecDev.reg[CS43L22_REG_MASTER_A_VOL] == expected);
+	CHECK(cs43l22_SetVolume(CODEC_ADDRESS, 60) == 0);
+	CHECK(codecDev.reg[CS43L22_REG_MASTER_A_VOL] != expected);
+	expected = codecDev.reg[CS43L22_REG_MASTER_A_VOL];
+	CHECK(cs43l22_SetVolume(CODEC_ADDRESS, 40) == 0);
+	CHECK(cs43l22_SetVolume(CODEC_ADDRESS, 60) == 0);
+	CHECK(codecDev.reg[CS43L22_REG_MASTER_A_VOL] == expected);
+}
+
+/**
+ * @brief Comandi del LIS3DSH di cui e' misurato il traffico.
+ */
+typedef enum {
+	LIS_INIT, LIS_RATE, LIS_SCALE, LIS_FIFO, LIS_REBOOT, LIS_READ, LIS_OPS
+} LisOp_t;
+
+static const char* lisOpName[LIS_OPS] = { "Init", "DataRateCmd", "FullScaleCmd", "FIFOConfig", "RebootCmd", "ReadACC" };
+
+static unsigned lisTransactions[2][LIS_OPS], lisBytes[2][LIS_OPS];	//!< traffico per comando, [copia][comando]
+static uint8_t lisReg[LIS3DSH_STEPS][128];		//!< registri del driver originale dopo ogni passo
+static int16_t lisSample[LIS3DSH_STEPS][3];		//!< campioni letti dal driver originale ad ogni passo
+
+/**
+ * @brief Esegue un comando del LIS3DSH e ne conta il traffico.
+ */
+static void Lis3dshOp(int cached, LisOp_t op, uint8_t arg, int16_t* sample) {
+	unsigned t = lis3dsh->transactions, b = lis3dsh->bytes;
+	switch (op) {
+	case LIS_INIT:
+		LIS3DSH_Init(LIS3DSH_DATARATE_100 | LIS3DSH_XYZ_ENABLE | (uint16_t) (LIS3DSH_FULLSCALE_2 << 8));
+		break;
+	case LIS_RATE:
+		LIS3DSH_DataRateCmd(arg);
+		break;
+	case LIS_SCALE:
+		LIS3DSH_FullScaleCmd(arg);
+		break;
+	case LIS_FIFO:
+		LIS3DSH_FIFOConfig(arg, arg == LIS3DSH_FIFO_BYPASS_MODE ? 0 : 16);
+		break;
+	case LIS_REBOOT:
+		LIS3DSH_RebootCmd();
+		break;
+	default:
+		LIS3DSH_ReadACC(sample);
+		break;
+	}
+	lisTransactions[cached][op] += lis3dsh->transactions - t;
+	lisBytes[cached][op] += lis3dsh->bytes - b;
+}
+
+/**
+ * @brief Uso tipico della BSP: campionamento continuo, alternanza tra attivita' e riposo con la FIFO, cambi di fondo
+ * scala, un reboot seguito dal ripristino della frequenza, uno seguito dalla lettura dei campioni e una
+ * reinizializzazione. I comandi ripetono spesso il valore che il registro ha gia'.
+ */
+static void Lis3dshScript(int cached, int step, int16_t* sample) {
+	Device_t* d = lis3dsh;
+	for (int i = 0; i < 6; i++)
+		d->reg[LIS3DSH_OUT_X_L_ADDR + i] = (uint8_t) (step * 37 + i * 11);
+	if (step == 0 || step == 250)
+		Lis3dshOp(cached, LIS_INIT, 0, NULL);
+	if (step % 10 == 5)
+		Lis3dshOp(cached, LIS_RATE, (step / 10) & 1 ? LIS3DSH_DATARATE_3_125 : LIS3DSH_DATARATE_100, NULL);
+	if (step % 10 == 0)
+		Lis3dshOp(cached, LIS_RATE, LIS3DSH_DATARATE_100, NULL);
+	if (step % 30 == 0)
+		Lis3dshOp(cached, LIS_SCALE, (step / 30) & 1 ? LIS3DSH_FULLSCALE_4 : LIS3DSH_FULLSCALE_2, NULL);
+	if (step % 30 == 15)
+		Lis3dshOp(cached, LIS_SCALE, (step / 30) & 1 ? LIS3DSH_FULLSCALE_4 : LIS3DSH_FULLSCALE_2, NULL);
+	if (step % 20 == 0)
+		Lis3dshOp(cached, LIS_FIFO, LIS3DSH_FIFO_STREAM_MODE, NULL);
+	if (step % 20 == 10)
+		Lis3dshOp(cached, LIS_FIFO, LIS3DSH_FIFO_BYPASS_MODE, NULL);
+	if (step == 100 || step == 200)
+		Lis3dshOp(cached, LIS_REBOOT, 0, NULL);
+	if (step == 100)
+		Lis3dshOp(cached, LIS_RATE, LIS3DSH_DATARATE_100, NULL);
+	Lis3dshOp(cached, LIS_READ, 0, sample);
+}
+
+/**
+ * @brief LIS3DSH: lo script eseguito dal driver originale e poi con la copia dei registri, confrontati ad ogni passo.
+ */
+static void TestLis3dsh(void) {
+	int mismatch = -1;
+	unsigned total[2][2] = { { 0 } };
+
+	lis3dsh = &lis3dshDev[1];
+	DeviceInit(lis3dsh, KIND_LIS3DSH);
+	bypassCache = 1;
+	for (int step = 0; step < LIS3DSH_STEPS; step++) {
+		Lis3dshScript(0, step, lisSample[step]);
+		memcpy(lisReg[step], lis3dsh->reg, sizeof(lisReg[step]));
+	}
+	bypassCache = 0;
+
+	lis3dsh = &lis3dshDev[0];
+	DeviceInit(lis3dsh, KIND_LIS3DSH);
+	for (int step = 0; step < LIS3DSH_STEPS; step++) {
+		int16_t sample[3];
+		Lis3dshScript(1, step, sample);
+		if (mismatch < 0 && (memcmp(lisReg[step], lis3dsh->reg, sizeof(lisReg[step])) != 0
+				|| memcmp(lisSample[step], sample, sizeof(sample)) != 0))
+			mismatch = step;
+	}
+	if (mismatch >= 0)
+		printf("LIS3DSH: stato diverso dal passo %d\n", mismatch);
+	CHECK(mismatch < 0);
+	CHECK(lis3dshDev[0].commands == lis3dshDev[1].commands);
+
+	for (int op = 0; op < LIS_OPS; op++) {
+		Report(lisOpName[op], SPI_CLOCK_HZ, SPI_BYTE_BITS, lisTransactions[0][op], lisBytes[0][op],
+				lisTransactions[1][op], lisBytes[1][op]);
+		CHECK(lisTransactions[1][op] <= lisTransactions[0][op]);
+		for (int cached = 0; cached < 2; cached++) {
+			total[cached][0] += lisTransactions[cached][op];
+			total[cached][1] += lisBytes[cached][op];
+		}
+	}
+	CHECK(total[0][0] == lis3dshDev[1].transactions && total[1][0] == lis3dshDev[0].transactions);
+	CHECK(lisTransactions[1][LIS_RATE] < lisTransactions[0][LIS_RATE]);
+	CHECK(lisTransactions[1][LIS_SCALE] < lisTransactions[0][LIS_SCALE]);
+	CHECK(lisTransactions[1][LIS_FIFO] < lisTransactions[0][LIS_FIFO]);
+	Report("LIS3DSH", SPI_CLOCK_HZ, SPI_BYTE_BITS, total[0][0], total[0][1], total[1][0], total[1][1]);
+}
+
+int main(void) {
+	TestCache();
+	TestExpander("STMPE811", stmpe811Dev, KIND_STMPE811, STMPE811_CACHED, STMPE811_PLAIN, Stmpe811Script);
+	TestExpander("STMPE1600", stmpe1600Dev, KIND_STMPE1600, STMPE1600_CACHED, STMPE1600_PLAIN, Stmpe1600Script);
+	TestExpander("MFXSTM32L152", mfxDev, KIND_MFX, MFX_CACHED, MFX_PLAIN, MfxScript);
+	TestCodec();
+	TestLis3dsh();
+	printf("regcache_test: %s\n", failures == 0 ? "OK" : "FAILED");
+	return failures != 0;
+}
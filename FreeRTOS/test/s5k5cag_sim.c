@@ -0,0 +1,171 @@
+/**
+ * @file s5k5cag_sim.c
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+/**
+ * @brief Simulazione su host dell'inizializzazione dell'S5K5CAG, con le tabelle compatte e le scritture a burst.
+ *
+ * @details
+ * Le funzioni CAMERA_IO_* sono sostituite da un modello del sensore: registri diretti e memoria ad accesso indiretto,
+ * con la pagina impostata da 0x0028, l'indirizzo da 0x002A e la porta dati 0x0F12 che incrementa l'indirizzo dopo ogni
+ * parola. Il modello conta le transazioni I2C, i byte trasferiti (indirizzo del dispositivo, registro a 16 bit, dati)
+ * e i ritardi richiesti dal driver.
+ *
+ * Per ogni risoluzione sono verificati:
+ *  - il contenuto finale dei registri e della memoria, confrontato con l'impronta FNV-1a ottenuta dal driver originale
+ *    (tabelle {registro, valore} scritte una per transazione);
+ *  - che i burst siano diretti solo alla porta dati e non superino S5K5CAG_BURST_MAX parole;
+ *  - il traffico e il tempo di inizializzazione a 100 kHz, confrontati con quelli del driver originale.
+ * Con -DSIM_NO_BURST il simulatore non definisce CAMERA_IO_WriteMultiple(), come una BSP che fornisce solo
+ * CAMERA_IO_Write(): il driver usa la sua implementazione di default e il risultato deve essere lo stesso.
+ *
+ * I valori del driver originale si riottengono compilando lo stesso simulatore con il sorgente precedente la
+ * conversione (git show f487edc^:FreeRTOS/Utilities/Components/s5k5cag/s5k5cag.c).
+ * @code
+ * gcc -std=gnu99 -O2 -Wall -IUtilities/Components/s5k5cag test/s5k5cag_sim.c \
+ *   Utilities/Components/s5k5cag/s5k5cag.c -o s5k5cag_sim && ./s5k5cag_sim
+ * gcc -std=gnu99 -O2 -Wall -DSIM_NO_BURST -IUtilities/Components/s5k5cag test/s5k5cag_sim.c \
+ *   Utilities/Components/s5k5cag/s5k5cag.c -o s5k5cag_sim && ./s5k5cag_sim
+ * @endcode
+ */
+#include "s5k5cag.h"
+#include <stdio.h>
+#include <string.h>
+
+#define I2C_CLOCK_HZ		100000		//!< SCL della BSP
+#define I2C_BYTE_BITS		9			//!< bit per byte, con l'acknowledge
+#define BURST_MAX			32			//!< S5K5CAG_BURST_MAX del driver
+
+static int failures = 0;
+
+#define CHECK(cond) do { if (!(cond)) { printf("%s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+/**
+ * @brief Modello dell'S5K5CAG visto dal bus I2C.
+ */
+typedef struct {
+	uint16_t reg[65536];		//!< registri diretti
+	uint8_t memory[1 << 20];	//!< memoria ad accesso indiretto
+	uint32_t page;				//!< pagina impostata da 0x0028
+	uint32_t address;			//!< indirizzo impostato da 0x002A
+	unsigned transactions;		//!< transazioni I2C
+	unsigned bytes;				//!< byte trasferiti
+	unsigned delayMs;			//!< ritardi richiesti
+	unsigned badBursts;			//!< burst non diretti alla porta dati o troppo lunghi
+} Sensor_t;
+
+static Sensor_t sensor;
+
+/**
+ * @brief Valori del driver originale per ogni risoluzione.
+ */
+typedef struct {
+	uint32_t resolution;		//!< risoluzione
+	const char* name;			//!< nome della risoluzione
+	uint32_t image;				//!< impronta di registri e memoria
+	unsigned transactions;		//!< transazioni I2C
+	unsigned bytes;				//!< byte trasferiti
+	unsigned delayMs;			//!< ritardi richiesti
+} Reference_t;
+
+static const Reference_t reference[] = {
+	{ CAMERA_R160x120, "QQVGA", 0xc12588e4, 2658, 13290, 2758 },
+	{ CAMERA_R320x240, "QVGA", 0xc8630c25, 2658, 13290, 2758 },
+	{ CAMERA_R480x272, "480x272", 0xfc3db0c4, 2658, 13290, 2758 },
+	{ CAMERA_R640x480, "VGA", 0x81d20627, 2658, 13290, 2758 },
+};
+
+static void SensorWrite(uint16_t reg, uint16_t value) {
+	if (reg == 0x0028)
+		sensor.page = value;
+	else if (reg == 0x002A)
+		sensor.address = value;
+	else if (reg == 0x0F12) {
+		uint32_t a = ((sensor.page & 0xF) << 16) | sensor.address;
+		sensor.memory[a] = value >> 8;
+		sensor.memory[a + 1] = value & 0xFF;
+		sensor.address += 2;
+	}
+	else
+		sensor.reg[reg] = value;
+}
+
+/*
+ * Interfaccia verso la BSP.
+ */
+void CAMERA_IO_Init(void) {
+}
+
+void CAMERA_IO_Write(uint8_t addr, uint16_t reg, uint16_t value) {
+	(void) addr;
+	sensor.transactions++;
+	sensor.bytes += 1 + 2 + 2;
+	SensorWrite(reg, value);
+}
+
+#ifndef SIM_NO_BURST
+void CAMERA_IO_WriteMultiple(uint8_t addr, uint16_t reg, const uint16_t *buffer, uint16_t length) {
+	(void) addr;
+	if (reg != 0x0F12 || length > BURST_MAX)
+		sensor.badBursts++;
+	sensor.transactions++;
+	sensor.bytes += 1 + 2 + 2 * length;
+	for (uint16_t i = 0; i < length; i++)
+		SensorWrite(reg, buffer[i]);
+}
+#endif
+
+uint16_t CAMERA_IO_Read(uint8_t addr, uint16_t reg) {
+	(void) addr;
+	return sensor.reg[reg];
+}
+
+void CAMERA_Delay(uint32_t delay) {
+	sensor.delayMs += delay;
+}
+
+static uint32_t Fingerprint(void) {
+	uint32_t h = 2166136261u;
+	for (size_t i = 0; i < sizeof(sensor.memory); i++)
+		h = (h ^ sensor.memory[i]) * 16777619u;
+	for (size_t i = 0; i < 65536; i++) {
+		h = (h ^ (sensor.reg[i] & 0xFF)) * 16777619u;
+		h = (h ^ (sensor.reg[i] >> 8)) * 16777619u;
+	}
+	return h;
+}
+
+static double InitMs(unsigned bytes, unsigned delayMs) {
+	return delayMs + 1e3 * I2C_BYTE_BITS * bytes / I2C_CLOCK_HZ;
+}
+
+int main(void) {
+	for (unsigned r = 0; r < sizeof(reference) / sizeof(reference[0]); r++) {
+		const Reference_t* ref = &reference[r];
+		memset(&sensor, 0, sizeof(sensor));
+		s5k5cag_Init(0x5A, ref->resolution);
+		uint32_t image = Fingerprint();
+		printf("%-8s: immagine %08x, %4u -> %4u transazioni, %5u -> %5u byte, %6.0f -> %6.0f ms a %u Hz\n", ref->name,
+				image, ref->transactions, sensor.transactions, ref->bytes, sensor.bytes,
+				InitMs(ref->bytes, ref->delayMs), InitMs(sensor.bytes, sensor.delayMs), I2C_CLOCK_HZ);
+		CHECK(image == ref->image);
+		CHECK(sensor.badBursts == 0);
+		CHECK(sensor.transactions <= ref->transactions);
+	}
+	printf("s5k5cag_sim: %s\n", failures == 0 ? "OK" : "FAILED");
+	return failures != 0;
+}
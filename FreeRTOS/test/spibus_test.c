@@ -0,0 +1,421 @@
+/**
+ * @file spibus_test.c
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+/**
+ * @brief Verifica su host del bus SPI dell'accelerometro della BSP Discovery, con una periferica SPI simulata.
+ *
+ * @details
+ * stm32f4_discovery.c e' compilato in questo file, con SPI1, gli stream DMA e RCC sostituiti da registri simulati e
+ * le funzioni HAL sostituite da stub che contano le chiamate. Il percorso veloce di SPIx_Transfer() accede
+ * direttamente ai registri SPI: la pagina che li contiene e' protetta e ogni accesso viene intercettato (SIGSEGV),
+ * eseguito in single step e completato dal modello della periferica (SIGTRAP), che scambia il byte con un modello del
+ * LIS3DSH. I trasferimenti DMA sono eseguiti dal modello all'abilitazione delle richieste in SPI_CR2.
+ *
+ * Per BSP_ACCELERO_GetXYZ() e per la lettura a burst della FIFO (percorso DMA) sono riportati le chiamate HAL, i byte
+ * e il tempo di bus simulato, confrontati con la BSP originale, che eseguiva una HAL_SPI_TransmitReceive() per ogni
+ * byte; i valori letti sono confrontati con quelli del modello.<br>
+ * Richiede Linux x86-64: gli indirizzi passati al DMA sono a 32 bit, per cui l'eseguibile non e' position
+ * independent e la pagina dei registri e' allocata nei primi 4 GB.
+ * @code
+ * F=.; gcc -std=gnu99 -O2 -Wall -no-pie -DSTM32F407xx -DUSE_HAL_DRIVER -I$F/HAL_Driver/Inc -I$F/CMSIS/device \
+ *   -I$F/CMSIS/core -I$F/Utilities/STM32F4-Discovery test/spibus_test.c \
+ *   Utilities/STM32F4-Discovery/stm32f4_discovery_accelerometer.c Utilities/Components/lis3dsh/lis3dsh.c \
+ *   Utilities/Components/lis302dl/lis302dl.c Utilities/Components/Common/regcache.c -o spibus_test && ./spibus_test
+ * @endcode
+ */
+#define _GNU_SOURCE
+#include <signal.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <ucontext.h>
+#include "stm32f4_discovery.h"
+#include "stm32f4_discovery_accelerometer.h"
+
+#if defined(__x86_64__) && defined(__linux__)
+
+#define SPI_CLOCK_HZ		5250000		//!< SCK della BSP: APB2 a 84 MHz, prescaler 16
+#define FIFO_SAMPLES		20			//!< campioni letti dalla FIFO, oltre la soglia del DMA
+#define LEGACY_CS			7			//!< cicli di chip select per campione della lettura originale
+#define LEGACY_BYTES		14			//!< byte per campione della lettura originale
+#define TRAP_FLAG			0x100		//!< EFLAGS.TF, single step
+
+static int failures = 0;
+
+#define CHECK(cond) do { if (!(cond)) { printf("%s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+/*
+ * Registri simulati, sostituiti a quelli del microcontrollore prima di compilare la BSP.
+ */
+static uint8_t* mockRegs;					//!< pagina protetta con i registri SPI
+static RCC_TypeDef mockRcc;
+static DMA_Stream_TypeDef mockDmaRx, mockDmaTx;
+
+#undef SPI1
+#define SPI1			((SPI_TypeDef*) mockRegs)
+#undef RCC
+#define RCC				(&mockRcc)
+#undef DMA2_Stream0
+#define DMA2_Stream0	(&mockDmaRx)
+#undef DMA2_Stream3
+#define DMA2_Stream3	(&mockDmaTx)
+
+#include "stm32f4_discovery.c"
+
+/**
+ * @brief Contatori del bus.
+ */
+static struct {
+	unsigned hal;			//!< chiamate HAL
+	unsigned cs;			//!< cicli di chip select
+	unsigned bytes;			//!< byte scambiati
+	unsigned dmaBytes;		//!< byte scambiati dal DMA
+	unsigned regAccess;		//!< accessi ai registri SPI
+} bus;
+
+/**
+ * @brief Modello del LIS3DSH: registri da 7 bit, incremento automatico con IF_ADD_INC e, con la FIFO abilitata,
+ * ritorno da OUT_Z_H a OUT_X_L con il campione successivo.
+ */
+static struct {
+	uint8_t reg[128];
+	uint8_t selected;		//!< chip select basso
+	uint8_t first;			//!< 1 se il prossimo byte e' l'indirizzo
+	uint8_t read;			//!< ciclo di lettura
+	uint8_t addr;			//!< indirizzo corrente
+	int16_t fifo[32][3];	//!< campioni in FIFO
+	unsigned fifoCount;		//!< campioni in FIFO
+} acc;
+
+/**
+ * @brief Carica nei registri di uscita il campione in testa alla FIFO.
+ */
+static void AccLoad(const int16_t* s) {
+	for (int i = 0; i < 3; i++) {
+		acc.reg[LIS3DSH_OUT_X_L_ADDR + 2 * i] = (uint8_t) s[i];
+		acc.reg[LIS3DSH_OUT_X_L_ADDR + 2 * i + 1] = (uint8_t) ((uint16_t) s[i] >> 8);
+	}
+	acc.reg[LIS3DSH_FIFO_SRC_ADDR] = acc.fifoCount == 0 ? LIS3DSH_FIFO_SRC_EMPTY : (uint8_t) (acc.fifoCount - 1);
+}
+
+/**
+ * @brief Scambia un byte con il LIS3DSH.
+ */
+static uint8_t AccExchange(uint8_t tx) {
+	bus.bytes++;
+	if (!acc.selected) {
+		failures++;		// byte trasmesso con il chip select alto
+		return 0xFF;
+	}
+	if (acc.first) {
+		acc.first = 0;
+		acc.read = (tx & 0x80) != 0;
+		acc.addr = tx & 0x7F;
+		return 0xFF;
+	}
+	uint8_t rx = 0xFF;
+	if (acc.read)
+		rx = acc.reg[acc.addr];
+	else
+		acc.reg[acc.addr] = tx;
+	if (acc.reg[LIS3DSH_CTRL_REG6_ADDR] & LIS3DSH_ADD_INC)
+		acc.addr = (acc.addr + 1) & 0x7F;
+	if (acc.read && acc.addr == LIS3DSH_OUT_Z_H_ADDR + 1 && (acc.reg[LIS3DSH_CTRL_REG6_ADDR] & LIS3DSH_FIFO_ENABLE)) {
+		acc.addr = LIS3DSH_OUT_X_L_ADDR;
+		if (acc.fifoCount > 0) {
+			memmove(acc.fifo[0], acc.fifo[1], sizeof(acc.fifo[0]) * --acc.fifoCount);
+			AccLoad(acc.fifo[0]);
+		}
+	}
+	return rx;
+}
+
+/*
+ * Modello della periferica SPI: ogni accesso ai registri provoca un SIGSEGV, l'istruzione viene eseguita in single
+ * step con la pagina accessibile e, al SIGTRAP, il modello aggiorna i registri.
+ */
+static size_t pendingOffset;
+static uint8_t pendingWrite;
+
+/**
+ * @brief Effetto di un accesso ai registri SPI, dopo la sua esecuzione.
+ */
+static void SpiAccess(size_t offset, uint8_t write) {
+	SPI_TypeDef* spi = (SPI_TypeDef*) mockRegs;
+	bus.regAccess++;
+	if (offset == offsetof(SPI_TypeDef, DR)) {
+		if (write) {
+			spi->DR = AccExchange((uint8_t) spi->DR);
+			spi->SR |= SPI_SR_RXNE;
+		}
+		else
+			spi->SR &= ~SPI_SR_RXNE;
+	}
+	else if (offset == offsetof(SPI_TypeDef, CR2) && write && (spi->CR2 & SPI_CR2_TXDMAEN)) {
+		// il DMA trasmette solo se le richieste di ricezione sono gia' abilitate: nessun byte ricevuto viene perso
+		CHECK(spi->CR2 & SPI_CR2_RXDMAEN);
+		uint8_t* src = (uint8_t*) (uintptr_t) mockDmaTx.M0AR;
+		uint8_t* dst = (uint8_t*) (uintptr_t) mockDmaRx.M0AR;
+		CHECK(mockDmaTx.PAR == (uint32_t) (uintptr_t) &spi->DR && mockDmaRx.PAR == mockDmaTx.PAR);
+		CHECK(mockDmaTx.NDTR == mockDmaRx.NDTR);
+		for (uint32_t i = 0; i < mockDmaTx.NDTR; i++) {
+			uint8_t rx = AccExchange(src[(mockDmaTx.CR & DMA_SxCR_MINC) ? i : 0]);
+			dst[(mockDmaRx.CR & DMA_SxCR_MINC) ? i : 0] = rx;
+			bus.dmaBytes++;
+		}
+		mockDmaTx.NDTR = mockDmaRx.NDTR = 0;
+	}
+}
+
+static void OnSegv(int sig, siginfo_t* si, void* ctx) {
+	ucontext_t* uc = (ucontext_t*) ctx;
+	uint8_t* addr = (uint8_t*) si->si_addr;
+	if (addr < mockRegs || addr >= mockRegs + 4096) {
+		signal(sig, SIG_DFL);	// accesso non simulato: il fault si ripete e termina il programma
+		return;
+	}
+	pendingOffset = addr - mockRegs;
+	pendingWrite = (uc->uc_mcontext.gregs[REG_ERR] & 2) != 0;
+	mprotect(mockRegs, 4096, PROT_READ | PROT_WRITE);
+	uc->uc_mcontext.gregs[REG_EFL] |= TRAP_FLAG;
+}
+
+static void OnTrap(int sig, siginfo_t* si, void* ctx) {
+	ucontext_t* uc = (ucontext_t*) ctx;
+	(void) sig; (void) si;
+	uc->uc_mcontext.gregs[REG_EFL] &= ~TRAP_FLAG;
+	SpiAccess(pendingOffset, pendingWrite);
+	mprotect(mockRegs, 4096, PROT_NONE);
+}
+
+/*
+ * Stub della libreria HAL.
+ */
+HAL_StatusTypeDef HAL_SPI_Init(SPI_HandleTypeDef* hspi) {
+	bus.hal++;
+	hspi->State = HAL_SPI_STATE_READY;
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_SPI_DeInit(SPI_HandleTypeDef* hspi) {
+	bus.hal++;
+	hspi->State = HAL_SPI_STATE_RESET;
+	return HAL_OK;
+}
+
+HAL_SPI_StateTypeDef HAL_SPI_GetState(SPI_HandleTypeDef* hspi) {
+	bus.hal++;
+	return hspi->State;
+}
+
+HAL_StatusTypeDef HAL_DMA_Init(DMA_HandleTypeDef* hdma) {
+	bus.hal++;
+	hdma->Instance->CR = (hdma->Init.MemInc == DMA_MINC_ENABLE) ? DMA_SxCR_MINC : 0;
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DMA_Start(DMA_HandleTypeDef* hdma, uint32_t SrcAddress, uint32_t DstAddress, uint32_t DataLength) {
+	bus.hal++;
+	hdma->Instance->NDTR = DataLength;
+	if (hdma->Init.Direction == DMA_PERIPH_TO_MEMORY) {
+		hdma->Instance->PAR = SrcAddress;
+		hdma->Instance->M0AR = DstAddress;
+	}
+	else {
+		hdma->Instance->PAR = DstAddress;
+		hdma->Instance->M0AR = SrcAddress;
+	}
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DMA_PollForTransfer(DMA_HandleTypeDef* hdma, uint32_t CompleteLevel, uint32_t Timeout) {
+	(void) CompleteLevel; (void) Timeout;
+	bus.hal++;
+	return hdma->Instance->NDTR == 0 ? HAL_OK : HAL_TIMEOUT;
+}
+
+void HAL_GPIO_Init(GPIO_TypeDef* GPIOx, GPIO_InitTypeDef* GPIO_Init) {
+	(void) GPIOx; (void) GPIO_Init;
+	bus.hal++;
+}
+
+void HAL_GPIO_WritePin(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState) {
+	bus.hal++;
+	if (GPIOx != ACCELERO_CS_GPIO_PORT || GPIO_Pin != ACCELERO_CS_PIN)
+		return;
+	if (PinState == GPIO_PIN_RESET) {
+		acc.selected = 1;
+		acc.first = 1;
+		bus.cs++;
+	}
+	else
+		acc.selected = 0;
+}
+
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin) {
+	(void) GPIOx; (void) GPIO_Pin;
+	bus.hal++;
+	return GPIO_PIN_RESET;
+}
+
+void HAL_GPIO_TogglePin(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin) {
+	(void) GPIOx; (void) GPIO_Pin;
+	bus.hal++;
+}
+
+void HAL_NVIC_SetPriority(IRQn_Type IRQn, uint32_t PreemptPriority, uint32_t SubPriority) {
+	(void) IRQn; (void) PreemptPriority; (void) SubPriority;
+	bus.hal++;
+}
+
+void HAL_NVIC_EnableIRQ(IRQn_Type IRQn) {
+	(void) IRQn;
+	bus.hal++;
+}
+
+void HAL_Delay(uint32_t Delay) {
+	(void) Delay;
+	bus.hal++;
+}
+
+/* Bus I2C del codec audio, non usato dall'accelerometro */
+HAL_StatusTypeDef HAL_I2C_Init(I2C_HandleTypeDef* hi2c) {
+	(void) hi2c;
+	return HAL_ERROR;
+}
+
+HAL_StatusTypeDef HAL_I2C_DeInit(I2C_HandleTypeDef* hi2c) {
+	(void) hi2c;
+	return HAL_ERROR;
+}
+
+HAL_StatusTypeDef HAL_I2C_Mem_Write(I2C_HandleTypeDef* hi2c, uint16_t DevAddress, uint16_t MemAddress,
+		uint16_t MemAddSize, uint8_t* pData, uint16_t Size, uint32_t Timeout) {
+	(void) hi2c; (void) DevAddress; (void) MemAddress; (void) MemAddSize; (void) pData; (void) Size; (void) Timeout;
+	return HAL_ERROR;
+}
+
+HAL_StatusTypeDef HAL_I2C_Mem_Read(I2C_HandleTypeDef* hi2c, uint16_t DevAddress, uint16_t MemAddress,
+		uint16_t MemAddSize, uint8_t* pData, uint16_t Size, uint32_t Timeout) {
+	(void) hi2c; (void) DevAddress; (void) MemAddress; (void) MemAddSize; (void) pData; (void) Size; (void) Timeout;
+	return HAL_ERROR;
+}
+
+HAL_I2C_StateTypeDef HAL_I2C_GetState(I2C_HandleTypeDef* hi2c) {
+	(void) hi2c;
+	return HAL_I2C_STATE_RESET;
+}
+
+/**
+ * @brief Azzera i contatori del bus.
+ */
+static void BusReset(void) {
+	memset(&bus, 0, sizeof(bus));
+}
+
+/**
+ * @brief Stampa i contatori per un'operazione, confrontati con quelli della BSP originale.
+ * @param legacyBytes byte e legacyCs cicli di chip select dell'operazione con la BSP originale, che eseguiva una
+ * HAL_SPI_TransmitReceive() per byte e due HAL_GPIO_WritePin() per ciclo
+ */
+static void BusPrint(const char* name, unsigned legacyBytes, unsigned legacyCs) {
+	printf("%s: %u chiamate HAL, %u cicli CS, %u byte (%u via DMA), %.1f us di bus; "
+			"BSP originale: %u chiamate HAL, %.1f us\n", name, bus.hal, bus.cs, bus.bytes, bus.dmaBytes,
+			8e6 * bus.bytes / SPI_CLOCK_HZ, legacyBytes + 2 * legacyCs, 8e6 * legacyBytes / SPI_CLOCK_HZ);
+}
+
+/**
+ * @brief Lettura di un campione con BSP_ACCELERO_GetXYZ(), percorso a registri.
+ */
+static void TestGetXYZ(void) {
+	static const int16_t sample[3] = { 1000, -2000, 16000 };
+	int16_t xyz[3];
+
+	CHECK(BSP_ACCELERO_Init() == ACCELERO_OK);
+	CHECK(acc.reg[LIS3DSH_CTRL_REG6_ADDR] & LIS3DSH_ADD_INC);
+	AccLoad(sample);
+
+	BusReset();
+	BSP_ACCELERO_GetXYZ(xyz);
+	for (int i = 0; i < 3; i++) {
+		int32_t mg = sample[i] * 6 / 100;	// 0.06 mg/digit, fondo scala 2 g
+		CHECK(xyz[i] - mg <= 1 && mg - xyz[i] <= 1);
+	}
+	CHECK(bus.cs == 1 && bus.bytes == 7 && bus.dmaBytes == 0);
+	CHECK(bus.hal == 2);	// solo il chip select
+	BusPrint("BSP_ACCELERO_GetXYZ", LEGACY_BYTES, LEGACY_CS);
+}
+
+/**
+ * @brief Lettura a burst della FIFO, percorso DMA.
+ */
+static void TestFIFO(void) {
+	static int16_t data[FIFO_SAMPLES * 3];	// nei primi 4 GB: l'indirizzo e' passato al DMA a 32 bit
+
+	CHECK(BSP_ACCELERO_FIFO_Start(FIFO_SAMPLES) == ACCELERO_OK);
+	CHECK(acc.reg[LIS3DSH_CTRL_REG6_ADDR] & LIS3DSH_FIFO_ENABLE);
+	acc.fifoCount = FIFO_SAMPLES;
+	for (int s = 0; s < FIFO_SAMPLES; s++)
+		for (int i = 0; i < 3; i++)
+			acc.fifo[s][i] = (int16_t) ((s + 1) * 100 * (i + 1) * (i == 1 ? -1 : 1));
+	AccLoad(acc.fifo[0]);
+	int16_t expected[FIFO_SAMPLES][3];
+	memcpy(expected, acc.fifo, sizeof(expected));
+
+	BusReset();
+	CHECK(BSP_ACCELERO_FIFO_Read(data, FIFO_SAMPLES) == FIFO_SAMPLES);
+	CHECK(bus.dmaBytes == 6 * FIFO_SAMPLES);
+	for (int s = 0; s < FIFO_SAMPLES; s++)
+		for (int i = 0; i < 3; i++) {
+			int32_t mg = expected[s][i] * 6 / 100;
+			CHECK(data[3 * s + i] - mg <= 1 && mg - data[3 * s + i] <= 1);
+		}
+	// originale: FIFO_SRC e i sei registri di uscita di ogni campione letti uno alla volta
+	BusPrint("BSP_ACCELERO_FIFO_Read", 2 + LEGACY_BYTES * FIFO_SAMPLES, 1 + LEGACY_CS * FIFO_SAMPLES);
+}
+
+int main(void) {
+	mockRegs = mmap(NULL, 4096, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_32BIT, -1, 0);
+	CHECK(mockRegs != MAP_FAILED);
+	if (mockRegs == MAP_FAILED)
+		return 1;
+	struct sigaction sa;
+	memset(&sa, 0, sizeof(sa));
+	sa.sa_flags = SA_SIGINFO;
+	sa.sa_sigaction = OnSegv;
+	sigaction(SIGSEGV, &sa, NULL);
+	sa.sa_sigaction = OnTrap;
+	sigaction(SIGTRAP, &sa, NULL);
+
+	acc.reg[LIS3DSH_WHO_AM_I_ADDR] = I_AM_LIS3DSH;
+	TestGetXYZ();
+	TestFIFO();
+	CHECK(bus.regAccess > 0);
+	printf("spibus_test: %s\n", failures == 0 ? "OK" : "FAILED");
+	return failures != 0;
+}
+
+#else
+
+int main(void) {
+	printf("spibus_test: richiede Linux x86-64\n");
+	return 0;
+}
+
+#endif
@@ -0,0 +1,192 @@
+/**
+ * @file sched.h
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef SCHED_H_
+#define SCHED_H_
+
+/**
+ * @defgroup SCHED
+ * @{
+ *
+ * @brief Scheduler event-driven con gestione della modalita' a basso consumo.
+ *
+ * @details
+ * Il modulo sostituisce il classico main loop che esegue in polling (o resta in attesa attiva) con uno scheduler di
+ * task run-to-completion. Ciascun task viene eseguito quando:
+ *  - una ISR ha segnalato un evento per quel task, con SCHED_Post();
+ *  - e' scaduto il timer del task, periodico (SCHED_AddTimer()) oppure one-shot (SCHED_Defer()).
+ *
+ * Quando non ci sono task da eseguire, lo scheduler sceglie lo stato di riposo:
+ *  - sleep (WFI), se il prossimo timer scade entro SCHED_STOP_MIN_MS o l'applicazione non consente lo stop;
+ *  - stop, altrimenti: SysTick viene sospeso e il tempo trascorso viene misurato dal port e recuperato al risveglio
+ *    (timekeeping tickless), per cui i timer continuano a scadere correttamente.
+ *
+ * Il risveglio avviene per una qualsiasi interruzione (EXTI, I2C, SysTick in sleep, wakeup timer in stop).<br>
+ * Lo scheduler misura la residenza nei tre stati (esecuzione, sleep, stop), consultabile con SCHED_GetResidency().<br>
+ * Il nucleo dello scheduler non dipende dalla libreria HAL: tutte le operazioni dipendenti dall'hardware sono fornite
+ * tramite la struttura SCHED_Port_t. Il port per STM32F3/F4 e' ottenuto con SCHED_PortInit(); sostituendo il port con
+ * uno simulato, lo scheduler puo' essere eseguito su un host Linux riproducendo una sequenza di interruzioni.
+ */
+
+#include <inttypes.h>
+
+#ifndef SCHED_MAX_TASK
+#define SCHED_MAX_TASK		8			//!< Numero massimo di task (al piu' 32)
+#endif
+
+#ifndef SCHED_STOP_MIN_MS
+#define SCHED_STOP_MIN_MS	5			//!< Durata minima del riposo per cui conviene entrare in stop
+#endif
+
+#define SCHED_FOREVER		0xFFFFFFFF	//!< Nessun timer armato
+
+/**
+ * @brief Funzione che implementa un task.
+ */
+typedef void (*SCHED_Task_t)(void);
+
+/**
+ * @brief Operazioni dipendenti dalla piattaforma.
+ */
+typedef struct {
+	uint32_t (*now)(void);				//!< tempo corrente, in millisecondi
+	void (*disableIrq)(void);			//!< disabilita le interruzioni
+	void (*enableIrq)(void);			//!< riabilita le interruzioni
+	void (*sleep)(void);				//!< entra in sleep; chiamata a interruzioni disabilitate, ritorna alla prima pendente
+	/**
+	 * @brief Entra in stop per al piu' ms millisecondi (SCHED_FOREVER: fino alla prima interruzione esterna).
+	 * Chiamata a interruzioni disabilitate; restituisce il tempo trascorso in stop, gia' recuperato nel tempo corrente.
+	 */
+	uint32_t (*stop)(uint32_t ms);
+} SCHED_Port_t;
+
+/**
+ * @brief Conversione in millisecondi del tempo trascorso in stop, usata dal port.
+ * @details Il port misura lo stop con un contatore a bassa frequenza (l'RTC): la parte inferiore al millisecondo viene
+ * conservata e sommata allo stop successivo, per cui l'errore di uwTick non cresce con il numero di stop.
+ */
+typedef struct {
+	uint32_t hz;			//!< frequenza del contatore
+	uint32_t wrap;			//!< periodo del contatore, in conteggi
+	uint32_t residue;		//!< tempo non ancora convertito, in unita' di 1 / hz microsecondi
+} SCHED_StopClock_t;
+
+/**
+ * @brief Struttura che rappresenta lo scheduler.
+ */
+typedef struct {
+	const SCHED_Port_t* port;				//!< operazioni dipendenti dalla piattaforma
+	SCHED_Task_t task[SCHED_MAX_TASK];		//!< task registrati
+	uint32_t period[SCHED_MAX_TASK];		//!< periodo dei timer, 0 per i timer one-shot
+	uint32_t deadline[SCHED_MAX_TASK];		//!< scadenza del timer di ciascun task
+	uint32_t armed;							//!< maschera dei task con timer armato
+	volatile uint32_t pending;				//!< maschera dei task con un evento segnalato da ISR
+	uint8_t nTask;							//!< numero di task registrati
+	int (*canStop)(void);					//!< funzione dell'applicazione che consente lo stop (opzionale)
+	uint32_t runMs;							//!< tempo trascorso in esecuzione, fino all'ultimo riposo
+	uint32_t sleepMs;						//!< tempo trascorso in sleep
+	uint32_t stopMs;						//!< tempo trascorso in stop
+	uint32_t idleEnd;						//!< fine dell'ultimo riposo (o inizializzazione)
+	uint32_t wakeups;						//!< numero di risvegli
+} SCHED_t;
+
+/**
+ * @brief Inizializza lo scheduler.
+ * @param[out] s puntatore allo scheduler
+ * @param[in] port operazioni dipendenti dalla piattaforma
+ * @param[in] canStop funzione che restituisce 0 se, in questo momento, la modalita' stop non e' consentita (ad esempio
+ * 				durante un trasferimento su bus); NULL se lo stop e' sempre consentito
+ */
+void SCHED_Init(SCHED_t* s, const SCHED_Port_t* port, int (*canStop)(void));
+
+/**
+ * @brief Registra un task attivato da eventi.
+ * @param[inout] s puntatore allo scheduler
+ * @param[in] task funzione del task
+ * @return identificativo del task, da usare con SCHED_Post() e SCHED_Defer()
+ */
+uint8_t SCHED_AddTask(SCHED_t* s, SCHED_Task_t task);
+
+/**
+ * @brief Registra un task periodico.
+ * @param[inout] s puntatore allo scheduler
+ * @param[in] task funzione del task
+ * @param[in] periodMs periodo, in millisecondi
+ * @return identificativo del task
+ */
+uint8_t SCHED_AddTimer(SCHED_t* s, SCHED_Task_t task, uint32_t periodMs);
+
+/**
+ * @brief Segnala un evento per un task. Puo' essere chiamata da una ISR.
+ * @param[inout] s puntatore allo scheduler
+ * @param[in] id identificativo del task
+ */
+void SCHED_Post(SCHED_t* s, uint8_t id);
+
+/**
+ * @brief Programma l'esecuzione di un task dopo delayMs millisecondi. Deve essere chiamata dal contesto dei task.
+ * @param[inout] s puntatore allo scheduler
+ * @param[in] id identificativo del task
+ * @param[in] delayMs ritardo, in millisecondi
+ */
+void SCHED_Defer(SCHED_t* s, uint8_t id, uint32_t delayMs);
+
+/**
+ * @brief Esegue i task pronti e, se non ce ne sono altri, mette il processore a riposo fino al successivo evento.
+ * @details E' pensata per essere l'unico contenuto del main loop.
+ * @param[inout] s puntatore allo scheduler
+ */
+void SCHED_Run(SCHED_t* s);
+
+/**
+ * @brief Restituisce la residenza nei tre stati, in millesimi del tempo trascorso dall'inizializzazione.
+ * @details Il tempo che non e' trascorso in sleep o in stop e' attribuito all'esecuzione: la somma dei tre stati e'
+ * sempre pari al tempo trascorso.
+ * @param[in] s puntatore allo scheduler
+ * @param[out] run millesimi del tempo in esecuzione
+ * @param[out] sleep millesimi del tempo in sleep
+ * @param[out] stop millesimi del tempo in stop
+ */
+void SCHED_GetResidency(const SCHED_t* s, uint16_t* run, uint16_t* sleep, uint16_t* stop);
+
+/**
+ * @brief Converte in millisecondi il tempo trascorso in stop, con il resto del calcolo precedente.
+ * @param[inout] c stato della conversione
+ * @param[in] before valore del contatore all'ingresso in stop
+ * @param[in] after valore del contatore al risveglio
+ * @param[in] lostUs tempo, in microsecondi, che il contatore dei tick non contera' piu' (ad esempio la frazione di
+ * 				millisecondo gia' trascorsa quando SysTick viene riavviato dalla riconfigurazione del clock)
+ * @return millisecondi da sommare al contatore dei tick
+ */
+uint32_t SCHED_StopElapsed(SCHED_StopClock_t* c, uint32_t before, uint32_t after, uint32_t lostUs);
+
+/**
+ * @brief Port dello scheduler per STM32F3/F4.
+ * @details Configura l'RTC, cloccato da LSI, come base dei tempi durante lo stop e come sorgente di risveglio (wakeup timer).
+ * @param[in] clockRestore funzione che riconfigura il system clock al risveglio dallo stop, che riparte su HSI;
+ * 				NULL se l'applicazione usa gia' HSI
+ * @return port da passare a SCHED_Init()
+ */
+const SCHED_Port_t* SCHED_PortInit(void (*clockRestore)(void));
+
+/**
+ * @}
+ */
+
+#endif /* SCHED_H_ */
@@ -35,6 +35,12 @@
  */
 
 #include "myBSP.h"
+#include "sched.h"
+
+/**
+ * @brief Scheduler del main loop.
+ */
+static SCHED_t sched;
 			
 /**
  * @brief Funzione di inizializzazione.
@@ -47,7 +53,8 @@ void init();
 /**
  * @brief Funzione che implementa la logica del programma.
  *
- * @details Il dispositivo resta in attesa della pressione del Push Button.
+ * @details Il dispositivo resta in stop, in attesa della pressione del Push Button.<br>
+ * 			L'interruzione EXTI risveglia il processore, che serve l'interruzione e torna in stop.
  */
 void loop();
 
@@ -63,10 +70,12 @@ void init(){
 	for(int i=0;i<N_LED;i++)
 		myBSP_LED_Init(i);
 	myBSP_BUTTON_Init(myBUTTON,myBUTTON_MODE_EXTI);
+	SCHED_Init(&sched, SCHED_PortInit(NULL), NULL);
 }
 
 void loop(){
 	// In attesa dell'evento di pressione di User Button
+	SCHED_Run(&sched);
 }
 
 /**
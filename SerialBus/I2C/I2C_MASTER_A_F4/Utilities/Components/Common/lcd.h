@@ -84,6 +84,17 @@ typedef struct
   uint16_t (*GetLcdPixelHeight)(void);
   void     (*DrawBitmap)(uint16_t, uint16_t, uint8_t*);
   void     (*DrawRGBImage)(uint16_t, uint16_t, uint16_t, uint16_t, uint8_t*);
+  
+  /* Bulk operations (optional, NULL when not supported by the driver):
+     one address window per rectangle and pixel data streamed in blocks
+     through LCD_IO_WriteMultipleData. The IO layer may move a block with
+     DMA, but it must return only when the transfer is complete: drivers
+     refill their block buffer for the next call, and the caller may reuse
+     the source pixels as soon as the operation returns */
+  void     (*FillRect)(uint16_t, uint16_t, uint16_t, uint16_t, uint16_t);
+  void     (*BlitRect)(uint16_t, uint16_t, uint16_t, uint16_t, const uint16_t*, uint16_t);
+  void     (*WriteWindow)(uint16_t, uint16_t, uint16_t, uint16_t);
+  void     (*WritePixels)(const uint16_t*, uint32_t);
 }LCD_DrvTypeDef;    
 /**
   * @}
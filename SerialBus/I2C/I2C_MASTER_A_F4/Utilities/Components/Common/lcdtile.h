@@ -0,0 +1,168 @@
+/**
+ * @file lcdtile.h
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+#ifndef LCDTILE_H_
+#define LCDTILE_H_
+
+/**
+ * @addtogroup BSP
+ * @{
+ * @addtogroup Components
+ * @{
+ * @defgroup LCDTILE
+ * @{
+ *
+ * @brief Composizione in un back buffer RGB565 con aggiornamento dei soli tile modificati.
+ *
+ * @details
+ * Ridisegnare un elemento dell'interfaccia direttamente sul display, attraverso LCD_DrvTypeDef, costa un trasferimento
+ * sul bus per ogni pixel disegnato, anche quando lo stesso pixel viene ridisegnato piu' volte (sfondo, riquadro,
+ * testo). Il modulo disegna invece in un back buffer in RAM, grande quanto il display, suddiviso in tile quadrati di
+ * LCDTILE_SIZE pixel di lato: ogni operazione di disegno marca come modificati i tile che tocca. LCDTILE_Flush()
+ * invia al display soltanto i tile modificati, unendo i tile adiacenti in rettangoli, ciascuno con un'unica finestra
+ * di indirizzi e un unico trasferimento a blocchi (LCD_DrvTypeDef::BlitRect).
+ *
+ * Il back buffer e' fornito dall'applicazione: 240x240 pixel occupano 112.5 KB, 320x240 pixel 150 KB. Puo' risiedere
+ * nella SRAM interna, nella memoria esterna collegata all'FSMC o, se il display e' abbastanza piccolo, nella CCM
+ * (64 KB); la CCM pero' non e' raggiungibile dal DMA, per cui non va usata se il livello di IO del display trasferisce
+ * i pixel con il DMA.<br>
+ * Il modulo non dipende dalla libreria HAL, per cui puo' essere compilato e verificato anche su un host.
+ */
+
+#include <inttypes.h>
+#include "lcd.h"
+
+#ifndef LCDTILE_SHIFT
+#define LCDTILE_SHIFT		4							//!< log2 del lato di un tile, in pixel
+#endif
+
+#define LCDTILE_SIZE		(1U << LCDTILE_SHIFT)		//!< lato di un tile, in pixel
+
+#ifndef LCDTILE_MAX_TILES
+#define LCDTILE_MAX_TILES	320							//!< tile gestiti, 320 per un display 320x240 a tile di 16
+#endif
+
+#if LCDTILE_SHIFT < 2 || LCDTILE_SHIFT > 7
+#error "LCDTILE_SHIFT deve essere compreso tra 2 e 7"
+#endif
+
+/**
+ * @brief Contatori del traffico verso il display.
+ */
+typedef struct {
+	uint32_t flushes;	//!< chiamate di LCDTILE_Flush() con almeno un tile da inviare
+	uint32_t tiles;		//!< tile inviati
+	uint32_t rects;		//!< rettangoli inviati, ciascuno con la propria finestra di indirizzi
+	uint32_t pixels;	//!< pixel inviati
+} LCDTILE_Stats_t;
+
+/**
+ * @brief Struttura che rappresenta il back buffer e lo stato dei suoi tile.
+ */
+typedef struct {
+	LCD_DrvTypeDef* drv;							//!< driver del display
+	uint16_t* buffer;								//!< back buffer, width * height pixel, riga per riga
+	uint16_t width;									//!< larghezza del display, in pixel
+	uint16_t height;								//!< altezza del display, in pixel
+	uint16_t tilesX;								//!< tile per riga
+	uint16_t tilesY;								//!< righe di tile
+	uint32_t dirty[(LCDTILE_MAX_TILES + 31) / 32];	//!< bit ty * tilesX + tx: il tile (tx, ty) e' da inviare
+	LCDTILE_Stats_t stats;							//!< contatori
+} LCDTILE_t;
+
+/**
+ * @brief Inizializza il compositore; il contenuto del back buffer non viene modificato e nessun tile e' da inviare.
+ * @param[out] t puntatore al compositore
+ * @param[in] drv driver del display; se non fornisce BlitRect i pixel sono inviati uno alla volta con WritePixel
+ * @param[in] buffer back buffer di width * height pixel
+ * @param[in] width larghezza del display, in pixel
+ * @param[in] height altezza del display, in pixel
+ */
+void LCDTILE_Init(LCDTILE_t* t, LCD_DrvTypeDef* drv, uint16_t* buffer, uint16_t width, uint16_t height);
+
+/**
+ * @brief Marca come modificati i tile che intersecano un rettangolo, ritagliato sul display.
+ * @details Va chiamata dopo aver disegnato direttamente nel back buffer.
+ * @param[inout] t puntatore al compositore
+ * @param[in] x ascissa dello spigolo in alto a sinistra
+ * @param[in] y ordinata dello spigolo in alto a sinistra
+ * @param[in] w larghezza
+ * @param[in] h altezza
+ */
+void LCDTILE_Invalidate(LCDTILE_t* t, uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+
+/**
+ * @brief Marca come modificati tutti i tile, per esempio dopo l'inizializzazione del display.
+ * @param[inout] t puntatore al compositore
+ */
+void LCDTILE_InvalidateAll(LCDTILE_t* t);
+
+/**
+ * @brief Riempie un rettangolo del back buffer con un colore.
+ * @param[inout] t puntatore al compositore
+ * @param[in] x ascissa dello spigolo in alto a sinistra
+ * @param[in] y ordinata dello spigolo in alto a sinistra
+ * @param[in] w larghezza
+ * @param[in] h altezza
+ * @param[in] color colore RGB565
+ */
+void LCDTILE_FillRect(LCDTILE_t* t, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color);
+
+/**
+ * @brief Copia un blocco di pixel in un rettangolo del back buffer.
+ * @param[inout] t puntatore al compositore
+ * @param[in] x ascissa dello spigolo in alto a sinistra
+ * @param[in] y ordinata dello spigolo in alto a sinistra
+ * @param[in] w larghezza
+ * @param[in] h altezza
+ * @param[in] src pixel RGB565, riga per riga
+ * @param[in] pitch distanza, in pixel, tra due righe di src
+ */
+void LCDTILE_BlitRect(LCDTILE_t* t, uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint16_t* src,
+		uint16_t pitch);
+
+/**
+ * @brief Fonde un blocco di pixel con un rettangolo del back buffer, con un alpha costante.
+ * @param[inout] t puntatore al compositore
+ * @param[in] x ascissa dello spigolo in alto a sinistra
+ * @param[in] y ordinata dello spigolo in alto a sinistra
+ * @param[in] w larghezza
+ * @param[in] h altezza
+ * @param[in] src pixel RGB565, riga per riga
+ * @param[in] pitch distanza, in pixel, tra due righe di src
+ * @param[in] alpha opacita' di src, da 0 (trasparente) a 255 (opaco)
+ */
+void LCDTILE_BlendRect(LCDTILE_t* t, uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint16_t* src,
+		uint16_t pitch, uint8_t alpha);
+
+/**
+ * @brief Invia al display i tile modificati e li marca come aggiornati.
+ * @details I tile modificati adiacenti di una riga formano un rettangolo, esteso verso il basso finche' le righe di
+ * tile successive sono modificate per tutta la sua larghezza.
+ * @param[inout] t puntatore al compositore
+ * @return numero di pixel inviati
+ */
+uint32_t LCDTILE_Flush(LCDTILE_t* t);
+
+/**
+ * @}
+ * @}
+ * @}
+ */
+
+#endif /* LCDTILE_H_ */
@@ -0,0 +1,163 @@
+/**
+ * @file regcache.c
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+#include "regcache.h"
+#include <assert.h>
+#include <string.h>
+
+#define REGCACHE_BIT(n)		((uint64_t)1 << (n))
+
+/**
+ * @brief Restituisce 1 se il registro e' nella finestra, calcolandone la posizione.
+ */
+static uint8_t REGCACHE_Index(const REGCACHE_t* c, uint8_t reg, uint8_t* n) {
+	*n = (uint8_t)(reg - c->base);
+	return *n < c->count;
+}
+
+void REGCACHE_Init(REGCACHE_t* c, uint8_t base, uint8_t count) {
+	assert(c);
+	assert(count <= REGCACHE_MAX_REGS);
+	memset(c, 0, sizeof(REGCACHE_t));
+	c->base = base;
+	c->count = count;
+}
+
+void REGCACHE_Cacheable(REGCACHE_t* c, uint8_t first, uint8_t last) {
+	assert(c);
+	assert(first <= last && (uint8_t)(first - c->base) < c->count && (uint8_t)(last - c->base) < c->count);
+	for (uint8_t n = first - c->base; n <= (uint8_t)(last - c->base); n++)
+		c->cacheable |= REGCACHE_BIT(n);
+}
+
+void REGCACHE_Invalidate(REGCACHE_t* c) {
+	assert(c);
+	c->valid = 0;
+	c->dirty = 0;
+}
+
+uint8_t REGCACHE_Read(REGCACHE_t* c, uint8_t reg, uint8_t* value) {
+	assert(c && value);
+	uint8_t n;
+	if (REGCACHE_Index(c, reg, &n) && (c->cacheable & (c->valid | c->dirty) & REGCACHE_BIT(n))) {
+		/* una scrittura accumulata e' il valore che il registro avra' */
+		*value = (c->dirty & REGCACHE_BIT(n)) ? c->staged[n] : c->value[n];
+		c->stats.readHits++;
+		return 1;
+	}
+	c->stats.readMisses++;
+	return 0;
+}
+
+void REGCACHE_Fill(REGCACHE_t* c, uint8_t reg, uint8_t value) {
+	assert(c);
+	uint8_t n;
+	/* una scrittura accumulata e' piu' recente del valore letto */
+	if (REGCACHE_Index(c, reg, &n) && (c->cacheable & ~c->dirty & REGCACHE_BIT(n))) {
+		c->value[n] = value;
+		c->valid |= REGCACHE_BIT(n);
+	}
+}
+
+uint8_t REGCACHE_Write(REGCACHE_t* c, uint8_t reg, uint8_t value) {
+	assert(c);
+	uint8_t n;
+	if (REGCACHE_Index(c, reg, &n)) {
+		uint64_t bit = REGCACHE_BIT(n);
+		c->dirty &= ~bit;
+		if (c->cacheable & bit) {
+			if ((c->valid & bit) && c->value[n] == value) {
+				c->stats.writesSkipped++;
+				return 0;
+			}
+			c->value[n] = value;
+			c->valid |= bit;
+		}
+		c->staged[n] = value;
+	}
+	c->stats.writes++;
+	return 1;
+}
+
+void REGCACHE_Stage(REGCACHE_t* c, uint8_t reg, uint8_t value) {
+	assert(c);
+	assert((uint8_t)(reg - c->base) < c->count);
+	uint8_t n = (uint8_t)(reg - c->base);
+	uint64_t bit = REGCACHE_BIT(n);
+	/* il confronto e' con il valore nel dispositivo, non con una scrittura gia' accumulata */
+	if ((c->cacheable & c->valid & bit) && c->value[n] == value) {
+		if (c->dirty & bit)
+			c->dirty &= ~bit;
+		else
+			c->stats.writesSkipped++;
+		return;
+	}
+	c->staged[n] = value;
+	c->dirty |= bit;
+}
+
+uint8_t REGCACHE_NextRun(REGCACHE_t* c, uint8_t* reg, uint8_t bridge, uint8_t maxLength) {
+	assert(c && reg);
+	assert(maxLength > 0);
+	if (c->dirty == 0)
+		return 0;
+	uint8_t first = 0, last, n;
+	while (!(c->dirty & REGCACHE_BIT(first)))
+		first++;
+	/* la sequenza si estende sui registri da scrivere e sui brevi intervalli di registri noti */
+	last = first;
+	for (n = first + 1; n < c->count && n - first < maxLength; n++) {
+		uint64_t bit = REGCACHE_BIT(n);
+		if (c->dirty & bit)
+			last = n;
+		else if (!(c->cacheable & c->valid & bit) || n - last > bridge)
+			break;
+	}
+	/* i registri non modificati della sequenza sono riscritti con il valore che hanno gia' */
+	for (n = first; n <= last; n++) {
+		uint64_t bit = REGCACHE_BIT(n);
+		if (!(c->dirty & bit))
+			c->staged[n] = c->value[n];
+		c->dirty &= ~bit;
+	}
+	*reg = c->base + first;
+	c->stats.runs++;
+	c->stats.writes += last - first + 1;
+	return last - first + 1;
+}
+
+void REGCACHE_Complete(REGCACHE_t* c, uint8_t reg, uint8_t length, uint8_t status) {
+	assert(c);
+	assert(length > 0 && (uint8_t)(reg - c->base) < c->count && (uint8_t)(reg - c->base) + length <= c->count);
+	for (uint8_t n = (uint8_t)(reg - c->base); length > 0; n++, length--) {
+		uint64_t bit = REGCACHE_BIT(n);
+		if (status == 0 && (c->cacheable & bit)) {
+			c->value[n] = c->staged[n];
+			c->valid |= bit;
+		}
+		else
+			/* dopo un errore il contenuto del registro non e' noto */
+			c->valid &= ~bit;
+	}
+}
+
+uint8_t* REGCACHE_Data(REGCACHE_t* c, uint8_t reg) {
+	assert(c);
+	assert((uint8_t)(reg - c->base) < c->count);
+	return &c->staged[(uint8_t)(reg - c->base)];
+}
@@ -37,6 +37,7 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "cs43l22.h"
+#include "../Common/regcache.h"
 
 /** @addtogroup BSP
   * @{
@@ -55,7 +56,14 @@
 /** @defgroup CS43L22_Private_Types
   * @{
   */
-
+/**
+  * @brief  One entry of a register sequence: register address and value.
+  */
+typedef struct
+{
+  uint8_t Reg;
+  uint8_t Value;
+} CS43L22_RegValue_t;
 /**
   * @}
   */ 
@@ -69,6 +77,17 @@
 #if !defined (VERIFY_WRITTENDATA)  
 /* #define VERIFY_WRITTENDATA */
 #endif /* VERIFY_WRITTENDATA */
+
+/* Unchanged registers that may be rewritten to join two runs of pending 
+   registers in a single auto-increment transaction: a new transaction costs 
+   a START, the device address, the MAP byte and a STOP, so bridging one or 
+   two known registers is cheaper than splitting the run */
+#if !defined (CS43L22_BRIDGE_MAX)
+#define CS43L22_BRIDGE_MAX        2
+#endif /* CS43L22_BRIDGE_MAX */
+
+/* Longest auto-increment transaction sent by CODEC_IO_Flush() */
+#define CS43L22_BURST_MAX         (CS43L22_REG_MAX + 1)
 /**
   * @}
   */ 
@@ -108,6 +127,56 @@ static uint8_t Is_cs43l22_Stop = 1;
 
 volatile uint8_t OutputDev = 0;
 
+/* Shadow copy of the codec registers. A register is written to the codec only 
+   when its staged value differs from the one known to be in the device: the 
+   power, mute and volume sequences rewrite many registers with the values 
+   they already hold */
+static REGCACHE_t Cs43l22Cache;
+
+/* Configuration written by cs43l22_Init() while the codec is powered off, in 
+   ascending register order. Besides reducing the time needed for the Codec to 
+   power off (see cs43l22_Init()), it restates the headphone volume reset 
+   value (0 dB), so that the master volume and the speaker volume registers 
+   (0x1F to 0x25) are sent in a single transaction */
+static const CS43L22_RegValue_t cs43l22_InitTable[] =
+{
+  {CS43L22_REG_CLOCKING_CTL,      0x81},            /* Clock configuration: Auto detection */
+  {CS43L22_REG_INTERFACE_CTL1,    CODEC_STANDARD},  /* Slave Mode and audio Standard */
+  {CS43L22_REG_ANALOG_ZC_SR_SETT, 0x00},            /* Disable the analog soft ramp */
+  {CS43L22_REG_MISC_CTL,          0x04},            /* Disable the digital soft ramp */
+  {CS43L22_REG_PCMA_VOL,          0x0A},            /* Adjust PCM volume level */
+  {CS43L22_REG_PCMB_VOL,          0x0A},
+  {CS43L22_REG_TONE_CTL,          0x0F},            /* Adjust Bass and Treble levels */
+  {CS43L22_REG_HEADPHONE_A_VOL,   0x00},            /* Headphone volume: reset value */
+  {CS43L22_REG_HEADPHONE_B_VOL,   0x00},
+  {CS43L22_REG_LIMIT_CTL1,        0x00},            /* Disable the limiter attack level */
+};
+
+/* Speaker Mono mode and attenuation level, written by cs43l22_Init() when the 
+   Speaker is enabled */
+static const CS43L22_RegValue_t cs43l22_SpeakerTable[] =
+{
+  {CS43L22_REG_PLAYBACK_CTL2,     0x06},
+  {CS43L22_REG_SPEAKER_A_VOL,     0x00},
+  {CS43L22_REG_SPEAKER_B_VOL,     0x00},
+};
+
+/* Output muting: outputs off, headphone volume to the minimum */
+static const CS43L22_RegValue_t cs43l22_MuteTable[] =
+{
+  {CS43L22_REG_POWER_CTL2,        0xFF},
+  {CS43L22_REG_HEADPHONE_A_VOL,   0x01},
+  {CS43L22_REG_HEADPHONE_B_VOL,   0x01},
+};
+
+/* Output unmuting: headphone volume back to 0 dB; the outputs are restored 
+   from OutputDev */
+static const CS43L22_RegValue_t cs43l22_UnmuteTable[] =
+{
+  {CS43L22_REG_HEADPHONE_A_VOL,   0x00},
+  {CS43L22_REG_HEADPHONE_B_VOL,   0x00},
+};
+
 /**
   * @}
   */ 
@@ -116,6 +185,10 @@ volatile uint8_t OutputDev = 0;
   * @{
   */
 static uint8_t CODEC_IO_Write(uint8_t Addr, uint8_t Reg, uint8_t Value);
+static void    CODEC_IO_Stage(uint8_t Reg, uint8_t Value);
+static void    CODEC_IO_StageTable(const CS43L22_RegValue_t *Table, uint32_t Count);
+static uint8_t CODEC_IO_Flush(uint8_t Addr);
+static void    CODEC_IO_Invalidate(void);
 /**
   * @}
   */ 
@@ -138,6 +211,9 @@ uint32_t cs43l22_Init(uint16_t DeviceAddr, uint16_t OutputDevice, uint8_t Volume
   
   /* Initialize the Control interface of the Audio Codec */
   AUDIO_IO_Init();     
+  
+  /* The codec has just been reset: the shadow registers are no longer valid */
+  CODEC_IO_Invalidate();
     
   /* Keep Codec powered OFF */
   counter += CODEC_IO_Write(DeviceAddr, CS43L22_REG_POWER_CTL1, 0x01);  
@@ -166,27 +242,9 @@ uint32_t cs43l22_Init(uint16_t DeviceAddr, uint16_t OutputDevice, uint8_t Volume
     break;    
   }
   
-  counter += CODEC_IO_Write(DeviceAddr, CS43L22_REG_POWER_CTL2, OutputDev);
-  
-  /* Clock configuration: Auto detection */  
-  counter += CODEC_IO_Write(DeviceAddr, CS43L22_REG_CLOCKING_CTL, 0x81);
-  
-  /* Set the Slave Mode and the audio Standard */  
-  counter += CODEC_IO_Write(DeviceAddr, CS43L22_REG_INTERFACE_CTL1, CODEC_STANDARD);
-  
-  /* Set the Master volume */
-  counter += cs43l22_SetVolume(DeviceAddr, Volume);
-  
-  /* If the Speaker is enabled, set the Mono mode and volume attenuation level */
-  if(OutputDevice != OUTPUT_DEVICE_HEADPHONE)
-  {
-    /* Set the Speaker Mono mode */  
-    counter += CODEC_IO_Write(DeviceAddr, CS43L22_REG_PLAYBACK_CTL2, 0x06);
-    
-    /* Set the Speaker attenuation level */  
-    counter += CODEC_IO_Write(DeviceAddr, CS43L22_REG_SPEAKER_A_VOL, 0x00);
-    counter += CODEC_IO_Write(DeviceAddr, CS43L22_REG_SPEAKER_B_VOL, 0x00);
-  }
+  /* The codec is powered off: the configuration registers are staged and 
+  then sent together, in ascending order, as few auto-increment runs */
+  CODEC_IO_Stage(CS43L22_REG_POWER_CTL2, OutputDev);
   
   /* Additional configuration for the CODEC. These configurations are done to reduce
   the time needed for the Codec to power off. If these configurations are removed, 
@@ -194,18 +252,16 @@ uint32_t cs43l22_Init(uint16_t DeviceAddr, uint16_t OutputDevice, uint8_t Volume
   off the I2S peripheral MCLK clock (which is the operating clock for Codec).
   If this delay is not inserted, then the codec will not shut down properly and
   it results in high noise after shut down. */
+  CODEC_IO_StageTable(cs43l22_InitTable, sizeof(cs43l22_InitTable) / sizeof(cs43l22_InitTable[0]));
   
-  /* Disable the analog soft ramp */
-  counter += CODEC_IO_Write(DeviceAddr, CS43L22_REG_ANALOG_ZC_SR_SETT, 0x00);
-  /* Disable the digital soft ramp */
-  counter += CODEC_IO_Write(DeviceAddr, CS43L22_REG_MISC_CTL, 0x04);
-  /* Disable the limiter attack level */
-  counter += CODEC_IO_Write(DeviceAddr, CS43L22_REG_LIMIT_CTL1, 0x00);
-  /* Adjust Bass and Treble levels */
-  counter += CODEC_IO_Write(DeviceAddr, CS43L22_REG_TONE_CTL, 0x0F);
-  /* Adjust PCM volume level */
-  counter += CODEC_IO_Write(DeviceAddr, CS43L22_REG_PCMA_VOL, 0x0A);
-  counter += CODEC_IO_Write(DeviceAddr, CS43L22_REG_PCMB_VOL, 0x0A);
+  /* If the Speaker is enabled, set the Mono mode and volume attenuation level */
+  if(OutputDevice != OUTPUT_DEVICE_HEADPHONE)
+  {
+    CODEC_IO_StageTable(cs43l22_SpeakerTable, sizeof(cs43l22_SpeakerTable) / sizeof(cs43l22_SpeakerTable[0]));
+  }
+  
+  /* Set the Master volume, sent with the rest of the configuration */
+  counter += cs43l22_SetVolume(DeviceAddr, Volume);
   
   /* Return communication control value */
   return counter;  
@@ -232,6 +288,7 @@ uint32_t cs43l22_ReadID(uint16_t DeviceAddr)
   uint8_t Value;
   /* Initialize the Control interface of the Audio Codec */
   AUDIO_IO_Init(); 
+  CODEC_IO_Invalidate();
   
   Value = AUDIO_IO_Read(DeviceAddr, CS43L22_CHIPID_ADDR);
   Value = (Value & CS43L22_ID_MASK);
@@ -252,9 +309,9 @@ uint32_t cs43l22_Play(uint16_t DeviceAddr, uint16_t* pBuffer, uint16_t Size)
   if(Is_cs43l22_Stop == 1)
   {
     /* Enable the digital soft ramp */
-    counter += CODEC_IO_Write(DeviceAddr, CS43L22_REG_MISC_CTL, 0x06);
+    CODEC_IO_Stage(CS43L22_REG_MISC_CTL, 0x06);
   
-    /* Enable Output device */  
+    /* Enable Output device, sent together with the soft ramp */  
     counter += cs43l22_SetMute(DeviceAddr, AUDIO_MUTE_OFF);
     
     /* Power on the Codec */
@@ -322,11 +379,11 @@ uint32_t cs43l22_Stop(uint16_t DeviceAddr, uint32_t CodecPdwnMode)
 {
   uint32_t counter = 0;
   
-  /* Mute the output first */
-  counter += cs43l22_SetMute(DeviceAddr, AUDIO_MUTE_ON);
-
   /* Disable the digital soft ramp */
-  counter += CODEC_IO_Write(DeviceAddr, CS43L22_REG_MISC_CTL, 0x04);
+  CODEC_IO_Stage(CS43L22_REG_MISC_CTL, 0x04);
+  
+  /* Mute the output first, sent together with the soft ramp */
+  counter += cs43l22_SetMute(DeviceAddr, AUDIO_MUTE_ON);
   
   /* Power down the DAC and the speaker (PMDAC and PMSPK bits)*/
   counter += CODEC_IO_Write(DeviceAddr, CS43L22_REG_POWER_CTL1, 0x9F);
@@ -350,16 +407,20 @@ uint32_t cs43l22_SetVolume(uint16_t DeviceAddr, uint8_t Volume)
   if(Volume > 0xE6)
   {
     /* Set the Master volume */
-    counter += CODEC_IO_Write(DeviceAddr, CS43L22_REG_MASTER_A_VOL, convertedvol - 0xE7); 
-    counter += CODEC_IO_Write(DeviceAddr, CS43L22_REG_MASTER_B_VOL, convertedvol - 0xE7);     
+    CODEC_IO_Stage(CS43L22_REG_MASTER_A_VOL, convertedvol - 0xE7); 
+    CODEC_IO_Stage(CS43L22_REG_MASTER_B_VOL, convertedvol - 0xE7);     
   }
   else
   {
     /* Set the Master volume */
-    counter += CODEC_IO_Write(DeviceAddr, CS43L22_REG_MASTER_A_VOL, convertedvol + 0x19); 
-    counter += CODEC_IO_Write(DeviceAddr, CS43L22_REG_MASTER_B_VOL, convertedvol + 0x19); 
+    CODEC_IO_Stage(CS43L22_REG_MASTER_A_VOL, convertedvol + 0x19); 
+    CODEC_IO_Stage(CS43L22_REG_MASTER_B_VOL, convertedvol + 0x19); 
   }
 
+  /* Both channels in one transaction; nothing is sent during a volume ramp 
+  step that does not change the register value */
+  counter += CODEC_IO_Flush(DeviceAddr);
+
   return counter;
 }
 
@@ -388,16 +449,15 @@ uint32_t cs43l22_SetMute(uint16_t DeviceAddr, uint32_t Cmd)
   /* Set the Mute mode */
   if(Cmd == AUDIO_MUTE_ON)
   {
-    counter += CODEC_IO_Write(DeviceAddr, CS43L22_REG_POWER_CTL2, 0xFF);
-    counter += CODEC_IO_Write(DeviceAddr, CS43L22_REG_HEADPHONE_A_VOL, 0x01);
-    counter += CODEC_IO_Write(DeviceAddr, CS43L22_REG_HEADPHONE_B_VOL, 0x01);
+    CODEC_IO_StageTable(cs43l22_MuteTable, sizeof(cs43l22_MuteTable) / sizeof(cs43l22_MuteTable[0]));
   }
   else /* AUDIO_MUTE_OFF Disable the Mute */
   {
-    counter += CODEC_IO_Write(DeviceAddr, CS43L22_REG_HEADPHONE_A_VOL, 0x00);
-    counter += CODEC_IO_Write(DeviceAddr, CS43L22_REG_HEADPHONE_B_VOL, 0x00);
-    counter += CODEC_IO_Write(DeviceAddr, CS43L22_REG_POWER_CTL2, OutputDev);
+    CODEC_IO_StageTable(cs43l22_UnmuteTable, sizeof(cs43l22_UnmuteTable) / sizeof(cs43l22_UnmuteTable[0]));
+    CODEC_IO_Stage(CS43L22_REG_POWER_CTL2, OutputDev);
   }
+  /* Registers staged by the caller (e.g. the soft ramp) are sent as well */
+  counter += CODEC_IO_Flush(DeviceAddr);
   return counter;
 }
 
@@ -463,18 +523,110 @@ uint32_t cs43l22_Reset(uint16_t DeviceAddr)
   */
 static uint8_t CODEC_IO_Write(uint8_t Addr, uint8_t Reg, uint8_t Value)
 {
-  uint32_t result = 0;
+  /* Registers staged before this one are sent first, to keep the order */
+  CODEC_IO_Stage(Reg, Value);
+  return CODEC_IO_Flush(Addr);
+}
+
+/**
+  * @brief  Stages a register value, to be sent by the next CODEC_IO_Flush().
+  * @note   Nothing is sent if the value is already in the device, as last 
+  *         confirmed by CODEC_IO_Flush(). Staging the same register twice 
+  *         keeps the last value only.
+  * @param  Reg: Reg address 
+  * @param  Value: Data to be written
+  */
+static void CODEC_IO_Stage(uint8_t Reg, uint8_t Value)
+{
+  REGCACHE_Stage(&Cs43l22Cache, Reg, Value);
+}
+
+/**
+  * @brief  Stages a register sequence.
+  * @param  Table: Register sequence
+  * @param  Count: Number of entries
+  */
+static void CODEC_IO_StageTable(const CS43L22_RegValue_t *Table, uint32_t Count)
+{
+  uint32_t index = 0;
   
-  AUDIO_IO_Write(Addr, Reg, Value);
+  for(index = 0; index < Count; index++)
+  {
+    CODEC_IO_Stage(Table[index].Reg, Table[index].Value);
+  }
+}
+
+/**
+  * @brief  Sends the staged registers, in ascending order.
+  * @note   Consecutive registers are sent in a single transaction using the 
+  *         codec auto-increment (MAP INCR bit); unchanged registers whose value 
+  *         is known are rewritten to join two runs when the gap is at most 
+  *         CS43L22_BRIDGE_MAX registers.
+  * @param  Addr: I2C address
+  * @retval 0 if correct communication, else wrong communication
+  */
+static uint8_t CODEC_IO_Flush(uint8_t Addr)
+{
+  uint8_t result = 0;
+  uint8_t first = 0, length = 0;
+  uint8_t status = 0;
+  uint8_t *values;
+#ifdef VERIFY_WRITTENDATA
+  uint8_t index = 0;
+#endif /* VERIFY_WRITTENDATA */
   
+  while((length = REGCACHE_NextRun(&Cs43l22Cache, &first, CS43L22_BRIDGE_MAX, CS43L22_BURST_MAX)) != 0)
+  {
+    values = REGCACHE_Data(&Cs43l22Cache, first);
+    if(length == 1)
+    {
+      status = AUDIO_IO_Write(Addr, first, values[0]);
+    }
+    else
+    {
+      status = AUDIO_IO_WriteMultiple(Addr, first | CS43L22_MAP_INCR, values, length);
+    }
+    
 #ifdef VERIFY_WRITTENDATA
-  /* Verify that the data has been correctly written */  
-  result = (AUDIO_IO_Read(Addr, Reg) == Value)? 0:1;
+    /* Verify that the data has been correctly written */  
+    for(index = 0; index < length; index++)
+    {
+      if(AUDIO_IO_Read(Addr, first + index) != values[index])
+      {
+        status = 1;
+      }
+    }
 #endif /* VERIFY_WRITTENDATA */
+    
+    /* The values become known only if the transaction succeeded: after an 
+       error they are sent again by the next write of the same registers */
+    REGCACHE_Complete(&Cs43l22Cache, first, length, status);
+    if(status != 0)
+    {
+      result = 1;
+    }
+  }
   
   return result;
 }
 
+/**
+  * @brief  Forgets the register values known to be in the device.
+  * @note   To be called after every codec reset (AUDIO_IO_Init()). The 
+  *         read-only status registers are never cached.
+  */
+static void CODEC_IO_Invalidate(void)
+{
+  if(Cs43l22Cache.count == 0)
+  {
+    REGCACHE_Init(&Cs43l22Cache, 0, CS43L22_REG_MAX + 1);
+    REGCACHE_Cacheable(&Cs43l22Cache, CS43L22_REG_POWER_CTL1, CS43L22_REG_LIMIT_ATTACK_RATE);
+    REGCACHE_Cacheable(&Cs43l22Cache, CS43L22_REG_BATT_COMPENSATION, CS43L22_REG_BATT_COMPENSATION);
+    REGCACHE_Cacheable(&Cs43l22Cache, CS43L22_REG_TEMPMONITOR_CTL, CS43L22_REG_CHARGE_PUMP_FREQ);
+  }
+  REGCACHE_Invalidate(&Cs43l22Cache);
+}
+
 /**
   * @}
   */
@@ -38,6 +38,7 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "lis3dsh.h"
+#include "../Common/regcache.h"
 
 /** @addtogroup BSP
   * @{
@@ -80,6 +81,22 @@
 /** @defgroup LIS3DSH_Private_Variables
   * @{
   */
+/* Sensitivity of the current full scale, in Q16 mg/digit: kept in sync by
+   LIS3DSH_Init and LIS3DSH_FullScaleCmd, so that LIS3DSH_ReadACC does not
+   read CTRL_REG5 back for every sample */
+static int32_t Lis3dshSensitivity = LIS3DSH_SENSITIVITY_Q16_0_06G;
+
+/* Set once IF_ADD_INC is known to be enabled: a reboot restores the default
+   register values, so LIS3DSH_RebootCmd clears it */
+static uint8_t Lis3dshAddrInc = 0;
+
+/* Copy of the control registers, read-modified-written by most of the 
+   commands: CTRL_REG4, CTRL_REG5, CTRL_REG6 and FIFO_CTRL are only changed by 
+   the driver (BOOT, the only self-clearing bit used, invalidates the copy). 
+   CTRL_REG1 to CTRL_REG3, in between, are volatile: CTRL_REG3 holds the 
+   self-clearing soft reset bit (STRT) */
+static REGCACHE_t Lis3dshCache;
+
 ACCELERO_DrvTypeDef Lis3dshDrv =
 {
   LIS3DSH_Init,
@@ -104,6 +121,11 @@ ACCELERO_DrvTypeDef Lis3dshDrv =
 /** @defgroup LIS3DSH_Private_FunctionPrototypes
   * @{
   */
+static int32_t LIS3DSH_Sensitivity(uint8_t ctrl5);
+static int16_t LIS3DSH_Scale(int16_t raw);
+static void    LIS3DSH_AddrIncCmd(void);
+static void    LIS3DSH_ReadReg(uint8_t Reg, uint8_t *pValue);
+static void    LIS3DSH_WriteReg(uint8_t Reg, uint8_t Value);
   
 /**
   * @}
@@ -124,18 +146,32 @@ void LIS3DSH_Init(uint16_t InitStruct)
   
   /* Configure the low level interface */
   ACCELERO_IO_Init();
+  
+  /* The register values left by a previous configuration are not known */
+  if(Lis3dshCache.count == 0)
+  {
+    REGCACHE_Init(&Lis3dshCache, LIS3DSH_CTRL_REG4_ADDR, LIS3DSH_FIFO_CTRL_ADDR - LIS3DSH_CTRL_REG4_ADDR + 1);
+    REGCACHE_Cacheable(&Lis3dshCache, LIS3DSH_CTRL_REG4_ADDR, LIS3DSH_CTRL_REG4_ADDR);
+    REGCACHE_Cacheable(&Lis3dshCache, LIS3DSH_CTRL_REG5_ADDR, LIS3DSH_CTRL_REG6_ADDR);
+    REGCACHE_Cacheable(&Lis3dshCache, LIS3DSH_FIFO_CTRL_ADDR, LIS3DSH_FIFO_CTRL_ADDR);
+  }
+  REGCACHE_Invalidate(&Lis3dshCache);
 
   /* Configure MEMS: power mode(ODR) and axes enable */
   ctrl = (uint8_t) (InitStruct);
   
   /* Write value to MEMS CTRL_REG4 register */
-  ACCELERO_IO_Write(&ctrl, LIS3DSH_CTRL_REG4_ADDR, 1);
+  LIS3DSH_WriteReg(LIS3DSH_CTRL_REG4_ADDR, ctrl);
   
   /* Configure MEMS: full scale and self test */
   ctrl = (uint8_t) (InitStruct >> 8);
   
   /* Write value to MEMS CTRL_REG5 register */
-  ACCELERO_IO_Write(&ctrl, LIS3DSH_CTRL_REG5_ADDR, 1);
+  LIS3DSH_WriteReg(LIS3DSH_CTRL_REG5_ADDR, ctrl);
+  Lis3dshSensitivity = LIS3DSH_Sensitivity(ctrl);
+
+  /* Enable the register address auto-increment used by the burst reads */
+  LIS3DSH_AddrIncCmd();
 }
 
 /**
@@ -161,7 +197,7 @@ uint8_t LIS3DSH_ReadID(void)
   ACCELERO_IO_Init();
 
   /* Read WHO_AM_I register */
-  ACCELERO_IO_Read(&tmp, LIS3DSH_WHO_AM_I_ADDR, 1);
+  LIS3DSH_ReadReg(LIS3DSH_WHO_AM_I_ADDR, &tmp);
   
   /* Return the ID */
   return (uint16_t)tmp;
@@ -183,21 +219,21 @@ void LIS3DSH_InterruptConfig(LIS3DSH_InterruptConfigTypeDef *LIS3DSH_IntConfigSt
                    LIS3DSH_IntConfigStruct->Interrupt_Signal);
   
   /* Write value to MEMS CTRL_REG3 register */
-  ACCELERO_IO_Write(&ctrl, LIS3DSH_CTRL_REG3_ADDR, 1);
+  LIS3DSH_WriteReg(LIS3DSH_CTRL_REG3_ADDR, ctrl);
   
   /* Configure State Machine 1 */                   
   ctrl = (uint8_t)(LIS3DSH_IntConfigStruct->State_Machine1_Enable | \
                    LIS3DSH_IntConfigStruct->State_Machine1_Interrupt);
   
   /* Write value to MEMS CTRL_REG1 register */
-  ACCELERO_IO_Write(&ctrl, LIS3DSH_CTRL_REG1_ADDR, 1);
+  LIS3DSH_WriteReg(LIS3DSH_CTRL_REG1_ADDR, ctrl);
   
   /* Configure State Machine 2 */                   
   ctrl = (uint8_t)(LIS3DSH_IntConfigStruct->State_Machine2_Enable | \
                    LIS3DSH_IntConfigStruct->State_Machine2_Interrupt);
   
   /* Write value to MEMS CTRL_REG2 register */
-  ACCELERO_IO_Write(&ctrl, LIS3DSH_CTRL_REG2_ADDR, 1);
+  LIS3DSH_WriteReg(LIS3DSH_CTRL_REG2_ADDR, ctrl);
 }
 
 /**
@@ -223,28 +259,28 @@ void LIS3DSH_Click_IntConfig(void)
     
   /* Set LIS3DSH State Machines configuration */
   ctrl=0x03; 
-  ACCELERO_IO_Write(&ctrl, LIS3DSH_TIM2_1_L_ADDR,1);
+  LIS3DSH_WriteReg(LIS3DSH_TIM2_1_L_ADDR, ctrl);
   ctrl=0xC8; 
-  ACCELERO_IO_Write(&ctrl, LIS3DSH_TIM1_1_L_ADDR,1);
+  LIS3DSH_WriteReg(LIS3DSH_TIM1_1_L_ADDR, ctrl);
   ctrl=0x45; 
-  ACCELERO_IO_Write(&ctrl, LIS3DSH_THRS2_1_ADDR,1);
+  LIS3DSH_WriteReg(LIS3DSH_THRS2_1_ADDR, ctrl);
   ctrl=0xFC; 
-  ACCELERO_IO_Write(&ctrl, LIS3DSH_MASK1_A_ADDR,1);
+  LIS3DSH_WriteReg(LIS3DSH_MASK1_A_ADDR, ctrl);
   ctrl=0xA1; 
-  ACCELERO_IO_Write(&ctrl, LIS3DSH_SETT1_ADDR,1);
+  LIS3DSH_WriteReg(LIS3DSH_SETT1_ADDR, ctrl);
   ctrl=0x01; 
-  ACCELERO_IO_Write(&ctrl, LIS3DSH_PR1_ADDR,1);
+  LIS3DSH_WriteReg(LIS3DSH_PR1_ADDR, ctrl);
 
-  ACCELERO_IO_Write(&ctrl, LIS3DSH_SETT2_ADDR,1);
+  LIS3DSH_WriteReg(LIS3DSH_SETT2_ADDR, ctrl);
   
   /* Configure State Machine 2 to detect single click */
-  ACCELERO_IO_Write(&ctrl, LIS3DSH_ST2_1_ADDR,1);
+  LIS3DSH_WriteReg(LIS3DSH_ST2_1_ADDR, ctrl);
   ctrl=0x06; 
-  ACCELERO_IO_Write(&ctrl, LIS3DSH_ST2_2_ADDR,1);
+  LIS3DSH_WriteReg(LIS3DSH_ST2_2_ADDR, ctrl);
   ctrl=0x28; 
-  ACCELERO_IO_Write(&ctrl, LIS3DSH_ST2_3_ADDR,1);
+  LIS3DSH_WriteReg(LIS3DSH_ST2_3_ADDR, ctrl);
   ctrl=0x11; 
-  ACCELERO_IO_Write(&ctrl, LIS3DSH_ST2_4_ADDR,1);
+  LIS3DSH_WriteReg(LIS3DSH_ST2_4_ADDR, ctrl);
 }
 
 /**
@@ -268,14 +304,14 @@ void LIS3DSH_ODR_LowpowerCmd(uint8_t ODR_LowPowerMode)
   uint8_t tmpreg;
   
   /* Read CTRL_REG4 register */
-  ACCELERO_IO_Read(&tmpreg, LIS3DSH_CTRL_REG4_ADDR, 1);
+  LIS3DSH_ReadReg(LIS3DSH_CTRL_REG4_ADDR, &tmpreg);
   
   /* Set new low power mode configuration */
-  tmpreg &= (uint8_t)~LIS3DSH_DATARATE_100;
+  tmpreg &= (uint8_t)~LIS3DSH__DATARATE_SELECTION;
   tmpreg |= ODR_LowPowerMode;
   
   /* Write value to MEMS CTRL_REG4 register */
-  ACCELERO_IO_Write(&tmpreg, LIS3DSH_CTRL_REG4_ADDR, 1);
+  LIS3DSH_WriteReg(LIS3DSH_CTRL_REG4_ADDR, tmpreg);
 }
 
 /**
@@ -298,14 +334,14 @@ void LIS3DSH_DataRateCmd(uint8_t DataRateValue)
   uint8_t tmpreg;
   
   /* Read CTRL_REG4 register */
-  ACCELERO_IO_Read(&tmpreg, LIS3DSH_CTRL_REG4_ADDR, 1);
+  LIS3DSH_ReadReg(LIS3DSH_CTRL_REG4_ADDR, &tmpreg);
   
-  /* Set new data rate configuration from 100 to 400Hz */
-  tmpreg &= (uint8_t)~LIS3DSH_DATARATE_400; 
+  /* Set new data rate configuration */
+  tmpreg &= (uint8_t)~LIS3DSH__DATARATE_SELECTION; 
   tmpreg |= DataRateValue;
   
   /* Write value to MEMS CTRL_REG4 register */
-  ACCELERO_IO_Write(&tmpreg, LIS3DSH_CTRL_REG4_ADDR, 1);
+  LIS3DSH_WriteReg(LIS3DSH_CTRL_REG4_ADDR, tmpreg);
 }
 
 /**
@@ -324,14 +360,15 @@ void LIS3DSH_FullScaleCmd(uint8_t FS_value)
   uint8_t tmpreg;
   
   /* Read CTRL_REG5 register */
-  ACCELERO_IO_Read(&tmpreg, LIS3DSH_CTRL_REG5_ADDR, 1);
+  LIS3DSH_ReadReg(LIS3DSH_CTRL_REG5_ADDR, &tmpreg);
   
   /* Set new full scale configuration */
-  tmpreg &= (uint8_t)~LIS3DSH_FULLSCALE_16;
+  tmpreg &= (uint8_t)~LIS3DSH__FULLSCALE_SELECTION;
   tmpreg |= FS_value;
   
   /* Write value to MEMS CTRL_REG5 register */
-  ACCELERO_IO_Write(&tmpreg, LIS3DSH_CTRL_REG5_ADDR, 1);
+  LIS3DSH_WriteReg(LIS3DSH_CTRL_REG5_ADDR, tmpreg);
+  Lis3dshSensitivity = LIS3DSH_Sensitivity(tmpreg);
 }
 
 /**
@@ -343,72 +380,244 @@ void LIS3DSH_RebootCmd(void)
 {
   uint8_t tmpreg;
   /* Read CTRL_REG6 register */
-  ACCELERO_IO_Read(&tmpreg, LIS3DSH_CTRL_REG6_ADDR, 1);
+  LIS3DSH_ReadReg(LIS3DSH_CTRL_REG6_ADDR, &tmpreg);
   
   /* Enable or Disable the reboot memory */
   tmpreg |= LIS3DSH_BOOT_FORCED;
   
   /* Write value to MEMS CTRL_REG6 register */
-  ACCELERO_IO_Write(&tmpreg, LIS3DSH_CTRL_REG6_ADDR, 1);
+  LIS3DSH_WriteReg(LIS3DSH_CTRL_REG6_ADDR, tmpreg);
+
+  /* The registers are reloaded with their default values */
+  REGCACHE_Invalidate(&Lis3dshCache);
+  Lis3dshSensitivity = LIS3DSH_SENSITIVITY_Q16_0_06G;
+  Lis3dshAddrInc = 0;
 }
 
 /**
   * @brief  Read LIS3DSH output register, and calculate the acceleration 
   *         ACC[mg]=SENSITIVITY* (out_h*256+out_l)/16 (12 bit representation).
+  * @note   The six output registers are read in a single chip select cycle,
+  *         using the register address auto-increment, and scaled with the
+  *         sensitivity cached at full scale selection time (Q16, truncated
+  *         toward zero as the former floating point conversion).
   * @param  pointer on floating buffer.
   * @retval None
   */
 void LIS3DSH_ReadACC(int16_t *pData)
 {
-  int8_t buffer[6];
-  uint8_t crtl, i = 0x00;
-  float sensitivity = LIS3DSH_SENSITIVITY_0_06G;
-  float valueinfloat = 0;
-  
-  ACCELERO_IO_Read(&crtl, LIS3DSH_CTRL_REG5_ADDR, 1);  
-  ACCELERO_IO_Read((uint8_t*)&buffer[0], LIS3DSH_OUT_X_L_ADDR, 1);
-  ACCELERO_IO_Read((uint8_t*)&buffer[1], LIS3DSH_OUT_X_H_ADDR, 1);
-  ACCELERO_IO_Read((uint8_t*)&buffer[2], LIS3DSH_OUT_Y_L_ADDR, 1);
-  ACCELERO_IO_Read((uint8_t*)&buffer[3], LIS3DSH_OUT_Y_H_ADDR, 1);
-  ACCELERO_IO_Read((uint8_t*)&buffer[4], LIS3DSH_OUT_Z_L_ADDR, 1);
-  ACCELERO_IO_Read((uint8_t*)&buffer[5], LIS3DSH_OUT_Z_H_ADDR, 1);
-  
-  switch(crtl & LIS3DSH__FULLSCALE_SELECTION) 
+  uint8_t buffer[6];
+  uint8_t i = 0x00;
+  
+  if(!Lis3dshAddrInc)
+  {
+    LIS3DSH_AddrIncCmd();
+  }
+  
+  /* OUT_X_L, OUT_X_H, OUT_Y_L, OUT_Y_H, OUT_Z_L, OUT_Z_H */
+  ACCELERO_IO_ReadBurst(buffer, LIS3DSH_OUT_X_L_ADDR, 6);
+  
+  /* Obtain the mg value for the three axis */
+  for(i=0; i<3; i++)
+  {
+    pData[i] = LIS3DSH_Scale((int16_t)((buffer[2*i+1] << 8) | buffer[2*i]));
+  }
+}
+
+/**
+  * @brief  Configure the LIS3DSH FIFO and its watermark interrupt on INT1.
+  * @note   The FIFO is passed through the bypass mode, which empties it, so
+  *         that INT1 starts low and its first rising edge is not missed.
+  *         INT1 stays high as long as the FIFO holds at least Watermark
+  *         samples: it is released only by reading the FIFO below that level.
+  * @param  FIFO_Mode: FIFO mode.
+  *   This parameter can be one of the following values:
+  *     @arg LIS3DSH_FIFO_BYPASS_MODE: FIFO and INT1 disabled
+  *     @arg LIS3DSH_FIFO_MODE: stop collecting data when the FIFO is full
+  *     @arg LIS3DSH_FIFO_STREAM_MODE: the newest sample overwrites the oldest one
+  * @param  Watermark: FIFO level, from 1 to 31 samples, that asserts INT1.
+  * @retval None
+  */
+void LIS3DSH_FIFOConfig(uint8_t FIFO_Mode, uint8_t Watermark)
+{
+  uint8_t tmpreg;
+  
+  /* Reset the FIFO content */
+  tmpreg = LIS3DSH_FIFO_BYPASS_MODE;
+  LIS3DSH_WriteReg(LIS3DSH_FIFO_CTRL_ADDR, tmpreg);
+  
+  /* Read CTRL_REG6 register */
+  LIS3DSH_ReadReg(LIS3DSH_CTRL_REG6_ADDR, &tmpreg);
+  tmpreg &= (uint8_t)~(LIS3DSH_BOOT_FORCED | LIS3DSH_FIFO_ENABLE | LIS3DSH_FIFO_STOP_ON_WTM | \
+                       LIS3DSH_FIFO_I1_EMPTY | LIS3DSH_FIFO_I1_WTM | LIS3DSH_FIFO_I1_OVERRUN);
+  
+  if(FIFO_Mode == LIS3DSH_FIFO_BYPASS_MODE)
+  {
+    /* Write value to MEMS CTRL_REG6 register */
+    LIS3DSH_WriteReg(LIS3DSH_CTRL_REG6_ADDR, tmpreg);
+    return;
+  }
+  
+  /* Configure the INT1 pin, then enable the FIFO and route its watermark to
+     INT1: the burst reads also need the address auto-increment */
+  ACCELERO_IO_INT1Config();
+  
+  tmpreg |= (uint8_t)(LIS3DSH_FIFO_ENABLE | LIS3DSH_FIFO_I1_WTM | LIS3DSH_ADD_INC);
+  LIS3DSH_WriteReg(LIS3DSH_CTRL_REG6_ADDR, tmpreg);
+  Lis3dshAddrInc = 1;
+  
+  /* INT1 signal enabled, active high */
+  LIS3DSH_ReadReg(LIS3DSH_CTRL_REG3_ADDR, &tmpreg);
+  tmpreg |= (uint8_t)(LIS3DSH_INT1_ENABLE | LIS3DSH_INTERRUPT_SIGNAL_HIGH);
+  LIS3DSH_WriteReg(LIS3DSH_CTRL_REG3_ADDR, tmpreg);
+  
+  /* Write value to MEMS FIFO_CTRL register */
+  tmpreg = (uint8_t)((FIFO_Mode & LIS3DSH__FIFO_MODE_SELECTION) | \
+                     (Watermark & LIS3DSH__FIFO_WATERMARK_SELECTION));
+  LIS3DSH_WriteReg(LIS3DSH_FIFO_CTRL_ADDR, tmpreg);
+}
+
+/**
+  * @brief  Read the samples stored in the LIS3DSH FIFO, oldest first.
+  * @note   With the FIFO enabled the register address rolls back from OUT_Z_H
+  *         to OUT_X_L, so all the samples are read in a single burst: the
+  *         bytes are read directly into pData (little endian X, Y, Z) and
+  *         then scaled in place to mg. pData may be moved by the DMA, so it
+  *         must not be placed in the CCM RAM.
+  * @param  pData: buffer of 3 * MaxSamples values, X, Y, Z of each sample.
+  * @param  MaxSamples: maximum number of samples to read.
+  * @retval Number of samples read, 0 if the FIFO is empty.
+  */
+uint8_t LIS3DSH_ReadFIFO(int16_t *pData, uint8_t MaxSamples)
+{
+  uint8_t src;
+  uint8_t samples;
+  uint16_t i;
+  
+  /* Read FIFO_SRC register: FSS is the number of stored samples - 1 */
+  LIS3DSH_ReadReg(LIS3DSH_FIFO_SRC_ADDR, &src);
+  if(src & LIS3DSH_FIFO_SRC_EMPTY)
+  {
+    return 0;
+  }
+  
+  samples = (uint8_t)((src & LIS3DSH_FIFO_SRC_FSS) + 1);
+  if(samples > MaxSamples)
+  {
+    samples = MaxSamples;
+  }
+  if(samples == 0)
+  {
+    return 0;
+  }
+  
+  ACCELERO_IO_ReadBurst((uint8_t*)pData, LIS3DSH_OUT_X_L_ADDR, (uint16_t)(6 * samples));
+  
+  /* Obtain the mg value for the three axis of each sample */
+  for(i=0; i<3*samples; i++)
+  {
+    pData[i] = LIS3DSH_Scale(pData[i]);
+  }
+  
+  return samples;
+}
+
+/**
+  * @brief  Sensitivity of the full scale selected in a CTRL_REG5 value.
+  * @param  ctrl5: CTRL_REG5 register value.
+  * @retval Sensitivity in Q16 mg/digit.
+  */
+static int32_t LIS3DSH_Sensitivity(uint8_t ctrl5)
+{
+  switch(ctrl5 & LIS3DSH__FULLSCALE_SELECTION) 
   {
-    /* FS bit = 000 ==> Sensitivity typical value = 0.06milligals/digit */ 
-  case LIS3DSH_FULLSCALE_2:
-    sensitivity = LIS3DSH_SENSITIVITY_0_06G;
-    break;
-    
     /* FS bit = 001 ==> Sensitivity typical value = 0.12milligals/digit */ 
   case LIS3DSH_FULLSCALE_4:
-    sensitivity = LIS3DSH_SENSITIVITY_0_12G;
-    break;
+    return LIS3DSH_SENSITIVITY_Q16_0_12G;
     
     /* FS bit = 010 ==> Sensitivity typical value = 0.18milligals/digit */ 
   case LIS3DSH_FULLSCALE_6:
-    sensitivity = LIS3DSH_SENSITIVITY_0_18G;
-    break;
+    return LIS3DSH_SENSITIVITY_Q16_0_18G;
     
     /* FS bit = 011 ==> Sensitivity typical value = 0.24milligals/digit */ 
   case LIS3DSH_FULLSCALE_8:
-    sensitivity = LIS3DSH_SENSITIVITY_0_24G;
-    break;
+    return LIS3DSH_SENSITIVITY_Q16_0_24G;
     
     /* FS bit = 100 ==> Sensitivity typical value = 0.73milligals/digit */ 
   case LIS3DSH_FULLSCALE_16:
-    sensitivity = LIS3DSH_SENSITIVITY_0_73G;
-    break;
+    return LIS3DSH_SENSITIVITY_Q16_0_73G;
     
+    /* FS bit = 000 ==> Sensitivity typical value = 0.06milligals/digit */ 
   default:
-    break;
+    return LIS3DSH_SENSITIVITY_Q16_0_06G;
   }
+}
+
+/**
+  * @brief  Scale a raw output value to mg with the cached sensitivity.
+  * @param  raw: output register value.
+  * @retval Acceleration in mg, truncated toward zero.
+  */
+static int16_t LIS3DSH_Scale(int16_t raw)
+{
+  int32_t value = raw * Lis3dshSensitivity;
   
-  /* Obtain the mg value for the three axis */
-  for(i=0; i<3; i++)
+  return (int16_t)(value >= 0 ? (value >> 16) : -((-value) >> 16));
+}
+
+/**
+  * @brief  Enable the register address auto-increment (CTRL_REG6 IF_ADD_INC).
+  * @param  None
+  * @retval None
+  */
+static void LIS3DSH_AddrIncCmd(void)
+{
+  uint8_t tmpreg;
+  
+  /* Read CTRL_REG6 register */
+  LIS3DSH_ReadReg(LIS3DSH_CTRL_REG6_ADDR, &tmpreg);
+  
+  /* A reboot still in progress is not interrupted: retry on the next read, 
+     from the bus, since the registers are still being reloaded */
+  if(tmpreg & LIS3DSH_BOOT_FORCED)
+  {
+    REGCACHE_Invalidate(&Lis3dshCache);
+    return;
+  }
+  
+  tmpreg |= LIS3DSH_ADD_INC;
+  
+  /* Write value to MEMS CTRL_REG6 register */
+  LIS3DSH_WriteReg(LIS3DSH_CTRL_REG6_ADDR, tmpreg);
+  Lis3dshAddrInc = 1;
+}
+
+/**
+  * @brief  Read a register, from the copy of the control registers if known.
+  * @param  Reg: register address.
+  * @param  pValue: register value.
+  * @retval None
+  */
+static void LIS3DSH_ReadReg(uint8_t Reg, uint8_t *pValue)
+{
+  if(!REGCACHE_Read(&Lis3dshCache, Reg, pValue))
+  {
+    ACCELERO_IO_Read(pValue, Reg, 1);
+    REGCACHE_Fill(&Lis3dshCache, Reg, *pValue);
+  }
+}
+
+/**
+  * @brief  Write a register, unless it is known to already hold the value.
+  * @param  Reg: register address.
+  * @param  Value: register value.
+  * @retval None
+  */
+static void LIS3DSH_WriteReg(uint8_t Reg, uint8_t Value)
+{
+  if(REGCACHE_Write(&Lis3dshCache, Reg, Value))
   {
-    valueinfloat = ((buffer[2*i+1] << 8) + buffer[2*i]) * sensitivity;
-    pData[i] = (int16_t)valueinfloat;
+    ACCELERO_IO_Write(&Value, Reg, 1);
   }
 }
 
@@ -97,10 +97,25 @@ LCD_DrvTypeDef   st7735_drv =
   st7735_GetLcdPixelWidth,
   st7735_GetLcdPixelHeight,
   st7735_DrawBitmap,
+  0,
+  st7735_FillRect,
+  st7735_BlitRect,
+  st7735_WriteWindow,
+  st7735_WritePixels,
 };
 
+/* Block of pixels of the same color, streamed by DrawHLine and FillRect. It
+   is refilled and sent again after each LCD_IO_WriteMultipleData, which must
+   therefore return only when the transfer is complete */
 static uint16_t ArrayRGB[320] = {0};
 
+/* Display window ends, as set by Init or SetDisplayWindow. SetCursor only
+   moves the window start: when a bulk operation has changed the whole window
+   (WindowChanged = 1), SetCursor restores these ends too. */
+static uint16_t WindowXend = ST7735_LCD_PIXEL_WIDTH - 1;
+static uint16_t WindowYend = ST7735_LCD_PIXEL_HEIGHT - 1;
+static uint8_t  WindowChanged = 0;
+
 /**
 * @}
 */ 
@@ -108,6 +123,8 @@ static uint16_t ArrayRGB[320] = {0};
 /** @defgroup ST7735_Private_FunctionPrototypes
   * @{
   */
+static void st7735_SetAddressWindow(uint16_t Xstart, uint16_t Ystart, uint16_t Xend, uint16_t Yend);
+static uint8_t st7735_ClipRect(uint16_t *Xpos, uint16_t *Ypos, uint16_t *Width, uint16_t *Height);
 
 /**
 * @}
@@ -188,6 +205,9 @@ void st7735_Init(void)
   LCD_IO_WriteMultipleData(&data, 1);
   data = 0x9F;
   LCD_IO_WriteMultipleData(&data, 1);
+  WindowXend = ST7735_LCD_PIXEL_WIDTH - 1;
+  WindowYend = ST7735_LCD_PIXEL_HEIGHT - 1;
+  WindowChanged = 0;
   /* Magical unicorn dust, 16 args, no delay */
   st7735_WriteReg(LCD_REG_224, 0x02); 
   st7735_WriteReg(LCD_REG_224, 0x1c);  
@@ -273,6 +293,14 @@ void st7735_DisplayOff(void)
 void st7735_SetCursor(uint16_t Xpos, uint16_t Ypos)
 {
   uint8_t data = 0;
+  if (WindowChanged)
+  {
+    /* Restore the display window left by a bulk operation */
+    st7735_SetAddressWindow(Xpos, Ypos, WindowXend, WindowYend);
+    LCD_IO_WriteReg(LCD_REG_44);
+    WindowChanged = 0;
+    return;
+  }
   LCD_IO_WriteReg(LCD_REG_42);
   data = (Xpos) >> 8;
   LCD_IO_WriteMultipleData(&data, 1);
@@ -354,6 +382,9 @@ void st7735_SetDisplayWindow(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint1
   LCD_IO_WriteMultipleData(&data, 1);
   data = (Ypos + Height - 1) & 0xFF;
   LCD_IO_WriteMultipleData(&data, 1);
+  WindowXend = Xpos + Width - 1;
+  WindowYend = Ypos + Height - 1;
+  WindowChanged = 0;
 }
 
 /**
@@ -390,13 +421,10 @@ void st7735_DrawHLine(uint16_t RGBCode, uint16_t Xpos, uint16_t Ypos, uint16_t L
   */
 void st7735_DrawVLine(uint16_t RGBCode, uint16_t Xpos, uint16_t Ypos, uint16_t Length)
 {
-  uint8_t counter = 0;
-  
   if(Ypos + Length > ST7735_LCD_PIXEL_HEIGHT) return;
-  for(counter = 0; counter < Length; counter++)
-  {
-    st7735_WritePixel(Xpos, Ypos + counter, RGBCode);
-  }   
+  
+  /* A one column window: the controller moves to the next row by itself */
+  st7735_FillRect(Xpos, Ypos, 1, Length, RGBCode);
 }
 
 /**
@@ -451,6 +479,154 @@ void st7735_DrawBitmap(uint16_t Xpos, uint16_t Ypos, uint8_t *pbmp)
   st7735_WriteReg(LCD_REG_54, 0xC0);
 }
 
+/**
+  * @brief  Opens a GRAM write window: the following pixel data fill it
+  *         row by row, from top left to bottom right.
+  * @param  Xpos:   specifies the X top left position.
+  * @param  Ypos:   specifies the Y top left position.
+  * @param  Width:  window width.
+  * @param  Height: window height.
+  * @retval None
+  */
+void st7735_WriteWindow(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height)
+{
+  st7735_SetAddressWindow(Xpos, Ypos, Xpos + Width - 1, Ypos + Height - 1);
+  LCD_IO_WriteReg(LCD_REG_44);
+  WindowChanged = 1;
+}
+
+/**
+  * @brief  Streams pixels into the window opened by st7735_WriteWindow.
+  * @param  pData: pixels in RGB565 format.
+  * @param  Size:  number of pixels.
+  * @retval None
+  */
+void st7735_WritePixels(const uint16_t *pData, uint32_t Size)
+{
+  if (Size > 0)
+  {
+    /* The IO layer sends the two bytes of each pixel MSB first */
+    LCD_IO_WriteMultipleData((uint8_t*)pData, Size * 2);
+  }
+}
+
+/**
+  * @brief  Fills a rectangle with a color.
+  * @param  Xpos:    specifies the X top left position.
+  * @param  Ypos:    specifies the Y top left position.
+  * @param  Width:   rectangle width.
+  * @param  Height:  rectangle height.
+  * @param  RGBCode: the RGB color in RGB565 format.
+  * @retval None
+  */
+void st7735_FillRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height, uint16_t RGBCode)
+{
+  uint32_t size, chunk;
+
+  if (!st7735_ClipRect(&Xpos, &Ypos, &Width, &Height))
+  {
+    return;
+  }
+  st7735_WriteWindow(Xpos, Ypos, Width, Height);
+
+  /* The whole rectangle is one GRAM stream, sent in blocks of ArrayRGB size */
+  size = (uint32_t)Width * Height;
+  chunk = (size < sizeof(ArrayRGB) / 2) ? size : sizeof(ArrayRGB) / 2;
+  PIXEL_Fill(ArrayRGB, RGBCode, chunk);
+  for (; size > 0; size -= chunk)
+  {
+    if (size < chunk)
+    {
+      chunk = size;
+    }
+    LCD_IO_WriteMultipleData((uint8_t*)&ArrayRGB[0], chunk * 2);
+  }
+}
+
+/**
+  * @brief  Copies a block of pixels into a rectangle.
+  * @param  Xpos:   specifies the X top left position.
+  * @param  Ypos:   specifies the Y top left position.
+  * @param  Width:  rectangle width.
+  * @param  Height: rectangle height.
+  * @param  pData:  pixels in RGB565 format, row by row.
+  * @param  Pitch:  distance, in pixels, between two rows of pData.
+  * @retval None
+  */
+void st7735_BlitRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height, const uint16_t *pData, uint16_t Pitch)
+{
+  uint16_t x = Xpos, y = Ypos;
+
+  if (!st7735_ClipRect(&x, &y, &Width, &Height))
+  {
+    return;
+  }
+  pData += (uint32_t)(y - Ypos) * Pitch + (x - Xpos);
+  st7735_WriteWindow(x, y, Width, Height);
+
+  if (Pitch == Width)
+  {
+    /* Contiguous rows: a single transfer */
+    LCD_IO_WriteMultipleData((uint8_t*)pData, (uint32_t)Width * Height * 2);
+  }
+  else
+  {
+    for (; Height > 0; Height--, pData += Pitch)
+    {
+      LCD_IO_WriteMultipleData((uint8_t*)pData, (uint32_t)Width * 2);
+    }
+  }
+}
+
+/**
+  * @brief  Sets the column and row address window, one transfer per register.
+  * @param  Xstart: first column.
+  * @param  Ystart: first row.
+  * @param  Xend:   last column.
+  * @param  Yend:   last row.
+  * @retval None
+  */
+static void st7735_SetAddressWindow(uint16_t Xstart, uint16_t Ystart, uint16_t Xend, uint16_t Yend)
+{
+  uint16_t data[2];
+
+  /* The IO layer sends the two bytes of each half word MSB first */
+  LCD_IO_WriteReg(LCD_REG_42);
+  data[0] = Xstart;
+  data[1] = Xend;
+  LCD_IO_WriteMultipleData((uint8_t*)data, 4);
+  LCD_IO_WriteReg(LCD_REG_43);
+  data[0] = Ystart;
+  data[1] = Yend;
+  LCD_IO_WriteMultipleData((uint8_t*)data, 4);
+}
+
+/**
+  * @brief  Clips a rectangle to the LCD area.
+  * @param  Xpos:   X top left position, updated.
+  * @param  Ypos:   Y top left position, updated.
+  * @param  Width:  rectangle width, updated.
+  * @param  Height: rectangle height, updated.
+  * @retval 0 if nothing is left to draw, 1 otherwise
+  */
+static uint8_t st7735_ClipRect(uint16_t *Xpos, uint16_t *Ypos, uint16_t *Width, uint16_t *Height)
+{
+  if ((*Xpos >= ST7735_LCD_PIXEL_WIDTH) || (*Ypos >= ST7735_LCD_PIXEL_HEIGHT) ||
+      (*Width == 0) || (*Height == 0))
+  {
+    return 0;
+  }
+  if (*Width > ST7735_LCD_PIXEL_WIDTH - *Xpos)
+  {
+    *Width = ST7735_LCD_PIXEL_WIDTH - *Xpos;
+  }
+  if (*Height > ST7735_LCD_PIXEL_HEIGHT - *Ypos)
+  {
+    *Height = ST7735_LCD_PIXEL_HEIGHT - *Ypos;
+  }
+  return 1;
+}
+
 /**
 * @}
 */ 
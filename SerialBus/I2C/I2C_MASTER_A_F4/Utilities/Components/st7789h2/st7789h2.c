@@ -100,12 +100,21 @@ LCD_DrvTypeDef   ST7789H2_drv =
   ST7789H2_GetLcdPixelHeight,
   ST7789H2_DrawBitmap,
   ST7789H2_DrawRGBImage,  
+  ST7789H2_FillRect,
+  ST7789H2_BlitRect,
+  ST7789H2_WriteWindow,
+  ST7789H2_WritePixels,
 };
 
 static uint16_t WindowsXstart = 0;
 static uint16_t WindowsYstart = 0;
 static uint16_t WindowsXend = ST7789H2_LCD_PIXEL_WIDTH-1;
 static uint16_t WindowsYend = ST7789H2_LCD_PIXEL_HEIGHT-1;
+
+/* Block of pixels of the same color, streamed by FillRect. It is sent again
+   for every block of the rectangle, so LCD_IO_WriteMultipleData must not
+   return before the previous transfer is complete */
+static uint16_t FillBuffer[ST7789H2_FILL_CHUNK];
 /**
   * @}
   */ 
@@ -115,6 +124,7 @@ static uint16_t WindowsYend = ST7789H2_LCD_PIXEL_HEIGHT-1;
   */
 static ST7789H2_Rgb888 ST7789H2_ReadPixel_rgb888(uint16_t Xpos, uint16_t Ypos);
 static void ST7789H2_DrawRGBHLine(uint16_t Xpos, uint16_t Ypos, uint16_t Xsize, uint8_t *pdata);
+static uint8_t ST7789H2_ClipRect(uint16_t *Xpos, uint16_t *Ypos, uint16_t *Width, uint16_t *Height);
 
 /**
   * @}
@@ -529,19 +539,8 @@ void ST7789H2_SetDisplayWindow(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uin
   */
 void ST7789H2_DrawHLine(uint16_t RGBCode, uint16_t Xpos, uint16_t Ypos, uint16_t Length)
 {
-  uint16_t counter = 0;
-  
-  /* Set Cursor */
-  ST7789H2_SetCursor(Xpos, Ypos); 
-  
-  /* Prepare to write to LCD RAM */
-  ST7789H2_WriteReg(ST7789H2_WRITE_RAM, (uint8_t*)NULL, 0);   /* RAM write data command */
-  
-  /* Sent a complete line */
-  for(counter = 0; counter < Length; counter++)
-  {
-    LCD_IO_WriteData(RGBCode);
-  }  
+  /* One address window, the line is streamed in blocks */
+  ST7789H2_FillRect(Xpos, Ypos, Length, 1, RGBCode);
 }
 
 /**
@@ -554,19 +553,8 @@ void ST7789H2_DrawHLine(uint16_t RGBCode, uint16_t Xpos, uint16_t Ypos, uint16_t
   */
 void ST7789H2_DrawVLine(uint16_t RGBCode, uint16_t Xpos, uint16_t Ypos, uint16_t Length)
 {
-  uint16_t counter = 0;
-
-  /* Set Cursor */
-  ST7789H2_SetCursor(Xpos, Ypos);
-  
-  /* Prepare to write to LCD RAM */
-  ST7789H2_WriteReg(ST7789H2_WRITE_RAM, (uint8_t*)NULL, 0);   /* RAM write data command */
-
-  /* Fill a complete vertical line */
-  for(counter = 0; counter < Length; counter++)
-  {
-    ST7789H2_WritePixel(Xpos, Ypos + counter, RGBCode);
-  }
+  /* A one column window: the controller moves to the next row by itself */
+  ST7789H2_FillRect(Xpos, Ypos, 1, Length, RGBCode);
 }
 
 /**
@@ -629,6 +617,120 @@ void ST7789H2_DrawRGBImage(uint16_t Xpos, uint16_t Ypos, uint16_t Xsize, uint16_
   }
 }
 
+/**
+  * @brief  Opens a GRAM write window: the following pixel data fill it
+  *         row by row, from top left to bottom right.
+  * @param  Xpos:   specifies the X top left position.
+  * @param  Ypos:   specifies the Y top left position.
+  * @param  Width:  window width.
+  * @param  Height: window height.
+  * @retval None
+  */
+void ST7789H2_WriteWindow(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height)
+{
+  uint8_t   parameter[4];
+  uint16_t  end;
+
+  /* CASET: Column Address Set */
+  end = Xpos + Width - 1;
+  parameter[0] = Xpos >> 8;
+  parameter[1] = Xpos & 0xFF;
+  parameter[2] = end >> 8;
+  parameter[3] = end & 0xFF;
+  ST7789H2_WriteReg(ST7789H2_CASET, parameter, 4);
+  /* RASET: Row Address Set */
+  end = Ypos + Height - 1;
+  parameter[0] = Ypos >> 8;
+  parameter[1] = Ypos & 0xFF;
+  parameter[2] = end >> 8;
+  parameter[3] = end & 0xFF;
+  ST7789H2_WriteReg(ST7789H2_RASET, parameter, 4);
+
+  /* Prepare to write to LCD RAM */
+  ST7789H2_WriteReg(ST7789H2_WRITE_RAM, (uint8_t*)NULL, 0);
+}
+
+/**
+  * @brief  Streams pixels into the window opened by ST7789H2_WriteWindow.
+  * @param  pData: pixels in RGB565 format.
+  * @param  Size:  number of pixels.
+  * @retval None
+  */
+void ST7789H2_WritePixels(const uint16_t *pData, uint32_t Size)
+{
+  if (Size > 0)
+  {
+    LCD_IO_WriteMultipleData((uint16_t*)pData, Size);
+  }
+}
+
+/**
+  * @brief  Fills a rectangle with a color.
+  * @param  Xpos:    specifies the X top left position.
+  * @param  Ypos:    specifies the Y top left position.
+  * @param  Width:   rectangle width.
+  * @param  Height:  rectangle height.
+  * @param  RGBCode: the RGB color in RGB565 format.
+  * @retval None
+  */
+void ST7789H2_FillRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height, uint16_t RGBCode)
+{
+  uint32_t size, chunk;
+
+  if (!ST7789H2_ClipRect(&Xpos, &Ypos, &Width, &Height))
+  {
+    return;
+  }
+  ST7789H2_WriteWindow(Xpos, Ypos, Width, Height);
+
+  /* The whole rectangle is one GRAM stream, sent in blocks of FILL_CHUNK pixels */
+  size = (uint32_t)Width * Height;
+  chunk = (size < ST7789H2_FILL_CHUNK) ? size : ST7789H2_FILL_CHUNK;
+  PIXEL_Fill(FillBuffer, RGBCode, chunk);
+  for (; size > 0; size -= chunk)
+  {
+    if (size < chunk)
+    {
+      chunk = size;
+    }
+    LCD_IO_WriteMultipleData(FillBuffer, chunk);
+  }
+}
+
+/**
+  * @brief  Copies a block of pixels into a rectangle.
+  * @param  Xpos:   specifies the X top left position.
+  * @param  Ypos:   specifies the Y top left position.
+  * @param  Width:  rectangle width.
+  * @param  Height: rectangle height.
+  * @param  pData:  pixels in RGB565 format, row by row.
+  * @param  Pitch:  distance, in pixels, between two rows of pData.
+  * @retval None
+  */
+void ST7789H2_BlitRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height, const uint16_t *pData, uint16_t Pitch)
+{
+  uint16_t x = Xpos, y = Ypos;
+
+  if (!ST7789H2_ClipRect(&x, &y, &Width, &Height))
+  {
+    return;
+  }
+  pData += (uint32_t)(y - Ypos) * Pitch + (x - Xpos);
+  ST7789H2_WriteWindow(x, y, Width, Height);
+
+  if (Pitch == Width)
+  {
+    /* Contiguous rows: a single transfer */
+    LCD_IO_WriteMultipleData((uint16_t*)pData, (uint32_t)Width * Height);
+  }
+  else
+  {
+    for (; Height > 0; Height--, pData += Pitch)
+    {
+      LCD_IO_WriteMultipleData((uint16_t*)pData, Width);
+    }
+  }
+}
 
 /******************************************************************************
                             Static Functions
@@ -685,25 +787,49 @@ static ST7789H2_Rgb888 ST7789H2_ReadPixel_rgb888(uint16_t Xpos, uint16_t Ypos)
   */
 static void ST7789H2_DrawRGBHLine(uint16_t Xpos, uint16_t Ypos, uint16_t Xsize, uint8_t *pdata)
 {
-  uint32_t i = 0;
-  uint32_t posX;
-  uint16_t *rgb565 = (uint16_t*)pdata;
+  uint32_t start, end;
   
   /* Prepare to write to LCD RAM */
   ST7789H2_WriteReg(ST7789H2_WRITE_RAM, (uint8_t*)NULL, 0);   /* RAM write data command */
   
-  for (posX = Xpos; posX < (Xsize + Xpos); posX++)
+  /* Check we are in the defined window: only the pixels inside it are sent,
+     from the first one of the line, as a single block */
+  if ((Ypos < WindowsYstart) || (Ypos > WindowsYend))
   {
-    if ((posX >= WindowsXstart) && (Ypos >= WindowsYstart) &&     /* Check we are in the defined window */
-        (posX <= WindowsXend) && (Ypos <= WindowsYend))
-    {
-      if (posX != (Xsize + Xpos))     /* When writing last pixel when size is odd, the third part is not written */
-      {
-        LCD_IO_WriteData(rgb565[i]);        
-      }      
-      i++;
-    }
+    return;
+  }
+  start = (Xpos > WindowsXstart) ? Xpos : WindowsXstart;
+  end = (Xpos + Xsize > WindowsXend + 1) ? WindowsXend + 1 : Xpos + Xsize;
+  if (end > start)
+  {
+    LCD_IO_WriteMultipleData((uint16_t*)pdata, end - start);
+  }
+}
+
+/**
+  * @brief  Clips a rectangle to the LCD area.
+  * @param  Xpos:   X top left position, updated.
+  * @param  Ypos:   Y top left position, updated.
+  * @param  Width:  rectangle width, updated.
+  * @param  Height: rectangle height, updated.
+  * @retval 0 if nothing is left to draw, 1 otherwise
+  */
+static uint8_t ST7789H2_ClipRect(uint16_t *Xpos, uint16_t *Ypos, uint16_t *Width, uint16_t *Height)
+{
+  if ((*Xpos >= ST7789H2_LCD_PIXEL_WIDTH) || (*Ypos >= ST7789H2_LCD_PIXEL_HEIGHT) ||
+      (*Width == 0) || (*Height == 0))
+  {
+    return 0;
+  }
+  if (*Width > ST7789H2_LCD_PIXEL_WIDTH - *Xpos)
+  {
+    *Width = ST7789H2_LCD_PIXEL_WIDTH - *Xpos;
+  }
+  if (*Height > ST7789H2_LCD_PIXEL_HEIGHT - *Ypos)
+  {
+    *Height = ST7789H2_LCD_PIXEL_HEIGHT - *Ypos;
   }
+  return 1;
 }
 
 /**
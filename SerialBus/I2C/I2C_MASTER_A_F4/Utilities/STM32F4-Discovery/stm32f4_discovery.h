@@ -173,6 +173,19 @@ typedef enum
 #define DISCOVERY_SPIx_MISO_PIN                     GPIO_PIN_6                 /* PA.06 */
 #define DISCOVERY_SPIx_MOSI_PIN                     GPIO_PIN_7                 /* PA.07 */
 
+/* DMA streams used by the SPI block transfers (SPI1 requests on DMA2 channel 3) */
+#define DISCOVERY_SPIx_DMA_CLK_ENABLE()             __HAL_RCC_DMA2_CLK_ENABLE()
+#define DISCOVERY_SPIx_DMA_CHANNEL                  DMA_CHANNEL_3
+#define DISCOVERY_SPIx_DMA_RX_STREAM                DMA2_Stream0
+#define DISCOVERY_SPIx_DMA_TX_STREAM                DMA2_Stream3
+
+/* Transfers of at least this number of bytes are moved by the DMA, the shorter
+   ones (register addresses, single samples) by polling the SPI registers, for
+   which the DMA setup would cost more than the transfer itself. */
+#ifndef DISCOVERY_SPIx_DMA_THRESHOLD
+ #define DISCOVERY_SPIx_DMA_THRESHOLD               16
+#endif /* DISCOVERY_SPIx_DMA_THRESHOLD */
+
 /* Maximum Timeout values for flags waiting loops. These timeouts are not based
    on accurate values, they just guarantee that the application will not remain
    stuck if the SPI communication is corrupted.
@@ -128,6 +128,19 @@ b) RECORD A FILE:
 
    + Call the function AUDIO_IN_STOP() to stop recording 
 
+c) RECORD-TO-PLAYBACK LOOPBACK:
+===============================
+   + Call the function BSP_AUDIO_LOOPBACK_Init(OutputDevice, Volume, AudioFreq) to configure
+      both the codec output and the microphone input (AudioFreq must be DEFAULT_AUDIO_IN_FREQ).
+   + Call the function BSP_AUDIO_LOOPBACK_Start() to start streaming the microphone to the codec.
+      The PDM samples are decimated, on each half of the record buffer, straight into the blocks
+      that the playback DMA reads afterwards (double buffer mode): no copy is done in between.
+      Each block can be processed in place by BSP_AUDIO_LOOPBACK_Process_CallBack().
+      The latency is set by AUDIO_LOOPBACK_LATENCY; the drift between the record and playback
+      clocks is compensated by dropping or repeating a single frame (see audiopipe.h).
+   + Call the function BSP_AUDIO_LOOPBACK_Stop() to stop; BSP_AUDIO_LOOPBACK_GetStats() returns
+      the underrun/overrun and drift compensation counters.
+
 ==============================================================================*/
 
 /* Includes ------------------------------------------------------------------*/
@@ -182,8 +195,14 @@ I2S_HandleTypeDef                 hAudioOutI2s;
 /*### RECORDER ###*/
 I2S_HandleTypeDef                 hAudioInI2s;
 
-PDMFilter_InitStruct Filter[DEFAULT_AUDIO_IN_CHANNEL_NBR];
+PDM_Filter_t Filter[DEFAULT_AUDIO_IN_CHANNEL_NBR];
 __IO uint16_t AudioInVolume = DEFAULT_AUDIO_IN_VOLUME;
+
+/*### LOOPBACK ###*/
+static uint16_t     LoopbackPDM[INTERNAL_BUFF_SIZE];
+static int16_t      LoopbackPool[(AUDIO_LOOPBACK_BLOCKS + 1) * PCM_OUT_SIZE * 2];
+static AUDIOPIPE_t  LoopbackPipe;
+static __IO uint8_t LoopbackRunning = 0;
 /**
   * @}
   */ 
@@ -194,6 +213,11 @@ __IO uint16_t AudioInVolume = DEFAULT_AUDIO_IN_VOLUME;
 static uint8_t I2S3_Init(uint32_t AudioFreq);
 static uint8_t I2S2_Init(uint32_t AudioFreq);
 static void PDMDecoder_Init(uint32_t AudioFreq, uint32_t ChnlNbr);
+static void Loopback_Capture(uint16_t *pPDM);
+static void Loopback_Process(void *ctx, int16_t *pBuffer, uint32_t Frames);
+static void Loopback_TxM0Cplt(DMA_HandleTypeDef *hdma);
+static void Loopback_TxM1Cplt(DMA_HandleTypeDef *hdma);
+static void Loopback_TxError(DMA_HandleTypeDef *hdma);
 /**
   * @}
   */ 
@@ -707,7 +731,7 @@ uint8_t BSP_AUDIO_IN_Init(uint32_t AudioFreq, uint32_t BitRes, uint32_t ChnlNbr)
   /* Configure PLL clock */ 
   BSP_AUDIO_IN_ClockConfig(&hAudioInI2s, AudioFreq, NULL);
   
-  /* Configure the PDM library */
+  /* Configure the PDM decimator */
   PDMDecoder_Init(AudioFreq, ChnlNbr);
 
   /* Configure the I2S peripheral */
@@ -789,8 +813,9 @@ uint8_t BSP_AUDIO_IN_Resume(void)
 
 /**
   * @brief  Controls the audio in volume level. 
-  * @param  Volume: Volume level to be set in percentage from 0% to 100% (0 for 
-  *         Mute and 100 for Max volume level).
+  * @param  Volume: Linear gain of the PDM decimator, in units of 1 / PDM_GAIN_UNITY
+  *         (8 for 0 dB, 0 for Mute); see DEFAULT_AUDIO_IN_VOLUME.
+  * @note   Unlike the ST PDM library, Volume is not a percentage.
   * @retval AUDIO_OK if correct communication, else wrong communication
   */
 uint8_t BSP_AUDIO_IN_SetVolume(uint8_t Volume)
@@ -804,30 +829,20 @@ uint8_t BSP_AUDIO_IN_SetVolume(uint8_t Volume)
 
 /**
   * @brief  Converts audio format from PDM to PCM.
+  * @note   The conversion is done in a single pass: the decimator reads the PDM
+  *         bytes straight from the DMA halfwords and writes stereo PCM samples.
   * @param  PDMBuf: Pointer to data PDM buffer
-  * @param  PCMBuf: Pointer to data PCM buffer
+  * @param  PCMBuf: Pointer to data PCM buffer (stereo, PCM_OUT_SIZE samples per channel)
   * @retval AUDIO_OK if correct communication, else wrong communication
   */
 uint8_t BSP_AUDIO_IN_PDMToPCM(uint16_t *PDMBuf, uint16_t *PCMBuf)
 {
-  uint16_t AppPDM[INTERNAL_BUFF_SIZE/2];
   uint32_t index = 0; 
   
-  /* PDM Demux */
-  for(index = 0; index<INTERNAL_BUFF_SIZE/2; index++)
-  {
-    AppPDM[index] = HTONS(PDMBuf[index]);
-  }
-  
   for(index = 0; index < DEFAULT_AUDIO_IN_CHANNEL_NBR; index++)
   {
-    /* PDM to PCM filter */
-    PDM_Filter_64_LSB((uint8_t*)&AppPDM[index], (uint16_t*)&(PCMBuf[index]), AudioInVolume , (PDMFilter_InitStruct *)&Filter[index]);
-  }
-  /* Duplicate samples since a single microphone in mounted on STM32F4-Discovery */
-  for(index = 0; index < PCM_OUT_SIZE; index++)
-  {
-    PCMBuf[(index<<1)+1] = PCMBuf[index<<1];
+    /* PDM to PCM filter, each filter reads and writes its own channel */
+    PDM_Process(&Filter[index], (uint8_t*)PDMBuf, (int16_t*)PCMBuf, PCM_OUT_SIZE, AudioInVolume);
   }
   
   /* Return AUDIO_OK when all operations are correctly done */
@@ -840,6 +855,12 @@ uint8_t BSP_AUDIO_IN_PDMToPCM(uint16_t *PDMBuf, uint16_t *PCMBuf)
   */
 void HAL_I2S_RxCpltCallback(I2S_HandleTypeDef *hi2s)
 {
+  if(LoopbackRunning)
+  {
+    /* The second half of the record buffer is ready */
+    Loopback_Capture(&LoopbackPDM[INTERNAL_BUFF_SIZE/2]);
+    return;
+  }
   /* Call the record update function to get the next buffer to fill and its size (size is ignored) */
   BSP_AUDIO_IN_TransferComplete_CallBack();
 }
@@ -850,6 +871,12 @@ void HAL_I2S_RxCpltCallback(I2S_HandleTypeDef *hi2s)
   */
 void HAL_I2S_RxHalfCpltCallback(I2S_HandleTypeDef *hi2s)
 {
+  if(LoopbackRunning)
+  {
+    /* The first half of the record buffer is ready */
+    Loopback_Capture(LoopbackPDM);
+    return;
+  }
   /* Manage the remaining file size and new address offset: This function 
      should be coded by user (its prototype is already declared in stm32f4_discovery_audio.h) */
   BSP_AUDIO_IN_HalfTransfer_CallBack();
@@ -1021,12 +1048,188 @@ __weak void BSP_AUDIO_IN_Error_Callback(void)
      error occurs. */
 }
 
+/*******************************************************************************
+                            Loopback Functions
+*******************************************************************************/
+
+/**
+  * @brief  Configures the codec output and the microphone input for the loopback.
+  * @param  OutputDevice: OUTPUT_DEVICE_SPEAKER, OUTPUT_DEVICE_HEADPHONE,
+  *                       OUTPUT_DEVICE_BOTH or OUTPUT_DEVICE_AUTO .
+  * @param  Volume: Initial output volume level (from 0 (Mute) to 100 (Max))
+  * @param  AudioFreq: Audio frequency, must be DEFAULT_AUDIO_IN_FREQ (the record
+  *                    buffers are sized on it).
+  * @retval AUDIO_OK if correct communication, else wrong communication
+  */
+uint8_t BSP_AUDIO_LOOPBACK_Init(uint16_t OutputDevice, uint8_t Volume, uint32_t AudioFreq)
+{
+  if(AudioFreq != DEFAULT_AUDIO_IN_FREQ)
+  {
+    return AUDIO_ERROR;
+  }
+  
+  if(BSP_AUDIO_IN_Init(AudioFreq, DEFAULT_AUDIO_IN_BIT_RESOLUTION, DEFAULT_AUDIO_IN_CHANNEL_NBR) != AUDIO_OK)
+  {
+    return AUDIO_ERROR;
+  }
+  if(BSP_AUDIO_OUT_Init(OutputDevice, Volume, AudioFreq) != AUDIO_OK)
+  {
+    return AUDIO_ERROR;
+  }
+  
+  /* Both I2S run from the PLLI2S, which has just been reprogrammed for the output:
+     the I2S2 prescaler must be computed again on the new clock */
+  I2S2_Init(AudioFreq);
+  
+  /* The decimator writes stereo frames straight into the pipeline blocks */
+  AUDIOPIPE_Init(&LoopbackPipe, LoopbackPool, AUDIO_LOOPBACK_BLOCKS, PCM_OUT_SIZE, 2,
+                 AUDIO_LOOPBACK_LATENCY, Loopback_Process, NULL);
+  
+  return AUDIO_OK;
+}
+
+/**
+  * @brief  Starts streaming the microphone to the codec.
+  * @note   The playback DMA runs in double buffer mode: on each buffer switch the
+  *         buffer just played goes back to the pipeline and the next block replaces it.
+  * @retval AUDIO_OK if correct communication, else wrong communication
+  */
+uint8_t BSP_AUDIO_LOOPBACK_Start(void)
+{
+  DMA_HandleTypeDef *hdma = hAudioOutI2s.hdmatx;
+  const int16_t *m0 = AUDIOPIPE_Play(&LoopbackPipe, NULL);
+  const int16_t *m1 = AUDIOPIPE_Play(&LoopbackPipe, NULL);
+  
+  /* Power up the codec, no data is transferred by the codec driver */
+  if(pAudioDrv->Play(AUDIO_I2C_ADDRESS, NULL, 0) != 0)
+  {
+    return AUDIO_ERROR;
+  }
+  
+  hdma->XferCpltCallback   = Loopback_TxM0Cplt;
+  hdma->XferM1CpltCallback = Loopback_TxM1Cplt;
+  hdma->XferErrorCallback  = Loopback_TxError;
+  hdma->XferHalfCpltCallback = NULL;
+  hdma->XferM1HalfCpltCallback = NULL;
+  if(HAL_DMAEx_MultiBufferStart_IT(hdma, (uint32_t)m0, (uint32_t)&hAudioOutI2s.Instance->DR,
+                                   (uint32_t)m1, PCM_OUT_SIZE * 2) != HAL_OK)
+  {
+    return AUDIO_ERROR;
+  }
+  
+  /* Let HAL_I2S_DMAStop() know the transmission is in progress */
+  hAudioOutI2s.State = HAL_I2S_STATE_BUSY_TX;
+  SET_BIT(hAudioOutI2s.Instance->CR2, SPI_CR2_TXDMAEN);
+  __HAL_I2S_ENABLE(&hAudioOutI2s);
+  
+  LoopbackRunning = 1;
+  if(BSP_AUDIO_IN_Record(LoopbackPDM, INTERNAL_BUFF_SIZE) != AUDIO_OK)
+  {
+    LoopbackRunning = 0;
+    return AUDIO_ERROR;
+  }
+  
+  return AUDIO_OK;
+}
+
+/**
+  * @brief  Stops the loopback and the codec.
+  * @param  Option: see BSP_AUDIO_OUT_Stop()
+  * @retval AUDIO_OK if correct communication, else wrong communication
+  */
+uint8_t BSP_AUDIO_LOOPBACK_Stop(uint32_t Option)
+{
+  BSP_AUDIO_IN_Stop();
+  LoopbackRunning = 0;
+  
+  return BSP_AUDIO_OUT_Stop(Option);
+}
+
+/**
+  * @brief  Returns the loopback counters.
+  * @param  pStats: Pointer to the counters copy
+  */
+void BSP_AUDIO_LOOPBACK_GetStats(AUDIOPIPE_Stats_t *pStats)
+{
+  *pStats = LoopbackPipe.stats;
+}
+
+/**
+  * @brief  Processes a recorded block before it is queued for playback.
+  * @param  pBuffer: Block samples (stereo, interleaved), to be processed in place
+  * @param  Frames: Number of frames in the block
+  */
+__weak void BSP_AUDIO_LOOPBACK_Process_CallBack(int16_t *pBuffer, uint32_t Frames)
+{
+  /* This function can be implemented by the user application (filters, effects...).
+     It runs in the record DMA interrupt and must end before the next half buffer. */
+}
+
+/**
+  * @brief  Decimates half of the record buffer into the pipeline blocks.
+  * @param  pPDM: Half of the record buffer
+  */
+static void Loopback_Capture(uint16_t *pPDM)
+{
+  uint32_t done = 0;
+  uint32_t room;
+  int16_t *dst;
+  
+  while(done < PCM_OUT_SIZE)
+  {
+    dst = AUDIOPIPE_CaptureBuffer(&LoopbackPipe, &room);
+    if(room > PCM_OUT_SIZE - done)
+    {
+      room = PCM_OUT_SIZE - done;
+    }
+    /* The PDM offset is always an even number of bytes, so the halfword swap still holds */
+    PDM_Process(&Filter[0], (uint8_t*)pPDM + done * DEFAULT_AUDIO_IN_DECIMATION / 8 * DEFAULT_AUDIO_IN_CHANNEL_NBR,
+                dst, room, AudioInVolume);
+    AUDIOPIPE_CaptureCommit(&LoopbackPipe, room);
+    done += room;
+  }
+}
+
+/**
+  * @brief  Pipeline processing hook, forwards the block to the user callback.
+  */
+static void Loopback_Process(void *ctx, int16_t *pBuffer, uint32_t Frames)
+{
+  BSP_AUDIO_LOOPBACK_Process_CallBack(pBuffer, Frames);
+}
+
+/**
+  * @brief  Memory 0 played: the DMA is reading memory 1, memory 0 gets the next block.
+  */
+static void Loopback_TxM0Cplt(DMA_HandleTypeDef *hdma)
+{
+  const int16_t *next = AUDIOPIPE_Play(&LoopbackPipe, (const int16_t*)hdma->Instance->M0AR);
+  HAL_DMAEx_ChangeMemory(hdma, (uint32_t)next, MEMORY0);
+}
+
+/**
+  * @brief  Memory 1 played: the DMA is reading memory 0, memory 1 gets the next block.
+  */
+static void Loopback_TxM1Cplt(DMA_HandleTypeDef *hdma)
+{
+  const int16_t *next = AUDIOPIPE_Play(&LoopbackPipe, (const int16_t*)hdma->Instance->M1AR);
+  HAL_DMAEx_ChangeMemory(hdma, (uint32_t)next, MEMORY1);
+}
+
+/**
+  * @brief  Playback DMA error during the loopback.
+  */
+static void Loopback_TxError(DMA_HandleTypeDef *hdma)
+{
+  BSP_AUDIO_OUT_Error_CallBack();
+}
+
 /*******************************************************************************
                             Static Functions
 *******************************************************************************/
 
 /**
-  * @brief  Initialize the PDM library.
+  * @brief  Initialize the PDM decimator.
   * @param  AudioFreq: Audio sampling frequency
   * @param  ChnlNbr: Number of audio channels (1: mono; 2: stereo)
   */
@@ -1034,20 +1237,13 @@ static void PDMDecoder_Init(uint32_t AudioFreq, uint32_t ChnlNbr)
 { 
   uint32_t i = 0;
   
-  /* Enable CRC peripheral to unlock the PDM library */
-  __CRC_CLK_ENABLE();
-  
   for(i = 0; i < ChnlNbr; i++)
   {
-    /* Filter LP and HP Init */
-    Filter[i].LP_HZ = AudioFreq / 2;
-    Filter[i].HP_HZ = 10;
-    Filter[i].Fs = AudioFreq;
-    /* On STM32F4-Discovery a single microphone is mounted, samples are duplicated
+    /* The I2S shifts the PDM bits in MSB first and the DMA stores them as halfwords,
+       10 Hz DC-blocking filter.
+       On STM32F4-Discovery a single microphone is mounted, samples are duplicated
        to make stereo audio streams */
-    Filter[i].Out_MicChannels = 2;
-    Filter[i].In_MicChannels = ChnlNbr; 
-    PDM_Filter_Init((PDMFilter_InitStruct *)&Filter[i]);
+    PDM_Init(&Filter[i], DEFAULT_AUDIO_IN_DECIMATION, PDM_MSB_FIRST_HALFWORD, AudioFreq, 10, i, ChnlNbr, 2);
   }  
 }
 
@@ -0,0 +1,137 @@
+/**
+ * @file audiopipe.c
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "audiopipe.h"
+#include <assert.h>
+#include <stddef.h>
+#include <string.h>
+
+#define AUDIOPIPE_MASK	(AUDIOPIPE_MAX_BLOCKS - 1)
+
+#if (AUDIOPIPE_MAX_BLOCKS & AUDIOPIPE_MASK) != 0 || AUDIOPIPE_MAX_BLOCKS > 256
+#error "AUDIOPIPE_MAX_BLOCKS deve essere una potenza di 2, al piu' 256"
+#endif
+
+/**
+ * @brief Restituisce l'indirizzo del blocco i-esimo del pool.
+ */
+static inline int16_t* AUDIOPIPE_Block(const AUDIOPIPE_t* p, uint32_t i) {
+	return p->pool + i * p->frames * p->channels;
+}
+
+void AUDIOPIPE_Init(AUDIOPIPE_t* p, int16_t* pool, uint16_t blocks, uint16_t frames, uint8_t channels,
+		uint32_t target, AUDIOPIPE_Process_t process, void* ctx) {
+	assert(p && pool);
+	assert(blocks >= 4 && blocks <= AUDIOPIPE_MAX_BLOCKS);
+	assert(frames > 0 && channels > 0);
+	assert(target >= frames && target <= (uint32_t)(blocks - 3) * frames);
+	memset(p, 0, sizeof(AUDIOPIPE_t));
+	p->pool = pool;
+	p->blocks = blocks;
+	p->frames = frames;
+	p->channels = channels;
+	p->target = target;
+	p->process = process;
+	p->ctx = ctx;
+	memset(AUDIOPIPE_Block(p, blocks), 0, frames * channels * sizeof(int16_t));
+	// il blocco 0 e' dell'acquisizione, gli altri sono liberi
+	p->current = 0;
+	for (uint16_t i = 1; i < blocks; i++)
+		p->free[p->freeHead++ & AUDIOPIPE_MASK] = (uint8_t)i;
+}
+
+int16_t* AUDIOPIPE_CaptureBuffer(AUDIOPIPE_t* p, uint32_t* room) {
+	assert(p && room);
+	*room = p->frames - p->cursor;
+	return AUDIOPIPE_Block(p, p->current) + p->cursor * p->channels;
+}
+
+void AUDIOPIPE_CaptureCommit(AUDIOPIPE_t* p, uint32_t frames) {
+	assert(p);
+	assert(p->cursor + frames <= p->frames);
+	p->cursor += frames;
+	if (p->cursor < p->frames)
+		return;
+
+	if (p->running) {
+		p->slip += (int32_t)AUDIOPIPE_Level(p) - (int32_t)p->target;
+		if (p->slip >= AUDIOPIPE_SLIP_GAIN) {
+			// acquisizione piu' veloce: l'ultimo frame verra' sovrascritto dal prossimo
+			p->slip -= AUDIOPIPE_SLIP_GAIN;
+			p->cursor--;
+			p->stats.dropped++;
+			return;
+		}
+	}
+	else
+		p->slip = 0;
+
+	if ((uint16_t)(p->freeHead - p->freeTail) == 0) {
+		// nessun blocco libero: la riproduzione e' ferma o troppo lenta, il blocco viene riusato
+		p->cursor = 0;
+		p->stats.overruns++;
+		return;
+	}
+	uint8_t next = p->free[p->freeTail & AUDIOPIPE_MASK];
+	p->freeTail++;
+	int16_t* block = AUDIOPIPE_Block(p, p->current);
+	p->cursor = 0;
+	if (p->slip <= -AUDIOPIPE_SLIP_GAIN) {
+		// acquisizione piu' lenta: l'ultimo frame, non ancora elaborato, viene ripetuto nel blocco successivo
+		p->slip += AUDIOPIPE_SLIP_GAIN;
+		memcpy(AUDIOPIPE_Block(p, next), block + (p->frames - 1) * p->channels, p->channels * sizeof(int16_t));
+		p->cursor = 1;
+		p->stats.inserted++;
+	}
+	if (p->process)
+		p->process(p->ctx, block, p->frames);
+	p->ready[p->readyHead & AUDIOPIPE_MASK] = p->current;
+	p->readyHead++;
+	p->current = next;
+	p->stats.captured++;
+}
+
+const int16_t* AUDIOPIPE_Play(AUDIOPIPE_t* p, const int16_t* done) {
+	assert(p);
+	const int16_t* silence = AUDIOPIPE_Block(p, p->blocks);
+	if (done && done != silence) {
+		p->free[p->freeHead & AUDIOPIPE_MASK] = (uint8_t)((done - p->pool) / (p->frames * p->channels));
+		p->freeHead++;
+		p->stats.played++;
+	}
+	uint16_t queued = (uint16_t)(p->readyHead - p->readyTail);
+	if (!p->running) {
+		if ((uint32_t)queued * p->frames < p->target)
+			return silence;
+		p->running = 1;
+	}
+	if (queued == 0) {
+		p->running = 0;
+		p->stats.underruns++;
+		return silence;
+	}
+	const int16_t* block = AUDIOPIPE_Block(p, p->ready[p->readyTail & AUDIOPIPE_MASK]);
+	p->readyTail++;
+	return block;
+}
+
+uint32_t AUDIOPIPE_Level(const AUDIOPIPE_t* p) {
+	assert(p);
+	return (uint16_t)(p->readyHead - p->readyTail) * p->frames + p->cursor;
+}
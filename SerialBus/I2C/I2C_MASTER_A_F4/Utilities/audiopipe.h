@@ -0,0 +1,167 @@
+/**
+ * @file audiopipe.h
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef AUDIOPIPE_H_
+#define AUDIOPIPE_H_
+
+/**
+ * @addtogroup BSP
+ * @{
+ * @defgroup AUDIOPIPE
+ * @{
+ *
+ * @brief Pipeline audio a blocchi tra un produttore (acquisizione) e un consumatore (riproduzione) con clock diversi.
+ *
+ * @details
+ * I campioni PCM, interlacciati, sono raccolti in blocchi di dimensione fissa presi da un pool fornito dal chiamante.
+ * I blocchi non vengono mai copiati: passano di proprieta' dall'acquisizione alla riproduzione e ritornano al pool:
+ *  - l'acquisizione scrive i campioni direttamente nel blocco corrente (AUDIOPIPE_CaptureBuffer()) e li conferma con
+ *    AUDIOPIPE_CaptureCommit(). Quando il blocco e' pieno viene elaborato dalla funzione di elaborazione opzionale
+ *    e accodato, e l'acquisizione prende un blocco libero;
+ *  - la riproduzione, a ogni fine blocco, restituisce il blocco appena riprodotto e ottiene il successivo con
+ *    AUDIOPIPE_Play(); il blocco restituito e' quello da cui leggera' il DMA.
+ *
+ * Le code dei blocchi pronti e dei blocchi liberi sono code a singolo produttore e singolo consumatore, per cui le due
+ * parti possono girare in interruzioni diverse, con priorita' qualsiasi, senza sezioni critiche.<br>
+ * La latenza e' controllata dal livello obiettivo, in frame, dei campioni accumulati tra le due parti: la
+ * riproduzione parte (e riparte dopo un underrun) solo quando il livello lo raggiunge, e fino ad allora riproduce
+ * silenzio. I due clock non sono mai esattamente uguali: a ogni blocco acquisito l'errore tra il livello e
+ * l'obiettivo viene integrato e, ogni AUDIOPIPE_SLIP_GAIN frame di errore accumulato, viene scartato (acquisizione
+ * piu' veloce) o duplicato (acquisizione piu' lenta) un frame al confine tra due blocchi. Il controllo e' del primo
+ * ordine, con costante di tempo di AUDIOPIPE_SLIP_GAIN blocchi: un frame inserito o scartato ogni tanto e' inudibile,
+ * al contrario dei buchi dovuti a un underrun o a un overrun, che vengono contati.<br>
+ * Il modulo non dipende dalla libreria HAL, per cui puo' essere compilato e verificato anche su un host.
+ */
+
+#include <inttypes.h>
+
+/**
+ * @brief Numero massimo di blocchi del pool (potenza di 2).
+ */
+#ifndef AUDIOPIPE_MAX_BLOCKS
+#define AUDIOPIPE_MAX_BLOCKS	16
+#endif
+
+/**
+ * @brief Errore accumulato, in frame per blocco, che produce l'inserimento o lo scarto di un frame.
+ * @details Sotto l'obiettivo l'errore e' limitato dal livello stesso, per cui la massima deriva compensata, in frame
+ * per frame, e' (target - frames) / (frames * AUDIOPIPE_SLIP_GAIN): circa 4000 ppm con un obiettivo di due blocchi.
+ */
+#ifndef AUDIOPIPE_SLIP_GAIN
+#define AUDIOPIPE_SLIP_GAIN		256
+#endif
+
+/**
+ * @brief Funzione di elaborazione di un blocco, chiamata in acquisizione prima di accodarlo.
+ * @param[in] ctx contesto passato ad AUDIOPIPE_Init()
+ * @param[inout] block campioni del blocco, interlacciati
+ * @param[in] frames numero di frame del blocco
+ */
+typedef void (*AUDIOPIPE_Process_t)(void* ctx, int16_t* block, uint32_t frames);
+
+/**
+ * @brief Contatori della pipeline.
+ */
+typedef struct {
+	uint32_t captured;			//!< blocchi acquisiti e accodati
+	uint32_t played;			//!< blocchi riprodotti (escluso il silenzio)
+	uint32_t underruns;			//!< blocchi di silenzio riprodotti perche' la coda era vuota
+	uint32_t overruns;			//!< blocchi acquisiti e scartati perche' il pool era esaurito
+	uint32_t dropped;			//!< frame scartati dalla compensazione della deriva
+	uint32_t inserted;			//!< frame duplicati dalla compensazione della deriva
+} AUDIOPIPE_Stats_t;
+
+/**
+ * @brief Struttura che rappresenta la pipeline.
+ */
+typedef struct {
+	int16_t* pool;								//!< pool di blocchi; l'ultimo e' il silenzio
+	uint16_t blocks;							//!< blocchi utilizzabili, escluso il silenzio
+	uint16_t frames;							//!< frame per blocco
+	uint8_t channels;							//!< campioni per frame
+	uint32_t target;							//!< livello obiettivo, in frame
+	AUDIOPIPE_Process_t process;				//!< elaborazione dei blocchi acquisiti, opzionale
+	void* ctx;									//!< contesto della funzione di elaborazione
+	uint8_t ready[AUDIOPIPE_MAX_BLOCKS];		//!< coda dei blocchi pronti
+	volatile uint16_t readyHead;				//!< scritto solo dall'acquisizione
+	volatile uint16_t readyTail;				//!< scritto solo dalla riproduzione
+	uint8_t free[AUDIOPIPE_MAX_BLOCKS];			//!< coda dei blocchi liberi
+	volatile uint16_t freeHead;					//!< scritto solo dalla riproduzione
+	volatile uint16_t freeTail;					//!< scritto solo dall'acquisizione
+	uint8_t current;							//!< blocco in acquisizione
+	uint16_t cursor;							//!< frame gia' scritti nel blocco in acquisizione
+	int32_t slip;								//!< errore di livello integrato, in frame
+	volatile uint8_t running;					//!< 1 se la riproduzione ha raggiunto il livello obiettivo
+	AUDIOPIPE_Stats_t stats;					//!< contatori
+} AUDIOPIPE_t;
+
+/**
+ * @brief Inizializza la pipeline.
+ * @param[out] p puntatore alla pipeline
+ * @param[in] pool memoria dei blocchi, (blocks + 1) * frames * channels campioni; l'ultimo blocco e' il silenzio
+ * @param[in] blocks numero di blocchi utilizzabili, da 4 a AUDIOPIPE_MAX_BLOCKS: due sono sempre del DMA di
+ * riproduzione e uno dell'acquisizione
+ * @param[in] frames frame per blocco
+ * @param[in] channels campioni per frame
+ * @param[in] target livello obiettivo, in frame, accumulato tra acquisizione e riproduzione (latenza)
+ * @param[in] process funzione di elaborazione dei blocchi acquisiti, oppure NULL
+ * @param[in] ctx contesto della funzione di elaborazione
+ */
+void AUDIOPIPE_Init(AUDIOPIPE_t* p, int16_t* pool, uint16_t blocks, uint16_t frames, uint8_t channels,
+		uint32_t target, AUDIOPIPE_Process_t process, void* ctx);
+
+/**
+ * @brief Restituisce la posizione in cui scrivere i prossimi frame acquisiti.
+ * @param[inout] p puntatore alla pipeline
+ * @param[out] room numero di frame contigui disponibili nel blocco corrente
+ * @return puntatore al primo campione libero del blocco corrente
+ */
+int16_t* AUDIOPIPE_CaptureBuffer(AUDIOPIPE_t* p, uint32_t* room);
+
+/**
+ * @brief Conferma i frame scritti nel blocco corrente.
+ * @details Se il blocco e' pieno lo elabora, lo accoda e prende un nuovo blocco libero; in questo momento viene
+ * anche applicata la compensazione della deriva. Se non ci sono blocchi liberi, il blocco viene scartato e riusato.
+ * @param[inout] p puntatore alla pipeline
+ * @param[in] frames numero di frame scritti, al piu' quelli restituiti da AUDIOPIPE_CaptureBuffer()
+ */
+void AUDIOPIPE_CaptureCommit(AUDIOPIPE_t* p, uint32_t frames);
+
+/**
+ * @brief Passa alla riproduzione del blocco successivo.
+ * @details Va chiamata quando il DMA ha finito di leggere un blocco: il blocco torna al pool e viene restituito il
+ * prossimo blocco pronto, oppure il silenzio se la pipeline non ha raggiunto il livello obiettivo (underrun).
+ * @param[inout] p puntatore alla pipeline
+ * @param[in] done blocco appena riprodotto, oppure NULL all'avvio
+ * @return blocco da riprodurre
+ */
+const int16_t* AUDIOPIPE_Play(AUDIOPIPE_t* p, const int16_t* done);
+
+/**
+ * @brief Livello corrente, in frame, dei campioni accumulati tra acquisizione e riproduzione.
+ * @param[in] p puntatore alla pipeline
+ */
+uint32_t AUDIOPIPE_Level(const AUDIOPIPE_t* p);
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* AUDIOPIPE_H_ */
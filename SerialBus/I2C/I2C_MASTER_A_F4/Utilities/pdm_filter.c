@@ -0,0 +1,247 @@
+/**
+ * @file pdm_filter.c
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "pdm_filter.h"
+#include <assert.h>
+#include <string.h>
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+/**
+ * @brief Lunghezza del seno cardinale del primo stadio, PDM_CIC_ORDER * 7 + 1.
+ */
+#define PDM_SINC_TAPS	(PDM_CIC_ORDER * 7 + 1)
+
+/**
+ * @brief Coefficienti pari del filtro half-band, in Q15; il coefficiente centrale vale 0.5.
+ * @details Sono simmetrici, per cui l'ordine della finestra dei campioni e' indifferente.
+ */
+static const int16_t PDM_HalfBand[PDM_HB_TAPS] = {
+	-1, 3, -6, 10, -17, 25, -36, 50, -69, 92, -120, 156, -199, 252, -316, 396,
+	-496, 623, -792, 1028, -1386, 2011, -3431, 10415, 10415, -3431, 2011, -1386, 1028, -792, 623, -496,
+	396, -316, 252, -199, 156, -120, 92, -69, 50, -36, 25, -17, 10, -6, 3, -1
+};
+
+/**
+ * @brief Tabella del primo stadio: PDM_Table[j][b] e' il contributo del byte b ricevuto j byte prima del corrente.
+ * @details E' costruita da PDM_Init() per byte con il bit piu' significativo per primo; la somma di una riga vale al
+ * piu' 8^5, per cui entra in 16 bit senza segno.
+ */
+static uint16_t PDM_Table[PDM_CIC_BYTES][256];
+static uint8_t PDM_TableReady = 0;
+
+/**
+ * @brief Costruisce la tabella del primo stadio, convolvendo PDM_CIC_ORDER finestre rettangolari di lunghezza 8.
+ */
+static void PDM_BuildTable(void) {
+	uint32_t h[PDM_CIC_BYTES * 8];
+	memset(h, 0, sizeof(h));
+	h[0] = 1;
+	for (int n = 0; n < PDM_CIC_ORDER; n++)
+		for (int k = PDM_SINC_TAPS - 1; k >= 0; k--) {
+			uint32_t acc = 0;
+			for (int i = 0; i < 8 && i <= k; i++)
+				acc += h[k - i];
+			h[k] = acc;
+		}
+	// il bit i del byte ricevuto j byte prima e' il campione di ritardo 8j + i
+	for (int j = 0; j < PDM_CIC_BYTES; j++)
+		for (int b = 0; b < 256; b++) {
+			uint32_t acc = 0;
+			for (int i = 0; i < 8; i++)
+				if (b & (1 << i))
+					acc += h[8 * j + i];
+			PDM_Table[j][b] = (uint16_t)acc;
+		}
+	PDM_TableReady = 1;
+}
+
+/**
+ * @brief Inverte l'ordine dei bit di un byte.
+ */
+static inline uint8_t PDM_Reverse(uint8_t b) {
+	b = (uint8_t)((b >> 4) | (b << 4));
+	b = (uint8_t)(((b & 0xCC) >> 2) | ((b & 0x33) << 2));
+	return (uint8_t)(((b & 0xAA) >> 1) | ((b & 0x55) << 1));
+}
+
+/**
+ * @brief Prodotto scalare di due coppie di valori a 16 bit con accumulo, acc + x.lo * y.lo + x.hi * y.hi.
+ * @details Sui core con estensione DSP (Cortex-M4) e' una singola istruzione SMLAD.
+ */
+static inline int32_t PDM_Smlad(uint32_t x, uint32_t y, int32_t acc) {
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+	int32_t result;
+	__asm__ ("smlad %0, %1, %2, %3" : "=r" (result) : "r" (x), "r" (y), "r" (acc));
+	return result;
+#else
+	return acc + (int16_t)x * (int16_t)y + (int16_t)(x >> 16) * (int16_t)(y >> 16);
+#endif
+}
+
+/**
+ * @brief Prodotto scalare tra la finestra dei campioni pari e i coefficienti del filtro half-band.
+ * @details Su x86 i prodotti sono calcolati con PMADDWD su 16 (AVX2) o 8 (SSE2) campioni alla volta, altrimenti a
+ * coppie con PDM_Smlad(). Le somme parziali sono a 32 bit in tutte le versioni e nessun coefficiente vale -32768,
+ * per cui il risultato e' identico.
+ */
+static inline int32_t PDM_HalfBandDot(const int16_t* x, int32_t acc) {
+#if defined(__AVX2__)
+	__m256i s = _mm256_madd_epi16(_mm256_loadu_si256((const __m256i*)x),
+			_mm256_loadu_si256((const __m256i*)PDM_HalfBand));
+	for (int k = 16; k < PDM_HB_TAPS; k += 16)
+		s = _mm256_add_epi32(s, _mm256_madd_epi16(_mm256_loadu_si256((const __m256i*)&x[k]),
+				_mm256_loadu_si256((const __m256i*)&PDM_HalfBand[k])));
+	__m128i h = _mm_add_epi32(_mm256_castsi256_si128(s), _mm256_extracti128_si256(s, 1));
+	h = _mm_add_epi32(h, _mm_shuffle_epi32(h, _MM_SHUFFLE(1, 0, 3, 2)));
+	h = _mm_add_epi32(h, _mm_shuffle_epi32(h, _MM_SHUFFLE(2, 3, 0, 1)));
+	return acc + _mm_cvtsi128_si32(h);
+#elif defined(__SSE2__)
+	__m128i s = _mm_madd_epi16(_mm_loadu_si128((const __m128i*)x), _mm_loadu_si128((const __m128i*)PDM_HalfBand));
+	for (int k = 8; k < PDM_HB_TAPS; k += 8)
+		s = _mm_add_epi32(s, _mm_madd_epi16(_mm_loadu_si128((const __m128i*)&x[k]),
+				_mm_loadu_si128((const __m128i*)&PDM_HalfBand[k])));
+	s = _mm_add_epi32(s, _mm_shuffle_epi32(s, _MM_SHUFFLE(1, 0, 3, 2)));
+	s = _mm_add_epi32(s, _mm_shuffle_epi32(s, _MM_SHUFFLE(2, 3, 0, 1)));
+	return acc + _mm_cvtsi128_si32(s);
+#else
+	for (int k = 0; k < PDM_HB_TAPS; k += 2) {
+		uint32_t xx, hh;
+		memcpy(&xx, &x[k], sizeof(xx));
+		memcpy(&hh, &PDM_HalfBand[k], sizeof(hh));
+		acc = PDM_Smlad(xx, hh, acc);
+	}
+	return acc;
+#endif
+}
+
+/**
+ * @brief Satura un valore a 16 bit con segno.
+ */
+static inline int16_t PDM_Saturate(int32_t x) {
+	if (x > INT16_MAX)
+		return INT16_MAX;
+	if (x < INT16_MIN)
+		return INT16_MIN;
+	return (int16_t)x;
+}
+
+/**
+ * @brief Produce un campione CIC, alla frequenza doppia di quella di uscita, consumando cicBytes byte PDM.
+ * @param[inout] inPos offset, nel buffer PDM, del prossimo byte del canale
+ * @return campione in Q15, dove +-1 corrisponde a un segnale PDM a fondo scala
+ */
+static int16_t PDM_Cic(PDM_Filter_t* f, const uint8_t* in, uint32_t* inPos) {
+	uint32_t pos = *inPos;
+	uint32_t bits = f->bits;
+	uint32_t i0 = f->integ[0], i1 = f->integ[1], i2 = f->integ[2], i3 = f->integ[3], i4 = f->integ[4];
+	for (int n = 0; n < f->cicBytes; n++) {
+		uint8_t b = in[pos ^ f->swap];
+		pos += f->inChannels;
+		if (f->lsbFirst)
+			b = PDM_Reverse(b);
+		i0 += (uint32_t)PDM_Table[0][b] + PDM_Table[1][bits & 0xFF] + PDM_Table[2][(bits >> 8) & 0xFF]
+				+ PDM_Table[3][(bits >> 16) & 0xFF] + PDM_Table[4][bits >> 24];
+		i1 += i0;
+		i2 += i1;
+		i3 += i2;
+		i4 += i3;
+		bits = (bits << 8) | b;
+	}
+	f->bits = bits;
+	f->integ[0] = i0;
+	f->integ[1] = i1;
+	f->integ[2] = i2;
+	f->integ[3] = i3;
+	f->integ[4] = i4;
+	*inPos = pos;
+
+	uint32_t y = i4;
+	for (int k = 0; k < PDM_CIC_ORDER; k++) {
+		uint32_t d = y - f->comb[k];
+		f->comb[k] = y;
+		y = d;
+	}
+	int64_t q = ((int64_t)(int32_t)(y - f->cicHalf) * f->cicScale) >> 32;
+	return PDM_Saturate((int32_t)q);
+}
+
+/**
+ * @brief Filtro half-band: riceve una coppia di campioni CIC (prima il dispari, poi il pari) e produce un campione.
+ * @return campione in Q15, non saturato
+ */
+static int32_t PDM_HalfBandStep(PDM_Filter_t* f, int16_t odd, int16_t even) {
+	f->even[f->evenPos] = even;
+	f->even[f->evenPos + PDM_HB_TAPS] = even;
+	if (++f->evenPos == PDM_HB_TAPS)
+		f->evenPos = 0;
+	int16_t center = f->odd[f->oddPos];
+	f->odd[f->oddPos] = odd;
+	if (++f->oddPos == PDM_HB_DELAY)
+		f->oddPos = 0;
+
+	return PDM_HalfBandDot(&f->even[f->evenPos], (int32_t)center << 14) >> 15;
+}
+
+int PDM_Init(PDM_Filter_t* f, uint16_t decimation, PDM_Format_t format, uint32_t fs, uint16_t hpCutoff,
+		uint8_t channel, uint8_t inChannels, uint8_t outChannels) {
+	assert(f);
+	assert(fs > 0);
+	assert(channel < inChannels && inChannels <= outChannels);
+	if (decimation != 64 && decimation != 80 && decimation != 128)
+		return -1;
+	if (!PDM_TableReady)
+		PDM_BuildTable();
+	memset(f, 0, sizeof(PDM_Filter_t));
+	f->decimation = decimation;
+	f->cicBytes = (uint8_t)(decimation / 16);
+	f->lsbFirst = (uint8_t)(format & 1);
+	f->swap = (uint8_t)(format >> 1);
+	f->channel = channel;
+	f->inChannels = inChannels;
+	f->outChannels = outChannels;
+	uint64_t gain = 1;
+	for (int k = 0; k < PDM_CIC_ORDER; k++)
+		gain *= decimation / 2;
+	f->cicHalf = (uint32_t)(gain / 2);
+	f->cicScale = (uint32_t)((1ULL << 48) / gain);
+	// polo del passa-alto in Q30: 1 - 2 pi fc / fs, con 6588397 = 2 pi 2^20
+	f->hpCoeff = (int32_t)((1 << 30) - (int32_t)((6588397ULL * hpCutoff << 10) / fs));
+	return 0;
+}
+
+void PDM_Process(PDM_Filter_t* f, const uint8_t* in, int16_t* out, uint32_t count, uint16_t gain) {
+	assert(f && in && out);
+	uint32_t pos = f->channel;
+	out += f->channel;
+	for (uint32_t n = 0; n < count; n++) {
+		int16_t odd = PDM_Cic(f, in, &pos);
+		int16_t even = PDM_Cic(f, in, &pos);
+		int32_t x = PDM_HalfBandStep(f, odd, even);
+		// y[n] = x[n] - x[n-1] + a y[n-1], con 8 bit frazionari sull'uscita
+		int32_t y = ((x - f->hpIn) << 8) + (int32_t)(((int64_t)f->hpCoeff * f->hpOut) >> 30);
+		f->hpIn = x;
+		f->hpOut = y;
+		int16_t v = PDM_Saturate((int32_t)(((int64_t)y * gain) >> (8 + PDM_GAIN_SHIFT)));
+		for (uint8_t c = 0; c < f->outChannels; c += f->inChannels)
+			out[c] = v;
+		out += f->outChannels;
+	}
+}
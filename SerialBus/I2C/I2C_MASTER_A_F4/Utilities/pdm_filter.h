@@ -1,76 +1,140 @@
 /**
-  ******************************************************************************
-  * @file    pdm_filter.h
-  * @author  MCD Application Team
-  * @version V2.1.0
-  * @date    31-March-2015
-  * @brief   Header file for PDM audio software decoding Library.   
-  *          This Library is used to decode and reconstruct the audio signal
-  *          produced by ST MEMS microphone (MP45Dxxx, MP34Dxxx).
-  *          For more details about this Library, please refer to document
-  *          "PDM audio software decoding on STM32 microcontrollers (AN3998)".  
- ******************************************************************************
-  * @attention
-  *
-  * <h2><center>&copy; COPYRIGHT 2015 STMicroelectronics</center></h2>
-  *
-  * Licensed under MCD-ST Image SW License Agreement V2, (the "License");
-  * You may not use this file except in compliance with the License.
-  * You may obtain a copy of the License at:
-  *
-  *        http://www.st.com/software_license_agreement_image_v2
-  *
-  * Unless required by applicable law or agreed to in writing, software 
-  * distributed under the License is distributed on an "AS IS" BASIS, 
-  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
-  * See the License for the specific language governing permissions and
-  * limitations under the License.
-  *
-  ******************************************************************************
-  */
+ * @file pdm_filter.h
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
 
-/* Define to prevent recursive inclusion -------------------------------------*/
-#ifndef __PDM_FILTER_H
-#define __PDM_FILTER_H
+#ifndef PDM_FILTER_H_
+#define PDM_FILTER_H_
 
-#ifdef __cplusplus
- extern "C" {
-#endif
-
-/* Includes ------------------------------------------------------------------*/
-#include <stdint.h>
+/**
+ * @addtogroup BSP
+ * @{
+ * @defgroup PDM_FILTER
+ * @{
+ *
+ * @brief Decimatore PDM/PCM in sorgente, che sostituisce la libreria binaria di ST.
+ *
+ * @details
+ * Converte il flusso a 1 bit di un microfono MEMS (MP45DT02 sulla STM32F4-Discovery) in campioni PCM a 16 bit,
+ * decimando di un fattore 64, 80 o 128, con una catena di tre stadi:
+ *  - filtro CIC del quinto ordine, che decima di D/2. I primi 8 campioni di ogni integratore sono risolti con una
+ *    tabella: il CIC e' scomposto in un seno cardinale di lunghezza 8, calcolato un byte alla volta sommando cinque
+ *    valori di una tabella indicizzata dagli ultimi cinque byte ricevuti (i 36 coefficienti del filtro coprono cinque
+ *    byte), seguito da un CIC dello stesso ordine che decima di D/16 sui campioni a un ottavo della frequenza PDM.
+ *    La composizione ha esattamente la risposta di un CIC che decima di D/2, senza alcuna operazione per bit;
+ *  - filtro FIR half-band a 95 coefficienti (finestra di Kaiser), che decima di 2: ondulazione in banda passante sotto
+ *    0.01 dB fino a 0.45 fs e attenuazione di almeno 70 dB da 0.55 fs. Meta' dei coefficienti e' nulla, per cui si
+ *    calcolano solo i 48 coefficienti pari, a coppie con SMLAD sui Cortex-M4 e con SSE2 o AVX2 su x86 (se abilitati
+ *    dal compilatore), piu' il coefficiente centrale. Tutte le versioni producono lo stesso risultato;
+ *  - passa-alto del primo ordine che rimuove la componente continua, con frequenza di taglio configurabile.
+ *
+ * Il guadagno e' lineare, con PDM_GAIN_UNITY che corrisponde a un segnale PDM a fondo scala in uscita a fondo scala;
+ * l'uscita e' saturata a 16 bit. Il CIC attenua i toni a 0.45 fs di circa 3.7 dB (droop non compensato).<br>
+ * I canali sono indipendenti: piu' microfoni, con i byte interlacciati, si gestiscono con un filtro per canale, che
+ * legge e scrive solo il proprio canale dei buffer interlacciati. La conversione avviene in un solo passo sul buffer
+ * del DMA: i formati PDM_xxx_HALFWORD leggono i byte direttamente dalle halfword little endian ricevute da I2S/SPI, in
+ * cui il primo byte in ordine di tempo e' quello alto, senza copia ne' scambio dei byte; se i canali in uscita sono
+ * piu' di quelli in ingresso, ogni campione viene replicato sui canali in eccesso (un microfono su un flusso stereo).
+ * Il modulo non dipende dalla libreria HAL, per cui puo' essere compilato e verificato anche su un host.
+ */
 
+#include <inttypes.h>
 
-/* Exported types ------------------------------------------------------------*/
-typedef struct {
-  uint16_t Fs;
-  float LP_HZ;
-  float HP_HZ;
-  uint16_t In_MicChannels;
-  uint16_t Out_MicChannels;
-  char InternalFilter[34];
-} PDMFilter_InitStruct;
+#define PDM_CIC_ORDER		5			//!< Ordine del filtro CIC
+#define PDM_CIC_BYTES		5			//!< Byte coperti dal seno cardinale di lunghezza 8 del primo stadio
+#define PDM_HB_TAPS			48			//!< Coefficienti pari (non nulli) del filtro half-band
+#define PDM_HB_DELAY		23			//!< Ritardo, in coppie di campioni, del coefficiente centrale del filtro half-band
 
-/* Exported constants --------------------------------------------------------*/
-/* Exported macros -----------------------------------------------------------*/
-#define HTONS(A)  ((((uint16_t)(A) & 0xff00) >> 8) | \
-                   (((uint16_t)(A) & 0x00ff) << 8))
+/**
+ * @brief Scala del guadagno: il guadagno e' gain / PDM_GAIN_UNITY.
+ * @details Con il valore predefinito, il volume predefinito del BSP (64) corrisponde a 18 dB.
+ */
+#ifndef PDM_GAIN_SHIFT
+#define PDM_GAIN_SHIFT		3
+#endif
+#define PDM_GAIN_UNITY		(1 << PDM_GAIN_SHIFT)
 
-/* Exported functions ------------------------------------------------------- */
-void PDM_Filter_Init(PDMFilter_InitStruct * Filter);
+/**
+ * @brief Formato del flusso PDM: ordine dei bit in ciascun byte e dei byte in memoria.
+ */
+typedef enum {
+	PDM_MSB_FIRST = 0,			//!< byte in ordine di tempo, primo bit nel bit piu' significativo (ordine di I2S/SPI)
+	PDM_LSB_FIRST = 1,			//!< byte in ordine di tempo, primo bit nel bit meno significativo
+	PDM_MSB_FIRST_HALFWORD = 2,	//!< come PDM_MSB_FIRST, con i byte in halfword little endian (buffer del DMA di I2S/SPI)
+	PDM_LSB_FIRST_HALFWORD = 3	//!< come PDM_LSB_FIRST, con i byte in halfword little endian
+} PDM_Format_t;
 
-int32_t PDM_Filter_64_MSB(uint8_t* data, uint16_t* dataOut, uint16_t MicGain, PDMFilter_InitStruct * Filter);
-int32_t PDM_Filter_80_MSB(uint8_t* data, uint16_t* dataOut, uint16_t MicGain, PDMFilter_InitStruct * Filter);
-int32_t PDM_Filter_128_MSB(uint8_t* data, uint16_t* dataOut, uint16_t MicGain, PDMFilter_InitStruct * Filter);
-int32_t PDM_Filter_64_LSB(uint8_t* data, uint16_t* dataOut, uint16_t MicGain, PDMFilter_InitStruct * Filter);
-int32_t PDM_Filter_80_LSB(uint8_t* data, uint16_t* dataOut, uint16_t MicGain, PDMFilter_InitStruct * Filter);
-int32_t PDM_Filter_128_LSB(uint8_t* data, uint16_t* dataOut, uint16_t MicGain, PDMFilter_InitStruct * Filter);
+/**
+ * @brief Stato di un canale del decimatore.
+ */
+typedef struct {
+	uint16_t decimation;					//!< fattore di decimazione complessivo (64, 80 o 128)
+	uint8_t cicBytes;						//!< byte PDM per campione CIC, D/16
+	uint8_t lsbFirst;						//!< 1 se il primo bit di ogni byte e' il meno significativo
+	uint8_t swap;							//!< 1 se i byte sono in halfword little endian: l'offset va in xor con 1
+	uint8_t channel;						//!< canale, sia nel buffer PDM sia nel buffer PCM
+	uint8_t inChannels;						//!< microfoni interlacciati nel buffer PDM
+	uint8_t outChannels;					//!< canali interlacciati nel buffer PCM
+	uint32_t cicHalf;						//!< meta' del guadagno del CIC, (D/2)^5 / 2, da sottrarre all'uscita
+	uint32_t cicScale;						//!< 2^48 / (D/2)^5: porta l'uscita del CIC in Q15
+	uint32_t bits;							//!< ultimi quattro byte PDM ricevuti, il piu' recente negli 8 bit bassi
+	uint32_t integ[PDM_CIC_ORDER];			//!< integratori del CIC (aritmetica modulo 2^32)
+	uint32_t comb[PDM_CIC_ORDER];			//!< ritardi dei derivatori del CIC
+	int16_t even[2 * PDM_HB_TAPS];			//!< campioni pari del filtro half-band, duplicati per una finestra contigua
+	int16_t odd[PDM_HB_DELAY];				//!< linea di ritardo dei campioni dispari del filtro half-band
+	uint8_t evenPos;						//!< posizione del prossimo campione pari
+	uint8_t oddPos;							//!< posizione del prossimo campione dispari
+	int32_t hpCoeff;						//!< polo del passa-alto, in Q30
+	int32_t hpIn;							//!< ultimo ingresso del passa-alto
+	int32_t hpOut;							//!< ultima uscita del passa-alto, con 8 bit frazionari
+} PDM_Filter_t;
 
-#ifdef __cplusplus
-}
-#endif
+/**
+ * @brief Inizializza un canale del decimatore.
+ * @param[out] f puntatore al filtro
+ * @param[in] decimation fattore di decimazione: 64, 80 o 128
+ * @param[in] format formato del flusso PDM
+ * @param[in] fs frequenza di campionamento PCM in uscita (Hz)
+ * @param[in] hpCutoff frequenza di taglio del passa-alto (Hz); 0 lo disabilita
+ * @param[in] channel canale gestito dal filtro, da 0 a inChannels - 1
+ * @param[in] inChannels numero di microfoni, con i byte interlacciati, nel buffer PDM
+ * @param[in] outChannels numero di canali, con i campioni interlacciati, nel buffer PCM; deve essere almeno inChannels
+ * @retval 0 se il filtro e' stato inizializzato
+ * @retval -1 se il fattore di decimazione non e' supportato
+ */
+int PDM_Init(PDM_Filter_t* f, uint16_t decimation, PDM_Format_t format, uint32_t fs, uint16_t hpCutoff,
+		uint8_t channel, uint8_t inChannels, uint8_t outChannels);
 
-#endif /* __PDM_FILTER_H */
+/**
+ * @brief Converte un blocco di campioni.
+ * @details Consuma count * decimation / 8 byte PDM del canale e produce count campioni PCM. I buffer sono quelli
+ * interlacciati, comuni a tutti i canali: il filtro legge e scrive solo il proprio. Per i formati PDM_xxx_HALFWORD,
+ * in deve essere allineato a 16 bit.
+ * @param[inout] f puntatore al filtro
+ * @param[in] in inizio del buffer PDM
+ * @param[out] out inizio del buffer PCM
+ * @param[in] count numero di campioni PCM da produrre
+ * @param[in] gain guadagno, in unita' di 1 / PDM_GAIN_UNITY
+ */
+void PDM_Process(PDM_Filter_t* f, const uint8_t* in, int16_t* out, uint32_t count, uint16_t gain);
 
-/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
+/**
+ * @}
+ * @}
+ */
 
+#endif /* PDM_FILTER_H_ */
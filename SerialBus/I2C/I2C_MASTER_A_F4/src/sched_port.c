@@ -0,0 +1,184 @@
+/**
+ * @file sched_port.c
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+/**
+ * @addtogroup SCHED
+ * @{
+ * @defgroup SCHED_Port
+ * @{
+ *
+ * @brief Port dello scheduler per STM32F3/F4.
+ *
+ * @details
+ * Durante lo stop il SysTick e' fermo: la base dei tempi e' fornita dall'RTC, cloccato da LSI con il prescaler asincrono
+ * al minimo, per cui il registro dei sotto-secondi conta a LSI / 2 (62.5 us su F4, 50 us su F3). Il tempo trascorso in
+ * stop e' misurato confrontando l'orario dell'RTC prima e dopo lo stop, e viene sommato al contatore dei tick della HAL
+ * con SCHED_StopElapsed(), per cui HAL_GetTick() resta coerente.<br>
+ * All'ingresso in stop la frazione di millisecondo gia' contata da SysTick e' sommata al tempo recuperato; al risveglio,
+ * subito dopo la lettura dell'RTC, SysTick riparte da capo. In questo modo il tempo di ripristino del clock e di
+ * sincronizzazione dell'RTC e' contato una sola volta (dall'RTC), anche quando la riconfigurazione del clock riavvia
+ * SysTick (HAL_RCC_ClockConfig() richiama HAL_InitTick()), e l'errore di uwTick non si accumula tra uno stop e l'altro.<br>
+ * Il wakeup timer dell'RTC risveglia il processore alla scadenza del prossimo timer dello scheduler.
+ * @warning LSI ha una tolleranza elevata (fino a qualche punto percentuale): i tempi recuperati dopo uno stop risentono
+ * di tale tolleranza.
+ */
+
+#include "sched.h"
+
+#if defined(STM32F30) || defined(STM32F3DISCOVERY) || defined(STM32F3) || defined(STM32F303VCTx) || defined(STM32F303xC)
+#include "stm32f3xx_hal.h"
+#endif
+
+#if defined(DSTM32F407VGTx) || defined(STM32F4) || defined(STM32F4DISCOVERY) || defined(STM32F407xx)
+#include "stm32f4xx_hal.h"
+#endif
+
+#define SCHED_PORT_ASYNC_PREDIV	1										//!< LSI / 2
+#define SCHED_PORT_RTC_HZ		(LSI_VALUE / (SCHED_PORT_ASYNC_PREDIV + 1))	//!< Frequenza dei sotto-secondi
+#define SCHED_PORT_SYNC_PREDIV	(SCHED_PORT_RTC_HZ - 1)					//!< 1 Hz; 15999 su F4, 19999 su F3 (al piu' 0x7FFF)
+#define SCHED_PORT_WKUP_HZ		(LSI_VALUE / 16)						//!< Frequenza di conteggio del wakeup timer
+#define SCHED_PORT_MAX_STOP_MS	(0x10000UL * 1000 / SCHED_PORT_WKUP_HZ)	//!< Durata massima di uno stop temporizzato
+#define SCHED_PORT_DAY			(86400UL * SCHED_PORT_RTC_HZ)			//!< Conteggi dell'RTC in un giorno
+
+/**
+ * @brief Contatore dei tick della HAL, definito in stm32fxxx_hal.c.
+ */
+extern __IO uint32_t uwTick;
+
+static RTC_HandleTypeDef hrtc;
+static void (*SCHED_PortClockRestore)(void) = NULL;
+static SCHED_StopClock_t SCHED_PortStopClock = { SCHED_PORT_RTC_HZ, SCHED_PORT_DAY, 0 };
+
+/**
+ * @brief Orario corrente dell'RTC, in conteggi dei sotto-secondi dalla mezzanotte.
+ */
+static uint32_t SCHED_PortRtcCounts(void) {
+	RTC_TimeTypeDef time;
+	RTC_DateTypeDef date;
+	HAL_RTC_GetTime(&hrtc, &time, RTC_FORMAT_BIN);
+	HAL_RTC_GetDate(&hrtc, &date, RTC_FORMAT_BIN);	// sblocca i registri shadow
+	return ((time.Hours * 60UL + time.Minutes) * 60UL + time.Seconds) * SCHED_PORT_RTC_HZ + SCHED_PORT_SYNC_PREDIV -
+			time.SubSeconds;
+}
+
+static uint32_t SCHED_PortNow(void) {
+	return HAL_GetTick();
+}
+
+static void SCHED_PortDisableIrq(void) {
+	__disable_irq();
+}
+
+static void SCHED_PortEnableIrq(void) {
+	__enable_irq();
+}
+
+static void SCHED_PortSleep(void) {
+	__WFI();
+}
+
+static uint32_t SCHED_PortStop(uint32_t ms) {
+	// frazione di millisecondo contata da SysTick dall'ultimo tick, che andrebbe persa al riavvio di SysTick
+	uint32_t lostUs = (SysTick->LOAD - SysTick->VAL) * 1000 / (SysTick->LOAD + 1);
+	uint32_t before = SCHED_PortRtcCounts();
+	if (ms != SCHED_FOREVER) {
+		if (ms > SCHED_PORT_MAX_STOP_MS)
+			ms = SCHED_PORT_MAX_STOP_MS;
+		HAL_RTCEx_SetWakeUpTimer_IT(&hrtc, ms * SCHED_PORT_WKUP_HZ / 1000 - 1, RTC_WAKEUPCLOCK_RTCCLK_DIV16);
+	}
+
+	HAL_SuspendTick();
+	HAL_PWR_EnterSTOPMode(PWR_LOWPOWERREGULATOR_ON, PWR_STOPENTRY_WFI);
+	// al risveglio il system clock e' HSI
+	if (SCHED_PortClockRestore)
+		SCHED_PortClockRestore();
+
+	if (ms != SCHED_FOREVER) {
+		HAL_RTCEx_DeactivateWakeUpTimer(&hrtc);
+		__HAL_RTC_WAKEUPTIMER_CLEAR_FLAG(&hrtc, RTC_FLAG_WUTF);
+		__HAL_RTC_WAKEUPTIMER_EXTI_CLEAR_FLAG();
+	}
+
+	// i registri shadow dell'RTC vanno risincronizzati dopo lo stop
+	__HAL_RTC_WRITEPROTECTION_DISABLE(&hrtc);
+	HAL_RTC_WaitForSynchro(&hrtc);
+	__HAL_RTC_WRITEPROTECTION_ENABLE(&hrtc);
+	uint32_t after = SCHED_PortRtcCounts();
+	// SysTick riparte da capo: il tempo trascorso dal risveglio e' gia' contato dall'RTC
+	SysTick->VAL = 0;
+	uint32_t elapsed = SCHED_StopElapsed(&SCHED_PortStopClock, before, after, lostUs);
+
+	uwTick += elapsed;
+	HAL_ResumeTick();
+	return elapsed;
+}
+
+static const SCHED_Port_t SCHED_Port = {
+	SCHED_PortNow,
+	SCHED_PortDisableIrq,
+	SCHED_PortEnableIrq,
+	SCHED_PortSleep,
+	SCHED_PortStop
+};
+
+const SCHED_Port_t* SCHED_PortInit(void (*clockRestore)(void)) {
+	RCC_OscInitTypeDef RCC_OscInitStruct;
+	RCC_PeriphCLKInitTypeDef PeriphClkInitStruct;
+
+	SCHED_PortClockRestore = clockRestore;
+
+	__HAL_RCC_PWR_CLK_ENABLE();
+	HAL_PWR_EnableBkUpAccess();
+
+	RCC_OscInitStruct.OscillatorType = RCC_OSCILLATORTYPE_LSI;
+	RCC_OscInitStruct.LSIState = RCC_LSI_ON;
+	RCC_OscInitStruct.PLL.PLLState = RCC_PLL_NONE;
+	HAL_RCC_OscConfig(&RCC_OscInitStruct);
+
+	PeriphClkInitStruct.PeriphClockSelection = RCC_PERIPHCLK_RTC;
+	PeriphClkInitStruct.RTCClockSelection = RCC_RTCCLKSOURCE_LSI;
+	HAL_RCCEx_PeriphCLKConfig(&PeriphClkInitStruct);
+	__HAL_RCC_RTC_ENABLE();
+
+	hrtc.Instance = RTC;
+	hrtc.Init.HourFormat = RTC_HOURFORMAT_24;
+	hrtc.Init.AsynchPrediv = SCHED_PORT_ASYNC_PREDIV;
+	hrtc.Init.SynchPrediv = SCHED_PORT_SYNC_PREDIV;
+	hrtc.Init.OutPut = RTC_OUTPUT_DISABLE;
+	hrtc.Init.OutPutPolarity = RTC_OUTPUT_POLARITY_HIGH;
+	hrtc.Init.OutPutType = RTC_OUTPUT_TYPE_OPENDRAIN;
+	HAL_RTC_Init(&hrtc);
+
+	HAL_NVIC_SetPriority(RTC_WKUP_IRQn, 0x0F, 0);
+	HAL_NVIC_EnableIRQ(RTC_WKUP_IRQn);
+
+	return &SCHED_Port;
+}
+
+/**
+ * @brief IRQHandler associata al wakeup timer dell'RTC.
+ */
+void RTC_WKUP_IRQHandler(void) {
+	HAL_RTCEx_WakeUpTimerIRQHandler(&hrtc);
+}
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,213 @@
+/**
+ * @file txqueue.c
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "txqueue.h"
+#include <assert.h>
+#include <string.h>
+
+#if (TXQUEUE_LENGTH & (TXQUEUE_LENGTH - 1)) != 0 || TXQUEUE_LENGTH > 128
+#error "TXQUEUE_LENGTH deve essere una potenza di 2 non superiore a 128"
+#endif
+
+#define TXQUEUE_MASK		(TXQUEUE_LENGTH - 1)
+
+/**
+ * @brief Impedisce al compilatore di riordinare gli accessi in memoria attorno al punto in cui e' usata.
+ * @details Garantisce che il contenuto di un messaggio sia scritto prima dell'aggiornamento dell'indice che lo pubblica.
+ */
+#define TXQUEUE_BARRIER()	__asm__ volatile ("" ::: "memory")
+
+/**
+ * @brief Incrementa un contatore a 16 bit, saturando al valore massimo.
+ */
+#define INC_SAT16(c)		do { if ((c) != 0xFFFF) (c)++; } while (0)
+
+/**
+ * @brief Incrementa un contatore a 8 bit, saturando al valore massimo.
+ */
+#define INC_SAT8(c)			do { if ((c) != 0xFF) (c)++; } while (0)
+
+/**
+ * @brief Generatore pseudo-casuale xorshift a 32 bit.
+ */
+static uint32_t TXQUEUE_Random(TXQUEUE_t* q) {
+	uint32_t x = q->seed;
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	q->seed = x;
+	return x;
+}
+
+/**
+ * @brief Programma il prossimo tentativo dopo un'attesa casuale in [1, backoffMs * 2^n] millisecondi.
+ */
+static void TXQUEUE_Backoff(TXQUEUE_t* q, uint32_t now, uint8_t n) {
+	uint32_t window = q->backoffMs << (n < 16 ? n : 16);
+	q->nextAttempt = now + 1 + (window ? TXQUEUE_Random(q) % window : 0);
+	q->state = TXQUEUE_BACKOFF;
+}
+
+/**
+ * @brief Rimuove il messaggio in testa e torna nello stato di riposo.
+ */
+static void TXQUEUE_Pop(TXQUEUE_t* q) {
+	q->retry = 0;
+	TXQUEUE_BARRIER();
+	q->head++;
+	q->state = TXQUEUE_IDLE;
+}
+
+/**
+ * @brief Aggiorna l'istogramma di latenza: la classe i (i > 0) raccoglie le latenze in [2^(i-1), 2^i) ms.
+ */
+static void TXQUEUE_Latency(TXQUEUE_t* q, uint32_t ms) {
+	uint8_t bin = 0;
+	while (ms && bin < TXQUEUE_LAT_BINS - 1) {
+		ms >>= 1;
+		bin++;
+	}
+	INC_SAT8(q->stats.latency[bin]);
+}
+
+void TXQUEUE_Init(TXQUEUE_t* q, TXQUEUE_Start_t start, void* ctx, uint8_t maxRetry, uint32_t backoffMs) {
+	assert(q);
+	assert(start);
+	memset(q, 0, sizeof(TXQUEUE_t));
+	q->state = TXQUEUE_IDLE;
+	q->start = start;
+	q->ctx = ctx;
+	q->maxRetry = maxRetry;
+	q->backoffMs = backoffMs;
+	q->seed = 0x2545F491;
+}
+
+void TXQUEUE_SetRecovery(TXQUEUE_t* q, TXQUEUE_Recovery_t recovery) {
+	assert(q);
+	q->recovery = recovery;
+}
+
+void TXQUEUE_Seed(TXQUEUE_t* q, uint32_t seed) {
+	assert(q);
+	q->seed = seed ? seed : 0x2545F491;
+}
+
+int TXQUEUE_Push(TXQUEUE_t* q, const uint8_t* data, uint8_t len, uint32_t now) {
+	assert(q);
+	assert(data);
+	uint8_t tail = q->tail;
+	if (len > TXQUEUE_MSG_SIZE || (uint8_t)(tail - q->head) == TXQUEUE_LENGTH) {
+		q->overflows++;
+		return -1;
+	}
+	TXQUEUE_Msg_t* msg = &q->msg[tail & TXQUEUE_MASK];
+	memcpy(msg->data, data, len);
+	msg->len = len;
+	msg->time = now;
+	TXQUEUE_BARRIER();
+	q->tail = tail + 1;
+	return 0;
+}
+
+void TXQUEUE_Poll(TXQUEUE_t* q, uint32_t now) {
+	assert(q);
+	if (q->state == TXQUEUE_BUSY)
+		return;
+	if (q->stuck || q->busyStreak >= TXQUEUE_STUCK_LIMIT) {
+		if (q->recovery)
+			q->recovery(q->ctx);
+		q->recoveries++;
+		q->stuck = 0;
+		q->busyStreak = 0;
+	}
+	if (q->head == q->tail)
+		return;
+	if (q->state == TXQUEUE_BACKOFF && (int32_t)(now - q->nextAttempt) < 0)
+		return;
+	TXQUEUE_Msg_t* msg = &q->msg[q->head & TXQUEUE_MASK];
+	q->state = TXQUEUE_BUSY;
+	switch (q->start(q->ctx, msg->data, msg->len)) {
+	case TXQUEUE_STARTED:
+		q->busyStreak = 0;
+		INC_SAT16(q->stats.attempts);
+		break;
+	case TXQUEUE_BUS_BUSY:
+		/* un altro Master occupa il bus: si attende senza consumare ritrasmissioni */
+		q->busyStreak++;
+		INC_SAT16(q->stats.busy);
+		TXQUEUE_Backoff(q, now, q->retry);
+		break;
+	default:
+		/* periferica occupata: nessun tentativo consumato, si riprova al prossimo poll */
+		q->state = TXQUEUE_IDLE;
+		break;
+	}
+}
+
+void TXQUEUE_Complete(TXQUEUE_t* q, uint32_t now) {
+	assert(q);
+	if (q->state != TXQUEUE_BUSY)
+		return;
+	q->delivered++;
+	TXQUEUE_Latency(q, now - q->msg[q->head & TXQUEUE_MASK].time);
+	TXQUEUE_Pop(q);
+}
+
+void TXQUEUE_Failed(TXQUEUE_t* q, uint32_t now, TXQUEUE_Failure_t cause) {
+	assert(q);
+	if (q->state != TXQUEUE_BUSY)
+		return;
+	switch (cause) {
+	case TXQUEUE_NACK:
+		INC_SAT16(q->stats.nacks);
+		break;
+	case TXQUEUE_ARLO:
+		INC_SAT16(q->stats.collisions);
+		break;
+	default:
+		q->errors++;
+		q->dropped++;
+		q->stuck = 1;
+		TXQUEUE_Pop(q);
+		return;
+	}
+	if (q->retry < q->maxRetry) {
+		q->retry++;
+		TXQUEUE_Backoff(q, now, q->retry - 1);
+		return;
+	}
+	q->dropped++;
+	TXQUEUE_Pop(q);
+}
+
+uint8_t TXQUEUE_Count(const TXQUEUE_t* q) {
+	assert(q);
+	return (uint8_t)(q->tail - q->head);
+}
+
+void TXQUEUE_PackStats(const TXQUEUE_t* q, uint8_t* out) {
+	assert(q);
+	assert(out);
+	const uint16_t c[4] = {q->stats.attempts, q->stats.collisions, q->stats.busy, q->stats.nacks};
+	for (int i = 0; i < 4; i++) {
+		out[2 * i] = (uint8_t) c[i];
+		out[2 * i + 1] = (uint8_t) (c[i] >> 8);
+	}
+	memcpy(&out[8], q->stats.latency, TXQUEUE_LAT_BINS);
+}
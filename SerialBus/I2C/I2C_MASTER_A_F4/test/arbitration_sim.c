@@ -0,0 +1,547 @@
+/**
+ * @file arbitration_sim.c
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+/**
+ * @brief Simulazione su host della gestione dell'arbitraggio, del bus bloccato e delle statistiche dei Master.
+ *
+ * @details
+ * Due Master, con la trasmissione differita, inviano allo Slave C i frame del push button ({'A'|'B', valore}) e, ogni
+ * 2 s come COUNT_Task(), il proprio blocco di statistiche ({0x80 + 16 * id, TXQUEUE_PackStats()}). Il bus e' simulato a
+ * passi di 1 us a 400 kHz; lo Slave e' il register file vero (I2C_SLAVE_C_F3/src/regfile.c), a cui sono consegnati i
+ * frame trasmessi con successo. Il modello comprende:
+ *  - collisioni quando due start cadono entro un bit: vince il frame con il primo byte minore, come sul bus;
+ *  - NACK dello Slave con probabilita' SIM_NACK_PERMILLE;
+ *  - nello scenario con guasti, uno Slave che ogni SIM_STUCK_PERIOD_US trattiene SDA basso finche' non riceve da 1 a
+ *    9 impulsi di SCL; nel frattempo il flag BUSY dei Master resta alto.
+ *
+ * Sono confrontate due politiche di ritrasmissione:
+ *  - originale (25e37e4, riprodotta nel simulatore): il callback EXTI accoda il frame; un NACK e' ritrasmesso al piu'
+ *    5 volte dopo 2 << n ms; un arbitraggio perso o un errore di bus portano il main loop in ringOfTheDeath(), che
+ *    ferma il Master; con il bus occupato la HAL attende il flag BUSY, per 25 ms alla volta, e non c'e' recupero;
+ *  - attuale: TXQUEUE con backoff esponenziale casuale per NACK e arbitraggio, attesa senza consumo di tentativi per il
+ *    bus occupato e, dopo TXQUEUE_STUCK_LIMIT tentativi consecutivi con bus occupato o dopo un errore, il recupero di
+ *    I2C_BusRecovery(): fino a 9 impulsi di SCL, STOP e reinizializzazione. Un recupero mentre l'altro Master trasmette
+ *    ne corrompe il trasferimento, che termina con un errore di bus.
+ *
+ * Per ogni scenario sono riportati i frame del push button consegnati e persi, gli arbitraggi persi, i recuperi (di
+ * cui spuri, con il bus non bloccato), il tempo complessivo e massimo di bus bloccato, i Master fermati, la latenza
+ * massima e, per ogni Master, l'istogramma di latenza e il blocco di statistiche letto dallo Slave. Sono verificati,
+ * per la politica attuale:
+ *  - che ogni blocco del bus sia risolto entro SIM_STUCK_MAX_MS;
+ *  - che nessun Master perda piu' frame che con la politica originale;
+ *  - che l'istogramma di latenza di TXQUEUE coincida con quello misurato dal simulatore (classi sature a 255);
+ *  - che il blocco di statistiche nello Slave coincida con l'ultimo blocco consegnato da ciascun Master.
+ * @code
+ * gcc -std=gnu99 -O2 -Wall -Iinc -I../I2C_SLAVE_C_F3/inc test/arbitration_sim.c src/txqueue.c \
+ *   ../I2C_SLAVE_C_F3/src/regfile.c -lm -o arbitration_sim && ./arbitration_sim
+ * @endcode
+ */
+#include "txqueue.h"
+#include "regfile.h"
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#define SIM_SECONDS			10				//!< durata simulata di ogni scenario
+#define SIM_BIT_NS			2500			//!< durata di un bit a 400 kHz
+#define SIM_NACK_PERMILLE	20				//!< probabilita' di NACK dello Slave, per mille
+#define SIM_ARLO_BITS		12				//!< bit trasmessi prima che il perdente rilevi la collisione
+#define SIM_MAX_RETRY		8				//!< TXQUEUE_MAX_RETRY di config.h
+#define SIM_BACKOFF_MS		2				//!< TXQUEUE_BACKOFF_MS di config.h
+#define SIM_OLD_MAX_RETRY	5				//!< ritrasmissioni della politica originale
+#define SIM_BUSY_TIMEOUT_US	25000			//!< attesa massima del flag BUSY nella HAL
+#define SIM_HALF_SCL_US		5				//!< mezzo periodo di SCL durante il recupero (I2C_RECOVERY_DELAY)
+#define SIM_COUNT_MS		2000			//!< periodo di COUNT_Task()
+#define SIM_STUCK_PERIOD_US	500000			//!< intervallo tra due blocchi del bus, nello scenario con guasti
+#define SIM_STUCK_MAX_MS	100				//!< durata massima ammessa di un blocco con la politica attuale
+#define SIM_LOG_LENGTH		256				//!< frame accodati tracciati dal simulatore, per Master
+
+static int failures = 0;
+
+#define CHECK(cond) do { if (!(cond)) { printf("%s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+/**
+ * @brief Generatore pseudo-casuale xorshift, per rendere la simulazione riproducibile. Le pressioni usano uno stato
+ * separato, cosi' le due politiche ricevono la stessa sequenza di frame.
+ */
+static uint32_t rng, rngPress;
+static uint32_t Next(uint32_t* state) {
+	*state ^= *state << 13;
+	*state ^= *state >> 17;
+	*state ^= *state << 5;
+	return *state;
+}
+static uint32_t Random(void) {
+	return Next(&rng);
+}
+
+typedef enum { OUT_OK, OUT_NACK, OUT_ARLO, OUT_ERROR } Outcome_t;
+
+/**
+ * @brief Stato del bus condiviso.
+ */
+static struct {
+	int owner;				//!< Master che occupa il bus, -1 se libero
+	uint32_t start;			//!< istante della condizione di start
+	uint32_t end;			//!< istante dello stop
+	uint8_t stuck;			//!< impulsi di SCL necessari a liberare SDA, 0 se il bus non e' bloccato
+	uint32_t stuckSince;	//!< istante del blocco
+	uint32_t stuckTotal;	//!< tempo complessivo di bus bloccato, in us
+	uint32_t stuckMax;		//!< durata massima di un blocco, in us
+	uint32_t nextStuck;		//!< istante del prossimo blocco
+} bus;
+
+/**
+ * @brief Coda della politica originale (25e37e4): NACK ritrasmessi con attesa deterministica, nessuna statistica.
+ */
+typedef struct {
+	uint8_t data[TXQUEUE_LENGTH][TXQUEUE_MSG_SIZE];
+	uint8_t len[TXQUEUE_LENGTH];
+	uint8_t head, tail;
+	TXQUEUE_State_t state;
+	uint8_t retry;
+	uint32_t nextAttempt;
+	uint32_t errors;
+} OldQueue_t;
+
+/**
+ * @brief Frame accodato, tracciato dal simulatore per misurare la latenza indipendentemente da TXQUEUE.
+ */
+typedef struct {
+	uint32_t time;			//!< istante di accodamento, in ms
+	uint8_t button;			//!< 1 per un frame del push button, 0 per le statistiche
+} Log_t;
+
+/**
+ * @brief Stato di un Master.
+ */
+typedef struct {
+	int id;
+	uint32_t phase;					//!< fase del clock in ms del Master, in us
+	uint32_t nextPress;				//!< istante della prossima pressione
+	uint32_t nextCount;				//!< istante del prossimo COUNT_Task(), in ms del Master
+	/* trasferimento in corso */
+	int txActive;
+	uint32_t txEnd;
+	Outcome_t txOutcome;
+	uint8_t txData[TXQUEUE_MSG_SIZE];
+	uint8_t txLen;
+	/* politica attuale */
+	TXQUEUE_t q;
+	int deferred;
+	uint32_t deferUntil;
+	uint32_t stallUntil;			//!< fine del recupero del bus, durante il quale il main loop e' occupato
+	uint8_t published[TXQUEUE_STATS_SIZE];	//!< ultimo blocco di statistiche consegnato
+	int publishedValid;
+	/* politica originale */
+	OldQueue_t old;
+	int waitingBusy;				//!< la HAL attende il flag BUSY
+	int dead;						//!< il Master e' in ringOfTheDeath()
+	/* frame accodati, nell'ordine della coda */
+	Log_t log[SIM_LOG_LENGTH];
+	uint8_t logHead, logTail;
+	/* contatori */
+	uint32_t presses, delivered, lost, arlo, recoveries, spurious;
+	uint32_t latency[TXQUEUE_LAT_BINS];	//!< istogramma di latenza misurato dal simulatore
+	uint32_t latencyMax;
+} Master_t;
+
+static Master_t m[2];
+static REGFILE_t slave;
+static uint32_t now;
+
+static uint32_t NowMs(const Master_t* x) {
+	return (now + x->phase) / 1000;
+}
+
+/**
+ * @brief Tempo di interarrivo esponenziale, in us, per un processo di Poisson di ratePerS eventi al secondo.
+ */
+static uint32_t ExpUs(uint32_t ratePerS) {
+	double u = (Next(&rngPress) + 1.0) / 4294967297.0;
+	return (uint32_t)(-log(u) * 1e6 / ratePerS) + 1;
+}
+
+/**
+ * @brief Durata, in us, di un frame di len byte: start, indirizzo, dati (9 bit ciascuno) e stop.
+ */
+static uint32_t FrameUs(uint8_t len) {
+	return ((uint32_t)(len + 1) * 9 + 2) * SIM_BIT_NS / 1000 + 1;
+}
+
+/**
+ * @brief Classe dell'istogramma di latenza, come in TXQUEUE: la classe i (i > 0) raccoglie [2^(i-1), 2^i) ms.
+ */
+static unsigned LatencyBin(uint32_t ms) {
+	unsigned bin = 0;
+	while (ms && bin < TXQUEUE_LAT_BINS - 1) {
+		ms >>= 1;
+		bin++;
+	}
+	return bin;
+}
+
+/* ---------------------------------------------------------------- traccia dei frame accodati */
+
+static void LogPush(Master_t* x, uint8_t button) {
+	Log_t* l = &x->log[x->logTail++];
+	l->time = NowMs(x);
+	l->button = button;
+}
+
+/**
+ * @brief Rimuove il frame in testa: consegnato (aggiorna la latenza) oppure scartato (aggiorna i persi).
+ */
+static void LogPop(Master_t* x, int delivered) {
+	Log_t* l = &x->log[x->logHead++];
+	if (delivered) {
+		uint32_t ms = NowMs(x) - l->time;
+		x->latency[LatencyBin(ms)]++;
+		if (ms > x->latencyMax)
+			x->latencyMax = ms;
+		if (l->button)
+			x->delivered++;
+	}
+	else if (l->button)
+		x->lost++;
+}
+
+/* ---------------------------------------------------------------- bus e Slave */
+
+/**
+ * @brief Avvia un trasferimento; restituisce 0 se il bus e' bloccato o occupato da piu' di un bit.
+ */
+static int BusStart(Master_t* x, const uint8_t* data, uint8_t len) {
+	if (bus.stuck || (bus.owner >= 0 && now - bus.start > SIM_BIT_NS / 1000))
+		return 0;
+	memcpy(x->txData, data, len);
+	x->txLen = len;
+	x->txActive = 1;
+	if (bus.owner >= 0) {
+		/* start entro un bit dall'altro Master: perde chi trasmette per primo un 1 dove l'altro trasmette uno 0 */
+		Master_t* other = &m[bus.owner];
+		Master_t* loser = x->txData[0] > other->txData[0] ? x : other;
+		Master_t* winner = loser == x ? other : x;
+		if (winner == x) {
+			bus.owner = x->id;
+			bus.end = now + FrameUs(len);
+			x->txOutcome = OUT_OK;
+			x->txEnd = bus.end;
+		}
+		loser->txOutcome = OUT_ARLO;
+		loser->arlo++;
+		loser->txEnd = bus.start + SIM_ARLO_BITS * SIM_BIT_NS / 1000;
+		return 1;
+	}
+	bus.owner = x->id;
+	bus.start = now;
+	if (Random() % 1000 < SIM_NACK_PERMILLE) {
+		x->txOutcome = OUT_NACK;
+		bus.end = now + 10 * SIM_BIT_NS / 1000;
+	}
+	else {
+		x->txOutcome = OUT_OK;
+		bus.end = now + FrameUs(len);
+	}
+	x->txEnd = bus.end;
+	return 1;
+}
+
+/**
+ * @brief Consegna allo Slave un frame trasmesso con successo, con gli eventi inoltrati dai callback della HAL.
+ */
+static void SlaveReceive(const uint8_t* data, uint8_t len) {
+	REGFILE_AddrMatch(&slave, REGFILE_WRITE);
+	for (uint8_t i = 0; i < len; i++)
+		REGFILE_RxByte(&slave, data[i]);
+	REGFILE_Stop(&slave);
+}
+
+/* ---------------------------------------------------------------- politica attuale */
+
+static int StartTransmit(void* ctx, uint8_t* data, uint8_t len) {
+	Master_t* x = (Master_t*)ctx;
+	if (x->txActive)
+		return TXQUEUE_LOCKED;
+	return BusStart(x, data, len) ? TXQUEUE_STARTED : TXQUEUE_BUS_BUSY;
+}
+
+/**
+ * @brief I2C_BusRecovery(): impulsi di SCL finche' SDA e' basso (al piu' 9), STOP e reinizializzazione.
+ */
+static void BusRecovery(void* ctx) {
+	Master_t* x = (Master_t*)ctx;
+	uint32_t pulses = 0;
+	x->recoveries++;
+	if (bus.stuck) {
+		pulses = bus.stuck;
+		bus.stuck = 0;
+		uint32_t d = now - bus.stuckSince;
+		bus.stuckTotal += d;
+		if (d > bus.stuckMax)
+			bus.stuckMax = d;
+	}
+	else {
+		x->spurious++;
+		if (bus.owner >= 0 && bus.owner != x->id) {
+			/* SCL pilotato durante il trasferimento dell'altro Master: errore di bus */
+			m[bus.owner].txOutcome = OUT_ERROR;
+		}
+	}
+	x->stallUntil = now + (2 * pulses + 4) * SIM_HALF_SCL_US;
+}
+
+static void TxTask(Master_t* x) {
+	uint32_t ms = NowMs(x);
+	TXQUEUE_Poll(&x->q, ms);
+	x->deferred = 0;
+	if (x->q.state == TXQUEUE_BACKOFF) {
+		int32_t wait = (int32_t)(x->q.nextAttempt - ms);
+		x->deferred = 1;
+		x->deferUntil = now + (wait > 0 ? wait : 0) * 1000;
+	}
+	else if (x->q.state == TXQUEUE_IDLE && TXQUEUE_Count(&x->q) != 0) {
+		x->deferred = 1;
+		x->deferUntil = now + 1000;
+	}
+}
+
+static void Push(Master_t* x, const uint8_t* data, uint8_t len, uint8_t button) {
+	if (TXQUEUE_Push(&x->q, data, len, NowMs(x)) == 0)
+		LogPush(x, button);
+	else if (button)
+		x->lost++;
+}
+
+static void StepCurrent(Master_t* x) {
+	if (now == x->nextPress) {
+		/* la ISR conta la pressione, BUTTON_Task accoda */
+		uint8_t frame[2] = {(uint8_t)(REGFILE_ADDEND(x->id)), (uint8_t)(x->presses & 0x0F)};
+		x->presses++;
+		Push(x, frame, 2, 1);
+		x->deferred = 1;
+		x->deferUntil = now;
+	}
+	if (NowMs(x) == x->nextCount && (now + x->phase) % 1000 == 0) {
+		/* COUNT_Task: pubblica le statistiche */
+		uint8_t frame[1 + TXQUEUE_STATS_SIZE];
+		frame[0] = REGFILE_STATS(x->id);
+		TXQUEUE_PackStats(&x->q, &frame[1]);
+		Push(x, frame, sizeof(frame), 0);
+		x->nextCount += SIM_COUNT_MS;
+		x->deferred = 1;
+		x->deferUntil = now;
+	}
+	if (x->txActive && now == x->txEnd) {
+		uint32_t dropped = x->q.dropped;
+		x->txActive = 0;
+		if (x->txOutcome == OUT_OK) {
+			SlaveReceive(x->txData, x->txLen);
+			if (x->txData[0] == REGFILE_STATS(x->id)) {
+				memcpy(x->published, &x->txData[1], TXQUEUE_STATS_SIZE);
+				x->publishedValid = 1;
+			}
+			TXQUEUE_Complete(&x->q, NowMs(x));
+			LogPop(x, 1);
+		}
+		else {
+			if (x->txOutcome == OUT_ERROR)
+				REGFILE_Error(&slave);
+			TXQUEUE_Failed(&x->q, NowMs(x), x->txOutcome == OUT_NACK ? TXQUEUE_NACK :
+					x->txOutcome == OUT_ARLO ? TXQUEUE_ARLO : TXQUEUE_ERROR);
+			if (x->q.dropped != dropped)
+				LogPop(x, 0);
+		}
+		x->deferred = 1;
+		x->deferUntil = now;
+	}
+	if (x->deferred && now >= x->deferUntil && now >= x->stallUntil)
+		TxTask(x);
+}
+
+/* ---------------------------------------------------------------- politica originale */
+
+static void OldPop(OldQueue_t* o) {
+	o->retry = 0;
+	o->head++;
+	o->state = TXQUEUE_IDLE;
+}
+
+static void StepOriginal(Master_t* x) {
+	OldQueue_t* o = &x->old;
+	if (now == x->nextPress) {
+		/* il callback EXTI accoda il frame */
+		x->presses++;
+		if (x->dead || (uint8_t)(o->tail - o->head) == TXQUEUE_LENGTH)
+			x->lost++;
+		else {
+			uint8_t slot = o->tail & (TXQUEUE_LENGTH - 1);
+			o->data[slot][0] = REGFILE_ADDEND(x->id);
+			o->data[slot][1] = x->presses & 0x0F;
+			o->len[slot] = 2;
+			o->tail++;
+			LogPush(x, 1);
+		}
+	}
+	if (x->txActive && now == x->txEnd) {
+		x->txActive = 0;
+		if (x->txOutcome == OUT_OK) {
+			SlaveReceive(x->txData, x->txLen);
+			LogPop(x, 1);
+			OldPop(o);
+		}
+		else if (x->txOutcome == OUT_NACK && o->retry < SIM_OLD_MAX_RETRY) {
+			o->nextAttempt = NowMs(x) + (SIM_BACKOFF_MS << o->retry);
+			o->retry++;
+			o->state = TXQUEUE_BACKOFF;
+		}
+		else {
+			if (x->txOutcome != OUT_NACK)
+				o->errors++;
+			LogPop(x, 0);
+			OldPop(o);
+		}
+	}
+	if (x->dead)
+		return;
+	/* main loop */
+	if (o->errors) {
+		/* ringOfTheDeath(): i frame ancora in coda non saranno mai trasmessi */
+		x->dead = 1;
+		while (x->logHead != x->logTail)
+			LogPop(x, 0);
+		return;
+	}
+	if (o->state == TXQUEUE_BUSY && !x->txActive && x->waitingBusy) {
+		/* HAL_I2C_Master_Transmit_IT attende il flag BUSY (25 ms, poi di nuovo al poll successivo) */
+		uint8_t slot = o->head & (TXQUEUE_LENGTH - 1);
+		if (BusStart(x, o->data[slot], o->len[slot]))
+			x->waitingBusy = 0;
+		return;
+	}
+	if (o->state == TXQUEUE_BUSY || o->head == o->tail)
+		return;
+	if (o->state == TXQUEUE_BACKOFF && (int32_t)(NowMs(x) - o->nextAttempt) < 0)
+		return;
+	o->state = TXQUEUE_BUSY;
+	x->waitingBusy = 1;
+}
+
+/* ---------------------------------------------------------------- scenari */
+
+typedef struct {
+	const char* name;
+	uint32_t ratePerS;		//!< pressioni al secondo per Master
+	int faults;				//!< 1 se lo Slave blocca periodicamente il bus
+} Scenario_t;
+
+static uint32_t Run(const Scenario_t* s, int current) {
+	rng = 12345;
+	rngPress = 67890;
+	memset(m, 0, sizeof(m));
+	memset(&bus, 0, sizeof(bus));
+	bus.owner = -1;
+	bus.nextStuck = SIM_STUCK_PERIOD_US;
+	REGFILE_Init(&slave);
+	for (int i = 0; i < 2; i++) {
+		m[i].id = i;
+		m[i].phase = Random() % 1000;
+		TXQUEUE_Init(&m[i].q, StartTransmit, &m[i], SIM_MAX_RETRY, SIM_BACKOFF_MS);
+		TXQUEUE_SetRecovery(&m[i].q, BusRecovery);
+		TXQUEUE_Seed(&m[i].q, (i + 1) << 24 ^ Random());
+		m[i].nextPress = ExpUs(s->ratePerS);
+		m[i].nextCount = SIM_COUNT_MS + i * 7;
+	}
+	for (now = 0; now < SIM_SECONDS * 1000000U; now++) {
+		if (bus.owner >= 0 && now >= bus.end)
+			bus.owner = -1;
+		if (s->faults && now >= bus.nextStuck && bus.owner < 0 && !bus.stuck) {
+			bus.stuck = 1 + Random() % 9;
+			bus.stuckSince = now;
+			bus.nextStuck = now + SIM_STUCK_PERIOD_US;
+		}
+		for (int i = 0; i < 2; i++) {
+			if (current)
+				StepCurrent(&m[i]);
+			else
+				StepOriginal(&m[i]);
+			if (now == m[i].nextPress)
+				m[i].nextPress = now + ExpUs(s->ratePerS);
+		}
+	}
+	if (bus.stuck) {
+		uint32_t d = now - bus.stuckSince;
+		bus.stuckTotal += d;
+		if (d > bus.stuckMax)
+			bus.stuckMax = d;
+	}
+
+	uint32_t presses = m[0].presses + m[1].presses;
+	uint32_t delivered = m[0].delivered + m[1].delivered;
+	uint32_t lost = m[0].lost + m[1].lost;
+	printf("%-9s %-22s %7lu %9lu %6lu %5.1f%% %5lu %5lu %4lu %7lu %6lu %4d %6lu\n", current ? "attuale" : "originale",
+			s->name, (unsigned long) presses, (unsigned long) delivered, (unsigned long) lost, 100.0 * lost / presses,
+			(unsigned long) (m[0].arlo + m[1].arlo), (unsigned long) (m[0].recoveries + m[1].recoveries),
+			(unsigned long) (m[0].spurious + m[1].spurious), (unsigned long) bus.stuckTotal / 1000,
+			(unsigned long) bus.stuckMax / 1000, m[0].dead + m[1].dead,
+			(unsigned long) (m[0].latencyMax > m[1].latencyMax ? m[0].latencyMax : m[1].latencyMax));
+	return lost;
+}
+
+/**
+ * @brief Riporta e verifica l'istogramma di latenza e il blocco di statistiche di ciascun Master.
+ */
+static void CheckStats(void) {
+	for (int i = 0; i < 2; i++) {
+		Master_t* x = &m[i];
+		printf("    Master %c: latenza [0,1) [1,2) [2,4) ... [64,inf) ms:", 'A' + i);
+		for (int b = 0; b < TXQUEUE_LAT_BINS; b++) {
+			printf(" %3u", x->q.stats.latency[b]);
+			CHECK(x->q.stats.latency[b] == (x->latency[b] < 255 ? x->latency[b] : 255));
+		}
+		uint8_t block[TXQUEUE_STATS_SIZE];
+		for (int j = 0; j < TXQUEUE_STATS_SIZE; j++)
+			block[j] = REGFILE_Read(&slave, REGFILE_STATS(i) + j);
+		printf("\n    Slave 0x%02X: tentativi %u, collisioni %u, bus occupato %u, NACK %u\n", REGFILE_STATS(i),
+				block[0] | block[1] << 8, block[2] | block[3] << 8, block[4] | block[5] << 8, block[6] | block[7] << 8);
+		CHECK(x->publishedValid);
+		CHECK(memcmp(block, x->published, TXQUEUE_STATS_SIZE) == 0);
+	}
+}
+
+int main(void) {
+	static const Scenario_t scenario[] = {
+		{ "contesa 200/s", 200, 0 },
+		{ "contesa 1000/s", 1000, 0 },
+		{ "200/s, bus bloccato", 200, 1 },
+		{ "1000/s, bus bloccato", 1000, 1 },
+	};
+	printf("%-9s %-22s %7s %9s %6s %6s %5s %5s %4s %7s %6s %4s %6s\n", "politica", "scenario", "press", "consegne",
+			"persi", "", "arlo", "recup", "spuri", "blocco", "max", "fermi", "lat");
+	printf("%-9s %-22s %7s %9s %6s %6s %5s %5s %4s %7s %6s %4s %6s\n", "", "", "", "", "", "", "", "", "", "ms", "ms",
+			"", "ms");
+	for (unsigned s = 0; s < sizeof(scenario) / sizeof(scenario[0]); s++) {
+		uint32_t oldLost = Run(&scenario[s], 0);
+		uint32_t newLost = Run(&scenario[s], 1);
+		CheckStats();
+		CHECK(bus.stuckMax <= SIM_STUCK_MAX_MS * 1000);
+		CHECK(newLost <= oldLost);
+	}
+	printf("arbitration_sim: %s\n", failures == 0 ? "OK" : "FAILED");
+	return failures != 0;
+}
@@ -0,0 +1,555 @@
+/**
+ * @file sched_sim.c
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+/**
+ * @brief Simulazione su host dello scheduler, con un port simulato che riproduce SysTick, RTC, stop ed EXTI/I2C.
+ *
+ * @details
+ * Il nucleo dello scheduler (src/sched.c, identico in Interrupt/INT_HAL_Based_F4, Interrupt/INT_BareMetal_F3 e nei due
+ * Master) e' eseguito senza modifiche con un SCHED_Port_t simulato, a passi di 1 us di tempo reale:
+ *  - SysTick: un tick ogni 1000 us di clock attivo; il contatore e' fermo in stop, HAL_SuspendTick() ne maschera
+ *    l'interruzione e la riconfigurazione del clock al risveglio (SystemClock_Config() -> HAL_InitTick()) lo riavvia;
+ *  - RTC: contatore dei sotto-secondi cloccato da LSI, come configurato da sched_port.c, con ritardo di
+ *    HAL_RTC_WaitForSynchro() e wakeup timer a LSI / 16;
+ *  - stop: la sequenza di SCHED_PortStop(), compreso il recupero di uwTick con SCHED_StopElapsed() e il riavvio di
+ *    SysTick dopo la lettura dell'RTC, con il tempo di risveglio dallo stop e, se presente, quello di ripristino del clock;
+ *  - interruzioni: SysTick, EXTI del push button, fine trasferimento I2C e wakeup timer, servite solo a interruzioni
+ *    abilitate; quelle che arrivano con le interruzioni disabilitate restano pendenti, come con PRIMASK.
+ *
+ * Sono riprodotti due scenari, per SIM_SECONDS secondi ciascuno:
+ *  - Interrupt: nessun task, la callback EXTI accende i led; il processore resta in stop fino alla pressione;
+ *  - Master: COUNT_Task() ogni 2 s, BUTTON_Task() attivato dall'EXTI, TX_Task() con TXQUEUE (src/txqueue.c), NACK dello
+ *    Slave con probabilita' SIM_NACK_PERMILLE, stop vietato durante i trasferimenti, SystemClock_Config() al risveglio;
+ *  - Master con LSI a +5%, entro la tolleranza di LSI, solo riportato.
+ *
+ * LSI e' simulata 0.1 ppm sopra il valore nominale, asincrona rispetto al clock del processore come sulla board: con i due
+ * clock in fase il risveglio cadrebbe sempre nello stesso punto del conteggio dell'RTC e l'errore di quantizzazione non
+ * avrebbe media nulla. Le pressioni seguono un processo di Poisson, con raffiche di 5 pressioni a circa 30 ms ogni 10 s. Per ogni sorgente di
+ * interruzione e per lo stato in cui si trovava il processore (run, sleep, stop) e' riportata la latenza media e massima
+ * fino alla ISR e, per il Master, fino all'inizio del task; sono riportate la residenza misurata dallo scheduler e quella
+ * reale e lo scostamento di uwTick dal tempo reale. Sono verificati, con LSI nominale:
+ *  - che il tempo in run, sleep e stop sommi al tempo trascorso secondo uwTick, e la residenza a 1000 millesimi;
+ *  - che il tempo in sleep e in stop misurato dallo scheduler differisca da quello reale di meno di SIM_RESIDENCY_MS
+ *    (0.2% del tempo simulato). Lo scheduler misura in tick da 1 ms: l'esecuzione piu' breve di un tick tra due riposi
+ *    e' attribuita al riposo successivo, e lo stop comprende il risveglio e il ripristino del clock, misurati dall'RTC;
+ *  - che uwTick resti, in ogni istante, entro 1 ms dal tempo reale piu' quattro deviazioni standard dell'errore di
+ *    quantizzazione dell'RTC, che a ogni stop e' uniforme entro un conteggio e a media nulla;
+ *  - che SCHED_StopElapsed() non perda la frazione di millisecondo su 10000 stop consecutivi.
+ * @code
+ * gcc -std=gnu99 -O2 -Wall -Wextra -Iinc test/sched_sim.c src/sched.c src/txqueue.c -lm -o sched_sim && ./sched_sim
+ * @endcode
+ */
+#include "sched.h"
+#include "txqueue.h"
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#define SIM_SECONDS			600				//!< durata di ogni scenario
+#define SIM_LSI_VALUE		32000			//!< LSI_VALUE della HAL di STM32F4
+#define SIM_RTC_HZ			(SIM_LSI_VALUE / 2)		//!< SCHED_PORT_RTC_HZ
+#define SIM_RTC_START_S		(86400 - 60)	//!< orario iniziale dell'RTC, per attraversare la mezzanotte
+#define SIM_WKUP_DIV		16				//!< divisore del wakeup timer (RTC_WAKEUPCLOCK_RTCCLK_DIV16)
+#define SIM_STOP_WAKEUP_US	110				//!< risveglio dallo stop con regolatore in low power (datasheet F407)
+#define SIM_CLOCK_RESTORE_US	300			//!< SystemClock_Config(): avvio di HSE e aggancio del PLL
+#define SIM_ISR_US			3				//!< durata di una ISR
+#define SIM_RUN_US			2				//!< durata di SCHED_Run() senza task da eseguire
+#define SIM_PRESS_MS		700				//!< intervallo medio tra due pressioni
+#define SIM_NACK_PERMILLE	50				//!< probabilita' di NACK dello Slave, per mille
+#define SIM_BIT_NS			2500			//!< durata di un bit a 400 kHz
+#define SIM_RESIDENCY_MS	(SIM_SECONDS * 2)	//!< scostamento ammesso della residenza misurata, in ms
+
+static int failures = 0;
+
+#define CHECK(cond) do { if (!(cond)) { printf("%s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+/**
+ * @brief Generatore pseudo-casuale xorshift, per rendere la simulazione riproducibile.
+ */
+static uint32_t rng;
+static uint32_t Random(void) {
+	rng ^= rng << 13;
+	rng ^= rng >> 17;
+	rng ^= rng << 5;
+	return rng;
+}
+
+typedef enum { CPU_RUN, CPU_SLEEP, CPU_STOP, CPU_STATES } Cpu_t;
+typedef enum { IRQ_SYSTICK, IRQ_EXTI, IRQ_I2C, IRQ_WKUP, IRQ_SOURCES } Irq_t;
+
+static const char* const cpuName[CPU_STATES] = { "run", "sleep", "stop" };
+static const char* const irqName[IRQ_SOURCES] = { "SysTick", "EXTI", "I2C", "wakeup" };
+
+/**
+ * @brief Latenza di una sorgente di interruzione, per stato del processore al momento dell'evento.
+ */
+typedef struct {
+	uint32_t count;
+	uint64_t sum;
+	uint32_t max;
+} Latency_t;
+
+static void LatencyAdd(Latency_t* l, uint32_t us) {
+	l->count++;
+	l->sum += us;
+	if (us > l->max)
+		l->max = us;
+}
+
+/**
+ * @brief Scenario simulato.
+ */
+typedef struct {
+	const char* name;
+	int master;				//!< 1 per il Master (task, I2C, SystemClock_Config()), 0 per l'esempio Interrupt
+	uint64_t lsiMilliHz;	//!< frequenza reale di LSI, in mHz
+} Scenario_t;
+
+/**
+ * @brief Stato del microcontrollore simulato.
+ */
+static struct {
+	const Scenario_t* sc;
+	uint64_t t;						//!< tempo reale, in us
+	Cpu_t cpu;						//!< stato del processore
+	uint64_t cpuUs[CPU_STATES];		//!< residenza reale, in us
+	int primask;					//!< interruzioni disabilitate
+	uint32_t pending;				//!< interruzioni pendenti
+	uint64_t raisedAt[IRQ_SOURCES];	//!< istante dell'evento che ha reso pendente ciascuna interruzione
+	Cpu_t raisedIn[IRQ_SOURCES];	//!< stato del processore al momento dell'evento
+	/* SysTick */
+	uint32_t tickPhase;				//!< us trascorsi dall'ultimo tick
+	int tickInt;					//!< interruzione di SysTick abilitata (TICKINT)
+	uint32_t uwTick;
+	/* periferiche */
+	uint64_t nextPress;				//!< prossima pressione del push button
+	uint32_t burst;					//!< pressioni residue della raffica in corso
+	uint64_t i2cDone;				//!< fine del trasferimento I2C in corso, 0 se nessuno
+	int i2cNack;					//!< esito del trasferimento in corso
+	uint64_t wkupAt;				//!< scadenza del wakeup timer, 0 se disattivato
+	SCHED_StopClock_t stopClock;	//!< stato di SCHED_StopElapsed() del port
+	/* misure */
+	Latency_t isr[IRQ_SOURCES][CPU_STATES];
+	Latency_t task[IRQ_SOURCES][CPU_STATES];
+	uint64_t buttonAt;				//!< pressione piu' vecchia non ancora servita da BUTTON_Task(), 0 se nessuna
+	Cpu_t buttonIn;
+	uint64_t txAt;					//!< interruzione I2C non ancora servita da TX_Task(), 0 se nessuna
+	Cpu_t txIn;
+	uint32_t stops;
+	double driftMax;				//!< massimo scostamento di uwTick dal tempo reale, in ms
+	double driftMin;
+} mcu;
+
+static SCHED_t sched;
+static TXQUEUE_t txQueue;
+static uint8_t txTask, buttonTask;
+static uint8_t buttonPressed, buttonHandled;
+
+/* ---------------------------------------------------------------- tempo e interruzioni */
+
+static uint64_t ExpUs(uint32_t meanMs) {
+	double u = (Random() + 1.0) / 4294967297.0;
+	return (uint64_t) (-log(u) * meanMs * 1000.0) + 1;
+}
+
+/**
+ * @brief Conteggi dell'RTC dalla mezzanotte: LSI reale divisa per il prescaler asincrono (2).
+ */
+static uint32_t RtcCounts(void) {
+	uint64_t counts = (mcu.t * mcu.sc->lsiMilliHz / 2) / 1000000000ULL + (uint64_t) SIM_RTC_START_S * SIM_RTC_HZ;
+	return (uint32_t) (counts % (86400ULL * SIM_RTC_HZ));
+}
+
+static void Raise(Irq_t irq) {
+	if (!(mcu.pending & (1U << irq))) {
+		mcu.pending |= 1U << irq;
+		mcu.raisedAt[irq] = mcu.t;
+		mcu.raisedIn[irq] = mcu.cpu;
+	}
+}
+
+/**
+ * @brief Istante del prossimo evento hardware.
+ */
+static uint64_t NextEvent(void) {
+	uint64_t next = mcu.nextPress;
+	if (mcu.cpu != CPU_STOP) {
+		uint64_t tick = mcu.t + 1000 - mcu.tickPhase;
+		if (tick < next)
+			next = tick;
+		if (mcu.i2cDone && mcu.i2cDone < next)
+			next = mcu.i2cDone;
+	}
+	if (mcu.wkupAt && mcu.wkupAt < next)
+		next = mcu.wkupAt;
+	return next;
+}
+
+/**
+ * @brief Fa trascorrere il tempo fino a un evento (compreso), senza servire le interruzioni.
+ */
+static void ElapseTo(uint64_t to) {
+	uint64_t d = to - mcu.t;
+	mcu.cpuUs[mcu.cpu] += d;
+	mcu.t = to;
+	if (mcu.cpu != CPU_STOP) {
+		mcu.tickPhase += d;
+		if (mcu.tickPhase >= 1000) {
+			mcu.tickPhase -= 1000;
+			if (mcu.tickInt)
+				Raise(IRQ_SYSTICK);
+		}
+		if (mcu.i2cDone && mcu.t >= mcu.i2cDone) {
+			mcu.i2cDone = 0;
+			Raise(IRQ_I2C);
+		}
+	}
+	if (mcu.t >= mcu.nextPress) {
+		Raise(IRQ_EXTI);
+		if (mcu.burst) {
+			mcu.burst--;
+			mcu.nextPress = mcu.t + 30000 + Random() % 1000;
+		}
+		else {
+			mcu.nextPress = mcu.t + ExpUs(SIM_PRESS_MS);
+			if (mcu.nextPress / 10000000 != mcu.t / 10000000) {
+				/* raffica ogni 10 s */
+				mcu.nextPress = mcu.nextPress / 10000000 * 10000000 + Random() % 1000;
+				mcu.burst = 4;
+			}
+		}
+	}
+	if (mcu.wkupAt && mcu.t >= mcu.wkupAt) {
+		mcu.wkupAt = 0;
+		Raise(IRQ_WKUP);
+	}
+}
+
+static void ServicePending(void);
+
+/**
+ * @brief Il processore esegue codice per us microsecondi; le interruzioni sono servite se abilitate.
+ */
+static void Busy(uint32_t us) {
+	uint64_t end = mcu.t + us;
+	for (;;) {
+		uint64_t next = NextEvent();
+		if (next > end)
+			break;
+		ElapseTo(next);
+		ServicePending();
+	}
+	ElapseTo(end);
+}
+
+/**
+ * @brief Verifica, a ogni tick, lo scostamento di uwTick dal tempo reale.
+ */
+static void CheckDrift(void) {
+	double drift = mcu.uwTick - mcu.t / 1000.0;
+	if (drift > mcu.driftMax)
+		mcu.driftMax = drift;
+	if (drift < mcu.driftMin)
+		mcu.driftMin = drift;
+}
+
+static void ExtiCallback(void);
+static void I2cCallback(void);
+
+/**
+ * @brief Serve le interruzioni pendenti, se abilitate, nell'ordine di priorita' (SysTick per prima).
+ */
+static void ServicePending(void) {
+	while (!mcu.primask && mcu.pending) {
+		Irq_t irq = 0;
+		while (!(mcu.pending & (1U << irq)))
+			irq++;
+		mcu.pending &= ~(1U << irq);
+		LatencyAdd(&mcu.isr[irq][mcu.raisedIn[irq]], (uint32_t) (mcu.t - mcu.raisedAt[irq]));
+		uint64_t at = mcu.raisedAt[irq];
+		Cpu_t in = mcu.raisedIn[irq];
+		mcu.primask = 1;
+		Busy(SIM_ISR_US);
+		mcu.primask = 0;
+		switch (irq) {
+		case IRQ_SYSTICK:
+			mcu.uwTick++;
+			CheckDrift();
+			break;
+		case IRQ_EXTI:
+			if (!mcu.buttonAt) {
+				mcu.buttonAt = at;
+				mcu.buttonIn = in;
+			}
+			ExtiCallback();
+			break;
+		case IRQ_I2C:
+			if (!mcu.txAt) {
+				mcu.txAt = at;
+				mcu.txIn = in;
+			}
+			I2cCallback();
+			break;
+		default:
+			/* HAL_RTCEx_WakeUpTimerIRQHandler(): flag gia' cancellato dal port */
+			break;
+		}
+	}
+}
+
+/* ---------------------------------------------------------------- port simulato */
+
+static uint32_t PortNow(void) {
+	return mcu.uwTick;
+}
+
+static void PortDisableIrq(void) {
+	mcu.primask = 1;
+}
+
+static void PortEnableIrq(void) {
+	mcu.primask = 0;
+	ServicePending();
+}
+
+/**
+ * @brief WFI: ritorna alla prima interruzione pendente, che sara' servita alla riabilitazione.
+ */
+static void PortSleep(void) {
+	mcu.cpu = CPU_SLEEP;
+	while (!mcu.pending)
+		ElapseTo(NextEvent());
+	mcu.cpu = CPU_RUN;
+}
+
+/**
+ * @brief SCHED_PortStop().
+ */
+static uint32_t PortStop(uint32_t ms) {
+	/* frazione di millisecondo gia' contata da SysTick */
+	uint32_t lostUs = mcu.tickPhase;
+	uint32_t before = RtcCounts();
+	if (ms != SCHED_FOREVER) {
+		uint32_t wkupHz = SIM_LSI_VALUE / SIM_WKUP_DIV;
+		uint32_t maxMs = 0x10000UL * 1000 / wkupHz;
+		if (ms > maxMs)
+			ms = maxMs;
+		uint32_t ticks = ms * wkupHz / 1000 - 1;
+		mcu.wkupAt = mcu.t + (uint64_t) (ticks + 1) * SIM_WKUP_DIV * 1000000000ULL / mcu.sc->lsiMilliHz;
+	}
+	mcu.tickInt = 0;
+	mcu.stops++;
+
+	mcu.cpu = CPU_STOP;
+	while (!mcu.pending)
+		ElapseTo(NextEvent());
+	mcu.cpu = CPU_RUN;
+	Busy(SIM_STOP_WAKEUP_US);
+	if (mcu.sc->master) {
+		/* SystemClock_Config() -> HAL_RCC_ClockConfig() -> HAL_InitTick(): SysTick riparte da capo, con TICKINT */
+		Busy(SIM_CLOCK_RESTORE_US);
+		mcu.tickPhase = 0;
+		mcu.tickInt = 1;
+	}
+	mcu.wkupAt = 0;
+	mcu.pending &= ~(1U << IRQ_WKUP);
+	/* HAL_RTC_WaitForSynchro(): fino a due periodi di RTCCLK */
+	Busy((uint32_t) (2 * 1000000000ULL / mcu.sc->lsiMilliHz));
+	uint32_t after = RtcCounts();
+	mcu.tickPhase = 0;
+	uint32_t elapsed = SCHED_StopElapsed(&mcu.stopClock, before, after, lostUs);
+	mcu.uwTick += elapsed;
+	mcu.tickInt = 1;
+	CheckDrift();
+	return elapsed;
+}
+
+static const SCHED_Port_t port = { PortNow, PortDisableIrq, PortEnableIrq, PortSleep, PortStop };
+
+/* ---------------------------------------------------------------- applicazione */
+
+static void TX_Task(void);
+
+static void ExtiCallback(void) {
+	if (mcu.sc->master) {
+		buttonPressed++;
+		SCHED_Post(&sched, buttonTask);
+	}
+	else {
+		/* esempio Interrupt: toggle dei led nella callback */
+		mcu.buttonAt = 0;
+	}
+}
+
+static void I2cCallback(void) {
+	if (mcu.i2cNack)
+		TXQUEUE_Failed(&txQueue, mcu.uwTick, TXQUEUE_NACK);
+	else
+		TXQUEUE_Complete(&txQueue, mcu.uwTick);
+	SCHED_Post(&sched, txTask);
+}
+
+static int StartTransmit(void* ctx, uint8_t* data, uint8_t len) {
+	(void) ctx;
+	(void) data;
+	if (mcu.i2cDone)
+		return TXQUEUE_LOCKED;
+	mcu.i2cNack = Random() % 1000 < SIM_NACK_PERMILLE;
+	mcu.i2cDone = mcu.t + (mcu.i2cNack ? 10 : ((uint32_t) (len + 1) * 9 + 2)) * SIM_BIT_NS / 1000 + 1;
+	return TXQUEUE_STARTED;
+}
+
+static int CanStop(void) {
+	return TXQUEUE_Count(&txQueue) == 0 && !mcu.i2cDone;
+}
+
+/**
+ * @brief Latenza dall'evento all'inizio del task che lo serve.
+ */
+static void TaskLatency(Irq_t irq, uint64_t* at, Cpu_t in) {
+	if (*at) {
+		LatencyAdd(&mcu.task[irq][in], (uint32_t) (mcu.t - *at));
+		*at = 0;
+	}
+}
+
+static void COUNT_Task(void) {
+	uint8_t stats[1 + TXQUEUE_STATS_SIZE];
+	Busy(20);
+	stats[0] = 0x80;
+	TXQUEUE_PackStats(&txQueue, &stats[1]);
+	TXQUEUE_Push(&txQueue, stats, sizeof(stats), mcu.uwTick);
+	TX_Task();
+}
+
+static void TX_Task(void) {
+	TaskLatency(IRQ_I2C, &mcu.txAt, mcu.txIn);
+	Busy(10);
+	uint32_t now = mcu.uwTick;
+	TXQUEUE_Poll(&txQueue, now);
+	if (txQueue.state == TXQUEUE_BACKOFF) {
+		int32_t wait = (int32_t) (txQueue.nextAttempt - now);
+		SCHED_Defer(&sched, txTask, wait > 0 ? wait : 0);
+	}
+	else if (txQueue.state == TXQUEUE_IDLE && TXQUEUE_Count(&txQueue) != 0)
+		SCHED_Defer(&sched, txTask, 1);
+}
+
+static void BUTTON_Task(void) {
+	uint8_t txBuffer[2] = { 'A', 0 };
+	TaskLatency(IRQ_EXTI, &mcu.buttonAt, mcu.buttonIn);
+	Busy(10);
+	for (; buttonHandled != buttonPressed; buttonHandled++)
+		TXQUEUE_Push(&txQueue, txBuffer, 2, mcu.uwTick);
+	TX_Task();
+}
+
+/* ---------------------------------------------------------------- scenari */
+
+static void Run(const Scenario_t* sc) {
+	memset(&mcu, 0, sizeof(mcu));
+	mcu.sc = sc;
+	mcu.tickInt = 1;
+	mcu.stopClock.hz = SIM_RTC_HZ;
+	mcu.stopClock.wrap = 86400UL * SIM_RTC_HZ;
+	rng = 2463534242u;
+	mcu.nextPress = ExpUs(SIM_PRESS_MS);
+	buttonPressed = buttonHandled = 0;
+
+	SCHED_Init(&sched, &port, sc->master ? CanStop : NULL);
+	if (sc->master) {
+		TXQUEUE_Init(&txQueue, StartTransmit, NULL, 8, 2);
+		TXQUEUE_Seed(&txQueue, 1);
+		SCHED_AddTimer(&sched, COUNT_Task, 2000);
+		txTask = SCHED_AddTask(&sched, TX_Task);
+		buttonTask = SCHED_AddTask(&sched, BUTTON_Task);
+	}
+	uint32_t tick0 = mcu.uwTick;
+	while (mcu.t < SIM_SECONDS * 1000000ULL) {
+		Busy(SIM_RUN_US);
+		SCHED_Run(&sched);
+	}
+
+	uint16_t run, sleep, stop;
+	SCHED_GetResidency(&sched, &run, &sleep, &stop);
+	uint64_t total = mcu.cpuUs[CPU_RUN] + mcu.cpuUs[CPU_SLEEP] + mcu.cpuUs[CPU_STOP];
+	printf("\n%s: %lu stop, uwTick %+.2f/%+.2f ms dal tempo reale (min/max), %+.2f ms alla fine\n", sc->name,
+			(unsigned long) mcu.stops, mcu.driftMin, mcu.driftMax, mcu.uwTick - mcu.t / 1000.0);
+	printf("  %-10s %10s %10s %10s\n", "residenza", "run", "sleep", "stop");
+	printf("  %-10s %9.1f%% %9.1f%% %9.1f%%\n", "scheduler", run / 10.0, sleep / 10.0, stop / 10.0);
+	printf("  %-10s %9.1f%% %9.1f%% %9.1f%%\n", "reale", 100.0 * mcu.cpuUs[CPU_RUN] / total,
+			100.0 * mcu.cpuUs[CPU_SLEEP] / total, 100.0 * mcu.cpuUs[CPU_STOP] / total);
+	printf("  %-10s %10lu %10lu %10lu   (ms; uwTick trascorsi %lu)\n", "scheduler", (unsigned long) sched.runMs,
+			(unsigned long) sched.sleepMs, (unsigned long) sched.stopMs, (unsigned long) (mcu.uwTick - tick0));
+	printf("  %-10s %10.0f %10.0f %10.0f\n", "reale", mcu.cpuUs[CPU_RUN] / 1000.0, mcu.cpuUs[CPU_SLEEP] / 1000.0,
+			mcu.cpuUs[CPU_STOP] / 1000.0);
+	printf("  %-8s %-6s %8s %10s %10s %10s %10s\n", "sorgente", "stato", "eventi", "ISR medio", "ISR max",
+			"task medio", "task max");
+	for (int i = 0; i < IRQ_SOURCES; i++)
+		for (int c = 0; c < CPU_STATES; c++) {
+			const Latency_t* l = &mcu.isr[i][c];
+			const Latency_t* k = &mcu.task[i][c];
+			if (l->count == 0)
+				continue;
+			printf("  %-8s %-6s %8lu %8.1f us %7lu us", irqName[i], cpuName[c], (unsigned long) l->count,
+					(double) l->sum / l->count, (unsigned long) l->max);
+			if (k->count)
+				printf(" %7.1f us %7lu us", (double) k->sum / k->count, (unsigned long) k->max);
+			printf("\n");
+		}
+
+	if (sc->lsiMilliHz > SIM_LSI_VALUE * 1001ULL)
+		return;
+	CHECK(sched.runMs + (mcu.uwTick - sched.idleEnd) + sched.sleepMs + sched.stopMs == mcu.uwTick - tick0);
+	CHECK(run + sleep + stop == 1000);
+	CHECK(fabs(sched.sleepMs - mcu.cpuUs[CPU_SLEEP] / 1000.0) < SIM_RESIDENCY_MS);
+	CHECK(fabs(sched.stopMs - mcu.cpuUs[CPU_STOP] / 1000.0) < SIM_RESIDENCY_MS);
+	/* ogni stop aggiunge un errore di quantizzazione dell'RTC a media nulla, uniforme entro un conteggio */
+	double driftMs = 1.0 + 4 * 1000.0 / SIM_RTC_HZ * sqrt(mcu.stops / 6.0);
+	CHECK(mcu.driftMax < driftMs && mcu.driftMin > -driftMs);
+	CHECK(mcu.stops > 100);
+}
+
+/**
+ * @brief SCHED_StopElapsed() su una sequenza di stop da 4.3 ms con il contatore a 16 kHz, a cavallo dell'azzeramento.
+ */
+static void CheckStopElapsed(void) {
+	SCHED_StopClock_t c = { SIM_RTC_HZ, 86400UL * SIM_RTC_HZ, 0 };
+	uint32_t counts = 86400UL * SIM_RTC_HZ - 5000;
+	uint64_t ms = 0;
+	for (int i = 0; i < 10000; i++) {
+		uint32_t next = (counts + 69 - (i % 10 == 0)) % c.wrap;	// 4.3125 ms, un conteggio in meno ogni dieci
+		ms += SCHED_StopElapsed(&c, counts, next, 250);			// 0.25 ms persi a ogni stop
+		counts = next;
+	}
+	/* 10000 * (69 * 62.5 us + 250 us) - 1000 * 62.5 us = 45562.5 ms */
+	CHECK(ms == 45562);
+}
+
+int main(void) {
+	static const Scenario_t scenario[] = {
+		{ "Interrupt (INT_HAL_Based_F4)", 0, SIM_LSI_VALUE * 1000ULL + 3 },
+		{ "Master (I2C_MASTER_A_F4)", 1, SIM_LSI_VALUE * 1000ULL + 3 },
+		{ "Master, LSI +5%", 1, SIM_LSI_VALUE * 1050ULL },
+	};
+	for (unsigned s = 0; s < sizeof(scenario) / sizeof(scenario[0]); s++)
+		Run(&scenario[s]);
+	CheckStopElapsed();
+	printf("\nsched_sim: %s\n", failures == 0 ? "OK" : "FAILED");
+	return failures != 0;
+}
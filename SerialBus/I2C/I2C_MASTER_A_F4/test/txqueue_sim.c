@@ -0,0 +1,347 @@
+/**
+ * @file txqueue_sim.c
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+/**
+ * @brief Simulazione su host di due Master che contendono il bus I2C per lo Slave C.
+ *
+ * @details
+ * Il bus e' simulato a passi di 1 us, a 400 kHz (2.5 us per bit). Ciascun Master genera pressioni del push button
+ * secondo un processo di Poisson e trasmette frame di due byte {'A'|'B', valore}:
+ *  - trasmissione originale: la ISR attende il bus e poi la fine del proprio trasferimento; un NACK o un arbitraggio
+ *    perso fanno perdere il frame, le pressioni che arrivano durante la ISR si fondono nel flag EXTI pendente;
+ *  - trasmissione differita: la ISR conta la pressione, il main loop accoda e pilota TXQUEUE con backoff.
+ *
+ * Due Master che iniziano entro un bit l'uno dall'altro vedono entrambi il bus libero e collidono: il primo byte dati
+ * differisce ('A' < 'B'), per cui B perde l'arbitraggio. Lo Slave risponde con NACK con probabilita' SIM_NACK_PERMILLE.
+ * I clock dei due Master hanno una fase casuale. Per ogni carico sono riportati i messaggi consegnati al secondo, i
+ * messaggi persi e la loro percentuale, gli arbitraggi persi e la durata massima di una ISR, misurata per entrambe le
+ * politiche come tempo simulato tra l'ingresso e l'uscita della ISR (le attese del bus). Per la trasmissione differita e'
+ * riportato anche il tempo massimo di CPU, misurato sull'host, del codice eseguito nei callback della periferica
+ * (TXQUEUE_Complete() e TXQUEUE_Failed()); ogni chiamata e' misurata come minimo di SIM_CPU_REPEAT ripetizioni su una
+ * copia della coda.
+ *
+ * Sono verificati:
+ *  - che con la trasmissione differita nessuna ISR attenda il bus;
+ *  - che, a ogni carico, la trasmissione differita non perda piu' messaggi di quella originale. Con pressioni a
+ *    saturazione (5000/s per Master) la coda da 8 messaggi ne perdeva circa il 30%, contro il 17% della trasmissione
+ *    originale: TXQUEUE_LENGTH e' percio' 32.
+ * @code
+ * gcc -std=gnu99 -O2 -Wall -Iinc test/txqueue_sim.c src/txqueue.c -lm -o txqueue_sim && ./txqueue_sim
+ * @endcode
+ */
+#include "txqueue.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <math.h>
+
+static int failures = 0;
+
+#define CHECK(cond) do { if (!(cond)) { printf("%s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+#define SIM_SECONDS			10				//!< durata simulata per ogni carico
+#define SIM_BIT_NS			2500			//!< durata di un bit a 400 kHz
+#define SIM_NACK_PERMILLE	20				//!< probabilita' di NACK dello Slave, per mille
+#define SIM_BUSY_TIMEOUT_US	25000			//!< attesa massima del flag BUSY nella HAL
+#define SIM_ARLO_BITS		12				//!< bit trasmessi prima che il perdente rilevi la collisione
+#define SIM_MAX_RETRY		8				//!< ritrasmissioni della coda, come in config.h
+#define SIM_BACKOFF_MS		2				//!< finestra di backoff iniziale, come in config.h
+#define SIM_CPU_REPEAT		5				//!< ripetizioni della misura del tempo di CPU di un callback
+
+/**
+ * @brief Generatore pseudo-casuale xorshift, per rendere la simulazione riproducibile.
+ */
+static uint32_t rng = 12345;
+static uint32_t Random(void) {
+	rng ^= rng << 13;
+	rng ^= rng >> 17;
+	rng ^= rng << 5;
+	return rng;
+}
+
+/**
+ * @brief Durata, in us, di un frame di len byte: start, indirizzo, dati (9 bit ciascuno) e stop.
+ */
+static uint32_t FrameUs(uint8_t len) {
+	return ((uint32_t)(len + 1) * 9 + 2) * SIM_BIT_NS / 1000 + 1;
+}
+
+typedef enum { OUT_OK, OUT_NACK, OUT_ARLO } Outcome_t;
+
+/**
+ * @brief Stato del bus condiviso.
+ */
+static struct {
+	int owner;			//!< Master che occupa il bus, -1 se libero
+	uint32_t start;		//!< istante della condizione di start
+	uint32_t end;		//!< istante dello stop
+} bus;
+
+/**
+ * @brief Stato di un Master.
+ */
+typedef struct {
+	int id;
+	uint32_t phase;				//!< fase del clock in ms del Master, in us
+	uint32_t nextPress;			//!< istante della prossima pressione
+	/* trasferimento in corso */
+	int txActive;
+	uint32_t txEnd;
+	Outcome_t txOutcome;
+	/* trasmissione originale */
+	int isrActive, isrPending, isrWaiting;
+	uint32_t isrStart, isrMax;	//!< ingresso della ISR in corso e durata massima, in us simulati
+	double cpuMaxNs;				//!< tempo massimo di CPU del codice della ISR, in ns misurati sull'host
+	/* trasmissione differita */
+	TXQUEUE_t q;
+	uint32_t deferUntil;
+	int deferred;
+	/* contatori */
+	uint32_t presses, delivered, lost, arlo;
+} Master_t;
+
+static Master_t m[2];
+static uint32_t now;
+
+static uint32_t NowMs(const Master_t* x) {
+	return (now + x->phase) / 1000;
+}
+
+/**
+ * @brief Tempo di interarrivo esponenziale, in us, per un processo di Poisson di ratePerS eventi al secondo.
+ */
+static uint32_t ExpUs(uint32_t ratePerS) {
+	double u = (Random() + 1.0) / 4294967297.0;
+	return (uint32_t)(-log(u) * 1e6 / ratePerS) + 1;
+}
+
+/**
+ * @brief Avvia un trasferimento sul bus; restituisce 0 se il bus era occupato da piu' di un bit.
+ */
+static int BusStart(Master_t* x, uint8_t len) {
+	uint32_t dur = FrameUs(len);
+	if (bus.owner >= 0 && now - bus.start > SIM_BIT_NS / 1000)
+		return 0;
+	if (bus.owner >= 0) {
+		/* start entro un bit dall'altro Master: collisione, B ('B' > 'A') perde l'arbitraggio */
+		Master_t* other = &m[bus.owner];
+		Master_t* loser = x->id > other->id ? x : other;
+		Master_t* winner = loser == x ? other : x;
+		if (winner == x) {
+			bus.owner = x->id;
+			bus.end = now + dur;
+			x->txOutcome = OUT_OK;
+			x->txEnd = bus.end;
+		}
+		loser->txOutcome = OUT_ARLO;
+		loser->arlo++;
+		loser->txEnd = bus.start + SIM_ARLO_BITS * SIM_BIT_NS / 1000;
+		x->txActive = 1;
+		return 1;
+	}
+	bus.owner = x->id;
+	bus.start = now;
+	if (Random() % 1000 < SIM_NACK_PERMILLE) {
+		x->txOutcome = OUT_NACK;
+		bus.end = now + 10 * SIM_BIT_NS / 1000;
+	}
+	else {
+		x->txOutcome = OUT_OK;
+		bus.end = now + dur;
+	}
+	x->txEnd = bus.end;
+	x->txActive = 1;
+	return 1;
+}
+
+/* ---------------------------------------------------------------- trasmissione differita */
+
+static int StartTransmit(void* ctx, uint8_t* data, uint8_t len) {
+	(void)data;
+	Master_t* x = (Master_t*)ctx;
+	if (x->txActive)
+		return TXQUEUE_LOCKED;
+	return BusStart(x, len) ? TXQUEUE_STARTED : TXQUEUE_BUS_BUSY;
+}
+
+static void TxTask(Master_t* x) {
+	uint32_t ms = NowMs(x);
+	TXQUEUE_Poll(&x->q, ms);
+	x->deferred = 0;
+	if (x->q.state == TXQUEUE_BACKOFF) {
+		int32_t wait = (int32_t)(x->q.nextAttempt - ms);
+		x->deferred = 1;
+		x->deferUntil = now + (wait > 0 ? wait : 0) * 1000;
+	}
+	else if (x->q.state == TXQUEUE_IDLE && TXQUEUE_Count(&x->q) != 0) {
+		x->deferred = 1;
+		x->deferUntil = now + 1000;
+	}
+}
+
+/**
+ * @brief Codice eseguito dai callback della periferica al termine di un trasferimento.
+ */
+static void Callback(Master_t* x, TXQUEUE_t* q) {
+	if (x->txOutcome == OUT_OK)
+		TXQUEUE_Complete(q, NowMs(x));
+	else
+		TXQUEUE_Failed(q, NowMs(x), x->txOutcome == OUT_NACK ? TXQUEUE_NACK : TXQUEUE_ARLO);
+}
+
+/**
+ * @brief Tempo di CPU, in ns sull'host, di Callback() sullo stato corrente della coda.
+ * @details Il callback e' eseguito SIM_CPU_REPEAT volte su copie della coda e viene preso il tempo minimo, che esclude
+ * le interruzioni e le preemption dell'host.
+ */
+static double CallbackNs(Master_t* x) {
+	double best = 1e18;
+	for (int r = 0; r < SIM_CPU_REPEAT; r++) {
+		static TXQUEUE_t copy;
+		struct timespec t0, t1;
+		copy = x->q;
+		clock_gettime(CLOCK_MONOTONIC, &t0);
+		Callback(x, &copy);
+		clock_gettime(CLOCK_MONOTONIC, &t1);
+		double ns = (t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec);
+		if (ns < best)
+			best = ns;
+	}
+	return best;
+}
+
+static void StepDeferred(Master_t* x) {
+	if (now == x->nextPress) {
+		/* EXTI: la ISR conta la pressione, BUTTON_Task accoda */
+		uint8_t frame[2] = {(uint8_t)('A' + x->id), 0};
+		x->presses++;
+		if (TXQUEUE_Push(&x->q, frame, 2, NowMs(x)) != 0)
+			x->lost++;
+		TxTask(x);
+	}
+	if (x->txActive && now == x->txEnd) {
+		/* callback della periferica: HAL_I2C_MasterTxCpltCallback() o HAL_I2C_ErrorCallback() */
+		x->txActive = 0;
+		x->isrStart = now;
+		uint32_t dropped = x->q.dropped;
+		double ns = CallbackNs(x);
+		if (ns > x->cpuMaxNs)
+			x->cpuMaxNs = ns;
+		Callback(x, &x->q);
+		if (now - x->isrStart > x->isrMax)
+			x->isrMax = now - x->isrStart;
+		if (x->txOutcome == OUT_OK)
+			x->delivered++;
+		x->lost += x->q.dropped - dropped;
+		TxTask(x);
+	}
+	if (x->deferred && now >= x->deferUntil)
+		TxTask(x);
+}
+
+/* ---------------------------------------------------------------- trasmissione originale */
+
+static void StepBlocking(Master_t* x) {
+	if (now == x->nextPress) {
+		x->presses++;
+		if (!x->isrActive) {
+			x->isrActive = 1;
+			x->isrWaiting = 1;
+			x->isrStart = now;
+		}
+		else if (x->isrPending)
+			x->lost++;			/* il flag EXTI e' gia' pendente: la pressione si perde */
+		else
+			x->isrPending = 1;
+	}
+	if (x->isrActive && x->isrWaiting) {
+		/* HAL_I2C_Master_Transmit_IT attende il flag BUSY, poi la ISR attende la fine del trasferimento */
+		if (BusStart(x, 2))
+			x->isrWaiting = 0;
+		else if (now - x->isrStart > SIM_BUSY_TIMEOUT_US)
+			x->isrWaiting = 0, x->isrActive = 0, x->lost++;
+	}
+	if (x->txActive && now == x->txEnd) {
+		x->txActive = 0;
+		if (x->txOutcome == OUT_OK)
+			x->delivered++;
+		else
+			x->lost++;
+		uint32_t d = now - x->isrStart;
+		if (d > x->isrMax)
+			x->isrMax = d;
+		x->isrActive = 0;
+		if (x->isrPending) {
+			x->isrPending = 0;
+			x->isrActive = 1;
+			x->isrWaiting = 1;
+			x->isrStart = now;
+		}
+	}
+}
+
+static uint32_t Run(int deferred, uint32_t ratePerS) {
+	memset(m, 0, sizeof(m));
+	memset(&bus, 0, sizeof(bus));
+	bus.owner = -1;
+	for (int i = 0; i < 2; i++) {
+		m[i].id = i;
+		m[i].phase = Random() % 1000;
+		TXQUEUE_Init(&m[i].q, StartTransmit, &m[i], SIM_MAX_RETRY, SIM_BACKOFF_MS);
+		TXQUEUE_Seed(&m[i].q, (i + 1) << 24 ^ Random());
+		m[i].nextPress = ExpUs(ratePerS);
+	}
+	for (now = 0; now < SIM_SECONDS * 1000000U; now++) {
+		if (bus.owner >= 0 && now >= bus.end)
+			bus.owner = -1;
+		for (int i = 0; i < 2; i++) {
+			if (deferred)
+				StepDeferred(&m[i]);
+			else
+				StepBlocking(&m[i]);
+			if (now == m[i].nextPress)
+				m[i].nextPress = now + ExpUs(ratePerS);
+		}
+	}
+	uint32_t presses = m[0].presses + m[1].presses;
+	uint32_t delivered = m[0].delivered + m[1].delivered;
+	uint32_t lost = m[0].lost + m[1].lost;
+	uint32_t isrMax = m[0].isrMax > m[1].isrMax ? m[0].isrMax : m[1].isrMax;
+	printf("%-9s %7lu %9lu %11.1f %7lu %5.1f%% %8lu %6lu us ", deferred ? "deferred" : "blocking",
+			(unsigned long)ratePerS, (unsigned long)presses, delivered / (double)SIM_SECONDS, (unsigned long)lost,
+			100.0 * lost / presses, (unsigned long)(m[0].arlo + m[1].arlo), (unsigned long)isrMax);
+	if (deferred)
+		printf("%7.0f ns\n", m[0].cpuMaxNs > m[1].cpuMaxNs ? m[0].cpuMaxNs : m[1].cpuMaxNs);
+	else
+		printf("%10s\n", "-");
+	return lost;
+}
+
+int main(void) {
+	static const uint32_t rates[] = {10, 100, 1000, 5000};
+	printf("%-9s %7s %9s %11s %7s %6s %8s %9s %10s\n", "policy", "rate/M", "presses", "deliv/s", "lost", "", "arlo",
+			"ISR wait", "ISR CPU");
+	for (unsigned r = 0; r < sizeof(rates) / sizeof(rates[0]); r++) {
+		uint32_t blockingLost = Run(0, rates[r]);
+		uint32_t deferredLost = Run(1, rates[r]);
+		CHECK(m[0].isrMax == 0 && m[1].isrMax == 0);
+		CHECK(deferredLost <= blockingLost);
+	}
+	printf("txqueue_sim: %s\n", failures == 0 ? "OK" : "FAILED");
+	return failures != 0;
+}
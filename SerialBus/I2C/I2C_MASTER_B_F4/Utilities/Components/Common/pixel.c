@@ -0,0 +1,153 @@
+/**
+ * @file pixel.c
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+#include "pixel.h"
+#include <assert.h>
+#include <string.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#define PIXEL_SPREAD_MASK	0x07E0F81FUL	//!< canali di un pixel RGB565 distribuiti in 32 bit: G<<16 | R<<11 | B
+
+/**
+ * @brief Converte l'alpha a 8 bit nell'alpha a 5 bit (0..32) usato dalla fusione.
+ */
+#define PIXEL_ALPHA5(alpha)	(((uint32_t)(alpha) + 4) >> 3)
+
+static inline uint16_t PIXEL_ToRGB565(uint32_t argb) {
+	return (uint16_t)(((argb >> 8) & 0xF800) | ((argb >> 5) & 0x07E0) | ((argb >> 3) & 0x001F));
+}
+
+static inline uint16_t PIXEL_Mix(uint16_t fg, uint16_t bg, uint32_t a5) {
+	uint32_t f = (fg | ((uint32_t)fg << 16)) & PIXEL_SPREAD_MASK;
+	uint32_t b = (bg | ((uint32_t)bg << 16)) & PIXEL_SPREAD_MASK;
+	uint32_t r = ((((f - b) * a5) >> 5) + b) & PIXEL_SPREAD_MASK;
+	return (uint16_t)(r | (r >> 16));
+}
+
+#if defined(__SSE2__)
+/**
+ * @brief Converte 4 pixel ARGB8888 in 4 valori RGB565 a 32 bit.
+ */
+static inline __m128i PIXEL_ToRGB565x4(__m128i p) {
+	__m128i r = _mm_and_si128(_mm_srli_epi32(p, 8), _mm_set1_epi32(0xF800));
+	__m128i g = _mm_and_si128(_mm_srli_epi32(p, 5), _mm_set1_epi32(0x07E0));
+	__m128i b = _mm_and_si128(_mm_srli_epi32(p, 3), _mm_set1_epi32(0x001F));
+	return _mm_or_si128(_mm_or_si128(r, g), b);
+}
+
+/**
+ * @brief Impacchetta due gruppi di 4 valori a 32 bit, minori di 65536, in 8 valori a 16 bit.
+ */
+static inline __m128i PIXEL_Pack16(__m128i lo, __m128i hi) {
+	/* estensione del segno da 16 bit, perche' _mm_packs_epi32 satura con segno */
+	lo = _mm_srai_epi32(_mm_slli_epi32(lo, 16), 16);
+	hi = _mm_srai_epi32(_mm_slli_epi32(hi, 16), 16);
+	return _mm_packs_epi32(lo, hi);
+}
+
+/**
+ * @brief Fonde 8 pixel RGB565, canale per canale, con alpha a 5 bit per pixel.
+ */
+static inline __m128i PIXEL_Mix8(__m128i f, __m128i b, __m128i a) {
+	const __m128i m5 = _mm_set1_epi16(0x1F), m6 = _mm_set1_epi16(0x3F);
+	__m128i na = _mm_sub_epi16(_mm_set1_epi16(32), a);
+	__m128i r = _mm_add_epi16(_mm_mullo_epi16(_mm_srli_epi16(f, 11), a), _mm_mullo_epi16(_mm_srli_epi16(b, 11), na));
+	__m128i g = _mm_add_epi16(_mm_mullo_epi16(_mm_and_si128(_mm_srli_epi16(f, 5), m6), a),
+			_mm_mullo_epi16(_mm_and_si128(_mm_srli_epi16(b, 5), m6), na));
+	__m128i bl = _mm_add_epi16(_mm_mullo_epi16(_mm_and_si128(f, m5), a), _mm_mullo_epi16(_mm_and_si128(b, m5), na));
+	r = _mm_slli_epi16(_mm_srli_epi16(r, 5), 11);
+	g = _mm_slli_epi16(_mm_srli_epi16(g, 5), 5);
+	bl = _mm_srli_epi16(bl, 5);
+	return _mm_or_si128(_mm_or_si128(r, g), bl);
+}
+#endif
+
+void PIXEL_Fill(uint16_t* dst, uint16_t color, uint32_t n) {
+	assert(dst || n == 0);
+	for (uint32_t i = 0; i < n; i++)
+		dst[i] = color;
+}
+
+void PIXEL_FromARGB8888(uint16_t* dst, const uint32_t* src, uint32_t n) {
+	assert((dst && src) || n == 0);
+	uint32_t i = 0;
+#if defined(__SSE2__)
+	for (; i + 8 <= n; i += 8) {
+		__m128i lo = PIXEL_ToRGB565x4(_mm_loadu_si128((const __m128i*)(src + i)));
+		__m128i hi = PIXEL_ToRGB565x4(_mm_loadu_si128((const __m128i*)(src + i + 4)));
+		_mm_storeu_si128((__m128i*)(dst + i), PIXEL_Pack16(lo, hi));
+	}
+#endif
+	for (; i < n; i++)
+		dst[i] = PIXEL_ToRGB565(src[i]);
+}
+
+void PIXEL_FromRGB888(uint16_t* dst, const uint8_t* src, uint32_t n) {
+	assert((dst && src) || n == 0);
+	for (uint32_t i = 0; i < n; i++, src += 3)
+		dst[i] = PIXEL_RGB565(src[2], src[1], src[0]);
+}
+
+void PIXEL_Blend(uint16_t* dst, const uint16_t* src, uint8_t alpha, uint32_t n) {
+	assert((dst && src) || n == 0);
+	uint32_t a5 = PIXEL_ALPHA5(alpha);
+	if (a5 == 0)
+		return;
+	if (a5 == 32) {
+		memmove(dst, src, n * sizeof(uint16_t));
+		return;
+	}
+	uint32_t i = 0;
+#if defined(__SSE2__)
+	__m128i a = _mm_set1_epi16((short)a5);
+	for (; i + 8 <= n; i += 8) {
+		__m128i f = _mm_loadu_si128((const __m128i*)(src + i));
+		__m128i b = _mm_loadu_si128((const __m128i*)(dst + i));
+		_mm_storeu_si128((__m128i*)(dst + i), PIXEL_Mix8(f, b, a));
+	}
+#endif
+	for (; i < n; i++)
+		dst[i] = PIXEL_Mix(src[i], dst[i], a5);
+}
+
+void PIXEL_BlendARGB8888(uint16_t* dst, const uint32_t* src, uint32_t n) {
+	assert((dst && src) || n == 0);
+	uint32_t i = 0;
+#if defined(__SSE2__)
+	const __m128i four = _mm_set1_epi32(4);
+	for (; i + 8 <= n; i += 8) {
+		__m128i plo = _mm_loadu_si128((const __m128i*)(src + i));
+		__m128i phi = _mm_loadu_si128((const __m128i*)(src + i + 4));
+		__m128i f = PIXEL_Pack16(PIXEL_ToRGB565x4(plo), PIXEL_ToRGB565x4(phi));
+		__m128i a = _mm_packs_epi32(_mm_srli_epi32(_mm_add_epi32(_mm_srli_epi32(plo, 24), four), 3),
+				_mm_srli_epi32(_mm_add_epi32(_mm_srli_epi32(phi, 24), four), 3));
+		__m128i b = _mm_loadu_si128((const __m128i*)(dst + i));
+		_mm_storeu_si128((__m128i*)(dst + i), PIXEL_Mix8(f, b, a));
+	}
+#endif
+	for (; i < n; i++) {
+		uint32_t a5 = PIXEL_ALPHA5(src[i] >> 24);
+		if (a5 == 32)
+			dst[i] = PIXEL_ToRGB565(src[i]);
+		else if (a5 != 0)
+			dst[i] = PIXEL_Mix(PIXEL_ToRGB565(src[i]), dst[i], a5);
+	}
+}
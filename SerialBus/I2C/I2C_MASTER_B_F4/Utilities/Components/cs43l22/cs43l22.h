@@ -141,6 +141,11 @@
 #define   CS43L22_REG_TEMPMONITOR_CTL     0x32
 #define   CS43L22_REG_THERMAL_FOLDBACK    0x33
 #define   CS43L22_REG_CHARGE_PUMP_FREQ    0x34
+#define   CS43L22_REG_MAX                 CS43L22_REG_CHARGE_PUMP_FREQ
+
+/* MAP byte: INCR bit, auto-increment of the register address after each byte 
+   of a write (or read) transaction */
+#define   CS43L22_MAP_INCR                0x80
 
 /******************************************************************************/
 /****************************** REGISTER MAPPING ******************************/
@@ -201,7 +206,8 @@ uint32_t cs43l22_Reset(uint16_t DeviceAddr);
 /* AUDIO IO functions */
 void      AUDIO_IO_Init(void);
 void      AUDIO_IO_DeInit(void);
-void      AUDIO_IO_Write(uint8_t Addr, uint8_t Reg, uint8_t Value);
+uint8_t   AUDIO_IO_Write(uint8_t Addr, uint8_t Reg, uint8_t Value);
+uint8_t   AUDIO_IO_WriteMultiple(uint8_t Addr, uint8_t Reg, uint8_t *pBuffer, uint16_t Length);
 uint8_t   AUDIO_IO_Read(uint8_t Addr, uint8_t Reg);
 
 /* Audio driver structure */
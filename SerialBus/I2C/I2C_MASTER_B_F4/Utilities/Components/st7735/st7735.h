@@ -46,6 +46,7 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "../Common/lcd.h"
+#include "../Common/pixel.h"
 
 /** @addtogroup BSP
   * @{
@@ -181,10 +182,16 @@ uint16_t st7735_GetLcdPixelWidth(void);
 uint16_t st7735_GetLcdPixelHeight(void);
 void     st7735_DrawBitmap(uint16_t Xpos, uint16_t Ypos, uint8_t *pbmp);
 
+void     st7735_FillRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height, uint16_t RGBCode);
+void     st7735_BlitRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height, const uint16_t *pData, uint16_t Pitch);
+void     st7735_WriteWindow(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height);
+void     st7735_WritePixels(const uint16_t *pData, uint32_t Size);
+
 /* LCD driver structure */
 extern LCD_DrvTypeDef   st7735_drv;
 
-/* LCD IO functions */
+/* LCD IO functions. LCD_IO_WriteMultipleData must be synchronous: the
+   driver reuses the data buffer as soon as it returns */
 void     LCD_IO_Init(void);
 void     LCD_IO_WriteMultipleData(uint8_t *pData, uint32_t Size);
 void     LCD_IO_WriteReg(uint8_t Reg);
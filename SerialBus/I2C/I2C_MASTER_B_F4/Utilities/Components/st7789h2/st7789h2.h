@@ -47,6 +47,7 @@
 /* Includes ------------------------------------------------------------------*/
 #include <stdio.h>
 #include "../Common/lcd.h"
+#include "../Common/pixel.h"
 
 /** @addtogroup BSP
   * @{
@@ -81,6 +82,13 @@
 #define  ST7789H2_LCD_PIXEL_WIDTH    ((uint16_t)240)
 #define  ST7789H2_LCD_PIXEL_HEIGHT   ((uint16_t)240)
 
+/** 
+  * @brief  Pixels sent per IO transfer by FillRect  
+  */  
+#ifndef ST7789H2_FILL_CHUNK
+#define  ST7789H2_FILL_CHUNK         ((uint16_t)64)
+#endif
+
 /**
  *  @brief LCD_OrientationTypeDef
  *  Possible values of Display Orientation
@@ -148,6 +156,11 @@ void     ST7789H2_DrawRGBImage(uint16_t Xpos, uint16_t Ypos, uint16_t Xsize, uin
 
 void     ST7789H2_SetDisplayWindow(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height);
 
+void     ST7789H2_FillRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height, uint16_t RGBCode);
+void     ST7789H2_BlitRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height, const uint16_t *pData, uint16_t Pitch);
+void     ST7789H2_WriteWindow(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height);
+void     ST7789H2_WritePixels(const uint16_t *pData, uint32_t Size);
+
 
 uint16_t ST7789H2_GetLcdPixelWidth(void);
 uint16_t ST7789H2_GetLcdPixelHeight(void);
@@ -155,7 +168,8 @@ uint16_t ST7789H2_GetLcdPixelHeight(void);
 /* LCD driver structure */
 extern LCD_DrvTypeDef   ST7789H2_drv;
 
-/* LCD IO functions */
+/* LCD IO functions. LCD_IO_WriteMultipleData must be synchronous: the
+   driver reuses the data buffer as soon as it returns */
 extern void     LCD_IO_Init(void);
 extern void     LCD_IO_WriteMultipleData(uint16_t *pData, uint32_t Size);
 extern void     LCD_IO_WriteReg(uint8_t Reg);
@@ -38,6 +38,7 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "stmpe811.h"
+#include "../Common/regcache.h"
 
 /** @addtogroup BSP
   * @{
@@ -59,6 +60,10 @@
   * @{
   */ 
 #define STMPE811_MAX_INSTANCE         2 
+
+/* Window of the register copy: SYS_CTRL2 to IO_AF */
+#define STMPE811_CACHE_FIRST          STMPE811_REG_SYS_CTRL2
+#define STMPE811_CACHE_COUNT          (STMPE811_REG_IO_AF - STMPE811_REG_SYS_CTRL2 + 1)
 /**
   * @}
   */
@@ -107,6 +112,13 @@ IO_DrvTypeDef stmpe811_io_drv =
 
 /* stmpe811 instances by address */
 uint8_t stmpe811[STMPE811_MAX_INSTANCE] = {0};
+
+/* Copy of the configuration registers of each instance, read-modified-written 
+   by most of the commands. SYS_CTRL2, INT_CTRL, INT_EN, IO_INT_EN, IO_DIR, 
+   IO_RE, IO_FE and IO_AF are only changed by the driver; the status registers 
+   (INT_STA, IO_INT_STA, IO_ED, IO_MP_STA) and SYS_CTRL1, whose reset bits 
+   clear themselves, are always read and written on the bus */
+static REGCACHE_t stmpe811Cache[STMPE811_MAX_INSTANCE];
 /**
   * @}
   */ 
@@ -115,6 +127,8 @@ uint8_t stmpe811[STMPE811_MAX_INSTANCE] = {0};
   * @{
   */
 static uint8_t stmpe811_GetInstance(uint16_t DeviceAddr); 
+static uint8_t stmpe811_ReadReg(uint16_t DeviceAddr, uint8_t Reg);
+static void    stmpe811_WriteReg(uint16_t DeviceAddr, uint8_t Reg, uint8_t Value);
 /**
   * @}
   */ 
@@ -163,6 +177,8 @@ void stmpe811_Init(uint16_t DeviceAddr)
   */
 void stmpe811_Reset(uint16_t DeviceAddr)
 {
+  uint8_t instance;
+  
   /* Power Down the stmpe811 */  
   IOE_Write(DeviceAddr, STMPE811_REG_SYS_CTRL1, 2);
 
@@ -174,6 +190,22 @@ void stmpe811_Reset(uint16_t DeviceAddr)
   
   /* Wait for a delay to ensure registers erasing */
   IOE_Delay(2); 
+  
+  /* The register values are back to their defaults, not yet known */
+  instance = stmpe811_GetInstance(DeviceAddr);
+  if(instance != 0xFF)
+  {
+    if(stmpe811Cache[instance].count == 0)
+    {
+      REGCACHE_Init(&stmpe811Cache[instance], STMPE811_CACHE_FIRST, STMPE811_CACHE_COUNT);
+      REGCACHE_Cacheable(&stmpe811Cache[instance], STMPE811_REG_SYS_CTRL2, STMPE811_REG_SYS_CTRL2);
+      REGCACHE_Cacheable(&stmpe811Cache[instance], STMPE811_REG_INT_CTRL, STMPE811_REG_INT_EN);
+      REGCACHE_Cacheable(&stmpe811Cache[instance], STMPE811_REG_IO_INT_EN, STMPE811_REG_IO_INT_EN);
+      REGCACHE_Cacheable(&stmpe811Cache[instance], STMPE811_REG_IO_DIR, STMPE811_REG_IO_DIR);
+      REGCACHE_Cacheable(&stmpe811Cache[instance], STMPE811_REG_IO_RE, STMPE811_REG_IO_AF);
+    }
+    REGCACHE_Invalidate(&stmpe811Cache[instance]);
+  }
 }
 
 /**
@@ -201,13 +233,13 @@ void stmpe811_EnableGlobalIT(uint16_t DeviceAddr)
   uint8_t tmp = 0;
   
   /* Read the Interrupt Control register  */
-  tmp = IOE_Read(DeviceAddr, STMPE811_REG_INT_CTRL);
+  tmp = stmpe811_ReadReg(DeviceAddr, STMPE811_REG_INT_CTRL);
   
   /* Set the global interrupts to be Enabled */    
   tmp |= (uint8_t)STMPE811_GIT_EN;
   
   /* Write Back the Interrupt Control register */
-  IOE_Write(DeviceAddr, STMPE811_REG_INT_CTRL, tmp); 
+  stmpe811_WriteReg(DeviceAddr, STMPE811_REG_INT_CTRL, tmp); 
 }
 
 /**
@@ -220,13 +252,13 @@ void stmpe811_DisableGlobalIT(uint16_t DeviceAddr)
   uint8_t tmp = 0;
   
   /* Read the Interrupt Control register  */
-  tmp = IOE_Read(DeviceAddr, STMPE811_REG_INT_CTRL);
+  tmp = stmpe811_ReadReg(DeviceAddr, STMPE811_REG_INT_CTRL);
 
   /* Set the global interrupts to be Disabled */    
   tmp &= ~(uint8_t)STMPE811_GIT_EN;
  
   /* Write Back the Interrupt Control register */
-  IOE_Write(DeviceAddr, STMPE811_REG_INT_CTRL, tmp);
+  stmpe811_WriteReg(DeviceAddr, STMPE811_REG_INT_CTRL, tmp);
     
 }
 
@@ -248,13 +280,13 @@ void stmpe811_EnableITSource(uint16_t DeviceAddr, uint8_t Source)
   uint8_t tmp = 0;
   
   /* Get the current value of the INT_EN register */
-  tmp = IOE_Read(DeviceAddr, STMPE811_REG_INT_EN);
+  tmp = stmpe811_ReadReg(DeviceAddr, STMPE811_REG_INT_EN);
 
   /* Set the interrupts to be Enabled */    
   tmp |= Source; 
   
   /* Set the register */
-  IOE_Write(DeviceAddr, STMPE811_REG_INT_EN, tmp);   
+  stmpe811_WriteReg(DeviceAddr, STMPE811_REG_INT_EN, tmp);   
 }
 
 /**
@@ -275,13 +307,13 @@ void stmpe811_DisableITSource(uint16_t DeviceAddr, uint8_t Source)
   uint8_t tmp = 0;
   
   /* Get the current value of the INT_EN register */
-  tmp = IOE_Read(DeviceAddr, STMPE811_REG_INT_EN);
+  tmp = stmpe811_ReadReg(DeviceAddr, STMPE811_REG_INT_EN);
 
   /* Set the interrupts to be Enabled */    
   tmp &= ~Source; 
   
   /* Set the register */
-  IOE_Write(DeviceAddr, STMPE811_REG_INT_EN, tmp);   
+  stmpe811_WriteReg(DeviceAddr, STMPE811_REG_INT_EN, tmp);   
 }
 
 /**
@@ -297,7 +329,7 @@ void stmpe811_SetITPolarity(uint16_t DeviceAddr, uint8_t Polarity)
   uint8_t tmp = 0;
   
   /* Get the current register value */ 
-  tmp = IOE_Read(DeviceAddr, STMPE811_REG_INT_CTRL);
+  tmp = stmpe811_ReadReg(DeviceAddr, STMPE811_REG_INT_CTRL);
   
   /* Mask the polarity bits */
   tmp &= ~(uint8_t)0x04;
@@ -306,7 +338,7 @@ void stmpe811_SetITPolarity(uint16_t DeviceAddr, uint8_t Polarity)
   tmp |= Polarity;
   
   /* Set the new register value */
-  IOE_Write(DeviceAddr, STMPE811_REG_INT_CTRL, tmp);
+  stmpe811_WriteReg(DeviceAddr, STMPE811_REG_INT_CTRL, tmp);
  
 }
 
@@ -323,7 +355,7 @@ void stmpe811_SetITType(uint16_t DeviceAddr, uint8_t Type)
   uint8_t tmp = 0;
   
   /* Get the current register value */ 
-  tmp = IOE_Read(DeviceAddr, STMPE811_REG_INT_CTRL);
+  tmp = stmpe811_ReadReg(DeviceAddr, STMPE811_REG_INT_CTRL);
   
   /* Mask the type bits */
   tmp &= ~(uint8_t)0x02;
@@ -332,7 +364,7 @@ void stmpe811_SetITType(uint16_t DeviceAddr, uint8_t Type)
   tmp |= Type;
   
   /* Set the new register value */
-  IOE_Write(DeviceAddr, STMPE811_REG_INT_CTRL, tmp);
+  stmpe811_WriteReg(DeviceAddr, STMPE811_REG_INT_CTRL, tmp);
  
 }
 
@@ -407,13 +439,13 @@ void stmpe811_IO_Start(uint16_t DeviceAddr, uint32_t IO_Pin)
   uint8_t mode;
   
   /* Get the current register value */
-  mode = IOE_Read(DeviceAddr, STMPE811_REG_SYS_CTRL2);
+  mode = stmpe811_ReadReg(DeviceAddr, STMPE811_REG_SYS_CTRL2);
   
   /* Set the Functionalities to be Disabled */    
   mode &= ~(STMPE811_IO_FCT | STMPE811_ADC_FCT);  
   
   /* Write the new register value */  
-  IOE_Write(DeviceAddr, STMPE811_REG_SYS_CTRL2, mode); 
+  stmpe811_WriteReg(DeviceAddr, STMPE811_REG_SYS_CTRL2, mode); 
 
   /* Disable AF for the selected IO pin(s) */
   stmpe811_IO_DisableAF(DeviceAddr, (uint8_t)IO_Pin);
@@ -502,7 +534,7 @@ void stmpe811_IO_InitPin(uint16_t DeviceAddr, uint32_t IO_Pin, uint8_t Direction
   uint8_t tmp = 0;   
   
   /* Get all the Pins direction */
-  tmp = IOE_Read(DeviceAddr, STMPE811_REG_IO_DIR);
+  tmp = stmpe811_ReadReg(DeviceAddr, STMPE811_REG_IO_DIR);
   
   /* Set the selected pin direction */
   if (Direction != STMPE811_DIRECTION_IN)
@@ -515,7 +547,7 @@ void stmpe811_IO_InitPin(uint16_t DeviceAddr, uint32_t IO_Pin, uint8_t Direction
   }
   
   /* Write the register new value */
-  IOE_Write(DeviceAddr, STMPE811_REG_IO_DIR, tmp);   
+  stmpe811_WriteReg(DeviceAddr, STMPE811_REG_IO_DIR, tmp);   
 }
 
 /**
@@ -531,13 +563,13 @@ void stmpe811_IO_DisableAF(uint16_t DeviceAddr, uint32_t IO_Pin)
   uint8_t tmp = 0;
   
   /* Get the current state of the IO_AF register */
-  tmp = IOE_Read(DeviceAddr, STMPE811_REG_IO_AF);
+  tmp = stmpe811_ReadReg(DeviceAddr, STMPE811_REG_IO_AF);
 
   /* Enable the selected pins alternate function */
   tmp |= (uint8_t)IO_Pin;
 
   /* Write back the new value in IO AF register */
-  IOE_Write(DeviceAddr, STMPE811_REG_IO_AF, tmp);
+  stmpe811_WriteReg(DeviceAddr, STMPE811_REG_IO_AF, tmp);
   
 }
 
@@ -554,13 +586,13 @@ void stmpe811_IO_EnableAF(uint16_t DeviceAddr, uint32_t IO_Pin)
   uint8_t tmp = 0;
   
   /* Get the current register value */
-  tmp = IOE_Read(DeviceAddr, STMPE811_REG_IO_AF);
+  tmp = stmpe811_ReadReg(DeviceAddr, STMPE811_REG_IO_AF);
 
   /* Enable the selected pins alternate function */   
   tmp &= ~(uint8_t)IO_Pin;   
   
   /* Write back the new register value */
-  IOE_Write(DeviceAddr, STMPE811_REG_IO_AF, tmp); 
+  stmpe811_WriteReg(DeviceAddr, STMPE811_REG_IO_AF, tmp); 
 }
 
 /**
@@ -579,8 +611,8 @@ void stmpe811_IO_SetEdgeMode(uint16_t DeviceAddr, uint32_t IO_Pin, uint8_t Edge)
   uint8_t tmp1 = 0, tmp2 = 0;   
   
   /* Get the current registers values */
-  tmp1 = IOE_Read(DeviceAddr, STMPE811_REG_IO_FE);
-  tmp2 = IOE_Read(DeviceAddr, STMPE811_REG_IO_RE);
+  tmp1 = stmpe811_ReadReg(DeviceAddr, STMPE811_REG_IO_FE);
+  tmp2 = stmpe811_ReadReg(DeviceAddr, STMPE811_REG_IO_RE);
 
   /* Disable the Falling Edge */
   tmp1 &= ~(uint8_t)IO_Pin;
@@ -601,8 +633,8 @@ void stmpe811_IO_SetEdgeMode(uint16_t DeviceAddr, uint32_t IO_Pin, uint8_t Edge)
   }
 
   /* Write back the new registers values */
-  IOE_Write(DeviceAddr, STMPE811_REG_IO_FE, tmp1);
-  IOE_Write(DeviceAddr, STMPE811_REG_IO_RE, tmp2);
+  stmpe811_WriteReg(DeviceAddr, STMPE811_REG_IO_FE, tmp1);
+  stmpe811_WriteReg(DeviceAddr, STMPE811_REG_IO_RE, tmp2);
 }
 
 /**
@@ -685,13 +717,13 @@ void stmpe811_IO_EnablePinIT(uint16_t DeviceAddr, uint32_t IO_Pin)
   uint8_t tmp = 0;
   
   /* Get the IO interrupt state */
-  tmp = IOE_Read(DeviceAddr, STMPE811_REG_IO_INT_EN);
+  tmp = stmpe811_ReadReg(DeviceAddr, STMPE811_REG_IO_INT_EN);
   
   /* Set the interrupts to be enabled */    
   tmp |= (uint8_t)IO_Pin;
   
   /* Write the register new value */
-  IOE_Write(DeviceAddr, STMPE811_REG_IO_INT_EN, tmp);  
+  stmpe811_WriteReg(DeviceAddr, STMPE811_REG_IO_INT_EN, tmp);  
 }
 
 /**
@@ -707,13 +739,13 @@ void stmpe811_IO_DisablePinIT(uint16_t DeviceAddr, uint32_t IO_Pin)
   uint8_t tmp = 0;
   
   /* Get the IO interrupt state */
-  tmp = IOE_Read(DeviceAddr, STMPE811_REG_IO_INT_EN);
+  tmp = stmpe811_ReadReg(DeviceAddr, STMPE811_REG_IO_INT_EN);
   
   /* Set the interrupts to be Disabled */    
   tmp &= ~(uint8_t)IO_Pin;
   
   /* Write the register new value */
-  IOE_Write(DeviceAddr, STMPE811_REG_IO_INT_EN, tmp);   
+  stmpe811_WriteReg(DeviceAddr, STMPE811_REG_IO_INT_EN, tmp);   
 }
 
 /**
@@ -748,10 +780,10 @@ void stmpe811_IO_ClearIT(uint16_t DeviceAddr, uint32_t IO_Pin)
   IOE_Write(DeviceAddr, STMPE811_REG_IO_ED, (uint8_t)IO_Pin);
   
   /* Clear the Rising edge pending bit */
-  IOE_Write(DeviceAddr, STMPE811_REG_IO_RE, (uint8_t)IO_Pin);
+  stmpe811_WriteReg(DeviceAddr, STMPE811_REG_IO_RE, (uint8_t)IO_Pin);
   
   /* Clear the Falling edge pending bit */
-  IOE_Write(DeviceAddr, STMPE811_REG_IO_FE, (uint8_t)IO_Pin); 
+  stmpe811_WriteReg(DeviceAddr, STMPE811_REG_IO_FE, (uint8_t)IO_Pin); 
 }
 
 /**
@@ -764,13 +796,13 @@ void stmpe811_TS_Start(uint16_t DeviceAddr)
   uint8_t mode;
   
   /* Get the current register value */
-  mode = IOE_Read(DeviceAddr, STMPE811_REG_SYS_CTRL2);
+  mode = stmpe811_ReadReg(DeviceAddr, STMPE811_REG_SYS_CTRL2);
   
   /* Set the Functionalities to be Enabled */    
   mode &= ~(STMPE811_IO_FCT);  
   
   /* Write the new register value */  
-  IOE_Write(DeviceAddr, STMPE811_REG_SYS_CTRL2, mode); 
+  stmpe811_WriteReg(DeviceAddr, STMPE811_REG_SYS_CTRL2, mode); 
 
   /* Select TSC pins in TSC alternate mode */  
   stmpe811_IO_EnableAF(DeviceAddr, STMPE811_TOUCH_IO_ALL);
@@ -779,7 +811,7 @@ void stmpe811_TS_Start(uint16_t DeviceAddr)
   mode &= ~(STMPE811_TS_FCT | STMPE811_ADC_FCT);  
   
   /* Set the new register value */  
-  IOE_Write(DeviceAddr, STMPE811_REG_SYS_CTRL2, mode); 
+  stmpe811_WriteReg(DeviceAddr, STMPE811_REG_SYS_CTRL2, mode); 
   
   /* Select Sample Time, bit number and ADC Reference */
   IOE_Write(DeviceAddr, STMPE811_REG_ADC_CTRL1, 0x49);
@@ -958,6 +990,47 @@ static uint8_t stmpe811_GetInstance(uint16_t DeviceAddr)
   return 0xFF;
 }
 
+/**
+  * @brief  Read a register, from the copy of the configuration registers if 
+  *         its value is known.
+  * @param  DeviceAddr: Device address on communication Bus.
+  * @param  Reg: Register address.
+  * @retval Register value.
+  */
+static uint8_t stmpe811_ReadReg(uint16_t DeviceAddr, uint8_t Reg)
+{
+  uint8_t instance = stmpe811_GetInstance(DeviceAddr);
+  uint8_t value = 0;
+  
+  if(instance == 0xFF)
+  {
+    return IOE_Read(DeviceAddr, Reg);
+  }
+  if(!REGCACHE_Read(&stmpe811Cache[instance], Reg, &value))
+  {
+    value = IOE_Read(DeviceAddr, Reg);
+    REGCACHE_Fill(&stmpe811Cache[instance], Reg, value);
+  }
+  return value;
+}
+
+/**
+  * @brief  Write a register, unless it is known to already hold the value.
+  * @param  DeviceAddr: Device address on communication Bus.
+  * @param  Reg: Register address.
+  * @param  Value: Register value.
+  * @retval None
+  */
+static void stmpe811_WriteReg(uint16_t DeviceAddr, uint8_t Reg, uint8_t Value)
+{
+  uint8_t instance = stmpe811_GetInstance(DeviceAddr);
+  
+  if((instance == 0xFF) || REGCACHE_Write(&stmpe811Cache[instance], Reg, Value))
+  {
+    IOE_Write(DeviceAddr, Reg, Value);
+  }
+}
+
 /**
   * @}
   */ 
@@ -86,6 +86,8 @@ void    BSP_ACCELERO_Reset(void);
 void    BSP_ACCELERO_Click_ITConfig(void);
 void    BSP_ACCELERO_Click_ITClear(void);
 void    BSP_ACCELERO_GetXYZ(int16_t *pDataXYZ);
+uint8_t BSP_ACCELERO_FIFO_Start(uint8_t Watermark);
+uint8_t BSP_ACCELERO_FIFO_Read(int16_t *pDataXYZ, uint8_t MaxSamples);
 
 /**
   * @}
@@ -50,6 +50,7 @@
 
 #include "stm32f4_discovery.h"
 #include "../pdm_filter.h"
+#include "../audiopipe.h"
 
 /** @addtogroup BSP
   * @{
@@ -153,16 +154,35 @@
 #define AUDIO_TIMEOUT                   2
 
 /* AudioFreq * DataSize (2 bytes) * NumChannels (Stereo: 2) */
+/* The record buffers are sized at compile time: define DEFAULT_AUDIO_IN_FREQ
+   in the build settings to record at another rate (e.g. 48000) */
+#ifndef DEFAULT_AUDIO_IN_FREQ
 #define DEFAULT_AUDIO_IN_FREQ                 I2S_AUDIOFREQ_16K
+#endif
 #define DEFAULT_AUDIO_IN_BIT_RESOLUTION       16
 #define DEFAULT_AUDIO_IN_CHANNEL_NBR          1 /* Mono = 1, Stereo = 2 */
+/* Microphone gain. With the source PDM decimator (pdm_filter.h) the volume is a
+   linear gain, Volume / PDM_GAIN_UNITY, i.e. Volume / 8: 8 is 0 dB, 64 is +18 dB,
+   100 is about +22 dB and 0 mutes. It is no longer the percentage of the ST
+   PDM library, so applications written for it may need a different value */
 #define DEFAULT_AUDIO_IN_VOLUME               64
+/* PDM clock is 64 times the audio frequency (see I2S2_Init()) */
+#define DEFAULT_AUDIO_IN_DECIMATION           64
 
 /* PDM buffer input size */
 #define INTERNAL_BUFF_SIZE                    128*DEFAULT_AUDIO_IN_FREQ/16000*DEFAULT_AUDIO_IN_CHANNEL_NBR
 /* PCM buffer output size */
 #define PCM_OUT_SIZE                          DEFAULT_AUDIO_IN_FREQ/1000
 #define CHANNEL_DEMUX_MASK                    0x55
+
+/* Record-to-playback loopback: number of PCM_OUT_SIZE blocks in the pool and
+   target latency (in frames) between the microphone and the codec */
+#ifndef AUDIO_LOOPBACK_BLOCKS
+#define AUDIO_LOOPBACK_BLOCKS                 8
+#endif
+#ifndef AUDIO_LOOPBACK_LATENCY
+#define AUDIO_LOOPBACK_LATENCY                (2*PCM_OUT_SIZE)
+#endif
    
 /*------------------------------------------------------------------------------
                     OPTIONAL Configuration defines parameters
@@ -175,6 +195,7 @@
 /** @defgroup STM32F4_DISCOVERY_AUDIO_Exported_Variables STM32F4 DISCOVERY AUDIO Exported Variables
   * @{
   */ 
+/* Linear microphone gain, in units of 1 / PDM_GAIN_UNITY (see DEFAULT_AUDIO_IN_VOLUME) */
 extern __IO uint16_t AudioInVolume;
 /**
   * @}
@@ -250,6 +271,23 @@ void  BSP_AUDIO_IN_ClockConfig(I2S_HandleTypeDef *hi2s, uint32_t AudioFreq, void
 void  BSP_AUDIO_IN_MspInit(I2S_HandleTypeDef *hi2s, void *Params);
 void  BSP_AUDIO_IN_MspDeInit(I2S_HandleTypeDef *hi2s, void *Params);
 
+/**
+  * @}
+  */  
+
+/** @defgroup STM32F4_DISCOVERY_AUDIO_LOOPBACK_Exported_Functions STM32F4 DISCOVERY AUDIO LOOPBACK Exported Functions
+  * @{
+  */ 
+uint8_t BSP_AUDIO_LOOPBACK_Init(uint16_t OutputDevice, uint8_t Volume, uint32_t AudioFreq);
+uint8_t BSP_AUDIO_LOOPBACK_Start(void);
+uint8_t BSP_AUDIO_LOOPBACK_Stop(uint32_t Option);
+void    BSP_AUDIO_LOOPBACK_GetStats(AUDIOPIPE_Stats_t *pStats);
+
+/* User Callbacks: user has to implement this function in his code if it is needed. */
+/* This function is called on each recorded block (stereo, interleaved) before it is
+   queued for playback: the samples can be processed in place. */
+void    BSP_AUDIO_LOOPBACK_Process_CallBack(int16_t *pBuffer, uint32_t Frames);
+
 /**
   * @}
   */  
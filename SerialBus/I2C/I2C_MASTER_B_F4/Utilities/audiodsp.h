@@ -0,0 +1,374 @@
+/**
+ * @file audiodsp.h
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+#ifndef AUDIODSP_H_
+#define AUDIODSP_H_
+
+/**
+ * @addtogroup BSP
+ * @{
+ * @defgroup AUDIODSP
+ * @{
+ *
+ * @brief Catena di elaborazione audio a blocchi, in virgola fissa.
+ *
+ * @details
+ * Il modulo fornisce alcuni nuclei di elaborazione per campioni PCM a 16 bit (Q15), interlacciati, da applicare a
+ * blocchi sul percorso PCM del BSP: dopo BSP_AUDIO_IN_PDMToPCM(), prima di BSP_AUDIO_OUT_ChangeBuffer() oppure,
+ * nel loopback, dentro BSP_AUDIO_LOOPBACK_Process_CallBack(). I nuclei sono:
+ *  - cascata di biquad (equalizzazione, passa-basso, passa-alto), in forma diretta I con coefficienti Q14 o Q13 e
+ *    accumulatore a 64 bit; i prodotti sono calcolati a coppie con SMLALD sui Cortex-M4 (PMADDWD su x86), e il
+ *    resto della quantizzazione dell'uscita viene riportato al campione successivo (error feedback), per cui anche i
+ *    filtri a bassa frequenza non soffrono dei 16 bit dello stato;
+ *  - compressore/limitatore con rivelatore di picco (attacco e rilascio), curva statica calcolata nel dominio
+ *    logaritmico in base 2 e guadagno di compensazione; i canali sono collegati, per non spostare l'immagine stereo;
+ *  - noise gate con soglia, tempo di hold, attenuazione a gate chiuso e rampa del guadagno;
+ *  - convertitore di frequenza di campionamento a rapporto frazionario qualsiasi, con interpolazione cubica di
+ *    Hermite a quattro punti; il passo puo' essere ritoccato a caldo, per inseguire la deriva di un clock esterno.
+ *    In decimazione non filtra: l'anti-aliasing va fatto prima, con un passa-basso della cascata di biquad.
+ *
+ * I nuclei che non cambiano il numero di frame possono essere messi in serie in una catena, che li esegue sullo
+ * stesso blocco e misura, per ciascuno stadio, i cicli di clock spesi sul blocco, il massimo osservato e quante
+ * volte e' stato superato il budget assegnato allo stadio, espresso in millesimi del tempo di un blocco. I cicli
+ * sono letti con AUDIODSP_CYCLES(), che sui Cortex-M legge il contatore DWT_CYCCNT: il contatore va abilitato
+ * dall'applicazione (DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk). Su un host x86 legge il contatore TSC; sulle altre
+ * architetture, se non definito diversamente, vale sempre 0.<br>
+ * Il modulo non dipende dalla libreria HAL, per cui puo' essere compilato e verificato anche su un host.
+ */
+
+#include <inttypes.h>
+
+/**
+ * @brief Numero massimo di canali di un flusso.
+ */
+#ifndef AUDIODSP_MAX_CHANNELS
+#define AUDIODSP_MAX_CHANNELS	2
+#endif
+
+/**
+ * @brief Numero massimo di sezioni di una cascata di biquad.
+ */
+#ifndef AUDIODSP_MAX_SECTIONS
+#define AUDIODSP_MAX_SECTIONS	4
+#endif
+
+/**
+ * @brief Numero massimo di stadi di una catena.
+ */
+#ifndef AUDIODSP_MAX_STAGES
+#define AUDIODSP_MAX_STAGES		6
+#endif
+
+/**
+ * @brief Lettura del contatore dei cicli di clock.
+ */
+#ifndef AUDIODSP_CYCLES
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__)
+#define AUDIODSP_CYCLES()		(*(volatile uint32_t*)0xE0001004UL)
+#elif defined(__x86_64__) || defined(__i386__)
+#define AUDIODSP_CYCLES()		((uint32_t) __builtin_ia32_rdtsc())
+#else
+#define AUDIODSP_CYCLES()		0
+#endif
+#endif
+
+/**
+ * @brief Funzione di elaborazione di uno stadio della catena, sul posto.
+ * @param[inout] state stato dello stadio
+ * @param[inout] buffer campioni interlacciati
+ * @param[in] frames numero di frame del blocco
+ */
+typedef void (*AUDIODSP_Stage_t)(void* state, int16_t* buffer, uint32_t frames);
+
+/**
+ * @brief Misura del carico di uno stadio.
+ */
+typedef struct {
+	uint32_t cycles;			//!< cicli spesi sull'ultimo blocco
+	uint32_t cyclesMax;			//!< massimo dei cicli spesi su un blocco
+	uint32_t budget;			//!< cicli disponibili per l'ultimo blocco, 0 se illimitati
+	uint32_t overBudget;		//!< blocchi in cui il budget e' stato superato
+} AUDIODSP_Meter_t;
+
+/**
+ * @brief Tipo di filtro biquad, secondo le formule di R. Bristow-Johnson.
+ */
+typedef enum {
+	AUDIODSP_LOWPASS = 0,		//!< passa-basso del secondo ordine
+	AUDIODSP_HIGHPASS = 1,		//!< passa-alto del secondo ordine
+	AUDIODSP_PEAKING = 2,		//!< equalizzatore a campana
+	AUDIODSP_LOWSHELF = 3,		//!< shelving sulle basse frequenze
+	AUDIODSP_HIGHSHELF = 4		//!< shelving sulle alte frequenze
+} AUDIODSP_BiquadType_t;
+
+/**
+ * @brief Coefficienti di una sezione biquad: y = b0 x0 + b1 x1 + b2 x2 - a1 y1 - a2 y2.
+ * @details I coefficienti sono in formato Q(15 - shift): con shift pari a 1 coprono [-2, 2), con shift pari a 2
+ * coprono [-4, 4), utile per le sezioni con un'enfasi sopra i 6 dB.
+ */
+typedef struct {
+	int16_t b0, b1, b2;			//!< coefficienti del numeratore
+	int16_t a1, a2;				//!< coefficienti del denominatore (a0 normalizzato a 1)
+	uint8_t shift;				//!< bit di parte intera dei coefficienti, 1 o 2
+} AUDIODSP_BiquadCoeffs_t;
+
+/**
+ * @brief Stato di una sezione biquad per un canale.
+ */
+typedef struct {
+	uint32_t x;					//!< x1 nella meta' bassa, x2 nella meta' alta
+	uint32_t y;					//!< y1 nella meta' bassa, y2 nella meta' alta
+	int32_t err;				//!< resto della quantizzazione dell'ultima uscita
+} AUDIODSP_BiquadState_t;
+
+/**
+ * @brief Cascata di biquad.
+ */
+typedef struct {
+	uint8_t channels;												//!< campioni per frame
+	uint8_t sections;												//!< sezioni in uso
+	struct {
+		int16_t b0;													//!< coefficiente b0
+		uint32_t b12;												//!< b1 nella meta' bassa, b2 nella meta' alta
+		uint32_t a12;												//!< -a1 nella meta' bassa, -a2 nella meta' alta
+		uint8_t shift;												//!< bit di parte intera dei coefficienti
+	} coeffs[AUDIODSP_MAX_SECTIONS];								//!< coefficienti impaccati per SMLALD
+	AUDIODSP_BiquadState_t state[AUDIODSP_MAX_SECTIONS][AUDIODSP_MAX_CHANNELS];	//!< stato delle sezioni
+} AUDIODSP_Biquad_t;
+
+/**
+ * @brief Compressore/limitatore.
+ */
+typedef struct {
+	uint8_t channels;			//!< campioni per frame
+	int32_t threshold;			//!< soglia, log2 in Q16
+	int32_t slope;				//!< riduzione del guadagno oltre la soglia, 1 - 1/ratio in Q15
+	int32_t makeup;				//!< guadagno di compensazione, log2 in Q16
+	int32_t attack;				//!< coefficiente di attacco del rivelatore, Q15
+	int32_t release;			//!< coefficiente di rilascio del rivelatore, Q15
+	int32_t envelope;			//!< inviluppo di picco, Q30
+	int32_t gain;				//!< guadagno applicato all'ultimo frame, Q12
+} AUDIODSP_Compressor_t;
+
+/**
+ * @brief Noise gate.
+ */
+typedef struct {
+	uint8_t channels;			//!< campioni per frame
+	int32_t threshold;			//!< soglia di apertura, lineare in Q30
+	int32_t floor;				//!< guadagno a gate chiuso, Q30
+	int32_t attack;				//!< coefficiente della rampa di apertura, Q15
+	int32_t release;			//!< coefficiente della rampa di chiusura, Q15
+	int32_t detector;			//!< coefficiente di rilascio del rivelatore, Q15
+	uint32_t hold;				//!< frame di hold dopo l'ultimo superamento della soglia
+	uint32_t holdCount;			//!< frame di hold rimanenti
+	int32_t envelope;			//!< inviluppo di picco, Q30
+	int32_t gain;				//!< guadagno corrente, Q30
+} AUDIODSP_Gate_t;
+
+/**
+ * @brief Convertitore di frequenza di campionamento.
+ */
+typedef struct {
+	uint8_t channels;								//!< campioni per frame
+	uint64_t nominal;								//!< passo nominale, frame di ingresso per frame in uscita in Q32
+	uint64_t step;									//!< passo corrente, Q32
+	uint64_t pos;									//!< posizione in ingresso, Q32, relativa al primo frame della storia
+	int16_t history[3][AUDIODSP_MAX_CHANNELS];		//!< ultimi tre frame del blocco precedente
+	uint32_t dropped;								//!< frame persi per mancanza di spazio in uscita
+	AUDIODSP_Meter_t meter;							//!< carico del convertitore
+} AUDIODSP_SRC_t;
+
+/**
+ * @brief Catena di stadi eseguiti sul posto sullo stesso blocco.
+ */
+typedef struct {
+	struct {
+		AUDIODSP_Stage_t process;		//!< funzione di elaborazione
+		void* state;					//!< stato dello stadio
+		uint16_t share;					//!< budget, in millesimi del tempo di un blocco
+		AUDIODSP_Meter_t meter;			//!< carico dello stadio
+	} stage[AUDIODSP_MAX_STAGES];		//!< stadi, in ordine di esecuzione
+	uint8_t count;						//!< stadi in uso
+	uint32_t cyclesPerFrame;			//!< cicli di clock disponibili per frame
+	AUDIODSP_Meter_t meter;				//!< carico dell'intera catena
+} AUDIODSP_Chain_t;
+
+/**
+ * @brief Calcola i coefficienti di una sezione biquad.
+ * @details Usa la virgola mobile, per cui va chiamata in fase di configurazione e non nel percorso dei campioni.
+ * @param[out] c coefficienti
+ * @param[in] type tipo di filtro
+ * @param[in] fs frequenza di campionamento, in Hz
+ * @param[in] f0 frequenza centrale o di taglio, in Hz
+ * @param[in] q fattore di qualita' (0.7071 per Butterworth)
+ * @param[in] gainDb guadagno in dB, per i tipi AUDIODSP_PEAKING, AUDIODSP_LOWSHELF e AUDIODSP_HIGHSHELF
+ * @retval 0 se i coefficienti sono rappresentabili
+ * @retval -1 se i parametri non sono validi o i coefficienti escono dall'intervallo [-4, 4)
+ */
+int AUDIODSP_BiquadDesign(AUDIODSP_BiquadCoeffs_t* c, AUDIODSP_BiquadType_t type, uint32_t fs, float f0, float q,
+		float gainDb);
+
+/**
+ * @brief Inizializza una cascata di biquad, azzerandone lo stato.
+ * @param[out] bq puntatore alla cascata
+ * @param[in] channels campioni per frame, al piu' AUDIODSP_MAX_CHANNELS
+ * @param[in] coeffs coefficienti delle sezioni, in ordine di esecuzione
+ * @param[in] sections numero di sezioni, al piu' AUDIODSP_MAX_SECTIONS
+ */
+void AUDIODSP_BiquadInit(AUDIODSP_Biquad_t* bq, uint8_t channels, const AUDIODSP_BiquadCoeffs_t* coeffs,
+		uint8_t sections);
+
+/**
+ * @brief Filtra un blocco sul posto con la cascata di biquad.
+ * @param[inout] bq puntatore alla cascata
+ * @param[inout] buffer campioni interlacciati
+ * @param[in] frames numero di frame
+ */
+void AUDIODSP_BiquadProcess(AUDIODSP_Biquad_t* bq, int16_t* buffer, uint32_t frames);
+
+/**
+ * @brief Inizializza un compressore/limitatore.
+ * @param[out] c puntatore al compressore
+ * @param[in] fs frequenza di campionamento, in Hz
+ * @param[in] channels campioni per frame
+ * @param[in] thresholdDb soglia, in dBFS (negativa)
+ * @param[in] ratio rapporto di compressione oltre la soglia (4 significa 4:1), 0 per un limitatore
+ * @param[in] attackMs tempo di attacco, in ms
+ * @param[in] releaseMs tempo di rilascio, in ms
+ * @param[in] makeupDb guadagno di compensazione, in dB, da 0 a 18
+ */
+void AUDIODSP_CompressorInit(AUDIODSP_Compressor_t* c, uint32_t fs, uint8_t channels, int8_t thresholdDb,
+		uint8_t ratio, uint16_t attackMs, uint16_t releaseMs, uint8_t makeupDb);
+
+/**
+ * @brief Comprime un blocco sul posto.
+ * @param[inout] c puntatore al compressore
+ * @param[inout] buffer campioni interlacciati
+ * @param[in] frames numero di frame
+ */
+void AUDIODSP_CompressorProcess(AUDIODSP_Compressor_t* c, int16_t* buffer, uint32_t frames);
+
+/**
+ * @brief Inizializza un noise gate.
+ * @param[out] g puntatore al gate
+ * @param[in] fs frequenza di campionamento, in Hz
+ * @param[in] channels campioni per frame
+ * @param[in] thresholdDb soglia di apertura, in dBFS (negativa)
+ * @param[in] rangeDb attenuazione a gate chiuso, in dB (negativa; -96 silenzia)
+ * @param[in] attackMs durata della rampa di apertura, in ms
+ * @param[in] holdMs tempo per cui il gate resta aperto dopo che il segnale e' sceso sotto la soglia, in ms
+ * @param[in] releaseMs durata della rampa di chiusura, in ms
+ */
+void AUDIODSP_GateInit(AUDIODSP_Gate_t* g, uint32_t fs, uint8_t channels, int8_t thresholdDb, int8_t rangeDb,
+		uint16_t attackMs, uint16_t holdMs, uint16_t releaseMs);
+
+/**
+ * @brief Applica il noise gate a un blocco sul posto.
+ * @param[inout] g puntatore al gate
+ * @param[inout] buffer campioni interlacciati
+ * @param[in] frames numero di frame
+ */
+void AUDIODSP_GateProcess(AUDIODSP_Gate_t* g, int16_t* buffer, uint32_t frames);
+
+/**
+ * @brief Inizializza un convertitore di frequenza di campionamento.
+ * @param[out] src puntatore al convertitore
+ * @param[in] channels campioni per frame
+ * @param[in] fsIn frequenza di campionamento in ingresso, in Hz
+ * @param[in] fsOut frequenza di campionamento in uscita, in Hz
+ */
+void AUDIODSP_SRCInit(AUDIODSP_SRC_t* src, uint8_t channels, uint32_t fsIn, uint32_t fsOut);
+
+/**
+ * @brief Ritocca il rapporto di conversione senza interrompere il flusso.
+ * @param[inout] src puntatore al convertitore
+ * @param[in] ppm scostamento dal rapporto nominale fsIn/fsOut, in parti per milione (positivo: consuma piu' ingresso)
+ */
+void AUDIODSP_SRCTrim(AUDIODSP_SRC_t* src, int32_t ppm);
+
+/**
+ * @brief Converte un blocco.
+ * @details Vengono prodotti tutti i frame calcolabili con l'ingresso ricevuto fino a questo momento, circa
+ * inFrames * fsOut / fsIn; i frame di ingresso necessari all'interpolazione sono conservati per il blocco successivo.
+ * @param[inout] src puntatore al convertitore
+ * @param[in] in campioni interlacciati in ingresso
+ * @param[in] inFrames frame in ingresso
+ * @param[out] out campioni interlacciati in uscita
+ * @param[in] outFrames spazio disponibile in uscita, in frame
+ * @return numero di frame prodotti, al piu' outFrames; se lo spazio in uscita non basta, i frame in eccesso non sono
+ * calcolati e vengono contati in src->dropped, mentre la fase dell'ingresso avanza come se fossero stati prodotti,
+ * per cui il blocco successivo resta allineato nel tempo
+ */
+uint32_t AUDIODSP_SRCProcess(AUDIODSP_SRC_t* src, const int16_t* in, uint32_t inFrames, int16_t* out,
+		uint32_t outFrames);
+
+/**
+ * @brief Stadio di catena per una cascata di biquad (state e' un AUDIODSP_Biquad_t).
+ */
+void AUDIODSP_BiquadStage(void* state, int16_t* buffer, uint32_t frames);
+
+/**
+ * @brief Stadio di catena per un compressore/limitatore (state e' un AUDIODSP_Compressor_t).
+ */
+void AUDIODSP_CompressorStage(void* state, int16_t* buffer, uint32_t frames);
+
+/**
+ * @brief Stadio di catena per un noise gate (state e' un AUDIODSP_Gate_t).
+ */
+void AUDIODSP_GateStage(void* state, int16_t* buffer, uint32_t frames);
+
+/**
+ * @brief Inizializza una catena vuota.
+ * @param[out] chain puntatore alla catena
+ * @param[in] coreClock frequenza di AUDIODSP_CYCLES(), in Hz (SystemCoreClock)
+ * @param[in] fs frequenza di campionamento dei blocchi, in Hz
+ */
+void AUDIODSP_ChainInit(AUDIODSP_Chain_t* chain, uint32_t coreClock, uint32_t fs);
+
+/**
+ * @brief Aggiunge uno stadio in coda alla catena.
+ * @param[inout] chain puntatore alla catena
+ * @param[in] process funzione di elaborazione, per esempio AUDIODSP_BiquadStage()
+ * @param[in] state stato dello stadio
+ * @param[in] share budget dello stadio, in millesimi del tempo di un blocco; 0 per non controllarlo
+ * @return indice dello stadio, oppure -1 se la catena e' piena
+ */
+int AUDIODSP_ChainAdd(AUDIODSP_Chain_t* chain, AUDIODSP_Stage_t process, void* state, uint16_t share);
+
+/**
+ * @brief Esegue tutti gli stadi della catena su un blocco, aggiornando le misure di carico.
+ * @param[inout] chain puntatore alla catena
+ * @param[inout] buffer campioni interlacciati
+ * @param[in] frames numero di frame
+ */
+void AUDIODSP_ChainProcess(AUDIODSP_Chain_t* chain, int16_t* buffer, uint32_t frames);
+
+/**
+ * @brief Restituisce la misura di carico di uno stadio, oppure dell'intera catena.
+ * @param[in] chain puntatore alla catena
+ * @param[in] index indice dello stadio, oppure -1 per l'intera catena
+ */
+const AUDIODSP_Meter_t* AUDIODSP_ChainMeter(const AUDIODSP_Chain_t* chain, int index);
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* AUDIODSP_H_ */
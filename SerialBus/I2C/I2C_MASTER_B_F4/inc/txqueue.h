@@ -0,0 +1,238 @@
+/**
+ * @file txqueue.h
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef TXQUEUE_H_
+#define TXQUEUE_H_
+
+/**
+ * @addtogroup busSeriali
+ * @{
+ * @addtogroup I2C
+ * @{
+ * @defgroup TXQUEUE
+ * @{
+ *
+ * @brief Coda di trasmissione differita per il Master I2C.
+ *
+ * @details
+ * La coda disaccoppia la produzione dei messaggi, che puo' avvenire in una ISR (ad esempio il callback del push button),
+ * dalla loro trasmissione sul bus. La ISR si limita ad accodare il messaggio con TXQUEUE_Push(), senza allocazioni
+ * dinamiche ne' attese; la trasmissione e' pilotata da TXQUEUE_Poll(), chiamata dal main loop, e l'esito viene notificato
+ * dai callback della periferica con TXQUEUE_Complete() e TXQUEUE_Failed().<br>
+ * In caso di NACK dello Slave o di perdita dell'arbitraggio (collisione con un altro Master) il messaggio viene ritrasmesso
+ * al piu' maxRetry volte, attendendo tra un tentativo e l'altro un tempo casuale scelto in una finestra che raddoppia ad ogni
+ * fallimento (backoff esponenziale randomizzato, in modo che due Master che collidono non si risincronizzino);
+ * superato il limite, il messaggio viene scartato.<br>
+ * Se all'avvio di una trasmissione il bus risulta occupato, il tentativo viene rimandato con lo stesso backoff, senza
+ * consumare ritrasmissioni; dopo TXQUEUE_STUCK_LIMIT tentativi consecutivi con bus occupato (o dopo un errore di bus) il bus
+ * viene considerato bloccato e viene invocata la funzione di recupero eventualmente registrata con TXQUEUE_SetRecovery().<br>
+ * Per ogni Master sono mantenute le statistiche TXQUEUE_Stats_t (tentativi, collisioni, bus occupato, NACK e istogramma
+ * della latenza di consegna), che possono essere serializzate con TXQUEUE_PackStats() e inviate allo Slave.<br>
+ * Il modulo non dipende dalla libreria HAL: l'avvio della trasmissione e' delegato ad una funzione fornita all'atto
+ * dell'inizializzazione, il tempo e' passato esplicitamente in millisecondi. Cio' consente di simularne il comportamento
+ * anche su un host Linux.<br>
+ * La coda e' di tipo single-producer / single-consumer: TXQUEUE_Push() deve essere chiamata da un solo contesto (una
+ * sola ISR, oppure solo il main loop), mentre TXQUEUE_Poll() deve essere chiamata esclusivamente dal main loop.
+ */
+
+#include <inttypes.h>
+
+#ifndef TXQUEUE_LENGTH
+#define TXQUEUE_LENGTH		32		//!< Numero di messaggi accodabili (deve essere una potenza di 2)
+#endif
+
+#ifndef TXQUEUE_MSG_SIZE
+#define TXQUEUE_MSG_SIZE	20		//!< Dimensione massima di un messaggio, in byte
+#endif
+
+#ifndef TXQUEUE_STUCK_LIMIT
+#define TXQUEUE_STUCK_LIMIT	16		//!< Tentativi consecutivi con bus occupato oltre i quali il bus e' considerato bloccato
+#endif
+
+#define TXQUEUE_LAT_BINS	8		//!< Classi dell'istogramma di latenza: [0,1), [1,2), [2,4), ... , [64,inf) ms
+#define TXQUEUE_STATS_SIZE	16		//!< Dimensione, in byte, delle statistiche serializzate
+
+#define TXQUEUE_STARTED		0		//!< Trasmissione avviata
+#define TXQUEUE_LOCKED		-1		//!< Periferica locale non disponibile, si riprova al prossimo poll
+#define TXQUEUE_BUS_BUSY	-2		//!< Bus occupato da un altro Master, si riprova dopo il backoff
+
+/**
+ * @brief Funzione che avvia la trasmissione (non bloccante) di un messaggio.
+ * @param[in] ctx contesto fornito a TXQUEUE_Init()
+ * @param[in] data messaggio da trasmettere; il buffer resta valido fino a TXQUEUE_Complete() o TXQUEUE_Failed()
+ * @param[in] len lunghezza del messaggio
+ * @retval TXQUEUE_STARTED se la trasmissione e' stata avviata
+ * @retval TXQUEUE_LOCKED se la periferica non e' disponibile; il tentativo verra' ripetuto alla successiva TXQUEUE_Poll()
+ * @retval TXQUEUE_BUS_BUSY se il bus e' occupato; il tentativo verra' ripetuto dopo il backoff
+ */
+typedef int (*TXQUEUE_Start_t)(void* ctx, uint8_t* data, uint8_t len);
+
+/**
+ * @brief Funzione che tenta di sbloccare il bus (ad esempio generando 9 impulsi di clock su SCL).
+ * @param[in] ctx contesto fornito a TXQUEUE_Init()
+ */
+typedef void (*TXQUEUE_Recovery_t)(void* ctx);
+
+/**
+ * @brief Esito di una trasmissione fallita.
+ */
+typedef enum {
+	TXQUEUE_NACK,		//!< lo Slave non ha riconosciuto indirizzo o dato
+	TXQUEUE_ARLO,		//!< arbitraggio perso a favore di un altro Master
+	TXQUEUE_ERROR		//!< errore di bus o della periferica, non recuperabile con una ritrasmissione
+} TXQUEUE_Failure_t;
+
+/**
+ * @brief Statistiche di un Master.
+ * @details I contatori a 16 bit e le classi dell'istogramma a 8 bit saturano al valore massimo.
+ */
+typedef struct {
+	uint16_t attempts;						//!< trasmissioni avviate
+	uint16_t collisions;					//!< arbitraggi persi
+	uint16_t busy;							//!< tentativi rimandati per bus occupato
+	uint16_t nacks;							//!< NACK ricevuti
+	uint8_t latency[TXQUEUE_LAT_BINS];		//!< istogramma della latenza tra accodamento e consegna
+} TXQUEUE_Stats_t;
+
+/**
+ * @brief Messaggio accodato.
+ */
+typedef struct {
+	uint8_t data[TXQUEUE_MSG_SIZE];	//!< contenuto del messaggio
+	uint8_t len;					//!< lunghezza del messaggio
+	uint32_t time;					//!< istante di accodamento, in millisecondi
+} TXQUEUE_Msg_t;
+
+/**
+ * @brief Stato della trasmissione del messaggio in testa alla coda.
+ */
+typedef enum {
+	TXQUEUE_IDLE,		//!< nessuna trasmissione in corso
+	TXQUEUE_BUSY,		//!< trasmissione in corso, in attesa dell'esito
+	TXQUEUE_BACKOFF		//!< trasmissione fallita, in attesa del prossimo tentativo
+} TXQUEUE_State_t;
+
+/**
+ * @brief Struttura che rappresenta la coda di trasmissione.
+ */
+typedef struct {
+	TXQUEUE_Msg_t msg[TXQUEUE_LENGTH];	//!< buffer circolare dei messaggi
+	volatile uint8_t head;				//!< indice del messaggio in trasmissione (modificato dal consumer)
+	volatile uint8_t tail;				//!< indice del primo slot libero (modificato dal producer)
+	volatile TXQUEUE_State_t state;		//!< stato della trasmissione in testa
+	TXQUEUE_Start_t start;				//!< funzione di avvio della trasmissione
+	TXQUEUE_Recovery_t recovery;		//!< funzione di recupero del bus (opzionale)
+	void* ctx;							//!< contesto passato a start e recovery
+	uint8_t maxRetry;					//!< numero massimo di ritrasmissioni per messaggio
+	uint8_t retry;						//!< ritrasmissioni gia' effettuate per il messaggio in testa
+	uint8_t busyStreak;					//!< tentativi consecutivi con bus occupato
+	volatile uint8_t stuck;				//!< 1 se e' richiesto il recupero del bus
+	uint32_t backoffMs;					//!< finestra di backoff dopo il primo fallimento, in millisecondi
+	uint32_t nextAttempt;				//!< istante del prossimo tentativo, in millisecondi
+	uint32_t seed;						//!< stato del generatore pseudo-casuale del backoff
+	uint32_t delivered;					//!< messaggi consegnati
+	uint32_t dropped;					//!< messaggi scartati per tentativi esauriti o errore
+	uint32_t overflows;					//!< messaggi scartati per coda piena
+	uint32_t errors;					//!< errori non recuperabili
+	uint32_t recoveries;				//!< recuperi del bus effettuati
+	TXQUEUE_Stats_t stats;				//!< statistiche di arbitraggio e latenza
+} TXQUEUE_t;
+
+/**
+ * @brief Inizializza la coda di trasmissione.
+ * @param[out] q puntatore alla coda
+ * @param[in] start funzione di avvio della trasmissione
+ * @param[in] ctx contesto passato a start
+ * @param[in] maxRetry numero massimo di ritrasmissioni di un messaggio
+ * @param[in] backoffMs finestra di backoff dopo il primo fallimento, raddoppiata ad ogni ritrasmissione successiva
+ */
+void TXQUEUE_Init(TXQUEUE_t* q, TXQUEUE_Start_t start, void* ctx, uint8_t maxRetry, uint32_t backoffMs);
+
+/**
+ * @brief Registra la funzione di recupero del bus.
+ * @param[inout] q puntatore alla coda
+ * @param[in] recovery funzione invocata, dal main loop, quando il bus e' considerato bloccato
+ */
+void TXQUEUE_SetRecovery(TXQUEUE_t* q, TXQUEUE_Recovery_t recovery);
+
+/**
+ * @brief Inizializza il generatore pseudo-casuale del backoff.
+ * @details Master diversi devono usare semi diversi (ad esempio il proprio indirizzo), altrimenti, dopo una collisione,
+ * 			sceglierebbero la stessa attesa e colliderebbero di nuovo.
+ * @param[inout] q puntatore alla coda
+ * @param[in] seed seme; il valore zero, che bloccherebbe il generatore, e' sostituito da un seme predefinito
+ */
+void TXQUEUE_Seed(TXQUEUE_t* q, uint32_t seed);
+
+/**
+ * @brief Accoda un messaggio. Puo' essere chiamata da una ISR, se e' l'unico produttore.
+ * @param[inout] q puntatore alla coda
+ * @param[in] data messaggio
+ * @param[in] len lunghezza del messaggio, al piu' TXQUEUE_MSG_SIZE
+ * @param[in] now istante corrente, in millisecondi, usato per la misura della latenza
+ * @retval 0 se il messaggio e' stato accodato
+ * @retval -1 se la coda e' piena o il messaggio e' troppo lungo; il messaggio viene scartato e conteggiato in overflows
+ */
+int TXQUEUE_Push(TXQUEUE_t* q, const uint8_t* data, uint8_t len, uint32_t now);
+
+/**
+ * @brief Avvia la trasmissione del messaggio in testa, se non ce n'e' una in corso e l'eventuale backoff e' scaduto.
+ * @details Se il bus e' stato dichiarato bloccato, invoca prima la funzione di recupero.
+ * @param[inout] q puntatore alla coda
+ * @param[in] now istante corrente, in millisecondi
+ */
+void TXQUEUE_Poll(TXQUEUE_t* q, uint32_t now);
+
+/**
+ * @brief Notifica la corretta trasmissione del messaggio in testa, che viene rimosso dalla coda.
+ * @param[inout] q puntatore alla coda
+ * @param[in] now istante corrente, in millisecondi
+ */
+void TXQUEUE_Complete(TXQUEUE_t* q, uint32_t now);
+
+/**
+ * @brief Notifica il fallimento della trasmissione del messaggio in testa.
+ * @details NACK e perdita di arbitraggio provocano una ritrasmissione dopo il backoff; un errore non recuperabile scarta il
+ * 			messaggio e richiede il recupero del bus.
+ * @param[inout] q puntatore alla coda
+ * @param[in] now istante corrente, in millisecondi
+ * @param[in] cause causa del fallimento
+ */
+void TXQUEUE_Failed(TXQUEUE_t* q, uint32_t now, TXQUEUE_Failure_t cause);
+
+/**
+ * @brief Restituisce il numero di messaggi in coda, compreso quello in trasmissione.
+ * @param[in] q puntatore alla coda
+ */
+uint8_t TXQUEUE_Count(const TXQUEUE_t* q);
+
+/**
+ * @brief Serializza le statistiche, in little endian, nell'ordine dei campi di TXQUEUE_Stats_t.
+ * @param[in] q puntatore alla coda
+ * @param[out] out buffer di almeno TXQUEUE_STATS_SIZE byte
+ */
+void TXQUEUE_PackStats(const TXQUEUE_t* q, uint8_t* out);
+
+/**
+ * @}
+ * @}
+ * @}
+ */
+
+#endif /* TXQUEUE_H_ */
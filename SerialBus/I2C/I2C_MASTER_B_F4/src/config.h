@@ -39,4 +39,11 @@
 
 #define I2C_ADDRESS I2C_ADDRESS_A
 
+#define I2C_MASTER_ID		('B' - 'A')	//!< Indice del Master nel register file dello Slave
+#define I2C_REG_STATS(i)	(0x80 + 16 * (i))	//!< Registro dello Slave con le statistiche del Master i-esimo
+
+#define TXQUEUE_MAX_RETRY	8		//!< Ritrasmissioni di un messaggio in caso di NACK o arbitraggio perso
+#define TXQUEUE_BACKOFF_MS	2		//!< Finestra di backoff dopo il primo fallimento, raddoppiata ad ogni ritrasmissione
+#define I2C_RECOVERY_DELAY	400		//!< Mezzo periodo di SCL durante il recupero del bus (circa 5 us a 168 MHz)
+
 #endif /* CONFIG_H_ */
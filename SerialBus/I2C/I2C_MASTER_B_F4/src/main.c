@@ -20,7 +20,8 @@
 /* Includes ------------------------------------------------------------------*/
 
 #include "config.h"
-#include <stdlib.h>
+#include "txqueue.h"
+#include "sched.h"
 
 /**
  * @addtogroup busSeriali
@@ -52,11 +53,41 @@ void setup();
 /**
  * @brief Funzione che implementa la logica del programma.
  *
- * @details Ogni 2 secondi si incrementa lo il conteggio effettuato dal dispositivo master e viene visualizzato
- * 			il corrispondente valore attraverso i led, realizzando un contatore esadecimale.
+ * @details Il loop esegue lo scheduler (vedi SCHED), che attiva i task COUNT_Task() e TX_Task() e, in assenza di
+ * 			lavoro, mette il processore in sleep o in stop. <br>
+ * 			Lo stop e' consentito solo quando la coda di trasmissione e' vuota e la periferica I2C e' inattiva, poiche'
+ * 			in stop la periferica non e' cloccata.
  *
  */
 void loop();
+/**
+ * @brief Task periodico del conteggio.
+ *
+ * @details Ogni 2 secondi si incrementa lo il conteggio effettuato dal dispositivo master e viene visualizzato
+ * 			il corrispondente valore attraverso i led, realizzando un contatore esadecimale. <br>
+ * 			Ad ogni incremento del conteggio vengono inoltre inviate allo Slave le statistiche di arbitraggio del Master,
+ * 			leggibili da qualsiasi Master a partire dal registro I2C_REG_STATS(I2C_MASTER_ID).
+ */
+static void COUNT_Task(void);
+/**
+ * @brief Task di trasmissione.
+ *
+ * @details Pilota la coda di trasmissione I2C (vedi TXQUEUE). Il task e' attivato da BUTTON_Task() e dai callback
+ * 			della periferica I2C; se il messaggio in testa e' in backoff, il task si riprogramma per l'istante del
+ * 			prossimo tentativo.
+ */
+static void TX_Task(void);
+/**
+ * @brief Task del push button.
+ *
+ * @details Accoda un messaggio per ogni pressione segnalata da HAL_GPIO_EXTI_Callback(). La coda di trasmissione ammette
+ * 			un solo produttore: accodando qui, nel main loop come COUNT_Task(), la ISR non accede mai alla coda.
+ */
+static void BUTTON_Task(void);
+/**
+ * @brief Consente lo stop solo se non ci sono trasferimenti I2C in corso o in attesa.
+ */
+static int I2C_CanStop(void);
 /**
  * @brief System Clock Configuration
 */
@@ -64,8 +95,8 @@ static void SystemClock_Config(void);
 /**
  * @brief Accensione / Spegnimento dei Led secondo uno schema ad anello.
  * @details
- * 			Questa funzione viene richiamata nella callback associata alla pressione del  button
- * 			quando la comunicazione col dispositivo slave attraverso I2C non va a buon fine.
+ * 			Questa funzione viene richiamata quando il bus I2C resta bloccato anche dopo la procedura di recupero,
+ * 			per cui la comunicazione col dispositivo slave non puo' andare a buon fine.
  *			In tal caso, viene effettuato un toggle dei led secondo uno schema circolare (ad anello)
  *          per segnalare la mancata corretta comunicazione tra il master e lo slave.
 */
@@ -73,12 +104,45 @@ void ringOfTheDeath(void);
 /**
  * @brief Callback associata alla pressione del BUTTON.
  *
- * @details Alla pressione del push button viene effettuato  l'invio ad un dispositivo Slave del valore associato al conteggio. <br>
+ * @details La pressione del push button viene conteggiata e attiva BUTTON_Task(), che accoda il valore associato al
+ * 			conteggio per l'invio ad un dispositivo Slave. <br>
+ * 			La ISR non accede alla coda ne' attende il bus: la trasmissione e' effettuata da TX_Task().
  * @param[in] GPIO_Pin : specifica il pin connesso alla linea EXTI.
  */
 
 void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin);
 
+/**
+ * @brief Avvia, ad interruzione, la trasmissione di un messaggio allo Slave.
+ * @details Funzione di avvio utilizzata dalla coda di trasmissione.
+ * @param[in] ctx puntatore all'handle I2C
+ * @param[in] data messaggio da trasmettere
+ * @param[in] len lunghezza del messaggio
+ * @retval 0 se la trasmissione e' stata avviata, -1 se la periferica e' occupata
+ */
+static int I2C_StartTransmit(void* ctx, uint8_t* data, uint8_t len);
+
+/**
+ * @brief Recupero di un bus bloccato.
+ * @details Se uno Slave e' rimasto a meta' di un byte e mantiene SDA bassa, il bus non puo' essere liberato dal Master.
+ * 			La funzione disabilita la periferica, pilota SCL come GPIO generando fino a 9 impulsi di clock finche' lo Slave
+ * 			non rilascia SDA, genera una condizione di STOP e reinizializza la periferica. Se SDA resta bassa, il guasto
+ * 			viene segnalato con ringOfTheDeath().
+ * @param[in] ctx puntatore all'handle I2C
+ */
+static void I2C_BusRecovery(void* ctx);
+
+/**
+ * @brief Callback di trasmissione completata: il messaggio in testa alla coda e' stato consegnato.
+ */
+void HAL_I2C_MasterTxCpltCallback(I2C_HandleTypeDef *hi2c);
+
+/**
+ * @brief Callback di errore: in caso di NACK dello Slave (ad esempio occupato a servire l'altro Master) o di arbitraggio
+ * 			perso il messaggio viene ritrasmesso con backoff casuale, qualsiasi altro errore provoca il recupero del bus.
+ */
+void HAL_I2C_ErrorCallback(I2C_HandleTypeDef *hi2c);
+
 int main(void){
 	setup();
 	for(;;)
@@ -87,6 +151,12 @@ int main(void){
 }
 
 I2C_HandleTypeDef I2cHandle;
+TXQUEUE_t txQueue;			//!< Coda dei messaggi da inviare allo Slave.
+SCHED_t sched;				//!< Scheduler del main loop; SCHED_GetResidency() riporta la residenza in run/sleep/stop.
+uint8_t txTask;				//!< Identificativo di TX_Task().
+uint8_t buttonTask;			//!< Identificativo di BUTTON_Task().
+volatile uint8_t buttonPressed;	//!< Pressioni del push button, incrementato solo dalla ISR.
+uint8_t buttonHandled;		//!< Pressioni gia' accodate, incrementato solo da BUTTON_Task().
 
 
 int counter, countDec;
@@ -109,6 +179,14 @@ void setup(){
 	I2cHandle.Init.NoStretchMode = I2C_NOSTRETCH_DISABLE;
 	I2cHandle.Init.OwnAddress1 = I2C_ADDRESS_B;
 	HAL_I2C_Init(&I2cHandle);
+	TXQUEUE_Init(&txQueue, I2C_StartTransmit, &I2cHandle, TXQUEUE_MAX_RETRY, TXQUEUE_BACKOFF_MS);
+	TXQUEUE_SetRecovery(&txQueue, I2C_BusRecovery);
+	/* il seme combina l'indice del Master con l'identificativo univoco del dispositivo */
+	TXQUEUE_Seed(&txQueue, ((I2C_MASTER_ID + 1) << 24) ^ *(__IO uint32_t*) UID_BASE);
+	SCHED_Init(&sched, SCHED_PortInit(SystemClock_Config), I2C_CanStop);
+	SCHED_AddTimer(&sched, COUNT_Task, 2000);
+	txTask = SCHED_AddTask(&sched, TX_Task);
+	buttonTask = SCHED_AddTask(&sched, BUTTON_Task);
 	/*MCU Support Package*/
 	led=0;
 	counter= 0x0000;
@@ -117,29 +195,116 @@ void setup(){
 }
 
 void loop(){
-	HAL_Delay(2000);
+	SCHED_Run(&sched);
+}
+
+static void COUNT_Task(void){
 	counter+=0x1000;
 	countDec++;
 	HAL_GPIO_WritePin(GPIOD,counter,GPIO_PIN_SET);
 	HAL_GPIO_WritePin(GPIOD,~counter,GPIO_PIN_RESET);
+
+	uint8_t stats[1 + TXQUEUE_STATS_SIZE];
+	stats[0] = I2C_REG_STATS(I2C_MASTER_ID);
+	TXQUEUE_PackStats(&txQueue, &stats[1]);
+	TXQUEUE_Push(&txQueue, stats, sizeof(stats), HAL_GetTick());
+	TX_Task();
+}
+
+static void TX_Task(void){
+	uint32_t now = HAL_GetTick();
+	TXQUEUE_Poll(&txQueue, now);
+	if (txQueue.state == TXQUEUE_BACKOFF){
+		int32_t wait = (int32_t) (txQueue.nextAttempt - now);
+		SCHED_Defer(&sched, txTask, wait > 0 ? wait : 0);
+	}
+	else if (txQueue.state == TXQUEUE_IDLE && TXQUEUE_Count(&txQueue) != 0)
+		/* periferica ancora occupata dal trasferimento precedente */
+		SCHED_Defer(&sched, txTask, 1);
+}
+
+static int I2C_CanStop(void){
+	return TXQUEUE_Count(&txQueue) == 0 && HAL_I2C_GetState(&I2cHandle) == HAL_I2C_STATE_READY;
 }
 
 
 void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin){
-	uint8_t* txBuffer = (uint8_t*) malloc(2);
+	buttonPressed++;
+	SCHED_Post(&sched, buttonTask);
+}
+
+static void BUTTON_Task(void){
+	uint8_t txBuffer[2];
 	txBuffer[0] = 'B';
-	txBuffer[1] = countDec%16; //F3
+	txBuffer[1] = countDec %16; //F3
+	/* ISR e task incrementano ciascuno il proprio contatore: le pressioni ravvicinate sono accodate tutte */
+	for (; buttonHandled != buttonPressed; buttonHandled++)
+		TXQUEUE_Push(&txQueue, txBuffer, 2, HAL_GetTick());
+	TX_Task();
+}
+
+static int I2C_StartTransmit(void* ctx, uint8_t* data, uint8_t len){
+	I2C_HandleTypeDef* hi2c = (I2C_HandleTypeDef*) ctx;
+	/* Il flag BUSY e' verificato prima di chiamare la HAL, che altrimenti lo attenderebbe in polling fino a 25 ms */
+	if (__HAL_I2C_GET_FLAG(hi2c, I2C_FLAG_BUSY) != RESET)
+		return TXQUEUE_BUS_BUSY;
+	if (HAL_OK != HAL_I2C_Master_Transmit_IT(hi2c, I2C_ADDRESS_C, data, len))
+		return TXQUEUE_LOCKED;
+	return TXQUEUE_STARTED;
+}
 
-	//HAL_I2C_Mem_Write
-    while(HAL_OK != HAL_I2C_Master_Transmit_IT(&I2cHandle, I2C_ADDRESS_C,txBuffer, 2)){
-		if (HAL_I2C_GetError(&I2cHandle) != HAL_I2C_ERROR_AF){
-			ringOfTheDeath();
-		}
-    }
-    while (HAL_I2C_STATE_READY != HAL_I2C_GetState(&I2cHandle));
+static void I2C_BusRecovery(void* ctx){
+	I2C_HandleTypeDef* hi2c = (I2C_HandleTypeDef*) ctx;
+	GPIO_InitTypeDef GPIO_InitStruct;
 
+	HAL_I2C_DeInit(hi2c);
+
+	GPIO_InitStruct.Mode = GPIO_MODE_OUTPUT_OD;
+	GPIO_InitStruct.Pull = GPIO_PULLUP;
+	GPIO_InitStruct.Speed = GPIO_SPEED_FAST;
+	GPIO_InitStruct.Pin = I2Cx_SCL_PIN;
+	HAL_GPIO_WritePin(I2Cx_SCL_GPIO_PORT, I2Cx_SCL_PIN, GPIO_PIN_SET);
+	HAL_GPIO_Init(I2Cx_SCL_GPIO_PORT, &GPIO_InitStruct);
+	GPIO_InitStruct.Pin = I2Cx_SDA_PIN;
+	HAL_GPIO_WritePin(I2Cx_SDA_GPIO_PORT, I2Cx_SDA_PIN, GPIO_PIN_SET);
+	HAL_GPIO_Init(I2Cx_SDA_GPIO_PORT, &GPIO_InitStruct);
+
+	for (int i = 0; i < 9 && HAL_GPIO_ReadPin(I2Cx_SDA_GPIO_PORT, I2Cx_SDA_PIN) == GPIO_PIN_RESET; i++){
+		HAL_GPIO_WritePin(I2Cx_SCL_GPIO_PORT, I2Cx_SCL_PIN, GPIO_PIN_RESET);
+		for (volatile int d = 0; d < I2C_RECOVERY_DELAY; d++);
+		HAL_GPIO_WritePin(I2Cx_SCL_GPIO_PORT, I2Cx_SCL_PIN, GPIO_PIN_SET);
+		for (volatile int d = 0; d < I2C_RECOVERY_DELAY; d++);
+	}
+	if (HAL_GPIO_ReadPin(I2Cx_SDA_GPIO_PORT, I2Cx_SDA_PIN) == GPIO_PIN_RESET)
+		ringOfTheDeath();
+
+	/* STOP: transizione di SDA da basso ad alto con SCL alto */
+	HAL_GPIO_WritePin(I2Cx_SCL_GPIO_PORT, I2Cx_SCL_PIN, GPIO_PIN_RESET);
+	for (volatile int d = 0; d < I2C_RECOVERY_DELAY; d++);
+	HAL_GPIO_WritePin(I2Cx_SDA_GPIO_PORT, I2Cx_SDA_PIN, GPIO_PIN_RESET);
+	for (volatile int d = 0; d < I2C_RECOVERY_DELAY; d++);
+	HAL_GPIO_WritePin(I2Cx_SCL_GPIO_PORT, I2Cx_SCL_PIN, GPIO_PIN_SET);
+	for (volatile int d = 0; d < I2C_RECOVERY_DELAY; d++);
+	HAL_GPIO_WritePin(I2Cx_SDA_GPIO_PORT, I2Cx_SDA_PIN, GPIO_PIN_SET);
+
+	/* HAL_I2C_Init richiama HAL_I2C_MspInit, che riconfigura i pin in alternate function */
+	HAL_I2C_Init(hi2c);
+}
+
+void HAL_I2C_MasterTxCpltCallback(I2C_HandleTypeDef *hi2c){
+	TXQUEUE_Complete(&txQueue, HAL_GetTick());
+	SCHED_Post(&sched, txTask);
+}
 
-    free(txBuffer);
+void HAL_I2C_ErrorCallback(I2C_HandleTypeDef *hi2c){
+	uint32_t error = HAL_I2C_GetError(hi2c);
+	if (error & HAL_I2C_ERROR_ARLO)
+		TXQUEUE_Failed(&txQueue, HAL_GetTick(), TXQUEUE_ARLO);
+	else if (error == HAL_I2C_ERROR_AF)
+		TXQUEUE_Failed(&txQueue, HAL_GetTick(), TXQUEUE_NACK);
+	else
+		TXQUEUE_Failed(&txQueue, HAL_GetTick(), TXQUEUE_ERROR);
+	SCHED_Post(&sched, txTask);
 }
 
 void ringOfTheDeath(){
@@ -0,0 +1,167 @@
+/**
+ * @file sched.c
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "sched.h"
+#include <assert.h>
+#include <string.h>
+
+#if SCHED_MAX_TASK > 32
+#error "SCHED_MAX_TASK deve essere al piu' 32"
+#endif
+
+/**
+ * @brief Registra un task e ne restituisce l'identificativo.
+ */
+static uint8_t SCHED_Register(SCHED_t* s, SCHED_Task_t task) {
+	assert(task);
+	assert(s->nTask < SCHED_MAX_TASK);
+	s->task[s->nTask] = task;
+	return s->nTask++;
+}
+
+void SCHED_Init(SCHED_t* s, const SCHED_Port_t* port, int (*canStop)(void)) {
+	assert(s);
+	assert(port && port->now && port->disableIrq && port->enableIrq && port->sleep);
+	memset(s, 0, sizeof(SCHED_t));
+	s->port = port;
+	s->canStop = canStop;
+	s->idleEnd = port->now();
+}
+
+uint8_t SCHED_AddTask(SCHED_t* s, SCHED_Task_t task) {
+	assert(s);
+	return SCHED_Register(s, task);
+}
+
+uint8_t SCHED_AddTimer(SCHED_t* s, SCHED_Task_t task, uint32_t periodMs) {
+	assert(s);
+	assert(periodMs > 0);
+	uint8_t id = SCHED_Register(s, task);
+	s->period[id] = periodMs;
+	s->deadline[id] = s->port->now() + periodMs;
+	s->armed |= 1UL << id;
+	return id;
+}
+
+void SCHED_Post(SCHED_t* s, uint8_t id) {
+	assert(s);
+	assert(id < s->nTask);
+	s->port->disableIrq();
+	s->pending |= 1UL << id;
+	s->port->enableIrq();
+}
+
+void SCHED_Defer(SCHED_t* s, uint8_t id, uint32_t delayMs) {
+	assert(s);
+	assert(id < s->nTask);
+	s->deadline[id] = s->port->now() + delayMs;
+	s->armed |= 1UL << id;
+}
+
+void SCHED_Run(SCHED_t* s) {
+	assert(s);
+	const SCHED_Port_t* port = s->port;
+	uint32_t start = port->now();
+
+	/* eventi segnalati dalle ISR */
+	port->disableIrq();
+	uint32_t ready = s->pending;
+	s->pending = 0;
+	port->enableIrq();
+
+	/* timer scaduti; i timer periodici vengono riarmati senza accumulare ritardo */
+	for (uint8_t i = 0; i < s->nTask; i++) {
+		uint32_t bit = 1UL << i;
+		if ((s->armed & bit) && (int32_t) (start - s->deadline[i]) >= 0) {
+			ready |= bit;
+			if (s->period[i]) {
+				s->deadline[i] += s->period[i];
+				if ((int32_t) (start - s->deadline[i]) >= 0)
+					s->deadline[i] = start + s->period[i];
+			}
+			else
+				s->armed &= ~bit;
+		}
+	}
+
+	if (ready) {
+		for (uint8_t i = 0; i < s->nTask; i++)
+			if (ready & (1UL << i))
+				s->task[i]();
+		return;
+	}
+
+	/* nessun task pronto: riposo fino al prossimo timer o alla prossima interruzione */
+	uint32_t idle = SCHED_FOREVER;
+	for (uint8_t i = 0; i < s->nTask; i++)
+		if (s->armed & (1UL << i)) {
+			int32_t left = (int32_t) (s->deadline[i] - start);
+			if (left <= 0)
+				return;
+			if ((uint32_t) left < idle)
+				idle = left;
+		}
+
+	port->disableIrq();
+	if (s->pending) {
+		port->enableIrq();
+		return;
+	}
+	/* tutto il tempo dalla fine del riposo precedente e' esecuzione, compresi i tick serviti fuori dai task */
+	uint32_t t0 = port->now();
+	s->runMs += t0 - s->idleEnd;
+	if (port->stop && idle >= SCHED_STOP_MIN_MS && (!s->canStop || s->canStop())) {
+		uint32_t elapsed = port->stop(idle);
+		s->stopMs += elapsed;
+		s->idleEnd = t0 + elapsed;
+		port->enableIrq();
+	}
+	else {
+		port->sleep();
+		/* l'interruzione che ha risvegliato il core (tipicamente SysTick, che aggiorna il tempo corrente) viene servita
+		 * solo quando le interruzioni sono riabilitate: il tempo va letto dopo, altrimenti lo sleep risulta nullo */
+		port->enableIrq();
+		s->idleEnd = port->now();
+		s->sleepMs += s->idleEnd - t0;
+	}
+	s->wakeups++;
+}
+
+uint32_t SCHED_StopElapsed(SCHED_StopClock_t* c, uint32_t before, uint32_t after, uint32_t lostUs) {
+	assert(c && c->hz && c->wrap);
+	uint32_t counts = after >= before ? after - before : after + (c->wrap - before);
+	uint64_t total = (uint64_t) counts * 1000000ULL + (uint64_t) lostUs * c->hz + c->residue;
+	uint64_t unit = 1000ULL * c->hz;
+	c->residue = (uint32_t) (total % unit);
+	return (uint32_t) (total / unit);
+}
+
+void SCHED_GetResidency(const SCHED_t* s, uint16_t* run, uint16_t* sleep, uint16_t* stop) {
+	assert(s);
+	assert(run && sleep && stop);
+	uint64_t total = (uint64_t) s->runMs + (uint32_t) (s->port->now() - s->idleEnd) + s->sleepMs + s->stopMs;
+	if (total == 0) {
+		*run = 1000;
+		*sleep = *stop = 0;
+		return;
+	}
+	*sleep = (uint16_t) (s->sleepMs * 1000ULL / total);
+	*stop = (uint16_t) (s->stopMs * 1000ULL / total);
+	*run = 1000 - *sleep - *stop;
+}
@@ -0,0 +1,111 @@
+/**
+ * @file i2c_timing.h
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef I2C_TIMING_H_
+#define I2C_TIMING_H_
+
+/**
+ * @addtogroup busSeriali
+ * @{
+ * @addtogroup I2C
+ * @{
+ * @defgroup I2C_TIMING
+ * @{
+ *
+ * @brief Calcolo del registro TIMINGR della periferica I2C di STM32F3.
+ *
+ * @details
+ * Il registro TIMINGR contiene il prescaler (PRESC), i ritardi di setup e hold del dato (SCLDEL, SDADEL) e la durata dei
+ * livelli alto e basso del clock (SCLH, SCLL), espressi in periodi del clock della periferica (I2CCLK). I valori corretti
+ * dipendono non solo dalla frequenza del bus, ma anche dai tempi di salita e discesa delle linee, che a loro volta
+ * dipendono dalle resistenze di pull-up e dalla capacita' del bus: un valore calcolato con tempi nulli produce, su un bus
+ * reale, una frequenza inferiore a quella attesa e tempi di setup/hold fuori specifica.<br>
+ * La funzione I2C_TIMING_Compute() determina, a runtime, la combinazione di parametri che rispetta i vincoli della
+ * specifica I2C per la modalita' richiesta (Standard 100 kHz, Fast 400 kHz, Fast-mode Plus 1 MHz) e minimizza lo
+ * scostamento dalla frequenza desiderata, riportando la frequenza effettivamente ottenuta e l'errore relativo. Il
+ * calcolo assume il filtro analogico abilitato (impostazione di default della HAL) e il filtro digitale disabilitato.<br>
+ * Per l'uso a tempo di compilazione sono disponibili le macro I2C_TIMING_xMHZ_yK, precalcolate con la stessa funzione
+ * per i clock piu' comuni, con tempo di salita di 100 ns e tempo di discesa di 10 ns.
+ */
+
+#include <inttypes.h>
+
+/**
+ * @brief Valori di TIMINGR precalcolati con I2C_TIMING_Compute(), rise time 100 ns e fall time 10 ns.
+ * @details A 16 MHz il limite sul data valid time della Fast-mode Plus e' negativo con il ritardo massimo del filtro
+ * 			analogico: il calcolo usa SDADEL = 0, come gli esempi del reference manual.
+ * @{
+ */
+#define I2C_TIMING_8MHZ_100K	0x00202623		//!< 99157 Hz, errore -0.84%
+#define I2C_TIMING_16MHZ_100K	0x00504F48		//!< 99776 Hz, errore -0.22%
+#define I2C_TIMING_8MHZ_400K	0x00100607		//!< 386847 Hz, errore -3.29%
+#define I2C_TIMING_16MHZ_400K	0x00300E11		//!< 396432 Hz, errore -0.89%
+#define I2C_TIMING_16MHZ_1M		0x00200205		//!< 977995 Hz, errore -2.20%
+#define I2C_TIMING_48MHZ_100K	0x1080796E		//!< 99983 Hz, errore -0.02%
+#define I2C_TIMING_48MHZ_400K	0x00902E3A		//!< 399734 Hz, errore -0.07%
+#define I2C_TIMING_48MHZ_1M		0x00700D13		//!< 998336 Hz, errore -0.17%
+#define I2C_TIMING_72MHZ_100K	0x10C0B7A6		//!< 99845 Hz, errore -0.15%
+#define I2C_TIMING_72MHZ_400K	0x00E04758		//!< 399734 Hz, errore -0.07%
+#define I2C_TIMING_72MHZ_1M		0x00A0151E		//!< 998336 Hz, errore -0.17%
+/**
+ * @}
+ */
+
+/**
+ * @brief Modalita' di funzionamento del bus I2C.
+ */
+typedef enum {
+	I2C_TIMING_STANDARD,	//!< Standard mode, 100 kHz
+	I2C_TIMING_FAST,		//!< Fast mode, 400 kHz
+	I2C_TIMING_FAST_PLUS	//!< Fast-mode Plus, 1 MHz
+} I2C_TIMING_Mode_t;
+
+/**
+ * @brief Risultato del calcolo.
+ */
+typedef struct {
+	uint8_t presc;			//!< prescaler, 0-15
+	uint8_t scldel;			//!< ritardo di setup del dato, 0-15
+	uint8_t sdadel;			//!< ritardo di hold del dato, 0-15
+	uint8_t sclh;			//!< durata del livello alto di SCL, 0-255
+	uint8_t scll;			//!< durata del livello basso di SCL, 0-255
+	uint32_t timingr;		//!< valore da scrivere nel registro TIMINGR (campo Init.Timing della HAL)
+	uint32_t freqHz;		//!< frequenza del bus effettivamente ottenuta, in Hz
+	int32_t errorPpm;		//!< errore relativo rispetto alla frequenza nominale, in parti per milione
+} I2C_TIMING_t;
+
+/**
+ * @brief Calcola i parametri del registro TIMINGR.
+ * @param[in] i2cclkHz frequenza del clock della periferica I2C, in Hz
+ * @param[in] mode modalita' del bus
+ * @param[in] riseNs tempo di salita delle linee misurato, in ns
+ * @param[in] fallNs tempo di discesa delle linee misurato, in ns
+ * @param[out] timing risultato del calcolo
+ * @retval 0 se esiste una combinazione di parametri che rispetta la specifica
+ * @retval -1 se I2CCLK e' troppo bassa per la modalita' richiesta o i tempi di salita/discesa sono fuori specifica
+ */
+int I2C_TIMING_Compute(uint32_t i2cclkHz, I2C_TIMING_Mode_t mode, uint32_t riseNs, uint32_t fallNs, I2C_TIMING_t* timing);
+
+/**
+ * @}
+ * @}
+ * @}
+ */
+
+#endif /* I2C_TIMING_H_ */
@@ -0,0 +1,199 @@
+/**
+ * @file regfile.h
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef REGFILE_H_
+#define REGFILE_H_
+
+/**
+ * @addtogroup busSeriali
+ * @{
+ * @addtogroup I2C
+ * @{
+ * @addtogroup I2C_Slave_C
+ * @{
+ * @defgroup REGFILE
+ * @{
+ *
+ * @brief Register file esposto dal dispositivo Slave sul bus I2C.
+ *
+ * @details
+ * Il modulo implementa la logica di dispatch di un register file a 8 bit, indipendente dalla periferica e dalla libreria HAL,
+ * in modo da poter essere compilato e verificato anche su un host Linux, pilotandolo con eventi I2C simulati.<br>
+ * Una transazione I2C e' vista come una sequenza di eventi:
+ *  - address match, REGFILE_AddrMatch(), con la direzione del trasferimento;
+ *  - ricezione di un byte, REGFILE_RxByte(): il primo byte di una scrittura e' il puntatore al registro, i successivi
+ *    sono scritti a partire da tale registro con auto-incremento;
+ *  - richiesta di un byte da trasmettere, REGFILE_TxByte(): restituisce il registro puntato e incrementa il puntatore;
+ *  - stop, REGFILE_Stop(), che chiude la transazione e aggiorna la somma.
+ *
+ * Gli addendi dei Master occupano i registri a partire da REGFILE_ADDEND_BASE = 'A', per cui il frame a due byte
+ * {'A', valore} inviato dai Master esistenti corrisponde esattamente alla scrittura del registro dell'addendo.
+ * Mappa dei registri:
+ * | Indirizzo             | Registro                             | Accesso |
+ * |-----------------------|--------------------------------------|---------|
+ * | 0x00 - 0x01           | somma (little endian)                | R       |
+ * | 0x02                  | numero di addendi gestiti            | R       |
+ * | 0x04 - 0x07           | transazioni di scrittura completate  | R       |
+ * | 0x08 - 0x0B           | transazioni di lettura completate    | R       |
+ * | 0x0C - 0x0F           | errori rilevati sul bus              | R       |
+ * | 0x41 - 0x41+N-1       | addendi dei Master 'A', 'B', ...     | R/W     |
+ * | 0x80+16i - 0x8F+16i   | statistiche del Master i-esimo       | R/W     |
+ *
+ * Il blocco di statistiche di ciascun Master e' scritto dal Master stesso e riporta, in little endian, i tentativi di
+ * trasmissione, gli arbitraggi persi, i tentativi rimandati per bus occupato e i NACK (16 bit ciascuno), seguiti
+ * dall'istogramma a 8 classi della latenza di consegna. Lo Slave non interpreta il contenuto del blocco, che puo' essere
+ * letto da qualsiasi Master con una lettura burst.
+ */
+
+#include <inttypes.h>
+
+/**
+ * @brief Numero di addendi (quindi di Master) gestiti dal register file.
+ */
+#ifndef REGFILE_N_ADDEND
+#define REGFILE_N_ADDEND	8
+#endif
+
+#define REGFILE_SUM_L		0x00		//!< Byte meno significativo della somma
+#define REGFILE_SUM_H		0x01		//!< Byte piu' significativo della somma
+#define REGFILE_N_ADD		0x02		//!< Numero di addendi gestiti
+#define REGFILE_RX_COUNT	0x04		//!< Contatore (32 bit) delle transazioni di scrittura
+#define REGFILE_TX_COUNT	0x08		//!< Contatore (32 bit) delle transazioni di lettura
+#define REGFILE_ERR_COUNT	0x0C		//!< Contatore (32 bit) degli errori sul bus
+#define REGFILE_ADDEND_BASE	0x41		//!< Registro dell'addendo del Master 'A'
+#define REGFILE_STATS_BASE	0x80		//!< Primo registro delle statistiche del Master 'A'
+#define REGFILE_STATS_SIZE	16			//!< Dimensione del blocco di statistiche di un Master
+
+#if REGFILE_N_ADDEND > 8
+#error "La mappa dei registri prevede al piu' 8 Master"
+#endif
+
+/**
+ * @brief Indirizzo del registro dell'addendo i-esimo.
+ */
+#define REGFILE_ADDEND(i)	(REGFILE_ADDEND_BASE + (i))
+
+/**
+ * @brief Indirizzo del primo registro delle statistiche del Master i-esimo.
+ */
+#define REGFILE_STATS(i)	(REGFILE_STATS_BASE + REGFILE_STATS_SIZE * (i))
+
+/**
+ * @brief Direzione di una transazione, dal punto di vista del Master.
+ */
+typedef enum {
+	REGFILE_WRITE = 0,	//!< il Master scrive sullo Slave
+	REGFILE_READ = 1	//!< il Master legge dallo Slave
+} REGFILE_Direction_t;
+
+/**
+ * @brief Struttura che rappresenta il register file.
+ * @details I campi sono modificati dai callback I2C, in contesto di interruzione, e letti dal main loop.
+ */
+typedef struct {
+	uint8_t addend[REGFILE_N_ADDEND];	//!< addendi ricevuti dai Master
+	uint8_t stats[REGFILE_N_ADDEND][REGFILE_STATS_SIZE];	//!< statistiche pubblicate dai Master
+	uint16_t sum;						//!< somma degli addendi
+	uint32_t rxCount;					//!< transazioni di scrittura completate
+	uint32_t txCount;					//!< transazioni di lettura completate
+	uint32_t errCount;					//!< errori rilevati sul bus
+	uint8_t pointer;					//!< puntatore al registro corrente
+	uint8_t pointerValid;				//!< 1 se il puntatore e' stato ricevuto nella transazione corrente
+	uint8_t active;						//!< 1 se una transazione e' in corso
+	uint8_t dirty;						//!< 1 se nella transazione corrente e' stato scritto almeno un addendo
+	REGFILE_Direction_t direction;		//!< direzione della transazione corrente
+	volatile uint8_t updated;			//!< 1 se la somma e' cambiata e non e' ancora stata consumata
+} REGFILE_t;
+
+/**
+ * @brief Inizializza il register file, azzerando addendi, somma e statistiche.
+ * @param[inout] rf puntatore al register file
+ */
+void REGFILE_Init(REGFILE_t* rf);
+
+/**
+ * @brief Legge un registro.
+ * @param[in] rf puntatore al register file
+ * @param[in] addr indirizzo del registro
+ * @return valore del registro; i registri non mappati restituiscono 0xFF.
+ */
+uint8_t REGFILE_Read(const REGFILE_t* rf, uint8_t addr);
+
+/**
+ * @brief Scrive un registro.
+ * @param[inout] rf puntatore al register file
+ * @param[in] addr indirizzo del registro
+ * @param[in] value valore da scrivere
+ * @retval 0 se la scrittura e' andata a buon fine
+ * @retval -1 se il registro e' di sola lettura o non mappato; la scrittura viene ignorata
+ */
+int REGFILE_Write(REGFILE_t* rf, uint8_t addr, uint8_t value);
+
+/**
+ * @brief Evento di address match: inizio di una nuova transazione.
+ * @param[inout] rf puntatore al register file
+ * @param[in] direction direzione del trasferimento
+ */
+void REGFILE_AddrMatch(REGFILE_t* rf, REGFILE_Direction_t direction);
+
+/**
+ * @brief Evento di ricezione di un byte.
+ * @details Il primo byte di una scrittura imposta il puntatore, i successivi sono scritti con auto-incremento.
+ * @param[inout] rf puntatore al register file
+ * @param[in] byte byte ricevuto
+ */
+void REGFILE_RxByte(REGFILE_t* rf, uint8_t byte);
+
+/**
+ * @brief Evento di richiesta di un byte da trasmettere.
+ * @param[inout] rf puntatore al register file
+ * @return valore del registro puntato; il puntatore viene incrementato.
+ */
+uint8_t REGFILE_TxByte(REGFILE_t* rf);
+
+/**
+ * @brief Evento di stop: chiude la transazione corrente.
+ * @details Se e' stato scritto almeno un addendo, ricalcola la somma e segnala l'aggiornamento.
+ * @param[inout] rf puntatore al register file
+ */
+void REGFILE_Stop(REGFILE_t* rf);
+
+/**
+ * @brief Evento di errore sul bus: la transazione corrente viene abortita.
+ * @details Gli addendi eventualmente gia' scritti restano validi e la somma viene ricalcolata.
+ * @param[inout] rf puntatore al register file
+ */
+void REGFILE_Error(REGFILE_t* rf);
+
+/**
+ * @brief Verifica se la somma e' stata aggiornata, consumando la notifica.
+ * @param[inout] rf puntatore al register file
+ * @retval 1 se la somma e' cambiata dall'ultima chiamata
+ * @retval 0 altrimenti
+ */
+uint8_t REGFILE_TakeUpdate(REGFILE_t* rf);
+
+/**
+ * @}
+ * @}
+ * @}
+ * @}
+ */
+
+#endif /* REGFILE_H_ */
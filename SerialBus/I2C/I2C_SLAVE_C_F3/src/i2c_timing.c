@@ -0,0 +1,138 @@
+/**
+ * @file i2c_timing.c
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "i2c_timing.h"
+#include <assert.h>
+#include <stddef.h>
+
+#define FS_PER_S			1000000000000000ULL
+#define FS_PER_NS			1000000LL
+
+#define AF_DELAY_MIN_NS		50		//!< Ritardo minimo introdotto dal filtro analogico
+#define AF_DELAY_MAX_NS		260		//!< Ritardo massimo introdotto dal filtro analogico
+
+/**
+ * @brief Vincoli della specifica I2C (UM10204) per una modalita', in ns salvo dove indicato.
+ */
+typedef struct {
+	uint32_t rateHz;		//!< frequenza nominale, in Hz
+	uint32_t rateMinHz;		//!< frequenza minima accettata, in Hz
+	uint32_t riseMax;		//!< tempo di salita massimo
+	uint32_t fallMax;		//!< tempo di discesa massimo
+	uint32_t hddatMin;		//!< data hold time minimo
+	uint32_t vddatMax;		//!< data valid time massimo
+	uint32_t sudatMin;		//!< data setup time minimo
+	uint32_t lowMin;		//!< durata minima del livello basso di SCL
+	uint32_t highMin;		//!< durata minima del livello alto di SCL
+} I2C_TIMING_Spec_t;
+
+static const I2C_TIMING_Spec_t spec[] = {
+	[I2C_TIMING_STANDARD]	= {  100000,  80000, 1000, 300, 0, 3450, 250, 4700, 4000 },
+	[I2C_TIMING_FAST]		= {  400000, 320000,  300, 300, 0,  900, 100, 1300,  600 },
+	[I2C_TIMING_FAST_PLUS]	= { 1000000, 800000,  120, 120, 0,  450,  50,  500,  260 },
+};
+
+int I2C_TIMING_Compute(uint32_t i2cclkHz, I2C_TIMING_Mode_t mode, uint32_t riseNs, uint32_t fallNs, I2C_TIMING_t* timing) {
+	assert(timing);
+	assert(mode <= I2C_TIMING_FAST_PLUS);
+	const I2C_TIMING_Spec_t* s = &spec[mode];
+	if (i2cclkHz == 0 || riseNs > s->riseMax || fallNs > s->fallMax)
+		return -1;
+
+	/* tutti i tempi sono in femtosecondi: con I2CCLK fino a 72 MHz il periodo troncato differisce da quello reale per meno
+	 * di una parte su 10^7, anche sommato sulle centinaia di periodi che compongono un ciclo di SCL */
+	const int64_t tclk = (int64_t) (FS_PER_S / i2cclkHz);
+	const int64_t tbus = (int64_t) (FS_PER_S / s->rateHz);
+	const int64_t tbusMax = (int64_t) (FS_PER_S / s->rateMinHz);
+	const int64_t rise = FS_PER_NS * riseNs;
+	const int64_t fall = FS_PER_NS * fallNs;
+
+	/* vincoli su SDADEL * tPRESC e (SCLDEL + 1) * tPRESC (RM0316, "I2C timings"); il periodo di I2CCLK che si aggiunge a
+	 * tSDADEL e' gia' compreso nei termini 3 * tclk e 4 * tclk. Se il limite superiore e' negativo (Fast-mode Plus con
+	 * I2CCLK bassa e filtro analogico al ritardo massimo) si usa SDADEL = 0, il ritardo minimo realizzabile, come fa il
+	 * calcolatore di ST da cui derivano gli esempi del reference manual */
+	int64_t sdadelMin = fall + FS_PER_NS * s->hddatMin - FS_PER_NS * AF_DELAY_MIN_NS - 3 * tclk;
+	int64_t sdadelMax = FS_PER_NS * s->vddatMax - rise - FS_PER_NS * AF_DELAY_MAX_NS - 4 * tclk;
+	int64_t scldelMin = rise + FS_PER_NS * s->sudatMin;
+	if (sdadelMin < 0)
+		sdadelMin = 0;
+	if (sdadelMax < 0)
+		sdadelMax = 0;
+
+	/* sincronizzazione di SCL: filtro analogico + 2 periodi di I2CCLK */
+	const int64_t tsync = FS_PER_NS * AF_DELAY_MIN_NS + 2 * tclk;
+
+	int found = 0;
+	int64_t bestError = tbus;
+	for (uint32_t presc = 0; presc < 16; presc++) {
+		const int64_t tpresc = (presc + 1) * tclk;
+
+		/* il piu' piccolo SCLDEL e il piu' piccolo SDADEL compatibili con il prescaler */
+		int32_t scldel = -1, sdadel = -1;
+		for (uint32_t l = 0; l < 16 && scldel < 0; l++)
+			if ((int64_t) (l + 1) * tpresc >= scldelMin)
+				scldel = l;
+		for (uint32_t a = 0; a < 16 && sdadel < 0; a++) {
+			int64_t tsdadel = (int64_t) a * tpresc;
+			if (tsdadel >= sdadelMin && tsdadel <= sdadelMax)
+				sdadel = a;
+		}
+		if (scldel < 0 || sdadel < 0)
+			continue;
+
+		for (uint32_t l = 0; l < 256; l++) {
+			const int64_t tlow = (l + 1) * tpresc + tsync;
+			if (tlow < FS_PER_NS * s->lowMin)
+				continue;
+			/* il livello basso deve durare piu' di 4 periodi di I2CCLK (RM0316) */
+			if (tlow - FS_PER_NS * AF_DELAY_MIN_NS <= 4 * tclk)
+				continue;
+			for (uint32_t h = 0; h < 256; h++) {
+				const int64_t thigh = (h + 1) * tpresc + tsync;
+				if (thigh < FS_PER_NS * s->highMin || thigh <= tclk)
+					continue;
+				const int64_t tscl = tlow + thigh + rise + fall;
+				if (tscl > tbusMax)
+					break;
+				if (tscl < tbus)
+					continue;
+				const int64_t error = tscl - tbus;
+				if (!found || error < bestError) {
+					found = 1;
+					bestError = error;
+					timing->presc = presc;
+					timing->scldel = scldel;
+					timing->sdadel = sdadel;
+					timing->sclh = h;
+					timing->scll = l;
+					timing->freqHz = (uint32_t) ((FS_PER_S + tscl / 2) / tscl);
+				}
+				/* aumentando h il periodo cresce: il primo valore accettabile e' il migliore per questo l */
+				break;
+			}
+		}
+	}
+	if (!found)
+		return -1;
+
+	timing->timingr = ((uint32_t) timing->presc << 28) | ((uint32_t) timing->scldel << 20) |
+			((uint32_t) timing->sdadel << 16) | ((uint32_t) timing->sclh << 8) | timing->scll;
+	timing->errorPpm = (int32_t) (((int64_t) timing->freqHz - s->rateHz) * 1000000LL / s->rateHz);
+	return 0;
+}
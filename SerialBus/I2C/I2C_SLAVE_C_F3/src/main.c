@@ -30,12 +30,16 @@
  * @details
  * 			Il dispositivo somma i valori ricevuti dai 2 Master e ne visualizza il risultato,in codifca binaria, sugli 8 led a bordo.
  * 			La comunicazione con i dispositivi Master avviene attraverso una comunicazione seriale I2C.
+ * 			La periferica I2C opera in listen mode ad interruzione: ogni evento (address match, byte ricevuto/trasmesso, stop)
+ * 			viene inoltrato al register file (vedi REGFILE), mentre il processore resta in sleep tra una transazione e l'altra.
  */
 
 
 #include "stm32f3xx.h"
 #include "stm32f3_discovery.h"
 #include "stdlib.h"
+#include "regfile.h"
+#include "i2c_timing.h"
 
 /**
  * @brief Funzione di inizializzazione.
@@ -51,9 +55,9 @@ void setup();
 /**
  * @brief Funzione che implementa la logica del programma.
  *
- * @details Il dispositivo Slave resta in attesa di ricevere un valore da uno dei due Master (receive bloccante). Una volta ricevuto, effettua la somma con
- * 			l'altro addendo (o valore 0 di default se l'altro addendo non è mai stato ricevuto). <br>
- * 			Il risultato della somma è codificato in binario e mostrato sugli 8 led a bordo.
+ * @details La ricezione degli addendi avviene interamente nei callback I2C, che aggiornano il register file. Quando la somma
+ * 			cambia, il loop la codifica in binario e la mostra sugli 8 led a bordo; altrimenti il processore entra in sleep (WFI)
+ * 			fino alla successiva interruzione.
  *
  */
 void loop();
@@ -71,6 +75,7 @@ void loop();
   *            HSE PREDIV                     = 1
   *            PLLMUL                         = RCC_PLL_MUL9 (9)
   *            Flash Latency(WS)              = 2
+  *            I2C1 clock source              = SYSCLK
   * @param  None
   * @retval None
   */
@@ -88,6 +93,8 @@ static void Error_Handler(void);
  * @brief Funzione di Init della struttura I2C_HandleTypeDef.
  * 	Definisce i parametri della comunicazione I2C per la specifica periferica.
  * 	Nello specifico, l'istanza è I2C1, modalita' Fast Mode con I2C Speed Frequency a 400KHz, indirizzo di periferica a 7 bit.
+ * 	Il valore del registro TIMINGR e' calcolato a partire dal clock della periferica e dai tempi di salita e discesa misurati
+ * 	sul bus (vedi I2C_TIMING).
  * @param none
  * @retval none
  */
@@ -107,12 +114,16 @@ static void I2Cx_MspInit(I2C_HandleTypeDef *hi2c);
 
 
 #define I2C_ADDRESS_C 0x0C <<1		//!< Indirizzo del dispositivo Slave C
+#define I2C_BUS_MODE I2C_TIMING_FAST	//!< Modalita' del bus I2C
+#define I2C_RISE_TIME_NS 100		//!< Tempo di salita di SDA/SCL misurato sul bus, in ns
+#define I2C_FALL_TIME_NS 10			//!< Tempo di discesa di SDA/SCL misurato sul bus, in ns
+#define SUM_MAX 31					//!< Somma massima visualizzabile con SUM_BIN
+#define SUM_OVERFLOW_PIN GPIO_PIN_13	//!< LED10, acceso quando la somma supera SUM_MAX
 
 I2C_HandleTypeDef I2cHandle; 		//!< Handle della struttura I2C che sarà utilizzata.
-uint8_t rxBuffer[2];				//!< Buffer di ricezione utilizzato per la comunicazione I2C.
-int add1;							//!< Variabile addendo 1.
-int add2;							//!< Variabile addendo 2.
-int sum;							//!< Variabile somma.
+REGFILE_t regfile;					//!< Register file esposto ai Master.
+uint8_t rxByte;						//!< Byte in ricezione sul bus I2C.
+uint8_t txByte;						//!< Byte in trasmissione sul bus I2C.
 
 
 /**
@@ -137,6 +148,7 @@ int main(void)
  *	- bit3 => LED7;
  *	- bit4 => LED9;
  *	- bit5 => LED10;
+ *	Le somme maggiori di 31 sono visualizzate come 31, con LED10 acceso a segnalare la saturazione.
  * @code
  * HAL_GPIO_WritePin(GPIOE,SUM_BIN[7],GPIO_PIN_SET); //Accende LED5, LED3, LED4 (MSB->LSB)
  * @endcode
@@ -182,33 +194,86 @@ void setup(){
 	SystemClock_Config();
 	for(int i=0; i< LEDn; i++)
 		BSP_LED_Init(i);
+	REGFILE_Init(&regfile);
 	I2Cx_Init();
-	add1=0;
-	add2=0;
-	sum=0;
+	if (HAL_I2C_EnableListen_IT(&I2cHandle) != HAL_OK)
+		Error_Handler();
 }
 
 void loop(){
-	if(HAL_OK == HAL_I2C_Slave_Receive(&I2cHandle,rxBuffer,2,500)){
-		switch (rxBuffer[0]){
-		case 'A':
-			add1=rxBuffer[1];
-			break;
-		case 'B':
-			add2=rxBuffer[1];
-			break;
-		}
-		sum = add1+add2;
-		HAL_GPIO_WritePin(GPIOE,SUM_BIN[sum],GPIO_PIN_SET);
-		HAL_GPIO_WritePin(GPIOE,~SUM_BIN[sum],GPIO_PIN_RESET);
+	/* La verifica e l'ingresso in sleep avvengono con le interruzioni disabilitate: un'interruzione che arriva nel mezzo resta
+	 * pendente e risveglia comunque il processore dal WFI. */
+	__disable_irq();
+	if (!regfile.updated)
+		__WFI();
+	__enable_irq();
+
+	if (REGFILE_TakeUpdate(&regfile)){
+		uint16_t pins = (regfile.sum > SUM_MAX) ? (SUM_BIN[SUM_MAX] | SUM_OVERFLOW_PIN) : SUM_BIN[regfile.sum];
+		HAL_GPIO_WritePin(GPIOE,pins,GPIO_PIN_SET);
+		HAL_GPIO_WritePin(GPIOE,~pins,GPIO_PIN_RESET);
 	}
 }
 
+/**
+ * @brief Callback di address match.
+ * @details Apre una transazione sul register file e predispone la ricezione o la trasmissione del primo byte.
+ */
+void HAL_I2C_AddrCallback(I2C_HandleTypeDef *hi2c, uint8_t TransferDirection, uint16_t AddrMatchCode){
+	if (TransferDirection == I2C_DIRECTION_TRANSMIT){
+		REGFILE_AddrMatch(&regfile, REGFILE_WRITE);
+		HAL_I2C_Slave_Sequential_Receive_IT(hi2c, &rxByte, 1, I2C_NEXT_FRAME);
+	}
+	else {
+		REGFILE_AddrMatch(&regfile, REGFILE_READ);
+		txByte = REGFILE_TxByte(&regfile);
+		HAL_I2C_Slave_Sequential_Transmit_IT(hi2c, &txByte, 1, I2C_NEXT_FRAME);
+	}
+}
+
+/**
+ * @brief Callback di ricezione completata: inoltra il byte al register file e si predispone a riceverne un altro.
+ */
+void HAL_I2C_SlaveRxCpltCallback(I2C_HandleTypeDef *hi2c){
+	REGFILE_RxByte(&regfile, rxByte);
+	HAL_I2C_Slave_Sequential_Receive_IT(hi2c, &rxByte, 1, I2C_NEXT_FRAME);
+}
+
+/**
+ * @brief Callback di trasmissione completata: preleva il registro successivo (burst read con auto-incremento).
+ */
+void HAL_I2C_SlaveTxCpltCallback(I2C_HandleTypeDef *hi2c){
+	txByte = REGFILE_TxByte(&regfile);
+	HAL_I2C_Slave_Sequential_Transmit_IT(hi2c, &txByte, 1, I2C_NEXT_FRAME);
+}
+
+/**
+ * @brief Callback di fine listen (stop sul bus): chiude la transazione e torna in ascolto.
+ */
+void HAL_I2C_ListenCpltCallback(I2C_HandleTypeDef *hi2c){
+	REGFILE_Stop(&regfile);
+	HAL_I2C_EnableListen_IT(hi2c);
+}
+
+/**
+ * @brief Callback di errore.
+ * @details Il NACK del Master sull'ultimo byte di una lettura e' la normale conclusione della transazione e non viene
+ * 			contato come errore. In ogni caso la periferica viene rimessa in ascolto.
+ */
+void HAL_I2C_ErrorCallback(I2C_HandleTypeDef *hi2c){
+	if (HAL_I2C_GetError(hi2c) == HAL_I2C_ERROR_AF)
+		REGFILE_Stop(&regfile);
+	else
+		REGFILE_Error(&regfile);
+	HAL_I2C_EnableListen_IT(hi2c);
+}
+
 
 static void SystemClock_Config(void)
   {
     RCC_ClkInitTypeDef RCC_ClkInitStruct;
     RCC_OscInitTypeDef RCC_OscInitStruct;
+    RCC_PeriphCLKInitTypeDef RCC_PeriphClkInit;
 
     /* Enable HSE Oscillator and activate PLL with HSE as source */
     RCC_OscInitStruct.OscillatorType = RCC_OSCILLATORTYPE_HSE;
@@ -231,6 +296,13 @@ static void SystemClock_Config(void)
     if(HAL_RCC_ClockConfig(&RCC_ClkInitStruct, FLASH_LATENCY_2)!=HAL_OK){
     	Error_Handler();
     }
+
+    /* I2C1 clocked by SYSCLK: HSI (8 MHz) is too slow to meet the Fast mode data valid time with a real rise time */
+    RCC_PeriphClkInit.PeriphClockSelection = RCC_PERIPHCLK_I2C1;
+    RCC_PeriphClkInit.I2c1ClockSelection = RCC_I2C1CLKSOURCE_SYSCLK;
+    if(HAL_RCCEx_PeriphCLKConfig(&RCC_PeriphClkInit)!=HAL_OK){
+    	Error_Handler();
+    }
   }
 
 static void Error_Handler(void){
@@ -241,11 +313,14 @@ static void Error_Handler(void){
 
 static void I2Cx_Init(void)
 {
+  I2C_TIMING_t timing;
+
   if(HAL_I2C_GetState(&I2cHandle) == HAL_I2C_STATE_RESET)
   {
+	if (I2C_TIMING_Compute(HAL_RCCEx_GetPeriphCLKFreq(RCC_PERIPHCLK_I2C1), I2C_BUS_MODE, I2C_RISE_TIME_NS, I2C_FALL_TIME_NS, &timing) != 0)
+		Error_Handler();
 	I2cHandle.Instance = I2C1;
-	//I2cHandle.Init.Timing = 0x00C4092A;
-	I2cHandle.Init.Timing = 0x0000020C; //Fast Mode, 400KHz, RiseTime 0ns, FallTime 0ns
+	I2cHandle.Init.Timing = timing.timingr;
     I2cHandle.Init.OwnAddress1 =  I2C_ADDRESS_C;
     I2cHandle.Init.AddressingMode = I2C_ADDRESSINGMODE_7BIT;
     I2cHandle.Init.DualAddressMode = I2C_DUALADDRESS_DISABLE;
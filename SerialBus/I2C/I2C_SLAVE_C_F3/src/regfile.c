@@ -0,0 +1,151 @@
+/**
+ * @file regfile.c
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "regfile.h"
+#include <assert.h>
+#include <string.h>
+
+/**
+ * @brief Restituisce il byte n-esimo (little endian) di una word a 32 bit.
+ */
+#define BYTE_OF(w, n) ((uint8_t)((w) >> (8 * (n))))
+
+/**
+ * @brief Verifica se addr cade nei size registri a partire da base.
+ * @details Il confronto avviene sullo scostamento, per cui resta corretto anche quando l'intervallo termina alla fine
+ * dello spazio di indirizzamento (per esempio le statistiche di 8 Master, da 0x80 a 0xFF).
+ */
+#define IN_RANGE(addr, base, size) ((unsigned)((addr) - (base)) < (unsigned)(size))
+
+/**
+ * @brief Ricalcola la somma se nella transazione corrente e' stato scritto almeno un addendo.
+ */
+static void REGFILE_UpdateSum(REGFILE_t* rf) {
+	if (rf->dirty) {
+		uint16_t sum = 0;
+		for (int i = 0; i < REGFILE_N_ADDEND; i++)
+			sum += rf->addend[i];
+		rf->sum = sum;
+		rf->dirty = 0;
+		rf->updated = 1;
+	}
+}
+
+/**
+ * @brief Chiude la transazione corrente, aggiornando contatori e somma.
+ * @details Viene invocata sia allo stop sia ad un repeated start, che chiude implicitamente la transazione precedente.
+ */
+static void REGFILE_Close(REGFILE_t* rf) {
+	if (!rf->active)
+		return;
+	rf->active = 0;
+	if (rf->direction == REGFILE_READ) {
+		rf->txCount++;
+		return;
+	}
+	rf->rxCount++;
+	REGFILE_UpdateSum(rf);
+}
+
+void REGFILE_Init(REGFILE_t* rf) {
+	assert(rf);
+	memset(rf, 0, sizeof(REGFILE_t));
+}
+
+uint8_t REGFILE_Read(const REGFILE_t* rf, uint8_t addr) {
+	assert(rf);
+	if (IN_RANGE(addr, REGFILE_ADDEND_BASE, REGFILE_N_ADDEND))
+		return rf->addend[addr - REGFILE_ADDEND_BASE];
+	if (IN_RANGE(addr, REGFILE_STATS_BASE, REGFILE_STATS_SIZE * REGFILE_N_ADDEND))
+		return rf->stats[(addr - REGFILE_STATS_BASE) / REGFILE_STATS_SIZE][(addr - REGFILE_STATS_BASE) % REGFILE_STATS_SIZE];
+	if (IN_RANGE(addr, REGFILE_RX_COUNT, 4))
+		return BYTE_OF(rf->rxCount, addr - REGFILE_RX_COUNT);
+	if (IN_RANGE(addr, REGFILE_TX_COUNT, 4))
+		return BYTE_OF(rf->txCount, addr - REGFILE_TX_COUNT);
+	if (IN_RANGE(addr, REGFILE_ERR_COUNT, 4))
+		return BYTE_OF(rf->errCount, addr - REGFILE_ERR_COUNT);
+	switch (addr) {
+	case REGFILE_SUM_L:
+		return BYTE_OF(rf->sum, 0);
+	case REGFILE_SUM_H:
+		return BYTE_OF(rf->sum, 1);
+	case REGFILE_N_ADD:
+		return REGFILE_N_ADDEND;
+	}
+	return 0xFF;
+}
+
+int REGFILE_Write(REGFILE_t* rf, uint8_t addr, uint8_t value) {
+	assert(rf);
+	if (IN_RANGE(addr, REGFILE_ADDEND_BASE, REGFILE_N_ADDEND)) {
+		rf->addend[addr - REGFILE_ADDEND_BASE] = value;
+		rf->dirty = 1;
+		return 0;
+	}
+	if (IN_RANGE(addr, REGFILE_STATS_BASE, REGFILE_STATS_SIZE * REGFILE_N_ADDEND)) {
+		rf->stats[(addr - REGFILE_STATS_BASE) / REGFILE_STATS_SIZE][(addr - REGFILE_STATS_BASE) % REGFILE_STATS_SIZE] = value;
+		return 0;
+	}
+	return -1;
+}
+
+void REGFILE_AddrMatch(REGFILE_t* rf, REGFILE_Direction_t direction) {
+	assert(rf);
+	REGFILE_Close(rf);
+	rf->active = 1;
+	rf->direction = direction;
+	if (direction == REGFILE_WRITE)
+		rf->pointerValid = 0;
+}
+
+void REGFILE_RxByte(REGFILE_t* rf, uint8_t byte) {
+	assert(rf);
+	if (!rf->pointerValid) {
+		rf->pointer = byte;
+		rf->pointerValid = 1;
+	}
+	else
+		REGFILE_Write(rf, rf->pointer++, byte);
+}
+
+uint8_t REGFILE_TxByte(REGFILE_t* rf) {
+	assert(rf);
+	return REGFILE_Read(rf, rf->pointer++);
+}
+
+void REGFILE_Stop(REGFILE_t* rf) {
+	assert(rf);
+	REGFILE_Close(rf);
+}
+
+void REGFILE_Error(REGFILE_t* rf) {
+	assert(rf);
+	rf->errCount++;
+	rf->active = 0;
+	rf->pointerValid = 0;
+	REGFILE_UpdateSum(rf);
+}
+
+uint8_t REGFILE_TakeUpdate(REGFILE_t* rf) {
+	assert(rf);
+	if (!rf->updated)
+		return 0;
+	rf->updated = 0;
+	return 1;
+}
@@ -0,0 +1,201 @@
+/**
+ * @file i2c_timing_test.c
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+/**
+ * @brief Verifica su host di I2C_TIMING_Compute() e report dell'errore di frequenza del bus.
+ *
+ * @details
+ * Per ogni combinazione di I2CCLK, modalita' e tempi di salita/discesa il valore calcolato e' decodificato e verificato
+ * contro i vincoli della specifica I2C (UM10204) con un modello indipendente dal calcolatore: periodo di SCL, durata
+ * dei livelli alto e basso e, per SDADEL e SCLDEL, le disuguaglianze di RM0316 ("I2C timings") scritte come nel reference
+ * manual, senza il periodo di I2CCLK che il reference manual somma a tSDADEL e che e' gia' compreso nei loro termini.<br>
+ * Come riferimento sono usati gli esempi di TIMINGR del reference manual (RM0316, "Examples of timing settings") e il
+ * valore 0x0000020C usato in precedenza dal progetto. Per ciascuno e' riportata la frequenza ottenuta sul bus con i tempi
+ * di salita e discesa indicati, l'errore rispetto alla frequenza nominale e l'eventuale violazione della specifica; il
+ * valore calcolato deve rispettare la specifica e avere un errore non superiore a quello di ogni riferimento conforme.
+ * Infine si verifica che le macro I2C_TIMING_xMHZ_yK coincidano con il risultato del calcolo: tra queste, Fast mode a
+ * 8 MHz e Fast-mode Plus a 16 e 48 MHz, con tr/tf 100/10 ns, devono avere soluzione.<br>
+ * Il programma termina con stato diverso da zero se una verifica fallisce.
+ * @code
+ * gcc -std=gnu99 -Wall -Wextra -Iinc test/i2c_timing_test.c src/i2c_timing.c -o i2c_timing_test && ./i2c_timing_test
+ * @endcode
+ */
+#include "i2c_timing.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+static int failures = 0;
+
+#define CHECK(cond) do { if (!(cond)) { printf("%s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+/**
+ * @brief Vincoli UM10204 in ns, ripetuti qui per non dipendere dalla tabella interna al calcolatore.
+ */
+static const struct {
+	const char* name;
+	double rateHz;
+	double sudatMin, vddatMax, lowMin, highMin;
+} um10204[] = {
+	[I2C_TIMING_STANDARD]	= { "SM",  100000, 250, 3450, 4700, 4000 },
+	[I2C_TIMING_FAST]		= { "FM",  400000, 100,  900, 1300,  600 },
+	[I2C_TIMING_FAST_PLUS]	= { "FM+", 1000000, 50,  450,  500,  260 },
+};
+
+#define AF_MIN	50.0	//!< ritardo minimo del filtro analogico, ns
+#define AF_MAX	260.0	//!< ritardo massimo del filtro analogico, ns
+#define HDDAT_MIN	0.0	//!< data hold time minimo, ns, uguale per tutte le modalita'
+
+#define VD_LIMIT	"conforme, SDADEL = 0 (tVD;DAT irraggiungibile)"
+
+/**
+ * @brief Frequenza di SCL e conformita' di un valore di TIMINGR.
+ * @details Modello del reference manual: ogni livello di SCL dura (SCLx+1)*tPRESC piu' il ritardo di sincronizzazione
+ * (filtro analogico e 2 periodi di I2CCLK); il periodo comprende i tempi di salita e discesa. SDADEL e SCLDEL sono
+ * verificati con le disuguaglianze di RM0316 cosi' come sono scritte (DNF = 0):
+ *  - SDADEL >= (tf + tHD;DAT(min) - tAF(min) - 3 * tI2CCLK) / tPRESC
+ *  - SDADEL <= (tVD;DAT(max) - tr - tAF(max) - 4 * tI2CCLK) / tPRESC
+ *  - SCLDEL >= (tr + tSU;DAT(min)) / tPRESC - 1
+ *
+ * Se il secondo membro della seconda disuguaglianza e' negativo nessun valore la soddisfa: SDADEL = 0, il ritardo
+ * minimo realizzabile, e' accettato e segnalato in *vdLimit.
+ * @return stringa vuota se il valore e' conforme, altrimenti il primo vincolo violato
+ */
+static const char* evaluate(uint32_t timingr, double clkHz, I2C_TIMING_Mode_t mode, double rise, double fall,
+		double* freqHz, int* vdLimit) {
+	const double tclk = 1e9 / clkHz;
+	const double tpresc = ((timingr >> 28) + 1) * tclk;
+	const double scldel = (timingr >> 20) & 0xF;
+	const double sdadel = (timingr >> 16) & 0xF;
+	const double tsync = AF_MIN + 2 * tclk;
+	const double tlow = ((timingr & 0xFF) + 1) * tpresc + tsync;
+	const double thigh = (((timingr >> 8) & 0xFF) + 1) * tpresc + tsync;
+	*freqHz = 1e9 / (tlow + thigh + rise + fall);
+
+	if (*freqHz > um10204[mode].rateHz + 0.5)
+		return "fSCL";
+	if (tlow < um10204[mode].lowMin)
+		return "tLOW";
+	if (thigh < um10204[mode].highMin)
+		return "tHIGH";
+	if (scldel < (rise + um10204[mode].sudatMin) / tpresc - 1)
+		return "tSU;DAT";
+	const double sdadelMax = (um10204[mode].vddatMax - rise - AF_MAX - 4 * tclk) / tpresc;
+	*vdLimit = sdadelMax < 0;
+	if (sdadel > sdadelMax && !(*vdLimit && sdadel == 0))
+		return "tVD;DAT";
+	if (sdadel < (fall + HDDAT_MIN - AF_MIN - 3 * tclk) / tpresc)
+		return "tHD;DAT";
+	return "";
+}
+
+static double errorPct(double freqHz, I2C_TIMING_Mode_t mode) {
+	return 100.0 * (freqHz - um10204[mode].rateHz) / um10204[mode].rateHz;
+}
+
+/**
+ * @brief Esempi di TIMINGR del reference manual.
+ */
+static const struct {
+	uint32_t clkHz;
+	I2C_TIMING_Mode_t mode;
+	uint32_t timingr;
+	const char* source;
+} reference[] = {
+	{  8000000, I2C_TIMING_STANDARD,	0x10420F13, "RM0316" },
+	{  8000000, I2C_TIMING_FAST,		0x00310309, "RM0316" },
+	{  8000000, I2C_TIMING_FAST,		0x0000020C, "progetto" },
+	{ 16000000, I2C_TIMING_STANDARD,	0x30420F13, "RM0316" },
+	{ 16000000, I2C_TIMING_FAST,		0x10320309, "RM0316" },
+	{ 16000000, I2C_TIMING_FAST_PLUS,	0x00200204, "RM0316" },
+	{ 48000000, I2C_TIMING_STANDARD,	0xB0420F13, "RM0316" },
+	{ 48000000, I2C_TIMING_FAST,		0x50330309, "RM0316" },
+	{ 48000000, I2C_TIMING_FAST_PLUS,	0x50100103, "RM0316" },
+};
+
+/**
+ * @brief Tempi di salita e discesa (ns): bus ideale, bus tipico della board, bus carico al limite della Fast mode.
+ */
+static const struct {
+	uint32_t rise, fall;
+} bus[] = { { 0, 0 }, { 100, 10 }, { 300, 100 } };
+
+int main(void) {
+	printf("%-9s %-4s %-9s %-10s %-10s %9s %8s %s\n", "I2CCLK", "mode", "tr/tf", "sorgente", "TIMINGR", "fSCL", "errore", "note");
+	for (size_t r = 0; r < sizeof(reference) / sizeof(reference[0]); r++) {
+		const uint32_t clk = reference[r].clkHz;
+		const I2C_TIMING_Mode_t mode = reference[r].mode;
+		for (size_t b = 0; b < sizeof(bus) / sizeof(bus[0]); b++) {
+			I2C_TIMING_t t;
+			double refFreq, freq;
+			int vdLimit;
+			const char* refViolation = evaluate(reference[r].timingr, clk, mode, bus[b].rise, bus[b].fall, &refFreq,
+					&vdLimit);
+			printf("%-9u %-4s %3u/%-5u %-10s 0x%08X %9.0f %+7.2f%% %s\n", (unsigned) clk, um10204[mode].name,
+					(unsigned) bus[b].rise, (unsigned) bus[b].fall, reference[r].source, (unsigned) reference[r].timingr,
+					refFreq, errorPct(refFreq, mode), *refViolation ? refViolation : vdLimit ? VD_LIMIT : "conforme");
+
+			if (I2C_TIMING_Compute(clk, mode, bus[b].rise, bus[b].fall, &t) != 0) {
+				printf("%-9s %-4s %-9s %-10s %-10s %9s %8s %s\n", "", "", "", "calcolato", "-", "-", "-", "nessuna soluzione");
+				/* se esiste un riferimento conforme, anche il calcolatore deve trovare una soluzione */
+				CHECK(*refViolation);
+				continue;
+			}
+			const char* violation = evaluate(t.timingr, clk, mode, bus[b].rise, bus[b].fall, &freq, &vdLimit);
+			printf("%-9s %-4s %-9s %-10s 0x%08X %9.0f %+7.2f%% %s\n", "", "", "", "calcolato", (unsigned) t.timingr,
+					freq, errorPct(freq, mode), *violation ? violation : vdLimit ? VD_LIMIT : "conforme");
+
+			CHECK(!*violation);
+			CHECK(abs((int) t.freqHz - (int) (freq + 0.5)) <= 1);
+			CHECK(abs(t.errorPpm - (int32_t) (errorPct(freq, mode) * 1e4)) <= 10);
+			if (!*refViolation)
+				CHECK(freq >= refFreq - 0.5);
+		}
+	}
+
+	/* le macro precalcolate devono coincidere con il calcolo (tr 100 ns, tf 10 ns) */
+	static const struct {
+		uint32_t clkHz;
+		I2C_TIMING_Mode_t mode;
+		uint32_t timingr;
+	} table[] = {
+		{  8000000, I2C_TIMING_STANDARD,	I2C_TIMING_8MHZ_100K },
+		{  8000000, I2C_TIMING_FAST,		I2C_TIMING_8MHZ_400K },
+		{ 16000000, I2C_TIMING_STANDARD,	I2C_TIMING_16MHZ_100K },
+		{ 16000000, I2C_TIMING_FAST,		I2C_TIMING_16MHZ_400K },
+		{ 16000000, I2C_TIMING_FAST_PLUS,	I2C_TIMING_16MHZ_1M },
+		{ 48000000, I2C_TIMING_STANDARD,	I2C_TIMING_48MHZ_100K },
+		{ 48000000, I2C_TIMING_FAST,		I2C_TIMING_48MHZ_400K },
+		{ 48000000, I2C_TIMING_FAST_PLUS,	I2C_TIMING_48MHZ_1M },
+		{ 72000000, I2C_TIMING_STANDARD,	I2C_TIMING_72MHZ_100K },
+		{ 72000000, I2C_TIMING_FAST,		I2C_TIMING_72MHZ_400K },
+		{ 72000000, I2C_TIMING_FAST_PLUS,	I2C_TIMING_72MHZ_1M },
+	};
+	for (size_t i = 0; i < sizeof(table) / sizeof(table[0]); i++) {
+		I2C_TIMING_t t;
+		CHECK(I2C_TIMING_Compute(table[i].clkHz, table[i].mode, 100, 10, &t) == 0);
+		CHECK(t.timingr == table[i].timingr);
+	}
+
+	/* tempi fuori specifica */
+	I2C_TIMING_t t;
+	CHECK(I2C_TIMING_Compute(72000000, I2C_TIMING_FAST_PLUS, 121, 10, &t) != 0);
+	CHECK(I2C_TIMING_Compute(72000000, I2C_TIMING_STANDARD, 1001, 10, &t) != 0);
+
+	printf("i2c_timing: %s\n", failures ? "FAILED" : "OK");
+	return failures != 0;
+}
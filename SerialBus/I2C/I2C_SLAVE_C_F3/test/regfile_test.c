@@ -0,0 +1,133 @@
+/**
+ * @file regfile_test.c
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+/**
+ * @brief Verifica su host del register file, pilotato con eventi I2C simulati.
+ *
+ * @details
+ * Ogni transazione del Master e' tradotta nella sequenza di eventi che i callback della HAL inoltrano al register file
+ * (address match, byte ricevuti o trasmessi, stop, errore). Il programma termina con stato diverso da zero se una
+ * verifica fallisce.
+ * @code
+ * gcc -std=gnu99 -Wall -Wextra -Iinc test/regfile_test.c src/regfile.c -o regfile_test && ./regfile_test
+ * @endcode
+ */
+#include "regfile.h"
+#include <stdio.h>
+
+static int failures = 0;
+
+#define CHECK(cond) do { if (!(cond)) { printf("%s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+/**
+ * @brief Scrittura del Master: puntatore seguito da n byte, chiusa da uno stop.
+ */
+static void masterWrite(REGFILE_t* rf, uint8_t reg, const uint8_t* data, int n) {
+	REGFILE_AddrMatch(rf, REGFILE_WRITE);
+	REGFILE_RxByte(rf, reg);
+	for (int i = 0; i < n; i++)
+		REGFILE_RxByte(rf, data[i]);
+	REGFILE_Stop(rf);
+}
+
+/**
+ * @brief Lettura del Master: scrittura del puntatore, repeated start, lettura burst di n byte, stop.
+ */
+static void masterRead(REGFILE_t* rf, uint8_t reg, uint8_t* data, int n) {
+	REGFILE_AddrMatch(rf, REGFILE_WRITE);
+	REGFILE_RxByte(rf, reg);
+	REGFILE_AddrMatch(rf, REGFILE_READ);
+	for (int i = 0; i < n; i++)
+		data[i] = REGFILE_TxByte(rf);
+	REGFILE_Stop(rf);
+}
+
+static uint32_t le32(const uint8_t* b) {
+	return b[0] | (b[1] << 8) | (b[2] << 16) | ((uint32_t)b[3] << 24);
+}
+
+int main(void) {
+	REGFILE_t rf;
+	uint8_t buf[32];
+	REGFILE_Init(&rf);
+
+	/* frame a due byte dei Master esistenti: {'A', valore} e {'B', valore} */
+	buf[0] = 7;
+	masterWrite(&rf, 'A', buf, 1);
+	CHECK(REGFILE_TakeUpdate(&rf) == 1);
+	CHECK(REGFILE_TakeUpdate(&rf) == 0);
+	buf[0] = 9;
+	masterWrite(&rf, 'B', buf, 1);
+	CHECK(rf.sum == 16);
+	CHECK(REGFILE_TakeUpdate(&rf) == 1);
+
+	/* scrittura burst di tutti gli addendi, con auto-incremento; la somma supera un byte */
+	for (int i = 0; i < REGFILE_N_ADDEND; i++)
+		buf[i] = 200 + i;
+	masterWrite(&rf, REGFILE_ADDEND(0), buf, REGFILE_N_ADDEND);
+	uint16_t expected = 0;
+	for (int i = 0; i < REGFILE_N_ADDEND; i++)
+		expected += 200 + i;
+	CHECK(rf.sum == expected);
+
+	/* lettura burst di somma e numero di addendi */
+	masterRead(&rf, REGFILE_SUM_L, buf, 3);
+	CHECK((buf[0] | (buf[1] << 8)) == expected);
+	CHECK(buf[2] == REGFILE_N_ADDEND);
+	CHECK(REGFILE_Read(&rf, 0x03) == 0xFF);
+
+	/* i registri di sola lettura ignorano le scritture e non aggiornano la somma */
+	REGFILE_TakeUpdate(&rf);
+	buf[0] = 0x55;
+	masterWrite(&rf, REGFILE_SUM_L, buf, 1);
+	CHECK(rf.sum == expected);
+	CHECK(REGFILE_TakeUpdate(&rf) == 0);
+	CHECK(REGFILE_Write(&rf, 0x20, 1) == -1);
+
+	/* statistiche dell'ultimo Master, fino alla fine dello spazio di indirizzamento */
+	for (int i = 0; i < REGFILE_STATS_SIZE; i++)
+		buf[i] = 0xA0 + i;
+	masterWrite(&rf, REGFILE_STATS(REGFILE_N_ADDEND - 1), buf, REGFILE_STATS_SIZE);
+	masterRead(&rf, REGFILE_STATS(REGFILE_N_ADDEND - 1), buf + 16, REGFILE_STATS_SIZE);
+	for (int i = 0; i < REGFILE_STATS_SIZE; i++)
+		CHECK(buf[16 + i] == 0xA0 + i);
+	CHECK(REGFILE_Read(&rf, REGFILE_STATS_BASE - 1) == 0xFF);
+	CHECK(REGFILE_Read(&rf, REGFILE_ADDEND_BASE - 1) == 0xFF);
+
+	/* errore a meta' transazione: l'addendo gia' scritto resta valido, il contatore di errori cresce */
+	REGFILE_AddrMatch(&rf, REGFILE_WRITE);
+	REGFILE_RxByte(&rf, REGFILE_ADDEND(0));
+	REGFILE_RxByte(&rf, 0);
+	REGFILE_Error(&rf);
+	CHECK(rf.sum == expected - 200);
+	/* dopo l'errore il primo byte ricevuto e' di nuovo il puntatore */
+	buf[0] = 1;
+	masterWrite(&rf, REGFILE_ADDEND(1), buf, 1);
+	CHECK(rf.addend[1] == 1);
+
+	/* contatori: 6 scritture e 3 scritture del puntatore (chiuse dal repeated start), 2 letture gia' concluse, 1 errore */
+	masterRead(&rf, REGFILE_RX_COUNT, buf, 12);
+	CHECK(le32(buf) == 9);
+	CHECK(le32(buf + 4) == 2);
+	CHECK(le32(buf + 8) == 1);
+	CHECK(rf.rxCount == 9);
+	CHECK(rf.txCount == 3);
+
+	printf("regfile: %s\n", failures ? "FAILED" : "OK");
+	return failures != 0;
+}
@@ -0,0 +1,166 @@
+/**
+ * @file uacsync.h
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+#ifndef UACSYNC_H_
+#define UACSYNC_H_
+
+/**
+ * @addtogroup USBD
+ * @{
+ * @addtogroup AUDIO_MIC
+ * @{
+ * @defgroup UACSYNC
+ * @{
+ *
+ * @brief Sincronizzazione di un flusso audio isocrono IN con il clock USB (SOF).
+ *
+ * @details
+ * Il microfono produce campioni al ritmo del proprio clock (PLLI2S), mentre l'host ne preleva un pacchetto ad ogni
+ * SOF, cioe' al ritmo del clock USB dell'host: i due clock non sono mai uguali, per cui un numero fisso di frame per
+ * pacchetto prima o poi svuota o riempie qualsiasi buffer. L'endpoint e' dichiarato asincrono: il dispositivo adatta
+ * la dimensione dei pacchetti al proprio clock, inviando di volta in volta il numero nominale di frame per SOF, uno in
+ * piu' o uno in meno.<br>
+ * Il modulo raccoglie i frame acquisiti in un buffer circolare e, ad ogni SOF, decide quanti frame trasmettere con un
+ * regolatore proporzionale-integrale sul livello del buffer:
+ *  - l'integrale converge alla frequenza effettiva dei campioni misurata in frame per SOF (UACSYNC_RateHz()), cioe' al
+ *    valore che un endpoint di feedback comunicherebbe all'host;
+ *  - il termine proporzionale riporta il livello all'obiettivo, che fissa la latenza;
+ *  - un accumulatore frazionario converte la frequenza stimata nella sequenza di pacchetti, per cui il numero medio di
+ *    frame trasmessi coincide con quello acquisito, senza campioni persi o duplicati a regime.
+ *
+ * La trasmissione parte (e riparte dopo un underrun) solo quando il livello raggiunge l'obiettivo: fino ad allora
+ * vengono trasmessi pacchetti vuoti. Il buffer e' lock-free con un solo produttore (la callback del DMA di I2S,
+ * UACSYNC_Write()) e un solo consumatore (la callback del SOF, UACSYNC_Packet()).<br>
+ * Il modulo non dipende dalla libreria HAL, per cui puo' essere compilato e verificato anche su un host, simulando
+ * clock con frequenze diverse.
+ */
+
+#include <inttypes.h>
+
+#ifndef UACSYNC_LENGTH
+#define UACSYNC_LENGTH			512		//!< Frame memorizzabili (potenza di 2)
+#endif
+
+#ifndef UACSYNC_MAX_CHANNELS
+#define UACSYNC_MAX_CHANNELS	2		//!< Numero massimo di canali per frame
+#endif
+
+/**
+ * @brief Guadagno proporzionale del regolatore, in potenze di 2: frame per SOF di correzione per frame di errore.
+ */
+#ifndef UACSYNC_KP_SHIFT
+#define UACSYNC_KP_SHIFT		7
+#endif
+
+/**
+ * @brief Guadagno integrale del regolatore, in potenze di 2.
+ */
+#ifndef UACSYNC_KI_SHIFT
+#define UACSYNC_KI_SHIFT		14
+#endif
+
+#if (UACSYNC_LENGTH & (UACSYNC_LENGTH - 1)) != 0
+#error "UACSYNC_LENGTH deve essere una potenza di 2"
+#endif
+
+/**
+ * @brief Contatori del flusso.
+ */
+typedef struct {
+	uint32_t packets;		//!< pacchetti con dati trasmessi
+	uint32_t frames;		//!< frame trasmessi
+	uint32_t underruns;		//!< pacchetti completati con silenzio per buffer vuoto
+	uint32_t overruns;		//!< frame acquisiti e scartati per buffer pieno
+	uint32_t longPackets;	//!< pacchetti con un frame in piu' del nominale
+	uint32_t shortPackets;	//!< pacchetti con un frame in meno del nominale
+} UACSYNC_Stats_t;
+
+/**
+ * @brief Struttura che rappresenta il flusso.
+ */
+typedef struct {
+	int16_t frame[UACSYNC_LENGTH][UACSYNC_MAX_CHANNELS];	//!< frame acquisiti
+	uint8_t channels;					//!< canali per frame
+	uint16_t target;					//!< livello obiettivo, in frame
+	uint32_t nominal;					//!< frame per SOF nominali, Q16
+	volatile uint32_t head;				//!< frame scritti dall'avvio (produttore)
+	volatile uint32_t tail;				//!< frame letti dall'avvio (consumatore)
+	volatile uint8_t running;			//!< 1 se il livello ha raggiunto l'obiettivo
+	int32_t integral;					//!< frequenza stimata, frame per SOF in Q16
+	uint32_t phase;						//!< frazione di frame accumulata, Q16
+	UACSYNC_Stats_t stats;				//!< contatori
+} UACSYNC_t;
+
+/**
+ * @brief Inizializza il flusso, vuoto.
+ * @param[out] s puntatore al flusso
+ * @param[in] channels canali per frame, al piu' UACSYNC_MAX_CHANNELS
+ * @param[in] fs frequenza di campionamento nominale, in Hz
+ * @param[in] sofHz frequenza dei SOF, in Hz (1000 a full speed)
+ * @param[in] target livello obiettivo, in frame, misurato prima di ogni pacchetto: deve coprire almeno due blocchi
+ * del produttore piu' un frame, perche' un blocco puo' arrivare con un SOF di ritardo
+ */
+void UACSYNC_Init(UACSYNC_t* s, uint8_t channels, uint32_t fs, uint32_t sofHz, uint16_t target);
+
+/**
+ * @brief Accoda i frame acquisiti; lato produttore.
+ * @details Se il buffer e' pieno, i frame in eccesso sono scartati e contati.
+ * @param[inout] s puntatore al flusso
+ * @param[in] pcm campioni interlacciati
+ * @param[in] frames numero di frame
+ * @param[in] stride campioni per frame in pcm, almeno channels: i canali in eccesso sono ignorati (per esempio il
+ * canale duplicato di un microfono mono su un buffer stereo)
+ */
+void UACSYNC_Write(UACSYNC_t* s, const int16_t* pcm, uint32_t frames, uint8_t stride);
+
+/**
+ * @brief Prepara il pacchetto da trasmettere al SOF corrente; lato consumatore.
+ * @param[inout] s puntatore al flusso
+ * @param[out] packet campioni del pacchetto, interlacciati
+ * @param[in] maxFrames dimensione massima del pacchetto, in frame (almeno il nominale piu' uno)
+ * @return numero di frame del pacchetto, 0 finche' il livello obiettivo non e' stato raggiunto
+ */
+uint32_t UACSYNC_Packet(UACSYNC_t* s, int16_t* packet, uint32_t maxFrames);
+
+/**
+ * @brief Svuota il flusso e riparte dalla frequenza nominale; lato consumatore (per esempio alla selezione
+ * dell'alternate setting da parte dell'host).
+ * @param[inout] s puntatore al flusso
+ */
+void UACSYNC_Reset(UACSYNC_t* s);
+
+/**
+ * @brief Restituisce il numero di frame presenti nel buffer.
+ * @param[in] s puntatore al flusso
+ */
+uint32_t UACSYNC_Level(const UACSYNC_t* s);
+
+/**
+ * @brief Restituisce la frequenza effettiva dei campioni stimata dal regolatore, in Hz, misurata con il clock USB.
+ * @param[in] s puntatore al flusso
+ * @param[in] sofHz frequenza dei SOF, in Hz
+ */
+uint32_t UACSYNC_RateHz(const UACSYNC_t* s, uint32_t sofHz);
+
+/**
+ * @}
+ * @}
+ * @}
+ */
+
+#endif /* UACSYNC_H_ */
@@ -0,0 +1,115 @@
+/**
+ * @file usbdesc.h
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef USBDESC_H_
+#define USBDESC_H_
+
+/**
+ * @addtogroup USBD
+ * @{
+ * @addtogroup AUDIO_MIC
+ * @{
+ * @defgroup USBDESC
+ * @{
+ *
+ * @brief Verifica del descrittore di configurazione e ripartizione della memoria FIFO del core OTG_FS.
+ *
+ * @details
+ * Il core OTG_FS dell'STM32F4 dispone di 1.25 KB (320 parole) di memoria per le FIFO, condivisa tra una RX FIFO, comune a
+ * tutti gli endpoint OUT, ed una TX FIFO per ciascun endpoint IN, e di 4 endpoint fisici per direzione, EP0 compreso.
+ * Le dimensioni delle FIFO, invece di essere fissate a mano in USBD_LL_Init(), sono ricavate dal descrittore di
+ * configurazione, che e' l'unico elenco delle interfacce e degli endpoint del dispositivo:
+ *  - USBDESC_Validate() percorre il descrittore e ne verifica la coerenza (lunghezze, numero di interfacce e di endpoint,
+ *    indirizzi unici e disponibili sul core, dimensioni dei pacchetti ammesse a full speed);
+ *  - USBDESC_PlanFifo() calcola la RX FIFO secondo la formula del reference manual (RM0090, par. 34.11) e una TX FIFO
+ *    per ciascun endpoint IN, doppia per gli endpoint bulk e isocroni, verificando che il totale rientri nella memoria disponibile.
+ *
+ * Il modulo non dipende dalla libreria HAL, per cui puo' essere compilato anche su un host per verificare un descrittore
+ * prima di portarlo sulla board.
+ */
+
+#include <inttypes.h>
+
+#ifndef USBDESC_MAX_EP
+#define USBDESC_MAX_EP			4		//!< Endpoint fisici per direzione, EP0 compreso
+#endif
+
+#ifndef USBDESC_FIFO_WORDS
+#define USBDESC_FIFO_WORDS		320		//!< Memoria FIFO del core, in parole da 32 bit
+#endif
+
+#define USBDESC_TXFIFO_MIN		16		//!< Dimensione minima di una TX FIFO, in parole
+#define USBDESC_FS_MAX_PACKET	64		//!< Massima dimensione di un pacchetto bulk o interrupt a full speed
+#define USBDESC_FS_MAX_ISOC_PACKET	1023	//!< Massima dimensione di un pacchetto isocrono a full speed
+
+#define USBDESC_TYPE_CONFIGURATION	0x02	//!< Tipo del descrittore di configurazione
+#define USBDESC_TYPE_INTERFACE		0x04	//!< Tipo del descrittore di interfaccia
+#define USBDESC_TYPE_ENDPOINT		0x05	//!< Tipo del descrittore di endpoint
+#define USBDESC_TYPE_IAD			0x0B	//!< Tipo dell'Interface Association Descriptor
+
+/**
+ * @brief Esito della verifica di un descrittore.
+ */
+typedef enum {
+	USBDESC_OK = 0,				//!< descrittore valido
+	USBDESC_ERR_LENGTH,			//!< un descrittore eccede la lunghezza totale o ha bLength non valido
+	USBDESC_ERR_TOTAL,			//!< wTotalLength non corrisponde alla lunghezza del descrittore
+	USBDESC_ERR_INTERFACE,		//!< numero di interfacce o di endpoint non coerente, interfaccia duplicata
+	USBDESC_ERR_ENDPOINT,		//!< endpoint non disponibile sul core o duplicato
+	USBDESC_ERR_PACKET,			//!< dimensione del pacchetto o intervallo di polling non ammessi
+	USBDESC_ERR_FIFO			//!< le FIFO richieste eccedono la memoria disponibile
+} USBDESC_Status_t;
+
+/**
+ * @brief Ripartizione della memoria FIFO, in parole da 32 bit.
+ */
+typedef struct {
+	uint16_t rx;						//!< RX FIFO, comune a tutti gli endpoint OUT
+	uint16_t tx[USBDESC_MAX_EP];		//!< TX FIFO dell'endpoint IN i-esimo (0 se non usato)
+	uint8_t nTx;						//!< numero di TX FIFO da configurare (endpoint IN piu' alto + 1)
+	uint16_t used;						//!< memoria assegnata, pari a USBDESC_FIFO_WORDS se il piano e' valido
+} USBDESC_Fifo_t;
+
+/**
+ * @brief Verifica la coerenza di un descrittore di configurazione.
+ * @param[in] cfg descrittore di configurazione, comprensivo dei descrittori di interfaccia, classe ed endpoint
+ * @param[in] len lunghezza del descrittore, in byte
+ * @return USBDESC_OK se il descrittore e' valido, altrimenti la prima incoerenza rilevata
+ */
+USBDESC_Status_t USBDESC_Validate(const uint8_t* cfg, uint16_t len);
+
+/**
+ * @brief Calcola le dimensioni delle FIFO per gli endpoint dichiarati in un descrittore di configurazione.
+ * @details La memoria che resta dopo aver assegnato le TX FIFO e la RX FIFO minima e' aggiunta alla RX FIFO.
+ * @param[in] cfg descrittore di configurazione, gia' verificato con USBDESC_Validate()
+ * @param[in] len lunghezza del descrittore, in byte
+ * @param[in] ep0Size dimensione massima di un pacchetto sull'endpoint di controllo
+ * @param[out] plan ripartizione calcolata
+ * @retval USBDESC_OK se le FIFO rientrano nella memoria disponibile
+ * @retval USBDESC_ERR_FIFO altrimenti; plan riporta comunque le dimensioni minime richieste
+ */
+USBDESC_Status_t USBDESC_PlanFifo(const uint8_t* cfg, uint16_t len, uint8_t ep0Size, USBDESC_Fifo_t* plan);
+
+/**
+ * @}
+ * @}
+ * @}
+ */
+
+#endif /* USBDESC_H_ */
@@ -0,0 +1,151 @@
+/**
+ * @file usbd_audio_mic.h
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+#ifndef USBD_AUDIO_MIC_H_
+#define USBD_AUDIO_MIC_H_
+
+/**
+ * @addtogroup USBD
+ * @{
+ * @addtogroup AUDIO_MIC
+ * @{
+ * @defgroup USBD_AUDIO_MIC
+ * @{
+ *
+ * @brief Classe USB Audio 1.0: microfono mono a 16 bit su endpoint isocrono IN.
+ *
+ * @details
+ * Il dispositivo espone due interfacce:
+ * | Interfaccia | Funzione                                               | Endpoint                                 |
+ * |-------------|--------------------------------------------------------|------------------------------------------|
+ * | 0           | AudioControl: Input Terminal (microfono) -> Output Terminal (USB streaming) | nessuno             |
+ * | 1           | AudioStreaming: alternate setting 0 senza banda, 1 PCM | 0x81 isocrono IN asincrono, 1 ms         |
+ *
+ * L'host seleziona l'alternate setting 1 quando un'applicazione apre il microfono e torna allo 0 alla chiusura: ad ogni
+ * cambio viene invocata USBD_AUDIO_MIC_StreamCallback(). Con il flusso attivo, ad ogni SOF la classe chiede
+ * all'applicazione il pacchetto del frame tramite USBD_AUDIO_MIC_PacketCallback() e lo carica sull'endpoint; un
+ * pacchetto vuoto e' comunque trasmesso, per non lasciare l'host senza risposta.<br>
+ * L'endpoint e' asincrono: la frequenza dei campioni dipende dal clock del dispositivo (PLLI2S) e non dal SOF, per cui
+ * la dimensione dei pacchetti varia di un frame attorno al nominale (vedi UACSYNC). Per un endpoint IN asincrono la
+ * specifica non prevede un endpoint di feedback: l'host ricava la frequenza effettiva dal numero di campioni ricevuti.<br>
+ * Il flusso non ha controlli (volume, mute): il descrittore non contiene Feature Unit e le richieste di classe sono
+ * rifiutate.
+ */
+
+#include "usbd_ioreq.h"
+
+/**
+ * @brief Frequenza di campionamento, in Hz; deve coincidere con quella di acquisizione del microfono.
+ */
+#ifndef AUDIO_MIC_FREQ
+#define AUDIO_MIC_FREQ				16000
+#endif
+
+#define AUDIO_MIC_CHANNELS			1		//!< Canali per frame
+#define AUDIO_MIC_SAMPLE_SIZE		2		//!< Byte per campione
+
+#define AUDIO_MIC_AC_ITF			0x00	//!< Interfaccia AudioControl
+#define AUDIO_MIC_AS_ITF			0x01	//!< Interfaccia AudioStreaming
+#define AUDIO_MIC_NUM_ITF			0x02	//!< Numero di interfacce
+
+#define AUDIO_MIC_EPIN_ADDR			0x81	//!< Endpoint isocrono IN
+
+/**
+ * @brief Frame nominali per pacchetto (un pacchetto per SOF, ogni millisecondo).
+ */
+#define AUDIO_MIC_FRAMES_NOMINAL	(AUDIO_MIC_FREQ / 1000)
+
+/**
+ * @brief Frame massimi per pacchetto: il nominale piu' uno, per recuperare la differenza tra i clock.
+ */
+#define AUDIO_MIC_FRAMES_MAX		(AUDIO_MIC_FRAMES_NOMINAL + 1)
+
+/**
+ * @brief Dimensione massima di un pacchetto, in byte.
+ */
+#define AUDIO_MIC_EPIN_SIZE			(AUDIO_MIC_FRAMES_MAX * AUDIO_MIC_CHANNELS * AUDIO_MIC_SAMPLE_SIZE)
+
+#define AUDIO_MIC_CONFIG_DESC_SIZE	100		//!< Dimensione del descrittore di configurazione
+#define AUDIO_MIC_AC_DESC_SIZE		30		//!< Dimensione dei descrittori di classe dell'interfaccia AudioControl
+
+#if AUDIO_MIC_FREQ % 1000 != 0
+#error "AUDIO_MIC_FREQ deve essere un multiplo di 1000 Hz (44.1 kHz non e' gestita)"
+#endif
+
+#define AUDIO_INTERFACE_DESCRIPTOR_TYPE		0x24	//!< CS_INTERFACE
+#define AUDIO_ENDPOINT_DESCRIPTOR_TYPE		0x25	//!< CS_ENDPOINT
+
+#define AUDIO_SUBCLASS_AUDIOCONTROL			0x01
+#define AUDIO_SUBCLASS_AUDIOSTREAMING		0x02
+
+#define AUDIO_CONTROL_HEADER				0x01
+#define AUDIO_CONTROL_INPUT_TERMINAL		0x02
+#define AUDIO_CONTROL_OUTPUT_TERMINAL		0x03
+#define AUDIO_STREAMING_GENERAL				0x01
+#define AUDIO_STREAMING_FORMAT_TYPE			0x02
+#define AUDIO_ENDPOINT_GENERAL				0x01
+
+#define AUDIO_FORMAT_TYPE_I					0x01
+#define AUDIO_FORMAT_PCM					0x0001
+
+#define AUDIO_TERMINAL_MICROPHONE			0x0201
+#define AUDIO_TERMINAL_USB_STREAMING		0x0101
+
+/**
+ * @brief Stato della classe, allocato all'apertura della configurazione.
+ */
+typedef struct {
+	uint8_t altSetting;						//!< alternate setting dell'interfaccia AudioStreaming
+	volatile uint8_t busy;					//!< 1 se un pacchetto e' in trasmissione
+	uint32_t incomplete;					//!< pacchetti non letti dall'host entro il frame
+	uint8_t packet[AUDIO_MIC_EPIN_SIZE];	//!< pacchetto in trasmissione
+} USBD_AUDIO_MIC_HandleTypeDef;
+
+extern USBD_ClassTypeDef USBD_AUDIO_MIC;
+
+/**
+ * @brief Restituisce 1 se l'host ha selezionato l'alternate setting con il flusso attivo.
+ */
+uint8_t USBD_AUDIO_MIC_IsStreaming(USBD_HandleTypeDef* pdev);
+
+/**
+ * @brief Callback invocata, in contesto di interruzione, quando l'host apre (active = 1) o chiude (active = 0) il flusso.
+ */
+void USBD_AUDIO_MIC_StreamCallback(USBD_HandleTypeDef* pdev, uint8_t active);
+
+/**
+ * @brief Callback invocata, in contesto di interruzione, ad ogni SOF con il flusso attivo, per preparare il pacchetto.
+ * @param[in] pdev device USB
+ * @param[out] pcm campioni del pacchetto, interlacciati
+ * @param[in] maxFrames dimensione massima del pacchetto, AUDIO_MIC_FRAMES_MAX
+ * @return numero di frame del pacchetto, anche 0
+ */
+uint32_t USBD_AUDIO_MIC_PacketCallback(USBD_HandleTypeDef* pdev, int16_t* pcm, uint32_t maxFrames);
+
+/**
+ * @brief Callback invocata, in contesto di interruzione, ad ogni Start Of Frame.
+ */
+void USBD_AUDIO_MIC_SOFCallback(USBD_HandleTypeDef* pdev);
+
+/**
+ * @}
+ * @}
+ * @}
+ */
+
+#endif /* USBD_AUDIO_MIC_H_ */
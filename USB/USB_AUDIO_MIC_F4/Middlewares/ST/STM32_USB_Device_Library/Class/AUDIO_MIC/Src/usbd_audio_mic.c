@@ -0,0 +1,318 @@
+/**
+ * @file usbd_audio_mic.c
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+#include "usbd_audio_mic.h"
+#include "usbd_desc.h"
+#include "usbd_ctlreq.h"
+
+static uint8_t USBD_AUDIO_MIC_Init(USBD_HandleTypeDef* pdev, uint8_t cfgidx);
+static uint8_t USBD_AUDIO_MIC_DeInit(USBD_HandleTypeDef* pdev, uint8_t cfgidx);
+static uint8_t USBD_AUDIO_MIC_Setup(USBD_HandleTypeDef* pdev, USBD_SetupReqTypedef* req);
+static uint8_t USBD_AUDIO_MIC_DataIn(USBD_HandleTypeDef* pdev, uint8_t epnum);
+static uint8_t USBD_AUDIO_MIC_SOF(USBD_HandleTypeDef* pdev);
+static uint8_t USBD_AUDIO_MIC_IsoINIncomplete(USBD_HandleTypeDef* pdev, uint8_t epnum);
+static uint8_t* USBD_AUDIO_MIC_GetCfgDesc(uint16_t* length);
+static uint8_t* USBD_AUDIO_MIC_GetDeviceQualifierDesc(uint16_t* length);
+
+USBD_ClassTypeDef USBD_AUDIO_MIC = {
+	USBD_AUDIO_MIC_Init,
+	USBD_AUDIO_MIC_DeInit,
+	USBD_AUDIO_MIC_Setup,
+	NULL, /*EP0_TxSent*/
+	NULL, /*EP0_RxReady*/
+	USBD_AUDIO_MIC_DataIn,
+	NULL, /*DataOut*/
+	USBD_AUDIO_MIC_SOF,
+	USBD_AUDIO_MIC_IsoINIncomplete,
+	NULL,
+	USBD_AUDIO_MIC_GetCfgDesc,
+	USBD_AUDIO_MIC_GetCfgDesc,
+	USBD_AUDIO_MIC_GetCfgDesc,
+	USBD_AUDIO_MIC_GetDeviceQualifierDesc,
+};
+
+/**
+ * @brief Descrittore di configurazione.
+ * @details E' l'unico elenco delle interfacce e degli endpoint del dispositivo: USBD_LL_Init() ne ricava le FIFO.
+ */
+__ALIGN_BEGIN static uint8_t USBD_AUDIO_MIC_CfgDesc[AUDIO_MIC_CONFIG_DESC_SIZE] __ALIGN_END = {
+	0x09,							/* bLength: Configuration Descriptor size */
+	USB_DESC_TYPE_CONFIGURATION,	/* bDescriptorType: Configuration */
+	LOBYTE(AUDIO_MIC_CONFIG_DESC_SIZE),	/* wTotalLength */
+	HIBYTE(AUDIO_MIC_CONFIG_DESC_SIZE),
+	AUDIO_MIC_NUM_ITF,				/* bNumInterfaces */
+	0x01,							/* bConfigurationValue */
+	0x00,							/* iConfiguration */
+	0xC0,							/* bmAttributes: self powered */
+	0x32,							/* MaxPower 100 mA */
+
+	/* 09: interfaccia AudioControl */
+	0x09,							/* bLength */
+	USB_DESC_TYPE_INTERFACE,		/* bDescriptorType */
+	AUDIO_MIC_AC_ITF,				/* bInterfaceNumber */
+	0x00,							/* bAlternateSetting */
+	0x00,							/* bNumEndpoints */
+	0x01,							/* bInterfaceClass: Audio */
+	AUDIO_SUBCLASS_AUDIOCONTROL,	/* bInterfaceSubClass */
+	0x00,							/* bInterfaceProtocol */
+	0x00,							/* iInterface */
+	/* 18: Class-specific AC Interface Header */
+	0x09,							/* bLength */
+	AUDIO_INTERFACE_DESCRIPTOR_TYPE,	/* bDescriptorType: CS_INTERFACE */
+	AUDIO_CONTROL_HEADER,			/* bDescriptorSubtype: Header */
+	0x00,							/* bcdADC: 1.00 */
+	0x01,
+	LOBYTE(AUDIO_MIC_AC_DESC_SIZE),	/* wTotalLength */
+	HIBYTE(AUDIO_MIC_AC_DESC_SIZE),
+	0x01,							/* bInCollection */
+	AUDIO_MIC_AS_ITF,				/* baInterfaceNr(1) */
+	/* 27: Input Terminal, microfono */
+	0x0C,							/* bLength */
+	AUDIO_INTERFACE_DESCRIPTOR_TYPE,	/* bDescriptorType: CS_INTERFACE */
+	AUDIO_CONTROL_INPUT_TERMINAL,	/* bDescriptorSubtype: Input Terminal */
+	0x01,							/* bTerminalID */
+	LOBYTE(AUDIO_TERMINAL_MICROPHONE),	/* wTerminalType: Microphone */
+	HIBYTE(AUDIO_TERMINAL_MICROPHONE),
+	0x00,							/* bAssocTerminal */
+	AUDIO_MIC_CHANNELS,				/* bNrChannels */
+	0x00,							/* wChannelConfig: mono */
+	0x00,
+	0x00,							/* iChannelNames */
+	0x00,							/* iTerminal */
+	/* 39: Output Terminal, USB streaming */
+	0x09,							/* bLength */
+	AUDIO_INTERFACE_DESCRIPTOR_TYPE,	/* bDescriptorType: CS_INTERFACE */
+	AUDIO_CONTROL_OUTPUT_TERMINAL,	/* bDescriptorSubtype: Output Terminal */
+	0x02,							/* bTerminalID */
+	LOBYTE(AUDIO_TERMINAL_USB_STREAMING),	/* wTerminalType: USB Streaming */
+	HIBYTE(AUDIO_TERMINAL_USB_STREAMING),
+	0x00,							/* bAssocTerminal */
+	0x01,							/* bSourceID: Input Terminal */
+	0x00,							/* iTerminal */
+
+	/* 48: interfaccia AudioStreaming, alternate setting 0 (nessuna banda) */
+	0x09,							/* bLength */
+	USB_DESC_TYPE_INTERFACE,		/* bDescriptorType */
+	AUDIO_MIC_AS_ITF,				/* bInterfaceNumber */
+	0x00,							/* bAlternateSetting */
+	0x00,							/* bNumEndpoints */
+	0x01,							/* bInterfaceClass: Audio */
+	AUDIO_SUBCLASS_AUDIOSTREAMING,	/* bInterfaceSubClass */
+	0x00,							/* bInterfaceProtocol */
+	0x00,							/* iInterface */
+	/* 57: interfaccia AudioStreaming, alternate setting 1 (flusso PCM) */
+	0x09,							/* bLength */
+	USB_DESC_TYPE_INTERFACE,		/* bDescriptorType */
+	AUDIO_MIC_AS_ITF,				/* bInterfaceNumber */
+	0x01,							/* bAlternateSetting */
+	0x01,							/* bNumEndpoints */
+	0x01,							/* bInterfaceClass: Audio */
+	AUDIO_SUBCLASS_AUDIOSTREAMING,	/* bInterfaceSubClass */
+	0x00,							/* bInterfaceProtocol */
+	0x00,							/* iInterface */
+	/* 66: Class-specific AS General */
+	0x07,							/* bLength */
+	AUDIO_INTERFACE_DESCRIPTOR_TYPE,	/* bDescriptorType: CS_INTERFACE */
+	AUDIO_STREAMING_GENERAL,		/* bDescriptorSubtype: AS_GENERAL */
+	0x02,							/* bTerminalLink: Output Terminal */
+	0x01,							/* bDelay, in frame */
+	LOBYTE(AUDIO_FORMAT_PCM),		/* wFormatTag: PCM */
+	HIBYTE(AUDIO_FORMAT_PCM),
+	/* 73: Format Type I */
+	0x0B,							/* bLength */
+	AUDIO_INTERFACE_DESCRIPTOR_TYPE,	/* bDescriptorType: CS_INTERFACE */
+	AUDIO_STREAMING_FORMAT_TYPE,	/* bDescriptorSubtype: FORMAT_TYPE */
+	AUDIO_FORMAT_TYPE_I,			/* bFormatType */
+	AUDIO_MIC_CHANNELS,				/* bNrChannels */
+	AUDIO_MIC_SAMPLE_SIZE,			/* bSubFrameSize */
+	8 * AUDIO_MIC_SAMPLE_SIZE,		/* bBitResolution */
+	0x01,							/* bSamFreqType: una frequenza */
+	(uint8_t) (AUDIO_MIC_FREQ),		/* tSamFreq */
+	(uint8_t) (AUDIO_MIC_FREQ >> 8),
+	(uint8_t) (AUDIO_MIC_FREQ >> 16),
+	/* 84: endpoint isocrono IN (descrittore audio a 9 byte) */
+	0x09,							/* bLength */
+	USB_DESC_TYPE_ENDPOINT,			/* bDescriptorType */
+	AUDIO_MIC_EPIN_ADDR,			/* bEndpointAddress */
+	0x05,							/* bmAttributes: isochronous, asynchronous */
+	LOBYTE(AUDIO_MIC_EPIN_SIZE),	/* wMaxPacketSize */
+	HIBYTE(AUDIO_MIC_EPIN_SIZE),
+	0x01,							/* bInterval: 1 ms */
+	0x00,							/* bRefresh */
+	0x00,							/* bSynchAddress */
+	/* 93: Class-specific endpoint General */
+	0x07,							/* bLength */
+	AUDIO_ENDPOINT_DESCRIPTOR_TYPE,	/* bDescriptorType: CS_ENDPOINT */
+	AUDIO_ENDPOINT_GENERAL,			/* bDescriptorSubtype: EP_GENERAL */
+	0x00,							/* bmAttributes: nessun controllo */
+	0x00,							/* bLockDelayUnits */
+	0x00,							/* wLockDelay */
+	0x00,
+	/* 100 */
+};
+
+__ALIGN_BEGIN static uint8_t USBD_AUDIO_MIC_DeviceQualifierDesc[USB_LEN_DEV_QUALIFIER_DESC] __ALIGN_END = {
+	USB_LEN_DEV_QUALIFIER_DESC,
+	USB_DESC_TYPE_DEVICE_QUALIFIER,
+	0x00,
+	0x02,
+	0x00,
+	0x00,
+	0x00,
+	0x40,
+	0x01,
+	0x00,
+};
+
+static uint8_t USBD_AUDIO_MIC_Init(USBD_HandleTypeDef* pdev, uint8_t cfgidx) {
+	USBD_AUDIO_MIC_HandleTypeDef* hmic;
+
+	pdev->pClassData = USBD_malloc(sizeof(USBD_AUDIO_MIC_HandleTypeDef));
+	if (pdev->pClassData == NULL)
+		return USBD_FAIL;
+	hmic = (USBD_AUDIO_MIC_HandleTypeDef*) pdev->pClassData;
+	USBD_memset(hmic, 0, sizeof(USBD_AUDIO_MIC_HandleTypeDef));
+
+	USBD_LL_OpenEP(pdev, AUDIO_MIC_EPIN_ADDR, USBD_EP_TYPE_ISOC, AUDIO_MIC_EPIN_SIZE);
+	return USBD_OK;
+}
+
+static uint8_t USBD_AUDIO_MIC_DeInit(USBD_HandleTypeDef* pdev, uint8_t cfgidx) {
+	USBD_AUDIO_MIC_HandleTypeDef* hmic = (USBD_AUDIO_MIC_HandleTypeDef*) pdev->pClassData;
+
+	USBD_LL_CloseEP(pdev, AUDIO_MIC_EPIN_ADDR);
+	if (hmic != NULL) {
+		if (hmic->altSetting)
+			USBD_AUDIO_MIC_StreamCallback(pdev, 0);
+		USBD_free(pdev->pClassData);
+		pdev->pClassData = NULL;
+	}
+	return USBD_OK;
+}
+
+static uint8_t USBD_AUDIO_MIC_Setup(USBD_HandleTypeDef* pdev, USBD_SetupReqTypedef* req) {
+	USBD_AUDIO_MIC_HandleTypeDef* hmic = (USBD_AUDIO_MIC_HandleTypeDef*) pdev->pClassData;
+	uint8_t itf = LOBYTE(req->wIndex);
+
+	switch (req->bmRequest & USB_REQ_TYPE_MASK) {
+	case USB_REQ_TYPE_CLASS:
+		/* nessun controllo: SET_CUR/GET_CUR di volume, mute o frequenza non sono gestiti */
+		USBD_CtlError(pdev, req);
+		return USBD_FAIL;
+
+	case USB_REQ_TYPE_STANDARD:
+		switch (req->bRequest) {
+		case USB_REQ_GET_INTERFACE: {
+			static uint8_t altSetting;
+			altSetting = itf == AUDIO_MIC_AS_ITF ? hmic->altSetting : 0;
+			USBD_CtlSendData(pdev, &altSetting, 1);
+			break;
+		}
+
+		case USB_REQ_SET_INTERFACE:
+			if (itf != AUDIO_MIC_AS_ITF)
+				break;
+			if ((uint8_t) req->wValue > 1) {
+				USBD_CtlError(pdev, req);
+				return USBD_FAIL;
+			}
+			if (hmic->altSetting == (uint8_t) req->wValue)
+				break;
+			hmic->altSetting = (uint8_t) req->wValue;
+			/* il pacchetto eventualmente in attesa appartiene al flusso precedente */
+			USBD_LL_FlushEP(pdev, AUDIO_MIC_EPIN_ADDR);
+			hmic->busy = 0;
+			USBD_AUDIO_MIC_StreamCallback(pdev, hmic->altSetting);
+			break;
+		}
+	}
+	return USBD_OK;
+}
+
+static uint8_t USBD_AUDIO_MIC_DataIn(USBD_HandleTypeDef* pdev, uint8_t epnum) {
+	USBD_AUDIO_MIC_HandleTypeDef* hmic = (USBD_AUDIO_MIC_HandleTypeDef*) pdev->pClassData;
+
+	if (epnum == (AUDIO_MIC_EPIN_ADDR & 0x7F))
+		hmic->busy = 0;
+	return USBD_OK;
+}
+
+/**
+ * @details Il pacchetto caricato al SOF e' letto dall'host nel frame successivo: se il pacchetto precedente non e'
+ * 			ancora stato letto il SOF corrente viene saltato.
+ */
+static uint8_t USBD_AUDIO_MIC_SOF(USBD_HandleTypeDef* pdev) {
+	USBD_AUDIO_MIC_HandleTypeDef* hmic = (USBD_AUDIO_MIC_HandleTypeDef*) pdev->pClassData;
+
+	USBD_AUDIO_MIC_SOFCallback(pdev);
+	if (hmic == NULL || !hmic->altSetting || hmic->busy)
+		return USBD_OK;
+	uint32_t frames = USBD_AUDIO_MIC_PacketCallback(pdev, (int16_t*) hmic->packet, AUDIO_MIC_FRAMES_MAX);
+	if (frames > AUDIO_MIC_FRAMES_MAX)
+		frames = AUDIO_MIC_FRAMES_MAX;
+	hmic->busy = 1;
+	USBD_LL_Transmit(pdev, AUDIO_MIC_EPIN_ADDR, hmic->packet, frames * AUDIO_MIC_CHANNELS * AUDIO_MIC_SAMPLE_SIZE);
+	return USBD_OK;
+}
+
+/**
+ * @details L'host non ha letto il pacchetto nel frame in cui era atteso (per esempio per un token IN perso): il
+ * 			pacchetto viene scartato, liberando l'endpoint per il SOF successivo.
+ */
+static uint8_t USBD_AUDIO_MIC_IsoINIncomplete(USBD_HandleTypeDef* pdev, uint8_t epnum) {
+	USBD_AUDIO_MIC_HandleTypeDef* hmic = (USBD_AUDIO_MIC_HandleTypeDef*) pdev->pClassData;
+
+	if (hmic == NULL || !hmic->busy)
+		return USBD_OK;
+	USBD_LL_FlushEP(pdev, AUDIO_MIC_EPIN_ADDR);
+	hmic->busy = 0;
+	hmic->incomplete++;
+	return USBD_OK;
+}
+
+static uint8_t* USBD_AUDIO_MIC_GetCfgDesc(uint16_t* length) {
+	*length = sizeof(USBD_AUDIO_MIC_CfgDesc);
+	return USBD_AUDIO_MIC_CfgDesc;
+}
+
+static uint8_t* USBD_AUDIO_MIC_GetDeviceQualifierDesc(uint16_t* length) {
+	*length = sizeof(USBD_AUDIO_MIC_DeviceQualifierDesc);
+	return USBD_AUDIO_MIC_DeviceQualifierDesc;
+}
+
+uint8_t USBD_AUDIO_MIC_IsStreaming(USBD_HandleTypeDef* pdev) {
+	USBD_AUDIO_MIC_HandleTypeDef* hmic = (USBD_AUDIO_MIC_HandleTypeDef*) pdev->pClassData;
+
+	if (pdev->dev_state != USBD_STATE_CONFIGURED || hmic == NULL)
+		return 0;
+	return hmic->altSetting;
+}
+
+__weak void USBD_AUDIO_MIC_StreamCallback(USBD_HandleTypeDef* pdev, uint8_t active) {
+	/* da ridefinire nell'applicazione */
+}
+
+__weak uint32_t USBD_AUDIO_MIC_PacketCallback(USBD_HandleTypeDef* pdev, int16_t* pcm, uint32_t maxFrames) {
+	/* senza applicazione, silenzio alla frequenza nominale */
+	USBD_memset(pcm, 0, AUDIO_MIC_FRAMES_NOMINAL * AUDIO_MIC_CHANNELS * AUDIO_MIC_SAMPLE_SIZE);
+	return AUDIO_MIC_FRAMES_NOMINAL;
+}
+
+__weak void USBD_AUDIO_MIC_SOFCallback(USBD_HandleTypeDef* pdev) {
+	/* da ridefinire nell'applicazione */
+}
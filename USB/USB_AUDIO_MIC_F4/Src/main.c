@@ -0,0 +1,309 @@
+/**
+ * @file main.c
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include "stm32f4xx_hal.h"
+#include "usb_device.h"
+#include "stm32f4_discovery.h"
+#include "stm32f4_discovery_audio.h"
+#include "usbd_audio_mic.h"
+#include "uacsync.h"
+
+/**
+ * @defgroup USBD
+ * @{
+ * @defgroup AUDIO_MIC
+ * @{
+ * @defgroup Microfono
+ * @{
+ *
+ * @brief Realizzazione di un microfono USB (USB Audio Class 1.0) con il microfono MEMS della board.
+ *
+ * @details Il segnale PDM del microfono MP45DT02 e' acquisito tramite I2S2 e DMA (BSP_AUDIO_IN_Record()): ogni mezzo
+ * 			 buffer, cioe' ogni millisecondo, il decimatore (BSP_AUDIO_IN_PDMToPCM()) produce #PCM_OUT_SIZE campioni PCM
+ * 			 a 16 bit, che vengono accodati in #micSync. L'host preleva un pacchetto ad ogni SOF dall'endpoint isocrono
+ * 			 della classe USBD_AUDIO_MIC, che lo chiede a #micSync (vedi UACSYNC): la dimensione del pacchetto segue la
+ * 			 frequenza effettiva del clock I2S, in modo che il flusso non si sposti rispetto al clock USB.<br>
+ * 			 La frequenza di campionamento e' di 16 kHz; per acquisire a 48 kHz occorre definire, nelle impostazioni di
+ * 			 compilazione, sia DEFAULT_AUDIO_IN_FREQ sia AUDIO_MIC_FREQ a 48000.<br>
+ * 			 Il clock di sistema e' ricavato dall'HSE con PLLM = 8, cioe' con l'ingresso a 1 MHz dei PLL che la
+ * 			 configurazione del PLLI2S del BSP presuppone.<br>
+ * 			 Led:
+ * 			 - verde (LED4): flusso aperto dall'host;
+ * 			 - rosso (LED5): campioni persi o pacchetti completati con silenzio dall'apertura del flusso.
+ */
+
+#if AUDIO_MIC_FREQ != DEFAULT_AUDIO_IN_FREQ
+#error "AUDIO_MIC_FREQ e DEFAULT_AUDIO_IN_FREQ devono coincidere"
+#endif
+
+/**
+ * @brief Livello obiettivo di #micSync, in frame: tre blocchi del decimatore, cioe' 3 ms di latenza.
+ * @details Un blocco puo' arrivare un SOF dopo l'altro, per cui il livello deve coprire due blocchi piu' un frame.
+ */
+#define MIC_SYNC_TARGET		(3 * PCM_OUT_SIZE)
+
+/* Private function prototypes -----------------------------------------------*/
+/**
+ * @brief System Clock Configuration
+*/
+void SystemClock_Config(void);
+/**
+ * @brief Funzione di configurazione ed inizializzazione delle periferiche GPIO utilizzate.
+ */
+static void MX_GPIO_Init(void);
+/**
+ * @brief Funzione di inizializzazione.<br>
+ *
+ * @details E' la prima funzione ad essere eseguita nel main program. Si occupa di:
+ * 			 - inizializzare la libreria HAL;
+ * 			 - configurare il system clock;
+ * 			 - inizializzare e configurare tutte le periferiche utilizzate;
+ * 			 - avviare l'acquisizione dal microfono, che resta attiva anche a flusso chiuso.
+ */
+void setup(void);
+/**
+ * @brief Funzione che implementa la logica del programma.<br>
+ *
+ * @details L'acquisizione e la trasmissione avvengono interamente nelle interruzioni del DMA e del core USB: il main
+ * 			 loop aggiorna i led e resta in sleep fino all'interruzione successiva.
+ */
+void loop(void);
+
+/**
+ * @brief Converte in PCM un mezzo buffer PDM e accoda i campioni in #micSync, se il flusso e' aperto.
+ * @param[in] pdm mezzo buffer PDM appena riempito dal DMA
+ */
+static void MIC_Capture(uint16_t* pdm);
+
+/**
+ * @brief Callback di meta' trasferimento del DMA di I2S2: la prima meta' di #pdmBuffer e' pronta.
+ */
+void BSP_AUDIO_IN_HalfTransfer_CallBack(void);
+
+/**
+ * @brief Callback di fine trasferimento del DMA di I2S2: la seconda meta' di #pdmBuffer e' pronta.
+ */
+void BSP_AUDIO_IN_TransferComplete_CallBack(void);
+
+/**
+ * @brief Callback di apertura e chiusura del flusso da parte dell'host: all'apertura #micSync riparte vuoto.
+ * @param[in] pdev handle del device USB
+ * @param[in] active 1 all'apertura, 0 alla chiusura
+ */
+void USBD_AUDIO_MIC_StreamCallback(USBD_HandleTypeDef *pdev, uint8_t active);
+
+/**
+ * @brief Callback associata al SOF: preleva da #micSync il pacchetto del frame.
+ * @param[in] pdev handle del device USB
+ * @param[out] pcm campioni del pacchetto
+ * @param[in] maxFrames dimensione massima del pacchetto
+ * @return numero di campioni del pacchetto
+ */
+uint32_t USBD_AUDIO_MIC_PacketCallback(USBD_HandleTypeDef *pdev, int16_t *pcm, uint32_t maxFrames);
+
+uint16_t pdmBuffer[INTERNAL_BUFF_SIZE];		//!< Buffer PDM riempito dal DMA di I2S2, in due meta' da 1 ms
+uint16_t pcmBuffer[PCM_OUT_SIZE * 2];		//!< Uscita del decimatore, stereo: il microfono occupa il canale sinistro
+UACSYNC_t micSync;							//!< Campioni in attesa di trasmissione e regolatore della dimensione dei pacchetti
+volatile uint8_t micActive;					//!< 1 se il flusso e' aperto dall'host
+
+int main(void)
+{
+	setup();
+    for(;;) loop();
+    return 1;
+}
+
+void setup(void){
+/* Reset of all peripherals, Initializes the Flash interface and the Systick. */
+  HAL_Init();
+
+  /* Configure the system clock */
+  SystemClock_Config();
+
+  /* Initialize all configured peripherals */
+  MX_GPIO_Init();
+  for(int i=0;i<LEDn;i++)
+	  BSP_LED_Init(i);
+
+  micActive = 0;
+  UACSYNC_Init(&micSync, AUDIO_MIC_CHANNELS, AUDIO_MIC_FREQ, 1000, MIC_SYNC_TARGET);
+  if (BSP_AUDIO_IN_Init(DEFAULT_AUDIO_IN_FREQ, DEFAULT_AUDIO_IN_BIT_RESOLUTION, DEFAULT_AUDIO_IN_CHANNEL_NBR) != AUDIO_OK ||
+	  BSP_AUDIO_IN_Record(pdmBuffer, INTERNAL_BUFF_SIZE) != AUDIO_OK)
+  {
+    _Error_Handler(__FILE__, __LINE__);
+  }
+  MX_USB_DEVICE_Init();
+}
+
+void loop(void){
+	__WFI();
+	micActive ? BSP_LED_On(LED4) : BSP_LED_Off(LED4);
+	(micSync.stats.underruns || micSync.stats.overruns) ? BSP_LED_On(LED5) : BSP_LED_Off(LED5);
+}
+
+static void MIC_Capture(uint16_t* pdm){
+	BSP_AUDIO_IN_PDMToPCM(pdm, pcmBuffer);
+	if (micActive)
+		UACSYNC_Write(&micSync, (int16_t*)pcmBuffer, PCM_OUT_SIZE, 2);
+}
+
+void BSP_AUDIO_IN_HalfTransfer_CallBack(void){
+	MIC_Capture(&pdmBuffer[0]);
+}
+
+void BSP_AUDIO_IN_TransferComplete_CallBack(void){
+	MIC_Capture(&pdmBuffer[INTERNAL_BUFF_SIZE / 2]);
+}
+
+void USBD_AUDIO_MIC_StreamCallback(USBD_HandleTypeDef *pdev, uint8_t active){
+	micActive = 0;
+	if (active){
+		/* il flusso riparte vuoto dalla frequenza nominale; i contatori restano per i led */
+		UACSYNC_Reset(&micSync);
+		micActive = 1;
+	}
+}
+
+uint32_t USBD_AUDIO_MIC_PacketCallback(USBD_HandleTypeDef *pdev, int16_t *pcm, uint32_t maxFrames){
+	return UACSYNC_Packet(&micSync, pcm, maxFrames);
+}
+
+
+void SystemClock_Config(void)
+{
+
+  RCC_OscInitTypeDef RCC_OscInitStruct;
+  RCC_ClkInitTypeDef RCC_ClkInitStruct;
+
+    /**Configure the main internal regulator output voltage 
+    */
+  __HAL_RCC_PWR_CLK_ENABLE();
+
+  __HAL_PWR_VOLTAGESCALING_CONFIG(PWR_REGULATOR_VOLTAGE_SCALE1);
+
+    /**Initializes the CPU, AHB and APB busses clocks: PLL input at 1 MHz,
+    as expected by the PLLI2S settings of the audio BSP
+    */
+  RCC_OscInitStruct.OscillatorType = RCC_OSCILLATORTYPE_HSE;
+  RCC_OscInitStruct.HSEState = RCC_HSE_ON;
+  RCC_OscInitStruct.PLL.PLLState = RCC_PLL_ON;
+  RCC_OscInitStruct.PLL.PLLSource = RCC_PLLSOURCE_HSE;
+  RCC_OscInitStruct.PLL.PLLM = 8;
+  RCC_OscInitStruct.PLL.PLLN = 336;
+  RCC_OscInitStruct.PLL.PLLP = RCC_PLLP_DIV2;
+  RCC_OscInitStruct.PLL.PLLQ = 7;
+  if (HAL_RCC_OscConfig(&RCC_OscInitStruct) != HAL_OK)
+  {
+    _Error_Handler(__FILE__, __LINE__);
+  }
+
+    /**Initializes the CPU, AHB and APB busses clocks 
+    */
+  RCC_ClkInitStruct.ClockType = RCC_CLOCKTYPE_HCLK|RCC_CLOCKTYPE_SYSCLK
+                              |RCC_CLOCKTYPE_PCLK1|RCC_CLOCKTYPE_PCLK2;
+  RCC_ClkInitStruct.SYSCLKSource = RCC_SYSCLKSOURCE_PLLCLK;
+  RCC_ClkInitStruct.AHBCLKDivider = RCC_SYSCLK_DIV1;
+  RCC_ClkInitStruct.APB1CLKDivider = RCC_HCLK_DIV4;
+  RCC_ClkInitStruct.APB2CLKDivider = RCC_HCLK_DIV2;
+
+  if (HAL_RCC_ClockConfig(&RCC_ClkInitStruct, FLASH_LATENCY_5) != HAL_OK)
+  {
+    _Error_Handler(__FILE__, __LINE__);
+  }
+
+    /**Configure the Systick interrupt time 
+    */
+  HAL_SYSTICK_Config(HAL_RCC_GetHCLKFreq()/1000);
+
+    /**Configure the Systick 
+    */
+  HAL_SYSTICK_CLKSourceConfig(SYSTICK_CLKSOURCE_HCLK);
+
+  /* SysTick_IRQn interrupt configuration */
+  HAL_NVIC_SetPriority(SysTick_IRQn, 0, 0);
+}
+
+/** Configure pins as 
+        * Analog 
+        * Input 
+        * Output
+        * EVENT_OUT
+        * EXTI
+*/
+static void MX_GPIO_Init(void)
+{
+
+  /* GPIO Ports Clock Enable */
+  __HAL_RCC_GPIOH_CLK_ENABLE();
+  __HAL_RCC_GPIOA_CLK_ENABLE();
+
+}
+
+/* USER CODE BEGIN 4 */
+
+/* USER CODE END 4 */
+
+/**
+  * @brief  This function is executed in case of error occurrence.
+  * @param  None
+  * @retval None
+  */
+void _Error_Handler(char * file, int line)
+{
+  /* USER CODE BEGIN Error_Handler_Debug */
+  /* User can add his own implementation to report the HAL error return state */
+  while(1) 
+  {
+  }
+  /* USER CODE END Error_Handler_Debug */ 
+}
+
+#ifdef USE_FULL_ASSERT
+
+/**
+   * @brief Reports the name of the source file and the source line number
+   * where the assert_param error has occurred.
+   * @param file: pointer to the source file name
+   * @param line: assert_param error line source number
+   * @retval None
+   */
+void assert_failed(uint8_t* file, uint32_t line)
+{
+  /* USER CODE BEGIN 6 */
+  /* User can add his own implementation to report the file name and line number,
+    ex: printf("Wrong parameters value: file %s on line %d\r\n", file, line) */
+  /* USER CODE END 6 */
+
+}
+
+#endif
+
+/**
+ * @} @} @}
+ */
+/**
+  * @}
+  */ 
+
+/**
+  * @}
+*/ 
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
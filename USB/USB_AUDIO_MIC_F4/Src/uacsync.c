@@ -0,0 +1,137 @@
+/**
+ * @file uacsync.c
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+#include "uacsync.h"
+#include <assert.h>
+#include <string.h>
+
+/**
+ * @brief Limite dell'errore di livello considerato dal regolatore, in frame, per non saturare l'integrale dopo un
+ * underrun o un overrun.
+ */
+#define UACSYNC_ERR_MAX		(UACSYNC_LENGTH / 4)
+
+void UACSYNC_Init(UACSYNC_t* s, uint8_t channels, uint32_t fs, uint32_t sofHz, uint16_t target) {
+	assert(s);
+	assert(channels > 0 && channels <= UACSYNC_MAX_CHANNELS);
+	assert(sofHz > 0 && target <= UACSYNC_LENGTH / 2);
+	memset(s, 0, sizeof(UACSYNC_t));
+	s->channels = channels;
+	s->target = target;
+	s->nominal = (uint32_t)(((uint64_t)fs << 16) / sofHz);
+	s->integral = (int32_t)s->nominal;
+}
+
+void UACSYNC_Write(UACSYNC_t* s, const int16_t* pcm, uint32_t frames, uint8_t stride) {
+	assert(s && pcm);
+	assert(stride >= s->channels);
+	uint32_t head = s->head;
+	uint32_t free = UACSYNC_LENGTH - (head - s->tail);
+	if (frames > free) {
+		s->stats.overruns += frames - free;
+		frames = free;
+	}
+	for (uint32_t n = 0; n < frames; n++, pcm += stride)
+		for (uint8_t c = 0; c < s->channels; c++)
+			s->frame[(head + n) & (UACSYNC_LENGTH - 1)][c] = pcm[c];
+	/* i frame sono gia' in memoria: solo ora diventano visibili al consumatore */
+	s->head = head + frames;
+}
+
+uint32_t UACSYNC_Packet(UACSYNC_t* s, int16_t* packet, uint32_t maxFrames) {
+	assert(s && packet);
+	uint32_t tail = s->tail;
+	uint32_t level = s->head - tail;
+	uint32_t nominal = s->nominal >> 16;
+	assert(maxFrames > nominal);
+
+	if (!s->running) {
+		/* attesa del livello obiettivo */
+		if (level < s->target)
+			return 0;
+		s->running = 1;
+		s->phase = 0;
+	}
+
+	/* regolatore PI: l'integrale stima la frequenza in frame per SOF, il proporzionale corregge il livello */
+	int32_t err = (int32_t)level - (int32_t)s->target;
+	if (err > UACSYNC_ERR_MAX)
+		err = UACSYNC_ERR_MAX;
+	else if (err < -UACSYNC_ERR_MAX)
+		err = -UACSYNC_ERR_MAX;
+	/* l'integrale e' limitato all'escursione di un endpoint asincrono, un frame attorno al nominale */
+	s->integral += (err * 65536) >> UACSYNC_KI_SHIFT;
+	if (s->integral > (int32_t)s->nominal + 0x10000)
+		s->integral = (int32_t)s->nominal + 0x10000;
+	else if (s->integral < (int32_t)s->nominal - 0x10000)
+		s->integral = (int32_t)s->nominal - 0x10000;
+	int32_t rate = s->integral + ((err * 65536) >> UACSYNC_KP_SHIFT);
+	if (rate < 0)
+		rate = 0;
+	s->phase += (uint32_t)rate;
+	uint32_t n = s->phase >> 16;
+	s->phase &= 0xFFFF;
+
+	/* un endpoint asincrono si discosta al piu' di un frame dal nominale */
+	if (n > nominal + 1) {
+		n = nominal + 1;
+		s->phase = 0xFFFF;
+	}
+	else if (n + 1 < nominal) {
+		n = nominal - 1;
+		s->phase = 0;
+	}
+	if (n > maxFrames)
+		n = maxFrames;
+	if (n > nominal)
+		s->stats.longPackets++;
+	else if (n < nominal)
+		s->stats.shortPackets++;
+
+	uint32_t avail = n < level ? n : level;
+	for (uint32_t k = 0; k < avail; k++, packet += s->channels)
+		memcpy(packet, s->frame[(tail + k) & (UACSYNC_LENGTH - 1)], s->channels * sizeof(int16_t));
+	s->tail = tail + avail;
+	if (avail < n) {
+		/* buffer vuoto: il pacchetto viene completato con silenzio e si attende di nuovo il livello obiettivo */
+		memset(packet, 0, (n - avail) * s->channels * sizeof(int16_t));
+		s->stats.underruns++;
+		s->running = 0;
+	}
+	s->stats.packets++;
+	s->stats.frames += n;
+	return n;
+}
+
+void UACSYNC_Reset(UACSYNC_t* s) {
+	assert(s);
+	s->running = 0;
+	s->tail = s->head;
+	s->integral = (int32_t)s->nominal;
+	s->phase = 0;
+}
+
+uint32_t UACSYNC_Level(const UACSYNC_t* s) {
+	assert(s);
+	return s->head - s->tail;
+}
+
+uint32_t UACSYNC_RateHz(const UACSYNC_t* s, uint32_t sofHz) {
+	assert(s);
+	return (uint32_t)(((uint64_t)(uint32_t)s->integral * sofHz + 0x8000) >> 16);
+}
@@ -0,0 +1,146 @@
+/**
+ * @file usbdesc.c
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "usbdesc.h"
+#include <assert.h>
+#include <string.h>
+
+#define USBDESC_EP_DIR_IN		0x80	//!< Bit di direzione nell'indirizzo di un endpoint
+#define USBDESC_EP_NUM_MASK		0x0F	//!< Numero dell'endpoint nell'indirizzo
+#define USBDESC_EP_TYPE_MASK	0x03	//!< Tipo di trasferimento in bmAttributes
+#define USBDESC_EP_ISOC			0x01	//!< Trasferimento isocrono
+#define USBDESC_EP_BULK			0x02	//!< Trasferimento bulk
+#define USBDESC_EP_INTR			0x03	//!< Trasferimento interrupt
+
+/**
+ * @brief Legge una word little endian.
+ */
+#define USBDESC_WORD(p)	((uint16_t) ((p)[0] | ((p)[1] << 8)))
+
+/**
+ * @brief Verifica un descrittore di endpoint e lo registra nelle maschere degli endpoint gia' usati.
+ */
+static USBDESC_Status_t USBDESC_CheckEndpoint(const uint8_t* ep, uint8_t* usedIn, uint8_t* usedOut) {
+	uint8_t num = ep[2] & USBDESC_EP_NUM_MASK;
+	uint8_t* used = (ep[2] & USBDESC_EP_DIR_IN) ? usedIn : usedOut;
+	uint8_t type = ep[3] & USBDESC_EP_TYPE_MASK;
+	uint16_t size = USBDESC_WORD(&ep[4]);
+
+	if (ep[0] < 7)
+		return USBDESC_ERR_LENGTH;
+	if (num == 0 || num >= USBDESC_MAX_EP || (*used & (1 << num)))
+		return USBDESC_ERR_ENDPOINT;
+	*used |= 1 << num;
+	if (type == USBDESC_EP_BULK && size != 8 && size != 16 && size != 32 && size != 64)
+		return USBDESC_ERR_PACKET;
+	if (type == USBDESC_EP_INTR && (size == 0 || size > USBDESC_FS_MAX_PACKET || ep[6] == 0))
+		return USBDESC_ERR_PACKET;
+	if (type == USBDESC_EP_ISOC && (size > USBDESC_FS_MAX_ISOC_PACKET || ep[6] != 1))
+		return USBDESC_ERR_PACKET;
+	return USBDESC_OK;
+}
+
+USBDESC_Status_t USBDESC_Validate(const uint8_t* cfg, uint16_t len) {
+	assert(cfg);
+	if (len < 9 || cfg[0] != 9 || cfg[1] != USBDESC_TYPE_CONFIGURATION)
+		return USBDESC_ERR_LENGTH;
+	if (USBDESC_WORD(&cfg[2]) != len)
+		return USBDESC_ERR_TOTAL;
+
+	uint8_t nInterface = cfg[4];
+	uint16_t seen = 0;			// interfacce (alternate setting 0) incontrate
+	uint8_t usedIn = 0, usedOut = 0;
+	int16_t endpoints = 0;		// endpoint ancora attesi per l'interfaccia corrente
+	USBDESC_Status_t status;
+	for (uint16_t i = cfg[0]; i < len; i += cfg[i]) {
+		const uint8_t* d = &cfg[i];
+		if (d[0] < 2 || i + d[0] > len)
+			return USBDESC_ERR_LENGTH;
+		switch (d[1]) {
+		case USBDESC_TYPE_INTERFACE:
+			if (d[0] < 9 || endpoints != 0 || d[2] >= nInterface || d[2] >= 16)
+				return USBDESC_ERR_INTERFACE;
+			if (d[3] == 0) {
+				if (seen & (1 << d[2]))
+					return USBDESC_ERR_INTERFACE;
+				seen |= 1 << d[2];
+			}
+			endpoints = d[4];
+			break;
+		case USBDESC_TYPE_ENDPOINT:
+			if (--endpoints < 0)
+				return USBDESC_ERR_INTERFACE;
+			status = USBDESC_CheckEndpoint(d, &usedIn, &usedOut);
+			if (status != USBDESC_OK)
+				return status;
+			break;
+		case USBDESC_TYPE_IAD:
+			if (d[0] < 8 || d[3] == 0 || d[2] + d[3] > nInterface)
+				return USBDESC_ERR_INTERFACE;
+			break;
+		}
+	}
+	if (endpoints != 0 || seen != (uint16_t) ((1 << nInterface) - 1))
+		return USBDESC_ERR_INTERFACE;
+	return USBDESC_OK;
+}
+
+USBDESC_Status_t USBDESC_PlanFifo(const uint8_t* cfg, uint16_t len, uint8_t ep0Size, USBDESC_Fifo_t* plan) {
+	assert(cfg);
+	assert(plan);
+	memset(plan, 0, sizeof(USBDESC_Fifo_t));
+
+	uint16_t maxPacket = ep0Size;
+	uint8_t nOut = 1;
+	plan->tx[0] = ep0Size / 4 > USBDESC_TXFIFO_MIN ? ep0Size / 4 : USBDESC_TXFIFO_MIN;
+	plan->nTx = 1;
+	for (uint16_t i = cfg[0]; i < len; i += cfg[i]) {
+		const uint8_t* d = &cfg[i];
+		if (d[1] != USBDESC_TYPE_ENDPOINT)
+			continue;
+		uint8_t num = d[2] & USBDESC_EP_NUM_MASK;
+		uint16_t size = USBDESC_WORD(&d[4]);
+		if (!(d[2] & USBDESC_EP_DIR_IN)) {
+			nOut++;
+			if (size > maxPacket)
+				maxPacket = size;
+			continue;
+		}
+		/* gli endpoint bulk e isocroni hanno spazio per due pacchetti, per caricare il successivo mentre l'host legge il
+		 * corrente: per un endpoint isocrono il pacchetto del frame successivo e' scritto prima che l'host abbia letto
+		 * quello del frame corrente */
+		uint16_t words = (size + 3) / 4;
+		if ((d[3] & USBDESC_EP_TYPE_MASK) == USBDESC_EP_BULK || (d[3] & USBDESC_EP_TYPE_MASK) == USBDESC_EP_ISOC)
+			words *= 2;
+		plan->tx[num] = words > USBDESC_TXFIFO_MIN ? words : USBDESC_TXFIFO_MIN;
+		if (num >= plan->nTx)
+			plan->nTx = num + 1;
+	}
+	/* RM0090: (5 * endpoint di controllo + 8) + (pacchetto piu' grande / 4 + 1) + 2 * endpoint OUT + 1 (global NAK) */
+	plan->rx = (5 + 8) + (maxPacket / 4 + 1) + 2 * nOut + 1;
+
+	plan->used = plan->rx;
+	for (uint8_t i = 0; i < plan->nTx; i++)
+		plan->used += plan->tx[i];
+	if (plan->used > USBDESC_FIFO_WORDS)
+		return USBDESC_ERR_FIFO;
+	plan->rx += USBDESC_FIFO_WORDS - plan->used;
+	plan->used = USBDESC_FIFO_WORDS;
+	return USBDESC_OK;
+}
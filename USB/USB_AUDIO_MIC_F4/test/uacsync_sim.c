@@ -0,0 +1,176 @@
+/**
+ * @file uacsync_sim.c
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+/**
+ * @brief Simulazione su host del regolatore UACSYNC con il clock del microfono diverso dal clock USB.
+ *
+ * @details
+ * Riproduce la configurazione di main.c: il decimatore produce un blocco di PCM_OUT_SIZE frame (fs / 1000) per
+ * periodo del clock di I2S, scritto con UACSYNC_Write() su un buffer stereo, e l'host chiede un pacchetto a ogni SOF,
+ * a 1 kHz esatti, con livello obiettivo di tre blocchi. Il periodo dei blocchi e' spostato della deriva in prova e,
+ * se richiesto, ogni blocco arriva con un ritardo casuale (la latenza dell'interruzione del DMA e del decimatore).
+ * Ogni frame contiene un contatore: i frame trasmessi devono crescere di 1, per cui ogni campione perso o duplicato
+ * e' un buco. Sono verificati, a 16 e 48 kHz, per derive da -5000 a +5000 ppm con e senza ritardi casuali:
+ *  - nessun underrun, overrun o buco dopo l'avvio;
+ *  - pacchetti di nominale, nominale + 1 o nominale - 1 frame;
+ *  - frame trasmessi in media uguali a quelli prodotti, a meno del livello del buffer;
+ *  - pacchetti lunghi e corti in egual numero con i clock uguali e senza ritardi.
+ * Una prova a parte cambia la deriva da -300 a +300 ppm a meta' simulazione, come una deriva termica, senza buchi.
+ * Per ogni prova sono riportati l'escursione del livello vista dal regolatore e la frequenza stimata da
+ * UACSYNC_RateHz() nella seconda meta' della prova, media e come escursione: i blocchi arrivano a gruppi di fs / 1000
+ * frame, per cui l'integrale oscilla attorno alla frequenza reale, e la media deve coincidere con essa.
+ * @code
+ * gcc -std=gnu99 -O2 -Wall -Wextra -IInc test/uacsync_sim.c Src/uacsync.c -o uacsync_sim && ./uacsync_sim
+ * @endcode
+ */
+#include "uacsync.h"
+#include <stdio.h>
+#include <string.h>
+
+#define SOF_HZ			1000		//!< SOF a full speed
+#define SIM_SECONDS		300			//!< durata simulata di ogni prova
+#define JITTER_US		300			//!< ritardo massimo di un blocco, in us
+
+static int failures = 0;
+
+#define CHECK(cond) do { if (!(cond)) { printf("%s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+/**
+ * @brief Generatore pseudo-casuale xorshift, per rendere la simulazione riproducibile.
+ */
+static uint32_t rng = 12345;
+static uint32_t Random(void) {
+	rng ^= rng << 13;
+	rng ^= rng >> 17;
+	rng ^= rng << 5;
+	return rng;
+}
+
+/**
+ * @brief Risultato di una prova.
+ */
+typedef struct {
+	UACSYNC_Stats_t stats;		//!< contatori del flusso
+	uint32_t glitches;			//!< frame persi o duplicati dopo l'avvio
+	uint32_t badSizes;			//!< pacchetti con piu' di un frame di scarto dal nominale
+	uint64_t produced;			//!< frame prodotti
+	uint32_t levelMin;			//!< livello minimo a regime
+	uint32_t levelMax;			//!< livello massimo a regime
+	double rateAvg;				//!< media della frequenza stimata a regime (Hz)
+	uint32_t rateMin;			//!< minimo della frequenza stimata a regime (Hz)
+	uint32_t rateMax;			//!< massimo della frequenza stimata a regime (Hz)
+} Result_t;
+
+/**
+ * @brief Simula un flusso.
+ * @param[in] fs frequenza di campionamento nominale (Hz)
+ * @param[in] ppm deriva del clock di I2S nella prima meta' della prova
+ * @param[in] ppm2 deriva nella seconda meta'
+ * @param[in] jitter 1 per ritardare i blocchi di un tempo casuale fino a JITTER_US
+ */
+static Result_t Run(uint32_t fs, double ppm, double ppm2, int jitter) {
+	static UACSYNC_t s;
+	static int16_t block[2 * 48], packet[2 * 50];
+	const uint32_t frames = fs / SOF_HZ;
+	Result_t r;
+	memset(&r, 0, sizeof(r));
+	r.levelMin = r.rateMin = UINT32_MAX;
+	UACSYNC_Init(&s, 1, fs, SOF_HZ, (uint16_t) (3 * frames));
+	double next = 0, delay = 0;
+	int16_t counter = 0, expect = 0;
+	int started = 0;
+	for (uint32_t k = 0; k < SIM_SECONDS * SOF_HZ; k++) {
+		double t = (double) k / SOF_HZ;
+		double period = frames / (fs * (1 + (k < SIM_SECONDS * SOF_HZ / 2 ? ppm : ppm2) * 1e-6));
+		while (next + delay <= t) {
+			for (uint32_t i = 0; i < frames; i++, counter++) {
+				block[2 * i] = counter;
+				block[2 * i + 1] = 0x7777;
+			}
+			UACSYNC_Write(&s, block, frames, 2);
+			r.produced += frames;
+			next += period;
+			delay = jitter ? (Random() % (JITTER_US + 1)) * 1e-6 : 0;
+		}
+		uint32_t level = UACSYNC_Level(&s);
+		if (k >= SIM_SECONDS * SOF_HZ / 2) {
+			if (level < r.levelMin)
+				r.levelMin = level;
+			if (level > r.levelMax)
+				r.levelMax = level;
+		}
+		uint32_t n = UACSYNC_Packet(&s, packet, frames + 2);
+		if (n) {
+			if (!started) {
+				started = 1;
+				expect = packet[0];
+			}
+			for (uint32_t i = 0; i < n; i++, expect++)
+				if (packet[i] != expect) {
+					r.glitches++;
+					expect = packet[i];
+				}
+			if (n > frames + 1 || n + 1 < frames)
+				r.badSizes++;
+		}
+		if (k >= SIM_SECONDS * SOF_HZ * 3 / 4) {
+			uint32_t rate = UACSYNC_RateHz(&s, SOF_HZ);
+			r.rateAvg += rate;
+			if (rate < r.rateMin)
+				r.rateMin = rate;
+			if (rate > r.rateMax)
+				r.rateMax = rate;
+		}
+	}
+	r.stats = s.stats;
+	r.rateAvg /= SIM_SECONDS * SOF_HZ / 4;
+	return r;
+}
+
+/**
+ * @brief Stampa e verifica il risultato di una prova.
+ */
+static void Check(uint32_t fs, double ppm, double ppm2, int jitter) {
+	Result_t r = Run(fs, ppm, ppm2, jitter);
+	double expected = fs * (1 + ppm2 * 1e-6);
+	printf("%5u Hz %+5.0f/%+5.0f ppm %s: livello [%3u, %3u] (obiettivo %3u), stima %8.1f Hz [%5u, %5u] "
+			"(reale %7.1f), lunghi %5u, corti %5u, underrun %u, overrun %u, buchi %u\n", fs, ppm, ppm2,
+			jitter ? "con ritardi  " : "senza ritardi", r.levelMin, r.levelMax, 3 * fs / SOF_HZ, r.rateAvg, r.rateMin,
+			r.rateMax, expected, r.stats.longPackets, r.stats.shortPackets, r.stats.underruns, r.stats.overruns,
+			r.glitches);
+	CHECK(r.stats.underruns == 0 && r.stats.overruns == 0);
+	CHECK(r.glitches == 0 && r.badSizes == 0);
+	CHECK(r.produced - r.stats.frames <= UACSYNC_LENGTH);
+	CHECK(r.rateAvg > expected - 1 && r.rateAvg < expected + 1);
+	if (ppm == 0 && ppm2 == 0 && !jitter)
+		CHECK(r.stats.longPackets == r.stats.shortPackets);
+}
+
+int main(void) {
+	static const double offsets[] = { 0, 100, -100, 500, -500, 1000, -1000, 5000, -5000 };
+	static const uint32_t rates[] = { 16000, 48000 };
+	for (size_t i = 0; i < sizeof(rates) / sizeof(rates[0]); i++)
+		for (size_t j = 0; j < sizeof(offsets) / sizeof(offsets[0]); j++)
+			for (int jitter = 0; jitter <= 1; jitter++)
+				Check(rates[i], offsets[j], offsets[j], jitter);
+	for (size_t i = 0; i < sizeof(rates) / sizeof(rates[0]); i++)
+		Check(rates[i], -300, 300, 1);
+
+	printf("uacsync_sim: %s\n", failures ? "FAILED" : "OK");
+	return failures != 0;
+}
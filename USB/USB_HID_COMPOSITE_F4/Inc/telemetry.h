@@ -0,0 +1,108 @@
+/**
+ * @file telemetry.h
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef TELEMETRY_H_
+#define TELEMETRY_H_
+
+/**
+ * @addtogroup USBD
+ * @{
+ * @addtogroup COMPOSITE
+ * @{
+ * @defgroup TELEMETRY
+ * @{
+ *
+ * @brief Flusso dei campioni grezzi dell'accelerometro sulla porta seriale virtuale.
+ *
+ * @details
+ * I campioni sono impacchettati in pacchetti da TELEMETRY_PACKET_SIZE byte, pari al pacchetto bulk a full speed, in modo
+ * che ogni trasferimento occupi esattamente un pacchetto. Un campione e' composto, in little endian, da un numero di
+ * sequenza a 16 bit e dalle tre componenti dell'accelerazione: l'host puo' quindi rilevare i campioni persi dai salti
+ * del numero di sequenza.<br>
+ * Il modulo usa due buffer: mentre uno e' in trasmissione, l'altro viene riempito. Se l'host non legge abbastanza in
+ * fretta, il pacchetto completo resta in attesa e i campioni successivi sono scartati (e contati in dropped) fino al
+ * completamento della trasmissione in corso; se la porta non e' aperta dall'host i pacchetti completi sono scartati.
+ *
+ * Come HIDQUEUE, il modulo non dipende dalla libreria HAL: la trasmissione e la mutua esclusione con l'interruzione USB
+ * sono fornite dall'applicazione in TELEMETRY_Init().
+ */
+
+#include <inttypes.h>
+
+#define TELEMETRY_PACKET_SIZE	64		//!< Dimensione di un pacchetto
+#define TELEMETRY_SAMPLE_SIZE	8		//!< Dimensione di un campione: sequenza, x, y, z
+#define TELEMETRY_SAMPLES		(TELEMETRY_PACKET_SIZE / TELEMETRY_SAMPLE_SIZE)	//!< Campioni per pacchetto
+
+/**
+ * @brief Funzione che avvia la trasmissione di un pacchetto.
+ * @return 0 se la trasmissione e' stata avviata, un valore diverso da 0 altrimenti
+ */
+typedef int (*TELEMETRY_Send_t)(void* ctx, uint8_t* packet, uint16_t len);
+
+/**
+ * @brief Struttura che rappresenta il flusso di telemetria.
+ */
+typedef struct {
+	uint8_t packet[2][TELEMETRY_PACKET_SIZE];	//!< buffer dei pacchetti
+	uint8_t fill;						//!< indice del buffer in riempimento
+	uint8_t count;						//!< campioni presenti nel buffer in riempimento
+	volatile uint8_t busy;				//!< 1 se l'altro buffer e' in trasmissione
+	volatile uint8_t ready;				//!< 1 se il buffer in riempimento e' completo e attende la trasmissione
+	uint16_t seq;						//!< numero di sequenza del prossimo campione
+	TELEMETRY_Send_t send;				//!< trasmissione di un pacchetto
+	void* ctx;							//!< argomento di send
+	void (*lock)(void);					//!< inizio della sezione critica rispetto all'interruzione USB
+	void (*unlock)(void);				//!< fine della sezione critica
+	uint32_t sent;						//!< pacchetti trasmessi
+	uint32_t dropped;					//!< campioni scartati
+} TELEMETRY_t;
+
+/**
+ * @brief Inizializza il flusso di telemetria.
+ * @param[inout] t puntatore al flusso
+ * @param[in] send funzione di trasmissione di un pacchetto
+ * @param[in] ctx argomento passato a send
+ * @param[in] lock funzione che disabilita l'interruzione USB
+ * @param[in] unlock funzione che riabilita l'interruzione USB
+ */
+void TELEMETRY_Init(TELEMETRY_t* t, TELEMETRY_Send_t send, void* ctx, void (*lock)(void), void (*unlock)(void));
+
+/**
+ * @brief Aggiunge un campione al flusso, trasmettendo il pacchetto quando e' completo.
+ * @param[inout] t puntatore al flusso
+ * @param[in] x componente x dell'accelerazione
+ * @param[in] y componente y dell'accelerazione
+ * @param[in] z componente z dell'accelerazione
+ */
+void TELEMETRY_Push(TELEMETRY_t* t, int16_t x, int16_t y, int16_t z);
+
+/**
+ * @brief Notifica il completamento della trasmissione di un pacchetto.
+ * @details Da chiamare al completamento della trasmissione sull'endpoint bulk IN, in contesto di interruzione.
+ * @param[inout] t puntatore al flusso
+ */
+void TELEMETRY_Sent(TELEMETRY_t* t);
+
+/**
+ * @}
+ * @}
+ * @}
+ */
+
+#endif /* TELEMETRY_H_ */
@@ -0,0 +1,168 @@
+/**
+ * @file usbd_composite.h
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef USBD_COMPOSITE_H_
+#define USBD_COMPOSITE_H_
+
+/**
+ * @addtogroup USBD
+ * @{
+ * @addtogroup COMPOSITE
+ * @{
+ * @defgroup USBD_COMPOSITE
+ * @{
+ *
+ * @brief Classe USB composita: tastiera e mouse HID e porta seriale virtuale CDC-ACM.
+ *
+ * @details
+ * Il dispositivo espone tre interfacce:
+ * | Interfaccia | Funzione                                        | Endpoint                                   |
+ * |-------------|-------------------------------------------------|--------------------------------------------|
+ * | 0           | HID, tastiera NKRO (report ID 1) e mouse (ID 2) | 0x81 interrupt IN, 16 byte, 1 ms           |
+ * | 1           | CDC-ACM, comunicazione                          | 0x82 interrupt IN, 8 byte (notifiche)      |
+ * | 2           | CDC-ACM, dati (telemetria dell'accelerometro)   | 0x03 bulk OUT, 0x83 bulk IN, 64 byte       |
+ *
+ * Le interfacce 1 e 2 sono raggruppate da un Interface Association Descriptor, per cui il dispositivo si dichiara di
+ * classe Miscellaneous (0xEF/0x02/0x01) nel device descriptor.<br>
+ * Il core OTG_FS dell'STM32F4 dispone di soli tre endpoint IN oltre a EP0: la funzione CDC ne richiede due, per cui
+ * tastiera e mouse condividono l'interfaccia HID e il relativo endpoint, distinguendosi per il report ID. L'interfaccia
+ * HID appartiene alla sottoclasse boot con protocollo tastiera: se l'host seleziona il boot protocol (SET_PROTOCOL 0)
+ * l'applicazione deve trasmettere il solo report boot della tastiera, senza report ID.<br>
+ * Le FIFO del core sono dimensionate in USBD_LL_Init() a partire dal descrittore di configurazione restituito dalla
+ * classe (vedi USBDESC).
+ */
+
+#include "usbd_ioreq.h"
+
+#define COMPOSITE_HID_ITF				0x00	//!< Interfaccia HID
+#define COMPOSITE_CDC_CMD_ITF			0x01	//!< Interfaccia di comunicazione CDC
+#define COMPOSITE_CDC_DATA_ITF			0x02	//!< Interfaccia dati CDC
+#define COMPOSITE_NUM_ITF				0x03	//!< Numero di interfacce
+
+#define COMPOSITE_HID_EPIN_ADDR			0x81	//!< Endpoint IN dei report HID
+#define COMPOSITE_HID_EPIN_SIZE			0x10	//!< Report NKRO (15 byte) preceduto dal report ID
+#define COMPOSITE_CDC_CMD_EP			0x82	//!< Endpoint delle notifiche CDC
+#define COMPOSITE_CDC_CMD_SIZE			0x08	//!< Dimensione di una notifica CDC
+#define COMPOSITE_CDC_OUT_EP			0x03	//!< Endpoint bulk OUT dei dati CDC
+#define COMPOSITE_CDC_IN_EP				0x83	//!< Endpoint bulk IN dei dati CDC
+#define COMPOSITE_CDC_DATA_SIZE			0x40	//!< Dimensione di un pacchetto bulk a full speed
+
+#define COMPOSITE_HID_FS_BINTERVAL		0x01	//!< Intervallo di polling dell'endpoint HID, in ms
+#define COMPOSITE_CDC_CMD_BINTERVAL		0x10	//!< Intervallo di polling dell'endpoint delle notifiche, in ms
+
+#define COMPOSITE_REPORT_ID_KEYBOARD	0x01	//!< Report ID della tastiera
+#define COMPOSITE_REPORT_ID_MOUSE		0x02	//!< Report ID del mouse
+
+#define COMPOSITE_CONFIG_DESC_SIZE		100		//!< Dimensione del descrittore di configurazione
+#define COMPOSITE_HID_DESC_SIZE			9		//!< Dimensione del descrittore HID
+#define COMPOSITE_HID_REPORT_DESC_SIZE	95		//!< Dimensione del report descriptor
+
+#define HID_DESCRIPTOR_TYPE				0x21
+#define HID_REPORT_DESC					0x22
+
+#define HID_REQ_SET_PROTOCOL			0x0B
+#define HID_REQ_GET_PROTOCOL			0x03
+#define HID_REQ_SET_IDLE				0x0A
+#define HID_REQ_GET_IDLE				0x02
+
+#define CDC_SET_LINE_CODING				0x20
+#define CDC_GET_LINE_CODING				0x21
+#define CDC_SET_CONTROL_LINE_STATE		0x22
+
+#define CDC_LINE_DTR					0x01	//!< Bit DTR di SET_CONTROL_LINE_STATE: porta aperta dall'host
+
+/**
+ * @brief Stato della classe composita, allocato all'apertura della configurazione.
+ */
+typedef struct {
+	uint8_t hidProtocol;				//!< 0 boot protocol, 1 report protocol
+	uint8_t hidIdle;					//!< idle rate impostato dall'host
+	volatile uint8_t hidBusy;			//!< 1 se un report e' in trasmissione
+	volatile uint8_t cdcBusy;			//!< 1 se un pacchetto CDC e' in trasmissione
+	volatile uint8_t cdcLineState;		//!< ultimo valore di SET_CONTROL_LINE_STATE
+	uint8_t cdcCmd;						//!< richiesta CDC in attesa della fase dati
+	uint8_t cdcLineCoding[7];			//!< line coding (baud rate, stop bit, parita', bit di dati)
+	uint8_t cdcRx[COMPOSITE_CDC_DATA_SIZE];	//!< buffer di ricezione dell'endpoint bulk OUT
+} USBD_COMPOSITE_HandleTypeDef;
+
+extern USBD_ClassTypeDef USBD_COMPOSITE;
+
+/**
+ * @brief Avvia la trasmissione di un report HID.
+ * @param[in] pdev device USB
+ * @param[in] report report, preceduto dal report ID se l'host usa il report protocol; deve restare valido fino al
+ * 			  completamento della trasmissione
+ * @param[in] len lunghezza del report
+ * @retval USBD_OK se la trasmissione e' stata avviata
+ * @retval USBD_BUSY se l'endpoint e' occupato dal report precedente
+ * @retval USBD_FAIL se il dispositivo non e' configurato
+ */
+uint8_t USBD_COMPOSITE_SendReport(USBD_HandleTypeDef* pdev, uint8_t* report, uint16_t len);
+
+/**
+ * @brief Restituisce il protocollo HID selezionato dall'host.
+ * @retval 0 boot protocol
+ * @retval 1 report protocol (anche se il dispositivo non e' ancora configurato)
+ */
+uint8_t USBD_COMPOSITE_GetProtocol(USBD_HandleTypeDef* pdev);
+
+/**
+ * @brief Avvia la trasmissione di un pacchetto sulla porta seriale virtuale.
+ * @param[in] pdev device USB
+ * @param[in] buf dati, che devono restare validi fino al completamento della trasmissione
+ * @param[in] len lunghezza, al piu' COMPOSITE_CDC_DATA_SIZE
+ * @retval USBD_OK se la trasmissione e' stata avviata
+ * @retval USBD_BUSY se l'endpoint e' occupato dal pacchetto precedente
+ * @retval USBD_FAIL se il dispositivo non e' configurato o la porta non e' aperta dall'host (DTR basso)
+ */
+uint8_t USBD_COMPOSITE_CDC_Transmit(USBD_HandleTypeDef* pdev, uint8_t* buf, uint16_t len);
+
+/**
+ * @brief Callback invocata, in contesto di interruzione, al completamento della trasmissione di un report HID.
+ */
+void USBD_COMPOSITE_ReportSentCallback(USBD_HandleTypeDef* pdev);
+
+/**
+ * @brief Callback invocata, in contesto di interruzione, al completamento della trasmissione di un pacchetto CDC.
+ */
+void USBD_COMPOSITE_CDC_TxCpltCallback(USBD_HandleTypeDef* pdev);
+
+/**
+ * @brief Callback invocata, in contesto di interruzione, alla ricezione di dati sulla porta seriale virtuale.
+ */
+void USBD_COMPOSITE_CDC_RxCallback(USBD_HandleTypeDef* pdev, uint8_t* buf, uint32_t len);
+
+/**
+ * @brief Callback invocata, in contesto di interruzione, ad ogni Start Of Frame.
+ */
+void USBD_COMPOSITE_SOFCallback(USBD_HandleTypeDef* pdev);
+
+/**
+ * @brief Callback invocata, in contesto di interruzione, alla deinizializzazione della classe (reset del bus,
+ * disconnessione o deconfigurazione): gli endpoint sono chiusi e i trasferimenti in corso non verranno completati.
+ */
+void USBD_COMPOSITE_DeInitCallback(USBD_HandleTypeDef* pdev);
+
+/**
+ * @}
+ * @}
+ * @}
+ */
+
+#endif /* USBD_COMPOSITE_H_ */
@@ -0,0 +1,492 @@
+/**
+ * @file usbd_composite.c
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "usbd_composite.h"
+#include "usbd_desc.h"
+#include "usbd_ctlreq.h"
+
+static uint8_t USBD_COMPOSITE_Init(USBD_HandleTypeDef* pdev, uint8_t cfgidx);
+static uint8_t USBD_COMPOSITE_DeInit(USBD_HandleTypeDef* pdev, uint8_t cfgidx);
+static uint8_t USBD_COMPOSITE_Setup(USBD_HandleTypeDef* pdev, USBD_SetupReqTypedef* req);
+static uint8_t USBD_COMPOSITE_EP0_RxReady(USBD_HandleTypeDef* pdev);
+static uint8_t USBD_COMPOSITE_DataIn(USBD_HandleTypeDef* pdev, uint8_t epnum);
+static uint8_t USBD_COMPOSITE_DataOut(USBD_HandleTypeDef* pdev, uint8_t epnum);
+static uint8_t USBD_COMPOSITE_SOF(USBD_HandleTypeDef* pdev);
+static uint8_t* USBD_COMPOSITE_GetCfgDesc(uint16_t* length);
+static uint8_t* USBD_COMPOSITE_GetDeviceQualifierDesc(uint16_t* length);
+
+USBD_ClassTypeDef USBD_COMPOSITE = {
+	USBD_COMPOSITE_Init,
+	USBD_COMPOSITE_DeInit,
+	USBD_COMPOSITE_Setup,
+	NULL, /*EP0_TxSent*/
+	USBD_COMPOSITE_EP0_RxReady,
+	USBD_COMPOSITE_DataIn,
+	USBD_COMPOSITE_DataOut,
+	USBD_COMPOSITE_SOF,
+	NULL,
+	NULL,
+	USBD_COMPOSITE_GetCfgDesc,
+	USBD_COMPOSITE_GetCfgDesc,
+	USBD_COMPOSITE_GetCfgDesc,
+	USBD_COMPOSITE_GetDeviceQualifierDesc,
+};
+
+/**
+ * @brief Descrittore di configurazione.
+ * @details E' l'unico elenco delle interfacce e degli endpoint del dispositivo: USBD_LL_Init() ne ricava le FIFO.
+ */
+__ALIGN_BEGIN static uint8_t USBD_COMPOSITE_CfgDesc[COMPOSITE_CONFIG_DESC_SIZE] __ALIGN_END = {
+	0x09,							/* bLength: Configuration Descriptor size */
+	USB_DESC_TYPE_CONFIGURATION,	/* bDescriptorType: Configuration */
+	LOBYTE(COMPOSITE_CONFIG_DESC_SIZE),	/* wTotalLength */
+	HIBYTE(COMPOSITE_CONFIG_DESC_SIZE),
+	COMPOSITE_NUM_ITF,				/* bNumInterfaces */
+	0x01,							/* bConfigurationValue */
+	0x00,							/* iConfiguration */
+	0xE0,							/* bmAttributes: self powered, remote wakeup */
+	0x32,							/* MaxPower 100 mA */
+
+	/* 09: interfaccia HID, boot keyboard */
+	0x09,							/* bLength */
+	USB_DESC_TYPE_INTERFACE,		/* bDescriptorType */
+	COMPOSITE_HID_ITF,				/* bInterfaceNumber */
+	0x00,							/* bAlternateSetting */
+	0x01,							/* bNumEndpoints */
+	0x03,							/* bInterfaceClass: HID */
+	0x01,							/* bInterfaceSubClass: boot */
+	0x01,							/* bInterfaceProtocol: keyboard */
+	0x00,							/* iInterface */
+	/* 18: descrittore HID */
+	0x09,							/* bLength */
+	HID_DESCRIPTOR_TYPE,			/* bDescriptorType: HID */
+	0x11,							/* bcdHID: 1.11 */
+	0x01,
+	0x00,							/* bCountryCode */
+	0x01,							/* bNumDescriptors */
+	HID_REPORT_DESC,				/* bDescriptorType: Report */
+	LOBYTE(COMPOSITE_HID_REPORT_DESC_SIZE),	/* wItemLength */
+	HIBYTE(COMPOSITE_HID_REPORT_DESC_SIZE),
+	/* 27: endpoint HID */
+	0x07,							/* bLength */
+	USB_DESC_TYPE_ENDPOINT,			/* bDescriptorType */
+	COMPOSITE_HID_EPIN_ADDR,		/* bEndpointAddress */
+	0x03,							/* bmAttributes: interrupt */
+	LOBYTE(COMPOSITE_HID_EPIN_SIZE),	/* wMaxPacketSize */
+	HIBYTE(COMPOSITE_HID_EPIN_SIZE),
+	COMPOSITE_HID_FS_BINTERVAL,		/* bInterval */
+
+	/* 34: Interface Association Descriptor della funzione CDC */
+	0x08,							/* bLength */
+	0x0B,							/* bDescriptorType: IAD */
+	COMPOSITE_CDC_CMD_ITF,			/* bFirstInterface */
+	0x02,							/* bInterfaceCount */
+	0x02,							/* bFunctionClass: CDC */
+	0x02,							/* bFunctionSubClass: ACM */
+	0x01,							/* bFunctionProtocol: AT commands */
+	0x00,							/* iFunction */
+	/* 42: interfaccia di comunicazione CDC */
+	0x09,							/* bLength */
+	USB_DESC_TYPE_INTERFACE,		/* bDescriptorType */
+	COMPOSITE_CDC_CMD_ITF,			/* bInterfaceNumber */
+	0x00,							/* bAlternateSetting */
+	0x01,							/* bNumEndpoints */
+	0x02,							/* bInterfaceClass: CDC */
+	0x02,							/* bInterfaceSubClass: ACM */
+	0x01,							/* bInterfaceProtocol: AT commands */
+	0x00,							/* iInterface */
+	/* 51: Header Functional Descriptor */
+	0x05,							/* bLength */
+	0x24,							/* bDescriptorType: CS_INTERFACE */
+	0x00,							/* bDescriptorSubtype: Header */
+	0x10,							/* bcdCDC: 1.10 */
+	0x01,
+	/* 56: Call Management Functional Descriptor */
+	0x05,							/* bLength */
+	0x24,							/* bDescriptorType: CS_INTERFACE */
+	0x01,							/* bDescriptorSubtype: Call Management */
+	0x00,							/* bmCapabilities */
+	COMPOSITE_CDC_DATA_ITF,			/* bDataInterface */
+	/* 61: ACM Functional Descriptor */
+	0x04,							/* bLength */
+	0x24,							/* bDescriptorType: CS_INTERFACE */
+	0x02,							/* bDescriptorSubtype: Abstract Control Management */
+	0x02,							/* bmCapabilities: line coding e control line state */
+	/* 65: Union Functional Descriptor */
+	0x05,							/* bLength */
+	0x24,							/* bDescriptorType: CS_INTERFACE */
+	0x06,							/* bDescriptorSubtype: Union */
+	COMPOSITE_CDC_CMD_ITF,			/* bMasterInterface */
+	COMPOSITE_CDC_DATA_ITF,			/* bSlaveInterface0 */
+	/* 70: endpoint delle notifiche */
+	0x07,							/* bLength */
+	USB_DESC_TYPE_ENDPOINT,			/* bDescriptorType */
+	COMPOSITE_CDC_CMD_EP,			/* bEndpointAddress */
+	0x03,							/* bmAttributes: interrupt */
+	LOBYTE(COMPOSITE_CDC_CMD_SIZE),	/* wMaxPacketSize */
+	HIBYTE(COMPOSITE_CDC_CMD_SIZE),
+	COMPOSITE_CDC_CMD_BINTERVAL,	/* bInterval */
+
+	/* 77: interfaccia dati CDC */
+	0x09,							/* bLength */
+	USB_DESC_TYPE_INTERFACE,		/* bDescriptorType */
+	COMPOSITE_CDC_DATA_ITF,			/* bInterfaceNumber */
+	0x00,							/* bAlternateSetting */
+	0x02,							/* bNumEndpoints */
+	0x0A,							/* bInterfaceClass: CDC Data */
+	0x00,							/* bInterfaceSubClass */
+	0x00,							/* bInterfaceProtocol */
+	0x00,							/* iInterface */
+	/* 86: endpoint bulk OUT */
+	0x07,							/* bLength */
+	USB_DESC_TYPE_ENDPOINT,			/* bDescriptorType */
+	COMPOSITE_CDC_OUT_EP,			/* bEndpointAddress */
+	0x02,							/* bmAttributes: bulk */
+	LOBYTE(COMPOSITE_CDC_DATA_SIZE),	/* wMaxPacketSize */
+	HIBYTE(COMPOSITE_CDC_DATA_SIZE),
+	0x00,							/* bInterval */
+	/* 93: endpoint bulk IN */
+	0x07,							/* bLength */
+	USB_DESC_TYPE_ENDPOINT,			/* bDescriptorType */
+	COMPOSITE_CDC_IN_EP,			/* bEndpointAddress */
+	0x02,							/* bmAttributes: bulk */
+	LOBYTE(COMPOSITE_CDC_DATA_SIZE),	/* wMaxPacketSize */
+	HIBYTE(COMPOSITE_CDC_DATA_SIZE),
+	0x00,							/* bInterval */
+	/* 100 */
+};
+
+/**
+ * @brief Descrittore HID, restituito anche su richiesta esplicita dell'host.
+ */
+__ALIGN_BEGIN static uint8_t USBD_COMPOSITE_HidDesc[COMPOSITE_HID_DESC_SIZE] __ALIGN_END = {
+	0x09,							/* bLength */
+	HID_DESCRIPTOR_TYPE,			/* bDescriptorType: HID */
+	0x11,							/* bcdHID: 1.11 */
+	0x01,
+	0x00,							/* bCountryCode */
+	0x01,							/* bNumDescriptors */
+	HID_REPORT_DESC,				/* bDescriptorType: Report */
+	LOBYTE(COMPOSITE_HID_REPORT_DESC_SIZE),	/* wItemLength */
+	HIBYTE(COMPOSITE_HID_REPORT_DESC_SIZE),
+};
+
+/**
+ * @brief Report descriptor: tastiera NKRO (report ID 1) e mouse relativo a 3 pulsanti (report ID 2).
+ */
+__ALIGN_BEGIN static uint8_t USBD_COMPOSITE_ReportDesc[COMPOSITE_HID_REPORT_DESC_SIZE] __ALIGN_END = {
+	0x05, 0x01,        // Usage Page (Generic Desktop Ctrls)
+	0x09, 0x06,        // Usage (Keyboard)
+	0xA1, 0x01,        // Collection (Application)
+	0x85, COMPOSITE_REPORT_ID_KEYBOARD,	//   Report ID (1)
+	0x05, 0x07,        //   Usage Page (Kbrd/Keypad)
+	0x19, 0xE0,        //   Usage Minimum (0xE0)
+	0x29, 0xE7,        //   Usage Maximum (0xE7)
+	0x15, 0x00,        //   Logical Minimum (0)
+	0x25, 0x01,        //   Logical Maximum (1)
+	0x75, 0x01,        //   Report Size (1)
+	0x95, 0x08,        //   Report Count (8)
+	0x81, 0x02,        //   Input (Data,Var,Abs)
+	0x75, 0x08,        //   Report Size (8)
+	0x95, 0x01,        //   Report Count (1)
+	0x81, 0x01,        //   Input (Const,Array,Abs)
+	0x19, 0x00,        //   Usage Minimum (0x00)
+	0x29, 0x67,        //   Usage Maximum (0x67)
+	0x75, 0x01,        //   Report Size (1)
+	0x95, 0x68,        //   Report Count (104)
+	0x81, 0x02,        //   Input (Data,Var,Abs)
+	0xC0,              // End Collection
+
+	0x05, 0x01,        // Usage Page (Generic Desktop Ctrls)
+	0x09, 0x02,        // Usage (Mouse)
+	0xA1, 0x01,        // Collection (Application)
+	0x85, COMPOSITE_REPORT_ID_MOUSE,	//   Report ID (2)
+	0x09, 0x01,        //   Usage (Pointer)
+	0xA1, 0x00,        //   Collection (Physical)
+	0x05, 0x09,        //     Usage Page (Button)
+	0x19, 0x01,        //     Usage Minimum (0x01)
+	0x29, 0x03,        //     Usage Maximum (0x03)
+	0x15, 0x00,        //     Logical Minimum (0)
+	0x25, 0x01,        //     Logical Maximum (1)
+	0x95, 0x03,        //     Report Count (3)
+	0x75, 0x01,        //     Report Size (1)
+	0x81, 0x02,        //     Input (Data,Var,Abs)
+	0x95, 0x01,        //     Report Count (1)
+	0x75, 0x05,        //     Report Size (5)
+	0x81, 0x01,        //     Input (Const,Array,Abs)
+	0x05, 0x01,        //     Usage Page (Generic Desktop Ctrls)
+	0x09, 0x30,        //     Usage (X)
+	0x09, 0x31,        //     Usage (Y)
+	0x09, 0x38,        //     Usage (Wheel)
+	0x15, 0x81,        //     Logical Minimum (-127)
+	0x25, 0x7F,        //     Logical Maximum (127)
+	0x75, 0x08,        //     Report Size (8)
+	0x95, 0x03,        //     Report Count (3)
+	0x81, 0x06,        //     Input (Data,Var,Rel)
+	0xC0,              //   End Collection
+	0xC0,              // End Collection
+};
+
+__ALIGN_BEGIN static uint8_t USBD_COMPOSITE_DeviceQualifierDesc[USB_LEN_DEV_QUALIFIER_DESC] __ALIGN_END = {
+	USB_LEN_DEV_QUALIFIER_DESC,
+	USB_DESC_TYPE_DEVICE_QUALIFIER,
+	0x00,
+	0x02,
+	0x00,
+	0x00,
+	0x00,
+	0x40,
+	0x01,
+	0x00,
+};
+
+/**
+ * @brief Line coding di default: 115200 baud, 1 stop bit, nessuna parita', 8 bit di dati.
+ * @details Su una porta seriale virtuale il line coding non ha effetto sulla velocita' di trasferimento; viene solo
+ * 			memorizzato e restituito all'host.
+ */
+static const uint8_t USBD_COMPOSITE_DefaultLineCoding[7] = { 0x00, 0xC2, 0x01, 0x00, 0x00, 0x00, 0x08 };
+
+static uint8_t USBD_COMPOSITE_Init(USBD_HandleTypeDef* pdev, uint8_t cfgidx) {
+	USBD_COMPOSITE_HandleTypeDef* hcmp;
+
+	pdev->pClassData = USBD_malloc(sizeof(USBD_COMPOSITE_HandleTypeDef));
+	if (pdev->pClassData == NULL)
+		return USBD_FAIL;
+	hcmp = (USBD_COMPOSITE_HandleTypeDef*) pdev->pClassData;
+	USBD_memset(hcmp, 0, sizeof(USBD_COMPOSITE_HandleTypeDef));
+	hcmp->hidProtocol = 1;
+	USBD_memcpy(hcmp->cdcLineCoding, USBD_COMPOSITE_DefaultLineCoding, sizeof(hcmp->cdcLineCoding));
+
+	USBD_LL_OpenEP(pdev, COMPOSITE_HID_EPIN_ADDR, USBD_EP_TYPE_INTR, COMPOSITE_HID_EPIN_SIZE);
+	USBD_LL_OpenEP(pdev, COMPOSITE_CDC_CMD_EP, USBD_EP_TYPE_INTR, COMPOSITE_CDC_CMD_SIZE);
+	USBD_LL_OpenEP(pdev, COMPOSITE_CDC_OUT_EP, USBD_EP_TYPE_BULK, COMPOSITE_CDC_DATA_SIZE);
+	USBD_LL_OpenEP(pdev, COMPOSITE_CDC_IN_EP, USBD_EP_TYPE_BULK, COMPOSITE_CDC_DATA_SIZE);
+	USBD_LL_PrepareReceive(pdev, COMPOSITE_CDC_OUT_EP, hcmp->cdcRx, COMPOSITE_CDC_DATA_SIZE);
+	return USBD_OK;
+}
+
+static uint8_t USBD_COMPOSITE_DeInit(USBD_HandleTypeDef* pdev, uint8_t cfgidx) {
+	USBD_LL_CloseEP(pdev, COMPOSITE_HID_EPIN_ADDR);
+	USBD_LL_CloseEP(pdev, COMPOSITE_CDC_CMD_EP);
+	USBD_LL_CloseEP(pdev, COMPOSITE_CDC_OUT_EP);
+	USBD_LL_CloseEP(pdev, COMPOSITE_CDC_IN_EP);
+	if (pdev->pClassData != NULL) {
+		USBD_free(pdev->pClassData);
+		pdev->pClassData = NULL;
+	}
+	/* i trasferimenti in corso non verranno mai completati; senza pClassData ogni nuova trasmissione fallisce */
+	USBD_COMPOSITE_DeInitCallback(pdev);
+	return USBD_OK;
+}
+
+/**
+ * @brief Richieste di classe rivolte all'interfaccia HID.
+ */
+static uint8_t USBD_COMPOSITE_HidClassRequest(USBD_HandleTypeDef* pdev, USBD_SetupReqTypedef* req) {
+	USBD_COMPOSITE_HandleTypeDef* hcmp = (USBD_COMPOSITE_HandleTypeDef*) pdev->pClassData;
+
+	switch (req->bRequest) {
+	case HID_REQ_SET_PROTOCOL:
+		hcmp->hidProtocol = (uint8_t) req->wValue;
+		break;
+	case HID_REQ_GET_PROTOCOL:
+		USBD_CtlSendData(pdev, &hcmp->hidProtocol, 1);
+		break;
+	case HID_REQ_SET_IDLE:
+		hcmp->hidIdle = (uint8_t) (req->wValue >> 8);
+		break;
+	case HID_REQ_GET_IDLE:
+		USBD_CtlSendData(pdev, &hcmp->hidIdle, 1);
+		break;
+	default:
+		USBD_CtlError(pdev, req);
+		return USBD_FAIL;
+	}
+	return USBD_OK;
+}
+
+/**
+ * @brief Richieste di classe rivolte all'interfaccia di comunicazione CDC.
+ * @details SET_LINE_CODING ha una fase dati OUT, completata in USBD_COMPOSITE_EP0_RxReady().
+ */
+static uint8_t USBD_COMPOSITE_CdcClassRequest(USBD_HandleTypeDef* pdev, USBD_SetupReqTypedef* req) {
+	USBD_COMPOSITE_HandleTypeDef* hcmp = (USBD_COMPOSITE_HandleTypeDef*) pdev->pClassData;
+
+	switch (req->bRequest) {
+	case CDC_SET_LINE_CODING:
+		hcmp->cdcCmd = req->bRequest;
+		USBD_CtlPrepareRx(pdev, hcmp->cdcLineCoding, MIN(req->wLength, sizeof(hcmp->cdcLineCoding)));
+		break;
+	case CDC_GET_LINE_CODING:
+		USBD_CtlSendData(pdev, hcmp->cdcLineCoding, MIN(req->wLength, sizeof(hcmp->cdcLineCoding)));
+		break;
+	case CDC_SET_CONTROL_LINE_STATE:
+		hcmp->cdcLineState = (uint8_t) req->wValue;
+		break;
+	default:
+		/* SEND_BREAK e le altre richieste ACM non hanno effetto su una porta virtuale */
+		break;
+	}
+	return USBD_OK;
+}
+
+static uint8_t USBD_COMPOSITE_Setup(USBD_HandleTypeDef* pdev, USBD_SetupReqTypedef* req) {
+	uint8_t itf = LOBYTE(req->wIndex);
+	uint16_t len = 0;
+	uint8_t* pbuf = NULL;
+
+	switch (req->bmRequest & USB_REQ_TYPE_MASK) {
+	case USB_REQ_TYPE_CLASS:
+		if (itf == COMPOSITE_HID_ITF)
+			return USBD_COMPOSITE_HidClassRequest(pdev, req);
+		if (itf == COMPOSITE_CDC_CMD_ITF)
+			return USBD_COMPOSITE_CdcClassRequest(pdev, req);
+		USBD_CtlError(pdev, req);
+		return USBD_FAIL;
+
+	case USB_REQ_TYPE_STANDARD:
+		switch (req->bRequest) {
+		case USB_REQ_GET_DESCRIPTOR:
+			if (itf != COMPOSITE_HID_ITF)
+				break;
+			if (req->wValue >> 8 == HID_REPORT_DESC) {
+				len = MIN(COMPOSITE_HID_REPORT_DESC_SIZE, req->wLength);
+				pbuf = USBD_COMPOSITE_ReportDesc;
+			}
+			else if (req->wValue >> 8 == HID_DESCRIPTOR_TYPE) {
+				len = MIN(COMPOSITE_HID_DESC_SIZE, req->wLength);
+				pbuf = USBD_COMPOSITE_HidDesc;
+			}
+			USBD_CtlSendData(pdev, pbuf, len);
+			break;
+
+		case USB_REQ_GET_INTERFACE: {
+			/* nessuna interfaccia ha alternate setting */
+			static uint8_t altSetting = 0;
+			USBD_CtlSendData(pdev, &altSetting, 1);
+			break;
+		}
+
+		case USB_REQ_SET_INTERFACE:
+			break;
+		}
+	}
+	return USBD_OK;
+}
+
+static uint8_t USBD_COMPOSITE_EP0_RxReady(USBD_HandleTypeDef* pdev) {
+	USBD_COMPOSITE_HandleTypeDef* hcmp = (USBD_COMPOSITE_HandleTypeDef*) pdev->pClassData;
+
+	/* il line coding e' gia' stato ricevuto in cdcLineCoding */
+	if (hcmp != NULL)
+		hcmp->cdcCmd = 0;
+	return USBD_OK;
+}
+
+static uint8_t USBD_COMPOSITE_DataIn(USBD_HandleTypeDef* pdev, uint8_t epnum) {
+	USBD_COMPOSITE_HandleTypeDef* hcmp = (USBD_COMPOSITE_HandleTypeDef*) pdev->pClassData;
+
+	if (epnum == (COMPOSITE_HID_EPIN_ADDR & 0x7F)) {
+		hcmp->hidBusy = 0;
+		USBD_COMPOSITE_ReportSentCallback(pdev);
+	}
+	else if (epnum == (COMPOSITE_CDC_IN_EP & 0x7F)) {
+		hcmp->cdcBusy = 0;
+		USBD_COMPOSITE_CDC_TxCpltCallback(pdev);
+	}
+	return USBD_OK;
+}
+
+static uint8_t USBD_COMPOSITE_DataOut(USBD_HandleTypeDef* pdev, uint8_t epnum) {
+	USBD_COMPOSITE_HandleTypeDef* hcmp = (USBD_COMPOSITE_HandleTypeDef*) pdev->pClassData;
+
+	if (epnum == COMPOSITE_CDC_OUT_EP) {
+		USBD_COMPOSITE_CDC_RxCallback(pdev, hcmp->cdcRx, USBD_LL_GetRxDataSize(pdev, epnum));
+		USBD_LL_PrepareReceive(pdev, COMPOSITE_CDC_OUT_EP, hcmp->cdcRx, COMPOSITE_CDC_DATA_SIZE);
+	}
+	return USBD_OK;
+}
+
+static uint8_t USBD_COMPOSITE_SOF(USBD_HandleTypeDef* pdev) {
+	USBD_COMPOSITE_SOFCallback(pdev);
+	return USBD_OK;
+}
+
+static uint8_t* USBD_COMPOSITE_GetCfgDesc(uint16_t* length) {
+	*length = sizeof(USBD_COMPOSITE_CfgDesc);
+	return USBD_COMPOSITE_CfgDesc;
+}
+
+static uint8_t* USBD_COMPOSITE_GetDeviceQualifierDesc(uint16_t* length) {
+	*length = sizeof(USBD_COMPOSITE_DeviceQualifierDesc);
+	return USBD_COMPOSITE_DeviceQualifierDesc;
+}
+
+uint8_t USBD_COMPOSITE_SendReport(USBD_HandleTypeDef* pdev, uint8_t* report, uint16_t len) {
+	USBD_COMPOSITE_HandleTypeDef* hcmp = (USBD_COMPOSITE_HandleTypeDef*) pdev->pClassData;
+
+	if (pdev->dev_state != USBD_STATE_CONFIGURED || hcmp == NULL)
+		return USBD_FAIL;
+	if (hcmp->hidBusy)
+		return USBD_BUSY;
+	hcmp->hidBusy = 1;
+	USBD_LL_Transmit(pdev, COMPOSITE_HID_EPIN_ADDR, report, len);
+	return USBD_OK;
+}
+
+uint8_t USBD_COMPOSITE_GetProtocol(USBD_HandleTypeDef* pdev) {
+	USBD_COMPOSITE_HandleTypeDef* hcmp = (USBD_COMPOSITE_HandleTypeDef*) pdev->pClassData;
+
+	if (hcmp == NULL)
+		return 1;
+	return hcmp->hidProtocol;
+}
+
+uint8_t USBD_COMPOSITE_CDC_Transmit(USBD_HandleTypeDef* pdev, uint8_t* buf, uint16_t len) {
+	USBD_COMPOSITE_HandleTypeDef* hcmp = (USBD_COMPOSITE_HandleTypeDef*) pdev->pClassData;
+
+	if (pdev->dev_state != USBD_STATE_CONFIGURED || hcmp == NULL || !(hcmp->cdcLineState & CDC_LINE_DTR))
+		return USBD_FAIL;
+	if (hcmp->cdcBusy)
+		return USBD_BUSY;
+	hcmp->cdcBusy = 1;
+	USBD_LL_Transmit(pdev, COMPOSITE_CDC_IN_EP, buf, MIN(len, COMPOSITE_CDC_DATA_SIZE));
+	return USBD_OK;
+}
+
+__weak void USBD_COMPOSITE_ReportSentCallback(USBD_HandleTypeDef* pdev) {
+	/* da ridefinire nell'applicazione */
+}
+
+__weak void USBD_COMPOSITE_CDC_TxCpltCallback(USBD_HandleTypeDef* pdev) {
+	/* da ridefinire nell'applicazione */
+}
+
+__weak void USBD_COMPOSITE_CDC_RxCallback(USBD_HandleTypeDef* pdev, uint8_t* buf, uint32_t len) {
+	/* i dati ricevuti sono ignorati, se l'applicazione non ridefinisce la callback */
+}
+
+__weak void USBD_COMPOSITE_SOFCallback(USBD_HandleTypeDef* pdev) {
+	/* da ridefinire nell'applicazione */
+}
+
+__weak void USBD_COMPOSITE_DeInitCallback(USBD_HandleTypeDef* pdev) {
+	/* da ridefinire nell'applicazione */
+}
@@ -0,0 +1,115 @@
+/**
+ * @file keyboard.c
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "keyboard.h"
+#include <assert.h>
+#include <string.h>
+
+void KEYBOARD_Init(KEYBOARD_t* k) {
+	assert(k);
+	memset(k, 0, sizeof(KEYBOARD_t));
+	k->changed = 1;
+}
+
+/**
+ * @brief Individua il byte e il bit che rappresentano un tasto.
+ * @return puntatore al byte, NULL se l'usage non e' rappresentabile
+ */
+static uint8_t* KEYBOARD_Locate(const KEYBOARD_t* k, uint8_t usage, uint8_t* mask) {
+	if (usage >= KEYBOARD_LEFT_CTRL && usage <= KEYBOARD_RIGHT_GUI) {
+		*mask = 1 << (usage - KEYBOARD_LEFT_CTRL);
+		return (uint8_t*) &k->modifiers;
+	}
+	if (usage >= KEYBOARD_FIRST_KEY && usage <= KEYBOARD_NKRO_MAX_USAGE) {
+		*mask = 1 << (usage % 8);
+		return (uint8_t*) &k->bitmap[usage / 8];
+	}
+	return NULL;
+}
+
+void KEYBOARD_Set(KEYBOARD_t* k, uint8_t usage, uint8_t pressed) {
+	assert(k);
+	uint8_t mask;
+	uint8_t* byte = KEYBOARD_Locate(k, usage, &mask);
+	if (byte == NULL)
+		return;
+	uint8_t old = *byte;
+	if (pressed)
+		*byte |= mask;
+	else
+		*byte &= ~mask;
+	if (*byte != old)
+		k->changed = 1;
+}
+
+uint8_t KEYBOARD_IsPressed(const KEYBOARD_t* k, uint8_t usage) {
+	assert(k);
+	uint8_t mask;
+	const uint8_t* byte = KEYBOARD_Locate(k, usage, &mask);
+	return byte != NULL && (*byte & mask) != 0;
+}
+
+uint8_t KEYBOARD_Changed(const KEYBOARD_t* k) {
+	assert(k);
+	return k->changed;
+}
+
+void KEYBOARD_Invalidate(KEYBOARD_t* k) {
+	assert(k);
+	k->changed = 1;
+}
+
+uint8_t KEYBOARD_BuildReport(KEYBOARD_t* k, KEYBOARD_Protocol_t protocol, uint8_t* report) {
+	assert(k);
+	assert(report);
+	memset(report, 0, KEYBOARD_NKRO_REPORT_SIZE);
+	report[0] = k->modifiers;
+	k->changed = 0;
+
+	memcpy(&report[2], k->bitmap, KEYBOARD_BITMAP_SIZE);
+	if (protocol == KEYBOARD_NKRO)
+		return KEYBOARD_NKRO_REPORT_SIZE;
+
+	uint8_t nkro[KEYBOARD_NKRO_REPORT_SIZE];
+	memcpy(nkro, report, KEYBOARD_NKRO_REPORT_SIZE);
+	memset(&report[2], 0, KEYBOARD_BITMAP_SIZE);
+	return KEYBOARD_ToBoot(nkro, report);
+}
+
+uint8_t KEYBOARD_ToBoot(const uint8_t* nkro, uint8_t* boot) {
+	assert(nkro);
+	assert(boot);
+	boot[0] = nkro[0];
+	memset(&boot[1], 0, KEYBOARD_BOOT_REPORT_SIZE - 1);
+
+	uint8_t n = 0;
+	for (uint8_t i = 0; i < KEYBOARD_BITMAP_SIZE; i++) {
+		if (nkro[2 + i] == 0)
+			continue;
+		for (uint8_t b = 0; b < 8; b++)
+			if (nkro[2 + i] & (1 << b)) {
+				if (n == KEYBOARD_BOOT_KEYS) {
+					memset(&boot[2], KEYBOARD_ERROR_ROLLOVER, KEYBOARD_BOOT_KEYS);
+					return KEYBOARD_BOOT_REPORT_SIZE;
+				}
+				boot[2 + n++] = i * 8 + b;
+			}
+	}
+	return KEYBOARD_BOOT_REPORT_SIZE;
+}
@@ -0,0 +1,522 @@
+/**
+ * @file main.c
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include "stm32f4xx_hal.h"
+#include "usb_device.h"
+#include "stm32f4_discovery.h"
+#include "stm32f4_discovery_accelerometer.h"
+#include "usbd_composite.h"
+#include "hidqueue.h"
+#include "keyboard.h"
+#include "motion.h"
+#include "telemetry.h"
+#include "accring.h"
+#include <string.h>
+
+/**
+ * @defgroup USBD
+ * @{
+ * @defgroup COMPOSITE
+ * @{
+ * @defgroup Composite
+ * @{
+ *
+ * @brief Realizzazione di una periferica USB composita: mouse, tastiera e porta seriale virtuale.
+ *
+ * @details Una sola board espone, su un unico device USB (vedi usbd_composite.h), le funzioni dei progetti USB_HID_MOUSE_F4
+ * 			 e USB_HID_KEYBOARD e un canale di telemetria:
+ * 			 - mouse: gli spostamenti del cursore sono ricavati dall'inclinazione della board, come nel progetto del mouse
+ * 			 (vedi MOTION); all'avvio la board deve restare ferma per #MOUSE_CAL_SAMPLES millisecondi;
+ * 			 - tastiera: la pressione del tasto blu della board (User Button) e' acquisita come pressione della barra
+ * 			 spaziatrice; i report sono prodotti solo in corrispondenza dei fronti (vedi KEYBOARD);
+ * 			 - porta seriale virtuale (CDC-ACM): ogni campione dell'accelerometro e' trasmesso all'host (vedi TELEMETRY)
+ * 			 quando la porta e' aperta.
+ *
+ * 			 Con il LIS3DSH i campioni sono acquisiti a 1600 Hz tramite la FIFO del sensore: l'interruzione di watermark su
+ * 			 INT1 (EXTI0) svuota la FIFO in #accRing, da cui il main loop preleva, ad ogni SOF, tutti i campioni raccolti
+ * 			 nel frame precedente; in questo modo nessun campione va perso, qualunque sia il ritardo del main loop. Con il
+ * 			 LIS302DL, privo di FIFO, viene letto un campione ad ogni SOF.
+ *
+ * 			 Mouse e tastiera condividono l'endpoint HID e si distinguono per il report ID: ciascuno ha la propria coda di
+ * 			 trasmissione (#mouseQueue, #keyQueue) e, al completamento di un report, la coda della tastiera viene servita
+ * 			 per prima, in modo che i fronti dei tasti non attendano gli spostamenti accumulati del mouse.
+ */
+
+/* Private variables ---------------------------------------------------------*/
+/**
+ * @brief Struttura che astrae le 3 componenti di accellerazione angolare lungo gli assi X, Y, Z.
+ */
+typedef struct{
+	int16_t asseX;		//!< Componente di accellerazione angolare lungo l'asse X
+	int16_t asseY;		//!< Componente di accellerazione angolare lungo l'asse Y
+	int16_t asseZ;		//!< Componente di accellerazione angolare lungo l'asse Z
+}accellero_t;
+
+/**
+ * @brief Struttura che astrae il device Mouse.
+ */
+typedef struct {
+    uint8_t buttons;	//!< Riporta la pressione dei tasti del mouse
+    int8_t x;			//!< Riporta lo spostamento lungo l'asse x
+    int8_t y;			//!< Riporta lo spostamento lungo l'asse y
+    int8_t wheel;		//!< Riporta lo scroll del mouse
+}mouseHID_t;
+
+/**
+ * @brief Soglia che permette di regolare lo la sensibilità minima del dispositivo.
+ *
+ * @details I valori della componente accellerazione compresi tra -soglia e soglia sono considerati di riposo, ossia
+ * 			valori per i quali il cursore deve restare fermo.
+ */
+#define soglia 64
+
+/**
+ * @brief Numero di campioni (uno per millisecondo) mediati per la calibrazione dell'offset di zero.
+ */
+#define MOUSE_CAL_SAMPLES		256
+
+/**
+ * @brief Costante di tempo del filtro passa-basso, in potenze di 2 campioni (8 ms).
+ */
+#define MOUSE_FILTER_SHIFT		3
+
+#define USB_HID_KEY_SPACEBAR	0x2C		//!< Usage ID associato alla barra spaziatrice
+
+/**
+ * @brief Livello della FIFO dell'accelerometro che genera l'interruzione (2.5 ms a 1600 Hz).
+ *
+ * @details Una soglia bassa riduce il ritardo con cui i campioni raggiungono il mouse, una soglia alta riduce il numero
+ * 			di interruzioni e il costo per campione della lettura: con 4 campioni la lettura costa circa 7 byte SPI per
+ * 			campione, contro gli 11 di una interruzione per campione.
+ */
+#define ACC_FIFO_WATERMARK		4
+
+/**
+ * @brief Curva di accelerazione: velocita' del cursore, in pixel per report, in funzione dell'inclinazione oltre la #soglia (mg).
+ */
+static const MOTION_CurvePoint_t mouseCurve[] = {
+	{    0, MOTION_SPEED(0)   },
+	{  250, MOTION_SPEED(0.3) },
+	{  600, MOTION_SPEED(1.3) },
+	{ 1000, MOTION_SPEED(4)   },
+};
+
+/* Private function prototypes -----------------------------------------------*/
+/**
+ * @brief System Clock Configuration
+*/
+void SystemClock_Config(void);
+/**
+ * @brief Funzione di configurazione ed inizializzazione delle periferiche GPIO utilizzate.
+ */
+static void MX_GPIO_Init(void);
+/**
+ * @brief Funzione di inizializzazione.<br>
+ *
+ * @details E' la prima funzione ad essere eseguita nel main program. Si occupa di:
+ * 			 - inizializzare la libreria HAL;
+ * 			 - configurare il system clock;
+ * 			 - inizializzare e configurare tutte le periferiche utilizzate;
+ * 			 - inizializzare le variabili ed eseguire le funzioni richieste al reset del sistema.
+ */
+void setup(void);
+/**
+ * @brief Funzione che implementa la logica del programma.<br>
+ *
+ * @details Ad ogni SOF (ogni millisecondo), segnalato da USBD_COMPOSITE_SOFCallback():
+ * 			 - viene valutata la pressione del tasto blu (button User) e, se lo stato della barra spaziatrice e' cambiato,
+ * 			 il report NKRO della tastiera viene accodato in #keyQueue e convertito, alla trasmissione, nel formato
+ * 			 selezionato dall'host;
+ * 			 - i campioni dell'accelerometro raccolti in #accRing (o, senza FIFO, il campione letto) vengono aggiunti al
+ * 			 flusso di telemetria #telemetry; l'ultimo campione e' usato per il mouse;
+ * 			 - in report protocol, gli spostamenti calcolati dalla pipeline #motion vengono accodati in #mouseQueue.
+ *
+ * 			 In attesa del SOF successivo il processore resta in sleep.
+ */
+void loop(void);
+
+/**
+ * @brief Avvia la trasmissione di un report della tastiera; funzione di trasmissione della coda #keyQueue.
+ * @details In report protocol il report e' preceduto dal report ID; in boot protocol viene trasmesso il solo report boot.
+ * @param[in] ctx handle del device USB
+ * @param[in] report report da trasmettere
+ * @param[in] len lunghezza del report
+ * @return 0 se la trasmissione e' stata avviata
+ */
+static int KEY_Send(void* ctx, uint8_t* report, uint8_t len);
+
+/**
+ * @brief Avvia la trasmissione di un report del mouse; funzione di trasmissione della coda #mouseQueue.
+ * @details In boot protocol l'interfaccia e' una tastiera boot e il report non puo' essere trasmesso: resta in coda
+ * fino al ritorno al report protocol.
+ * @param[in] ctx handle del device USB
+ * @param[in] report report da trasmettere
+ * @param[in] len lunghezza del report
+ * @return 0 se la trasmissione e' stata avviata
+ */
+static int MOUSE_Send(void* ctx, uint8_t* report, uint8_t len);
+
+/**
+ * @brief Avvia la trasmissione di un pacchetto di telemetria sulla porta seriale virtuale.
+ * @param[in] ctx handle del device USB
+ * @param[in] packet pacchetto da trasmettere
+ * @param[in] len lunghezza del pacchetto
+ * @return 0 se la trasmissione e' stata avviata
+ */
+static int CDC_Send(void* ctx, uint8_t* packet, uint16_t len);
+
+/**
+ * @brief Disabilita l'interruzione USB, per l'accesso alle code di trasmissione dal main loop.
+ */
+static void USB_Lock(void);
+
+/**
+ * @brief Riabilita l'interruzione USB.
+ */
+static void USB_Unlock(void);
+
+/**
+ * @brief Callback di fine trasmissione di un report HID: trasmette il report successivo, dando priorita' alla tastiera.
+ * @param[in] pdev handle del device USB
+ */
+void USBD_COMPOSITE_ReportSentCallback(USBD_HandleTypeDef *pdev);
+
+/**
+ * @brief Callback di fine trasmissione di un pacchetto di telemetria.
+ * @param[in] pdev handle del device USB
+ */
+void USBD_COMPOSITE_CDC_TxCpltCallback(USBD_HandleTypeDef *pdev);
+
+/**
+ * @brief Callback associata al SOF: richiede al main loop il campionamento dell'accelerometro.
+ * @param[in] pdev handle del device USB
+ */
+void USBD_COMPOSITE_SOFCallback(USBD_HandleTypeDef *pdev);
+
+/**
+ * @brief Callback di deinizializzazione della classe (reset del bus, deconfigurazione): svuota le code #keyQueue e
+ * 			#mouseQueue e libera il buffer di #telemetry, i cui trasferimenti in corso non verranno mai completati.
+ * @param[in] pdev handle del device USB
+ */
+void USBD_COMPOSITE_DeInitCallback(USBD_HandleTypeDef *pdev);
+
+/**
+ * @brief Lettura della FIFO dell'accelerometro; funzione di lettura di #accRing.
+ * @param[out] dst campioni letti
+ * @param[in] max numero massimo di campioni da leggere
+ * @return numero di campioni letti
+ */
+static uint8_t ACC_Read(ACCRING_Sample_t* dst, uint8_t max);
+
+/**
+ * @brief Callback delle linee EXTI: l'interruzione di watermark dell'accelerometro svuota la FIFO in #accRing.
+ * @param[in] GPIO_Pin pin connesso alla linea EXTI
+ */
+void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin);
+
+mouseHID_t mouseHID;		//!< Oggetto di tipo mouseHID_t
+accellero_t accellero;		//!< Oggetto di tipo accellero_t
+
+int8_t value_x;				//!< Rappresenta lo spostamento lungo l'asse x del mouse
+int8_t value_y;				//!< Rappresenta lo spostamento lungo l'asse y del mouse
+
+MOTION_t motion;			//!< Pipeline di elaborazione dei campioni dell'accelerometro
+KEYBOARD_t keyboard;		//!< Stato dei tasti
+TELEMETRY_t telemetry;		//!< Flusso dei campioni grezzi sulla porta seriale virtuale
+ACCRING_t accRing;			//!< Campioni letti dalla FIFO dell'accelerometro
+uint8_t accFifo;			//!< 1 se l'acquisizione avviene tramite la FIFO dell'accelerometro
+
+HIDQUEUE_t keyQueue;		//!< Coda di trasmissione dei report della tastiera
+HIDQUEUE_t mouseQueue;		//!< Coda di trasmissione dei report del mouse
+uint8_t keyTx[COMPOSITE_HID_EPIN_SIZE];		//!< Report della tastiera in trasmissione: report NKRO preceduto dal report ID, o report boot
+uint8_t mouseTx[sizeof(mouseHID_t) + 1];	//!< Report del mouse in trasmissione, preceduto dal report ID
+volatile uint8_t sofPending;	//!< 1 se e' stato ricevuto un SOF non ancora servito
+
+int main(void)
+{
+	setup();
+    for(;;) loop();
+    return 1;
+}
+
+void setup(void){
+/* Reset of all peripherals, Initializes the Flash interface and the Systick. */
+  HAL_Init();
+
+  /* Configure the system clock */
+  SystemClock_Config();
+
+  /* Initialize all configured peripherals */
+  MX_GPIO_Init();
+  MX_USB_DEVICE_Init();
+  BSP_PB_Init(BUTTON_KEY,BUTTON_MODE_GPIO);
+  BSP_ACCELERO_Init();
+  /* ODR massimo, con i campioni raccolti nella FIFO del sensore: il buffer deve essere pronto prima dell'interruzione */
+  ACCRING_Init(&accRing);
+  accFifo = 0;
+  if(BSP_ACCELERO_ReadID() == I_AM_LIS3DSH){
+	  LIS3DSH_DataRateCmd(LIS3DSH_DATARATE_1600);
+	  accFifo = BSP_ACCELERO_FIFO_Start(ACC_FIFO_WATERMARK) == ACCELERO_OK;
+  }
+  for(int i=0;i<LEDn;i++)
+	  BSP_LED_Init(i);
+
+  mouseHID.buttons=0x00;
+  mouseHID.x = 0;
+  mouseHID.y = 0;
+  mouseHID.wheel = 0;
+  MOTION_Init(&motion, mouseCurve, sizeof(mouseCurve) / sizeof(mouseCurve[0]), MOUSE_FILTER_SHIFT, soglia);
+  MOTION_StartCalibration(&motion, MOUSE_CAL_SAMPLES);
+  KEYBOARD_Init(&keyboard);
+  mouseTx[0] = COMPOSITE_REPORT_ID_MOUSE;
+  HIDQUEUE_Init(&keyQueue, HIDQUEUE_KEYBOARD, KEYBOARD_NKRO_REPORT_SIZE, KEY_Send, &hUsbDeviceFS, USB_Lock, USB_Unlock);
+  HIDQUEUE_Init(&mouseQueue, HIDQUEUE_MOUSE, sizeof(mouseHID_t), MOUSE_Send, &hUsbDeviceFS, USB_Lock, USB_Unlock);
+  TELEMETRY_Init(&telemetry, CDC_Send, &hUsbDeviceFS, USB_Lock, USB_Unlock);
+  sofPending = 0;
+}
+
+void loop(void){
+	uint8_t report[KEYBOARD_NKRO_REPORT_SIZE];
+
+  /* Attesa del SOF: il campione viene acquisito all'inizio del frame in cui l'host interroga l'endpoint */
+	__disable_irq();
+	while(!sofPending){
+		__WFI();
+		__enable_irq();
+		__disable_irq();
+	}
+	sofPending = 0;
+	__enable_irq();
+
+  /* Tastiera: barra spaziatrice associata al tasto blu (Button User) */
+	KEYBOARD_Set(&keyboard, USB_HID_KEY_SPACEBAR, BSP_PB_GetState(BUTTON_KEY)==GPIO_PIN_SET);
+	KEYBOARD_IsPressed(&keyboard, USB_HID_KEY_SPACEBAR) ? BSP_LED_On(LED4) : BSP_LED_Off(LED4);
+	/* la coda riceve il report NKRO, convertito nel formato selezionato dall'host in KEY_Send() */
+	if (KEYBOARD_Changed(&keyboard)){
+		KEYBOARD_BuildReport(&keyboard, KEYBOARD_NKRO, report);
+		HIDQUEUE_Push(&keyQueue, report);
+	}
+
+  /* Telemetria: campioni raccolti dall'ultimo SOF; senza FIFO, un campione letto ora */
+	if (accFifo){
+		ACCRING_Sample_t sample;
+		while (ACCRING_Pop(&accRing, &sample)){
+			TELEMETRY_Push(&telemetry, sample.x, sample.y, sample.z);
+			accellero.asseX = sample.x;
+			accellero.asseY = sample.y;
+			accellero.asseZ = sample.z;
+		}
+	}
+	else {
+		BSP_ACCELERO_GetXYZ((int16_t*)&accellero);
+		TELEMETRY_Push(&telemetry, accellero.asseX, accellero.asseY, accellero.asseZ);
+	}
+
+  /* Mouse: filtro, offset di zero, curva di accelerazione e accumulo sub-pixel */
+	MOTION_Process(&motion, accellero.asseX, accellero.asseY, &value_x, &value_y);
+	mouseHID.x = -value_x; 								// opposto perchè la board è rivolta con il button user verso le dita
+	mouseHID.y = -value_y;
+	/* in boot protocol i report del mouse non sono trasmessi: non vengono accodati, per non accumulare spostamenti */
+	if (USBD_COMPOSITE_GetProtocol(&hUsbDeviceFS) != KEYBOARD_BOOT)
+		HIDQUEUE_Push(&mouseQueue,(uint8_t*)&mouseHID);
+
+  /* Led: campioni di telemetria persi dall'avvio */
+	(telemetry.dropped || accRing.dropped) ? BSP_LED_On(LED5) : BSP_LED_Off(LED5);
+}
+
+static int KEY_Send(void* ctx, uint8_t* report, uint8_t len){
+	if (USBD_COMPOSITE_GetProtocol((USBD_HandleTypeDef*)ctx) == KEYBOARD_BOOT){
+		len = KEYBOARD_ToBoot(report, keyTx);
+		return USBD_COMPOSITE_SendReport((USBD_HandleTypeDef*)ctx, keyTx, len) == USBD_OK ? 0 : -1;
+	}
+	keyTx[0] = COMPOSITE_REPORT_ID_KEYBOARD;
+	memcpy(&keyTx[1], report, len);
+	return USBD_COMPOSITE_SendReport((USBD_HandleTypeDef*)ctx, keyTx, len + 1) == USBD_OK ? 0 : -1;
+}
+
+static int MOUSE_Send(void* ctx, uint8_t* report, uint8_t len){
+	if (USBD_COMPOSITE_GetProtocol((USBD_HandleTypeDef*)ctx) == KEYBOARD_BOOT)
+		return -1;
+	memcpy(&mouseTx[1], report, len);
+	return USBD_COMPOSITE_SendReport((USBD_HandleTypeDef*)ctx, mouseTx, len + 1) == USBD_OK ? 0 : -1;
+}
+
+static int CDC_Send(void* ctx, uint8_t* packet, uint16_t len){
+	return USBD_COMPOSITE_CDC_Transmit((USBD_HandleTypeDef*)ctx, packet, len) == USBD_OK ? 0 : -1;
+}
+
+static void USB_Lock(void){
+	HAL_NVIC_DisableIRQ(OTG_FS_IRQn);
+}
+
+static void USB_Unlock(void){
+	HAL_NVIC_EnableIRQ(OTG_FS_IRQn);
+}
+
+void USBD_COMPOSITE_ReportSentCallback(USBD_HandleTypeDef *pdev){
+	HIDQUEUE_Sent(&keyQueue);
+	HIDQUEUE_Sent(&mouseQueue);
+}
+
+void USBD_COMPOSITE_CDC_TxCpltCallback(USBD_HandleTypeDef *pdev){
+	TELEMETRY_Sent(&telemetry);
+}
+
+void USBD_COMPOSITE_SOFCallback(USBD_HandleTypeDef *pdev){
+	sofPending = 1;
+}
+
+void USBD_COMPOSITE_DeInitCallback(USBD_HandleTypeDef *pdev){
+	HIDQUEUE_Reset(&keyQueue);
+	HIDQUEUE_Reset(&mouseQueue);
+	TELEMETRY_Sent(&telemetry);
+}
+
+static uint8_t ACC_Read(ACCRING_Sample_t* dst, uint8_t max){
+	return BSP_ACCELERO_FIFO_Read((int16_t*)dst, max);
+}
+
+void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin){
+	if (GPIO_Pin == ACCELERO_INT1_PIN)
+		ACCRING_Drain(&accRing, ACC_Read);
+}
+
+
+void SystemClock_Config(void)
+{
+
+  RCC_OscInitTypeDef RCC_OscInitStruct;
+  RCC_ClkInitTypeDef RCC_ClkInitStruct;
+
+    /**Configure the main internal regulator output voltage 
+    */
+  __HAL_RCC_PWR_CLK_ENABLE();
+
+  __HAL_PWR_VOLTAGESCALING_CONFIG(PWR_REGULATOR_VOLTAGE_SCALE1);
+
+    /**Initializes the CPU, AHB and APB busses clocks 
+    */
+  RCC_OscInitStruct.OscillatorType = RCC_OSCILLATORTYPE_HSE;
+  RCC_OscInitStruct.HSEState = RCC_HSE_ON;
+  RCC_OscInitStruct.PLL.PLLState = RCC_PLL_ON;
+  RCC_OscInitStruct.PLL.PLLSource = RCC_PLLSOURCE_HSE;
+  RCC_OscInitStruct.PLL.PLLM = 4;
+  RCC_OscInitStruct.PLL.PLLN = 72;
+  RCC_OscInitStruct.PLL.PLLP = RCC_PLLP_DIV2;
+  RCC_OscInitStruct.PLL.PLLQ = 3;
+  if (HAL_RCC_OscConfig(&RCC_OscInitStruct) != HAL_OK)
+  {
+    _Error_Handler(__FILE__, __LINE__);
+  }
+
+    /**Initializes the CPU, AHB and APB busses clocks 
+    */
+  RCC_ClkInitStruct.ClockType = RCC_CLOCKTYPE_HCLK|RCC_CLOCKTYPE_SYSCLK
+                              |RCC_CLOCKTYPE_PCLK1|RCC_CLOCKTYPE_PCLK2;
+  RCC_ClkInitStruct.SYSCLKSource = RCC_SYSCLKSOURCE_PLLCLK;
+  RCC_ClkInitStruct.AHBCLKDivider = RCC_SYSCLK_DIV1;
+  RCC_ClkInitStruct.APB1CLKDivider = RCC_HCLK_DIV2;
+  RCC_ClkInitStruct.APB2CLKDivider = RCC_HCLK_DIV1;
+
+  if (HAL_RCC_ClockConfig(&RCC_ClkInitStruct, FLASH_LATENCY_2) != HAL_OK)
+  {
+    _Error_Handler(__FILE__, __LINE__);
+  }
+
+    /**Configure the Systick interrupt time 
+    */
+  HAL_SYSTICK_Config(HAL_RCC_GetHCLKFreq()/1000);
+
+    /**Configure the Systick 
+    */
+  HAL_SYSTICK_CLKSourceConfig(SYSTICK_CLKSOURCE_HCLK);
+
+  /* SysTick_IRQn interrupt configuration */
+  HAL_NVIC_SetPriority(SysTick_IRQn, 0, 0);
+}
+
+/** Configure pins as 
+        * Analog 
+        * Input 
+        * Output
+        * EVENT_OUT
+        * EXTI
+*/
+static void MX_GPIO_Init(void)
+{
+
+  /* GPIO Ports Clock Enable */
+  __HAL_RCC_GPIOH_CLK_ENABLE();
+  __HAL_RCC_GPIOA_CLK_ENABLE();
+
+}
+
+/* USER CODE BEGIN 4 */
+
+/* USER CODE END 4 */
+
+/**
+  * @brief  This function is executed in case of error occurrence.
+  * @param  None
+  * @retval None
+  */
+void _Error_Handler(char * file, int line)
+{
+  /* USER CODE BEGIN Error_Handler_Debug */
+  /* User can add his own implementation to report the HAL error return state */
+  while(1) 
+  {
+  }
+  /* USER CODE END Error_Handler_Debug */ 
+}
+
+#ifdef USE_FULL_ASSERT
+
+/**
+   * @brief Reports the name of the source file and the source line number
+   * where the assert_param error has occurred.
+   * @param file: pointer to the source file name
+   * @param line: assert_param error line source number
+   * @retval None
+   */
+void assert_failed(uint8_t* file, uint32_t line)
+{
+  /* USER CODE BEGIN 6 */
+  /* User can add his own implementation to report the file name and line number,
+    ex: printf("Wrong parameters value: file %s on line %d\r\n", file, line) */
+  /* USER CODE END 6 */
+
+}
+
+#endif
+
+/**
+ * @} @} @}
+ */
+/**
+  * @}
+  */ 
+
+/**
+  * @}
+*/ 
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,108 @@
+/**
+ * @file motion.c
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "motion.h"
+#include <assert.h>
+#include <string.h>
+
+/**
+ * @brief Velocita' associata ad un'inclinazione, per interpolazione lineare sulla curva di accelerazione.
+ * @param[in] tilt inclinazione filtrata, in Q8: la parte frazionaria non va persa, altrimenti le inclinazioni piccole
+ * 			sarebbero sottostimate in media di mezza unita'
+ */
+static int32_t MOTION_Curve(const MOTION_t* m, int32_t tilt) {
+	int32_t mag = (tilt < 0 ? -tilt : tilt) - m->deadZone * 256;
+	if (mag <= 0)
+		return 0;
+	const MOTION_CurvePoint_t* p = m->curve;
+	uint8_t i = 1;
+	while (i < m->nCurve - 1 && mag > p[i].tilt * 256)
+		i++;
+	int32_t speed;
+	if (mag >= p[i].tilt * 256)
+		speed = p[i].speed;
+	else
+		speed = p[i - 1].speed + (int32_t) ((int64_t) (mag - p[i - 1].tilt * 256) * (p[i].speed - p[i - 1].speed)
+				/ ((p[i].tilt - p[i - 1].tilt) * 256));
+	return tilt < 0 ? -speed : speed;
+}
+
+/**
+ * @brief Elabora un campione per un asse.
+ */
+static int8_t MOTION_Axis(const MOTION_t* m, MOTION_Axis_t* a, int16_t sample) {
+	int32_t x = (int32_t) sample - a->zero;
+	/* divisione, e non shift aritmetico, per un troncamento simmetrico nei due versi */
+	a->filt += (x * 256 - a->filt) / (1 << m->alphaShift);
+
+	a->rest += MOTION_Curve(m, a->filt);
+	if (a->rest > MOTION_REST_MAX)
+		a->rest = MOTION_REST_MAX;
+	else if (a->rest < -MOTION_REST_MAX)
+		a->rest = -MOTION_REST_MAX;
+
+	/* troncamento verso lo zero, simmetrico per i due versi di movimento */
+	int32_t out = a->rest / MOTION_Q16;
+	if (out > MOTION_REPORT_MAX)
+		out = MOTION_REPORT_MAX;
+	else if (out < -MOTION_REPORT_MAX)
+		out = -MOTION_REPORT_MAX;
+	a->rest -= out * MOTION_Q16;
+	return (int8_t) out;
+}
+
+void MOTION_Init(MOTION_t* m, const MOTION_CurvePoint_t* curve, uint8_t nCurve, uint8_t alphaShift, int32_t deadZone) {
+	assert(m);
+	assert(curve && nCurve >= 2);
+	assert(alphaShift < 16);
+	memset(m, 0, sizeof(MOTION_t));
+	m->curve = curve;
+	m->nCurve = nCurve;
+	m->alphaShift = alphaShift;
+	m->deadZone = deadZone;
+}
+
+void MOTION_StartCalibration(MOTION_t* m, uint16_t nSamples) {
+	assert(m);
+	assert(nSamples > 0);
+	m->x.calSum = m->y.calSum = 0;
+	m->calCount = 0;
+	m->calTarget = nSamples;
+}
+
+uint8_t MOTION_Process(MOTION_t* m, int16_t ax, int16_t ay, int8_t* dx, int8_t* dy) {
+	assert(m);
+	assert(dx && dy);
+	if (m->calTarget) {
+		*dx = *dy = 0;
+		m->x.calSum += ax;
+		m->y.calSum += ay;
+		if (++m->calCount < m->calTarget)
+			return 0;
+		m->x.zero = m->x.calSum / m->calCount;
+		m->y.zero = m->y.calSum / m->calCount;
+		m->x.filt = m->y.filt = 0;
+		m->x.rest = m->y.rest = 0;
+		m->calTarget = 0;
+		return 1;
+	}
+	*dx = MOTION_Axis(m, &m->x, ax);
+	*dy = MOTION_Axis(m, &m->y, ay);
+	return 1;
+}
@@ -0,0 +1,81 @@
+/**
+ * @file telemetry.c
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "telemetry.h"
+#include <assert.h>
+#include <string.h>
+
+/**
+ * @brief Avvia la trasmissione del buffer in riempimento, se completo. Da chiamare in sezione critica.
+ */
+static void TELEMETRY_Start(TELEMETRY_t* t) {
+	if (t->busy || !t->ready)
+		return;
+	t->ready = 0;
+	if (t->send(t->ctx, t->packet[t->fill], TELEMETRY_PACKET_SIZE) != 0)
+		t->dropped += TELEMETRY_SAMPLES;
+	else {
+		t->busy = 1;
+		t->sent++;
+		t->fill ^= 1;
+	}
+	t->count = 0;
+}
+
+void TELEMETRY_Init(TELEMETRY_t* t, TELEMETRY_Send_t send, void* ctx, void (*lock)(void), void (*unlock)(void)) {
+	assert(t);
+	assert(send && lock && unlock);
+	memset(t, 0, sizeof(TELEMETRY_t));
+	t->send = send;
+	t->ctx = ctx;
+	t->lock = lock;
+	t->unlock = unlock;
+}
+
+void TELEMETRY_Push(TELEMETRY_t* t, int16_t x, int16_t y, int16_t z) {
+	assert(t);
+	uint16_t seq = t->seq++;
+	if (t->ready) {
+		/* entrambi i buffer sono occupati */
+		t->dropped++;
+		return;
+	}
+	uint8_t* s = &t->packet[t->fill][t->count * TELEMETRY_SAMPLE_SIZE];
+	s[0] = (uint8_t) seq;
+	s[1] = (uint8_t) (seq >> 8);
+	s[2] = (uint8_t) x;
+	s[3] = (uint8_t) ((uint16_t) x >> 8);
+	s[4] = (uint8_t) y;
+	s[5] = (uint8_t) ((uint16_t) y >> 8);
+	s[6] = (uint8_t) z;
+	s[7] = (uint8_t) ((uint16_t) z >> 8);
+	if (++t->count < TELEMETRY_SAMPLES)
+		return;
+
+	t->lock();
+	t->ready = 1;
+	TELEMETRY_Start(t);
+	t->unlock();
+}
+
+void TELEMETRY_Sent(TELEMETRY_t* t) {
+	assert(t);
+	t->busy = 0;
+	TELEMETRY_Start(t);
+}
@@ -0,0 +1,180 @@
+/**
+ * @file accring_test.c
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+/**
+ * @brief Simulazione su host dell'acquisizione tramite la FIFO del LIS3DSH: riempimento della FIFO, interruzione di
+ * watermark e svuotamento nel buffer circolare ACCRING.
+ *
+ * @details
+ * Il tempo avanza a passi di 1 us. La FIFO simulata riceve un campione numerato alla frequenza di uscita (ODR) e, in
+ * stream mode, a FIFO piena scarta il campione piu' vecchio. La linea INT1 e' alta finche' la FIFO contiene almeno
+ * watermark campioni; un fronte di salita avvia, dopo la latenza dell'interruzione, l'handler, che invoca
+ * ACCRING_Drain() con una lettura che riproduce LIS3DSH_ReadFIFO() (FIFO_SRC, poi un burst di tutti i campioni) e ne
+ * conta i byte SPI. Il main loop preleva i campioni ad ogni SOF (1 ms).
+ *
+ * Per ogni ODR e soglia si verifica che nessun campione vada perso o sia riordinato, che la linea INT1 torni bassa
+ * dopo ogni svuotamento (altrimenti l'acquisizione si fermerebbe senza nuovi fronti) e che la latenza rispetti il
+ * limite atteso. Con il consumatore bloccato oltre la capacita' del buffer, i campioni mancanti devono coincidere con
+ * quelli contati in dropped, senza overrun della FIFO, e l'acquisizione deve riprendere.
+ * @code
+ * gcc -std=gnu99 -O2 -Wall -Wextra -IInc test/accring_test.c Src/accring.c -o accring_test && ./accring_test
+ * @endcode
+ */
+#include "accring.h"
+#include <stdio.h>
+#include <string.h>
+
+#define SIM_US			1000000		//!< durata di ogni prova
+#define SOF_US			1000		//!< periodo del main loop
+#define IRQ_LATENCY_US	50			//!< ritardo fra il fronte di INT1 e l'handler
+#define STALL_START_US	300000		//!< inizio del blocco del consumatore
+#define STALL_US		200000		//!< durata del blocco del consumatore
+#define SEQ_MASK		0x7FFF		//!< numerazione dei campioni
+
+static int failures = 0;
+
+#define CHECK(cond) do { if (!(cond)) { printf("%s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+/**
+ * @brief FIFO del sensore simulata.
+ */
+static struct {
+	ACCRING_Sample_t sample[ACCRING_FIFO_DEPTH];
+	unsigned level;			//!< campioni presenti
+	unsigned overrun;		//!< campioni sovrascritti a FIFO piena
+	unsigned long bytes;	//!< byte SPI letti
+} fifo;
+
+static uint32_t produced;					//!< campioni prodotti dal sensore
+static long producedAt[SEQ_MASK + 1];		//!< istante di produzione di ogni campione
+
+static void FifoProduce(long t) {
+	if (fifo.level == ACCRING_FIFO_DEPTH) {
+		memmove(&fifo.sample[0], &fifo.sample[1], sizeof(fifo.sample[0]) * --fifo.level);
+		fifo.overrun++;
+	}
+	int16_t seq = (int16_t) (produced & SEQ_MASK);
+	ACCRING_Sample_t s = { seq, (int16_t) -seq, (int16_t) (seq * 3) };
+	fifo.sample[fifo.level++] = s;
+	producedAt[seq] = t;
+	produced++;
+}
+
+/**
+ * @brief Lettura della FIFO come LIS3DSH_ReadFIFO(): FIFO_SRC (2 byte) e, se non vuota, un burst di 6 byte per campione.
+ */
+static uint8_t FifoRead(ACCRING_Sample_t* dst, uint8_t max) {
+	fifo.bytes += 2;
+	if (fifo.level == 0 || max == 0)
+		return 0;
+	unsigned n = fifo.level < max ? fifo.level : max;
+	fifo.bytes += 1 + 6 * n;
+	memcpy(dst, fifo.sample, sizeof(fifo.sample[0]) * n);
+	memmove(&fifo.sample[0], &fifo.sample[n], sizeof(fifo.sample[0]) * (fifo.level - n));
+	fifo.level -= n;
+	return (uint8_t) n;
+}
+
+/**
+ * @brief Esegue una prova.
+ * @param odr frequenza di uscita (Hz)
+ * @param wtm soglia della FIFO (campioni)
+ * @param stall 1 per bloccare il consumatore per STALL_US
+ */
+static void Run(unsigned odr, unsigned wtm, int stall) {
+	static ACCRING_t ring;
+	ACCRING_Init(&ring);
+	memset(&fifo, 0, sizeof(fifo));
+	produced = 0;
+
+	unsigned long next = 0;
+	int line = 0, pending = 0, stuck = 0;
+	long irqAt = 0, maxLatency = 0;
+	uint32_t expect = 0, received = 0, missing = 0, order = 0, irqs = 0;
+
+	for (long t = 0; t < SIM_US; t++) {
+		if ((unsigned long) t * odr >= next * 1000000UL) {
+			FifoProduce(t);
+			next++;
+		}
+		/* INT1: alta finche' la FIFO contiene almeno wtm campioni; l'handler parte sul fronte di salita */
+		int level = fifo.level >= wtm;
+		if (level && !line) {
+			pending = 1;
+			irqAt = t + IRQ_LATENCY_US;
+		}
+		line = level;
+		if (pending && t >= irqAt) {
+			pending = 0;
+			irqs++;
+			ACCRING_Drain(&ring, FifoRead);
+			line = fifo.level >= wtm;
+			if (line)
+				stuck++;
+		}
+		if (t % SOF_US != 0 || (stall && t >= STALL_START_US && t < STALL_START_US + STALL_US))
+			continue;
+		ACCRING_Sample_t s;
+		while (ACCRING_Pop(&ring, &s)) {
+			uint32_t seq = (uint16_t) s.x;
+			if (s.y != -s.x || s.z != (int16_t) (s.x * 3) || seq > SEQ_MASK)
+				order++;
+			else if (seq != expect) {
+				uint32_t gap = (seq - expect) & SEQ_MASK;
+				if (gap > ring.dropped)
+					order++;
+				missing += gap;
+			}
+			expect = (seq + 1) & SEQ_MASK;
+			received++;
+			if (t - producedAt[seq] > maxLatency)
+				maxLatency = t - producedAt[seq];
+		}
+	}
+
+	/* limite di latenza: riempimento fino alla soglia, interruzione, attesa del SOF */
+	long bound = (long) wtm * 1000000L / odr + IRQ_LATENCY_US + SOF_US + 1;
+	printf("%4u Hz, soglia %2u%s: %6u interruzioni, %.2f byte SPI per campione, latenza max %.2f ms, %u scartati\n",
+			odr, wtm, stall ? ", consumatore bloccato" : "", irqs, (double) fifo.bytes / produced, maxLatency / 1000.0,
+			ring.dropped);
+	CHECK(order == 0);
+	CHECK(stuck == 0);
+	CHECK(fifo.overrun == 0);
+	CHECK(received + ring.dropped + ACCRING_Count(&ring) + fifo.level == produced);
+	CHECK(missing == ring.dropped);
+	if (stall) {
+		CHECK(ring.dropped > 0);
+		CHECK(received > (SIM_US - STALL_US) / 1000000.0 * odr - ACCRING_LENGTH);
+	}
+	else {
+		CHECK(ring.dropped == 0);
+		CHECK(maxLatency <= bound);
+	}
+}
+
+int main(void) {
+	static const unsigned odrs[] = { 400, 800, 1600 };
+	static const unsigned wtms[] = { 1, 2, 4, 8, 16, 31 };
+	for (unsigned o = 0; o < sizeof(odrs) / sizeof(odrs[0]); o++)
+		for (unsigned w = 0; w < sizeof(wtms) / sizeof(wtms[0]); w++)
+			Run(odrs[o], wtms[w], 0);
+	Run(1600, 4, 1);
+	Run(1600, 31, 1);
+	printf("accring_test: %s\n", failures == 0 ? "OK" : "FAILED");
+	return failures != 0;
+}
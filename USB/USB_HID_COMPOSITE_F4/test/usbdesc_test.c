@@ -0,0 +1,321 @@
+/**
+ * @file usbdesc_test.c
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+/**
+ * @brief Verifica su host di USBDESC con i descrittori di configurazione reali e con descrittori malformati.
+ *
+ * @details
+ * I descrittori sono quelli restituiti da GetFSConfigDescriptor() delle classi COMPOSITE e AUDIO_MIC, compilate su
+ * host con gli header HAL del progetto FreeRTOS; le funzioni del core USB che le classi invocano sono sostituite da
+ * stub, e USBD_LL_OpenEP() registra gli endpoint aperti. Per ciascun descrittore si verifica che:
+ *  - USBDESC_Validate() lo accetti e USBDESC_PlanFifo() trovi un piano valido;
+ *  - la RX FIFO non sia inferiore alla formula di RM0090 (par. 34.11), calcolata qui a partire dalle costanti della
+ *    classe, e riceva tutta la memoria non assegnata alle TX FIFO, per un totale di USBDESC_FIFO_WORDS parole;
+ *  - ogni TX FIFO abbia la dimensione attesa per l'endpoint IN corrispondente;
+ *  - gli endpoint aperti dall'Init della classe coincidano, per indirizzo, tipo e dimensione, con quelli del
+ *    descrittore, che e' l'unica fonte da cui USBD_LL_Init() ricava le FIFO.
+ *
+ * Copie modificate dei descrittori devono essere rifiutate con l'errore atteso: wTotalLength errato, descrittore che
+ * eccede la lunghezza totale, endpoint duplicato, endpoint oltre quelli del core o oltre bNumEndpoints, dimensione del
+ * pacchetto bulk, interrupt o isocrono non ammessa, intervallo di polling non valido e FIFO oltre la memoria del core.
+ * @code
+ * M=Middlewares/ST/STM32_USB_Device_Library; A=../USB_AUDIO_MIC_F4/$M/Class/AUDIO_MIC; F=../../FreeRTOS
+ * gcc -std=gnu99 -Wall -DSTM32F407xx -DUSE_HAL_DRIVER -IInc -I$M/Core/Inc -I$M/Class/COMPOSITE/Inc -I$A/Inc \
+ *     -I$F/HAL_Driver/Inc -I$F/CMSIS/device -I$F/CMSIS/core test/usbdesc_test.c Src/usbdesc.c \
+ *     $M/Class/COMPOSITE/Src/usbd_composite.c $A/Src/usbd_audio_mic.c -o usbdesc_test && ./usbdesc_test
+ * @endcode
+ */
+#include "usbdesc.h"
+#include "usbd_composite.h"
+#include "usbd_audio_mic.h"
+#include <stdio.h>
+#include <string.h>
+
+#define TEST_MAX_DESC		256		//!< dimensione massima di un descrittore modificato
+#define TEST_MAX_OPEN		8		//!< endpoint registrati da USBD_LL_OpenEP()
+
+static int failures = 0;
+
+#define CHECK(cond) do { if (!(cond)) { printf("%s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+/**
+ * @brief Endpoint aperti dall'Init della classe.
+ */
+static struct {
+	uint8_t addr;
+	uint8_t type;
+	uint16_t size;
+} opened[TEST_MAX_OPEN];
+static unsigned nOpened;
+
+USBD_StatusTypeDef USBD_LL_OpenEP(USBD_HandleTypeDef* pdev, uint8_t ep_addr, uint8_t ep_type, uint16_t ep_mps) {
+	(void) pdev;
+	if (nOpened < TEST_MAX_OPEN) {
+		opened[nOpened].addr = ep_addr;
+		opened[nOpened].type = ep_type;
+		opened[nOpened].size = ep_mps;
+	}
+	nOpened++;
+	return USBD_OK;
+}
+
+USBD_StatusTypeDef USBD_LL_CloseEP(USBD_HandleTypeDef* pdev, uint8_t ep_addr) {
+	(void) pdev;
+	(void) ep_addr;
+	return USBD_OK;
+}
+
+USBD_StatusTypeDef USBD_LL_FlushEP(USBD_HandleTypeDef* pdev, uint8_t ep_addr) {
+	(void) pdev;
+	(void) ep_addr;
+	return USBD_OK;
+}
+
+USBD_StatusTypeDef USBD_LL_Transmit(USBD_HandleTypeDef* pdev, uint8_t ep_addr, uint8_t* pbuf, uint16_t size) {
+	(void) pdev;
+	(void) ep_addr;
+	(void) pbuf;
+	(void) size;
+	return USBD_OK;
+}
+
+USBD_StatusTypeDef USBD_LL_PrepareReceive(USBD_HandleTypeDef* pdev, uint8_t ep_addr, uint8_t* pbuf, uint16_t size) {
+	(void) pdev;
+	(void) ep_addr;
+	(void) pbuf;
+	(void) size;
+	return USBD_OK;
+}
+
+uint32_t USBD_LL_GetRxDataSize(USBD_HandleTypeDef* pdev, uint8_t ep_addr) {
+	(void) pdev;
+	(void) ep_addr;
+	return 0;
+}
+
+USBD_StatusTypeDef USBD_CtlSendData(USBD_HandleTypeDef* pdev, uint8_t* buf, uint16_t len) {
+	(void) pdev;
+	(void) buf;
+	(void) len;
+	return USBD_OK;
+}
+
+USBD_StatusTypeDef USBD_CtlPrepareRx(USBD_HandleTypeDef* pdev, uint8_t* pbuf, uint16_t len) {
+	(void) pdev;
+	(void) pbuf;
+	(void) len;
+	return USBD_OK;
+}
+
+void USBD_CtlError(USBD_HandleTypeDef* pdev, USBD_SetupReqTypedef* req) {
+	(void) pdev;
+	(void) req;
+}
+
+/**
+ * @brief RX FIFO minima secondo RM0090: (5 * endpoint di controllo + 8) + (pacchetto OUT piu' grande / 4 + 1) +
+ * 2 * endpoint OUT + 1, con EP0 contato fra gli endpoint OUT.
+ */
+static uint16_t Rm0090Rx(uint16_t ctrl, uint16_t maxPacket, uint16_t nOut) {
+	return (5 * ctrl + 8) + (maxPacket / 4 + 1) + 2 * nOut + 1;
+}
+
+/**
+ * @brief TX FIFO attesa per un endpoint IN: un pacchetto, due per bulk e isocroni, almeno USBDESC_TXFIFO_MIN parole.
+ */
+static uint16_t TxWords(uint16_t size, int doubled) {
+	uint16_t words = (size + 3) / 4 * (doubled ? 2 : 1);
+	return words > USBDESC_TXFIFO_MIN ? words : USBDESC_TXFIFO_MIN;
+}
+
+/**
+ * @brief Restituisce l'offset del descrittore dell'endpoint addr, 0 se assente.
+ */
+static uint16_t FindEndpoint(const uint8_t* cfg, uint16_t len, uint8_t addr) {
+	for (uint16_t i = cfg[0]; i < len; i += cfg[i])
+		if (cfg[i + 1] == USBDESC_TYPE_ENDPOINT && cfg[i + 2] == addr)
+			return i;
+	return 0;
+}
+
+/**
+ * @brief Restituisce l'offset del descrittore dell'interfaccia itf, alternate setting alt, 0 se assente.
+ */
+static uint16_t FindInterface(const uint8_t* cfg, uint16_t len, uint8_t itf, uint8_t alt) {
+	for (uint16_t i = cfg[0]; i < len; i += cfg[i])
+		if (cfg[i + 1] == USBDESC_TYPE_INTERFACE && cfg[i + 2] == itf && cfg[i + 3] == alt)
+			return i;
+	return 0;
+}
+
+/**
+ * @brief Gli endpoint aperti dall'Init della classe coincidono con quelli dichiarati nel descrittore.
+ */
+static void CheckOpened(USBD_ClassTypeDef* cls, const uint8_t* cfg, uint16_t len) {
+	USBD_HandleTypeDef pdev;
+	unsigned declared = 0;
+	memset(&pdev, 0, sizeof(pdev));
+	nOpened = 0;
+	CHECK(cls->Init(&pdev, 0) == USBD_OK);
+	for (uint16_t i = cfg[0]; i < len; i += cfg[i])
+		if (cfg[i + 1] == USBDESC_TYPE_ENDPOINT)
+			declared++;
+	CHECK(nOpened == declared);
+	for (unsigned k = 0; k < nOpened && k < TEST_MAX_OPEN; k++) {
+		uint16_t ep = FindEndpoint(cfg, len, opened[k].addr);
+		CHECK(ep != 0);
+		if (ep == 0)
+			continue;
+		CHECK((cfg[ep + 3] & 0x03) == opened[k].type);
+		CHECK((cfg[ep + 4] | (cfg[ep + 5] << 8)) == opened[k].size);
+	}
+	cls->DeInit(&pdev, 0);
+}
+
+/**
+ * @brief Verifica un descrittore modificato.
+ */
+static USBDESC_Status_t Mutated(const uint8_t* cfg, uint16_t len, uint16_t offset, uint8_t value) {
+	uint8_t copy[TEST_MAX_DESC];
+	memcpy(copy, cfg, len);
+	copy[offset] = value;
+	return USBDESC_Validate(copy, len);
+}
+
+/**
+ * @brief Descrittore della classe COMPOSITE: HID (1 endpoint interrupt IN), CDC (interrupt IN, bulk OUT e bulk IN).
+ */
+static void TestComposite(void) {
+	USBDESC_Fifo_t plan;
+	uint16_t len;
+	const uint8_t* cfg = USBD_COMPOSITE.GetFSConfigDescriptor(&len);
+
+	CHECK(len == COMPOSITE_CONFIG_DESC_SIZE && len <= TEST_MAX_DESC);
+	CHECK(USBDESC_Validate(cfg, len) == USBDESC_OK);
+	CHECK(USBDESC_PlanFifo(cfg, len, USB_MAX_EP0_SIZE, &plan) == USBDESC_OK);
+	printf("composite: rx %u, tx %u/%u/%u/%u parole\n", plan.rx, plan.tx[0], plan.tx[1], plan.tx[2], plan.tx[3]);
+
+	/* endpoint OUT: EP0 e bulk OUT, entrambi da 64 byte */
+	uint16_t rxMin = Rm0090Rx(1, COMPOSITE_CDC_DATA_SIZE > USB_MAX_EP0_SIZE ? COMPOSITE_CDC_DATA_SIZE : USB_MAX_EP0_SIZE,
+			2);
+	CHECK(plan.nTx == 4);
+	CHECK(plan.tx[0] == TxWords(USB_MAX_EP0_SIZE, 0));
+	CHECK(plan.tx[COMPOSITE_HID_EPIN_ADDR & 0x0F] == TxWords(COMPOSITE_HID_EPIN_SIZE, 0));
+	CHECK(plan.tx[COMPOSITE_CDC_CMD_EP & 0x0F] == TxWords(COMPOSITE_CDC_CMD_SIZE, 0));
+	CHECK(plan.tx[COMPOSITE_CDC_IN_EP & 0x0F] == TxWords(COMPOSITE_CDC_DATA_SIZE, 1));
+	CHECK(plan.rx >= rxMin);
+	CHECK(plan.rx + plan.tx[0] + plan.tx[1] + plan.tx[2] + plan.tx[3] == USBDESC_FIFO_WORDS);
+	CHECK(plan.used == USBDESC_FIFO_WORDS);
+	CheckOpened(&USBD_COMPOSITE, cfg, len);
+
+	uint16_t hid = FindEndpoint(cfg, len, COMPOSITE_HID_EPIN_ADDR);
+	uint16_t cmd = FindEndpoint(cfg, len, COMPOSITE_CDC_CMD_EP);
+	uint16_t out = FindEndpoint(cfg, len, COMPOSITE_CDC_OUT_EP);
+	uint16_t in = FindEndpoint(cfg, len, COMPOSITE_CDC_IN_EP);
+	uint16_t data = FindInterface(cfg, len, COMPOSITE_CDC_DATA_ITF, 0);
+	CHECK(hid && cmd && out && in && data);
+
+	/* lunghezze */
+	CHECK(Mutated(cfg, len, 2, len + 1) == USBDESC_ERR_TOTAL);
+	CHECK(Mutated(cfg, len, 2, len - 1) == USBDESC_ERR_TOTAL);
+	CHECK(Mutated(cfg, len, in, 8) == USBDESC_ERR_LENGTH);
+	CHECK(Mutated(cfg, len, hid, 0) == USBDESC_ERR_LENGTH);
+	uint8_t cut[TEST_MAX_DESC];
+	memcpy(cut, cfg, len);
+	cut[2] = len - 7;
+	CHECK(USBDESC_Validate(cut, len - 7) == USBDESC_ERR_INTERFACE);		// manca il bulk IN dichiarato
+	/* endpoint duplicati o non disponibili sul core */
+	CHECK(Mutated(cfg, len, in + 2, COMPOSITE_HID_EPIN_ADDR) == USBDESC_ERR_ENDPOINT);
+	CHECK(Mutated(cfg, len, out + 2, COMPOSITE_CDC_OUT_EP | 0x80) == USBDESC_ERR_ENDPOINT);
+	CHECK(Mutated(cfg, len, cmd + 2, 0x80 | USBDESC_MAX_EP) == USBDESC_ERR_ENDPOINT);
+	CHECK(Mutated(cfg, len, out + 2, 0x00) == USBDESC_ERR_ENDPOINT);
+	/* troppi endpoint per l'interfaccia, o interfacce incoerenti */
+	CHECK(Mutated(cfg, len, data + 4, 1) == USBDESC_ERR_INTERFACE);
+	CHECK(Mutated(cfg, len, data + 4, 3) == USBDESC_ERR_INTERFACE);
+	CHECK(Mutated(cfg, len, 4, COMPOSITE_NUM_ITF - 1) == USBDESC_ERR_INTERFACE);
+	CHECK(Mutated(cfg, len, data + 2, COMPOSITE_CDC_CMD_ITF) == USBDESC_ERR_INTERFACE);
+	/* dimensioni dei pacchetti e polling */
+	CHECK(Mutated(cfg, len, in + 4, 48) == USBDESC_ERR_PACKET);
+	CHECK(Mutated(cfg, len, out + 4, 0) == USBDESC_ERR_PACKET);
+	CHECK(Mutated(cfg, len, in + 5, 0x02) == USBDESC_ERR_PACKET);
+	CHECK(Mutated(cfg, len, hid + 4, USBDESC_FS_MAX_PACKET + 1) == USBDESC_ERR_PACKET);
+	CHECK(Mutated(cfg, len, cmd + 4, 0) == USBDESC_ERR_PACKET);
+	CHECK(Mutated(cfg, len, hid + 6, 0) == USBDESC_ERR_PACKET);
+	for (uint16_t size = 8; size <= 64; size *= 2)
+		CHECK(Mutated(cfg, len, in + 4, size) == USBDESC_OK);
+}
+
+/**
+ * @brief Descrittore della classe AUDIO_MIC: AudioControl senza endpoint, AudioStreaming con l'alternate setting 1 che
+ * dichiara un endpoint isocrono IN.
+ */
+static void TestAudio(void) {
+	USBDESC_Fifo_t plan;
+	uint16_t len;
+	const uint8_t* cfg = USBD_AUDIO_MIC.GetFSConfigDescriptor(&len);
+
+	CHECK(len == AUDIO_MIC_CONFIG_DESC_SIZE && len <= TEST_MAX_DESC);
+	CHECK(USBDESC_Validate(cfg, len) == USBDESC_OK);
+	CHECK(USBDESC_PlanFifo(cfg, len, USB_MAX_EP0_SIZE, &plan) == USBDESC_OK);
+	printf("audio:     rx %u, tx %u/%u parole\n", plan.rx, plan.tx[0], plan.tx[1]);
+
+	/* unico endpoint OUT: EP0 */
+	CHECK(plan.nTx == 2);
+	CHECK(plan.tx[0] == TxWords(USB_MAX_EP0_SIZE, 0));
+	CHECK(plan.tx[AUDIO_MIC_EPIN_ADDR & 0x0F] == TxWords(AUDIO_MIC_EPIN_SIZE, 1));
+	CHECK(plan.rx >= Rm0090Rx(1, USB_MAX_EP0_SIZE, 1));
+	CHECK(plan.rx + plan.tx[0] + plan.tx[1] == USBDESC_FIFO_WORDS);
+	CHECK(plan.used == USBDESC_FIFO_WORDS);
+	CheckOpened(&USBD_AUDIO_MIC, cfg, len);
+
+	uint16_t ep = FindEndpoint(cfg, len, AUDIO_MIC_EPIN_ADDR);
+	uint16_t alt0 = FindInterface(cfg, len, AUDIO_MIC_AS_ITF, 0);
+	CHECK(ep && alt0);
+
+	/* il descrittore dell'endpoint audio e' lungo 9 byte: la lunghezza minima e' 7 */
+	CHECK(Mutated(cfg, len, ep, 6) == USBDESC_ERR_LENGTH);
+	CHECK(Mutated(cfg, len, 2, len + 2) == USBDESC_ERR_TOTAL);
+	CHECK(Mutated(cfg, len, alt0 + 4, 1) == USBDESC_ERR_INTERFACE);
+	CHECK(Mutated(cfg, len, ep + 2, 0x80) == USBDESC_ERR_ENDPOINT);
+	CHECK(Mutated(cfg, len, ep + 6, 2) == USBDESC_ERR_PACKET);
+	CHECK(Mutated(cfg, len, ep + 5, 0x04) == USBDESC_ERR_PACKET);		// 1024 + size > 1023
+
+	/* un endpoint isocrono da 600 byte e' ammesso, ma le sue due TX FIFO non entrano nella memoria del core */
+	uint8_t big[TEST_MAX_DESC];
+	memcpy(big, cfg, len);
+	big[ep + 4] = (uint8_t) 600;
+	big[ep + 5] = 600 >> 8;
+	CHECK(USBDESC_Validate(big, len) == USBDESC_OK);
+	CHECK(USBDESC_PlanFifo(big, len, USB_MAX_EP0_SIZE, &plan) == USBDESC_ERR_FIFO);
+	CHECK(plan.tx[AUDIO_MIC_EPIN_ADDR & 0x0F] == TxWords(600, 1));
+	CHECK(plan.used == Rm0090Rx(1, USB_MAX_EP0_SIZE, 1) + plan.tx[0] + plan.tx[1]);
+	CHECK(plan.used > USBDESC_FIFO_WORDS);
+	/* al limite: 2 * 128 parole piu' EP0 e la RX FIFO minima entrano ancora */
+	big[ep + 4] = (uint8_t) 512;
+	big[ep + 5] = 512 >> 8;
+	CHECK(USBDESC_PlanFifo(big, len, USB_MAX_EP0_SIZE, &plan) == USBDESC_OK);
+	CHECK(plan.rx == USBDESC_FIFO_WORDS - plan.tx[0] - plan.tx[1] && plan.rx >= Rm0090Rx(1, USB_MAX_EP0_SIZE, 1));
+}
+
+int main(void) {
+	TestComposite();
+	TestAudio();
+
+	printf("usbdesc: %s\n", failures ? "FAILED" : "OK");
+	return failures != 0;
+}
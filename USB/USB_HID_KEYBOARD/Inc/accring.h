@@ -0,0 +1,124 @@
+/**
+ * @file accring.h
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef ACCRING_H_
+#define ACCRING_H_
+
+/**
+ * @addtogroup USBD
+ * @{
+ * @addtogroup HID
+ * @{
+ * @defgroup ACCRING
+ * @{
+ *
+ * @brief Buffer circolare dei campioni dell'accelerometro, riempito svuotando la FIFO del sensore.
+ *
+ * @details
+ * Il LIS3DSH raccoglie i campioni nella propria FIFO alla frequenza di uscita configurata, indipendentemente dal main
+ * loop, e segnala sulla linea INT1 il raggiungimento della soglia (watermark). L'handler dell'interruzione invoca
+ * ACCRING_Drain(), che legge la FIFO finche' non e' vuota, con una lettura burst per volta direttamente nello spazio
+ * libero contiguo del buffer: svuotare completamente la FIFO riporta bassa la linea INT1, in modo che il successivo
+ * raggiungimento della soglia produca un nuovo fronte.<br>
+ * Il buffer e' lock-free con un solo produttore (l'handler) e un solo consumatore (il main loop, ACCRING_Pop()): head e
+ * tail sono contatori liberi, scritti ciascuno da un solo lato, e un campione diventa visibile al consumatore solo dopo
+ * essere stato scritto. Se il buffer e' pieno, i campioni letti dalla FIFO sono scartati e contati in dropped: la FIFO
+ * va comunque svuotata, altrimenti INT1 resterebbe alta e l'acquisizione si fermerebbe.
+ *
+ * Il modulo non dipende dalla libreria HAL: la lettura della FIFO e' fornita dall'applicazione ad ACCRING_Drain().
+ */
+
+#include <inttypes.h>
+
+#ifndef ACCRING_LENGTH
+#define ACCRING_LENGTH		128		//!< Numero di campioni memorizzabili (potenza di 2)
+#endif
+
+#define ACCRING_FIFO_DEPTH	32		//!< Profondita' della FIFO del sensore
+
+#if (ACCRING_LENGTH & (ACCRING_LENGTH - 1)) != 0
+#error "ACCRING_LENGTH deve essere una potenza di 2"
+#endif
+
+/**
+ * @brief Campione dell'accelerometro (mg), nel formato prodotto dalla lettura della FIFO.
+ */
+typedef struct {
+	int16_t x;		//!< componente lungo l'asse X
+	int16_t y;		//!< componente lungo l'asse Y
+	int16_t z;		//!< componente lungo l'asse Z
+} ACCRING_Sample_t;
+
+/**
+ * @brief Funzione che legge la FIFO del sensore.
+ * @param[out] dst campioni letti, dal piu' vecchio
+ * @param[in] max numero massimo di campioni da leggere
+ * @return numero di campioni letti, 0 se la FIFO e' vuota
+ */
+typedef uint8_t (*ACCRING_Read_t)(ACCRING_Sample_t* dst, uint8_t max);
+
+/**
+ * @brief Struttura che rappresenta il buffer circolare.
+ * @details Il buffer viene letto dal DMA: non deve essere allocato nella CCM RAM.
+ */
+typedef struct {
+	ACCRING_Sample_t sample[ACCRING_LENGTH];		//!< campioni
+	ACCRING_Sample_t discard[ACCRING_FIFO_DEPTH];	//!< destinazione dei campioni scartati a buffer pieno
+	volatile uint32_t head;				//!< campioni scritti dall'avvio (produttore)
+	volatile uint32_t tail;				//!< campioni letti dall'avvio (consumatore)
+	volatile uint32_t dropped;			//!< campioni scartati a buffer pieno
+	uint32_t drains;					//!< svuotamenti della FIFO eseguiti
+} ACCRING_t;
+
+/**
+ * @brief Inizializza il buffer circolare, vuoto.
+ * @param[inout] r puntatore al buffer
+ */
+void ACCRING_Init(ACCRING_t* r);
+
+/**
+ * @brief Svuota la FIFO del sensore nel buffer; da invocare nell'handler dell'interruzione di watermark.
+ * @param[inout] r puntatore al buffer
+ * @param[in] read funzione di lettura della FIFO
+ * @return numero di campioni letti dalla FIFO, compresi quelli scartati
+ */
+uint32_t ACCRING_Drain(ACCRING_t* r, ACCRING_Read_t read);
+
+/**
+ * @brief Preleva il campione piu' vecchio.
+ * @param[inout] r puntatore al buffer
+ * @param[out] s campione prelevato
+ * @retval 1 se e' stato prelevato un campione
+ * @retval 0 se il buffer e' vuoto
+ */
+uint8_t ACCRING_Pop(ACCRING_t* r, ACCRING_Sample_t* s);
+
+/**
+ * @brief Restituisce il numero di campioni presenti nel buffer.
+ * @param[in] r puntatore al buffer
+ */
+uint32_t ACCRING_Count(const ACCRING_t* r);
+
+/**
+ * @}
+ * @}
+ * @}
+ */
+
+#endif /* ACCRING_H_ */
@@ -0,0 +1,224 @@
+/**
+ * @file gesture.h
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef GESTURE_H_
+#define GESTURE_H_
+
+/**
+ * @addtogroup USBD
+ * @{
+ * @addtogroup HID
+ * @{
+ * @addtogroup KeyBoard
+ * @{
+ * @defgroup GESTURE
+ * @{
+ *
+ * @brief Riconoscimento di gesti (tap, doppio tap, flick, scuotimento, inclinazione) dai campioni dell'accelerometro.
+ *
+ * @details
+ * Il riconoscimento e' una macchina a stati che elabora un campione alla volta, alla frequenza di uscita
+ * dell'accelerometro, in sola aritmetica intera: ogni campione costa un numero costante di operazioni (alcune decine
+ * di moltiplicazioni e confronti, senza cicli che dipendano dal segnale), per cui il tempo di elaborazione per
+ * campione e' limitato e indipendente dalla storia del segnale. Tutte le durate sono espresse in millisecondi e convertite in numero di
+ * campioni in GESTURE_Init(), in base alla frequenza di campionamento.<br>
+ * Ogni campione viene scomposto in:
+ *  - gravita': media mobile esponenziale del campione, con costante di tempo di circa GESTURE_GRAVITY_MS. Durante un
+ *    impulso la stima viene congelata, in modo che il movimento non venga scambiato per un'inclinazione, ma solo fino
+ *    a GESTURE_FLICK_MAX_MS: un cambio di orientamento rapido non blocca la stima;
+ *  - componente dinamica: differenza tra campione e gravita', di cui si valuta il modulo al quadrato (senza radice).
+ *
+ * Un impulso inizia quando il modulo della componente dinamica supera GESTURE_IMPULSE_ON e termina quando resta sotto
+ * GESTURE_IMPULSE_OFF per GESTURE_RELEASE_MS, in modo che i due lobi di un flick non vengano separati. Alla fine
+ * dell'impulso:
+ *  - se e' durato al piu' GESTURE_TAP_MAX_MS e il picco ha superato GESTURE_TAP_PEAK, e' un tap. Dopo un tap si
+ *    ignorano le oscillazioni per GESTURE_TAP_QUIET_MS; un secondo tap entro GESTURE_TAP_WINDOW_MS produce
+ *    GESTURE_DOUBLE_TAP, altrimenti allo scadere della finestra viene prodotto GESTURE_TAP;
+ *  - se e' durato al piu' GESTURE_FLICK_MAX_MS ed e' bifasico lungo l'asse X o Y dominante (accelerazione oltre
+ *    GESTURE_FLICK_PEAK e decelerazione opposta di almeno la meta'), e' un flick nella direzione del primo lobo.
+ *    Un cambio di inclinazione, che e' un gradino e non un impulso bifasico, non produce flick;
+ *  - altrimenti (movimento lungo o debole) non viene prodotto alcun evento.
+ *
+ * Lo scuotimento e' riconosciuto in parallelo, contando le inversioni di segno dell'asse X o Y oltre
+ * GESTURE_SHAKE_LEVEL: GESTURE_SHAKE_REVERSALS inversioni, ciascuna entro GESTURE_SHAKE_GAP_MS dalla precedente,
+ * producono GESTURE_SHAKE e annullano tap e flick in corso. Tap e flick restano ignorati finche' lo scuotimento
+ * prosegue (escursioni a meno di GESTURE_SHAKE_GAP_MS l'una dall'altra), e comunque per GESTURE_SHAKE_REFRACTORY_MS;
+ * uno scuotimento lungo produce un GESTURE_SHAKE per ogni periodo refrattario.<br>
+ * L'inclinazione e' uno stato, non un evento: una direzione risulta attiva quando la gravita' lungo l'asse supera la
+ * soglia di inclinazione da almeno GESTURE_TILT_HOLD_MS, e torna inattiva quando scende sotto la meta' della soglia
+ * (isteresi).
+ *
+ * Convenzione degli assi, come nel progetto: +X destra, +Y avanti (su). Il modulo non dipende dalla libreria HAL.
+ */
+
+#include <inttypes.h>
+
+#ifndef GESTURE_GRAVITY_MS
+#define GESTURE_GRAVITY_MS			100		//!< Costante di tempo della stima della gravita' (ms)
+#endif
+#ifndef GESTURE_IMPULSE_ON
+#define GESTURE_IMPULSE_ON			600		//!< Inizio di un impulso (mg)
+#endif
+#ifndef GESTURE_IMPULSE_OFF
+#define GESTURE_IMPULSE_OFF			300		//!< Fine di un impulso (mg)
+#endif
+#ifndef GESTURE_RELEASE_MS
+#define GESTURE_RELEASE_MS			20		//!< Permanenza sotto GESTURE_IMPULSE_OFF che chiude un impulso (ms)
+#endif
+#ifndef GESTURE_TAP_PEAK
+#define GESTURE_TAP_PEAK			1200	//!< Picco minimo di un tap (mg)
+#endif
+#ifndef GESTURE_TAP_MAX_MS
+#define GESTURE_TAP_MAX_MS			40		//!< Durata massima di un tap (ms)
+#endif
+#ifndef GESTURE_TAP_QUIET_MS
+#define GESTURE_TAP_QUIET_MS		60		//!< Oscillazioni ignorate dopo un tap (ms)
+#endif
+#ifndef GESTURE_TAP_WINDOW_MS
+#define GESTURE_TAP_WINDOW_MS		300		//!< Finestra, dalla fine del primo tap, per il secondo tap (ms)
+#endif
+#ifndef GESTURE_FLICK_PEAK
+#define GESTURE_FLICK_PEAK			700		//!< Picco minimo del primo lobo di un flick (mg)
+#endif
+#ifndef GESTURE_FLICK_MAX_MS
+#define GESTURE_FLICK_MAX_MS		300		//!< Durata massima di un flick (ms)
+#endif
+#ifndef GESTURE_SHAKE_LEVEL
+#define GESTURE_SHAKE_LEVEL			900		//!< Escursione che conta come inversione di uno scuotimento (mg)
+#endif
+#ifndef GESTURE_SHAKE_REVERSALS
+#define GESTURE_SHAKE_REVERSALS		4		//!< Inversioni che formano uno scuotimento
+#endif
+#ifndef GESTURE_SHAKE_GAP_MS
+#define GESTURE_SHAKE_GAP_MS		300		//!< Intervallo massimo tra due inversioni (ms)
+#endif
+#ifndef GESTURE_SHAKE_REFRACTORY_MS
+#define GESTURE_SHAKE_REFRACTORY_MS	600		//!< Eventi ignorati dopo uno scuotimento (ms)
+#endif
+#ifndef GESTURE_TILT_HOLD_MS
+#define GESTURE_TILT_HOLD_MS		150		//!< Permanenza dell'inclinazione che attiva una direzione (ms)
+#endif
+
+#define GESTURE_TILT_LEFT			0x01	//!< Inclinazione a sinistra (-X)
+#define GESTURE_TILT_RIGHT			0x02	//!< Inclinazione a destra (+X)
+#define GESTURE_TILT_DOWN			0x04	//!< Inclinazione indietro (-Y)
+#define GESTURE_TILT_UP				0x08	//!< Inclinazione in avanti (+Y)
+
+/**
+ * @brief Eventi prodotti dal riconoscimento; al piu' un evento per campione.
+ */
+typedef enum {
+	GESTURE_NONE = 0,			//!< nessun evento
+	GESTURE_TAP,				//!< tap singolo
+	GESTURE_DOUBLE_TAP,			//!< due tap ravvicinati
+	GESTURE_FLICK_LEFT,			//!< movimento rapido verso -X
+	GESTURE_FLICK_RIGHT,		//!< movimento rapido verso +X
+	GESTURE_FLICK_DOWN,			//!< movimento rapido verso -Y
+	GESTURE_FLICK_UP,			//!< movimento rapido verso +Y
+	GESTURE_SHAKE,				//!< scuotimento
+	GESTURE_N_EVENTS			//!< numero di eventi, compreso GESTURE_NONE
+} GESTURE_Event_t;
+
+/**
+ * @brief Fase del riconoscimento degli impulsi.
+ */
+typedef enum {
+	GESTURE_IDLE = 0,			//!< in attesa di un impulso
+	GESTURE_ACTIVE,				//!< impulso in corso
+	GESTURE_QUIET,				//!< oscillazioni ignorate dopo un evento
+	GESTURE_WAIT_TAP,			//!< in attesa dell'eventuale secondo tap
+	GESTURE_SHAKING				//!< scuotimento in corso, impulsi ignorati
+} GESTURE_Phase_t;
+
+/**
+ * @brief Struttura che rappresenta lo stato del riconoscimento.
+ */
+typedef struct {
+	/* durate, in campioni */
+	uint16_t releaseLen;		//!< GESTURE_RELEASE_MS
+	uint16_t tapMax;			//!< GESTURE_TAP_MAX_MS
+	uint16_t tapQuiet;			//!< GESTURE_TAP_QUIET_MS
+	uint16_t tapWindow;			//!< GESTURE_TAP_WINDOW_MS
+	uint16_t flickMax;			//!< GESTURE_FLICK_MAX_MS
+	uint16_t shakeGap;			//!< GESTURE_SHAKE_GAP_MS
+	uint16_t shakeRefractory;	//!< GESTURE_SHAKE_REFRACTORY_MS
+	uint16_t tiltHold;			//!< GESTURE_TILT_HOLD_MS
+	uint8_t gravityShift;		//!< costante di tempo della gravita', in potenze di 2 campioni
+	/* gravita' */
+	int32_t gravity[3];			//!< stima della gravita', in Q(gravityShift)
+	uint8_t primed;				//!< 1 se la stima della gravita' e' stata inizializzata
+	/* impulsi */
+	GESTURE_Phase_t phase;		//!< fase corrente
+	uint16_t timer;				//!< campioni trascorsi nella fase corrente
+	uint16_t duration;			//!< campioni dall'inizio dell'impulso all'ultimo sopra GESTURE_IMPULSE_OFF
+	uint16_t below;				//!< campioni consecutivi sotto GESTURE_IMPULSE_OFF
+	uint16_t quietLen;			//!< durata della fase GESTURE_QUIET in corso
+	uint32_t peak2;			//!< picco del modulo al quadrato della componente dinamica
+	uint8_t axis;				//!< asse (0 = X, 1 = Y) dominante all'inizio dell'impulso
+	int8_t sign;				//!< segno del primo lobo lungo axis
+	int16_t lobe1;				//!< picco del primo lobo lungo axis
+	int16_t lobe2;				//!< picco del lobo opposto lungo axis
+	int16_t peakZ;				//!< picco di |Z| durante l'impulso
+	uint8_t taps;				//!< tap della sequenza in corso
+	/* scuotimento */
+	uint8_t shakeAxis;			//!< asse dell'ultima escursione
+	int8_t shakeSign;			//!< segno dell'ultima escursione, 0 se nessuna
+	uint8_t shakeCount;			//!< inversioni contate
+	uint16_t shakeTimer;		//!< campioni dall'ultima escursione
+	uint16_t shakeHold;			//!< campioni in cui le inversioni non vengono contate, dopo uno scuotimento
+	/* inclinazione */
+	int16_t tiltOn;				//!< soglia di attivazione (mg)
+	int16_t tiltOff;			//!< soglia di rilascio (mg)
+	uint8_t tilt;				//!< direzioni attive, GESTURE_TILT_*
+	uint16_t tiltTimer[4];		//!< permanenza oltre la soglia di ciascuna direzione
+} GESTURE_t;
+
+/**
+ * @brief Inizializza il riconoscimento.
+ * @param[inout] g puntatore allo stato
+ * @param[in] rate frequenza di campionamento (Hz)
+ * @param[in] tiltThreshold soglia di inclinazione (mg); il rilascio avviene alla meta'
+ */
+void GESTURE_Init(GESTURE_t* g, uint16_t rate, int16_t tiltThreshold);
+
+/**
+ * @brief Elabora un campione.
+ * @param[inout] g puntatore allo stato
+ * @param[in] x componente lungo l'asse X (mg)
+ * @param[in] y componente lungo l'asse Y (mg)
+ * @param[in] z componente lungo l'asse Z (mg)
+ * @return evento riconosciuto con questo campione, GESTURE_NONE se nessuno
+ */
+GESTURE_Event_t GESTURE_Process(GESTURE_t* g, int16_t x, int16_t y, int16_t z);
+
+/**
+ * @brief Restituisce le direzioni di inclinazione attive.
+ * @param[in] g puntatore allo stato
+ * @return maschera di bit GESTURE_TILT_*
+ */
+uint8_t GESTURE_Tilt(const GESTURE_t* g);
+
+/**
+ * @}
+ * @}
+ * @}
+ * @}
+ */
+
+#endif /* GESTURE_H_ */
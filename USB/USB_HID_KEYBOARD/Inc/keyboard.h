@@ -0,0 +1,138 @@
+/**
+ * @file keyboard.h
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef KEYBOARD_H_
+#define KEYBOARD_H_
+
+/**
+ * @addtogroup USBD
+ * @{
+ * @addtogroup HID
+ * @{
+ * @addtogroup KeyBoard
+ * @{
+ * @defgroup KEYBOARD
+ * @{
+ *
+ * @brief Stato della tastiera e costruzione dei report NKRO e boot.
+ *
+ * @details
+ * Il modulo mantiene lo stato di ciascun tasto (premuto / rilasciato) e costruisce i report da trasmettere all'host
+ * solo quando lo stato cambia: la ripetizione automatica (typematic) di un tasto tenuto premuto e' gestita dall'host.<br>
+ * Sono supportati due formati di report:
+ *  - report protocol, N-key rollover: modificatori, un byte riservato e una bitmap con un bit per ciascun usage della
+ *    Keyboard/Keypad page da 0x00 a KEYBOARD_NKRO_MAX_USAGE (KEYBOARD_NKRO_REPORT_SIZE byte);
+ *  - boot protocol, 6-key rollover: modificatori, un byte riservato e fino a 6 usage premuti (8 byte). Se sono premuti
+ *    piu' di 6 tasti, il report riporta ErrorRollOver in tutte le posizioni, come previsto dalla specifica HID.
+ *
+ * La scelta del formato spetta all'host, con la richiesta SET_PROTOCOL. Il modulo non dipende dalla libreria HAL.
+ */
+
+#include <inttypes.h>
+
+#define KEYBOARD_NKRO_MAX_USAGE		0x67	//!< Ultimo usage rappresentato nella bitmap (Keypad =)
+#define KEYBOARD_BITMAP_SIZE		((KEYBOARD_NKRO_MAX_USAGE + 8) / 8)	//!< Byte della bitmap
+#define KEYBOARD_NKRO_REPORT_SIZE	(2 + KEYBOARD_BITMAP_SIZE)			//!< Dimensione del report NKRO
+#define KEYBOARD_BOOT_REPORT_SIZE	8		//!< Dimensione del report boot
+#define KEYBOARD_BOOT_KEYS			6		//!< Tasti riportati nel report boot
+
+#define KEYBOARD_ERROR_ROLLOVER		0x01	//!< Usage ErrorRollOver
+#define KEYBOARD_FIRST_KEY			0x04	//!< Primo usage di un tasto (Keyboard a); 0x00 - 0x03 sono codici riservati o di errore
+#define KEYBOARD_LEFT_CTRL			0xE0	//!< Primo usage modificatore
+#define KEYBOARD_RIGHT_GUI			0xE7	//!< Ultimo usage modificatore
+
+/**
+ * @brief Formato del report.
+ */
+typedef enum {
+	KEYBOARD_BOOT = 0,		//!< boot protocol, 6KRO (valore di SET_PROTOCOL)
+	KEYBOARD_NKRO = 1		//!< report protocol, bitmap NKRO (valore di SET_PROTOCOL)
+} KEYBOARD_Protocol_t;
+
+/**
+ * @brief Struttura che rappresenta lo stato della tastiera.
+ */
+typedef struct {
+	uint8_t modifiers;							//!< stato dei modificatori (usage 0xE0 - 0xE7)
+	uint8_t bitmap[KEYBOARD_BITMAP_SIZE];		//!< stato dei tasti, un bit per usage
+	uint8_t changed;							//!< 1 se lo stato e' cambiato dall'ultimo report costruito
+} KEYBOARD_t;
+
+/**
+ * @brief Inizializza la tastiera, con tutti i tasti rilasciati.
+ * @param[out] k puntatore alla tastiera
+ */
+void KEYBOARD_Init(KEYBOARD_t* k);
+
+/**
+ * @brief Aggiorna lo stato di un tasto.
+ * @param[inout] k puntatore alla tastiera
+ * @param[in] usage usage del tasto nella Keyboard/Keypad page; gli usage non rappresentabili sono ignorati
+ * @param[in] pressed 1 se il tasto e' premuto, 0 se e' rilasciato
+ */
+void KEYBOARD_Set(KEYBOARD_t* k, uint8_t usage, uint8_t pressed);
+
+/**
+ * @brief Restituisce lo stato di un tasto.
+ * @param[in] k puntatore alla tastiera
+ * @param[in] usage usage del tasto nella Keyboard/Keypad page
+ * @retval 1 se il tasto e' premuto
+ * @retval 0 se il tasto e' rilasciato o non rappresentabile
+ */
+uint8_t KEYBOARD_IsPressed(const KEYBOARD_t* k, uint8_t usage);
+
+/**
+ * @brief Verifica se lo stato e' cambiato dall'ultimo report costruito.
+ * @param[in] k puntatore alla tastiera
+ */
+uint8_t KEYBOARD_Changed(const KEYBOARD_t* k);
+
+/**
+ * @brief Forza la costruzione di un nuovo report, ad esempio dopo un cambio di protocollo.
+ * @param[inout] k puntatore alla tastiera
+ */
+void KEYBOARD_Invalidate(KEYBOARD_t* k);
+
+/**
+ * @brief Costruisce il report corrispondente allo stato corrente.
+ * @param[inout] k puntatore alla tastiera
+ * @param[in] protocol formato del report
+ * @param[out] report buffer di almeno KEYBOARD_NKRO_REPORT_SIZE byte; i byte non usati dal formato boot sono azzerati
+ * @return lunghezza del report
+ */
+uint8_t KEYBOARD_BuildReport(KEYBOARD_t* k, KEYBOARD_Protocol_t protocol, uint8_t* report);
+
+/**
+ * @brief Converte un report NKRO nel report boot equivalente.
+ * @details Permette di accodare i soli report NKRO, in cui ogni tasto e' rappresentato da un bit, e di scegliere il
+ * formato al momento della trasmissione, in base al protocollo selezionato dall'host.
+ * @param[in] nkro report NKRO, di KEYBOARD_NKRO_REPORT_SIZE byte
+ * @param[out] boot report boot, di KEYBOARD_BOOT_REPORT_SIZE byte; non deve sovrapporsi a nkro
+ * @return lunghezza del report boot
+ */
+uint8_t KEYBOARD_ToBoot(const uint8_t* nkro, uint8_t* boot);
+
+/**
+ * @}
+ * @}
+ * @}
+ * @}
+ */
+
+#endif /* KEYBOARD_H_ */
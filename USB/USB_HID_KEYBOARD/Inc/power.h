@@ -0,0 +1,157 @@
+/**
+ * @file power.h
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef POWER_H_
+#define POWER_H_
+
+/**
+ * @addtogroup USBD
+ * @{
+ * @addtogroup HID
+ * @{
+ * @defgroup POWER
+ * @{
+ *
+ * @brief Gestione della sospensione del bus USB e del remote wakeup.
+ *
+ * @details
+ * Macchina a stati, indipendente dalla libreria HAL e dallo stack USB, invocata dal main loop ad ogni iterazione con
+ * POWER_Process(), a cui vengono passati lo stato del bus (sospeso o meno) e il tempo corrente in millisecondi. Gli
+ * interventi sull'hardware sono delegati alle funzioni di POWER_Hooks_t, fornite dall'applicazione.
+ *  - POWER_ACTIVE: il bus e' attivo e l'applicazione lavora normalmente. Quando l'host sospende il bus viene invocato
+ *    suspend(), che porta l'accelerometro e i led nella configurazione a basso consumo, e si passa in POWER_SUSPENDED.
+ *  - POWER_SUSPENDED: in assenza di richieste di risveglio viene invocato sleep(), che ferma il processore (stop mode)
+ *    fino all'interruzione successiva. Le richieste di risveglio sono prodotte dall'applicazione con POWER_Wake(), ad
+ *    esempio alla pressione di un tasto, o da POWER_Motion(), che confronta ogni campione dell'accelerometro con il
+ *    primo acquisito in sospensione. Se l'host ha abilitato il remote wakeup (wakeupEnabled()) e il bus e' sospeso da
+ *    almeno POWER_IDLE_MS, viene avviata la segnalazione di resume con wakeupStart() e si passa in POWER_RESUMING; se
+ *    l'host non lo ha abilitato la richiesta viene scartata. Se e' l'host a riprendere il bus viene invocato resume()
+ *    e si torna in POWER_ACTIVE.
+ *  - POWER_RESUMING: la segnalazione di resume dura POWER_RESUME_SIGNAL_MS (la specifica USB la vuole tra 1 e 15 ms),
+ *    al termine della quale viene invocato wakeupStop(). Quando l'host riprende il bus viene invocato resume() e si
+ *    torna in POWER_ACTIVE; se l'host non lo fa entro POWER_RESUME_TIMEOUT_MS si torna in POWER_SUSPENDED.
+ *
+ * Il tempo non avanza mentre il processore e' in stop mode (il SysTick e' fermo), per cui POWER_IDLE_MS e' misurato
+ * sul solo tempo di esecuzione, per eccesso.
+ */
+
+#include <inttypes.h>
+
+#ifndef POWER_IDLE_MS
+#define POWER_IDLE_MS				5		//!< Sospensione minima prima di un remote wakeup (ms)
+#endif
+#ifndef POWER_RESUME_SIGNAL_MS
+#define POWER_RESUME_SIGNAL_MS		10		//!< Durata della segnalazione di resume (ms)
+#endif
+#ifndef POWER_RESUME_TIMEOUT_MS
+#define POWER_RESUME_TIMEOUT_MS		100		//!< Attesa massima del resume dell'host dopo un remote wakeup (ms)
+#endif
+
+/**
+ * @brief Stato della gestione della sospensione.
+ */
+typedef enum {
+	POWER_ACTIVE = 0,	//!< bus attivo
+	POWER_SUSPENDED,	//!< bus sospeso, dispositivo a basso consumo
+	POWER_RESUMING		//!< remote wakeup segnalato, in attesa del resume dell'host
+} POWER_State_t;
+
+/**
+ * @brief Funzioni con cui la macchina a stati interviene sull'hardware; ricevono il contesto passato a POWER_Init().
+ */
+typedef struct {
+	void (*suspend)(void* ctx);				//!< porta sensori e led nella configurazione a basso consumo
+	void (*resume)(void* ctx);				//!< ripristina la configurazione di funzionamento normale
+	void (*sleep)(void* ctx);				//!< attende a basso consumo l'interruzione successiva, con le interruzioni
+											//!< disabilitate, solo se non ci sono eventi da elaborare (POWER_WakePending()
+											//!< compreso); ritorna con i clock ripristinati
+	void (*wakeupStart)(void* ctx);			//!< avvia la segnalazione di resume sul bus
+	void (*wakeupStop)(void* ctx);			//!< termina la segnalazione di resume
+	uint8_t (*wakeupEnabled)(void* ctx);	//!< 1 se l'host ha abilitato il remote wakeup
+} POWER_Hooks_t;
+
+/**
+ * @brief Struttura che rappresenta la gestione della sospensione.
+ * @details POWER_Wake() puo' essere invocata in contesto di interruzione; le altre funzioni dal solo main loop.
+ */
+typedef struct {
+	const POWER_Hooks_t* hooks;		//!< funzioni di intervento sull'hardware
+	void* ctx;						//!< contesto passato alle funzioni di hooks
+	POWER_State_t state;			//!< stato corrente
+	uint32_t since;					//!< istante di ingresso nello stato corrente (ms)
+	volatile uint8_t wakeRequest;	//!< 1 se e' stato richiesto un risveglio non ancora servito
+	uint8_t signalling;				//!< 1 se la segnalazione di resume e' in corso
+	int16_t motionThreshold;		//!< scostamento da #ref che costituisce un movimento (mg)
+	int16_t ref[3];					//!< campione di riferimento per il rilevamento del movimento
+	uint8_t refValid;				//!< 1 se #ref e' stato acquisito
+	uint32_t wakeups;				//!< remote wakeup segnalati
+} POWER_t;
+
+/**
+ * @brief Inizializza la gestione della sospensione, nello stato POWER_ACTIVE.
+ * @param[inout] p puntatore alla struttura
+ * @param[in] hooks funzioni di intervento sull'hardware
+ * @param[in] ctx contesto passato alle funzioni di hooks
+ * @param[in] motionThreshold scostamento di un asse, rispetto al campione di riferimento, che costituisce un
+ * 			movimento (mg)
+ */
+void POWER_Init(POWER_t* p, const POWER_Hooks_t* hooks, void* ctx, int16_t motionThreshold);
+
+/**
+ * @brief Aggiorna la macchina a stati; va invocata ad ogni iterazione del main loop.
+ * @details In POWER_SUSPENDED, in assenza di richieste di risveglio, non ritorna fino all'interruzione successiva.
+ * @param[inout] p puntatore alla struttura
+ * @param[in] busSuspended 1 se il bus e' sospeso
+ * @param[in] now tempo corrente (ms)
+ * @return stato corrente: l'applicazione lavora normalmente solo in POWER_ACTIVE
+ */
+POWER_State_t POWER_Process(POWER_t* p, uint8_t busSuspended, uint32_t now);
+
+/**
+ * @brief Richiede il risveglio dell'host; ignorata se il bus non e' sospeso.
+ * @param[inout] p puntatore alla struttura
+ */
+void POWER_Wake(POWER_t* p);
+
+/**
+ * @brief Verifica se c'e' una richiesta di risveglio non ancora servita.
+ * @details Va verificata dalla funzione sleep() con le interruzioni disabilitate, subito prima di fermare il
+ * 			processore: una richiesta prodotta da un'interruzione servita dopo l'ultimo POWER_Process() andrebbe persa.
+ * @param[in] p puntatore alla struttura
+ * @return 1 se c'e' una richiesta di risveglio
+ */
+uint8_t POWER_WakePending(const POWER_t* p);
+
+/**
+ * @brief Elabora un campione dell'accelerometro acquisito in sospensione: uno scostamento di un asse oltre la soglia,
+ * 			rispetto al primo campione, richiede il risveglio dell'host.
+ * @param[inout] p puntatore alla struttura
+ * @param[in] x componente lungo l'asse X (mg)
+ * @param[in] y componente lungo l'asse Y (mg)
+ * @param[in] z componente lungo l'asse Z (mg)
+ */
+void POWER_Motion(POWER_t* p, int16_t x, int16_t y, int16_t z);
+
+/**
+ * @}
+ * @}
+ * @}
+ */
+
+#endif /* POWER_H_ */
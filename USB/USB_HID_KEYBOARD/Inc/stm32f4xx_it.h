@@ -48,7 +48,9 @@
 void SVC_Handler(void);
 void PendSV_Handler(void);
 void SysTick_Handler(void);
+void EXTI0_IRQHandler(void);
 void OTG_FS_IRQHandler(void);
+void OTG_FS_WKUP_IRQHandler(void);
 
 #ifdef __cplusplus
 }
@@ -50,11 +50,11 @@
   * @{
   */ 
 #define HID_EPIN_ADDR                 0x81
-#define HID_EPIN_SIZE                 0x05		// dimensione della struttura inviata nel report
+#define HID_EPIN_SIZE                 0x0F		// dimensione del report NKRO (KEYBOARD_NKRO_REPORT_SIZE)
 
 #define USB_HID_CONFIG_DESC_SIZ       34
 #define USB_HID_DESC_SIZ              9
-#define HID_CUSTOM_REPORT_DESC_SIZE   41		// dimensione del descrittore hid custom
+#define HID_CUSTOM_REPORT_DESC_SIZE   39		// dimensione del descrittore hid custom
 
 #define HID_DESCRIPTOR_TYPE           0x21
 #define HID_REPORT_DESC               0x22
@@ -128,6 +128,11 @@ uint8_t USBD_HID_SendReport (USBD_HandleTypeDef *pdev,
 
 uint32_t USBD_HID_GetPollingInterval (USBD_HandleTypeDef *pdev);
 
+void USBD_HID_ReportSentCallback (USBD_HandleTypeDef *pdev);
+void USBD_HID_DeInitCallback (USBD_HandleTypeDef *pdev);
+
+uint8_t USBD_HID_GetProtocol (USBD_HandleTypeDef *pdev);
+
 /**
   * @}
   */ 
@@ -146,7 +146,7 @@ __ALIGN_BEGIN static uint8_t USBD_HID_CfgDesc[USB_HID_CONFIG_DESC_SIZ]  __ALIGN_
   0x01,         /*bConfigurationValue: Configuration value*/
   0x00,         /*iConfiguration: Index of string descriptor describing
   the configuration*/
-  0xE0,         /*bmAttributes: bus powered and Support Remote Wake-up */
+  0xE0,         /*bmAttributes: self powered and Support Remote Wake-up */
   0x32,         /*MaxPower 100 mA: this current is used for detecting Vbus*/
   
   /************** Descriptor of Joystick Mouse interface ****************/
@@ -157,7 +157,7 @@ __ALIGN_BEGIN static uint8_t USBD_HID_CfgDesc[USB_HID_CONFIG_DESC_SIZ]  __ALIGN_
   0x00,         /*bAlternateSetting: Alternate setting*/
   0x01,         /*bNumEndpoints*/
   0x03,         /*bInterfaceClass: HID*/
-  0x00,         /*bInterfaceSubClass : 1=BOOT, 0=no boot*/
+  0x01,         /*bInterfaceSubClass : 1=BOOT, 0=no boot*/
   0x01,         /*nInterfaceProtocol : 0=none, 1=keyboard, 2=mouse*/
   0,            /*iInterface: Index of string descriptor*/
   /******************** Descriptor of Joystick Mouse HID ********************/
@@ -217,29 +217,31 @@ __ALIGN_BEGIN static uint8_t USBD_HID_DeviceQualifierDesc[USB_LEN_DEV_QUALIFIER_
 
 /**
  * @brief Struttura che definisce il descrittore di una custom human interface device configuarata come keyboard.
+ * @details Report protocol, N-key rollover: modificatori, un byte riservato e una bitmap con un bit per ciascun usage
+ * della Keyboard/Keypad page da 0x00 a 0x67. In boot protocol l'host ignora il descrittore e si attende il report boot
+ * a 8 byte (modificatori, riservato, 6 tasti).
  */
 __ALIGN_BEGIN static uint8_t HID_CUSTOM_ReportDesc[HID_CUSTOM_REPORT_DESC_SIZE]  __ALIGN_END = {
-  // 41 bytes
+  // 39 bytes
   0x05, 0x01,        // Usage Page (Generic Desktop Ctrls)
   0x09, 0x06,        // Usage (Keyboard)
   0xA1, 0x01,        // Collection (Application)
-  0x85, 0x01,        //   Report ID (1)
   0x05, 0x07,        //   Usage Page (Kbrd/Keypad)
-  0x75, 0x01,        //   Report Size (1)
-  0x95, 0x08,        //   Report Count (8)
   0x19, 0xE0,        //   Usage Minimum (0xE0)
   0x29, 0xE7,        //   Usage Maximum (0xE7)
   0x15, 0x00,        //   Logical Minimum (0)
   0x25, 0x01,        //   Logical Maximum (1)
+  0x75, 0x01,        //   Report Size (1)
+  0x95, 0x08,        //   Report Count (8)
   0x81, 0x02,        //   Input (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position)
-  0x95, 0x03,        //   Report Count (3)
   0x75, 0x08,        //   Report Size (8)
-  0x15, 0x00,        //   Logical Minimum (0)
-  0x25, 0x64,        //   Logical Maximum (100)
-  0x05, 0x07,        //   Usage Page (Kbrd/Keypad)
+  0x95, 0x01,        //   Report Count (1)
+  0x81, 0x01,        //   Input (Const,Array,Abs,No Wrap,Linear,Preferred State,No Null Position)
   0x19, 0x00,        //   Usage Minimum (0x00)
-  0x29, 0x65,        //   Usage Maximum (0x65)
-  0x81, 0x00,        //   Input (Data,Array,Abs,No Wrap,Linear,Preferred State,No Null Position)
+  0x29, 0x67,        //   Usage Maximum (0x67)
+  0x75, 0x01,        //   Report Size (1)
+  0x95, 0x68,        //   Report Count (104)
+  0x81, 0x02,        //   Input (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position)
   0xC0,              // End Collection
 };
 
@@ -278,6 +280,8 @@ static uint8_t  USBD_HID_Init (USBD_HandleTypeDef *pdev,
   else
   {
     ((USBD_HID_HandleTypeDef *)pdev->pClassData)->state = HID_IDLE;
+    /* The device starts in report protocol, as required by the HID spec */
+    ((USBD_HID_HandleTypeDef *)pdev->pClassData)->Protocol = 1;
   }
   return ret;
 }
@@ -296,6 +300,9 @@ static uint8_t  USBD_HID_DeInit (USBD_HandleTypeDef *pdev,
   USBD_LL_CloseEP(pdev,
                   HID_EPIN_ADDR);
   
+  /* A report in flight will never complete: let the application release it */
+  USBD_HID_DeInitCallback(pdev);
+  
   /* FRee allocated memory */
   if(pdev->pClassData != NULL)
   {
@@ -393,7 +400,9 @@ static uint8_t  USBD_HID_Setup (USBD_HandleTypeDef *pdev,
   *         Send HID Report
   * @param  pdev: device instance
   * @param  buff: pointer to report
-  * @retval status
+  * @retval status: USBD_OK if the transfer has been started, USBD_BUSY if the
+  *         previous report is still in progress, USBD_FAIL if the device is
+  *         not configured. The report is not sent unless USBD_OK is returned.
   */
 uint8_t USBD_HID_SendReport     (USBD_HandleTypeDef  *pdev, 
                                  uint8_t *report,
@@ -401,17 +410,19 @@ uint8_t USBD_HID_SendReport     (USBD_HandleTypeDef  *pdev,
 {
   USBD_HID_HandleTypeDef     *hhid = (USBD_HID_HandleTypeDef*)pdev->pClassData;
   
-  if (pdev->dev_state == USBD_STATE_CONFIGURED )
+  if (pdev->dev_state != USBD_STATE_CONFIGURED )
   {
-    if(hhid->state == HID_IDLE)
-    {
-      hhid->state = HID_BUSY;
-      USBD_LL_Transmit (pdev, 
-                        HID_EPIN_ADDR,                                      
-                        report,
-                        len);
-    }
+    return USBD_FAIL;
+  }
+  if(hhid->state != HID_IDLE)
+  {
+    return USBD_BUSY;
   }
+  hhid->state = HID_BUSY;
+  USBD_LL_Transmit (pdev, 
+                    HID_EPIN_ADDR,                                      
+                    report,
+                    len);
   return USBD_OK;
 }
 
@@ -443,6 +454,23 @@ uint32_t USBD_HID_GetPollingInterval (USBD_HandleTypeDef *pdev)
   return ((uint32_t)(polling_interval));
 }
 
+/**
+  * @brief  USBD_HID_GetProtocol 
+  *         return the protocol selected by the host with SET_PROTOCOL
+  * @param  pdev: device instance
+  * @retval 0 for boot protocol, 1 for report protocol
+  */
+uint8_t USBD_HID_GetProtocol (USBD_HandleTypeDef *pdev)
+{
+  USBD_HID_HandleTypeDef     *hhid = (USBD_HID_HandleTypeDef*)pdev->pClassData;
+
+  if (hhid == NULL)
+  {
+    return 1;
+  }
+  return (uint8_t)hhid->Protocol;
+}
+
 /**
   * @brief  USBD_HID_GetCfgDesc 
   *         return configuration descriptor
@@ -471,9 +499,39 @@ static uint8_t  USBD_HID_DataIn (USBD_HandleTypeDef *pdev,
   /* Ensure that the FIFO is empty before a new transfer, this condition could 
   be caused by  a new transfer before the end of the previous transfer */
   ((USBD_HID_HandleTypeDef *)pdev->pClassData)->state = HID_IDLE;
+
+  /* The endpoint is free again: the application can queue the next report */
+  USBD_HID_ReportSentCallback(pdev);
   return USBD_OK;
 }
 
+/**
+  * @brief  USBD_HID_ReportSentCallback
+  *         Report transmitted to the host, the IN endpoint is idle.
+  *         Called in interrupt context.
+  * @param  pdev: device instance
+  * @retval None
+  */
+__weak void USBD_HID_ReportSentCallback (USBD_HandleTypeDef *pdev)
+{
+  /* NOTE : This function should not be modified, when the callback is needed,
+  the USBD_HID_ReportSentCallback could be implemented in the user file */
+}
+
+/**
+  * @brief  USBD_HID_DeInitCallback
+  *         HID class deinitialized (bus reset, disconnection or configuration
+  *         cleared): the IN endpoint is closed and a pending report is lost.
+  *         Called in interrupt context.
+  * @param  pdev: device instance
+  * @retval None
+  */
+__weak void USBD_HID_DeInitCallback (USBD_HandleTypeDef *pdev)
+{
+  /* NOTE : This function should not be modified, when the callback is needed,
+  the USBD_HID_DeInitCallback could be implemented in the user file */
+}
+
 
 /**
 * @brief  DeviceQualifierDescriptor 
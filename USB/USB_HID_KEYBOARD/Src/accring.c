@@ -0,0 +1,75 @@
+/**
+ * @file accring.c
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "accring.h"
+#include <assert.h>
+#include <string.h>
+
+/**
+ * @brief Restituisce lo spazio libero contiguo a partire da head. Lato produttore.
+ */
+static uint32_t ACCRING_Space(ACCRING_t* r, ACCRING_Sample_t** dst) {
+	uint32_t head = r->head;
+	uint32_t free = ACCRING_LENGTH - (head - r->tail);
+	uint32_t index = head & (ACCRING_LENGTH - 1);
+	*dst = &r->sample[index];
+	return (free < ACCRING_LENGTH - index) ? free : ACCRING_LENGTH - index;
+}
+
+void ACCRING_Init(ACCRING_t* r) {
+	assert(r);
+	memset(r, 0, sizeof(ACCRING_t));
+}
+
+uint32_t ACCRING_Drain(ACCRING_t* r, ACCRING_Read_t read) {
+	assert(r && read);
+	uint32_t total = 0;
+	uint8_t n;
+	do {
+		ACCRING_Sample_t* dst;
+		uint32_t space = ACCRING_Space(r, &dst);
+		if (space == 0) {
+			n = read(r->discard, ACCRING_FIFO_DEPTH);
+			r->dropped += n;
+		}
+		else {
+			n = read(dst, space < ACCRING_FIFO_DEPTH ? (uint8_t) space : ACCRING_FIFO_DEPTH);
+			/* i campioni sono gia' in memoria: solo ora diventano visibili al consumatore */
+			r->head += n;
+		}
+		total += n;
+	} while (n != 0);
+	r->drains++;
+	return total;
+}
+
+uint8_t ACCRING_Pop(ACCRING_t* r, ACCRING_Sample_t* s) {
+	assert(r && s);
+	uint32_t tail = r->tail;
+	if (tail == r->head)
+		return 0;
+	*s = r->sample[tail & (ACCRING_LENGTH - 1)];
+	r->tail = tail + 1;
+	return 1;
+}
+
+uint32_t ACCRING_Count(const ACCRING_t* r) {
+	assert(r);
+	return r->head - r->tail;
+}
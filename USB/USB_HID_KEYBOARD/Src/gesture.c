@@ -0,0 +1,243 @@
+/**
+ * @file gesture.c
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "gesture.h"
+#include <assert.h>
+#include <string.h>
+
+#define GESTURE_ABS(v)		((v) < 0 ? -(v) : (v))
+#define GESTURE_SQUARE(v)	((uint32_t)((int32_t)(v) * (int32_t)(v)))
+
+/**
+ * @brief Converte una durata in millisecondi nel numero di campioni corrispondente, almeno uno.
+ */
+static uint16_t GESTURE_Samples(uint16_t rate, uint16_t ms) {
+	uint32_t n = ((uint32_t) rate * ms + 999) / 1000;
+	return n ? (uint16_t) n : 1;
+}
+
+/**
+ * @brief Inizia un impulso, se la componente dinamica supera GESTURE_IMPULSE_ON.
+ */
+static void GESTURE_Start(GESTURE_t* g, const int16_t* d, uint32_t m2) {
+	if (m2 <= GESTURE_SQUARE(GESTURE_IMPULSE_ON))
+		return;
+	g->phase = GESTURE_ACTIVE;
+	g->duration = 1;
+	g->below = 0;
+	g->peak2 = m2;
+	g->axis = GESTURE_ABS(d[0]) >= GESTURE_ABS(d[1]) ? 0 : 1;
+	g->sign = d[g->axis] >= 0 ? 1 : -1;
+	g->lobe1 = g->sign * d[g->axis];
+	g->lobe2 = 0;
+	g->peakZ = GESTURE_ABS(d[2]);
+}
+
+/**
+ * @brief Classifica un impulso concluso ed avvia la fase di quiete.
+ */
+static GESTURE_Event_t GESTURE_Classify(GESTURE_t* g) {
+	g->phase = GESTURE_QUIET;
+	g->timer = 0;
+	g->quietLen = g->tapQuiet;
+
+	if (g->duration <= g->tapMax && g->peak2 >= GESTURE_SQUARE(GESTURE_TAP_PEAK)) {
+		if (++g->taps < 2)
+			return GESTURE_NONE;
+		g->taps = 0;
+		return GESTURE_DOUBLE_TAP;
+	}
+	if (g->taps) {
+		/* un impulso diverso da un tap chiude la sequenza: il tap in attesa ha la precedenza */
+		g->taps = 0;
+		return GESTURE_TAP;
+	}
+	if (g->duration <= g->flickMax && g->lobe1 >= GESTURE_FLICK_PEAK && g->lobe2 >= GESTURE_FLICK_PEAK / 2
+			&& g->lobe1 > g->peakZ) {
+		if (g->axis == 0)
+			return g->sign > 0 ? GESTURE_FLICK_RIGHT : GESTURE_FLICK_LEFT;
+		return g->sign > 0 ? GESTURE_FLICK_UP : GESTURE_FLICK_DOWN;
+	}
+	return GESTURE_NONE;
+}
+
+/**
+ * @brief Aggiorna l'impulso in corso con un campione.
+ */
+static GESTURE_Event_t GESTURE_Track(GESTURE_t* g, const int16_t* d, uint32_t m2) {
+	if (m2 <= GESTURE_SQUARE(GESTURE_IMPULSE_OFF)) {
+		if (++g->below < g->releaseLen)
+			return GESTURE_NONE;
+		return GESTURE_Classify(g);
+	}
+	/* i campioni sotto soglia tra due lobi fanno parte dell'impulso; oltre flickMax la durata non serve piu' */
+	if (g->duration <= g->flickMax)
+		g->duration += g->below + 1;
+	g->below = 0;
+	if (m2 > g->peak2)
+		g->peak2 = m2;
+	int16_t v = g->sign * d[g->axis];
+	if (v > g->lobe1)
+		g->lobe1 = v;
+	if (-v > g->lobe2)
+		g->lobe2 = -v;
+	if (GESTURE_ABS(d[2]) > g->peakZ)
+		g->peakZ = GESTURE_ABS(d[2]);
+	return GESTURE_NONE;
+}
+
+/**
+ * @brief Conta le inversioni dell'asse X o Y dominante.
+ * @return 1 se e' stato riconosciuto uno scuotimento
+ */
+static uint8_t GESTURE_Shake(GESTURE_t* g, const int16_t* d) {
+	if (g->shakeHold)
+		g->shakeHold--;
+	if (g->shakeSign != 0 && ++g->shakeTimer > g->shakeGap) {
+		g->shakeSign = 0;
+		g->shakeCount = 0;
+	}
+	uint8_t axis = GESTURE_ABS(d[0]) >= GESTURE_ABS(d[1]) ? 0 : 1;
+	if (GESTURE_ABS(d[axis]) <= GESTURE_SHAKE_LEVEL)
+		return 0;
+	int8_t sign = d[axis] > 0 ? 1 : -1;
+	g->shakeTimer = 0;
+	if (g->shakeSign == 0 || axis != g->shakeAxis) {
+		g->shakeAxis = axis;
+		g->shakeSign = sign;
+		g->shakeCount = 0;
+		return 0;
+	}
+	if (sign == g->shakeSign)
+		return 0;
+	g->shakeSign = sign;
+	/* nel periodo refrattario le escursioni vengono seguite, ma le inversioni non vengono contate */
+	if (g->shakeHold || ++g->shakeCount < GESTURE_SHAKE_REVERSALS)
+		return 0;
+	g->shakeCount = 0;
+	g->shakeHold = g->shakeRefractory;
+	return 1;
+}
+
+/**
+ * @brief Aggiorna le direzioni di inclinazione attive in base alla stima della gravita'.
+ */
+static void GESTURE_UpdateTilt(GESTURE_t* g) {
+	int16_t gx = (int16_t) (g->gravity[0] >> g->gravityShift);
+	int16_t gy = (int16_t) (g->gravity[1] >> g->gravityShift);
+	int16_t v[4] = { -gx, gx, -gy, gy };	// nell'ordine dei bit GESTURE_TILT_*
+	for (int i = 0; i < 4; i++) {
+		uint8_t bit = 1 << i;
+		if (g->tilt & bit) {
+			if (v[i] <= g->tiltOff)
+				g->tilt &= ~bit;
+			g->tiltTimer[i] = 0;
+		}
+		else if (v[i] > g->tiltOn) {
+			if (++g->tiltTimer[i] >= g->tiltHold)
+				g->tilt |= bit;
+		}
+		else
+			g->tiltTimer[i] = 0;
+	}
+}
+
+void GESTURE_Init(GESTURE_t* g, uint16_t rate, int16_t tiltThreshold) {
+	assert(g);
+	assert(rate > 0 && tiltThreshold > 0);
+	memset(g, 0, sizeof(GESTURE_t));
+	g->releaseLen = GESTURE_Samples(rate, GESTURE_RELEASE_MS);
+	g->tapMax = GESTURE_Samples(rate, GESTURE_TAP_MAX_MS);
+	g->tapQuiet = GESTURE_Samples(rate, GESTURE_TAP_QUIET_MS);
+	g->tapWindow = GESTURE_Samples(rate, GESTURE_TAP_WINDOW_MS);
+	g->flickMax = GESTURE_Samples(rate, GESTURE_FLICK_MAX_MS);
+	g->shakeGap = GESTURE_Samples(rate, GESTURE_SHAKE_GAP_MS);
+	g->shakeRefractory = GESTURE_Samples(rate, GESTURE_SHAKE_REFRACTORY_MS);
+	g->tiltHold = GESTURE_Samples(rate, GESTURE_TILT_HOLD_MS);
+	uint16_t tau = GESTURE_Samples(rate, GESTURE_GRAVITY_MS);
+	while ((1U << g->gravityShift) < tau)
+		g->gravityShift++;
+	g->tiltOn = tiltThreshold;
+	g->tiltOff = tiltThreshold / 2;
+}
+
+GESTURE_Event_t GESTURE_Process(GESTURE_t* g, int16_t x, int16_t y, int16_t z) {
+	assert(g);
+	const int16_t a[3] = { x, y, z };
+	int16_t d[3];
+	GESTURE_Event_t event = GESTURE_NONE;
+
+	if (!g->primed) {
+		for (int i = 0; i < 3; i++)
+			g->gravity[i] = (int32_t) a[i] << g->gravityShift;
+		g->primed = 1;
+	}
+
+	/* componente dinamica; il modulo al quadrato sta in 32 bit senza segno fino a +-16 g */
+	for (int i = 0; i < 3; i++)
+		d[i] = (int16_t) (a[i] - (g->gravity[i] >> g->gravityShift));
+	uint32_t m2 = GESTURE_SQUARE(d[0]) + GESTURE_SQUARE(d[1]) + GESTURE_SQUARE(d[2]);
+
+	if (GESTURE_Shake(g, d)) {
+		/* tap e flick in corso fanno parte dello scuotimento */
+		event = GESTURE_SHAKE;
+		g->taps = 0;
+		g->phase = GESTURE_SHAKING;
+	}
+	else switch (g->phase) {
+	case GESTURE_WAIT_TAP:
+		if (++g->timer >= g->tapWindow) {
+			event = GESTURE_TAP;
+			g->taps = 0;
+			g->phase = GESTURE_IDLE;
+		}
+		/* un impulso nella finestra puo' essere il secondo tap */
+		GESTURE_Start(g, d, m2);
+		break;
+	case GESTURE_IDLE:
+		GESTURE_Start(g, d, m2);
+		break;
+	case GESTURE_ACTIVE:
+		event = GESTURE_Track(g, d, m2);
+		break;
+	case GESTURE_QUIET:
+		/* il timer prosegue in GESTURE_WAIT_TAP: la finestra del secondo tap parte dalla fine del primo */
+		if (++g->timer >= g->quietLen)
+			g->phase = g->taps ? GESTURE_WAIT_TAP : GESTURE_IDLE;
+		break;
+	case GESTURE_SHAKING:
+		/* un impulso iniziato a meta' di uno scuotimento verrebbe scambiato per un flick */
+		if (!g->shakeHold && g->shakeSign == 0)
+			g->phase = GESTURE_IDLE;
+		break;
+	}
+
+	/* gravita': congelata durante un impulso, ma non oltre la durata di un flick */
+	if (g->phase != GESTURE_ACTIVE || g->duration > g->flickMax)
+		for (int i = 0; i < 3; i++)
+			g->gravity[i] += a[i] - (g->gravity[i] >> g->gravityShift);
+	GESTURE_UpdateTilt(g);
+
+	return event;
+}
+
+uint8_t GESTURE_Tilt(const GESTURE_t* g) {
+	assert(g);
+	return g->tilt;
+}
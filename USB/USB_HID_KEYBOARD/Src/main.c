@@ -24,6 +24,11 @@
 #include "stm32f4_discovery.h"
 #include "stm32f4_discovery_accelerometer.h"
 #include "usbd_hid.h"
+#include "hidqueue.h"
+#include "keyboard.h"
+#include "accring.h"
+#include "gesture.h"
+#include "power.h"
 
 /**
  * @defgroup USBD
@@ -39,9 +44,31 @@
  * 			 La tastiera permette di dare come comandi le frecce a destra, sinistra, sopra e sotto, oltre che al tasto spazio. <br>
  * 			 Inclinando il dispositivo in avanti, a sinistra, destra o all'indietro diamo un detirminato valore delle frecce direzionali.
  * 			 Ciò viene reso possibile attraverso l'accellerometro a bordo, che riporta le accellerazioni angolari lungo i tre assi X, Y, Z.
- * 			 I valori di accellerazione angolare letti vengono processati tenendo conto di opportuni valori di #soglia e sensitivita'  che sono personalizzabili
- * 			 a seconda delle esigenze di progetto o semplicemente a seconda della sensibilita' percepita e voluta dall'utente. <br>
+ * 			 I campioni dell'accelerometro sono elaborati dal modulo GESTURE, che ricava l'inclinazione della board (con
+ * 			 #soglia come soglia di inclinazione) e riconosce tap, doppio tap, flick e scuotimento. Ciascun gesto produce la
+ * 			 pressione e il rilascio di un tasto (vedi #gestureKey):
+ * 			 | Gesto              | Tasto               |
+ * 			 |--------------------|---------------------|
+ * 			 | tap                | invio               |
+ * 			 | doppio tap         | esc                 |
+ * 			 | flick sx / dx      | home / end          |
+ * 			 | flick avanti / ind.| page up / page down |
+ * 			 | scuotimento        | backspace           |
+ *
+ * 			 Con il LIS3DSH i campioni sono acquisiti a #ACC_RATE Hz tramite la FIFO del sensore: l'interruzione di
+ * 			 watermark su INT1 (EXTI0) svuota la FIFO in #accRing, e ad ogni scansione tutti i campioni raccolti vengono
+ * 			 elaborati, in modo che il riconoscimento veda gli impulsi brevi dei tap. Con il LIS302DL, privo di FIFO, viene
+ * 			 elaborato un campione per scansione, per cui i tap brevi possono non essere riconosciuti. <br>
+ * 			 Quando l'host sospende il bus (vedi POWER) i led vengono spenti e il processore resta in stop mode. Il LIS3DSH
+ * 			 continua a campionare a 12.5 Hz, con una interruzione per campione: un movimento oltre #ACC_MOTION_THRESHOLD o
+ * 			 il tasto User premuto al momento del campione producono il remote wakeup, se abilitato dall'host. Con il
+ * 			 LIS302DL l'accelerometro viene spento e il remote wakeup e' prodotto dal solo tasto User, in interruzione. <br>
  * 			 La pressione del tasto blu della board (User Button) viene acquisita come pressione del tasto space della tastiera. <br>
+ * 			 Lo stato dei tasti e' mantenuto dal modulo KEYBOARD: un report viene prodotto solo quando un tasto viene premuto o
+ * 			 rilasciato, mentre la ripetizione di un tasto tenuto premuto e' lasciata all'host. Il report e' una bitmap N-key
+ * 			 rollover; se l'host seleziona il boot protocol (ad esempio il BIOS) viene trasmesso il report boot a 6 tasti. <br>
+ * 			 I report sono consegnati alla coda di trasmissione #hidQueue (vedi HIDQUEUE), che li trasmette in ordine al
+ * 			 completamento del precedente, per cui nessun fronte di pressione o rilascio va perso se l'endpoint e' occupato. <br>
  */
 
 /* USB HID Usage Table */
@@ -51,6 +78,13 @@
 #define USB_HID_KEY_DOWN_ARROW			0x51		//!< Usage ID associato alla freccia dw
 #define USB_HID_KEY_UP_ARROW			0x52		//!< Usage ID associato alla freccia up
 #define USB_HID_KEY_SPACEBAR 			0x2C		//!< Usage ID associato alla barra aspaziatrice
+#define USB_HID_KEY_ENTER				0x28		//!< Usage ID associato al tasto invio
+#define USB_HID_KEY_ESCAPE				0x29		//!< Usage ID associato al tasto esc
+#define USB_HID_KEY_BACKSPACE			0x2A		//!< Usage ID associato al tasto backspace
+#define USB_HID_KEY_HOME				0x4A		//!< Usage ID associato al tasto home
+#define USB_HID_KEY_PAGE_UP				0x4B		//!< Usage ID associato al tasto page up
+#define USB_HID_KEY_END					0x4D		//!< Usage ID associato al tasto end
+#define USB_HID_KEY_PAGE_DOWN			0x4E		//!< Usage ID associato al tasto page down
 
 
 /**
@@ -63,15 +97,26 @@ void SystemClock_Config(void);
 static void MX_GPIO_Init(void);
 
 /**
- * @brief Struttura che astrae il device keyBoard.
+ * @brief Periodo di scansione dei tasti, in millisecondi, pari all'intervallo di polling dell'endpoint.
  */
-struct keyboardHID_t {
-    uint8_t id;				//!< Id della Keyboard
-    uint8_t modifiers;		//!< Valore di un tasto modificatore della KeyBoard
-    uint8_t key1;			//!< Valore di un tasto della KeyBoard
-    uint8_t key2;			//!< Valore di un tasto della KeyBoard
-    uint8_t key3;			//!< Valore di un tasto della KeyBoard
-};
+#define KEYBOARD_SCAN_MS		HID_FS_BINTERVAL
+
+/**
+ * @brief Frequenza di uscita del LIS3DSH, in Hz, e quindi di elaborazione dei gesti.
+ */
+#define ACC_RATE				400
+
+/**
+ * @brief Livello della FIFO dell'accelerometro che genera l'interruzione (20 ms a #ACC_RATE Hz).
+ * @details La latenza dei gesti e' comunque dominata dalla loro durata: una soglia alta riduce il numero di
+ * 			interruzioni, e 8 campioni restano entro lo spazio libero della FIFO anche se il main loop ritarda.
+ */
+#define ACC_FIFO_WATERMARK		8
+
+/**
+ * @brief Scostamento di un asse, in mg, rispetto al primo campione acquisito in sospensione, che risveglia l'host.
+ */
+#define ACC_MOTION_THRESHOLD	150
 
 /**
  * @brief Struttura che astrae le 3 componenti di accellerazione angolare lungo gli assi X, Y, Z.
@@ -84,7 +129,140 @@ typedef struct {
 
 int soglia=64;				//!< Soglia che permette di regolare lo la sensibilità minima del dispositivo.
 XYZ_t XYZ;					//!< Oggetto di tipo XYZ_t
-static int16_t value_x,value_y;
+HIDQUEUE_t hidQueue;		//!< Coda di trasmissione dei report
+KEYBOARD_t keyboard;		//!< Stato dei tasti
+uint8_t bootReport[KEYBOARD_BOOT_REPORT_SIZE];	//!< Report boot in trasmissione, convertito dal report NKRO accodato
+
+ACCRING_t accRing;			//!< Campioni letti dalla FIFO dell'accelerometro
+uint8_t accFifo;			//!< 1 se l'acquisizione avviene tramite la FIFO dell'accelerometro
+GESTURE_t gesture;			//!< Stato del riconoscimento dei gesti
+uint32_t gestureCycles;		//!< Cicli di clock impiegati da GESTURE_Process() per l'ultimo campione
+uint32_t gestureCyclesMax;	//!< Massimo numero di cicli di clock impiegati da GESTURE_Process()
+POWER_t power;				//!< Gestione della sospensione del bus
+
+/**
+ * @brief Tasto associato a ciascun gesto; il tasto viene premuto alla scansione in cui il gesto e' riconosciuto e
+ * 			rilasciato alla successiva.
+ */
+static const uint8_t gestureKey[GESTURE_N_EVENTS] = {
+	[GESTURE_TAP] = USB_HID_KEY_ENTER,
+	[GESTURE_DOUBLE_TAP] = USB_HID_KEY_ESCAPE,
+	[GESTURE_FLICK_LEFT] = USB_HID_KEY_HOME,
+	[GESTURE_FLICK_RIGHT] = USB_HID_KEY_END,
+	[GESTURE_FLICK_DOWN] = USB_HID_KEY_PAGE_DOWN,
+	[GESTURE_FLICK_UP] = USB_HID_KEY_PAGE_UP,
+	[GESTURE_SHAKE] = USB_HID_KEY_BACKSPACE
+};
+
+/**
+ * @brief Elabora un campione dell'accelerometro, premendo il tasto associato al gesto eventualmente riconosciuto.
+ * @param[in] x componente lungo l'asse X (mg)
+ * @param[in] y componente lungo l'asse Y (mg)
+ * @param[in] z componente lungo l'asse Z (mg)
+ */
+static void ACC_Gesture(int16_t x, int16_t y, int16_t z);
+
+/**
+ * @brief Lettura della FIFO dell'accelerometro; funzione di lettura di #accRing.
+ * @param[out] dst campioni letti
+ * @param[in] max numero massimo di campioni da leggere
+ * @return numero di campioni letti
+ */
+static uint8_t ACC_Read(ACCRING_Sample_t* dst, uint8_t max);
+
+/**
+ * @brief Callback delle linee EXTI: l'interruzione di watermark dell'accelerometro svuota la FIFO in #accRing.
+ * @details Senza FIFO, la linea EXTI0 e' usata in sospensione dal tasto User, che richiede il remote wakeup.
+ * @param[in] GPIO_Pin pin connesso alla linea EXTI
+ */
+void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin);
+
+/**
+ * @brief Elaborazione degli eventi in sospensione: i campioni raccolti in #accRing e lo stato del tasto User
+ * 			possono richiedere il remote wakeup.
+ */
+static void PWR_Poll(void);
+
+/**
+ * @brief Ingresso in sospensione: led spenti, accelerometro a bassa frequenza o spento.
+ * @param[in] ctx handle del device USB
+ */
+static void PWR_Suspend(void* ctx);
+
+/**
+ * @brief Uscita dalla sospensione: ripristino dell'acquisizione e del riconoscimento dei gesti.
+ * @param[in] ctx handle del device USB
+ */
+static void PWR_Resume(void* ctx);
+
+/**
+ * @brief Stop mode fino all'interruzione successiva, se non ci sono eventi da elaborare.
+ * @param[in] ctx handle del device USB
+ */
+static void PWR_Sleep(void* ctx);
+
+/**
+ * @brief Avvia la segnalazione di remote wakeup sul bus.
+ * @param[in] ctx handle del device USB
+ */
+static void PWR_WakeupStart(void* ctx);
+
+/**
+ * @brief Termina la segnalazione di remote wakeup.
+ * @param[in] ctx handle del device USB
+ */
+static void PWR_WakeupStop(void* ctx);
+
+/**
+ * @brief Verifica se l'host ha abilitato il remote wakeup.
+ * @param[in] ctx handle del device USB
+ * @return 1 se il remote wakeup e' abilitato
+ */
+static uint8_t PWR_WakeupEnabled(void* ctx);
+
+/**
+ * @brief Funzioni di intervento sull'hardware di #power.
+ */
+static const POWER_Hooks_t powerHooks = {
+	PWR_Suspend,
+	PWR_Resume,
+	PWR_Sleep,
+	PWR_WakeupStart,
+	PWR_WakeupStop,
+	PWR_WakeupEnabled
+};
+
+/**
+ * @brief Avvia la trasmissione di un report; funzione di trasmissione della coda #hidQueue.
+ * @param[in] ctx handle del device USB
+ * @param[in] report report da trasmettere
+ * @param[in] len lunghezza del report
+ * @return 0 se la trasmissione e' stata avviata
+ */
+static int HID_Send(void* ctx, uint8_t* report, uint8_t len);
+
+/**
+ * @brief Disabilita l'interruzione USB, per l'accesso alla coda #hidQueue dal main loop.
+ */
+static void HID_Lock(void);
+
+/**
+ * @brief Riabilita l'interruzione USB.
+ */
+static void HID_Unlock(void);
+
+/**
+ * @brief Callback di fine trasmissione di un report: trasmette il report successivo, se presente.
+ * @param[in] pdev handle del device USB
+ */
+void USBD_HID_ReportSentCallback(USBD_HandleTypeDef *pdev);
+
+/**
+ * @brief Callback di deinizializzazione della classe HID (reset del bus, deconfigurazione): svuota la coda #hidQueue,
+ * 			il cui report in trasmissione non verra' mai completato.
+ * @param[in] pdev handle del device USB
+ */
+void USBD_HID_DeInitCallback(USBD_HandleTypeDef *pdev);
 
 /**
  * @brief Funzione che implementa la logica del programma.<br>
@@ -92,25 +270,20 @@ static int16_t value_x,value_y;
  * @details
  * 			Vengono inizializzate le librerie HAL, configurato il system clock, inizializzate e configurate tutte le periferiche utilizzate,
  * 			inizializzate le variabili ed eseguite le funzioni richieste al reset del sistema. <br>
- * 			 - viene valutata la pressione del tasto blu (button User) e aggiornato il campo buttons dell'oggetto mouseHID;
- * 			 - viene effettuata la lettura delle componenti di accellerazione angolare lungo i 3 assi (sfruttando l'accellerometro a bordo) aggiornati i campi
- * 			 dell'oggetto muoseHID;
- * 			 - vengono aggiornati i campi x e y del'oggetto mouseHID. Questo è fatto tenendo conto del valore di soglia e sensitivita'
- * 			 (s) impostato;
- * 			 - viene invocata la funzione "uint8_t USBD_HID_SendReport(USBD_HandleTypeDef  *pdev, uint8_t *report,uint16_t len)", tramite la quale viene comunicato
- * 			 il report contenente i dati acquisiti;
- * 			 - prima di uscire vengono resettati tutti i valori della struttura mouseHID.
+ * 			Se il bus e' sospeso, la scansione e' interrotta e il main loop si limita agli eventi che possono richiedere
+ * 			il remote wakeup (vedi PWR_Poll()). Altrimenti, ogni #KEYBOARD_SCAN_MS millisecondi:
+ * 			 - viene valutata la pressione del tasto blu (button User) e aggiornato lo stato della barra spaziatrice;
+ * 			 - i tasti associati ai gesti riconosciuti alla scansione precedente vengono rilasciati;
+ * 			 - i campioni dell'accelerometro raccolti in #accRing (o, senza FIFO, il campione letto) vengono elaborati dal
+ * 			 modulo GESTURE: ogni gesto riconosciuto preme il tasto associato, e le frecce direzionali seguono
+ * 			 l'inclinazione della board;
+ * 			 - se lo stato di almeno un tasto e' cambiato, il report NKRO viene accodato per la trasmissione; HID_Send() lo converte
+ * 			 nel formato selezionato dall'host.
  */
 int main(void)
 {
 
-	struct keyboardHID_t keyboardHID;
-	keyboardHID.id = 1;
-	keyboardHID.modifiers = 0;
-	keyboardHID.key1 = 0;
-	keyboardHID.key2 = 0;
-	keyboardHID.key3 = 0;
-
+	uint8_t report[KEYBOARD_NKRO_REPORT_SIZE];
 
 	HAL_Init();
 	SystemClock_Config();
@@ -122,62 +295,159 @@ int main(void)
 	BSP_LED_Init(LED6);
 	BSP_PB_Init(BUTTON_KEY,BUTTON_MODE_GPIO);
 	BSP_ACCELERO_Init();
-	value_x=0;
-	value_y=0;
+	/* il buffer e il riconoscimento devono essere pronti prima dell'interruzione di watermark */
+	ACCRING_Init(&accRing);
+	accFifo = 0;
+	if(BSP_ACCELERO_ReadID() == I_AM_LIS3DSH){
+		LIS3DSH_DataRateCmd(LIS3DSH_DATARATE_400);
+		accFifo = BSP_ACCELERO_FIFO_Start(ACC_FIFO_WATERMARK) == ACCELERO_OK;
+	}
+	GESTURE_Init(&gesture, accFifo ? ACC_RATE : 1000 / KEYBOARD_SCAN_MS, soglia);
+	/* Contatore di cicli del DWT, per la misura del costo del riconoscimento */
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+	gestureCycles = 0;
+	gestureCyclesMax = 0;
+	POWER_Init(&power, &powerHooks, &hUsbDeviceFS, ACC_MOTION_THRESHOLD);
+	KEYBOARD_Init(&keyboard);
+	HIDQUEUE_Init(&hidQueue, HIDQUEUE_KEYBOARD, KEYBOARD_NKRO_REPORT_SIZE, HID_Send, &hUsbDeviceFS, HID_Lock, HID_Unlock);
 
 
   while (1)
   {
-	  BSP_ACCELERO_GetXYZ((int16_t*)&XYZ);
-	  value_x=XYZ.asse_x;
-	  value_y=XYZ.asse_y;
-
+/* Bus sospeso: nessuna scansione finche' l'host non riprende il bus */
+	  if (POWER_Process(&power, hUsbDeviceFS.dev_state == USBD_STATE_SUSPENDED, HAL_GetTick()) != POWER_ACTIVE){
+		  PWR_Poll();
+		  continue;
+	  }
 
 /* Button User */
-	  if(BSP_PB_GetState(BUTTON_KEY)!=GPIO_PIN_SET)
-		  keyboardHID.key3=0;
-	  else
-		  keyboardHID.key3=USB_HID_KEY_SPACEBAR;
-
-/* Accellerazione lungo l'asse y */
-	  if (value_y>soglia){
-		  BSP_LED_Toggle(LED3);
-		  keyboardHID.key1 = USB_HID_KEY_UP_ARROW;
+	  KEYBOARD_Set(&keyboard, USB_HID_KEY_SPACEBAR, BSP_PB_GetState(BUTTON_KEY)==GPIO_PIN_SET);
+
+/* Gesti: rilascio dei tasti premuti alla scansione precedente ed elaborazione dei nuovi campioni */
+	  for (int i = GESTURE_TAP; i < GESTURE_N_EVENTS; i++)
+		  KEYBOARD_Set(&keyboard, gestureKey[i], 0);
+	  if (accFifo){
+		  ACCRING_Sample_t sample;
+		  while (ACCRING_Pop(&accRing, &sample))
+			  ACC_Gesture(sample.x, sample.y, sample.z);
 	  }
-	  else if (value_y<-soglia){
-		  BSP_LED_Toggle(LED6);
-		  keyboardHID.key1 = USB_HID_KEY_DOWN_ARROW;
+	  else {
+		  BSP_ACCELERO_GetXYZ((int16_t*)&XYZ);
+		  ACC_Gesture(XYZ.asse_x, XYZ.asse_y, XYZ.asse_z);
 	  }
 
-  /* Accellerazione lungo l'asse x */
-	  if (value_x>soglia){
-		  BSP_LED_Toggle(LED5);
-		  keyboardHID.key2 = USB_HID_KEY_RIGHT_ARROW;
-	  }
-	  else if (value_x<-soglia){
-		  BSP_LED_Toggle(LED4);
-		  keyboardHID.key2 = USB_HID_KEY_LEFT_ARROW;
+/* Inclinazione lungo gli assi x e y */
+	  uint8_t tilt = GESTURE_Tilt(&gesture);
+	  KEYBOARD_Set(&keyboard, USB_HID_KEY_UP_ARROW, (tilt & GESTURE_TILT_UP) != 0);
+	  KEYBOARD_Set(&keyboard, USB_HID_KEY_DOWN_ARROW, (tilt & GESTURE_TILT_DOWN) != 0);
+	  KEYBOARD_Set(&keyboard, USB_HID_KEY_RIGHT_ARROW, (tilt & GESTURE_TILT_RIGHT) != 0);
+	  KEYBOARD_Set(&keyboard, USB_HID_KEY_LEFT_ARROW, (tilt & GESTURE_TILT_LEFT) != 0);
+
+/* Led accesi in corrispondenza delle frecce premute */
+	  KEYBOARD_IsPressed(&keyboard, USB_HID_KEY_UP_ARROW) ? BSP_LED_On(LED3) : BSP_LED_Off(LED3);
+	  KEYBOARD_IsPressed(&keyboard, USB_HID_KEY_DOWN_ARROW) ? BSP_LED_On(LED6) : BSP_LED_Off(LED6);
+	  KEYBOARD_IsPressed(&keyboard, USB_HID_KEY_RIGHT_ARROW) ? BSP_LED_On(LED5) : BSP_LED_Off(LED5);
+	  KEYBOARD_IsPressed(&keyboard, USB_HID_KEY_LEFT_ARROW) ? BSP_LED_On(LED4) : BSP_LED_Off(LED4);
+
+/* Invio Report, solo in corrispondenza di un fronte: la coda riceve il report NKRO, convertito in HID_Send() */
+	  if (KEYBOARD_Changed(&keyboard)){
+		  KEYBOARD_BuildReport(&keyboard, KEYBOARD_NKRO, report);
+		  HIDQUEUE_Push(&hidQueue, report);
 	  }
-
-/* Invio Report */
-	  USBD_HID_SendReport(&hUsbDeviceFS, (uint8_t*)&keyboardHID, sizeof(struct keyboardHID_t));
-	  HAL_Delay(25);
-
-/* Reset dei valori della struttura keyboardHID*/
-	 keyboardHID.key1 = 0;
-	 keyboardHID.key2 = 0;
-	 keyboardHID.key3 = 0;
-
-/* Reset Led */
-	  for(int i=0; i<4;i++)
-	  		  BSP_LED_Off(i);
-/* Reset dei valori in attesa della prossima misurazione */
-	  value_x=0;
-	  value_y=0;
-	  HAL_Delay(25);
+	  HAL_Delay(KEYBOARD_SCAN_MS);
   }
 }
 
+static void ACC_Gesture(int16_t x, int16_t y, int16_t z){
+	uint32_t start = DWT->CYCCNT;
+	GESTURE_Event_t event = GESTURE_Process(&gesture, x, y, z);
+	gestureCycles = DWT->CYCCNT - start;
+	if (gestureCycles > gestureCyclesMax)
+		gestureCyclesMax = gestureCycles;
+	if (event != GESTURE_NONE)
+		KEYBOARD_Set(&keyboard, gestureKey[event], 1);
+}
+
+static uint8_t ACC_Read(ACCRING_Sample_t* dst, uint8_t max){
+	return BSP_ACCELERO_FIFO_Read((int16_t*)dst, max);
+}
+
+void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin){
+	if (GPIO_Pin != ACCELERO_INT1_PIN)
+		return;
+	if (accFifo)
+		ACCRING_Drain(&accRing, ACC_Read);
+	else
+		POWER_Wake(&power);
+}
+
+static void PWR_Poll(void){
+	ACCRING_Sample_t sample;
+	while (ACCRING_Pop(&accRing, &sample))
+		POWER_Motion(&power, sample.x, sample.y, sample.z);
+	if (BSP_PB_GetState(BUTTON_KEY) == GPIO_PIN_SET)
+		POWER_Wake(&power);
+}
+
+static void PWR_Suspend(void* ctx){
+	for (int i = 0; i < LEDn; i++)
+		BSP_LED_Off(i);
+	if (accFifo){
+		/* una interruzione per campione: ciascun campione risveglia il processore */
+		LIS3DSH_DataRateCmd(LIS3DSH_DATARATE_12_5);
+		BSP_ACCELERO_FIFO_Start(1);
+	}
+	else {
+		LIS302DL_LowpowerCmd(LIS302DL_LOWPOWERMODE_POWERDOWN);
+		BSP_PB_Init(BUTTON_KEY, BUTTON_MODE_EXTI);
+	}
+}
+
+static void PWR_Resume(void* ctx){
+	if (accFifo){
+		LIS3DSH_DataRateCmd(LIS3DSH_DATARATE_400);
+		BSP_ACCELERO_FIFO_Start(ACC_FIFO_WATERMARK);
+	}
+	else {
+		LIS302DL_LowpowerCmd(LIS302DL_LOWPOWERMODE_ACTIVE);
+		BSP_PB_Init(BUTTON_KEY, BUTTON_MODE_GPIO);
+		HAL_NVIC_DisableIRQ(KEY_BUTTON_EXTI_IRQn);
+	}
+	/* la stima della gravita' precedente alla sospensione non e' piu' valida */
+	GESTURE_Init(&gesture, accFifo ? ACC_RATE : 1000 / KEYBOARD_SCAN_MS, soglia);
+}
+
+static void PWR_Sleep(void* ctx){
+	/* il risveglio dallo stop mode avviene con l'HSI: l'interruzione USB viene servita dopo il ripristino dei clock,
+	 * le altre subito, perche' SystemClock_Config() misura i suoi timeout con il SysTick */
+	__disable_irq();
+	if (!POWER_WakePending(&power) && ACCRING_Count(&accRing) == 0){
+		HAL_NVIC_DisableIRQ(OTG_FS_IRQn);
+		HAL_PWR_EnterSTOPMode(PWR_LOWPOWERREGULATOR_ON, PWR_STOPENTRY_WFI);
+		__enable_irq();
+		SystemClock_Config();
+		HAL_NVIC_EnableIRQ(OTG_FS_IRQn);
+	}
+	__enable_irq();
+}
+
+static void PWR_WakeupStart(void* ctx){
+	PCD_HandleTypeDef* hpcd = (PCD_HandleTypeDef*)((USBD_HandleTypeDef*)ctx)->pData;
+	/* il clock del PHY e' stato fermato all'ingresso in sospensione */
+	__HAL_PCD_UNGATE_PHYCLOCK(hpcd);
+	HAL_PCD_ActivateRemoteWakeup(hpcd);
+}
+
+static void PWR_WakeupStop(void* ctx){
+	HAL_PCD_DeActivateRemoteWakeup((PCD_HandleTypeDef*)((USBD_HandleTypeDef*)ctx)->pData);
+}
+
+static uint8_t PWR_WakeupEnabled(void* ctx){
+	return ((USBD_HandleTypeDef*)ctx)->dev_remote_wakeup != 0;
+}
+
 void SystemClock_Config(void)
 {
 
@@ -231,6 +501,31 @@ void SystemClock_Config(void)
   HAL_NVIC_SetPriority(SysTick_IRQn, 0, 0);
 }
 
+static int HID_Send(void* ctx, uint8_t* report, uint8_t len){
+	/* in boot protocol l'host si attende il solo report a 8 byte */
+	if (USBD_HID_GetProtocol((USBD_HandleTypeDef*)ctx) == KEYBOARD_BOOT){
+		len = KEYBOARD_ToBoot(report, bootReport);
+		report = bootReport;
+	}
+	return USBD_HID_SendReport((USBD_HandleTypeDef*)ctx, report, len) == USBD_OK ? 0 : -1;
+}
+
+static void HID_Lock(void){
+	HAL_NVIC_DisableIRQ(OTG_FS_IRQn);
+}
+
+static void HID_Unlock(void){
+	HAL_NVIC_EnableIRQ(OTG_FS_IRQn);
+}
+
+void USBD_HID_ReportSentCallback(USBD_HandleTypeDef *pdev){
+	HIDQUEUE_Sent(&hidQueue);
+}
+
+void USBD_HID_DeInitCallback(USBD_HandleTypeDef *pdev){
+	HIDQUEUE_Reset(&hidQueue);
+}
+
 /** Configure pins as 
         * Analog 
         * Input 
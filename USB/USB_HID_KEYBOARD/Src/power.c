@@ -0,0 +1,125 @@
+/**
+ * @file power.c
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "power.h"
+#include <assert.h>
+#include <string.h>
+
+/**
+ * @brief Ingresso in POWER_SUSPENDED: il riferimento del movimento viene riacquisito.
+ */
+static void POWER_Enter(POWER_t* p, POWER_State_t state, uint32_t now) {
+	p->state = state;
+	p->since = now;
+	if (state == POWER_SUSPENDED) {
+		p->refValid = 0;
+		p->wakeRequest = 0;
+	}
+}
+
+void POWER_Init(POWER_t* p, const POWER_Hooks_t* hooks, void* ctx, int16_t motionThreshold) {
+	assert(p && hooks);
+	assert(hooks->suspend && hooks->resume && hooks->sleep);
+	assert(hooks->wakeupStart && hooks->wakeupStop && hooks->wakeupEnabled);
+	assert(motionThreshold > 0);
+	memset(p, 0, sizeof(POWER_t));
+	p->hooks = hooks;
+	p->ctx = ctx;
+	p->state = POWER_ACTIVE;
+	p->motionThreshold = motionThreshold;
+}
+
+POWER_State_t POWER_Process(POWER_t* p, uint8_t busSuspended, uint32_t now) {
+	assert(p);
+	switch (p->state) {
+	case POWER_ACTIVE:
+		if (busSuspended) {
+			p->hooks->suspend(p->ctx);
+			POWER_Enter(p, POWER_SUSPENDED, now);
+		}
+		break;
+
+	case POWER_SUSPENDED:
+		if (!busSuspended) {
+			p->hooks->resume(p->ctx);
+			POWER_Enter(p, POWER_ACTIVE, now);
+		}
+		else if (!p->wakeRequest)
+			p->hooks->sleep(p->ctx);
+		else if (!p->hooks->wakeupEnabled(p->ctx))
+			p->wakeRequest = 0;
+		else if (now - p->since >= POWER_IDLE_MS) {
+			/* altrimenti si attende, senza fermare il processore, che la sospensione duri abbastanza */
+			p->wakeRequest = 0;
+			p->hooks->wakeupStart(p->ctx);
+			p->signalling = 1;
+			p->wakeups++;
+			POWER_Enter(p, POWER_RESUMING, now);
+		}
+		break;
+
+	case POWER_RESUMING:
+		if (p->signalling) {
+			if (now - p->since < POWER_RESUME_SIGNAL_MS)
+				break;
+			p->hooks->wakeupStop(p->ctx);
+			p->signalling = 0;
+		}
+		if (!busSuspended) {
+			p->hooks->resume(p->ctx);
+			POWER_Enter(p, POWER_ACTIVE, now);
+		}
+		else if (now - p->since >= POWER_RESUME_TIMEOUT_MS)
+			POWER_Enter(p, POWER_SUSPENDED, now);
+		break;
+	}
+	return p->state;
+}
+
+void POWER_Wake(POWER_t* p) {
+	assert(p);
+	if (p->state == POWER_SUSPENDED)
+		p->wakeRequest = 1;
+}
+
+uint8_t POWER_WakePending(const POWER_t* p) {
+	assert(p);
+	return p->wakeRequest;
+}
+
+void POWER_Motion(POWER_t* p, int16_t x, int16_t y, int16_t z) {
+	assert(p);
+	if (p->state != POWER_SUSPENDED)
+		return;
+	if (!p->refValid) {
+		p->ref[0] = x;
+		p->ref[1] = y;
+		p->ref[2] = z;
+		p->refValid = 1;
+		return;
+	}
+	const int16_t a[3] = { x, y, z };
+	for (int i = 0; i < 3; i++) {
+		int32_t delta = (int32_t) a[i] - p->ref[i];
+		if (delta > p->motionThreshold || delta < -p->motionThreshold) {
+			p->wakeRequest = 1;
+			return;
+		}
+	}
+}
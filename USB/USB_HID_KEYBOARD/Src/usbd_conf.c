@@ -98,6 +98,13 @@ void HAL_PCD_MspInit(PCD_HandleTypeDef* pcdHandle)
     HAL_NVIC_SetPriority(OTG_FS_IRQn, 0, 0);
     HAL_NVIC_EnableIRQ(OTG_FS_IRQn);
   /* USER CODE BEGIN USB_OTG_FS_MspInit 1 */
+    /* EXTI line 18: the host resume wakes up the MCU from the stop mode
+       entered while the bus is suspended */
+    __HAL_USB_OTG_FS_WAKEUP_EXTI_CLEAR_FLAG();
+    __HAL_USB_OTG_FS_WAKEUP_EXTI_ENABLE_RISING_EDGE();
+    __HAL_USB_OTG_FS_WAKEUP_EXTI_ENABLE_IT();
+    HAL_NVIC_SetPriority(OTG_FS_WKUP_IRQn, 0, 0);
+    HAL_NVIC_EnableIRQ(OTG_FS_WKUP_IRQn);
 
   /* USER CODE END USB_OTG_FS_MspInit 1 */
   }
@@ -229,6 +236,8 @@ void HAL_PCD_SuspendCallback(PCD_HandleTypeDef *hpcd)
 void HAL_PCD_ResumeCallback(PCD_HandleTypeDef *hpcd)
 {
   /* USER CODE BEGIN 3 */
+  /* The PHY clock is gated on suspend, also when the low power mode is disabled */
+  __HAL_PCD_UNGATE_PHYCLOCK(hpcd);
   /* USER CODE END 3 */
   USBD_LL_Resume((USBD_HandleTypeDef*)hpcd->pData);
   
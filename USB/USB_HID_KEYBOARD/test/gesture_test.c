@@ -0,0 +1,399 @@
+/**
+ * @file gesture_test.c
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+/**
+ * @brief Verifica su host del riconoscimento dei gesti su tracce etichettate e misura del costo per campione.
+ *
+ * @details
+ * Ogni traccia e' una sequenza di segmenti (riposo, tap, doppio tap, flick nelle quattro direzioni, scuotimento,
+ * vibrazione da camminata, inclinazioni lente e a gradino, gesti con la board gia' inclinata) generata con le
+ * caratteristiche del LIS3DSH: rumore uniforme di +-20 mg e durate espresse in millisecondi, per cui la stessa traccia
+ * viene riprodotta a 100, 400 e 1600 Hz. Ogni segmento porta con se' la propria etichetta:
+ *  - gli eventi attesi, ciascuno con la finestra di campioni in cui deve essere prodotto e il numero minimo e massimo
+ *    di occorrenze (uno scuotimento lungo produce un evento per ogni periodo refrattario);
+ *  - le direzioni di inclinazione attese in punti di controllo, al termine dei tempi di assestamento.
+ *
+ * Un evento prodotto fuori da ogni finestra, o di tipo diverso da quello atteso nella finestra, e' un falso positivo;
+ * una finestra con meno occorrenze del minimo e' un gesto perso. Sono verificate inoltre l'isteresi
+ * dell'inclinazione e la riproducibilita' (stesso stato iniziale, stessa traccia, stessi eventi).
+ *
+ * Infine viene riportato il costo medio di GESTURE_Process() per campione su host, in ns e, su x86, in cicli.
+ * @code
+ * gcc -std=gnu99 -O2 -Wall -Wextra -IInc test/gesture_test.c Src/gesture.c -lm -o gesture_test && ./gesture_test
+ * @endcode
+ */
+#include "gesture.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <math.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#define TEST_TILT			300			//!< soglia di inclinazione usata dal progetto
+#define TEST_NOISE_MG		20			//!< ampiezza del rumore del sensore
+#define TEST_MAX_SAMPLES	(1 << 17)	//!< campioni massimi di una traccia
+#define TEST_MAX_LABELS		64			//!< etichette massime di una traccia
+#define TEST_TRACES			20			//!< tracce per frequenza, con rumore diverso
+#define BENCH_SAMPLES		10000000	//!< campioni elaborati per la misura del costo
+
+static int failures = 0;
+
+#define CHECK(cond) do { if (!(cond)) { printf("%s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+static const char* const names[GESTURE_N_EVENTS] = {
+	"NONE", "TAP", "DOUBLE_TAP", "FLICK_LEFT", "FLICK_RIGHT", "FLICK_DOWN", "FLICK_UP", "SHAKE"
+};
+
+/**
+ * @brief Generatore pseudo-casuale xorshift, per rendere le tracce riproducibili.
+ */
+static uint32_t rng = 12345;
+static uint32_t Random(void) {
+	rng ^= rng << 13;
+	rng ^= rng >> 17;
+	rng ^= rng << 5;
+	return rng;
+}
+
+static double Noise(void) {
+	return (double) ((int32_t) (Random() % (2 * TEST_NOISE_MG + 1)) - TEST_NOISE_MG);
+}
+
+/**
+ * @brief Etichetta: evento atteso in una finestra di campioni, oppure inclinazione attesa in un campione.
+ */
+typedef struct {
+	GESTURE_Event_t event;		//!< evento atteso, GESTURE_NONE per un punto di controllo dell'inclinazione
+	uint32_t from;				//!< primo campione della finestra
+	uint32_t to;				//!< ultimo campione della finestra
+	uint8_t min;				//!< occorrenze minime
+	uint8_t max;				//!< occorrenze massime
+	uint8_t tilt;				//!< direzioni attese, per un punto di controllo
+	uint8_t seen;				//!< occorrenze osservate
+} Label_t;
+
+/**
+ * @brief Traccia etichettata.
+ */
+typedef struct {
+	uint16_t rate;						//!< frequenza di campionamento (Hz)
+	double gx, gy;						//!< inclinazione corrente (mg) lungo X e Y
+	uint32_t len;						//!< campioni
+	int16_t s[TEST_MAX_SAMPLES][3];		//!< campioni (mg)
+	uint32_t nLabels;					//!< etichette
+	Label_t labels[TEST_MAX_LABELS];
+} Trace_t;
+
+static Trace_t trace;
+
+static uint32_t Samples(uint32_t ms) {
+	uint32_t n = trace.rate * ms / 1000;
+	return n ? n : 1;
+}
+
+/**
+ * @brief Aggiunge un campione: gravita' dell'inclinazione corrente piu' la componente dinamica (dx, dy, dz).
+ */
+static void Push(double dx, double dy, double dz) {
+	double gz = sqrt(1e6 - trace.gx * trace.gx - trace.gy * trace.gy);
+	if (trace.len >= TEST_MAX_SAMPLES)
+		return;
+	trace.s[trace.len][0] = (int16_t) lround(trace.gx + dx + Noise());
+	trace.s[trace.len][1] = (int16_t) lround(trace.gy + dy + Noise());
+	trace.s[trace.len][2] = (int16_t) lround(gz + dz + Noise());
+	trace.len++;
+}
+
+static void Label(GESTURE_Event_t event, uint32_t from, uint32_t toMs, uint8_t min, uint8_t max) {
+	Label_t* l = &trace.labels[trace.nLabels++];
+	memset(l, 0, sizeof(Label_t));
+	l->event = event;
+	l->from = from;
+	l->to = trace.len + Samples(toMs);
+	l->min = min;
+	l->max = max;
+}
+
+static void ExpectTilt(uint8_t tilt) {
+	Label_t* l = &trace.labels[trace.nLabels++];
+	memset(l, 0, sizeof(Label_t));
+	l->from = l->to = trace.len - 1;
+	l->tilt = tilt;
+}
+
+static void Rest(uint32_t ms) {
+	for (uint32_t i = 0, n = Samples(ms); i < n; i++)
+		Push(0, 0, 0);
+}
+
+/**
+ * @brief Colpo sulla board lungo Z: 5 ms di compressione a +2 g e 5 ms di rimbalzo a -1.2 g.
+ */
+static void Impact(void) {
+	uint32_t n = Samples(5);
+	for (uint32_t i = 0; i < 2 * n; i++)
+		Push(0, 0, i < n ? 2000 : -1200);
+}
+
+static void Tap(void) {
+	uint32_t from = trace.len;
+	Impact();
+	/* il tap singolo viene prodotto allo scadere della finestra del secondo tap */
+	Label(GESTURE_TAP, from, GESTURE_RELEASE_MS + GESTURE_TAP_WINDOW_MS + 20, 1, 1);
+	Rest(600);
+}
+
+static void DoubleTap(uint32_t gapMs) {
+	Impact();
+	Rest(gapMs);
+	uint32_t from = trace.len;
+	Impact();
+	Label(GESTURE_DOUBLE_TAP, from, GESTURE_RELEASE_MS + 10, 1, 1);
+	Rest(600);
+}
+
+/**
+ * @brief Flick: un periodo di sinusoide di 1.2 g in 120 ms lungo X (axis 0) o Y (axis 1), nel verso di sign.
+ */
+static void Flick(int axis, int sign, GESTURE_Event_t event) {
+	uint32_t from = trace.len, n = Samples(120);
+	for (uint32_t i = 0; i < n; i++) {
+		double v = sign * 1200 * sin(2 * M_PI * i / n);
+		Push(axis == 0 ? v : 0, axis == 1 ? v : 0, 0);
+	}
+	Label(event, from, GESTURE_RELEASE_MS + 10, 1, 1);
+	Rest(500);
+}
+
+/**
+ * @brief Scuotimento lungo X a 5 Hz, 1.5 g.
+ */
+static void Shake(uint32_t ms) {
+	uint32_t from = trace.len;
+	for (uint32_t i = 0, n = Samples(ms); i < n; i++)
+		Push(1500 * sin(2 * M_PI * 5 * i / trace.rate), 0, 0);
+	Label(GESTURE_SHAKE, from, 10, 1, 1 + ms / GESTURE_SHAKE_REFRACTORY_MS);
+	Rest(800);
+}
+
+/**
+ * @brief Vibrazione da camminata: 2 Hz, 250 mg lungo Y e Z; non deve produrre eventi.
+ */
+static void Walk(uint32_t ms) {
+	for (uint32_t i = 0, n = Samples(ms); i < n; i++) {
+		double v = 250 * sin(2 * M_PI * 2 * i / trace.rate);
+		Push(0, v, v);
+	}
+}
+
+/**
+ * @brief Rampa lineare dell'inclinazione fino a (x, y) in ms millisecondi (ms = 0: gradino).
+ */
+static void Tilt(double x, double y, uint32_t ms) {
+	double x0 = trace.gx, y0 = trace.gy;
+	uint32_t n = ms ? Samples(ms) : 0;
+	for (uint32_t i = 1; i <= n; i++) {
+		trace.gx = x0 + (x - x0) * i / n;
+		trace.gy = y0 + (y - y0) * i / n;
+		Push(0, 0, 0);
+	}
+	trace.gx = x;
+	trace.gy = y;
+}
+
+/**
+ * @brief Sessione etichettata.
+ */
+static void Build(uint16_t rate) {
+	memset(&trace, 0, sizeof(trace));
+	trace.rate = rate;
+
+	Rest(500);
+	ExpectTilt(0);
+	Tap();
+	DoubleTap(150);
+	DoubleTap(250);
+	Flick(0, 1, GESTURE_FLICK_RIGHT);
+	Flick(0, -1, GESTURE_FLICK_LEFT);
+	Flick(1, 1, GESTURE_FLICK_UP);
+	Flick(1, -1, GESTURE_FLICK_DOWN);
+	Shake(1500);
+	Walk(2000);
+	Rest(500);
+
+	/* inclinazione lenta a sinistra e ritorno: solo stato, nessun evento */
+	Tilt(-600, 0, 1000);
+	Rest(500);
+	ExpectTilt(GESTURE_TILT_LEFT);
+	Tilt(0, 0, 1000);
+	Rest(1000);
+	ExpectTilt(0);
+
+	/* inclinazione a gradino in avanti: il gradino non e' un flick */
+	Tilt(0, 600, 0);
+	Rest(1000);
+	ExpectTilt(GESTURE_TILT_UP);
+	Tilt(0, 0, 0);
+	Rest(1000);
+	ExpectTilt(0);
+
+	/* gesti con la board inclinata a destra */
+	Tilt(500, 0, 500);
+	Rest(1000);
+	ExpectTilt(GESTURE_TILT_RIGHT);
+	Tap();
+	Flick(0, -1, GESTURE_FLICK_LEFT);
+	Flick(1, 1, GESTURE_FLICK_UP);
+	ExpectTilt(GESTURE_TILT_RIGHT);
+	Tilt(-400, -400, 1000);
+	Rest(1000);
+	ExpectTilt(GESTURE_TILT_LEFT | GESTURE_TILT_DOWN);
+
+	/* isteresi: oltre la meta' della soglia la direzione resta attiva, sotto viene rilasciata */
+	Tilt(-TEST_TILT * 3 / 4, 0, 1000);
+	Rest(1000);
+	ExpectTilt(GESTURE_TILT_LEFT);
+	Tilt(-TEST_TILT / 4, 0, 1000);
+	Rest(1000);
+	ExpectTilt(0);
+	Tilt(-TEST_TILT * 3 / 4, 0, 1000);
+	Rest(1000);
+	ExpectTilt(0);
+	Tilt(0, 0, 1000);
+	Rest(1000);
+	ExpectTilt(0);
+}
+
+static uint32_t totalGestures, totalMissed, totalFalse;
+
+/**
+ * @brief Elabora la traccia e confronta eventi e inclinazione con le etichette.
+ * @param[out] log eventi prodotti, come (campione << 3 | evento)
+ * @return eventi prodotti
+ */
+static uint32_t Run(uint32_t* log) {
+	GESTURE_t g;
+	uint32_t n = 0, falsePositives = 0, next = 0;
+	GESTURE_Init(&g, trace.rate, TEST_TILT);
+	for (uint32_t t = 0; t < trace.len; t++) {
+		GESTURE_Event_t e = GESTURE_Process(&g, trace.s[t][0], trace.s[t][1], trace.s[t][2]);
+		if (e != GESTURE_NONE) {
+			log[n] = t << 3 | e;
+			n++;
+			Label_t* l = NULL;
+			for (uint32_t i = 0; i < trace.nLabels && !l; i++)
+				if (trace.labels[i].event == e && t >= trace.labels[i].from && t <= trace.labels[i].to)
+					l = &trace.labels[i];
+			if (l)
+				l->seen++;
+			else {
+				printf("  %4u Hz: %s inatteso a %u ms\n", trace.rate, names[e], t * 1000 / trace.rate);
+				falsePositives++;
+			}
+		}
+		for (; next < trace.nLabels && trace.labels[next].from <= t; next++) {
+			const Label_t* l = &trace.labels[next];
+			if (l->event == GESTURE_NONE && GESTURE_Tilt(&g) != l->tilt) {
+				printf("  %4u Hz: inclinazione %x, attesa %x a %u ms\n", trace.rate, GESTURE_Tilt(&g), l->tilt,
+						t * 1000 / trace.rate);
+				failures++;
+			}
+		}
+	}
+	uint32_t missed = 0, gestures = 0;
+	for (uint32_t i = 0; i < trace.nLabels; i++) {
+		const Label_t* l = &trace.labels[i];
+		if (l->event == GESTURE_NONE)
+			continue;
+		gestures++;
+		if (l->seen < l->min || l->seen > l->max) {
+			printf("  %4u Hz: %s a %u ms riconosciuto %u volte\n", trace.rate, names[l->event],
+					l->from * 1000 / trace.rate, l->seen);
+			missed++;
+		}
+	}
+	totalGestures += gestures;
+	totalMissed += missed;
+	totalFalse += falsePositives;
+	return n;
+}
+
+/**
+ * @brief Tracce etichettate alle frequenze del LIS3DSH usate nei progetti, con TEST_TRACES realizzazioni del rumore
+ * per frequenza, e riproducibilita'.
+ */
+static void TestTraces(void) {
+	static const uint16_t rates[] = { 100, 400, 1600 };
+	static uint32_t a[1024], b[1024];
+	for (size_t i = 0; i < sizeof(rates) / sizeof(rates[0]); i++) {
+		totalGestures = totalMissed = totalFalse = 0;
+		for (int k = 0; k < TEST_TRACES; k++) {
+			Build(rates[i]);
+			uint32_t n = Run(a);
+			for (uint32_t j = 0; j < trace.nLabels; j++)
+				trace.labels[j].seen = 0;
+			CHECK(Run(b) == n && memcmp(a, b, n * sizeof(uint32_t)) == 0);
+		}
+		printf("%4u Hz: %2d tracce da %6u campioni, %3u gesti etichettati, %u errati, %u falsi positivi\n",
+				rates[i], TEST_TRACES, trace.len, totalGestures / 2, totalMissed / 2, totalFalse / 2);
+		CHECK(totalMissed == 0);
+		CHECK(totalFalse == 0);
+	}
+}
+
+/**
+ * @brief Costo medio di GESTURE_Process() per campione, sulla traccia a 1600 Hz.
+ */
+static void Benchmark(void) {
+	GESTURE_t g;
+	long sink = 0;
+	Build(1600);
+	GESTURE_Init(&g, trace.rate, TEST_TILT);
+
+	struct timespec t0, t1;
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+#if defined(__x86_64__) || defined(__i386__)
+	uint64_t c0 = __rdtsc();
+#endif
+	for (uint32_t i = 0, t = 0; i < BENCH_SAMPLES; i++) {
+		sink += GESTURE_Process(&g, trace.s[t][0], trace.s[t][1], trace.s[t][2]);
+		if (++t == trace.len)
+			t = 0;
+	}
+#if defined(__x86_64__) || defined(__i386__)
+	uint64_t c1 = __rdtsc();
+#endif
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	double ns = ((t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec)) / BENCH_SAMPLES;
+#if defined(__x86_64__) || defined(__i386__)
+	printf("GESTURE_Process: %.1f ns, %.1f cicli TSC per campione (x, y, z) su host [%ld]\n", ns,
+			(double) (c1 - c0) / BENCH_SAMPLES, sink & 1);
+#else
+	printf("GESTURE_Process: %.1f ns per campione (x, y, z) su host [%ld]\n", ns, sink & 1);
+#endif
+}
+
+int main(void) {
+	TestTraces();
+	Benchmark();
+
+	printf("gesture: %s\n", failures ? "FAILED" : "OK");
+	return failures != 0;
+}
@@ -0,0 +1,259 @@
+/**
+ * @file hidqueue_test.c
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+/**
+ * @brief Verifica su host della coda di trasmissione dei report HID, con finestre di occupazione dell'endpoint casuali.
+ *
+ * @details
+ * L'endpoint simulato accetta un report alla volta e lo consegna all'host dopo un numero casuale di passi, invocando
+ * HIDQUEUE_Sent() come il callback di fine trasmissione. Ad ogni passo l'applicazione accoda un report:
+ *  - tastiera: report NKRO in cui cambiano tasti casuali; l'host conta, per ogni tasto, i fronti osservati, che devono
+ *    coincidere con quelli prodotti a meno di quelli dei report sostituiti, e lo stato finale deve coincidere;
+ *  - mouse: spostamenti casuali, anche oltre il range di un report, e cambi dei pulsanti; la somma degli spostamenti
+ *    ricevuti, piu' quelli ancora in coda, deve coincidere con quella prodotta.
+ *
+ * Poiche' ad ogni passo cambia al piu' un tasto (o pulsante), l'ultimo report accodato differisce dal nuovo per un solo
+ * fronte; la sostituzione perde quel fronte e quello opposto che lo stesso tasto aveva nel report sostituito. I fronti
+ * persi devono quindi essere esattamente il doppio di overflows: ne' fronti persi senza sostituzioni, ne' sostituzioni
+ * che perdono fronti di altri tasti.
+ *
+ * Sono verificati inoltre HIDQUEUE_Reset() con un report in trasmissione mai completato e la conversione del report
+ * NKRO accodato nel report boot.
+ * @code
+ * gcc -std=gnu99 -Wall -Wextra -IInc test/hidqueue_test.c Src/hidqueue.c Src/keyboard.c -o hidqueue_test && ./hidqueue_test
+ * @endcode
+ */
+#include "hidqueue.h"
+#include "keyboard.h"
+#include <stdio.h>
+#include <string.h>
+
+#define TEST_STEPS		200000		//!< report prodotti per ogni prova casuale
+#define TEST_KEYS		(8 * KEYBOARD_BITMAP_SIZE)
+
+static int failures = 0;
+
+#define CHECK(cond) do { if (!(cond)) { printf("%s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+/**
+ * @brief Generatore pseudo-casuale xorshift, per rendere la prova riproducibile.
+ */
+static uint32_t rng = 12345;
+static uint32_t Random(void) {
+	rng ^= rng << 13;
+	rng ^= rng >> 17;
+	rng ^= rng << 5;
+	return rng;
+}
+
+/**
+ * @brief Endpoint simulato.
+ */
+static struct {
+	int loaded;							//!< 1 se un report attende di essere prelevato dall'host
+	uint32_t left;						//!< passi mancanti al prelievo
+	uint32_t maxBusy;					//!< durata massima della finestra di occupazione
+	uint8_t report[HIDQUEUE_REPORT_SIZE];
+	uint8_t len;
+	uint32_t sends;						//!< chiamate della funzione di trasmissione
+} ep;
+
+static int EP_Send(void* ctx, uint8_t* report, uint8_t len) {
+	(void) ctx;
+	if (ep.loaded)
+		return -1;
+	memcpy(ep.report, report, len);
+	ep.len = len;
+	ep.loaded = 1;
+	ep.left = ep.maxBusy ? Random() % (ep.maxBusy + 1) : 0;
+	ep.sends++;
+	return 0;
+}
+
+static void Lock(void) {
+}
+
+static void Unlock(void) {
+}
+
+/**
+ * @brief Avanza di un passo l'endpoint; restituisce 1 se l'host ha prelevato un report.
+ */
+static int EP_Step(HIDQUEUE_t* q, uint8_t* received) {
+	if (!ep.loaded || ep.left-- > 0)
+		return 0;
+	memcpy(received, ep.report, ep.len);
+	ep.loaded = 0;
+	HIDQUEUE_Sent(q);
+	return 1;
+}
+
+/**
+ * @brief Tastiera: fronti di ciascun tasto osservati dall'host.
+ * @param[in] maxBusy durata massima della finestra di occupazione dell'endpoint, in passi
+ * @param[in] togglePermille probabilita', per mille, che un tasto cambi stato ad ogni passo
+ */
+static void TestKeyboard(uint32_t maxBusy, uint32_t togglePermille) {
+	HIDQUEUE_t q;
+	uint8_t state[KEYBOARD_NKRO_REPORT_SIZE] = { 0 }, host[KEYBOARD_NKRO_REPORT_SIZE] = { 0 }, rx[HIDQUEUE_REPORT_SIZE];
+	uint32_t produced[TEST_KEYS] = { 0 }, observed[TEST_KEYS] = { 0 };
+	memset(&ep, 0, sizeof(ep));
+	ep.maxBusy = maxBusy;
+	HIDQUEUE_Init(&q, HIDQUEUE_KEYBOARD, KEYBOARD_NKRO_REPORT_SIZE, EP_Send, NULL, Lock, Unlock);
+
+	for (uint32_t step = 0; step < TEST_STEPS || ep.loaded || HIDQUEUE_Count(&q); step++) {
+		if (step < TEST_STEPS && Random() % 1000 < togglePermille) {
+			uint32_t key = Random() % TEST_KEYS;
+			state[2 + key / 8] ^= 1 << (key % 8);
+			produced[key]++;
+			HIDQUEUE_Push(&q, state);
+		}
+		if (EP_Step(&q, rx)) {
+			for (uint32_t key = 0; key < TEST_KEYS; key++)
+				if ((rx[2 + key / 8] ^ host[2 + key / 8]) & (1 << (key % 8)))
+					observed[key]++;
+			memcpy(host, rx, sizeof(host));
+		}
+	}
+
+	uint32_t lost = 0, edges = 0;
+	for (uint32_t key = 0; key < TEST_KEYS; key++) {
+		lost += produced[key] - observed[key];
+		edges += produced[key];
+	}
+	printf("tastiera: occupazione <= %3u passi, %4u/1000 cambi per passo: %6u fronti, %6u report, %6u fusi, "
+			"%4u sostituiti, %4u fronti persi\n", (unsigned) maxBusy, (unsigned) togglePermille, (unsigned) edges,
+			(unsigned) q.sent, (unsigned) q.merged, (unsigned) q.overflows, (unsigned) lost);
+	CHECK(memcmp(host, state, sizeof(state)) == 0);
+	/* ad ogni passo cambia al piu' un tasto: ogni sostituzione fonde i due fronti opposti di quel tasto, e solo quelli */
+	CHECK(lost == 2 * q.overflows);
+}
+
+/**
+ * @brief Mouse: spostamento totale e fronti dei pulsanti osservati dall'host.
+ * @param[in] maxBusy durata massima della finestra di occupazione dell'endpoint, in passi
+ * @param[in] maxDelta massimo spostamento per report, in valore assoluto
+ * @param[in] buttonPermille probabilita', per mille, che un pulsante cambi stato ad ogni passo
+ */
+static void TestMouse(uint32_t maxBusy, int32_t maxDelta, uint32_t buttonPermille) {
+	HIDQUEUE_t q;
+	uint8_t report[4] = { 0 }, rx[HIDQUEUE_REPORT_SIZE], hostButtons = 0;
+	long produced[3] = { 0 }, received[3] = { 0 };
+	uint32_t edges = 0, observed = 0;
+	memset(&ep, 0, sizeof(ep));
+	ep.maxBusy = maxBusy;
+	HIDQUEUE_Init(&q, HIDQUEUE_MOUSE, sizeof(report), EP_Send, NULL, Lock, Unlock);
+
+	for (uint32_t step = 0; step < TEST_STEPS || ep.loaded || HIDQUEUE_Count(&q) || q.carry[0] || q.carry[1] ||
+			q.carry[2]; step++) {
+		if (step < TEST_STEPS) {
+			if (Random() % 1000 < buttonPermille) {
+				report[HIDQUEUE_MOUSE_BUTTONS] ^= 1 << (Random() % 3);
+				edges++;
+			}
+			for (int i = 0; i < 3; i++) {
+				int32_t d = (int32_t) (Random() % (2 * maxDelta + 1)) - maxDelta;
+				report[HIDQUEUE_MOUSE_X + i] = (uint8_t) (int8_t) d;
+				produced[i] += d;
+			}
+		}
+		else
+			memset(&report[HIDQUEUE_MOUSE_X], 0, 3);
+		/* a fine prova l'applicazione produce report vuoti finche' la coda conserva degli spostamenti */
+		if (step < TEST_STEPS || q.carry[0] || q.carry[1] || q.carry[2])
+			HIDQUEUE_Push(&q, report);
+		if (EP_Step(&q, rx)) {
+			for (int i = 0; i < 3; i++)
+				received[i] += (int8_t) rx[HIDQUEUE_MOUSE_X + i];
+			for (uint8_t diff = rx[HIDQUEUE_MOUSE_BUTTONS] ^ hostButtons; diff; diff &= diff - 1)
+				observed++;
+			hostButtons = rx[HIDQUEUE_MOUSE_BUTTONS];
+		}
+	}
+
+	printf("mouse:    occupazione <= %3u passi, spostamento <= %3d, %2u/1000 cambi: %6u report, %6u fusi, "
+			"%4u sostituiti, %4u fronti persi\n", (unsigned) maxBusy, (int) maxDelta, (unsigned) buttonPermille,
+			(unsigned) q.sent, (unsigned) q.merged, (unsigned) q.overflows, (unsigned) (edges - observed));
+	for (int i = 0; i < 3; i++)
+		CHECK(received[i] == produced[i]);
+	CHECK(hostButtons == report[HIDQUEUE_MOUSE_BUTTONS]);
+	/* come per la tastiera, ad ogni passo cambia al piu' un pulsante */
+	CHECK(edges - observed == 2 * q.overflows);
+}
+
+/**
+ * @brief Il report in trasmissione al reset del bus non viene mai completato: senza HIDQUEUE_Reset() la coda resta
+ * bloccata.
+ */
+static void TestReset(void) {
+	HIDQUEUE_t q;
+	uint8_t state[KEYBOARD_NKRO_REPORT_SIZE] = { 0 };
+	memset(&ep, 0, sizeof(ep));
+	HIDQUEUE_Init(&q, HIDQUEUE_KEYBOARD, KEYBOARD_NKRO_REPORT_SIZE, EP_Send, NULL, Lock, Unlock);
+
+	state[2] = 0x10;
+	HIDQUEUE_Push(&q, state);
+	state[2] = 0x30;
+	HIDQUEUE_Push(&q, state);
+	CHECK(ep.sends == 1);
+	CHECK(HIDQUEUE_Count(&q) == 1);
+
+	/* reset: l'endpoint viene chiuso e il report in trasmissione perso */
+	ep.loaded = 0;
+	HIDQUEUE_Reset(&q);
+	CHECK(HIDQUEUE_Count(&q) == 0);
+	CHECK(!q.busy);
+
+	/* dopo l'enumerazione l'host assume tutti i tasti rilasciati: lo stesso stato va trasmesso di nuovo */
+	HIDQUEUE_Push(&q, state);
+	CHECK(ep.sends == 2);
+	CHECK(memcmp(ep.report, state, sizeof(state)) == 0);
+}
+
+/**
+ * @brief Il report boot ottenuto dal report NKRO accodato coincide con quello costruito dallo stato della tastiera.
+ */
+static void TestBoot(void) {
+	KEYBOARD_t k;
+	uint8_t nkro[KEYBOARD_NKRO_REPORT_SIZE], boot[KEYBOARD_NKRO_REPORT_SIZE], converted[KEYBOARD_BOOT_REPORT_SIZE];
+	KEYBOARD_Init(&k);
+	for (int i = 0; i < 10000; i++) {
+		KEYBOARD_Set(&k, Random() % 2 ? KEYBOARD_LEFT_CTRL + Random() % 8 : KEYBOARD_FIRST_KEY + Random() % 24,
+				Random() % 3 != 0 && i % 50 < 40);
+		KEYBOARD_BuildReport(&k, KEYBOARD_NKRO, nkro);
+		CHECK(KEYBOARD_BuildReport(&k, KEYBOARD_BOOT, boot) == KEYBOARD_BOOT_REPORT_SIZE);
+		CHECK(KEYBOARD_ToBoot(nkro, converted) == KEYBOARD_BOOT_REPORT_SIZE);
+		CHECK(memcmp(boot, converted, KEYBOARD_BOOT_REPORT_SIZE) == 0);
+	}
+}
+
+int main(void) {
+	TestKeyboard(0, 100);
+	TestKeyboard(10, 300);
+	TestKeyboard(40, 300);
+	TestKeyboard(40, 900);
+	TestMouse(0, 20, 10);
+	TestMouse(10, 127, 10);
+	TestMouse(40, 127, 50);
+	TestMouse(40, 127, 500);
+	TestReset();
+	TestBoot();
+
+	printf("hidqueue: %s\n", failures ? "FAILED" : "OK");
+	return failures != 0;
+}
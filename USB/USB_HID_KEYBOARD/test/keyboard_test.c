@@ -0,0 +1,418 @@
+/**
+ * @file keyboard_test.c
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+/**
+ * @brief Verifica su host della macchina a stati della tastiera e dei descrittori HID, confrontati con le HID Usage
+ * Tables.
+ *
+ * @details
+ * Il descrittore di configurazione e il report descriptor sono ottenuti dalla classe HID della libreria USB, come li
+ * riceverebbe l'host (GET_DESCRIPTOR), con le funzioni del livello LL sostituite da stub. Il report descriptor viene
+ * interpretato item per item, ricostruendo per ogni bit del report di input l'usage page e l'usage associati; si
+ * verifica quindi che:
+ *  - la collection sia Generic Desktop / Keyboard e l'interfaccia supporti il boot protocol keyboard;
+ *  - il report sia lungo KEYBOARD_NKRO_REPORT_SIZE byte e stia nell'endpoint;
+ *  - per ogni usage rappresentabile, il bit impostato da KEYBOARD_BuildReport() sia quello che il descrittore associa
+ *    allo stesso usage della Keyboard/Keypad page (0x07).
+ *
+ * La macchina a stati e' verificata con una sequenza casuale di pressioni e rilasci, confrontata con un modello: un
+ * report e' richiesto solo quando lo stato di almeno un tasto cambia, la ripetizione di uno stato gia' noto non produce
+ * report (typematic a carico dell'host) e il report boot riporta ErrorRollOver con piu' di 6 tasti premuti.
+ * @code
+ * F=../../FreeRTOS; gcc -std=gnu99 -Wall -DSTM32F407xx -DUSE_HAL_DRIVER -IInc -I$F/HAL_Driver/Inc -I$F/CMSIS/device \
+ *   -I$F/CMSIS/core -IMiddlewares/ST/STM32_USB_Device_Library/Core/Inc \
+ *   -IMiddlewares/ST/STM32_USB_Device_Library/Class/HID/Inc test/keyboard_test.c Src/keyboard.c \
+ *   Middlewares/ST/STM32_USB_Device_Library/Class/HID/Src/usbd_hid.c -o keyboard_test && ./keyboard_test
+ * @endcode
+ */
+#include "keyboard.h"
+#include "usbd_hid.h"
+#include <stdio.h>
+#include <string.h>
+
+#define TEST_STEPS		100000		//!< operazioni della sequenza casuale
+#define REPORT_BITS		256			//!< bit massimi del report di input interpretato
+
+/* Usage della Keyboard/Keypad page (0x07), dalle HID Usage Tables 1.12, capitolo 10 */
+#define HUT_PAGE_GENERIC_DESKTOP	0x01
+#define HUT_USAGE_KEYBOARD			0x06
+#define HUT_PAGE_KEYBOARD			0x07
+#define HUT_ERROR_ROLLOVER			0x01
+#define HUT_KEYBOARD_A				0x04
+#define HUT_KEYPAD_EQUAL			0x67
+#define HUT_KEYBOARD_F13			0x68
+#define HUT_LEFT_CONTROL			0xE0
+#define HUT_RIGHT_GUI				0xE7
+
+static int failures = 0;
+
+#define CHECK(cond) do { if (!(cond)) { printf("%s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+/**
+ * @brief Generatore pseudo-casuale xorshift, per rendere la prova riproducibile.
+ */
+static uint32_t rng = 12345;
+static uint32_t Random(void) {
+	rng ^= rng << 13;
+	rng ^= rng >> 17;
+	rng ^= rng << 5;
+	return rng;
+}
+
+/*
+ * Stub del livello LL e delle richieste di controllo, usati dalla classe HID.
+ */
+static uint8_t* ctlData = NULL;
+static uint16_t ctlLength = 0;
+
+USBD_StatusTypeDef USBD_LL_OpenEP(USBD_HandleTypeDef* pdev, uint8_t ep_addr, uint8_t ep_type, uint16_t ep_mps) {
+	(void) pdev; (void) ep_addr; (void) ep_type; (void) ep_mps;
+	return USBD_OK;
+}
+
+USBD_StatusTypeDef USBD_LL_CloseEP(USBD_HandleTypeDef* pdev, uint8_t ep_addr) {
+	(void) pdev; (void) ep_addr;
+	return USBD_OK;
+}
+
+USBD_StatusTypeDef USBD_LL_Transmit(USBD_HandleTypeDef* pdev, uint8_t ep_addr, uint8_t* pbuf, uint16_t size) {
+	(void) pdev; (void) ep_addr; (void) pbuf; (void) size;
+	return USBD_OK;
+}
+
+USBD_StatusTypeDef USBD_CtlSendData(USBD_HandleTypeDef* pdev, uint8_t* pbuf, uint16_t len) {
+	(void) pdev;
+	ctlData = pbuf;
+	ctlLength = len;
+	return USBD_OK;
+}
+
+void USBD_CtlError(USBD_HandleTypeDef* pdev, USBD_SetupReqTypedef* req) {
+	(void) pdev; (void) req;
+	failures++;
+}
+
+/**
+ * @brief Campo del report di input associato ad un bit.
+ */
+typedef struct {
+	uint16_t page;		//!< usage page
+	uint16_t usage;		//!< usage
+	uint8_t constant;	//!< 1 se il bit e' di riempimento (Constant)
+} Field_t;
+
+/**
+ * @brief Esito dell'interpretazione del report descriptor.
+ */
+typedef struct {
+	Field_t input[REPORT_BITS];		//!< campi del report di input, bit per bit
+	unsigned inputBits;				//!< lunghezza del report di input, in bit
+	uint16_t collectionPage;		//!< usage page della collection application
+	uint16_t collectionUsage;		//!< usage della collection application
+	int depth;						//!< profondita' delle collection al termine (deve essere 0)
+	int errors;						//!< item non supportati o incoerenti
+} Descriptor_t;
+
+/**
+ * @brief Interpreta un report descriptor composto da short item (HID 1.11, paragrafo 6.2.2).
+ * @details Sono gestiti gli item usati da un report di tastiera: Usage Page, Logical Minimum/Maximum, Report Size,
+ * Report Count, Usage, Usage Minimum/Maximum, Input, Output, Collection, End Collection. Gli item Input Array sono
+ * segnalati come errore, poiche' il report NKRO deve essere composto solo da variabili.
+ */
+static void ParseDescriptor(const uint8_t* d, uint16_t len, Descriptor_t* out) {
+	memset(out, 0, sizeof(Descriptor_t));
+	uint16_t page = 0, usages[REPORT_BITS];
+	unsigned size = 0, count = 0, nUsages = 0, usageMin = 0, usageMax = 0, hasRange = 0;
+
+	for (uint16_t i = 0; i < len; ) {
+		uint8_t prefix = d[i++];
+		uint8_t bytes = (prefix & 0x03) == 3 ? 4 : (prefix & 0x03);
+		if (prefix == 0xFE || i + bytes > len) {
+			out->errors++;	// long item o descrittore troncato
+			return;
+		}
+		uint32_t data = 0;
+		for (uint8_t b = 0; b < bytes; b++)
+			data |= (uint32_t) d[i + b] << (8 * b);
+		i += bytes;
+
+		uint8_t tag = prefix & 0xFC;
+		switch (tag) {
+		case 0x04: page = data; break;
+		case 0x14: case 0x24: break;
+		case 0x74: size = data; break;
+		case 0x94: count = data; break;
+		case 0x08:
+			if (nUsages < REPORT_BITS)
+				usages[nUsages++] = data;
+			break;
+		case 0x18: usageMin = data; hasRange = 1; break;
+		case 0x28: usageMax = data; hasRange = 1; break;
+		case 0xA0:
+			if (out->depth == 0 && nUsages > 0) {
+				out->collectionPage = page;
+				out->collectionUsage = usages[0];
+			}
+			out->depth++;
+			nUsages = 0; hasRange = 0;
+			break;
+		case 0xC0:
+			out->depth--;
+			break;
+		case 0x80:
+		case 0x90: {
+			uint8_t constant = data & 0x01, variable = (data >> 1) & 0x01;
+			if (!constant && !variable)
+				out->errors++;
+			if (tag == 0x80 && out->inputBits + size * count > REPORT_BITS)
+				out->errors++;
+			else if (tag == 0x80)
+				for (unsigned f = 0; f < count; f++) {
+					uint16_t usage = 0;
+					if (hasRange)
+						usage = usageMin + f <= usageMax ? usageMin + f : usageMax;
+					else if (nUsages > 0)
+						usage = usages[f < nUsages ? f : nUsages - 1];
+					for (unsigned b = 0; b < size; b++) {
+						Field_t* field = &out->input[out->inputBits++];
+						field->page = page;
+						field->usage = usage;
+						field->constant = constant;
+					}
+				}
+			nUsages = 0; hasRange = 0;
+			break;
+		}
+		default:
+			out->errors++;
+			break;
+		}
+	}
+}
+
+/**
+ * @brief Restituisce l'indice dell'unico bit impostato nel report, -1 se i bit impostati non sono esattamente uno.
+ */
+static int SingleBit(const uint8_t* report, uint8_t len) {
+	int bit = -1;
+	for (unsigned i = 0; i < len * 8u; i++)
+		if (report[i / 8] & (1 << (i % 8))) {
+			if (bit >= 0)
+				return -1;
+			bit = i;
+		}
+	return bit;
+}
+
+/**
+ * @brief Verifica i descrittori della classe HID e la corrispondenza fra report descriptor e report costruiti.
+ */
+static void TestDescriptor(void) {
+	uint16_t cfgLen = 0;
+	uint8_t* cfg = USBD_HID.GetFSConfigDescriptor(&cfgLen);
+	CHECK(cfgLen == USB_HID_CONFIG_DESC_SIZ);
+	CHECK(cfg[2] + (cfg[3] << 8) == cfgLen);
+
+	unsigned reportDescLen = 0, interfaces = 0, endpoints = 0;
+	for (unsigned i = 0; i + 1 < cfgLen && cfg[i] != 0; i += cfg[i]) {
+		const uint8_t* desc = &cfg[i];
+		if (desc[1] == USB_DESC_TYPE_INTERFACE) {
+			interfaces++;
+			CHECK(desc[5] == 0x03);		// HID
+			CHECK(desc[6] == 0x01);		// boot interface subclass
+			CHECK(desc[7] == 0x01);		// protocollo keyboard
+		}
+		else if (desc[1] == HID_DESCRIPTOR_TYPE) {
+			CHECK(desc[6] == HID_REPORT_DESC);
+			reportDescLen = desc[7] + (desc[8] << 8);
+		}
+		else if (desc[1] == USB_DESC_TYPE_ENDPOINT) {
+			endpoints++;
+			CHECK(desc[2] == HID_EPIN_ADDR);
+			CHECK((desc[3] & 0x03) == 0x03);	// interrupt
+			CHECK(desc[4] + (desc[5] << 8) >= KEYBOARD_NKRO_REPORT_SIZE);
+		}
+	}
+	CHECK(interfaces == 1 && endpoints == 1);
+
+	USBD_HandleTypeDef dev;
+	memset(&dev, 0, sizeof(dev));
+	USBD_SetupReqTypedef req = { 0x81, USB_REQ_GET_DESCRIPTOR, HID_REPORT_DESC << 8, 0, 0xFF };
+	ctlData = NULL;
+	USBD_HID.Setup(&dev, &req);
+	CHECK(ctlData != NULL && ctlLength == reportDescLen);
+	if (ctlData == NULL)
+		return;
+
+	static Descriptor_t parsed;
+	ParseDescriptor(ctlData, ctlLength, &parsed);
+	CHECK(parsed.errors == 0);
+	CHECK(parsed.depth == 0);
+	CHECK(parsed.collectionPage == HUT_PAGE_GENERIC_DESKTOP);
+	CHECK(parsed.collectionUsage == HUT_USAGE_KEYBOARD);
+	CHECK(parsed.inputBits == 8 * KEYBOARD_NKRO_REPORT_SIZE);
+	CHECK(parsed.inputBits <= 8 * HID_EPIN_SIZE);
+	for (unsigned b = 8; b < 16; b++)
+		CHECK(parsed.input[b].constant);	// byte riservato, come nel report boot
+
+	// ogni usage rappresentabile deve finire nel bit che il descrittore gli associa
+	unsigned checked = 0;
+	for (unsigned usage = 0; usage <= 0xFF; usage++) {
+		KEYBOARD_t k;
+		uint8_t report[KEYBOARD_NKRO_REPORT_SIZE];
+		KEYBOARD_Init(&k);
+		KEYBOARD_BuildReport(&k, KEYBOARD_NKRO, report);
+		KEYBOARD_Set(&k, usage, 1);
+		int bit = SingleBit(report, KEYBOARD_BuildReport(&k, KEYBOARD_NKRO, report));
+		uint8_t representable = (usage >= HUT_KEYBOARD_A && usage <= HUT_KEYPAD_EQUAL)
+				|| (usage >= HUT_LEFT_CONTROL && usage <= HUT_RIGHT_GUI);
+		if (!representable) {
+			CHECK(bit < 0 && !KEYBOARD_Changed(&k));
+			continue;
+		}
+		CHECK(bit >= 0 && (unsigned) bit < parsed.inputBits);
+		if (bit < 0 || (unsigned) bit >= parsed.inputBits)
+			continue;
+		CHECK(parsed.input[bit].page == HUT_PAGE_KEYBOARD);
+		CHECK(parsed.input[bit].usage == usage);
+		CHECK(!parsed.input[bit].constant);
+		checked++;
+	}
+	CHECK(checked == (HUT_KEYPAD_EQUAL - HUT_KEYBOARD_A + 1) + 8);
+
+	// l'host puo' selezionare il boot protocol; il dispositivo parte in report protocol
+	CHECK(USBD_HID.Init(&dev, 0) == 0);
+	CHECK(USBD_HID_GetProtocol(&dev) == KEYBOARD_NKRO);
+	USBD_SetupReqTypedef setProtocol = { 0x21, HID_REQ_SET_PROTOCOL, KEYBOARD_BOOT, 0, 0 };
+	USBD_HID.Setup(&dev, &setProtocol);
+	CHECK(USBD_HID_GetProtocol(&dev) == KEYBOARD_BOOT);
+	USBD_HID.DeInit(&dev, 0);
+}
+
+/**
+ * @brief Verifica le costanti del modulo rispetto alle HID Usage Tables.
+ */
+static void TestUsageTables(void) {
+	CHECK(KEYBOARD_ERROR_ROLLOVER == HUT_ERROR_ROLLOVER);
+	CHECK(KEYBOARD_FIRST_KEY == HUT_KEYBOARD_A);
+	CHECK(KEYBOARD_NKRO_MAX_USAGE == HUT_KEYPAD_EQUAL);
+	CHECK(KEYBOARD_LEFT_CTRL == HUT_LEFT_CONTROL);
+	CHECK(KEYBOARD_RIGHT_GUI == HUT_RIGHT_GUI);
+	CHECK(KEYBOARD_BOOT_REPORT_SIZE == 8);	// HID 1.11, appendice B.1
+
+	KEYBOARD_t k;
+	KEYBOARD_Init(&k);
+	KEYBOARD_Set(&k, HUT_KEYBOARD_F13, 1);
+	CHECK(!KEYBOARD_IsPressed(&k, HUT_KEYBOARD_F13));
+	KEYBOARD_Set(&k, HUT_ERROR_ROLLOVER, 1);
+	CHECK(!KEYBOARD_IsPressed(&k, HUT_ERROR_ROLLOVER));
+}
+
+/**
+ * @brief Costruisce il report boot atteso dallo stato del modello.
+ */
+static void ModelBoot(const uint8_t* pressed, uint8_t* boot) {
+	memset(boot, 0, KEYBOARD_BOOT_REPORT_SIZE);
+	unsigned n = 0;
+	for (unsigned u = HUT_LEFT_CONTROL; u <= HUT_RIGHT_GUI; u++)
+		if (pressed[u])
+			boot[0] |= 1 << (u - HUT_LEFT_CONTROL);
+	for (unsigned u = HUT_KEYBOARD_A; u <= HUT_KEYPAD_EQUAL; u++)
+		if (pressed[u]) {
+			if (n == KEYBOARD_BOOT_KEYS) {
+				memset(&boot[2], HUT_ERROR_ROLLOVER, KEYBOARD_BOOT_KEYS);
+				return;
+			}
+			boot[2 + n++] = u;
+		}
+}
+
+/**
+ * @brief Sequenza casuale di pressioni e rilasci, confrontata con un modello.
+ */
+static void TestStateMachine(void) {
+	KEYBOARD_t k;
+	uint8_t pressed[256] = { 0 }, changed = 1;
+	uint8_t report[KEYBOARD_NKRO_REPORT_SIZE], boot[KEYBOARD_BOOT_REPORT_SIZE];
+	unsigned reports = 0, rollovers = 0;
+	KEYBOARD_Init(&k);
+
+	for (unsigned step = 0; step < TEST_STEPS; step++) {
+		// pochi tasti, cosi' da ripetere spesso uno stato gia' noto e superare a volte i 6 tasti premuti
+		static const uint8_t keys[] = { 0x04, 0x05, 0x16, 0x1A, 0x28, 0x2C, 0x4F, 0x50, 0x51, 0x52, 0x67, 0xE0, 0xE1,
+				0xE7 };
+		uint8_t usage = keys[Random() % sizeof(keys)];
+		uint8_t state = Random() % 4 != 0;	// pressioni piu' frequenti dei rilasci
+		if (pressed[usage] != state)
+			changed = 1;
+		pressed[usage] = state;
+		KEYBOARD_Set(&k, usage, state);
+		CHECK(KEYBOARD_IsPressed(&k, usage) == state);
+		CHECK(KEYBOARD_Changed(&k) == changed);
+
+		if (Random() % 3 != 0 || !KEYBOARD_Changed(&k))
+			continue;
+		KEYBOARD_Protocol_t protocol = Random() % 2 ? KEYBOARD_NKRO : KEYBOARD_BOOT;
+		uint8_t len = KEYBOARD_BuildReport(&k, protocol, report);
+		changed = 0;
+		reports++;
+		CHECK(!KEYBOARD_Changed(&k));
+		if (protocol == KEYBOARD_NKRO) {
+			CHECK(len == KEYBOARD_NKRO_REPORT_SIZE);
+			for (unsigned u = 0; u <= 0xFF; u++) {
+				uint8_t representable = (u >= HUT_KEYBOARD_A && u <= HUT_KEYPAD_EQUAL)
+						|| (u >= HUT_LEFT_CONTROL && u <= HUT_RIGHT_GUI);
+				if (!representable)
+					continue;
+				unsigned bit = u >= HUT_LEFT_CONTROL ? u - HUT_LEFT_CONTROL : 16 + u;
+				CHECK(((report[bit / 8] >> (bit % 8)) & 1) == pressed[u]);
+			}
+			uint8_t converted[KEYBOARD_BOOT_REPORT_SIZE];
+			ModelBoot(pressed, boot);
+			CHECK(KEYBOARD_ToBoot(report, converted) == KEYBOARD_BOOT_REPORT_SIZE);
+			CHECK(memcmp(converted, boot, KEYBOARD_BOOT_REPORT_SIZE) == 0);
+		}
+		else {
+			CHECK(len == KEYBOARD_BOOT_REPORT_SIZE);
+			ModelBoot(pressed, boot);
+			CHECK(memcmp(report, boot, KEYBOARD_BOOT_REPORT_SIZE) == 0);
+			if (report[2] == HUT_ERROR_ROLLOVER)
+				rollovers++;
+		}
+	}
+	CHECK(reports > 0 && rollovers > 0);
+
+	// un tasto tenuto premuto non produce altri report; Invalidate() ne forza uno
+	KEYBOARD_Init(&k);
+	KEYBOARD_Set(&k, HUT_KEYBOARD_A, 1);
+	KEYBOARD_BuildReport(&k, KEYBOARD_NKRO, report);
+	for (unsigned i = 0; i < 10; i++)
+		KEYBOARD_Set(&k, HUT_KEYBOARD_A, 1);
+	CHECK(!KEYBOARD_Changed(&k));
+	KEYBOARD_Invalidate(&k);
+	CHECK(KEYBOARD_Changed(&k));
+	printf("keyboard: %u report, %u con ErrorRollOver\n", reports, rollovers);
+}
+
+int main(void) {
+	TestUsageTables();
+	TestDescriptor();
+	TestStateMachine();
+	printf("keyboard_test: %s\n", failures == 0 ? "OK" : "FAILED");
+	return failures != 0;
+}
@@ -0,0 +1,356 @@
+/**
+ * @file power_test.c
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+/**
+ * @brief Verifica su host della gestione della sospensione e del remote wakeup.
+ *
+ * @details
+ * Le funzioni di POWER_Hooks_t sono sostituite da un modello del dispositivo e dell'host che registra le invocazioni.
+ * Sono verificati i percorsi della macchina a stati (sospensione e ripresa da parte dell'host, remote wakeup
+ * abilitato e non, attesa di POWER_IDLE_MS, durata della segnalazione di resume, host che non riprende il bus),
+ * il rilevamento del movimento con POWER_Motion(), una richiesta di risveglio prodotta da un'interruzione mentre il
+ * processore e' fermo, il riavvolgimento del contatore dei millisecondi e, infine, una sequenza casuale di eventi del
+ * bus e di richieste di risveglio su cui sono verificati gli invarianti:
+ *  - suspend() e resume() si alternano, a partire da suspend();
+ *  - sleep() viene invocata solo con il bus sospeso e senza richieste di risveglio;
+ *  - wakeupStart() e wakeupStop() si alternano, la segnalazione dura almeno POWER_RESUME_SIGNAL_MS e viene avviata
+ *    solo se l'host ha abilitato il remote wakeup e il bus e' sospeso da almeno POWER_IDLE_MS.
+ * @code
+ * gcc -std=gnu99 -Wall -Wextra -IInc test/power_test.c Src/power.c -o power_test && ./power_test
+ * @endcode
+ */
+#include "power.h"
+#include <stdio.h>
+#include <string.h>
+
+#define TEST_THRESHOLD		100			//!< soglia di movimento (mg)
+#define TEST_STEPS			2000000		//!< passi della sequenza casuale
+
+static int failures = 0;
+
+#define CHECK(cond) do { if (!(cond)) { printf("%s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+/**
+ * @brief Generatore pseudo-casuale xorshift, per rendere la prova riproducibile.
+ */
+static uint32_t rng = 12345;
+static uint32_t Random(void) {
+	rng ^= rng << 13;
+	rng ^= rng >> 17;
+	rng ^= rng << 5;
+	return rng;
+}
+
+/**
+ * @brief Modello del dispositivo e dell'host.
+ */
+typedef struct {
+	POWER_t* p;
+	uint32_t now;				//!< tempo corrente (ms)
+	uint8_t busSuspended;		//!< stato del bus
+	uint8_t remoteWakeup;		//!< remote wakeup abilitato dall'host
+	uint8_t lowPower;			//!< 1 tra suspend() e resume()
+	uint8_t signalling;			//!< 1 tra wakeupStart() e wakeupStop()
+	uint32_t suspendedAt;		//!< istante dell'ultimo suspend()
+	uint32_t signalAt;			//!< istante dell'ultimo wakeupStart()
+	uint8_t wakeInSleep;		//!< se 1, sleep() simula un'interruzione che richiede il risveglio
+	uint32_t suspends, resumes, sleeps, starts, stops;
+	uint32_t errors;			//!< violazioni degli invarianti
+} Model_t;
+
+static Model_t model;
+
+static void Error(const char* what) {
+	if (model.errors++ < 10)
+		printf("  t=%u ms: %s\n", model.now, what);
+}
+
+static void Suspend(void* ctx) {
+	CHECK(ctx == &model);
+	if (model.lowPower)
+		Error("suspend() ripetuta");
+	model.lowPower = 1;
+	model.suspendedAt = model.now;
+	model.suspends++;
+}
+
+static void Resume(void* ctx) {
+	(void) ctx;
+	if (!model.lowPower)
+		Error("resume() senza suspend()");
+	if (model.signalling)
+		Error("resume() durante la segnalazione");
+	model.lowPower = 0;
+	model.resumes++;
+}
+
+static void Sleep(void* ctx) {
+	(void) ctx;
+	if (!model.busSuspended || !model.lowPower)
+		Error("sleep() con il bus attivo");
+	if (POWER_WakePending(model.p))
+		Error("sleep() con una richiesta di risveglio");
+	model.sleeps++;
+	if (model.wakeInSleep) {
+		model.wakeInSleep = 0;
+		POWER_Wake(model.p);
+	}
+}
+
+static void WakeupStart(void* ctx) {
+	(void) ctx;
+	if (model.signalling)
+		Error("wakeupStart() ripetuta");
+	if (!model.remoteWakeup)
+		Error("remote wakeup non abilitato");
+	if (!model.busSuspended)
+		Error("remote wakeup con il bus attivo");
+	if (model.now - model.suspendedAt < POWER_IDLE_MS)
+		Error("remote wakeup prima di POWER_IDLE_MS");
+	model.signalling = 1;
+	model.signalAt = model.now;
+	model.starts++;
+}
+
+static void WakeupStop(void* ctx) {
+	(void) ctx;
+	if (!model.signalling)
+		Error("wakeupStop() senza wakeupStart()");
+	if (model.now - model.signalAt < POWER_RESUME_SIGNAL_MS)
+		Error("segnalazione di resume troppo breve");
+	model.signalling = 0;
+	model.stops++;
+}
+
+static uint8_t WakeupEnabled(void* ctx) {
+	(void) ctx;
+	return model.remoteWakeup;
+}
+
+static const POWER_Hooks_t hooks = { Suspend, Resume, Sleep, WakeupStart, WakeupStop, WakeupEnabled };
+
+static POWER_State_t Step(void) {
+	return POWER_Process(model.p, model.busSuspended, model.now);
+}
+
+static void Setup(POWER_t* p, uint32_t now) {
+	memset(&model, 0, sizeof(model));
+	model.p = p;
+	model.now = now;
+	POWER_Init(p, &hooks, &model, TEST_THRESHOLD);
+}
+
+/**
+ * @brief Sospensione e ripresa da parte dell'host, senza richieste di risveglio.
+ */
+static void TestHostResume(void) {
+	POWER_t p;
+	Setup(&p, 1000);
+	POWER_Wake(&p);
+	CHECK(!POWER_WakePending(&p));				/* ignorata con il bus attivo */
+	CHECK(Step() == POWER_ACTIVE && model.suspends == 0);
+	model.busSuspended = 1;
+	CHECK(Step() == POWER_SUSPENDED && model.suspends == 1 && model.sleeps == 0);
+	for (int i = 0; i < 10; i++, model.now++)
+		CHECK(Step() == POWER_SUSPENDED);
+	CHECK(model.sleeps == 10);
+	model.busSuspended = 0;
+	CHECK(Step() == POWER_ACTIVE && model.resumes == 1 && model.starts == 0);
+	CHECK(model.errors == 0);
+}
+
+/**
+ * @brief Remote wakeup: attesa di POWER_IDLE_MS, segnalazione, ripresa da parte dell'host.
+ */
+static void TestRemoteWakeup(void) {
+	POWER_t p;
+	Setup(&p, 0);
+	model.remoteWakeup = 1;
+	model.busSuspended = 1;
+	Step();
+	POWER_Wake(&p);
+	CHECK(POWER_WakePending(&p));
+	/* prima di POWER_IDLE_MS il processore non viene fermato e la richiesta resta in attesa */
+	for (uint32_t t = 0; t < POWER_IDLE_MS; t++, model.now++)
+		CHECK(Step() == POWER_SUSPENDED);
+	CHECK(model.sleeps == 0 && model.starts == 0);
+	CHECK(Step() == POWER_RESUMING && model.starts == 1 && p.wakeups == 1);
+	CHECK(!POWER_WakePending(&p));
+	/* la segnalazione dura POWER_RESUME_SIGNAL_MS anche se l'host riprende subito il bus */
+	model.busSuspended = 0;
+	for (uint32_t t = 1; t < POWER_RESUME_SIGNAL_MS; t++) {
+		model.now++;
+		CHECK(Step() == POWER_RESUMING && model.stops == 0);
+	}
+	model.now++;
+	CHECK(Step() == POWER_ACTIVE && model.stops == 1 && model.resumes == 1);
+	CHECK(model.errors == 0);
+}
+
+/**
+ * @brief Remote wakeup non abilitato: la richiesta viene scartata e il processore torna a fermarsi.
+ */
+static void TestWakeupDisabled(void) {
+	POWER_t p;
+	Setup(&p, 0);
+	model.busSuspended = 1;
+	Step();
+	model.now += 100;
+	POWER_Wake(&p);
+	CHECK(Step() == POWER_SUSPENDED && model.starts == 0 && !POWER_WakePending(&p));
+	CHECK(model.sleeps == 0);
+	CHECK(Step() == POWER_SUSPENDED && model.sleeps == 1);
+	CHECK(model.errors == 0);
+}
+
+/**
+ * @brief L'host non riprende il bus: dopo POWER_RESUME_TIMEOUT_MS si torna in sospensione, e un movimento
+ * successivo produce un nuovo remote wakeup.
+ */
+static void TestResumeTimeout(void) {
+	POWER_t p;
+	Setup(&p, 0);
+	model.remoteWakeup = 1;
+	model.busSuspended = 1;
+	Step();
+	model.now += POWER_IDLE_MS;
+	POWER_Wake(&p);
+	CHECK(Step() == POWER_RESUMING);
+	uint32_t start = model.now;
+	while (Step() == POWER_RESUMING && model.now - start < 10 * POWER_RESUME_TIMEOUT_MS)
+		model.now++;
+	CHECK(p.state == POWER_SUSPENDED && model.now - start == POWER_RESUME_TIMEOUT_MS);
+	CHECK(model.stops == 1 && model.resumes == 0);
+	/* il riferimento del movimento viene riacquisito */
+	POWER_Motion(&p, 0, 0, 1000);
+	POWER_Motion(&p, TEST_THRESHOLD, 0, 1000);
+	CHECK(!POWER_WakePending(&p));
+	POWER_Motion(&p, 0, 0, 1000 - TEST_THRESHOLD - 1);
+	CHECK(POWER_WakePending(&p));
+	model.now += POWER_IDLE_MS;
+	CHECK(Step() == POWER_RESUMING && model.starts == 2);
+	CHECK(model.errors == 0);
+}
+
+/**
+ * @brief POWER_Motion(): ignorata fuori dalla sospensione, riferimento riacquisito ad ogni sospensione.
+ */
+static void TestMotion(void) {
+	POWER_t p;
+	Setup(&p, 0);
+	POWER_Motion(&p, 0, 0, 1000);
+	POWER_Motion(&p, 1000, 1000, 0);
+	CHECK(!POWER_WakePending(&p) && !p.refValid);
+	model.busSuspended = 1;
+	Step();
+	POWER_Motion(&p, 500, -500, 700);
+	for (int d = -TEST_THRESHOLD; d <= TEST_THRESHOLD; d++) {
+		POWER_Motion(&p, 500 + d, -500 - d, 700 + d);
+		CHECK(!POWER_WakePending(&p));
+	}
+	POWER_Motion(&p, 500, -500 - TEST_THRESHOLD - 1, 700);
+	CHECK(POWER_WakePending(&p));
+	/* valori estremi: lo scostamento e' calcolato a 32 bit */
+	model.busSuspended = 0;
+	Step();
+	model.busSuspended = 1;
+	Step();
+	POWER_Motion(&p, INT16_MAX, 0, 0);
+	CHECK(!POWER_WakePending(&p));
+	POWER_Motion(&p, INT16_MIN, 0, 0);
+	CHECK(POWER_WakePending(&p));
+	CHECK(model.errors == 0);
+}
+
+/**
+ * @brief Richiesta di risveglio prodotta da un'interruzione servita dopo l'uscita dallo stop mode, e riavvolgimento
+ * del contatore dei millisecondi.
+ */
+static void TestWakeDuringSleep(void) {
+	POWER_t p;
+	Setup(&p, UINT32_MAX - 2);
+	model.remoteWakeup = 1;
+	model.busSuspended = 1;
+	Step();
+	model.wakeInSleep = 1;
+	CHECK(Step() == POWER_SUSPENDED && model.sleeps == 1 && POWER_WakePending(&p));
+	CHECK(Step() == POWER_SUSPENDED && model.sleeps == 1);
+	model.now += POWER_IDLE_MS;						/* il contatore si riavvolge */
+	CHECK(Step() == POWER_RESUMING && model.starts == 1);
+	model.now += POWER_RESUME_SIGNAL_MS;
+	model.busSuspended = 0;
+	CHECK(Step() == POWER_ACTIVE && model.stops == 1 && model.resumes == 1);
+	CHECK(model.errors == 0);
+}
+
+/**
+ * @brief Sequenza casuale di eventi del bus, richieste di risveglio e abilitazione del remote wakeup.
+ */
+static void TestRandom(void) {
+	POWER_t p;
+	uint32_t active = 0, suspended = 0, resuming = 0;
+	Setup(&p, Random());
+	for (int i = 0; i < TEST_STEPS; i++) {
+		uint32_t r = Random();
+		model.now += r & 3;
+		if ((r >> 2) % 200 == 0)
+			model.busSuspended = !model.busSuspended;
+		if ((r >> 10) % 500 == 0)
+			model.remoteWakeup = !model.remoteWakeup;
+		if ((r >> 20) % 100 == 0)
+			POWER_Wake(&p);
+		if ((r >> 28) == 0)
+			model.wakeInSleep = 1;
+		switch (Step()) {
+		case POWER_ACTIVE:
+			active++;
+			if (model.lowPower || model.signalling || model.busSuspended)
+				Error("POWER_ACTIVE incoerente");
+			break;
+		case POWER_SUSPENDED:
+			suspended++;
+			if (!model.lowPower || model.signalling)
+				Error("POWER_SUSPENDED incoerente");
+			break;
+		case POWER_RESUMING:
+			resuming++;
+			if (!model.lowPower)
+				Error("POWER_RESUMING incoerente");
+			break;
+		}
+	}
+	printf("sequenza casuale: %u passi attivi, %u sospesi, %u in resume; %u sospensioni, %u remote wakeup, "
+			"%u stop mode\n", active, suspended, resuming, model.suspends, model.starts, model.sleeps);
+	CHECK(model.errors == 0);
+	CHECK(model.starts == p.wakeups && model.starts > 100);
+	CHECK(model.stops == model.starts || model.stops + 1 == model.starts);
+	CHECK(model.resumes == model.suspends || model.resumes + 1 == model.suspends);
+}
+
+int main(void) {
+	TestHostResume();
+	TestRemoteWakeup();
+	TestWakeupDisabled();
+	TestResumeTimeout();
+	TestMotion();
+	TestWakeDuringSleep();
+	TestRandom();
+
+	printf("power: %s\n", failures ? "FAILED" : "OK");
+	return failures != 0;
+}
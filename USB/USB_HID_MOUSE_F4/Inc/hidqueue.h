@@ -0,0 +1,176 @@
+/**
+ * @file hidqueue.h
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef HIDQUEUE_H_
+#define HIDQUEUE_H_
+
+/**
+ * @addtogroup USBD
+ * @{
+ * @addtogroup HID
+ * @{
+ * @defgroup HIDQUEUE
+ * @{
+ *
+ * @brief Coda di trasmissione dei report HID.
+ *
+ * @details
+ * USBD_HID_SendReport() non puo' trasmettere un report mentre l'endpoint IN e' occupato dal report precedente. La coda
+ * raccoglie i report prodotti dall'applicazione e li trasmette, uno alla volta, al completamento del precedente
+ * (HIDQUEUE_Sent(), da invocare in USBD_HID_ReportSentCallback()), senza perdere informazione:
+ *  - HIDQUEUE_MOUSE: report relativi del mouse in formato boot {buttons, x, y, wheel}. Finche' l'endpoint e' occupato,
+ *    un nuovo report con gli stessi pulsanti viene fuso con l'ultimo accodato sommando gli spostamenti; la parte che
+ *    eccede il range di un int8_t e' conservata e sommata ai report successivi, o trasmessa in un report dedicato
+ *    quando la coda si svuota. Un cambiamento dei pulsanti occupa sempre un nuovo report, per cui pressioni e rilasci
+ *    sono trasmessi nell'ordine in cui si sono verificati.
+ *  - HIDQUEUE_KEYBOARD: report di stato della tastiera, in cui ogni bit rappresenta un tasto (ad esempio il report
+ *    NKRO; la conversione in un formato a elenco di usage, come il report boot, va fatta nella funzione di
+ *    trasmissione). Ogni report che differisce dall'ultimo accodato viene trasmesso nell'ordine, per cui nessun fronte
+ *    di pressione o rilascio viene perso; un report identico all'ultimo e' scartato.
+ *
+ * Se la coda e' piena, viene liberato lo slot del report accodato meno recente che non rappresenta un fronte:
+ * un report in cui nessun tasto (o pulsante del mouse) cambia stato sia rispetto al precedente sia rispetto al successivo.
+ * Eliminandolo, i due cambiamenti sono trasmessi insieme, senza perdere alcun fronte; per il mouse, i suoi spostamenti
+ * sono sommati a quelli del report precedente.
+ *
+ * Il report in testa non e' mai eliminato. Se nessun report puo' essere eliminato, il nuovo report sostituisce l'ultimo
+ * accodato, in modo che lo stato finale sia corretto (per il mouse gli spostamenti sono conservati), e l'evento, che
+ * comporta la perdita di un fronte, viene contato in overflows.<br>
+ * Al reset del bus o alla deconfigurazione del dispositivo il trasferimento in corso non verra' mai completato:
+ * HIDQUEUE_Reset() svuota la coda e libera l'endpoint.
+ *
+ * La coda non dipende dalla libreria HAL: la trasmissione e la mutua esclusione con l'interruzione USB sono fornite
+ * dall'applicazione in HIDQUEUE_Init().
+ */
+
+#include <inttypes.h>
+
+#ifndef HIDQUEUE_LENGTH
+#define HIDQUEUE_LENGTH			8		//!< Numero di report accodabili (potenza di 2)
+#endif
+
+#ifndef HIDQUEUE_REPORT_SIZE
+#define HIDQUEUE_REPORT_SIZE	16		//!< Dimensione massima di un report
+#endif
+
+#if (HIDQUEUE_LENGTH & (HIDQUEUE_LENGTH - 1)) != 0
+#error "HIDQUEUE_LENGTH deve essere una potenza di 2"
+#endif
+
+#define HIDQUEUE_MOUSE_BUTTONS	0		//!< Offset del campo pulsanti nel report del mouse
+#define HIDQUEUE_MOUSE_X		1		//!< Offset dello spostamento lungo x nel report del mouse
+#define HIDQUEUE_MOUSE_Y		2		//!< Offset dello spostamento lungo y nel report del mouse
+#define HIDQUEUE_MOUSE_WHEEL	3		//!< Offset dello scroll nel report del mouse
+
+/**
+ * @brief Politica di accodamento dei report.
+ */
+typedef enum {
+	HIDQUEUE_MOUSE,		//!< report relativi, fusi sommando gli spostamenti
+	HIDQUEUE_KEYBOARD	//!< report di stato, trasmessi in ordine ad ogni cambiamento
+} HIDQUEUE_Mode_t;
+
+/**
+ * @brief Funzione che avvia la trasmissione di un report.
+ * @param[in] ctx contesto fornito in HIDQUEUE_Init()
+ * @param[in] report report da trasmettere; resta invariato fino alla chiamata di HIDQUEUE_Sent()
+ * @param[in] len lunghezza del report
+ * @return 0 se la trasmissione e' stata avviata, un valore diverso da 0 altrimenti
+ */
+typedef int (*HIDQUEUE_Send_t)(void* ctx, uint8_t* report, uint8_t len);
+
+/**
+ * @brief Struttura che rappresenta la coda di trasmissione.
+ */
+typedef struct {
+	uint8_t slot[HIDQUEUE_LENGTH][HIDQUEUE_REPORT_SIZE];	//!< buffer circolare dei report
+	uint8_t tx[HIDQUEUE_REPORT_SIZE];	//!< report in trasmissione
+	uint8_t last[HIDQUEUE_REPORT_SIZE];	//!< ultimo report accodato o trasmesso (HIDQUEUE_KEYBOARD)
+	int16_t carry[3];					//!< spostamenti x, y, wheel da sommare al report successivo (HIDQUEUE_MOUSE)
+	uint8_t head;						//!< indice del prossimo report da trasmettere
+	uint8_t tail;						//!< indice del primo slot libero
+	uint8_t len;						//!< lunghezza dei report
+	volatile uint8_t busy;				//!< 1 se un report e' in trasmissione
+	HIDQUEUE_Mode_t mode;				//!< politica di accodamento
+	HIDQUEUE_Send_t send;				//!< funzione di trasmissione
+	void* ctx;							//!< contesto passato a send
+	void (*lock)(void);					//!< inizio della sezione critica rispetto all'interruzione USB
+	void (*unlock)(void);				//!< fine della sezione critica
+	uint32_t sent;						//!< report trasmessi
+	uint32_t merged;					//!< report fusi con un report gia' accodato, senza perdita di informazione
+	uint32_t overflows;					//!< report sostituiti per coda piena, con la perdita di un fronte
+} HIDQUEUE_t;
+
+/**
+ * @brief Inizializza la coda.
+ * @param[out] q puntatore alla coda
+ * @param[in] mode politica di accodamento
+ * @param[in] len lunghezza dei report, al piu' HIDQUEUE_REPORT_SIZE
+ * @param[in] send funzione di trasmissione
+ * @param[in] ctx contesto passato a send
+ * @param[in] lock funzione che disabilita l'interruzione USB
+ * @param[in] unlock funzione che riabilita l'interruzione USB
+ */
+void HIDQUEUE_Init(HIDQUEUE_t* q, HIDQUEUE_Mode_t mode, uint8_t len, HIDQUEUE_Send_t send, void* ctx,
+		void (*lock)(void), void (*unlock)(void));
+
+/**
+ * @brief Accoda un report e, se l'endpoint e' libero, ne avvia la trasmissione. Da chiamare dal main loop.
+ * @param[inout] q puntatore alla coda
+ * @param[in] report report da accodare, di lunghezza pari a quella indicata in HIDQUEUE_Init()
+ */
+void HIDQUEUE_Push(HIDQUEUE_t* q, const uint8_t* report);
+
+/**
+ * @brief Notifica il completamento della trasmissione e avvia quella del report successivo.
+ * @details Da chiamare in USBD_HID_ReportSentCallback(), in contesto di interruzione.
+ * @param[inout] q puntatore alla coda
+ */
+void HIDQUEUE_Sent(HIDQUEUE_t* q);
+
+/**
+ * @brief Avvia la trasmissione del primo report accodato, se l'endpoint e' libero.
+ * @details Utile per riprendere la trasmissione se un avvio precedente e' fallito, ad esempio perche' il dispositivo non
+ * era ancora configurato dall'host.
+ * @param[inout] q puntatore alla coda
+ */
+void HIDQUEUE_Kick(HIDQUEUE_t* q);
+
+/**
+ * @brief Svuota la coda e libera l'endpoint, dopo un reset del bus o la deconfigurazione del dispositivo.
+ * @details Da chiamare in contesto di interruzione, ad esempio dal callback di deinizializzazione della classe HID.
+ * Per la tastiera, l'ultimo stato trasmesso diventa quello con tutti i tasti rilasciati, che e' lo stato assunto
+ * dall'host dopo l'enumerazione.
+ * @param[inout] q puntatore alla coda
+ */
+void HIDQUEUE_Reset(HIDQUEUE_t* q);
+
+/**
+ * @brief Numero di report in attesa di trasmissione.
+ * @param[in] q puntatore alla coda
+ */
+uint8_t HIDQUEUE_Count(const HIDQUEUE_t* q);
+
+/**
+ * @}
+ * @}
+ * @}
+ */
+
+#endif /* HIDQUEUE_H_ */
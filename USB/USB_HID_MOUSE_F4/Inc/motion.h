@@ -0,0 +1,133 @@
+/**
+ * @file motion.h
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef MOTION_H_
+#define MOTION_H_
+
+/**
+ * @addtogroup USBD
+ * @{
+ * @addtogroup HID
+ * @{
+ * @addtogroup Mouse
+ * @{
+ * @defgroup MOTION
+ * @{
+ *
+ * @brief Elaborazione in virgola fissa dei campioni dell'accelerometro per il movimento del cursore.
+ *
+ * @details
+ * Ogni campione attraversa le seguenti fasi, tutte in aritmetica intera:
+ *  - calibrazione: la media dei primi campioni acquisiti a riposo viene memorizzata come offset di zero e sottratta ai
+ *    campioni successivi (MOTION_StartCalibration());
+ *  - filtro passa-basso del primo ordine, y += (x - y) / 2^alphaShift, con stato in Q8. E' la forma a regime del filtro
+ *    di Kalman per un segnale modellato come random walk, con guadagno fissato dalla scelta di alphaShift;
+ *  - zona morta: le inclinazioni inferiori a deadZone non muovono il cursore;
+ *  - curva di accelerazione: una spezzata, fornita dall'applicazione, che associa all'inclinazione (oltre la zona
+ *    morta) la velocita' del cursore in pixel per report, in Q16. Le inclinazioni piccole producono velocita'
+ *    inferiori al pixel per report, che non andrebbero perse grazie alla fase successiva;
+ *  - accumulo sub-pixel: la velocita' viene sommata ad un residuo in Q16, di cui ogni report trasporta la parte intera;
+ *  - saturazione: la parte intera e' limitata al range del report (+-127); l'eccedenza resta nel residuo ed e'
+ *    trasmessa nei report successivi. Il residuo e' a sua volta limitato a MOTION_REST_MAX, in modo che il cursore
+ *    non continui a muoversi a lungo dopo che la board e' tornata orizzontale.
+ *
+ * Il modulo non dipende dalla libreria HAL.
+ */
+
+#include <inttypes.h>
+
+#define MOTION_Q16				65536L				//!< 1.0 in Q16
+#define MOTION_REPORT_MAX		127					//!< Spostamento massimo trasportato da un report
+#define MOTION_REST_MAX			(4L * MOTION_REPORT_MAX * MOTION_Q16)	//!< Residuo massimo, in Q16
+
+/**
+ * @brief Converte una velocita' espressa in pixel per report nel formato Q16.
+ */
+#define MOTION_SPEED(px)		((int32_t)((px) * MOTION_Q16))
+
+/**
+ * @brief Punto della curva di accelerazione.
+ */
+typedef struct {
+	int32_t tilt;		//!< inclinazione oltre la zona morta, nelle unita' dell'accelerometro (mg)
+	int32_t speed;		//!< velocita' del cursore, in pixel per report (Q16)
+} MOTION_CurvePoint_t;
+
+/**
+ * @brief Stato dell'elaborazione per un asse.
+ */
+typedef struct {
+	int32_t zero;		//!< offset di zero
+	int32_t filt;		//!< stato del filtro passa-basso (Q8)
+	int32_t rest;		//!< residuo sub-pixel (Q16)
+	int32_t calSum;		//!< somma dei campioni di calibrazione
+} MOTION_Axis_t;
+
+/**
+ * @brief Struttura che rappresenta la pipeline di elaborazione.
+ */
+typedef struct {
+	MOTION_Axis_t x;					//!< stato dell'asse x
+	MOTION_Axis_t y;					//!< stato dell'asse y
+	const MOTION_CurvePoint_t* curve;	//!< curva di accelerazione, con tilt crescente e primo punto {0, ...}
+	uint8_t nCurve;						//!< numero di punti della curva
+	uint8_t alphaShift;					//!< costante di tempo del filtro, in potenze di 2 campioni
+	int32_t deadZone;					//!< ampiezza della zona morta
+	uint16_t calCount;					//!< campioni di calibrazione acquisiti
+	uint16_t calTarget;					//!< campioni di calibrazione richiesti, 0 se la calibrazione non e' in corso
+} MOTION_t;
+
+/**
+ * @brief Inizializza la pipeline, con offset di zero nullo.
+ * @param[out] m puntatore alla pipeline
+ * @param[in] curve curva di accelerazione (almeno due punti)
+ * @param[in] nCurve numero di punti della curva
+ * @param[in] alphaShift costante di tempo del filtro: 0 disabilita il filtro
+ * @param[in] deadZone ampiezza della zona morta
+ */
+void MOTION_Init(MOTION_t* m, const MOTION_CurvePoint_t* curve, uint8_t nCurve, uint8_t alphaShift, int32_t deadZone);
+
+/**
+ * @brief Avvia la calibrazione dell'offset di zero, che va eseguita con la board a riposo.
+ * @details Durante la calibrazione MOTION_Process() restituisce spostamenti nulli.
+ * @param[inout] m puntatore alla pipeline
+ * @param[in] nSamples numero di campioni da mediare
+ */
+void MOTION_StartCalibration(MOTION_t* m, uint16_t nSamples);
+
+/**
+ * @brief Elabora un campione.
+ * @param[inout] m puntatore alla pipeline
+ * @param[in] ax componente dell'accelerazione lungo x
+ * @param[in] ay componente dell'accelerazione lungo y
+ * @param[out] dx spostamento lungo x da trasmettere nel report
+ * @param[out] dy spostamento lungo y da trasmettere nel report
+ * @retval 1 se la pipeline e' calibrata
+ * @retval 0 se la calibrazione e' in corso
+ */
+uint8_t MOTION_Process(MOTION_t* m, int16_t ax, int16_t ay, int8_t* dx, int8_t* dy);
+
+/**
+ * @}
+ * @}
+ * @}
+ * @}
+ */
+
+#endif /* MOTION_H_ */
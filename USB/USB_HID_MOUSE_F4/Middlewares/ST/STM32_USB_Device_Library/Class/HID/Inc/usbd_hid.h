@@ -60,8 +60,8 @@
 #define HID_REPORT_DESC               0x22
 
 #define HID_HS_BINTERVAL               0x07
-#define HID_FS_BINTERVAL               0x0A
-#define HID_POLLING_INTERVAL           0x0A
+#define HID_FS_BINTERVAL               0x01
+#define HID_POLLING_INTERVAL           0x01
 
 #define HID_REQ_SET_PROTOCOL          0x0B
 #define HID_REQ_GET_PROTOCOL          0x03
@@ -128,6 +128,11 @@ uint8_t USBD_HID_SendReport (USBD_HandleTypeDef *pdev,
 
 uint32_t USBD_HID_GetPollingInterval (USBD_HandleTypeDef *pdev);
 
+void USBD_HID_ReportSentCallback (USBD_HandleTypeDef *pdev);
+void USBD_HID_DeInitCallback (USBD_HandleTypeDef *pdev);
+
+void USBD_HID_SOFCallback (USBD_HandleTypeDef *pdev);
+
 /**
   * @}
   */ 
@@ -108,6 +108,8 @@ static uint8_t  *USBD_HID_GetCfgDesc (uint16_t *length);
 static uint8_t  *USBD_HID_GetDeviceQualifierDesc (uint16_t *length);
 
 static uint8_t  USBD_HID_DataIn (USBD_HandleTypeDef *pdev, uint8_t epnum);
+
+static uint8_t  USBD_HID_SOF (USBD_HandleTypeDef *pdev);
 /**
   * @}
   */ 
@@ -125,7 +127,7 @@ USBD_ClassTypeDef  USBD_HID =
   NULL, /*EP0_RxReady*/
   USBD_HID_DataIn, /*DataIn*/
   NULL, /*DataOut*/
-  NULL, /*SOF */
+  USBD_HID_SOF, /*SOF */
   NULL,
   NULL,      
   USBD_HID_GetCfgDesc,
@@ -146,7 +148,7 @@ __ALIGN_BEGIN static uint8_t USBD_HID_CfgDesc[USB_HID_CONFIG_DESC_SIZ]  __ALIGN_
   0x01,         /*bConfigurationValue: Configuration value*/
   0x00,         /*iConfiguration: Index of string descriptor describing
   the configuration*/
-  0xE0,         /*bmAttributes: bus powered and Support Remote Wake-up */
+  0xE0,         /*bmAttributes: self powered and Support Remote Wake-up */
   0x32,         /*MaxPower 100 mA: this current is used for detecting Vbus*/
   
   /************** Descriptor of Joystick Mouse interface ****************/
@@ -180,7 +182,7 @@ __ALIGN_BEGIN static uint8_t USBD_HID_CfgDesc[USB_HID_CONFIG_DESC_SIZ]  __ALIGN_
   0x03,          /*bmAttributes: Interrupt endpoint*/
   HID_EPIN_SIZE, /*wMaxPacketSize: 4 Byte max */
   0x00,
-  HID_FS_BINTERVAL,          /*bInterval: Polling Interval (10 ms)*/
+  HID_FS_BINTERVAL,          /*bInterval: Polling Interval (1 ms)*/
   /* 34 */
 } ;
 
@@ -317,6 +319,9 @@ static uint8_t  USBD_HID_DeInit (USBD_HandleTypeDef *pdev,
   USBD_LL_CloseEP(pdev,
                   HID_EPIN_ADDR);
   
+  /* A report in flight will never complete: let the application release it */
+  USBD_HID_DeInitCallback(pdev);
+  
   /* FRee allocated memory */
   if(pdev->pClassData != NULL)
   {
@@ -414,7 +419,9 @@ static uint8_t  USBD_HID_Setup (USBD_HandleTypeDef *pdev,
   *         Send HID Report
   * @param  pdev: device instance
   * @param  buff: pointer to report
-  * @retval status
+  * @retval status: USBD_OK if the transfer has been started, USBD_BUSY if the
+  *         previous report is still in progress, USBD_FAIL if the device is
+  *         not configured. The report is not sent unless USBD_OK is returned.
   */
 uint8_t USBD_HID_SendReport     (USBD_HandleTypeDef  *pdev, 
                                  uint8_t *report,
@@ -422,17 +429,19 @@ uint8_t USBD_HID_SendReport     (USBD_HandleTypeDef  *pdev,
 {
   USBD_HID_HandleTypeDef     *hhid = (USBD_HID_HandleTypeDef*)pdev->pClassData;
   
-  if (pdev->dev_state == USBD_STATE_CONFIGURED )
+  if (pdev->dev_state != USBD_STATE_CONFIGURED )
   {
-    if(hhid->state == HID_IDLE)
-    {
-      hhid->state = HID_BUSY;
-      USBD_LL_Transmit (pdev, 
-                        HID_EPIN_ADDR,                                      
-                        report,
-                        len);
-    }
+    return USBD_FAIL;
+  }
+  if(hhid->state != HID_IDLE)
+  {
+    return USBD_BUSY;
   }
+  hhid->state = HID_BUSY;
+  USBD_LL_Transmit (pdev, 
+                    HID_EPIN_ADDR,                                      
+                    report,
+                    len);
   return USBD_OK;
 }
 
@@ -492,9 +501,65 @@ static uint8_t  USBD_HID_DataIn (USBD_HandleTypeDef *pdev,
   /* Ensure that the FIFO is empty before a new transfer, this condition could 
   be caused by  a new transfer before the end of the previous transfer */
   ((USBD_HID_HandleTypeDef *)pdev->pClassData)->state = HID_IDLE;
+
+  /* The endpoint is free again: the application can queue the next report
+  right away, so that it is ready for the next poll of the host */
+  USBD_HID_ReportSentCallback(pdev);
   return USBD_OK;
 }
 
+/**
+  * @brief  USBD_HID_SOF
+  *         handle Start Of Frame event
+  * @param  pdev: device instance
+  * @retval status
+  */
+static uint8_t  USBD_HID_SOF (USBD_HandleTypeDef *pdev)
+{
+  USBD_HID_SOFCallback(pdev);
+  return USBD_OK;
+}
+
+/**
+  * @brief  USBD_HID_ReportSentCallback
+  *         Report transmitted to the host, the IN endpoint is idle.
+  *         Called in interrupt context.
+  * @param  pdev: device instance
+  * @retval None
+  */
+__weak void USBD_HID_ReportSentCallback (USBD_HandleTypeDef *pdev)
+{
+  /* NOTE : This function should not be modified, when the callback is needed,
+  the USBD_HID_ReportSentCallback could be implemented in the user file */
+}
+
+/**
+  * @brief  USBD_HID_DeInitCallback
+  *         HID class deinitialized (bus reset, disconnection or configuration
+  *         cleared): the IN endpoint is closed and a pending report is lost.
+  *         Called in interrupt context.
+  * @param  pdev: device instance
+  * @retval None
+  */
+__weak void USBD_HID_DeInitCallback (USBD_HandleTypeDef *pdev)
+{
+  /* NOTE : This function should not be modified, when the callback is needed,
+  the USBD_HID_DeInitCallback could be implemented in the user file */
+}
+
+/**
+  * @brief  USBD_HID_SOFCallback
+  *         Start Of Frame received (every 1 ms at full speed).
+  *         Called in interrupt context.
+  * @param  pdev: device instance
+  * @retval None
+  */
+__weak void USBD_HID_SOFCallback (USBD_HandleTypeDef *pdev)
+{
+  /* NOTE : This function should not be modified, when the callback is needed,
+  the USBD_HID_SOFCallback could be implemented in the user file */
+}
+
 
 /**
 * @brief  DeviceQualifierDescriptor 
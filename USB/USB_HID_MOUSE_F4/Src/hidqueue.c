@@ -0,0 +1,231 @@
+/**
+ * @file hidqueue.c
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "hidqueue.h"
+#include <assert.h>
+#include <string.h>
+
+#define HIDQUEUE_MASK	(HIDQUEUE_LENGTH - 1)
+
+/**
+ * @brief Somma due spostamenti, restituendo la parte rappresentabile in un report e lasciando il resto in *rest.
+ */
+static int8_t HIDQUEUE_AddSat(int8_t a, int8_t b, int16_t* rest) {
+	int16_t sum = (int16_t) a + b;
+	int16_t out = sum > 127 ? 127 : (sum < -127 ? -127 : sum);
+	*rest = sum - out;
+	return (int8_t) out;
+}
+
+/**
+ * @brief Somma a uno spostamento la parte conservata in *carry, lasciandovi cio' che eccede il range di un int8_t.
+ */
+static int8_t HIDQUEUE_AddCarry(int8_t a, int16_t* carry) {
+	int32_t sum = (int32_t) a + *carry;
+	int32_t out = sum > 127 ? 127 : (sum < -127 ? -127 : sum);
+	*carry = (int16_t) (sum - out);
+	return (int8_t) out;
+}
+
+/**
+ * @brief Accumula uno spostamento da sommare al report successivo, saturando al range di un int16_t.
+ */
+static void HIDQUEUE_Carry(int16_t* carry, int16_t value) {
+	int32_t sum = (int32_t) *carry + value;
+	*carry = (int16_t) (sum > INT16_MAX ? INT16_MAX : (sum < -INT16_MAX ? -INT16_MAX : sum));
+}
+
+/**
+ * @brief Avvia la trasmissione del report in testa. Da chiamare in sezione critica.
+ */
+static void HIDQUEUE_Start(HIDQUEUE_t* q) {
+	if (q->busy)
+		return;
+	if (q->head == q->tail) {
+		/* coda vuota: gli spostamenti conservati sono trasmessi con i pulsanti dell'ultimo report */
+		if (q->mode != HIDQUEUE_MOUSE || (q->carry[0] == 0 && q->carry[1] == 0 && q->carry[2] == 0))
+			return;
+		uint8_t* slot = q->slot[q->tail & HIDQUEUE_MASK];
+		memcpy(slot, q->tx, q->len);
+		for (uint8_t i = HIDQUEUE_MOUSE_X; i <= HIDQUEUE_MOUSE_WHEEL; i++)
+			slot[i] = (uint8_t) HIDQUEUE_AddCarry(0, &q->carry[i - HIDQUEUE_MOUSE_X]);
+		q->tail++;
+	}
+	memcpy(q->tx, q->slot[q->head & HIDQUEUE_MASK], q->len);
+	q->busy = 1;
+	if (q->send(q->ctx, q->tx, q->len) != 0) {
+		q->busy = 0;
+		return;
+	}
+	q->head++;
+	q->sent++;
+}
+
+/**
+ * @brief Fonde un report del mouse con l'ultimo accodato, se hanno gli stessi pulsanti.
+ * @details La parte degli spostamenti che eccede il range di un int8_t e' conservata e sommata ai report successivi:
+ * 			gli slot restano disponibili per i cambiamenti dei pulsanti.
+ * @retval 1 se il report e' stato fuso
+ * @retval 0 se il report deve occupare un nuovo slot
+ */
+static int HIDQUEUE_Merge(HIDQUEUE_t* q, const uint8_t* report) {
+	if (q->head == q->tail)
+		return 0;
+	uint8_t* last = q->slot[(q->tail - 1) & HIDQUEUE_MASK];
+	if (last[HIDQUEUE_MOUSE_BUTTONS] != report[HIDQUEUE_MOUSE_BUTTONS])
+		return 0;
+	for (uint8_t i = HIDQUEUE_MOUSE_X; i <= HIDQUEUE_MOUSE_WHEEL; i++) {
+		int16_t rest;
+		last[i] = HIDQUEUE_AddSat(last[i], report[i], &rest);
+		HIDQUEUE_Carry(&q->carry[i - HIDQUEUE_MOUSE_X], rest);
+	}
+	q->merged++;
+	return 1;
+}
+
+/**
+ * @brief Fonde un report accodato con il precedente, se cio' non comporta la perdita di un fronte.
+ * @param[inout] prev report che precede quello da eliminare; per il mouse riceve gli spostamenti di cur, la parte
+ * 			eccedente e' conservata per i report successivi
+ * @param[in] cur report da eliminare
+ * @param[in] next report che segue quello da eliminare
+ * @retval 1 se cur e' stato fuso con prev e puo' essere eliminato
+ */
+static int HIDQUEUE_Absorb(HIDQUEUE_t* q, uint8_t* prev, const uint8_t* cur, const uint8_t* next) {
+	/* un tasto o un pulsante che cambia stato entrando e uscendo da cur produrrebbe due fronti che andrebbero persi */
+	if (q->mode == HIDQUEUE_KEYBOARD) {
+		for (uint8_t i = 0; i < q->len; i++)
+			if ((prev[i] ^ cur[i]) & (cur[i] ^ next[i]))
+				return 0;
+		return 1;
+	}
+	const uint8_t b = HIDQUEUE_MOUSE_BUTTONS;
+	if ((prev[b] ^ cur[b]) & (cur[b] ^ next[b]))
+		return 0;
+	for (uint8_t i = HIDQUEUE_MOUSE_X; i <= HIDQUEUE_MOUSE_WHEEL; i++) {
+		int16_t rest;
+		prev[i] = HIDQUEUE_AddSat(prev[i], cur[i], &rest);
+		HIDQUEUE_Carry(&q->carry[i - HIDQUEUE_MOUSE_X], rest);
+	}
+	return 1;
+}
+
+/**
+ * @brief Libera uno slot eliminando il report accodato meno recente che non rappresenta un fronte.
+ * @param[in] next report che sara' accodato dopo l'ultimo
+ * @retval 1 se uno slot e' stato liberato
+ */
+static int HIDQUEUE_Compact(HIDQUEUE_t* q, const uint8_t* next) {
+	for (uint8_t i = q->head + 1; i != q->tail; i++) {
+		uint8_t* prev = q->slot[(uint8_t) (i - 1) & HIDQUEUE_MASK];
+		const uint8_t* after = (uint8_t) (i + 1) == q->tail ? next : q->slot[(uint8_t) (i + 1) & HIDQUEUE_MASK];
+		if (!HIDQUEUE_Absorb(q, prev, q->slot[i & HIDQUEUE_MASK], after))
+			continue;
+		for (uint8_t j = i; (uint8_t) (j + 1) != q->tail; j++)
+			memcpy(q->slot[j & HIDQUEUE_MASK], q->slot[(uint8_t) (j + 1) & HIDQUEUE_MASK], q->len);
+		q->tail--;
+		q->merged++;
+		return 1;
+	}
+	return 0;
+}
+
+void HIDQUEUE_Init(HIDQUEUE_t* q, HIDQUEUE_Mode_t mode, uint8_t len, HIDQUEUE_Send_t send, void* ctx,
+		void (*lock)(void), void (*unlock)(void)) {
+	assert(q);
+	assert(send && lock && unlock);
+	assert(len > 0 && len <= HIDQUEUE_REPORT_SIZE);
+	assert(mode != HIDQUEUE_MOUSE || len > HIDQUEUE_MOUSE_WHEEL);
+	memset(q, 0, sizeof(HIDQUEUE_t));
+	q->mode = mode;
+	q->len = len;
+	q->send = send;
+	q->ctx = ctx;
+	q->lock = lock;
+	q->unlock = unlock;
+}
+
+void HIDQUEUE_Push(HIDQUEUE_t* q, const uint8_t* report) {
+	assert(q);
+	assert(report);
+	uint8_t r[HIDQUEUE_REPORT_SIZE];
+	memcpy(r, report, q->len);
+
+	q->lock();
+	if (q->mode == HIDQUEUE_MOUSE) {
+		r[HIDQUEUE_MOUSE_X] = HIDQUEUE_AddCarry(r[HIDQUEUE_MOUSE_X], &q->carry[0]);
+		r[HIDQUEUE_MOUSE_Y] = HIDQUEUE_AddCarry(r[HIDQUEUE_MOUSE_Y], &q->carry[1]);
+		r[HIDQUEUE_MOUSE_WHEEL] = HIDQUEUE_AddCarry(r[HIDQUEUE_MOUSE_WHEEL], &q->carry[2]);
+	}
+	if (q->mode == HIDQUEUE_KEYBOARD) {
+		if (memcmp(q->last, r, q->len) == 0) {
+			q->unlock();
+			return;
+		}
+		memcpy(q->last, r, q->len);
+	}
+	else if (HIDQUEUE_Merge(q, r)) {
+		q->unlock();
+		return;
+	}
+
+	if ((uint8_t) (q->tail - q->head) == HIDQUEUE_LENGTH && !HIDQUEUE_Compact(q, r)) {
+		uint8_t* last = q->slot[(uint8_t) (q->tail - 1) & HIDQUEUE_MASK];
+		/* nessun report eliminabile: l'ultimo accodato viene sostituito; per il mouse ne conserva gli spostamenti */
+		q->overflows++;
+		q->tail--;
+		if (q->mode == HIDQUEUE_MOUSE) {
+			int16_t rest;
+			for (uint8_t i = HIDQUEUE_MOUSE_X; i <= HIDQUEUE_MOUSE_WHEEL; i++) {
+				r[i] = HIDQUEUE_AddSat(last[i], r[i], &rest);
+				HIDQUEUE_Carry(&q->carry[i - HIDQUEUE_MOUSE_X], rest);
+			}
+		}
+	}
+	memcpy(q->slot[q->tail & HIDQUEUE_MASK], r, q->len);
+	q->tail++;
+	HIDQUEUE_Start(q);
+	q->unlock();
+}
+
+void HIDQUEUE_Sent(HIDQUEUE_t* q) {
+	assert(q);
+	q->busy = 0;
+	HIDQUEUE_Start(q);
+}
+
+void HIDQUEUE_Kick(HIDQUEUE_t* q) {
+	assert(q);
+	q->lock();
+	HIDQUEUE_Start(q);
+	q->unlock();
+}
+
+void HIDQUEUE_Reset(HIDQUEUE_t* q) {
+	assert(q);
+	q->head = q->tail;
+	q->busy = 0;
+	memset(q->last, 0, sizeof(q->last));
+	memset(q->carry, 0, sizeof(q->carry));
+}
+
+uint8_t HIDQUEUE_Count(const HIDQUEUE_t* q) {
+	assert(q);
+	return (uint8_t) (q->tail - q->head);
+}
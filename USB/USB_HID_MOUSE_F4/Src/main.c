@@ -24,6 +24,9 @@
 #include "stm32f4_discovery.h"
 #include "stm32f4_discovery_accelerometer.h"
 #include "usbd_hid.h"
+#include "hidqueue.h"
+#include "motion.h"
+#include "power.h"
 
 /**
  * @defgroup USBD
@@ -37,9 +40,21 @@
  *
  * @details Progetto di una periferica usb hid che definisce un device di tipo mouse.<br>
  * 			 Per gli spostamenti del cursore viene utilizzato l'accellerometro a bordo, che riporta le accellerazioni angolari lungo i tre assi X, Y, Z.
- * 			 I valori di accellerazione angolare letti vengono processati tenendo conto di opportuni valori di #soglia e sensitivita' (#s) che sono personalizzabili
- * 			 a seconda delle esigenze di progetto o semplicemente a seconda della sensibilita' percepita e voluta dall'utente. <br>
+ * 			 I valori di accellerazione angolare letti vengono processati (vedi MOTION) tenendo conto di un valore di #soglia e di una curva di
+ * 			 accelerazione (#mouseCurve) che sono personalizzabili a seconda delle esigenze di progetto o semplicemente a seconda della
+ * 			 sensibilita' percepita e voluta dall'utente. All'avvio la board deve restare ferma per #MOUSE_CAL_SAMPLES millisecondi, durante
+ * 			 i quali viene calibrato l'offset di zero dell'accelerometro. <br>
  * 			 La pressione del tasto blu della board (User Button) viene acquisita come pressione del tasto sinistro del mouse. <br>
+ * 			 Il dispositivo lavora in modalita' a bassa latenza: l'endpoint di interrupt e' interrogato dall'host ogni millisecondo
+ * 			 (bInterval = 1) e ogni SOF avvia il campionamento dell'accelerometro (configurato a 1600 Hz), per cui ciascun
+ * 			 report trasporta un campione acquisito nello stesso frame. Il report successivo e' accodato al completamento del
+ * 			 precedente, in USBD_HID_ReportSentCallback(), senza alcuna attesa nel main loop: i report prodotti mentre
+ * 			 l'endpoint e' occupato sono fusi dalla coda di trasmissione (vedi HIDQUEUE), per cui nessuno spostamento va perso. <br>
+ * 			 Quando l'host sospende il bus (vedi POWER) i led vengono spenti e il processore resta in stop mode. Il LIS3DSH
+ * 			 campiona a 12.5 Hz tramite la FIFO, con una interruzione per campione su INT1 (EXTI0): un movimento oltre
+ * 			 #ACC_MOTION_THRESHOLD o il tasto User premuto al momento del campione producono il remote wakeup, se abilitato
+ * 			 dall'host. Con il LIS302DL l'accelerometro viene spento e il remote wakeup e' prodotto dal solo tasto User, in
+ * 			 interruzione. Alla ripresa del bus l'accelerometro torna a 1600 Hz senza FIFO. <br>
  */
 
 /* Private variables ---------------------------------------------------------*/
@@ -62,14 +77,6 @@ typedef struct {
     int8_t wheel;		//!< Riporta lo scroll del mouse
 }mouseHID_t;
 
-/**
- * @brief Valore di sensitivita' con cui il valore della componente di accellerazione è scalato.
- *
- * @details Tale valore determina la sensibilità percepita dall'utente del device.<br>
-			E' anche necessario per scalare correttamente su 8 bit il valore della componente accellerazione che invece è espresso su 16 bit.<br>
- */
-#define s 0.1
-
 /**
  * @brief Soglia che permette di regolare lo la sensibilità minima del dispositivo.
  *
@@ -81,6 +88,39 @@ typedef struct {
  */
 #define soglia 64
 
+/**
+ * @brief Numero di campioni (uno per millisecondo) mediati per la calibrazione dell'offset di zero.
+ */
+#define MOUSE_CAL_SAMPLES		256
+
+/**
+ * @brief Costante di tempo del filtro passa-basso, in potenze di 2 campioni (8 ms).
+ */
+#define MOUSE_FILTER_SHIFT		3
+
+/**
+ * @brief Scostamento di un asse, in mg, rispetto al primo campione acquisito in sospensione, che risveglia l'host.
+ */
+#define ACC_MOTION_THRESHOLD	150
+
+/**
+ * @brief Numero massimo di campioni letti dalla FIFO dell'accelerometro con una lettura, in sospensione.
+ */
+#define ACC_SUSPEND_SAMPLES		4
+
+/**
+ * @brief Curva di accelerazione: velocita' del cursore, in pixel per report, in funzione dell'inclinazione oltre la #soglia (mg).
+ *
+ * @details Con un report al millisecondo, 1 pixel per report corrisponde a 1000 pixel al secondo. Le inclinazioni piccole
+ * 			producono spostamenti inferiori al pixel, per un puntamento preciso, quelle grandi crescono piu' che linearmente.
+ */
+static const MOTION_CurvePoint_t mouseCurve[] = {
+	{    0, MOTION_SPEED(0)   },
+	{  250, MOTION_SPEED(0.3) },
+	{  600, MOTION_SPEED(1.3) },
+	{ 1000, MOTION_SPEED(4)   },
+};
+
 /* Private function prototypes -----------------------------------------------*/
 /**
  * @brief System Clock Configuration
@@ -103,24 +143,137 @@ void setup(void);
 /**
  * @brief Funzione che implementa la logica del programma.<br>
  *
- * @details Ogni 50 milli secondi :
+ * @details Se il bus e' sospeso, non vengono prodotti report e vengono elaborati i soli eventi che possono richiedere il
+ * 			 remote wakeup (vedi PWR_Poll()). Altrimenti, ad ogni SOF (ogni millisecondo), segnalato da USBD_HID_SOFCallback():
  * 			 - viene valutata la pressione del tasto blu (button User) e aggiornato il campo buttons dell'oggetto mouseHID;
  * 			 - viene effettuata la lettura delle componenti di accellerazione angolare lungo i 3 assi (sfruttando l'accellerometro a bordo) aggiornati i campi
  * 			 dell'oggetto muoseHID;
- * 			 - vengono aggiornati i campi x e y del'oggetto mouseHID. Questo è fatto tenendo conto del valore di soglia e sensitivita'
- * 			 (s) impostato;
- * 			 - viene invocata la funzione "uint8_t USBD_HID_SendReport(USBD_HandleTypeDef  *pdev, uint8_t *report,uint16_t len)", tramite la quale viene comunicato
- * 			 il report contenente i dati acquisiti;
+ * 			 - vengono aggiornati i campi x e y del'oggetto mouseHID con gli spostamenti calcolati dalla pipeline #motion;
+ * 			 - il report viene consegnato alla coda di trasmissione #hidQueue, che lo trasmette subito se l'endpoint e' libero
+ * 			 o lo fonde con quelli in attesa altrimenti;
  * 			 - prima di uscire vengono resettati tutti i valori della struttura mouseHID.
+ *
+ * 			 In attesa del SOF successivo il processore resta in sleep.
  */
 void loop(void);
 
+/**
+ * @brief Avvia la trasmissione di un report; funzione di trasmissione della coda #hidQueue.
+ * @param[in] ctx handle del device USB
+ * @param[in] report report da trasmettere
+ * @param[in] len lunghezza del report
+ * @return 0 se la trasmissione e' stata avviata
+ */
+static int HID_Send(void* ctx, uint8_t* report, uint8_t len);
+
+/**
+ * @brief Disabilita l'interruzione USB, per l'accesso alla coda #hidQueue dal main loop.
+ */
+static void HID_Lock(void);
+
+/**
+ * @brief Riabilita l'interruzione USB.
+ */
+static void HID_Unlock(void);
+
+/**
+ * @brief Callback di fine trasmissione di un report: trasmette il report successivo, se presente.
+ * @param[in] pdev handle del device USB
+ */
+void USBD_HID_ReportSentCallback(USBD_HandleTypeDef *pdev);
+
+/**
+ * @brief Callback di deinizializzazione della classe HID (reset del bus, deconfigurazione): svuota la coda #hidQueue,
+ * 			il cui report in trasmissione non verra' mai completato.
+ * @param[in] pdev handle del device USB
+ */
+void USBD_HID_DeInitCallback(USBD_HandleTypeDef *pdev);
+
+/**
+ * @brief Callback associata al SOF: richiede al main loop il campionamento dell'accelerometro.
+ * @param[in] pdev handle del device USB
+ */
+void USBD_HID_SOFCallback(USBD_HandleTypeDef *pdev);
+
+/**
+ * @brief Callback delle linee EXTI: in sospensione, campione disponibile nella FIFO dell'accelerometro oppure, senza
+ * 			FIFO, pressione del tasto User.
+ * @param[in] GPIO_Pin pin connesso alla linea EXTI
+ */
+void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin);
+
+/**
+ * @brief Elaborazione degli eventi in sospensione: i campioni della FIFO dell'accelerometro e lo stato del tasto
+ * 			User possono richiedere il remote wakeup.
+ */
+static void PWR_Poll(void);
+
+/**
+ * @brief Ingresso in sospensione: led spenti, accelerometro a bassa frequenza o spento.
+ * @param[in] ctx handle del device USB
+ */
+static void PWR_Suspend(void* ctx);
+
+/**
+ * @brief Uscita dalla sospensione: ripristino del campionamento a 1600 Hz.
+ * @param[in] ctx handle del device USB
+ */
+static void PWR_Resume(void* ctx);
+
+/**
+ * @brief Stop mode fino all'interruzione successiva, se non ci sono eventi da elaborare.
+ * @param[in] ctx handle del device USB
+ */
+static void PWR_Sleep(void* ctx);
+
+/**
+ * @brief Avvia la segnalazione di remote wakeup sul bus.
+ * @param[in] ctx handle del device USB
+ */
+static void PWR_WakeupStart(void* ctx);
+
+/**
+ * @brief Termina la segnalazione di remote wakeup.
+ * @param[in] ctx handle del device USB
+ */
+static void PWR_WakeupStop(void* ctx);
+
+/**
+ * @brief Verifica se l'host ha abilitato il remote wakeup.
+ * @param[in] ctx handle del device USB
+ * @return 1 se il remote wakeup e' abilitato
+ */
+static uint8_t PWR_WakeupEnabled(void* ctx);
+
+/**
+ * @brief Funzioni di intervento sull'hardware di #power.
+ */
+static const POWER_Hooks_t powerHooks = {
+	PWR_Suspend,
+	PWR_Resume,
+	PWR_Sleep,
+	PWR_WakeupStart,
+	PWR_WakeupStop,
+	PWR_WakeupEnabled
+};
+
 mouseHID_t mouseHID;		//!< Oggetto di tipo mouseHID_t
 accellero_t accellero;		//!< Oggetto di tipo accellero_t
 
 int8_t value_x;				//!< Rappresenta lo spostamento lungo l'asse x del mouse
 int8_t value_y;				//!< Rappresenta lo spostamento lungo l'asse y del mouse
 
+MOTION_t motion;			//!< Pipeline di elaborazione dei campioni dell'accelerometro
+uint32_t motionCycles;		//!< Cicli di clock impiegati da MOTION_Process() per l'ultimo campione
+uint32_t motionCyclesMax;	//!< Massimo numero di cicli di clock impiegati da MOTION_Process()
+
+HIDQUEUE_t hidQueue;		//!< Coda di trasmissione dei report
+volatile uint8_t sofPending;	//!< 1 se e' stato ricevuto un SOF non ancora servito
+
+POWER_t power;				//!< Gestione della sospensione del bus
+uint8_t accFifo;			//!< 1 se in sospensione l'accelerometro campiona tramite la FIFO
+volatile uint8_t accPending;	//!< 1 se la FIFO dell'accelerometro ha segnalato un campione non ancora letto
+
 int main(void)
 {
 	setup();
@@ -140,6 +293,10 @@ void setup(void){
   MX_USB_DEVICE_Init();
   BSP_PB_Init(BUTTON_KEY,BUTTON_MODE_GPIO);
   BSP_ACCELERO_Init();
+  /* Un campione nuovo ad ogni frame USB: ODR superiore alla frequenza di polling */
+  accFifo = BSP_ACCELERO_ReadID() == I_AM_LIS3DSH;
+  if(accFifo)
+	  LIS3DSH_DataRateCmd(LIS3DSH_DATARATE_1600);
   for(int i=0;i<LEDn;i++)
 	  BSP_LED_Init(i);
 
@@ -148,9 +305,41 @@ void setup(void){
   mouseHID.x = 0;
   mouseHID.y = 0;
   mouseHID.wheel = 0;
+  MOTION_Init(&motion, mouseCurve, sizeof(mouseCurve) / sizeof(mouseCurve[0]), MOUSE_FILTER_SHIFT, soglia);
+  MOTION_StartCalibration(&motion, MOUSE_CAL_SAMPLES);
+  /* Contatore di cicli del DWT, per la misura del costo della pipeline */
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+  motionCycles = 0;
+  motionCyclesMax = 0;
+  HIDQUEUE_Init(&hidQueue, HIDQUEUE_MOUSE, sizeof(mouseHID_t), HID_Send, &hUsbDeviceFS, HID_Lock, HID_Unlock);
+  sofPending = 0;
+  accPending = 0;
+  POWER_Init(&power, &powerHooks, &hUsbDeviceFS, ACC_MOTION_THRESHOLD);
 }
 
 void loop(void){
+  /* Bus sospeso: nessun report finche' l'host non riprende il bus */
+	if(POWER_Process(&power, hUsbDeviceFS.dev_state == USBD_STATE_SUSPENDED, HAL_GetTick()) != POWER_ACTIVE){
+		PWR_Poll();
+		return;
+	}
+
+  /* Attesa del SOF: il campione viene acquisito all'inizio del frame in cui l'host interroga l'endpoint */
+	__disable_irq();
+	while(!sofPending && hUsbDeviceFS.dev_state != USBD_STATE_SUSPENDED){
+		__WFI();
+		__enable_irq();
+		__disable_irq();
+	}
+	if(!sofPending){
+		__enable_irq();
+		return;
+	}
+	sofPending = 0;
+	__enable_irq();
+
   /* Valuta la pressione del tasto blu (Button User)*/
 	if(BSP_PB_GetState(BUTTON_KEY)!= GPIO_PIN_SET){
 		  mouseHID.buttons=0x00;						// se il tasto blu non viene premuto, mouseHID.buttons = 0x00
@@ -165,33 +354,29 @@ void loop(void){
 
 	BSP_ACCELERO_GetXYZ((int16_t*)&accellero);			// lettura delle componenti di accellerazione angolare lungo i 3 assi
 
-	value_x = (int8_t)(accellero.asseX*s);				// scaling della componente di accellerazione angolare lungo l'asse x
-	value_y = (int8_t)(accellero.asseY*s);				// scaling della componente di accellerazione angolare lungo l'asse y
+/* Filtro, offset di zero, curva di accelerazione e accumulo sub-pixel */
+	uint32_t start = DWT->CYCCNT;
+	MOTION_Process(&motion, accellero.asseX, accellero.asseY, &value_x, &value_y);
+	motionCycles = DWT->CYCCNT - start;
+	if (motionCycles > motionCyclesMax)
+		motionCyclesMax = motionCycles;
 
-/* Valutazione delle soglie e aggiornamento dei campi x e y dell'oggetto mouseHID */
+/* Valutazione delle soglie per la segnalazione sui led e aggiornamento dei campi x e y dell'oggetto mouseHID */
+	mouseHID.x = -value_x; 								// opposto perchè la board è rivolta con il button user verso le dita
+	mouseHID.y = -value_y;
   /* Accellerazione lungo l'asse y */
-	if (accellero.asseX>soglia){
+	if (accellero.asseX>soglia)
 		BSP_LED_Toggle(LED5);
-		mouseHID.x = -value_x; 							// opposto perchè la board è rivolta con il button user verso le dita
-		}
-	else if (accellero.asseX<-soglia){
+	else if (accellero.asseX<-soglia)
 		BSP_LED_Toggle(LED4);
-		mouseHID.x = -value_x; 							// opposto perchè la board è rivolta con il button user verso le dita
-		}
 
 	/* Accellerazione lungo l'asse x */
-	if (accellero.asseY>soglia){
+	if (accellero.asseY>soglia)
 		BSP_LED_Toggle(LED3);
-		mouseHID.y = -value_y;
-	}
-	else if (accellero.asseY<-soglia){
+	else if (accellero.asseY<-soglia)
 		BSP_LED_Toggle(LED6);
-		mouseHID.y = -value_y;
-	}
   /* Send HID Report */
-	USBD_HID_SendReport(&hUsbDeviceFS,(uint8_t*)&mouseHID,sizeof(mouseHID_t));		// viene inviato il report, contenente i dati acquisiti per l'oggetto mouseHID
-
-	HAL_Delay(50);
+	HIDQUEUE_Push(&hidQueue,(uint8_t*)&mouseHID);		// viene accodato il report, contenente i dati acquisiti per l'oggetto mouseHID
 
   /* Reset dei valori della struttura mouseHID*/
 	mouseHID.x = 0;
@@ -199,6 +384,111 @@ void loop(void){
 	mouseHID.wheel = 0;
 }
 
+static int HID_Send(void* ctx, uint8_t* report, uint8_t len){
+	return USBD_HID_SendReport((USBD_HandleTypeDef*)ctx, report, len) == USBD_OK ? 0 : -1;
+}
+
+static void HID_Lock(void){
+	HAL_NVIC_DisableIRQ(OTG_FS_IRQn);
+}
+
+static void HID_Unlock(void){
+	HAL_NVIC_EnableIRQ(OTG_FS_IRQn);
+}
+
+void USBD_HID_ReportSentCallback(USBD_HandleTypeDef *pdev){
+	HIDQUEUE_Sent(&hidQueue);
+}
+
+void USBD_HID_DeInitCallback(USBD_HandleTypeDef *pdev){
+	HIDQUEUE_Reset(&hidQueue);
+}
+
+void USBD_HID_SOFCallback(USBD_HandleTypeDef *pdev){
+	sofPending = 1;
+}
+
+void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin){
+	if (GPIO_Pin != ACCELERO_INT1_PIN)
+		return;
+	if (accFifo)
+		accPending = 1;
+	else
+		POWER_Wake(&power);
+}
+
+static void PWR_Poll(void){
+	int16_t xyz[3 * ACC_SUSPEND_SAMPLES];
+	uint8_t n;
+	if (accPending){
+		/* la FIFO va svuotata, altrimenti INT1 resta alta e non produce altre interruzioni */
+		accPending = 0;
+		while ((n = BSP_ACCELERO_FIFO_Read(xyz, ACC_SUSPEND_SAMPLES)) > 0)
+			for (uint8_t i = 0; i < n; i++)
+				POWER_Motion(&power, xyz[3 * i], xyz[3 * i + 1], xyz[3 * i + 2]);
+	}
+	if (BSP_PB_GetState(BUTTON_KEY) == GPIO_PIN_SET)
+		POWER_Wake(&power);
+}
+
+static void PWR_Suspend(void* ctx){
+	for (int i = 0; i < LEDn; i++)
+		BSP_LED_Off(i);
+	if (accFifo){
+		/* una interruzione per campione: ciascun campione risveglia il processore */
+		LIS3DSH_DataRateCmd(LIS3DSH_DATARATE_12_5);
+		BSP_ACCELERO_FIFO_Start(1);
+	}
+	else {
+		LIS302DL_LowpowerCmd(LIS302DL_LOWPOWERMODE_POWERDOWN);
+		BSP_PB_Init(BUTTON_KEY, BUTTON_MODE_EXTI);
+	}
+}
+
+static void PWR_Resume(void* ctx){
+	if (accFifo){
+		/* FIFO disabilitata: le letture tornano ai registri di uscita */
+		HAL_NVIC_DisableIRQ(ACCELERO_INT1_EXTI_IRQn);
+		LIS3DSH_FIFOConfig(LIS3DSH_FIFO_BYPASS_MODE, 0);
+		LIS3DSH_DataRateCmd(LIS3DSH_DATARATE_1600);
+		accPending = 0;
+	}
+	else {
+		LIS302DL_LowpowerCmd(LIS302DL_LOWPOWERMODE_ACTIVE);
+		BSP_PB_Init(BUTTON_KEY, BUTTON_MODE_GPIO);
+		HAL_NVIC_DisableIRQ(KEY_BUTTON_EXTI_IRQn);
+	}
+}
+
+static void PWR_Sleep(void* ctx){
+	/* il risveglio dallo stop mode avviene con l'HSI: l'interruzione USB viene servita dopo il ripristino dei clock,
+	 * le altre subito, perche' SystemClock_Config() misura i suoi timeout con il SysTick */
+	__disable_irq();
+	if (!POWER_WakePending(&power) && !accPending){
+		HAL_NVIC_DisableIRQ(OTG_FS_IRQn);
+		HAL_PWR_EnterSTOPMode(PWR_LOWPOWERREGULATOR_ON, PWR_STOPENTRY_WFI);
+		__enable_irq();
+		SystemClock_Config();
+		HAL_NVIC_EnableIRQ(OTG_FS_IRQn);
+	}
+	__enable_irq();
+}
+
+static void PWR_WakeupStart(void* ctx){
+	PCD_HandleTypeDef* hpcd = (PCD_HandleTypeDef*)((USBD_HandleTypeDef*)ctx)->pData;
+	/* il clock del PHY e' stato fermato all'ingresso in sospensione */
+	__HAL_PCD_UNGATE_PHYCLOCK(hpcd);
+	HAL_PCD_ActivateRemoteWakeup(hpcd);
+}
+
+static void PWR_WakeupStop(void* ctx){
+	HAL_PCD_DeActivateRemoteWakeup((PCD_HandleTypeDef*)((USBD_HandleTypeDef*)ctx)->pData);
+}
+
+static uint8_t PWR_WakeupEnabled(void* ctx){
+	return ((USBD_HandleTypeDef*)ctx)->dev_remote_wakeup != 0;
+}
+
 
 void SystemClock_Config(void)
 {
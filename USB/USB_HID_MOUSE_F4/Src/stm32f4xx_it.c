@@ -34,6 +34,7 @@
 #include "stm32f4xx_hal.h"
 #include "stm32f4xx.h"
 #include "stm32f4xx_it.h"
+#include "stm32f4_discovery.h"
 
 /* USER CODE BEGIN 0 */
 
@@ -94,6 +95,14 @@ void SysTick_Handler(void)
 /* please refer to the startup file (startup_stm32f4xx.s).                    */
 /******************************************************************************/
 
+/**
+* @brief This function handles EXTI line0 interrupt (accelerometer INT1).
+*/
+void EXTI0_IRQHandler(void)
+{
+  HAL_GPIO_EXTI_IRQHandler(ACCELERO_INT1_PIN);
+}
+
 /**
 * @brief This function handles USB On The Go FS global interrupt.
 */
@@ -108,6 +117,15 @@ void OTG_FS_IRQHandler(void)
   /* USER CODE END OTG_FS_IRQn 1 */
 }
 
+/**
+* @brief This function handles USB On The Go FS Wakeup through EXTI line interrupt.
+*/
+void OTG_FS_WKUP_IRQHandler(void)
+{
+  /* the resume itself is handled by OTG_FS_IRQHandler, once the clocks are restored */
+  __HAL_USB_OTG_FS_WAKEUP_EXTI_CLEAR_FLAG();
+}
+
 /* USER CODE BEGIN 1 */
 
 /* USER CODE END 1 */
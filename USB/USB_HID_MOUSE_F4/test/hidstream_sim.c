@@ -0,0 +1,242 @@
+/**
+ * @file hidstream_sim.c
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+/**
+ * @brief Simulazione su host del flusso di report HID del mouse: latenza movimento-report e frequenza dei report.
+ *
+ * @details
+ * Il bus USB e' simulato a passi di 1 us. L'host invia un SOF ogni millisecondo e interroga l'endpoint di interrupt
+ * ogni bInterval frame, in un istante casuale all'interno del frame (la posizione del token IN dipende dallo scheduling
+ * del controller host): se l'endpoint contiene un report lo preleva, e il completamento viene notificato al dispositivo
+ * come in USBD_HID_DataIn(). Il movimento della board cambia in istanti casuali (processo di Poisson); l'accelerometro
+ * campiona con periodo 1/ODR e ogni campione porta con se' l'ultimo cambiamento che ha osservato. Sono confrontate:
+ *  - la versione originale: bInterval = 10, accelerometro a 100 Hz, lettura e USBD_HID_SendReport() seguiti da
+ *    HAL_Delay(50); un report trovato con l'endpoint occupato e' perso;
+ *  - la versione a bassa latenza: bInterval = 1, accelerometro a 1600 Hz, lettura allineata al SOF e report consegnato
+ *    a HIDQUEUE, trasmesso dal callback di completamento.
+ *
+ * La latenza e' misurata da ciascun cambiamento del movimento alla ricezione, da parte dell'host, del primo report che
+ * contiene un campione successivo; non comprende il ritardo del filtro di MOTION, che non dipende dal trasporto. Sono
+ * riportati la frequenza dei report ricevuti, la frazione di report che portano un campione nuovo, media, 99-esimo
+ * percentile e massimo della latenza, e lo spostamento perso (somma degli spostamenti prodotti meno quella ricevuta).
+ * @code
+ * gcc -std=gnu99 -O2 -Wall -Wextra -IInc test/hidstream_sim.c Src/hidqueue.c -o hidstream_sim && ./hidstream_sim
+ * @endcode
+ */
+#include "hidqueue.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SIM_SECONDS			10			//!< durata simulata per ogni configurazione
+#define SIM_EVENT_MEAN_US	20000		//!< intervallo medio tra due cambiamenti del movimento
+#define SIM_READ_US			60			//!< lettura SPI dell'accelerometro ed elaborazione del campione
+#define SIM_MAX_EVENTS		4096		//!< cambiamenti memorizzati per il calcolo della latenza
+
+static int failures = 0;
+
+#define CHECK(cond) do { if (!(cond)) { printf("%s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+/**
+ * @brief Generatore pseudo-casuale xorshift, per rendere la simulazione riproducibile.
+ */
+static uint32_t rng;
+static uint32_t Random(void) {
+	rng ^= rng << 13;
+	rng ^= rng >> 17;
+	rng ^= rng << 5;
+	return rng;
+}
+
+/**
+ * @brief Configurazione del dispositivo simulato.
+ */
+typedef struct {
+	const char* name;
+	uint32_t bInterval;		//!< intervallo di polling, in frame
+	uint32_t odrHz;			//!< frequenza di campionamento dell'accelerometro
+	uint32_t loopUs;		//!< attesa nel main loop dopo ogni report (0: lettura allineata al SOF)
+	int queued;				//!< 1 se i report passano per HIDQUEUE
+} Config_t;
+
+/**
+ * @brief Endpoint IN di interrupt: report caricato dal dispositivo e non ancora prelevato dall'host.
+ */
+static struct {
+	int loaded;
+	uint8_t report[4];
+	uint32_t seq;			//!< ultimo cambiamento del movimento contenuto nel report
+	uint32_t sample;		//!< indice del campione piu' recente contenuto nel report
+} ep;
+
+static uint32_t pushSeq;		//!< cambiamento del movimento contenuto nell'ultimo report prodotto
+static uint32_t pushSample;		//!< indice del campione contenuto nell'ultimo report prodotto
+
+static int EP_Send(void* ctx, uint8_t* report, uint8_t len) {
+	(void) ctx;
+	if (ep.loaded)
+		return -1;
+	memcpy(ep.report, report, len);
+	/* lo spostamento resta entro il range di un int8_t e i pulsanti non cambiano: la coda contiene al piu' un report,
+	 * che comprende tutti quelli prodotti fino ad ora */
+	ep.seq = pushSeq;
+	ep.sample = pushSample;
+	ep.loaded = 1;
+	return 0;
+}
+
+static void Lock(void) {
+}
+
+static void Unlock(void) {
+}
+
+static int CompareU32(const void* a, const void* b) {
+	uint32_t x = *(const uint32_t*) a, y = *(const uint32_t*) b;
+	return (x > y) - (x < y);
+}
+
+/**
+ * @brief Risultati di una configurazione.
+ */
+typedef struct {
+	double rate;			//!< report ricevuti al secondo
+	double fresh;			//!< frazione di report con un campione nuovo
+	double latMean;			//!< latenza media, in us
+	uint32_t latP99;		//!< 99-esimo percentile della latenza, in us
+	uint32_t latMax;		//!< latenza massima, in us
+	long lost;				//!< spostamento perso
+	uint32_t merged;		//!< report fusi dalla coda
+} Result_t;
+
+static Result_t Simulate(const Config_t* c) {
+	static uint32_t eventTime[SIM_MAX_EVENTS], latency[SIM_MAX_EVENTS];
+	HIDQUEUE_t q;
+	Result_t r;
+	memset(&r, 0, sizeof(r));
+	memset(&ep, 0, sizeof(ep));
+	HIDQUEUE_Init(&q, HIDQUEUE_MOUSE, 4, EP_Send, NULL, Lock, Unlock);
+	rng = 12345;
+
+	const uint32_t end = SIM_SECONDS * 1000000;
+	const uint32_t odrUs = 1000000 / c->odrHz;
+	uint32_t nEvents = 0, delivered = 0, nextEvent = Random() % SIM_EVENT_MEAN_US;
+	uint32_t seq = 0, sampleSeq = 0, sample = 0, lastSample = (uint32_t) -1;
+	uint32_t pollAt = Random() % 1000, readAt = 0, received = 0, fresh = 0;
+	long produced = 0, consumed = 0;
+
+	for (uint32_t t = 0; t < end; t++) {
+		/* movimento della board */
+		if (t == nextEvent) {
+			if (nEvents < SIM_MAX_EVENTS)
+				eventTime[nEvents++] = t;
+			seq = nEvents;
+			nextEvent = t + 1 + Random() % (2 * SIM_EVENT_MEAN_US);
+		}
+		/* campionamento dell'accelerometro */
+		if (t % odrUs == 0) {
+			sample = t / odrUs;
+			sampleSeq = seq;
+		}
+		/* SOF: nella versione a bassa latenza avvia la lettura del campione; l'host sceglie l'istante del token IN */
+		if (t % 1000 == 0) {
+			if (c->loopUs == 0)
+				readAt = t + SIM_READ_US;
+			if ((t / 1000) % c->bInterval == 0)
+				pollAt = t + Random() % 1000;
+		}
+		/* main loop: report con il campione piu' recente */
+		if (t == readAt) {
+			uint8_t report[4] = { 0, (uint8_t) (1 + sample % 3), (uint8_t) -1, 0 };
+			produced += (int8_t) report[1];
+			pushSeq = sampleSeq;
+			pushSample = sample;
+			if (c->queued)
+				HIDQUEUE_Push(&q, report);
+			else
+				EP_Send(NULL, report, sizeof(report));
+			if (c->loopUs)
+				readAt = t + SIM_READ_US + c->loopUs;
+		}
+		/* token IN dell'host */
+		if (t == pollAt && ep.loaded) {
+			ep.loaded = 0;
+			received++;
+			consumed += (int8_t) ep.report[1];
+			if (ep.sample != lastSample)
+				fresh++;
+			lastSample = ep.sample;
+			for (; delivered < ep.seq; delivered++)
+				latency[delivered] = t - eventTime[delivered];
+			if (c->queued)
+				HIDQUEUE_Sent(&q);
+		}
+	}
+
+	r.rate = (double) received / SIM_SECONDS;
+	r.fresh = received ? (double) fresh / received : 0;
+	r.lost = produced - consumed;
+	r.merged = q.merged;
+	if (delivered) {
+		double sum = 0;
+		for (uint32_t i = 0; i < delivered; i++)
+			sum += latency[i];
+		r.latMean = sum / delivered;
+		qsort(latency, delivered, sizeof(latency[0]), CompareU32);
+		r.latP99 = latency[delivered * 99 / 100];
+		r.latMax = latency[delivered - 1];
+	}
+	/* lo spostamento ancora in coda o nell'endpoint alla fine della simulazione non e' perso */
+	if (c->queued)
+		for (uint8_t i = q.head; i != q.tail; i++)
+			r.lost -= (int8_t) q.slot[i & (HIDQUEUE_LENGTH - 1)][HIDQUEUE_MOUSE_X];
+	if (ep.loaded)
+		r.lost -= (int8_t) ep.report[1];
+	return r;
+}
+
+int main(void) {
+	static const Config_t config[] = {
+		{ "originale (bInterval 10, 100 Hz, HAL_Delay(50))", 10, 100, 50000, 0 },
+		{ "bassa latenza (bInterval 1, 1600 Hz, SOF)", 1, 1600, 0, 1 },
+	};
+	Result_t r[2];
+
+	printf("%-50s %9s %7s %10s %9s %9s %7s %7s\n", "configurazione", "report/s", "nuovi", "lat. media", "lat. p99",
+			"lat. max", "fusi", "persi");
+	for (int i = 0; i < 2; i++) {
+		r[i] = Simulate(&config[i]);
+		printf("%-50s %9.1f %6.1f%% %8.2fms %7.2fms %7.2fms %7u %7ld\n", config[i].name, r[i].rate, 100 * r[i].fresh,
+				r[i].latMean / 1000, r[i].latP99 / 1000.0, r[i].latMax / 1000.0, (unsigned) r[i].merged, r[i].lost);
+	}
+
+	/* originale: un report ogni 50 ms, mai perso perche' l'endpoint si libera entro 10 ms */
+	CHECK(r[0].rate > 19 && r[0].rate < 21);
+	CHECK(r[0].lost == 0);
+	/* bassa latenza: un report per frame, ciascuno con un campione nuovo. La latenza e' limitata dal periodo di
+	 * campionamento, dall'attesa del SOF e da due frame: il report prodotto resta in coda finche' l'host non preleva
+	 * dall'endpoint quello del frame precedente */
+	CHECK(r[1].rate > 990);
+	CHECK(r[1].fresh > 0.99);
+	CHECK(r[1].latMax <= 625 + 3000 + SIM_READ_US);
+	CHECK(r[1].latMean * 10 < r[0].latMean);
+	CHECK(r[1].lost == 0);
+
+	printf("hidstream: %s\n", failures ? "FAILED" : "OK");
+	return failures != 0;
+}
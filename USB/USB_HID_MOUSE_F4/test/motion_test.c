@@ -0,0 +1,301 @@
+/**
+ * @file motion_test.c
+ * @author 	Salvatore Barone <salvator.barone@gmail.com> ,
+ * 			Alfonso Di Martino <alfonsodimartino160989@gmail.com> ,
+ * 			Sossio Fiorillo <fsossio@gmail.com> ,
+ * 		 	Pietro Liguori <pie.liguori@gmail.com> .
+ *
+ * @date 19 10 2026
+ *
+ * @copyright
+ * This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3 of the License, or any later version.
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+/**
+ * @brief Verifica su host della pipeline MOTION su tracce dell'accelerometro e misura del costo per campione.
+ *
+ * @details
+ * Le tracce sono generate con le caratteristiche del LIS3DSH a 1600 Hz letto una volta per millisecondo: offset di
+ * zero della board (alcune decine di mg), rumore uniforme di +-20 mg, inclinazioni a gradino e a rampa, movimento
+ * casuale della mano (random walk). Su ciascuna traccia sono verificati:
+ *  - la calibrazione dell'offset di zero;
+ *  - l'assenza di movimento con la board a riposo;
+ *  - la conservazione degli spostamenti sub-pixel: la posizione del cursore segue, entro un pixel, quella calcolata
+ *    in virgola mobile con la stessa curva di accelerazione;
+ *  - il limite di +-127 per report e l'arresto del cursore, entro pochi report, quando la board torna orizzontale;
+ *  - la simmetria tra i due versi di movimento.
+ *
+ * Infine viene riportato il costo medio di MOTION_Process() per campione su host, in ns e, su x86, in cicli; sul
+ * target la stessa misura e' disponibile in motionCycles (contatore DWT).
+ * @code
+ * gcc -std=gnu99 -O2 -Wall -Wextra -IInc test/motion_test.c Src/motion.c -o motion_test && ./motion_test
+ * @endcode
+ */
+#include "motion.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <math.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#define TEST_DEAD_ZONE		64			//!< soglia usata dal progetto
+#define TEST_FILTER_SHIFT	3			//!< MOUSE_FILTER_SHIFT del progetto
+#define TEST_CAL_SAMPLES	256			//!< MOUSE_CAL_SAMPLES del progetto
+#define TEST_NOISE_MG		20			//!< ampiezza del rumore del sensore
+#define BENCH_SAMPLES		10000000	//!< campioni elaborati per la misura del costo
+
+static int failures = 0;
+
+#define CHECK(cond) do { if (!(cond)) { printf("%s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+/**
+ * @brief Curva di accelerazione del progetto (mouseCurve).
+ */
+static const MOTION_CurvePoint_t curve[] = {
+	{    0, MOTION_SPEED(0)   },
+	{  250, MOTION_SPEED(0.3) },
+	{  600, MOTION_SPEED(1.3) },
+	{ 1000, MOTION_SPEED(4)   },
+};
+#define N_CURVE (sizeof(curve) / sizeof(curve[0]))
+
+/**
+ * @brief Generatore pseudo-casuale xorshift, per rendere le tracce riproducibili.
+ */
+static uint32_t rng = 12345;
+static uint32_t Random(void) {
+	rng ^= rng << 13;
+	rng ^= rng >> 17;
+	rng ^= rng << 5;
+	return rng;
+}
+
+static int16_t Noise(void) {
+	return (int16_t) ((int32_t) (Random() % (2 * TEST_NOISE_MG + 1)) - TEST_NOISE_MG);
+}
+
+/**
+ * @brief Modello di riferimento in virgola mobile di un asse, con gli stessi parametri della pipeline.
+ */
+typedef struct {
+	double filt;
+	double rest;
+	double pos;		//!< posizione del cursore, somma degli spostamenti trasmessi
+} Ref_t;
+
+static double RefCurve(double tilt) {
+	double mag = (tilt < 0 ? -tilt : tilt) - TEST_DEAD_ZONE;
+	if (mag <= 0)
+		return 0;
+	size_t i = 1;
+	while (i < N_CURVE - 1 && mag > curve[i].tilt)
+		i++;
+	double speed;
+	if (mag >= curve[i].tilt)
+		speed = curve[i].speed;
+	else
+		speed = curve[i - 1].speed + (mag - curve[i - 1].tilt) * (curve[i].speed - curve[i - 1].speed)
+				/ (curve[i].tilt - curve[i - 1].tilt);
+	speed /= MOTION_Q16;
+	return tilt < 0 ? -speed : speed;
+}
+
+static void RefStep(Ref_t* r, double x) {
+	r->filt += (x - r->filt) / (1 << TEST_FILTER_SHIFT);
+	r->rest += RefCurve(r->filt);
+	double max = (double) MOTION_REST_MAX / MOTION_Q16;
+	if (r->rest > max)
+		r->rest = max;
+	else if (r->rest < -max)
+		r->rest = -max;
+	double out = (double) (long) r->rest;
+	if (out > MOTION_REPORT_MAX)
+		out = MOTION_REPORT_MAX;
+	else if (out < -MOTION_REPORT_MAX)
+		out = -MOTION_REPORT_MAX;
+	r->rest -= out;
+	r->pos += out;
+}
+
+/**
+ * @brief Pipeline calibrata su una board ferma con offset (zx, zy).
+ */
+static void Calibrate(MOTION_t* m, int16_t zx, int16_t zy) {
+	int8_t dx, dy;
+	MOTION_Init(m, curve, N_CURVE, TEST_FILTER_SHIFT, TEST_DEAD_ZONE);
+	MOTION_StartCalibration(m, TEST_CAL_SAMPLES);
+	for (int i = 0; i < TEST_CAL_SAMPLES - 1; i++) {
+		CHECK(MOTION_Process(m, zx + Noise(), zy + Noise(), &dx, &dy) == 0);
+		CHECK(dx == 0 && dy == 0);
+	}
+	CHECK(MOTION_Process(m, zx + Noise(), zy + Noise(), &dx, &dy) == 1);
+}
+
+/**
+ * @brief Calibrazione e riposo: nessun movimento con il solo rumore del sensore.
+ */
+static void TestRest(void) {
+	MOTION_t m;
+	int8_t dx, dy;
+	long px = 0, py = 0;
+	Calibrate(&m, 37, -52);
+	CHECK(m.x.zero >= 37 - 2 && m.x.zero <= 37 + 2);
+	CHECK(m.y.zero >= -52 - 2 && m.y.zero <= -52 + 2);
+	for (int i = 0; i < 10000; i++) {
+		MOTION_Process(&m, 37 + Noise(), -52 + Noise(), &dx, &dy);
+		px += dx;
+		py += dy;
+	}
+	printf("riposo: spostamento in 10 s (%ld, %ld)\n", px, py);
+	CHECK(px == 0 && py == 0);
+}
+
+/**
+ * @brief Traccia: confronto con il modello di riferimento e verifica dei limiti per report.
+ * @param[in] name nome della traccia
+ * @param[in] tilt inclinazione (mg, offset escluso) in funzione del campione
+ * @param[in] n numero di campioni
+ */
+static void TestTrace(const char* name, double (*tilt)(int), int n) {
+	MOTION_t m;
+	Ref_t rx = { 0, 0, 0 }, ry = { 0, 0, 0 };
+	int8_t dx, dy;
+	long px = 0, py = 0;
+	double maxErr = 0;
+	int outOfRange = 0;
+	Calibrate(&m, 25, 40);
+	for (int i = 0; i < n; i++) {
+		double t = tilt(i);
+		int16_t sx = (int16_t) (t + Noise()), sy = (int16_t) (-t / 2 + Noise());
+		MOTION_Process(&m, 25 + sx, 40 + sy, &dx, &dy);
+		RefStep(&rx, sx + 25 - m.x.zero);
+		RefStep(&ry, sy + 40 - m.y.zero);
+		px += dx;
+		py += dy;
+		if (dx < -MOTION_REPORT_MAX || dy < -MOTION_REPORT_MAX)
+			outOfRange++;
+		double err = fabs(px - rx.pos) > fabs(py - ry.pos) ? fabs(px - rx.pos) : fabs(py - ry.pos);
+		if (err > maxErr)
+			maxErr = err;
+	}
+	printf("%-24s posizione (%7ld, %7ld), riferimento (%9.1f, %9.1f), errore massimo %.2f px\n", name, px, py,
+			rx.pos, ry.pos, maxErr);
+	CHECK(outOfRange == 0);
+	CHECK(maxErr <= 1.0);
+}
+
+static double TiltSmall(int i) {
+	return i < 5000 ? 120 : 0;			/* appena oltre la zona morta: 0.07 px per report */
+}
+
+static double TiltRamp(int i) {
+	return i < 4000 ? i * 0.3 : 0;		/* da 0 a 1200 mg in 4 s */
+}
+
+static double TiltWalk(int i) {
+	static double w = 0;
+	if (i == 0)
+		w = 0;
+	w += (double) ((int32_t) (Random() % 41) - 20);
+	if (w > 1000)
+		w = 1000;
+	else if (w < -1000)
+		w = -1000;
+	return w;
+}
+
+/**
+ * @brief Saturazione: con una curva molto ripida i report restano entro +-127 e il cursore si ferma entro pochi
+ * report dal ritorno della board in orizzontale.
+ */
+static void TestSaturation(void) {
+	static const MOTION_CurvePoint_t steep[] = { { 0, 0 }, { 100, MOTION_SPEED(300) } };
+	MOTION_t m;
+	int8_t dx, dy;
+	MOTION_Init(&m, steep, 2, 0, TEST_DEAD_ZONE);
+	for (int i = 0; i < 100; i++) {
+		MOTION_Process(&m, 1000, -1000, &dx, &dy);
+		CHECK(dx == MOTION_REPORT_MAX && dy == -MOTION_REPORT_MAX);
+	}
+	int moving = 0;
+	for (int i = 0; i < 100; i++) {
+		MOTION_Process(&m, 0, 0, &dx, &dy);
+		if (dx || dy)
+			moving = i + 1;
+	}
+	printf("saturazione: cursore fermo dopo %d report\n", moving);
+	CHECK(moving <= (int) (MOTION_REST_MAX / MOTION_Q16 / MOTION_REPORT_MAX));
+}
+
+/**
+ * @brief Simmetria: inclinazioni opposte producono spostamenti opposti.
+ */
+static void TestSymmetry(void) {
+	MOTION_t a, b;
+	int8_t ax, ay, bx, by;
+	int mismatch = 0;
+	MOTION_Init(&a, curve, N_CURVE, TEST_FILTER_SHIFT, TEST_DEAD_ZONE);
+	MOTION_Init(&b, curve, N_CURVE, TEST_FILTER_SHIFT, TEST_DEAD_ZONE);
+	for (int i = 0; i < 20000; i++) {
+		int16_t s = (int16_t) TiltWalk(i);
+		MOTION_Process(&a, s, (int16_t) (s / 3), &ax, &ay);
+		MOTION_Process(&b, (int16_t) -s, (int16_t) (-s / 3), &bx, &by);
+		if (ax != -bx || ay != -by)
+			mismatch++;
+	}
+	CHECK(mismatch == 0);
+}
+
+/**
+ * @brief Costo medio di MOTION_Process() per campione.
+ */
+static void Benchmark(void) {
+	static int16_t trace[4096];
+	MOTION_t m;
+	int8_t dx, dy;
+	long sink = 0;
+	for (int i = 0; i < 4096; i++)
+		trace[i] = (int16_t) TiltWalk(i);
+	MOTION_Init(&m, curve, N_CURVE, TEST_FILTER_SHIFT, TEST_DEAD_ZONE);
+
+	struct timespec t0, t1;
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+#if defined(__x86_64__) || defined(__i386__)
+	uint64_t c0 = __rdtsc();
+#endif
+	for (int i = 0; i < BENCH_SAMPLES; i++) {
+		MOTION_Process(&m, trace[i & 4095], trace[(i + 1000) & 4095], &dx, &dy);
+		sink += dx + dy;
+	}
+#if defined(__x86_64__) || defined(__i386__)
+	uint64_t c1 = __rdtsc();
+#endif
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	double ns = ((t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec)) / BENCH_SAMPLES;
+#if defined(__x86_64__) || defined(__i386__)
+	printf("MOTION_Process: %.1f ns, %.1f cicli TSC per campione (x, y) su host [%ld]\n", ns,
+			(double) (c1 - c0) / BENCH_SAMPLES, sink & 1);
+#else
+	printf("MOTION_Process: %.1f ns per campione (x, y) su host [%ld]\n", ns, sink & 1);
+#endif
+}
+
+int main(void) {
+	TestRest();
+	TestTrace("inclinazione piccola", TiltSmall, 8000);
+	TestTrace("rampa fino a 1200 mg", TiltRamp, 6000);
+	TestTrace("movimento casuale", TiltWalk, 60000);
+	TestSaturation();
+	TestSymmetry();
+	Benchmark();
+
+	printf("motion: %s\n", failures ? "FAILED" : "OK");
+	return failures != 0;
+}